@@ -0,0 +1,43 @@
+/* entropy.c -- getentropy from the noise source in pic30-entropy.h.
+
+   arc4random reads 40 bytes at start and once per 65000 bytes it
+   returns after that, so the readings may be slow; the ChaCha20
+   keystream does the rest.  */
+
+#include <errno.h>
+#include <stddef.h>
+#include <unistd.h>
+#include "pic30-entropy.h"
+
+extern unsigned int pic30_entropy_sample (void) __attribute__ ((weak));
+
+int
+getentropy (void *buf,
+	size_t len)
+{
+  unsigned char *p = buf;
+  unsigned char b;
+  int i;
+
+  if (len > 256)
+    {
+      errno = EIO;
+      return -1;
+    }
+  if (!pic30_entropy_sample)
+    {
+      errno = ENOSYS;
+      return -1;
+    }
+  while (len-- > 0)
+    {
+      /* Rotate each reading in, so that the noisy low bits of eight
+	 of them cover the whole byte.  */
+      b = 0;
+      for (i = 0; i < PIC30_ENTROPY_SAMPLES; i++)
+	b = (unsigned char) (((b << 1) | (b >> 7))
+			     ^ pic30_entropy_sample ());
+      *p++ = b;
+    }
+  return 0;
+}
@@ -0,0 +1,260 @@
+/* gmon.c -- the profiling runtime behind gcrt0.o, for gprof.
+
+   Link with gcrt0.o in place of crt0.o and compile with -pg.  Timer1
+   then interrupts PROF_HZ times a second and its handler in gcrt0.S
+   counts the interrupted PC in a histogram of the program memory the
+   linker script gives as __CODE_BASE and __CODE_LENGTH, and the call
+   to _mcount at the start of each function compiled with -pg counts
+   the arc from its caller in a hash table.
+
+   Both are sized when the BSP is built, not from the size of the
+   program: PROF_BINS 16-bit counters, each the smallest power of two
+   of PC units that covers the code with them, and PROF_ARCS arcs,
+   beyond which new arcs are counted as lost.
+
+   At exit the data is written to the console as gmon.out in
+   hexadecimal, between "-- gmon.out --" and "-- end --" lines; there is
+   no file system to write to.  On the host
+
+	sed -n '/^-- gmon.out --$/,/^-- end --$/{//!p}' log | xxd -r -p > gmon.out
+
+   recovers the file.  Its addresses are 32 bits, those of the ELF
+   file, in the PC units of its symbols.  */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Sampling rate and the instruction clock Timer1 counts */
+#ifndef PROF_HZ
+#define PROF_HZ		1000
+#endif
+#ifndef PROF_FCY
+#define PROF_FCY	40000000UL
+#endif
+/* Histogram counters, 2 bytes each */
+#ifndef PROF_BINS
+#define PROF_BINS	512
+#endif
+/* Call graph arcs, 12 bytes each; a power of two */
+#ifndef PROF_ARCS
+#define PROF_ARCS	128
+#endif
+/* Priority of the sampling interrupt, above the code it profiles */
+#ifndef PROF_IPL
+#define PROF_IPL	6
+#endif
+
+#define XSTR(x) STR (x)
+#define STR(x) #x
+
+/* The SFRs are placed by the device linker script */
+#define SFR(x) extern volatile unsigned int x __attribute__ ((__sfr__))
+SFR (T1CON);
+SFR (TMR1);
+SFR (PR1);
+SFR (IPC0);
+
+/* On, instruction clock, 1:1 or 1:8 */
+#define T1CON_ON	0x8000
+#define T1CON_DIV8	0x0010
+/* T1IP in IPC0, T1IF and T1IE are bit 3 of IFS0 and IEC0 */
+#define T1IP_SHIFT	12
+#define T1_BIT		3
+
+#define PROF_PERIOD	(PROF_FCY / PROF_HZ)
+
+#define GMON_MAGIC	"gmon"
+#define GMON_VERSION	1
+#define GMON_TAG_TIME_HIST	0
+#define GMON_TAG_CG_ARC		1
+
+struct arc
+{
+  unsigned long frompc;
+  unsigned long selfpc;
+  unsigned long count;
+};
+
+/* Read by the sampling handler in gcrt0.S */
+unsigned long __prof_lowpc;
+unsigned int __prof_shift;
+unsigned int __prof_nbins;
+unsigned short __prof_kcount[PROF_BINS];
+
+static struct arc prof_arcs[PROF_ARCS];
+static unsigned long prof_arcs_lost;
+
+/* 0 off, 1 on, 2 inside _mcount_internal */
+static volatile unsigned char prof_state;
+
+void _mcount_internal (unsigned long, unsigned long);
+void _monstartup (unsigned long, unsigned long);
+void _mcleanup (void);
+
+/* Called by _mcount in gcrt0.S with the return address of the function
+   being entered, in its caller, and its own address.  */
+void
+_mcount_internal (unsigned long frompc,
+	unsigned long selfpc)
+{
+  unsigned int i, n;
+
+  /* an instrumented interrupt handler, or this was never started */
+  if (prof_state != 1)
+    return;
+  prof_state = 2;
+
+  i = ((unsigned int) frompc ^ (unsigned int) (frompc >> 16)
+       ^ (unsigned int) selfpc) >> 1;
+  for (n = 0; n < PROF_ARCS; ++n, ++i)
+    {
+      struct arc *a = &prof_arcs[i & (PROF_ARCS - 1)];
+
+      if (a->count == 0)
+	{
+	  a->frompc = frompc;
+	  a->selfpc = selfpc;
+	}
+      else if (a->frompc != frompc || a->selfpc != selfpc)
+	continue;
+      ++a->count;
+      goto done;
+    }
+  ++prof_arcs_lost;
+
+done:
+  prof_state = 1;
+}
+
+/* Called by gcrt0.o before main with the bounds of program memory.  */
+void
+_monstartup (unsigned long lowpc,
+	unsigned long textsize)
+{
+  if (textsize != 0)
+    {
+      /* at least one instruction word, 2 PC units, to a counter */
+      for (__prof_shift = 1;
+	   (textsize >> __prof_shift) >= PROF_BINS;
+	   ++__prof_shift)
+	;
+      __prof_nbins = (unsigned int) ((textsize + (1UL << __prof_shift) - 1)
+				     >> __prof_shift);
+      __prof_lowpc = lowpc;
+      memset (__prof_kcount, 0, sizeof __prof_kcount);
+
+      T1CON = 0;
+      TMR1 = 0;
+#if PROF_PERIOD > 0x10000
+      PR1 = PROF_PERIOD / 8 - 1;
+#else
+      PR1 = PROF_PERIOD - 1;
+#endif
+      IPC0 = (IPC0 & ~(7u << T1IP_SHIFT)) | (PROF_IPL << T1IP_SHIFT);
+      __asm__ volatile ("bclr\tIFS0, #" XSTR (T1_BIT) "\n\t"
+			"bset\tIEC0, #" XSTR (T1_BIT) : : : "memory");
+#if PROF_PERIOD > 0x10000
+      T1CON = T1CON_ON | T1CON_DIV8;
+#else
+      T1CON = T1CON_ON;
+#endif
+    }
+  memset (prof_arcs, 0, sizeof prof_arcs);
+  prof_arcs_lost = 0;
+  prof_state = 1;
+  atexit (_mcleanup);
+}
+
+static const char hexdigit[] = "0123456789abcdef";
+
+struct hexout
+{
+  unsigned int n;
+  char line[2 * 32 + 1];
+};
+
+static void
+hex_bytes (struct hexout *h,
+	const void *p,
+	unsigned int len)
+{
+  const unsigned char *s = p;
+
+  while (len-- > 0)
+    {
+      h->line[h->n++] = hexdigit[*s >> 4];
+      h->line[h->n++] = hexdigit[*s++ & 15];
+      if (h->n == sizeof h->line - 1)
+	{
+	  h->line[h->n++] = '\n';
+	  write (1, h->line, h->n);
+	  h->n = 0;
+	}
+    }
+}
+
+/* Little endian, as gprof reads the file for this target.  */
+static void
+hex_word (struct hexout *h,
+	unsigned long v)
+{
+  hex_bytes (h, &v, 4);
+}
+
+void
+_mcleanup (void)
+{
+  static const char magic[] = GMON_MAGIC;
+  static const char dimen[15] = "seconds";
+  struct hexout h;
+  unsigned int i;
+  char c;
+
+  if (prof_state == 0)
+    return;
+  T1CON = 0;
+  __asm__ volatile ("bclr\tIEC0, #" XSTR (T1_BIT) : : : "memory");
+  prof_state = 0;
+
+  write (1, "\n-- gmon.out --\n", 16);
+  h.n = 0;
+  hex_bytes (&h, magic, 4);
+  hex_word (&h, GMON_VERSION);
+  for (i = 0; i < 3; ++i)
+    hex_word (&h, 0);
+
+  if (__prof_nbins != 0)
+    {
+      c = GMON_TAG_TIME_HIST;
+      hex_bytes (&h, &c, 1);
+      hex_word (&h, __prof_lowpc);
+      hex_word (&h, __prof_lowpc
+		+ ((unsigned long) __prof_nbins << __prof_shift));
+      hex_word (&h, __prof_nbins);
+      hex_word (&h, PROF_HZ);
+      hex_bytes (&h, dimen, sizeof dimen);
+      c = 's';
+      hex_bytes (&h, &c, 1);
+      hex_bytes (&h, __prof_kcount, 2 * __prof_nbins);
+    }
+
+  for (i = 0; i < PROF_ARCS; ++i)
+    if (prof_arcs[i].count != 0)
+      {
+	c = GMON_TAG_CG_ARC;
+	hex_bytes (&h, &c, 1);
+	hex_word (&h, prof_arcs[i].frompc);
+	hex_word (&h, prof_arcs[i].selfpc);
+	hex_word (&h, prof_arcs[i].count);
+      }
+
+  if (h.n != 0)
+    {
+      h.line[h.n++] = '\n';
+      write (1, h.line, h.n);
+    }
+  write (1, "-- end --\n", 10);
+  if (prof_arcs_lost != 0)
+    write (2, "_mcleanup: call graph arcs lost, raise PROF_ARCS\n", 49);
+}
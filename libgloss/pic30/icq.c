@@ -0,0 +1,182 @@
+/* icq.c -- message queues between the cores of a dsPIC33CH or CK, see
+   pic30-icq.h.
+
+   msi.c frames each message on the channel of its queue and hands the
+   frames that arrive to __icq_deliver, which copies each message, its
+   length first, into the ring of its queue in one ring_write.  The
+   ring is the lock-free one of <machine/ring.h>: __icq_deliver, run by
+   whoever holds the receiving end of the FIFO, is its only producer
+   and the reader of the queue its only consumer, and a message is
+   published whole.  The reserved buffer is handed out by an
+   atomic_flag.
+
+   Waits are counted in microseconds of REPEAT delays from ICQ_FCY, as
+   the receive timeout of uart.c is.  */
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <machine/ring.h>
+#include "pic30-icq.h"
+
+/* In msi.c */
+extern void __msi_pump (void);
+extern int __msi_frame (unsigned int, const void *, unsigned int);
+
+/* A power of two, holding at least one message and its length */
+#ifndef ICQ_RX_SIZE
+#define ICQ_RX_SIZE	128
+#endif
+/* Instruction clock, for the timeouts */
+#ifndef ICQ_FCY
+#define ICQ_FCY		40000000UL
+#endif
+
+/* REPEAT counts to 16383 at most on the older families */
+#define US_CYCLES	(ICQ_FCY / 1000000UL)
+#define US_REPEAT	(US_CYCLES > 16 ? US_CYCLES - 12 : 4)
+
+static unsigned char rx_buf[ICQ_QUEUES][ICQ_RX_SIZE];
+static struct ring rx[ICQ_QUEUES] =
+{
+  RING_INITIALIZER (rx_buf[0]), RING_INITIALIZER (rx_buf[1]),
+  RING_INITIALIZER (rx_buf[2]), RING_INITIALIZER (rx_buf[3])
+};
+static unsigned char reserved[ICQ_MSG_MAX];
+static atomic_flag reserved_owned = ATOMIC_FLAG_INIT;
+volatile unsigned long icq_dropped;
+
+static void
+delay_us (void)
+{
+  __asm__ volatile ("repeat\t#%0\n\tnop" : : "i" (US_REPEAT));
+}
+
+static struct ring *
+queue (int q)
+{
+  return q >= 1 && q <= ICQ_QUEUES ? &rx[q - 1] : NULL;
+}
+
+void
+__icq_deliver (unsigned int q,
+	const unsigned char *msg,
+	unsigned int len)
+{
+  unsigned char rec[1 + ICQ_MSG_MAX];
+  struct ring *r = queue (q);
+  unsigned int i;
+
+  if (r == NULL || len > ICQ_MSG_MAX)
+    return;
+  rec[0] = len;
+  for (i = 0; i < len; i++)
+    rec[1 + i] = msg[i];
+  if (ring_write (r, rec, len + 1) == 0)
+    icq_dropped++;
+}
+
+void
+icq_poll (void)
+{
+  __msi_pump ();
+}
+
+/* Whether a wait of TIMEOUT_MS that has lasted *US microseconds is
+   over, setting errno if it is.  */
+static int
+expired (int timeout_ms,
+	unsigned long *us)
+{
+  if (timeout_ms == 0)
+    {
+      errno = EAGAIN;
+      return 1;
+    }
+  if (timeout_ms != ICQ_FOREVER
+      && (*us)++ >= (unsigned long) timeout_ms * 1000)
+    {
+      errno = ETIMEDOUT;
+      return 1;
+    }
+  delay_us ();
+  return 0;
+}
+
+int
+icq_send (int q,
+	const void *msg,
+	size_t len,
+	int timeout_ms)
+{
+  unsigned long us = 0;
+
+  if (q < 1 || q > ICQ_QUEUES)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  if (len > ICQ_MSG_MAX)
+    {
+      errno = EMSGSIZE;
+      return -1;
+    }
+  while (__msi_frame (q, msg, len) != 0)
+    if (expired (timeout_ms, &us))
+      return -1;
+  return 0;
+}
+
+int
+icq_recv (int q,
+	void *buf,
+	size_t size,
+	int timeout_ms)
+{
+  struct ring *r = queue (q);
+  unsigned char *b = (unsigned char *) buf;
+  unsigned long us = 0;
+  unsigned int len, i;
+  int c;
+
+  if (r == NULL)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  for (;;)
+    {
+      __msi_pump ();
+      if (ring_count (r) != 0)
+	break;
+      if (expired (timeout_ms, &us))
+	return -1;
+    }
+  /* The length and the message were published together.  */
+  len = ring_get (r);
+  for (i = 0; i < len && (c = ring_get (r)) >= 0; i++)
+    if (i < size)
+      b[i] = c;
+  return len;
+}
+
+void *
+icq_reserve (void)
+{
+  if (atomic_flag_test_and_set (&reserved_owned))
+    {
+      errno = EBUSY;
+      return NULL;
+    }
+  return reserved;
+}
+
+int
+icq_commit (int q,
+	size_t len,
+	int timeout_ms)
+{
+  int ret = icq_send (q, reserved, len, timeout_ms);
+
+  atomic_flag_clear (&reserved_owned);
+  return ret;
+}
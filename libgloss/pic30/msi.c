@@ -0,0 +1,450 @@
+/* msi.c -- the console of the secondary core of a dsPIC33CH, carried
+   over the MSI FIFOs by the primary core, see pic30-msi.h, and the
+   transport under the message queues of icq.c.
+
+   Built twice.  msi.o, in libsim.a, is the primary's end:
+   pic30_msi_service takes what the secondary has written out of the
+   secondary-write FIFO and hands it to the primary's own _write, and
+   pic30_msi_send feeds the primary-write FIFO for the secondary's
+   _read.  msi-secondary.o, built with MSI_SECONDARY, takes the place
+   of uart.o in libmsi.a, for the secondary, which has no UART.
+
+   Each FIFO carries frames: a word with the channel in its top four
+   bits and the count of bytes below, then the bytes two to a word, low
+   byte first, so that an odd count survives the 16-bit FIFO.  Channel
+   0 is the console, whose frames hold 1 to MSI_BATCH bytes; the others
+   are the queues of icq.c, a message to a frame.  A console frame may
+   be split wherever the FIFO fills, and the reader keeps its place
+   across calls; a message frame is only started into an empty FIFO,
+   which holds all of it.
+
+   Each FIFO has one writer and one reader, on the two cores, and its
+   full and empty flags are all the flow control there is; the
+   mailboxes are left to the program.  On each core an atomic_flag
+   keeps the writers of the FIFO it writes, and another the readers of
+   the one it reads, from splitting each other's frames: a thread or an
+   interrupt handler that finds the flag taken leaves the work to the
+   one holding it, or tries again.  So no lock is waited on, and the
+   secondary waits on the primary only when its ring fills under
+   PIC30_MSI_BLOCK: _write copies into the ring and moves what fits
+   into the FIFO, and the rest follows on the next _write or on
+   pic30_msi_flush.
+
+   The register names and the flag bits are those of the
+   dsPIC33CH128MP508 family and can be overridden when the BSP is
+   built.  */
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <machine/ring.h>
+#include "pic30-msi.h"
+#include "poll.h"
+
+extern int _write (int, char *, int);
+/* In icq.c, which only a program that uses the queues links.  */
+extern void __icq_deliver (unsigned int, const unsigned char *,
+			   unsigned int) __attribute__ ((weak));
+
+#ifndef MSI_BATCH
+#define MSI_BATCH	64
+#endif
+/* Powers of two */
+#ifndef MSI_TX_SIZE
+#define MSI_TX_SIZE	128
+#endif
+#ifndef MSI_RX_SIZE
+#define MSI_RX_SIZE	128
+#endif
+
+/* The largest message, which with its frame word fills the FIFO.  */
+#define MSI_MSG_MAX	62
+
+#ifdef MSI_SECONDARY
+#ifndef MSI_FIFOCS
+#define MSI_FIFOCS	SI1FIFOCS
+#endif
+#ifndef MSI_TXDATA
+#define MSI_TXDATA	SWMRFDATA
+#define MSI_RXDATA	MWSRFDATA
+#endif
+#else
+#ifndef MSI_FIFOCS
+#define MSI_FIFOCS	MSI1FIFOCS
+#endif
+#ifndef MSI_TXDATA
+#define MSI_TXDATA	MWSRFDATA
+#define MSI_RXDATA	SWMRFDATA
+#endif
+#endif
+
+/* In MSI_FIFOCS, on both cores: enable, full and empty of the FIFO
+   the secondary writes, then of the one the primary writes.  */
+#ifndef MSI_SWFEN
+#define MSI_SWFEN	0x8000
+#define MSI_SWFFULL	0x0400
+#define MSI_SWFEMPTY	0x0200
+#define MSI_MWFEN	0x0080
+#define MSI_MWFFULL	0x0004
+#define MSI_MWFEMPTY	0x0002
+#endif
+
+#ifdef MSI_SECONDARY
+#define TX_FULL		MSI_SWFFULL
+#define TX_EMPTY	MSI_SWFEMPTY
+#define RX_EMPTY	MSI_MWFEMPTY
+#define TX_READY	MSI_SWFEN
+#else
+#define TX_FULL		MSI_MWFFULL
+#define TX_EMPTY	MSI_MWFEMPTY
+#define RX_EMPTY	MSI_SWFEMPTY
+#define TX_READY	MSI_MWFEN
+#endif
+
+/* The SFRs are placed by the device linker script */
+#define SFR(x) extern volatile unsigned int x __attribute__ ((__sfr__))
+SFR (MSI_FIFOCS);
+SFR (MSI_TXDATA);
+SFR (MSI_RXDATA);
+
+#define CAN_PUT()	((MSI_FIFOCS & (TX_READY | TX_FULL)) == TX_READY)
+#define CAN_GET()	(!(MSI_FIFOCS & RX_EMPTY))
+#define TX_IDLE()	((MSI_FIFOCS & (TX_READY | TX_EMPTY)) \
+			 == (TX_READY | TX_EMPTY))
+
+#define FRAME(chan, n)	(((chan) << 12) | (n))
+
+static atomic_flag tx_owned = ATOMIC_FLAG_INIT;
+static atomic_flag rx_owned = ATOMIC_FLAG_INIT;
+
+static unsigned int tx_left;	/* bytes of the console frame still to go */
+
+static unsigned int rx_left;	/* bytes of the frame still to come */
+static unsigned int rx_chan;
+static unsigned int rx_len;	/* bytes of a message so far */
+static unsigned char rx_msg[MSI_MSG_MAX];
+
+/* The console bytes that have arrived.  */
+static unsigned char con_buf[MSI_RX_SIZE];
+static struct ring con_rx = RING_INITIALIZER (con_buf);
+
+static void
+rx_byte (unsigned int c)
+{
+  rx_left--;
+  if (rx_chan == 0)
+    ring_put (&con_rx, c);
+  else if (rx_len < MSI_MSG_MAX)
+    rx_msg[rx_len++] = c;
+}
+
+/* Move what has arrived to the console ring and the queues, until the
+   FIFO is empty or the console ring is full.  */
+void
+__msi_pump (void)
+{
+  unsigned int w;
+
+  if (atomic_flag_test_and_set (&rx_owned))
+    return;
+  while (CAN_GET ())
+    {
+      if (rx_left == 0)
+	{
+	  w = MSI_RXDATA;
+	  rx_chan = w >> 12;
+	  rx_left = w & 0xfff;
+	  rx_len = 0;
+	}
+      else if (rx_chan == 0 && ring_space (&con_rx) < 2)
+	break;
+      else
+	{
+	  w = MSI_RXDATA;
+	  rx_byte (w & 0xff);
+	  if (rx_left != 0)
+	    rx_byte (w >> 8);
+	}
+      if (rx_left == 0 && rx_chan != 0 && __icq_deliver)
+	__icq_deliver (rx_chan, rx_msg, rx_len);
+    }
+  atomic_flag_clear (&rx_owned);
+}
+
+/* Put LEN bytes from PTR in the FIFO as one frame if it is idle and
+   no console frame is under way, and return 0; return -1 if not.  */
+int
+__msi_frame (unsigned int chan,
+	const void *ptr,
+	unsigned int len)
+{
+  const unsigned char *p = (const unsigned char *) ptr;
+  unsigned int n, w;
+
+  if (len > MSI_MSG_MAX || atomic_flag_test_and_set (&tx_owned))
+    return -1;
+  if (tx_left != 0 || !TX_IDLE ())
+    {
+      atomic_flag_clear (&tx_owned);
+      return -1;
+    }
+  MSI_TXDATA = FRAME (chan, len);
+  for (n = 0; n < len; n += 2)
+    {
+      w = p[n];
+      if (n + 1 < len)
+	w |= (unsigned int) p[n + 1] << 8;
+      MSI_TXDATA = w;
+    }
+  atomic_flag_clear (&tx_owned);
+  return 0;
+}
+
+#ifndef MSI_SECONDARY
+
+void
+pic30_msi_init (void)
+{
+  MSI_FIFOCS |= MSI_SWFEN | MSI_MWFEN;
+}
+
+int
+pic30_msi_service (void)
+{
+  char buf[MSI_BATCH];
+  unsigned int n;
+  int total = 0;
+
+  for (;;)
+    {
+      __msi_pump ();
+      if ((n = ring_read (&con_rx, buf, sizeof buf)) == 0)
+	return total;
+      _write (1, buf, n);
+      total += n;
+    }
+}
+
+int
+pic30_msi_send (const char *ptr,
+	unsigned int len)
+{
+  const unsigned char *p = (const unsigned char *) ptr;
+  unsigned int n, w;
+
+  while (atomic_flag_test_and_set (&tx_owned))
+    ;
+  for (n = 0; n < len; )
+    {
+      while (!CAN_PUT ())
+	;
+      if (tx_left == 0)
+	{
+	  tx_left = len - n < MSI_BATCH ? len - n : MSI_BATCH;
+	  MSI_TXDATA = FRAME (0, tx_left);
+	  continue;
+	}
+      w = p[n++];
+      if (--tx_left != 0)
+	{
+	  w |= (unsigned int) p[n++] << 8;
+	  tx_left--;
+	}
+      MSI_TXDATA = w;
+    }
+  atomic_flag_clear (&tx_owned);
+  return len;
+}
+
+#else /* MSI_SECONDARY */
+
+#define TX_MASK		(MSI_TX_SIZE - 1)
+
+static unsigned char tx_buf[MSI_TX_SIZE];
+static unsigned int tx_head;	/* bytes written */
+static unsigned int tx_tail;	/* bytes gone into the FIFO */
+static int tx_policy = PIC30_MSI_BLOCK;
+volatile unsigned long pic30_msi_dropped;
+
+/* Read by poll.c */
+volatile unsigned char __pic30_uart_polled;
+
+/* Move what fits of the ring into the FIFO.  */
+static void
+tx_push (void)
+{
+  unsigned int w;
+
+  if (atomic_flag_test_and_set (&tx_owned))
+    return;
+  while (CAN_PUT ())
+    {
+      if (tx_left == 0)
+	{
+	  if ((tx_left = tx_head - tx_tail) == 0)
+	    break;
+	  if (tx_left > MSI_BATCH)
+	    tx_left = MSI_BATCH;
+	  MSI_TXDATA = FRAME (0, tx_left);
+	  continue;
+	}
+      w = tx_buf[tx_tail++ & TX_MASK];
+      if (--tx_left != 0)
+	{
+	  w |= (unsigned int) tx_buf[tx_tail++ & TX_MASK] << 8;
+	  tx_left--;
+	}
+      MSI_TXDATA = w;
+    }
+  atomic_flag_clear (&tx_owned);
+}
+
+/* Copy LEN bytes into the ring; dropped bytes count as taken.  */
+static unsigned int
+tx_put (const char *ptr,
+	unsigned int len)
+{
+  unsigned int done = 0, room, at, n;
+
+  while (done < len)
+    {
+      if ((room = MSI_TX_SIZE - (tx_head - tx_tail)) == 0)
+	{
+	  if (tx_policy == PIC30_MSI_DROP)
+	    {
+	      pic30_msi_dropped += len - done;
+	      return len;
+	    }
+	  tx_push ();
+	  continue;
+	}
+      at = tx_head & TX_MASK;
+      n = len - done;
+      if (n > room)
+	n = room;
+      if (n > MSI_TX_SIZE - at)
+	n = MSI_TX_SIZE - at;
+      memcpy (&tx_buf[at], ptr + done, n);
+      tx_head += n;
+      done += n;
+    }
+  return done;
+}
+
+int
+pic30_msi_overflow (int policy)
+{
+  int old = tx_policy;
+
+  tx_policy = policy;
+  return old;
+}
+
+void
+pic30_msi_flush (void)
+{
+  while (tx_head != tx_tail || tx_left != 0)
+    tx_push ();
+}
+
+int
+_write (int file,
+	char *ptr,
+	int len)
+{
+  unsigned int n;
+
+  if (file != 1 && file != 2)
+    {
+      errno = EBADF;
+      return -1;
+    }
+  n = tx_put (ptr, len);
+  tx_push ();
+  return n;
+}
+
+ssize_t
+_writev (int file,
+	const struct iovec *iov,
+	int iovcnt)
+{
+  ssize_t len = 0;
+  int i;
+
+  if (file != 1 && file != 2)
+    {
+      errno = EBADF;
+      return -1;
+    }
+  for (i = 0; i < iovcnt; i++)
+    len += tx_put (iov[i].iov_base, iov[i].iov_len);
+  tx_push ();
+  return len;
+}
+
+/* Wait for the first byte, then take everything that has come.  */
+int
+_read (int file,
+	char *ptr,
+	int len)
+{
+  unsigned int n;
+
+  if (file != 0)
+    {
+      errno = EBADF;
+      return -1;
+    }
+  if (len <= 0)
+    return 0;
+  for (;;)
+    {
+      __msi_pump ();
+      if ((n = ring_read (&con_rx, ptr, len)) != 0)
+	return n;
+      tx_push ();
+    }
+}
+
+int
+__console_putc (int c)
+{
+  char b = c;
+
+  _write (1, &b, 1);
+  return (unsigned char) b;
+}
+
+int
+__console_getc (void)
+{
+  unsigned char c;
+
+  return _read (0, (char *) &c, 1) == 1 ? c : -1;
+}
+
+/* What of EVENTS is ready on console descriptor FILE, for poll.  */
+short
+__pic30_uart_revents (int file,
+	short events)
+{
+  short revents = 0;
+
+  if (file == 0)
+    {
+      __msi_pump ();
+      if ((events & POLLIN) && ring_count (&con_rx) != 0)
+	revents |= POLLIN;
+    }
+  else
+    {
+      tx_push ();
+      if ((events & POLLOUT) && MSI_TX_SIZE != tx_head - tx_tail)
+	revents |= POLLOUT;
+    }
+  return revents;
+}
+
+#endif /* MSI_SECONDARY */
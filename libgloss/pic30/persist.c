@@ -0,0 +1,167 @@
+/* persist.c -- the keyed arena of pic30-persist.h.
+
+   The arena is a header followed by blocks, each a key and a size in
+   bytes, rounded up to a word, then the data:
+
+	magic	PERSIST_MAGIC
+	size	bytes in the arena
+	top	bytes in use, header included
+	sum	Fletcher-16 of the three words above and of the key and
+		size of every block
+
+   Blocks are only ever added at top, so the header and the sum are
+   rewritten once per new block and never on a lookup.  */
+
+#include <errno.h>
+#include <string.h>
+#include "pic30-persist.h"
+
+extern unsigned char __persist_arena[] __attribute__ ((weak));
+extern const size_t __persist_arena_size __attribute__ ((weak));
+
+#define PERSIST_MAGIC	0x5045
+
+struct persist_hdr
+{
+  unsigned int magic;
+  unsigned int size;
+  unsigned int top;
+  unsigned int sum;
+};
+
+struct persist_blk
+{
+  unsigned int key;
+  unsigned int size;
+};
+
+#define BLK_SPAN(size)	(sizeof (struct persist_blk) + (((size) + 1) & ~1U))
+
+/* 0 until the arena is first looked at after a reset, then 1 if it
+   was cleared and 2 if it was kept; in .bss, so every reset starts
+   over.  */
+static unsigned char state;
+
+static void
+fletcher (unsigned int *s1,
+	unsigned int *s2,
+	unsigned int w)
+{
+  *s1 = (*s1 + (w & 0xff) + (w >> 8)) % 255;
+  *s2 = (*s2 + *s1) % 255;
+}
+
+/* The sum of the header so far, or 0xffff, which no Fletcher-16 sum
+   gives, if the blocks do not end exactly at top.  */
+static unsigned int
+persist_sum (const struct persist_hdr *h)
+{
+  const unsigned char *base = (const unsigned char *) h;
+  const struct persist_blk *b;
+  unsigned int s1 = 0, s2 = 0, off;
+
+  fletcher (&s1, &s2, h->magic);
+  fletcher (&s1, &s2, h->size);
+  fletcher (&s1, &s2, h->top);
+  if (h->top > h->size)
+    return 0xffff;
+  for (off = sizeof *h; off < h->top; off += BLK_SPAN (b->size))
+    {
+      if (h->top - off < sizeof *b)
+	return 0xffff;
+      b = (const struct persist_blk *) (base + off);
+      if (b->size > h->top - off - sizeof *b)
+	return 0xffff;
+      fletcher (&s1, &s2, b->key);
+      fletcher (&s1, &s2, b->size);
+    }
+  return off == h->top ? (s2 << 8) | s1 : 0xffff;
+}
+
+void
+persist_reset (void)
+{
+  struct persist_hdr *h = (struct persist_hdr *) __persist_arena;
+
+  if (!__persist_arena || __persist_arena_size < sizeof *h)
+    return;
+  h->magic = PERSIST_MAGIC;
+  h->size = __persist_arena_size;
+  h->top = sizeof *h;
+  h->sum = persist_sum (h);
+  state = 1;
+}
+
+/* The header, checked once after each reset; NULL if there is no
+   arena.  */
+static struct persist_hdr *
+persist_arena (void)
+{
+  struct persist_hdr *h = (struct persist_hdr *) __persist_arena;
+
+  if (!__persist_arena || __persist_arena_size < sizeof *h)
+    return NULL;
+  if (state == 0)
+    {
+      if (h->magic == PERSIST_MAGIC && h->size == __persist_arena_size
+	  && h->sum == persist_sum (h))
+	state = 2;
+      else
+	persist_reset ();
+    }
+  return h;
+}
+
+int
+persist_warm (void)
+{
+  return persist_arena () != NULL && state == 2;
+}
+
+void *
+persist_alloc (unsigned int key,
+	size_t size)
+{
+  struct persist_hdr *h = persist_arena ();
+  unsigned char *base = (unsigned char *) h;
+  struct persist_blk *b;
+  unsigned int off, avail;
+
+  if (h == NULL)
+    {
+      errno = ENOMEM;
+      return NULL;
+    }
+  if (key == 0)
+    {
+      errno = EINVAL;
+      return NULL;
+    }
+  for (off = sizeof *h; off < h->top; off += BLK_SPAN (b->size))
+    {
+      b = (struct persist_blk *) (base + off);
+      if (b->key == key)
+	{
+	  if (b->size != size)
+	    {
+	      errno = EINVAL;
+	      return NULL;
+	    }
+	  return b + 1;
+	}
+    }
+  avail = h->size - h->top;
+  if (avail < sizeof *b
+      || size / 2 + (size & 1) > (avail - sizeof *b) / 2)
+    {
+      errno = ENOMEM;
+      return NULL;
+    }
+  b = (struct persist_blk *) (base + h->top);
+  b->key = key;
+  b->size = size;
+  memset (b + 1, 0, size);
+  h->top += BLK_SPAN (size);
+  h->sum = persist_sum (h);
+  return b + 1;
+}
@@ -0,0 +1,24 @@
+/* pic30-entropy.h -- the noise source behind getentropy.  */
+
+#ifndef _PIC30_ENTROPY_H_
+#define _PIC30_ENTROPY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A reading whose low bits are noise: an ADC conversion of an open
+   input or of the temperature sensor, or a timer clocked from the
+   main oscillator read in an interrupt from the LPRC watchdog.  The
+   program defines it; without it getentropy fails with ENOSYS and
+   arc4random stops the program.  getentropy folds PIC30_ENTROPY_SAMPLES readings
+   into each byte it returns.  */
+extern unsigned int pic30_entropy_sample (void);
+
+#define PIC30_ENTROPY_SAMPLES	8
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_ENTROPY_H_ */
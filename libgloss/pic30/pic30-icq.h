@@ -0,0 +1,64 @@
+/* pic30-icq.h -- message queues between the two cores of a dsPIC33CH
+   or dsPIC33CK, over the MSI FIFOs that also carry the secondary's
+   console, see pic30-msi.h.
+
+   A message is 0 to ICQ_MSG_MAX bytes and arrives whole or not at all,
+   in the order sent on its queue.  The cores share no data memory, so
+   a message is copied through the FIFO; each queue buffers what has
+   arrived on the receiving core until icq_recv takes it, and a message
+   that does not fit there is dropped and counted in icq_dropped.
+
+   Each queue has one reader, a task or an interrupt handler, on the
+   receiving core.  Any number may send, but a handler should give a
+   TIMEOUT of 0, since the FIFO may be in use by the task it
+   interrupted.  Messages move when icq_poll runs: icq_recv calls it
+   while it waits, and the interrupt of the FIFO may call it as well.
+   The primary enables the FIFOs with pic30_msi_init, and the secondary
+   links libmsi.a.  */
+
+#ifndef _PIC30_ICQ_H_
+#define _PIC30_ICQ_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Queues are numbered 1 to ICQ_QUEUES, the same on both cores.  */
+#define ICQ_QUEUES	4
+
+#define ICQ_MSG_MAX	62
+
+/* TIMEOUT_MS for waiting as long as it takes.  */
+#define ICQ_FOREVER	(-1)
+
+/* Send LEN bytes at MSG on queue Q and return 0, or return -1 and set
+   errno: EINVAL for a bad Q, EMSGSIZE for LEN over ICQ_MSG_MAX, EAGAIN
+   if the FIFO is busy and TIMEOUT_MS is 0, ETIMEDOUT if it stays busy
+   for TIMEOUT_MS.  */
+extern int icq_send (int q, const void *msg, size_t len, int timeout_ms);
+
+/* Take the oldest message on queue Q into BUF and return its length,
+   waiting up to TIMEOUT_MS for one, or return -1 and set errno as for
+   icq_send.  A message longer than SIZE is cut to SIZE bytes.  */
+extern int icq_recv (int q, void *buf, size_t size, int timeout_ms);
+
+/* Return a buffer of ICQ_MSG_MAX bytes to build a message in, or NULL
+   with errno EBUSY while another is reserved.  icq_commit sends LEN
+   bytes of it, as icq_send, and gives it back either way, so the
+   message goes from where it was built straight into the FIFO.  */
+extern void *icq_reserve (void);
+extern int icq_commit (int q, size_t len, int timeout_ms);
+
+/* Move the messages that have arrived to their queues.  */
+extern void icq_poll (void);
+
+/* Messages that arrived with no room on their queue.  */
+extern volatile unsigned long icq_dropped;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_ICQ_H_ */
@@ -0,0 +1,48 @@
+/* pic30-msi.h -- the console of the secondary core of a dsPIC33CH,
+   carried over the MSI FIFOs by the primary core.  */
+
+#ifndef _PIC30_MSI_H_
+#define _PIC30_MSI_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* On the primary, in libsim.a.  */
+
+/* Enable the FIFOs and start taking what the secondary writes.  */
+extern void pic30_msi_init (void);
+
+/* Pass what the secondary has written so far to the primary's own
+   _write on descriptor 1, and return the number of bytes.  Call it
+   from the main loop, or from the FIFO interrupt if the UART is not
+   under PIC30_UART_BLOCK, so that the handler never waits.  */
+extern int pic30_msi_service (void);
+
+/* Queue LEN bytes at PTR for the _read of the secondary, waiting for
+   room in the FIFO, and return LEN.  */
+extern int pic30_msi_send (const char *ptr, unsigned int len);
+
+/* On the secondary, in libmsi.a, which it links instead of libsim.a.
+   _write, _writev and _read on the console descriptors go through
+   the FIFOs, and pic30_uart_init is not there.  */
+
+/* What _write does when its ring is full.  */
+#define PIC30_MSI_BLOCK		0	/* wait for the primary to make room */
+#define PIC30_MSI_DROP		1	/* discard the new bytes */
+
+/* Select the overflow policy, returning the previous one.  The
+   default is PIC30_MSI_BLOCK.  */
+extern int pic30_msi_overflow (int policy);
+
+/* Bytes discarded under PIC30_MSI_DROP.  */
+extern volatile unsigned long pic30_msi_dropped;
+
+/* Wait until everything written has gone into the FIFO.  */
+extern void pic30_msi_flush (void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_MSI_H_ */
@@ -0,0 +1,52 @@
+/* pic30-persist.h -- memory that survives a warm reset.  */
+
+#ifndef _PIC30_PERSIST_H_
+#define _PIC30_PERSIST_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Persistent variables have no .dinit record, so crt0 leaves them as
+   they were across a watchdog, software or MCLR reset.  A program
+   puts one arena of SIZE bytes there with
+
+	PIC30_PERSIST_ARENA (512);
+
+   at file scope, and carves it into blocks named by a nonzero KEY.
+   The arena starts with a header whose check word also covers the
+   key and size of every block; on first use after a reset, an arena
+   whose header does not add up, as after power-up, or that is not
+   SIZE bytes, is cleared out.  Only the headers are checked: a block
+   that must be trusted after, say, a crash in the middle of updating
+   it should carry its own check.
+
+   The arena is not locked; allocate from it in one thread, typically
+   early in main.  */
+#define PIC30_PERSIST_ARENA(size) \
+  unsigned char __persist_arena[size] \
+    __attribute__ ((persistent, aligned (2))); \
+  const size_t __persist_arena_size = (size)
+
+/* The block KEY of SIZE bytes: the one from before the reset if there
+   is one of that size, otherwise a new one, zeroed, taken from the
+   free end of the arena.  NULL, with errno set to ENOMEM, if it does
+   not fit or there is no arena, and to EINVAL if KEY is 0 or the
+   block from before has another size.  */
+extern void *persist_alloc (unsigned int key, size_t size);
+
+/* Nonzero if the arena came through the last reset, 0 if it was
+   cleared: after power-up, or if e.g. RCON shows that a reset lost
+   power and the program called persist_reset.  */
+extern int persist_warm (void);
+
+/* Drop every block.  */
+extern void persist_reset (void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_PERSIST_H_ */
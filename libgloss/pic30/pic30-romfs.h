@@ -0,0 +1,58 @@
+/* pic30-romfs.h -- a read-only filesystem in program memory.  */
+
+#ifndef _PIC30_ROMFS_H_
+#define _PIC30_ROMFS_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* One file.  NAME has no leading slash.  */
+struct romfs_entry
+{
+  const char *name;
+  const void *data;
+  size_t size;
+};
+
+/* The files, ending with a NULL name and sorted by name, with '/'
+   before any other byte, which keeps the files of each directory
+   together and in order; lookups are binary searches.  romfs.py
+   writes the C source for it from a list of files on the build host.  The names and data
+   are const, so with the default -mconst-in-code they stay in program
+   memory and are read through the PSV window, which limits the whole
+   image to one 32K page.  Without a table every open fails with
+   ENOENT.  */
+extern const struct romfs_entry romfs_table[];
+
+/* _open, _read, _lseek, _fstat and _close work on the files, from
+   file descriptor 3 up.  _open fails with EROFS unless it is for
+   reading, and with EMFILE when ROMFS_OPEN_MAX files, 4 unless the
+   BSP is built otherwise, are open.  _stat takes a file or a
+   directory.
+
+   A directory is there when a file is under it, and the root always
+   is.  opendir, readdir, readdir_r, rewinddir, telldir, seekdir and
+   closedir read one from the table; opendir fails with EMFILE when
+   ROMFS_DIR_MAX directories, 2 unless the BSP is built otherwise, are
+   open.  readdir gives the names in order, each subdirectory once, with
+   d_type DT_REG or DT_DIR, so scandir with alphasort does not sort.  */
+
+/* The data of the file PATH and its size in *SIZE, or NULL if there
+   is no such file.  The pointer is into the PSV window, so nothing is
+   copied into RAM.  */
+extern const void *romfs_find (const char *, size_t *);
+
+/* The same for the file behind the stream FP, or NULL if it is not
+   open on one.  Reading the data directly leaves the stream where it
+   was.  */
+extern const void *fmap (FILE *, size_t *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_ROMFS_H_ */
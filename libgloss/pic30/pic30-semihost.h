@@ -0,0 +1,53 @@
+/* pic30-semihost.h -- the console and the files of the host, for a
+   program run under a debugger or the simulator.
+
+   A program linked with libsemi.a in place of libsim.a has its
+   console on the debugger's, and _open opens files on the host when
+   they are not in the romfs image, see pic30-romfs.h.  _read, _write,
+   _writev, _lseek, _fstat and _close work on them from descriptor
+   PIC30_SEMIHOST_FD0 up, a whole block to a request, and _exit hands
+   the status to the host.  The time of day of clock_gettime and
+   _gettimeofday starts from the host's clock; _times stays on the
+   timer of pic30-timer.h, which counts the target's cycles, stopped
+   or not.
+
+   The parts have no breakpoint instruction to make a request with, so
+   each one calls pic30_semihost, which stops on the global label
+   __semihost_trap, where the debugger is to set a breakpoint.  There
+   w0 holds the operation and w1 the address of its arguments, 32-bit
+   words as for the ARM semihosting operation of the same number, with
+   a pointer in the low half of one.  The debugger carries it out and
+   resumes with the 32-bit result in w1:w0.  With no debugger there,
+   every request returns its operation number.  */
+
+#ifndef _PIC30_SEMIHOST_H_
+#define _PIC30_SEMIHOST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The operations used here.  */
+#define PIC30_SYS_OPEN		0x01
+#define PIC30_SYS_CLOSE		0x02
+#define PIC30_SYS_WRITE		0x05
+#define PIC30_SYS_READ		0x06
+#define PIC30_SYS_SEEK		0x0a
+#define PIC30_SYS_FLEN		0x0c
+#define PIC30_SYS_TIME		0x11
+#define PIC30_SYS_ERRNO		0x13
+#define PIC30_SYS_EXIT		0x18
+
+/* The first descriptor of a file on the host, above those of romfs.c.
+   SEMIHOST_OPEN_MAX files, 4 unless the BSP is built otherwise, can
+   be open.  */
+#define PIC30_SEMIHOST_FD0	16
+
+/* Make request OP with the arguments at ARGS and return its result.  */
+extern long pic30_semihost (unsigned int op, void *args);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_SEMIHOST_H_ */
@@ -0,0 +1,47 @@
+/* pic30-signal.h -- deferred signals and the trap signals, see
+   signal.c and sigtrap.S.  */
+
+#ifndef _PIC30_SIGNAL_H_
+#define _PIC30_SIGNAL_H_
+
+/* The traps of sigtrap.S raise SIGBUS for an address error and
+   SIGFPE for a math error, and the handlers run later, like those of
+   any signal raised from an interrupt handler.  A stack error leaves
+   no stack to run on, so the SIGSEGV handler runs at once, on
+   PIC30_SIG_STACK bytes of its own at the priority of the trap, and
+   the device is reset if it returns.  Under SIG_DFL every trap
+   resets the device.  */
+#ifndef PIC30_SIG_STACK
+#define PIC30_SIG_STACK	128
+#endif
+
+/* Words of pending bits, one bit per signal */
+#define PIC30_SIG_WORDS	2
+
+#ifndef __ASSEMBLER__
+
+#include <signal.h>
+#include <machine/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Set from interrupt handlers and traps */
+extern volatile unsigned int __pic30_sig_pending[PIC30_SIG_WORDS];
+
+/* Run the handlers of the pending signals, as raise would, and return
+   how many ran.  Does nothing in an interrupt handler.  */
+extern int sigpoll (void);
+
+/* raise (SIG) for an interrupt handler, SIG a constant: one BSET.  */
+#define pic30_sigpost(sig) \
+  atom_bit_set (&__pic30_sig_pending[(sig) >> 4], (sig) & 15)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* _PIC30_SIGNAL_H_ */
@@ -0,0 +1,24 @@
+/* pic30-sleep.h -- nanosleep, sleep and usleep in Idle mode.  */
+
+#ifndef _PIC30_SLEEP_H_
+#define _PIC30_SLEEP_H_
+
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Not declared by <time.h> without _POSIX_TIMERS.  */
+extern int nanosleep (const struct timespec *, struct timespec *);
+
+/* End the sleep in progress, if any: nanosleep returns -1 with errno
+   EINTR and the time left, sleep and usleep return early.  Safe to
+   call from an interrupt handler.  */
+extern void pic30_sleep_wake (void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_SLEEP_H_ */
@@ -0,0 +1,35 @@
+/* pic30-stack.h -- how much of a stack has ever been used.  */
+
+#ifndef _PIC30_STACK_H_
+#define _PIC30_STACK_H_
+
+/* crt0 fills the stack from __SP_init to __SPLIM_init with this word
+   before anything runs on it; a word still holding it has never been
+   written, barring the rare one that stores it.  */
+#define PIC30_STACK_PAINT	0x5a5a
+
+#ifndef __ASSEMBLER__
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bytes of the stack of main and the interrupts used so far, and
+   bytes never used, from the top down to the first painted word.  */
+extern size_t __stack_high_water (void);
+extern size_t __stack_free (void);
+
+/* The same for the SIZE bytes of a task stack at BASE, which grows
+   up from it like the main one; paint it before the task starts.  */
+extern void __task_stack_paint (void *base, size_t size);
+extern size_t __task_stack_high_water (const void *base, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* _PIC30_STACK_H_ */
@@ -0,0 +1,35 @@
+/* pic30-thread.h -- the settings of the scheduler behind <threads.h>.  */
+
+#ifndef _PIC30_THREAD_H_
+#define _PIC30_THREAD_H_
+
+#include <stddef.h>
+#include <threads.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Stack bytes of each thread created from now on, PIC30_THREAD_STACK
+   to begin with.  Its struct _reent and the scheduler's own data come
+   on top, from the same malloc.  */
+extern size_t pic30_thread_stack_size;
+
+#ifndef PIC30_THREAD_STACK
+#define PIC30_THREAD_STACK	512
+#endif
+
+/* tss_t keys there can be at once */
+#ifndef PIC30_TSS_MAX
+#define PIC30_TSS_MAX	4
+#endif
+
+/* Bytes of the stack of THR used so far, see pic30-stack.h; that of
+   main, which is also that of the interrupts, for main's.  */
+extern size_t pic30_thread_stack_high_water (thrd_t thr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_THREAD_H_ */
@@ -0,0 +1,56 @@
+/* pic30-timer.h -- the clock behind clock_gettime, gettimeofday and
+   times.  */
+
+#ifndef _PIC30_TIMER_H_
+#define _PIC30_TIMER_H_
+
+#include <time.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Start the 32-bit timer pair counting instruction cycles and enable
+   its interrupt, which counts the wraps.  Until this is called every
+   clock reads 0.  */
+extern void pic30_timer_init (void);
+
+/* Seconds since 1970 at pic30_timer_init, from an RTC or the network;
+   CLOCK_REALTIME and gettimeofday add it to the time since then.  */
+extern time_t pic30_timer_epoch;
+
+/* Instruction cycles since pic30_timer_init: the 64-bit count, and
+   the 32 low bits of it straight from the timer, a few instructions
+   for timing short stretches of code.  */
+extern unsigned long long pic30_timer_ticks (void);
+
+#ifndef PIC30_TIMER_LO
+#define PIC30_TIMER_LO	TMR2
+#define PIC30_TIMER_HLD	TMR3HLD
+#endif
+extern volatile unsigned int PIC30_TIMER_LO __attribute__ ((__sfr__));
+extern volatile unsigned int PIC30_TIMER_HLD __attribute__ ((__sfr__));
+
+static __inline__ unsigned long
+__cycles (void)
+{
+  /* reading the low half latches the high half */
+  unsigned int lo = PIC30_TIMER_LO;
+
+  return ((unsigned long) PIC30_TIMER_HLD << 16) | lo;
+}
+
+/* Not declared by <time.h> without _POSIX_TIMERS.  CLOCK_REALTIME and
+   CLOCK_MONOTONIC are supported.  */
+#ifndef CLOCK_MONOTONIC
+#define CLOCK_MONOTONIC	((clockid_t) 4)
+#endif
+extern int clock_gettime (clockid_t, struct timespec *);
+extern int clock_getres (clockid_t, struct timespec *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_TIMER_H_ */
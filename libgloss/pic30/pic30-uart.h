@@ -0,0 +1,59 @@
+/* pic30-uart.h -- the console UART behind _write and _read.  */
+
+#ifndef _PIC30_UART_H_
+#define _PIC30_UART_H_
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* What _write does when the transmit ring is full.  */
+#define PIC30_UART_BLOCK	0	/* wait for the DMA to make room */
+#define PIC30_UART_DROP		1	/* discard the new bytes */
+#define PIC30_UART_OVERWRITE	2	/* discard the oldest bytes not yet sent */
+
+/* Set up the UART for BRG (the value for UxBRG, BRGH clear) and the
+   DMA channel that feeds it, and enable the receive interrupt.
+   Until this is called _write and _read fail with EIO.  */
+extern void pic30_uart_init (unsigned int brg);
+
+/* Select the overflow policy, returning the previous one.  The
+   default is PIC30_UART_BLOCK.  With O_NONBLOCK set on the descriptor
+   by fcntl, PIC30_UART_BLOCK returns a short count, or fails with
+   EAGAIN, instead of waiting; _read on descriptor 0 then acts as
+   under PIC30_UART_RX_NONBLOCK.  PIC30_UART_OVERWRITE never waits:
+   while the DMA is sending, a full ring drops what the write needs
+   and returns short, or fails with EAGAIN, until the DMA is done.  */
+extern int pic30_uart_overflow (int policy);
+
+/* Bytes discarded under PIC30_UART_DROP and PIC30_UART_OVERWRITE.  */
+extern volatile unsigned long pic30_uart_dropped;
+
+/* Wait until every queued byte has left the UART shift register.  */
+extern void pic30_uart_drain (void);
+
+/* fflush, then wait for the bytes to go out.  */
+extern int pic30_uart_fflush (FILE *);
+
+/* How _read waits when nothing has been received.  */
+#define PIC30_UART_RX_BLOCK	0	/* until a byte arrives */
+#define PIC30_UART_RX_NONBLOCK	1	/* not at all, failing with EAGAIN */
+#define PIC30_UART_RX_TIMEOUT	2	/* up to the timeout, then ETIMEDOUT */
+
+/* Select the receive mode; TIMEOUT_MS only matters for
+   PIC30_UART_RX_TIMEOUT.  The default is PIC30_UART_RX_BLOCK.  */
+extern void pic30_uart_rx_mode (int mode, unsigned int timeout_ms);
+
+/* Bytes waiting in the receive ring.  */
+extern unsigned int pic30_uart_rx_pending (void);
+
+/* Bytes lost because the ring or the UART FIFO was full.  */
+extern volatile unsigned long pic30_uart_overruns;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_UART_H_ */
@@ -0,0 +1,78 @@
+/* poll.c -- poll over the console and the files in program memory.
+
+   Descriptor 0 is ready for reading once the receive ring or the UART
+   FIFO holds a byte, 1 and 2 for writing while the transmit ring has
+   room.  A file opened from romfs is always ready for reading, and a
+   descriptor that is neither gets POLLNVAL.  Negative descriptors are
+   skipped, as POSIX has it.
+
+   While nothing is ready, poll sleeps in Idle mode with nanosleep,
+   and the UART handlers of uart.c end the sleep when bytes arrive or
+   leave.  One that comes after the last look but before the sleep has
+   begun is missed, so the sleep is cut into slices of POLL_SLICE
+   milliseconds, which bounds the delay it can add.  */
+
+#include <time.h>
+#include <sys/stat.h>
+#include "poll.h"
+#include "pic30-sleep.h"
+
+#ifndef POLL_SLICE
+#define POLL_SLICE	10
+#endif
+
+/* In uart.c */
+extern short __pic30_uart_revents (int, short);
+extern volatile unsigned char __pic30_uart_polled;
+/* In romfs.c, which only a program that opens files links.  */
+extern int __romfs_fstat (int, struct stat *) __attribute__ ((weak));
+
+static short
+revents (int fd,
+	short events)
+{
+  struct stat st;
+
+  if (fd >= 0 && fd <= 2)
+    return __pic30_uart_revents (fd, events);
+  if (__romfs_fstat && __romfs_fstat (fd, &st) == 0)
+    return events & POLLIN;
+  return POLLNVAL;
+}
+
+int
+poll (struct pollfd *fds,
+	nfds_t nfds,
+	int timeout)
+{
+  unsigned int slice;
+  struct timespec req, rem;
+  nfds_t i;
+  int ready;
+
+  for (;;)
+    {
+      __pic30_uart_polled = 1;
+      ready = 0;
+      for (i = 0; i < nfds; i++)
+	{
+	  fds[i].revents = fds[i].fd < 0 ? 0
+	    : revents (fds[i].fd, fds[i].events);
+	  if (fds[i].revents != 0)
+	    ready++;
+	}
+      if (ready != 0 || timeout == 0)
+	break;
+
+      slice = timeout < 0 || timeout > POLL_SLICE ? POLL_SLICE : timeout;
+      req.tv_sec = 0;
+      req.tv_nsec = slice * 1000000L;
+      if (nanosleep (&req, &rem) != 0)
+	/* woken, with the time left of the slice */
+	slice -= (unsigned int) (rem.tv_nsec / 1000000L);
+      if (timeout > 0)
+	timeout -= slice;
+    }
+  __pic30_uart_polled = 0;
+  return ready;
+}
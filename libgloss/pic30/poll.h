@@ -0,0 +1,36 @@
+/* poll.h -- readiness of the pic30 BSP devices, see poll.c.  */
+
+#ifndef _PIC30_POLL_H_
+#define _PIC30_POLL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef unsigned int nfds_t;
+
+struct pollfd
+{
+  int fd;
+  short events;
+  short revents;
+};
+
+#define POLLIN		0x0001
+#define POLLPRI		0x0002
+#define POLLOUT		0x0004
+#define POLLERR		0x0008
+#define POLLHUP		0x0010
+#define POLLNVAL	0x0020
+#define POLLRDNORM	POLLIN
+#define POLLWRNORM	POLLOUT
+
+/* Wait up to TIMEOUT milliseconds, or for ever if it is negative, for
+   one of the descriptors to be ready, and return how many are.  */
+extern int poll (struct pollfd *, nfds_t, int);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PIC30_POLL_H_ */
@@ -0,0 +1,205 @@
+/* romdir.c -- opendir, readdir and scandir on the romfs, see
+   pic30-romfs.h.
+
+   A directory is not stored: it is the run of the table whose names
+   start with its own and a '/'.  The table is sorted so that the run
+   is in the order of the names in the directory, so opendir finds it
+   by binary search, readdir walks it and scandir never sorts it for
+   alphasort.  A subdirectory is read as the first name of its own run,
+   which readdir then skips.  */
+
+#include <dirent.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pic30-romfs.h"
+
+#ifndef ROMFS_DIR_MAX
+#define ROMFS_DIR_MAX	2
+#endif
+
+extern const struct romfs_entry romfs_table[] __attribute__ ((weak));
+extern int __romfs_dir (const char **, size_t *);
+
+struct __romfs_dir
+{
+  const char *path;	/* NULL when the slot is free */
+  size_t len;		/* of PATH, without the '/' */
+  int first;		/* index of the first name in the directory */
+  int pos;		/* index of the next one */
+  struct dirent ent;
+};
+
+static struct __romfs_dir romfs_dirs[ROMFS_DIR_MAX];
+
+/* Whether the table entry I is under the directory D.  */
+static int
+romfs_under (const DIR *d,
+	int i)
+{
+  const char *name;
+
+  if (romfs_table == NULL || (name = romfs_table[i].name) == NULL)
+    return 0;
+  return d->len == 0
+	 || (strncmp (name, d->path, d->len) == 0 && name[d->len] == '/');
+}
+
+DIR *
+opendir (const char *path)
+{
+  size_t len;
+  int i, first;
+
+  if ((first = __romfs_dir (&path, &len)) < 0)
+    {
+      errno = romfs_find (path, &len) != NULL ? ENOTDIR : ENOENT;
+      return NULL;
+    }
+  for (i = 0; i < ROMFS_DIR_MAX; i++)
+    if (romfs_dirs[i].path == NULL)
+      {
+	romfs_dirs[i].path = path;
+	romfs_dirs[i].len = len;
+	romfs_dirs[i].first = romfs_dirs[i].pos = first;
+	return &romfs_dirs[i];
+      }
+  errno = EMFILE;
+  return NULL;
+}
+
+struct dirent *
+readdir (DIR *d)
+{
+  const char *full, *name, *slash;
+  size_t n;
+
+  if (!romfs_under (d, d->pos))
+    return NULL;
+  full = romfs_table[d->pos].name;
+  name = full + d->len + (d->len != 0);
+  d->ent.d_ino = ++d->pos;
+  if ((slash = strchr (name, '/')) == NULL)
+    {
+      n = strlen (name);
+      d->ent.d_type = DT_REG;
+    }
+  else
+    {
+      n = slash - name;
+      d->ent.d_type = DT_DIR;
+      /* Skip the rest of the subdirectory's run.  */
+      while (romfs_table[d->pos].name != NULL
+	     && strncmp (romfs_table[d->pos].name, full, slash - full + 1) == 0)
+	d->pos++;
+    }
+  if (n > MAXNAMLEN)
+    n = MAXNAMLEN;
+  memcpy (d->ent.d_name, name, n);
+  d->ent.d_name[n] = '\0';
+  return &d->ent;
+}
+
+int
+readdir_r (DIR *d,
+	struct dirent *entry,
+	struct dirent **result)
+{
+  struct dirent *e = readdir (d);
+
+  if (e != NULL)
+    {
+      *entry = *e;
+      e = entry;
+    }
+  *result = e;
+  return 0;
+}
+
+void
+rewinddir (DIR *d)
+{
+  d->pos = d->first;
+}
+
+long
+telldir (DIR *d)
+{
+  return d->pos;
+}
+
+void
+seekdir (DIR *d,
+	long loc)
+{
+  d->pos = loc;
+}
+
+int
+dirfd (DIR *d)
+{
+  errno = ENOTSUP;
+  return -1;
+}
+
+int
+closedir (DIR *d)
+{
+  d->path = NULL;
+  return 0;
+}
+
+int
+alphasort (const struct dirent **a,
+	const struct dirent **b)
+{
+  return strcoll ((*a)->d_name, (*b)->d_name);
+}
+
+/* Count the names first, so that the list is allocated once.  */
+int
+scandir (const char *path,
+	struct dirent ***list,
+	int (*select) (const struct dirent *),
+	int (*compar) (const struct dirent **, const struct dirent **))
+{
+  struct dirent *e, **names;
+  DIR *d;
+  size_t size;
+  int n = 0, i = 0;
+
+  if ((d = opendir (path)) == NULL)
+    return -1;
+  while (readdir (d) != NULL)
+    n++;
+  rewinddir (d);
+  if ((names = malloc ((n + 1) * sizeof (*names))) == NULL)
+    goto fail;
+  while ((e = readdir (d)) != NULL)
+    {
+      if (select != NULL && !(*select) (e))
+	continue;
+      size = offsetof (struct dirent, d_name) + strlen (e->d_name) + 1;
+      if ((names[i] = malloc (size)) == NULL)
+	{
+	  while (i > 0)
+	    free (names[--i]);
+	  free (names);
+	  goto fail;
+	}
+      memcpy (names[i++], e, size);
+    }
+  closedir (d);
+  /* readdir is already in the order of alphasort.  */
+  if (compar != NULL && compar != alphasort && i > 1)
+    qsort (names, i, sizeof (*names),
+	   (int (*) (const void *, const void *)) compar);
+  *list = names;
+  return i;
+
+fail:
+  closedir (d);
+  errno = ENOMEM;
+  return -1;
+}
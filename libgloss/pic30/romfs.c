@@ -0,0 +1,305 @@
+/* romfs.c -- _open, _read, _lseek, _fstat and _close on a read-only
+   filesystem in program memory, see pic30-romfs.h.
+
+   _open is here; the other syscalls reach the functions here through
+   weak references, so a program that never opens a file does not
+   link them.  A read copies straight from the PSV window; romfs_find and
+   fmap skip even that.  */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "pic30-romfs.h"
+
+#ifndef ROMFS_OPEN_MAX
+#define ROMFS_OPEN_MAX	4
+#endif
+
+/* The stdio buffer size for a file, see __swhatbuf_r.  The data is
+   already in memory, so a small one does.  */
+#ifndef ROMFS_BLKSIZE
+#define ROMFS_BLKSIZE	32
+#endif
+
+/* The first file descriptor after the console's.  */
+#define ROMFS_FD0	3
+
+extern const struct romfs_entry romfs_table[] __attribute__ ((weak));
+/* In semihost.c, in libsemi.a, which opens the files of the host.  */
+extern int __semihost_open (const char *, int) __attribute__ ((weak));
+
+struct romfs_file
+{
+  const struct romfs_entry *e;	/* NULL when the slot is free */
+  off_t pos;
+};
+
+static struct romfs_file romfs_fd[ROMFS_OPEN_MAX];
+
+/* The number of files, counted on first use.  */
+static int romfs_count = -1;
+
+/* Byte C of a name in the order of the table, where '/' comes before
+   any other byte, so that the files of a directory sort together and
+   in the order of their names in it.  */
+#define ROMFS_KEY(c)	((c) == '/' ? 1 : (unsigned char) (c))
+
+/* Compare NAME with the LEN bytes of PATH, followed by a '/' if DIR.  */
+static int
+romfs_cmp (const char *name,
+	const char *path,
+	size_t len,
+	int dir)
+{
+  size_t i;
+  int a, b;
+
+  for (i = 0; i < len + dir; i++)
+    {
+      a = ROMFS_KEY (name[i]);
+      b = i < len ? ROMFS_KEY (path[i]) : 1;
+      if (a != b)
+	return a - b;
+    }
+  return name[i] != '\0';
+}
+
+/* The index in the table of the first name not before the LEN bytes
+   of PATH, followed by a '/' if DIR.  */
+static int
+romfs_index (const char *path,
+	size_t len,
+	int dir)
+{
+  int lo = 0, hi, mid;
+
+  if (romfs_count < 0)
+    {
+      romfs_count = 0;
+      if (romfs_table != NULL)
+	while (romfs_table[romfs_count].name != NULL)
+	  romfs_count++;
+    }
+  hi = romfs_count;
+  while (lo < hi)
+    {
+      mid = (lo + hi) / 2;
+      if (romfs_cmp (romfs_table[mid].name, path, len, dir) < 0)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo;
+}
+
+static const struct romfs_entry *
+romfs_lookup (const char *path)
+{
+  const struct romfs_entry *e;
+  size_t len;
+
+  if (romfs_table == NULL)
+    return NULL;
+  while (*path == '/')
+    path++;
+  len = strlen (path);
+  e = &romfs_table[romfs_index (path, len, 0)];
+  if (e->name == NULL || romfs_cmp (e->name, path, len, 0) != 0)
+    return NULL;
+  return e;
+}
+
+int
+__romfs_dir (const char **path,
+	size_t *len)
+{
+  const char *p = *path;
+  size_t n;
+  int i;
+
+  while (*p == '/')
+    p++;
+  n = strlen (p);
+  while (n > 0 && p[n - 1] == '/')
+    n--;
+  if (n == 1 && p[0] == '.')
+    n = 0;
+  *path = p;
+  *len = n;
+  if (romfs_table == NULL)
+    return n == 0 ? 0 : -1;
+  if (n == 0)
+    return 0;
+  i = romfs_index (p, n, 1);
+  if (romfs_table[i].name == NULL || strncmp (romfs_table[i].name, p, n) != 0
+      || romfs_table[i].name[n] != '/')
+    return -1;
+  return i;
+}
+
+/* The open slot for FILE, or NULL with errno set.  */
+static struct romfs_file *
+romfs_slot (int file)
+{
+  if (file < ROMFS_FD0 || file >= ROMFS_FD0 + ROMFS_OPEN_MAX
+      || romfs_fd[file - ROMFS_FD0].e == NULL)
+    {
+      errno = EBADF;
+      return NULL;
+    }
+  return &romfs_fd[file - ROMFS_FD0];
+}
+
+const void *
+romfs_find (const char *path,
+	size_t *size)
+{
+  const struct romfs_entry *e = romfs_lookup (path);
+
+  if (e == NULL)
+    return NULL;
+  *size = e->size;
+  return e->data;
+}
+
+const void *
+fmap (FILE *fp,
+	size_t *size)
+{
+  struct romfs_file *f = romfs_slot (fileno (fp));
+
+  if (f == NULL)
+    return NULL;
+  *size = f->e->size;
+  return f->e->data;
+}
+
+int
+_open (const char *path,
+	int flags,
+	...)
+{
+  const struct romfs_entry *e;
+  int i;
+
+  if ((e = romfs_lookup (path)) == NULL)
+    {
+      if (__semihost_open)
+	return __semihost_open (path, flags);
+      errno = ENOENT;
+      return -1;
+    }
+  if ((flags & O_ACCMODE) != O_RDONLY || (flags & O_TRUNC))
+    {
+      errno = EROFS;
+      return -1;
+    }
+  for (i = 0; i < ROMFS_OPEN_MAX; i++)
+    if (romfs_fd[i].e == NULL)
+      {
+	romfs_fd[i].e = e;
+	romfs_fd[i].pos = 0;
+	return ROMFS_FD0 + i;
+      }
+  errno = EMFILE;
+  return -1;
+}
+
+int
+__romfs_read (int file,
+	char *ptr,
+	int len)
+{
+  struct romfs_file *f = romfs_slot (file);
+  size_t n;
+
+  if (f == NULL)
+    return -1;
+  if (f->pos >= (off_t) f->e->size)
+    return 0;
+  n = f->e->size - (size_t) f->pos;
+  if (n > (size_t) len)
+    n = len;
+  memcpy (ptr, (const char *) f->e->data + (size_t) f->pos, n);
+  f->pos += n;
+  return n;
+}
+
+off_t
+__romfs_lseek (int file,
+	off_t ptr,
+	int dir)
+{
+  struct romfs_file *f = romfs_slot (file);
+
+  if (f == NULL)
+    return -1;
+  if (dir == SEEK_CUR)
+    ptr += f->pos;
+  else if (dir == SEEK_END)
+    ptr += f->e->size;
+  else if (dir != SEEK_SET)
+    ptr = -1;
+  if (ptr < 0)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  /* Past the end reads as end of file.  */
+  return f->pos = ptr;
+}
+
+int
+__romfs_fstat (int file,
+	struct stat *st)
+{
+  struct romfs_file *f = romfs_slot (file);
+
+  if (f == NULL)
+    return -1;
+  memset (st, 0, sizeof (*st));
+  st->st_mode = S_IFREG | S_IRUSR | S_IRGRP | S_IROTH;
+  st->st_size = f->e->size;
+  st->st_blksize = ROMFS_BLKSIZE;
+  return 0;
+}
+
+int
+_stat (const char *path,
+	struct stat *st)
+{
+  const struct romfs_entry *e;
+  size_t len;
+
+  memset (st, 0, sizeof (*st));
+  if ((e = romfs_lookup (path)) != NULL)
+    {
+      st->st_mode = S_IFREG | S_IRUSR | S_IRGRP | S_IROTH;
+      st->st_size = e->size;
+      st->st_blksize = ROMFS_BLKSIZE;
+      return 0;
+    }
+  if (__romfs_dir (&path, &len) < 0)
+    {
+      errno = ENOENT;
+      return -1;
+    }
+  st->st_mode = S_IFDIR | S_IRUSR | S_IXUSR | S_IRGRP | S_IXGRP
+		| S_IROTH | S_IXOTH;
+  st->st_blksize = ROMFS_BLKSIZE;
+  return 0;
+}
+
+int
+__romfs_close (int file)
+{
+  struct romfs_file *f = romfs_slot (file);
+
+  if (f == NULL)
+    return -1;
+  f->e = NULL;
+  return 0;
+}
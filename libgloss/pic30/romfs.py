@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+#
+# romfs.py -- write the C source of a pic30 romfs image.
+#
+# usage: romfs.py [-C DIR] [-o OUT.c] FILE...
+#
+# Each FILE becomes the file of the same name, taken relative to DIR
+# when -C is given, in the romfs_table that libgloss/pic30/romfs.c
+# serves; see pic30-romfs.h.  A directory stands for every file under
+# it.  Compile the output with the program.
+
+import argparse
+import os
+import sys
+
+PSV_PAGE = 32768
+NAME_MAX = 63     # MAXNAMLEN of <sys/dirent.h>
+
+
+def files(root, paths):
+    for path in paths:
+        full = os.path.join(root, path)
+        if os.path.isdir(full):
+            for top, dirs, names in os.walk(full):
+                dirs.sort()
+                for name in sorted(names):
+                    yield os.path.relpath(os.path.join(top, name), root)
+        else:
+            yield os.path.normpath(path)
+
+
+def cstring(s):
+    out = []
+    for c in s.encode():
+        if c in b'"\\' or c < 0x20 or c > 0x7e:
+            out.append('\\%03o' % c)
+        else:
+            out.append(chr(c))
+    return '"%s"' % ''.join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Pack files into a romfs.')
+    ap.add_argument('-C', dest='root', default='.')
+    ap.add_argument('-o', dest='out')
+    ap.add_argument('files', nargs='+')
+    opts = ap.parse_args()
+
+    # Sorted by component, which is the order of the table: see
+    # pic30-romfs.h.
+    names = sorted(set(n.replace(os.sep, '/')
+                       for n in files(opts.root, opts.files)),
+                   key=lambda n: n.split('/'))
+    for name in names:
+        if max(len(c.encode()) for c in name.split('/')) > NAME_MAX:
+            sys.stderr.write('romfs.py: %s: a name in it is longer than '
+                             '%d bytes\n' % (name, NAME_MAX))
+            sys.exit(1)
+    out = [
+        '/* Generated by romfs.py; do not edit.  */',
+        '',
+        '#include <pic30-romfs.h>',
+        '',
+    ]
+    total = 0
+    for i, name in enumerate(names):
+        with open(os.path.join(opts.root, name), 'rb') as f:
+            data = f.read()
+        total += len(data) + len(name.encode()) + 1
+        out.append('static const unsigned char romfs_data_%d[%d] = {'
+                   % (i, max(len(data), 1)))
+        for at in range(0, len(data), 12):
+            out.append('  ' + ' '.join('0x%02x,' % b
+                                       for b in data[at:at + 12]))
+        out.append('};')
+        out.append('')
+        names[i] = (name, len(data))
+
+    out.append('const struct romfs_entry romfs_table[] = {')
+    for i, (name, size) in enumerate(names):
+        out.append('  { %s, romfs_data_%d, %d },' % (cstring(name), i, size))
+    out.append('  { 0, 0, 0 }')
+    out.append('};')
+
+    if total > PSV_PAGE:
+        sys.stderr.write('romfs.py: warning: %d bytes do not fit in one '
+                         'PSV page\n' % total)
+    text = '\n'.join(out) + '\n'
+    if opts.out:
+        with open(opts.out, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
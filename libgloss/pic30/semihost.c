@@ -0,0 +1,485 @@
+/* semihost.c -- the console and the files of the host over the
+   debugger, see pic30-semihost.h.
+
+   semihost.o takes the place of uart.o in libsemi.a.  The console
+   descriptors are the host's ":tt", opened for reading, writing and
+   appending by a constructor, which also sets pic30_timer_epoch from
+   the host's clock when timer.c is linked.  _open in romfs.c, and
+   _lseek, _fstat, _close and _exit in syscalls.c, reach the functions
+   here through weak references, so libsim.a goes on without them.
+
+   Every request stops the target for a round trip to the host, which
+   costs far more than the bytes, so each _read and _write is one
+   request for the whole block, _writev one for each vector, and the
+   position of each file is kept here, so that an lseek that does not
+   move, as ftell makes, needs none.  A host file reports a
+   SEMIHOST_BLKSIZE buffer to stdio for the same reason.  */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include "pic30-semihost.h"
+#include "poll.h"
+
+/* In romfs.c, which only a program that opens files links.  */
+extern int __romfs_read (int, char *, int) __attribute__ ((weak));
+extern int __romfs_fstat (int, struct stat *) __attribute__ ((weak));
+/* In timer.c */
+extern time_t pic30_timer_epoch __attribute__ ((weak));
+
+#ifndef SEMIHOST_OPEN_MAX
+#define SEMIHOST_OPEN_MAX	4
+#endif
+
+/* The stdio buffer size for a host file, see __swhatbuf_r.  */
+#ifndef SEMIHOST_BLKSIZE
+#define SEMIHOST_BLKSIZE	512
+#endif
+
+/* The modes of SYS_OPEN, those of fopen in order.  */
+#define MODE_R		0
+#define MODE_W		4
+#define MODE_A		8
+#define MODE_PLUS	2
+#define MODE_B		1
+
+/* The reason for SYS_EXIT: the program has ended.  */
+#define EXIT_APPLICATION	0x20026UL
+
+struct host_file
+{
+  long handle;
+  off_t pos;		/* -1 after a write in append mode */
+  int flags;
+  char used;
+};
+
+static struct host_file host_fd[SEMIHOST_OPEN_MAX];
+
+/* The host's handles for descriptors 0, 1 and 2.  */
+static long con[3] = { -1, -1, -1 };
+
+volatile unsigned char __pic30_uart_polled;
+
+long __attribute__ ((__noinline__))
+pic30_semihost (unsigned int op,
+	void *args)
+{
+  register unsigned int lo __asm__ ("w0") = op;
+  register unsigned int hi __asm__ ("w1") = (unsigned int) args;
+
+  __asm__ volatile ("\n\t.global\t___semihost_trap\n___semihost_trap:\n\tnop"
+		    : "+r" (lo), "+r" (hi) : : "memory");
+  return (long) ((unsigned long) hi << 16 | lo);
+}
+
+#define ARG(p)	((unsigned long) (unsigned int) (p))
+
+static void
+host_errno (void)
+{
+  int e = (int) pic30_semihost (PIC30_SYS_ERRNO, NULL);
+
+  errno = e > 0 ? e : EIO;
+}
+
+static long
+host_open (const char *path,
+	unsigned int mode)
+{
+  unsigned long a[3];
+
+  a[0] = ARG (path);
+  a[1] = mode;
+  a[2] = strlen (path);
+  return pic30_semihost (PIC30_SYS_OPEN, a);
+}
+
+static int
+host_read (long handle,
+	char *ptr,
+	int len)
+{
+  unsigned long a[3];
+  long left;
+
+  if (len <= 0)
+    return 0;
+  a[0] = handle;
+  a[1] = ARG (ptr);
+  a[2] = len;
+  left = pic30_semihost (PIC30_SYS_READ, a);
+  if (left < 0 || left > len)
+    {
+      host_errno ();
+      return -1;
+    }
+  return len - (int) left;
+}
+
+static int
+host_write (long handle,
+	const char *ptr,
+	int len)
+{
+  unsigned long a[3];
+  long left;
+
+  if (len <= 0)
+    return 0;
+  a[0] = handle;
+  a[1] = ARG (ptr);
+  a[2] = len;
+  left = pic30_semihost (PIC30_SYS_WRITE, a);
+  if (left < 0 || left > len)
+    left = len;
+  if (left == len)
+    {
+      host_errno ();
+      return -1;
+    }
+  return len - (int) left;
+}
+
+static long
+host_flen (long handle)
+{
+  unsigned long a[1];
+
+  a[0] = handle;
+  return pic30_semihost (PIC30_SYS_FLEN, a);
+}
+
+static void __attribute__ ((__constructor__))
+semihost_init (void)
+{
+  long t;
+
+  con[0] = host_open (":tt", MODE_R);
+  con[1] = host_open (":tt", MODE_W);
+  con[2] = host_open (":tt", MODE_A);
+  if (&pic30_timer_epoch != NULL
+      && (t = pic30_semihost (PIC30_SYS_TIME, NULL)) > 0)
+    pic30_timer_epoch = t;
+}
+
+/* The open slot for FILE, or NULL with errno set.  */
+static struct host_file *
+host_slot (int file)
+{
+  if (file < PIC30_SEMIHOST_FD0
+      || file >= PIC30_SEMIHOST_FD0 + SEMIHOST_OPEN_MAX
+      || !host_fd[file - PIC30_SEMIHOST_FD0].used)
+    {
+      errno = EBADF;
+      return NULL;
+    }
+  return &host_fd[file - PIC30_SEMIHOST_FD0];
+}
+
+/* The console handle of FILE, or -1 with errno set.  */
+static long
+con_handle (int file)
+{
+  if (con[file] == -1)
+    {
+      errno = EIO;
+      return -1;
+    }
+  return con[file];
+}
+
+/* Fopen has no mode that creates a file without truncating it, so
+   O_CREAT without O_TRUNC tries the file first.  */
+int
+__semihost_open (const char *path,
+	int flags)
+{
+  unsigned int mode;
+  long h;
+  int i;
+
+  for (i = 0; i < SEMIHOST_OPEN_MAX; i++)
+    if (!host_fd[i].used)
+      break;
+  if (i == SEMIHOST_OPEN_MAX)
+    {
+      errno = EMFILE;
+      return -1;
+    }
+
+  mode = (flags & O_ACCMODE) == O_RDWR ? MODE_PLUS | MODE_B : MODE_B;
+  if ((flags & O_ACCMODE) == O_RDONLY)
+    h = host_open (path, MODE_R | mode);
+  else if (flags & O_APPEND)
+    h = host_open (path, MODE_A | mode);
+  else if (flags & O_TRUNC)
+    h = host_open (path, MODE_W | mode);
+  else if ((h = host_open (path, MODE_R | MODE_PLUS | MODE_B)) == -1
+	   && (flags & O_CREAT))
+    h = host_open (path, MODE_W | mode);
+  if (h == -1)
+    {
+      host_errno ();
+      return -1;
+    }
+
+  host_fd[i].handle = h;
+  host_fd[i].pos = 0;
+  host_fd[i].flags = flags & (O_ACCMODE | O_APPEND);
+  host_fd[i].used = 1;
+  return PIC30_SEMIHOST_FD0 + i;
+}
+
+off_t
+__semihost_lseek (int file,
+	off_t ptr,
+	int dir)
+{
+  struct host_file *f = host_slot (file);
+  unsigned long a[2];
+  long len;
+
+  if (f == NULL)
+    return -1;
+  if (dir == SEEK_END || (dir == SEEK_CUR && f->pos < 0))
+    {
+      if ((len = host_flen (f->handle)) < 0)
+	{
+	  host_errno ();
+	  return -1;
+	}
+      if (dir == SEEK_CUR)
+	f->pos = len;
+      else
+	ptr += len;
+    }
+  if (dir == SEEK_CUR)
+    ptr += f->pos;
+  else if (dir != SEEK_SET && dir != SEEK_END)
+    ptr = -1;
+  if (ptr < 0)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  if (ptr == f->pos)
+    return ptr;
+  a[0] = f->handle;
+  a[1] = ptr;
+  if (pic30_semihost (PIC30_SYS_SEEK, a) != 0)
+    {
+      host_errno ();
+      return -1;
+    }
+  return f->pos = ptr;
+}
+
+int
+__semihost_fstat (int file,
+	struct stat *st)
+{
+  struct host_file *f = host_slot (file);
+  long len;
+
+  if (f == NULL)
+    return -1;
+  if ((len = host_flen (f->handle)) < 0)
+    {
+      host_errno ();
+      return -1;
+    }
+  memset (st, 0, sizeof (*st));
+  st->st_mode = S_IFREG | S_IRUSR | S_IWUSR;
+  st->st_size = len;
+  st->st_blksize = SEMIHOST_BLKSIZE;
+  return 0;
+}
+
+int
+__semihost_close (int file)
+{
+  struct host_file *f = host_slot (file);
+  unsigned long a[1];
+
+  if (f == NULL)
+    return -1;
+  f->used = 0;
+  a[0] = f->handle;
+  if (pic30_semihost (PIC30_SYS_CLOSE, a) != 0)
+    {
+      host_errno ();
+      return -1;
+    }
+  return 0;
+}
+
+void
+__semihost_exit (int n)
+{
+  unsigned long a[2];
+
+  a[0] = EXIT_APPLICATION;
+  a[1] = n;
+  pic30_semihost (PIC30_SYS_EXIT, a);
+}
+
+int
+_read (int file,
+	char *ptr,
+	int len)
+{
+  struct host_file *f;
+  long h;
+  int n;
+
+  if (file == 0)
+    return (h = con_handle (0)) == -1 ? -1 : host_read (h, ptr, len);
+  if (file >= PIC30_SEMIHOST_FD0)
+    {
+      if ((f = host_slot (file)) == NULL)
+	return -1;
+      if ((f->flags & O_ACCMODE) == O_WRONLY)
+	{
+	  errno = EBADF;
+	  return -1;
+	}
+      if ((n = host_read (f->handle, ptr, len)) > 0 && f->pos >= 0)
+	f->pos += n;
+      return n;
+    }
+  if (file > 2 && __romfs_read)
+    return __romfs_read (file, ptr, len);
+  errno = EBADF;
+  return -1;
+}
+
+int
+_write (int file,
+	char *ptr,
+	int len)
+{
+  struct host_file *f;
+  long h;
+  int n;
+
+  if (file == 1 || file == 2)
+    return (h = con_handle (file)) == -1 ? -1 : host_write (h, ptr, len);
+  if ((f = host_slot (file)) == NULL)
+    return -1;
+  if ((f->flags & O_ACCMODE) == O_RDONLY)
+    {
+      errno = EBADF;
+      return -1;
+    }
+  if ((n = host_write (f->handle, ptr, len)) > 0)
+    f->pos = f->flags & O_APPEND ? -1 : f->pos + n;
+  return n;
+}
+
+ssize_t
+_writev (int file,
+	const struct iovec *iov,
+	int iovcnt)
+{
+  ssize_t len = 0;
+  int i, n;
+
+  for (i = 0; i < iovcnt; i++)
+    {
+      if (iov[i].iov_len == 0)
+	continue;
+      if ((n = _write (file, iov[i].iov_base, iov[i].iov_len)) < 0)
+	return len == 0 ? -1 : len;
+      len += n;
+      if ((size_t) n < iov[i].iov_len)
+	break;
+    }
+  return len;
+}
+
+int
+__console_putc (int c)
+{
+  char b = c;
+
+  return _write (1, &b, 1) == 1 ? (unsigned char) b : -1;
+}
+
+int
+__console_getc (void)
+{
+  unsigned char c;
+
+  return _read (0, (char *) &c, 1) == 1 ? c : -1;
+}
+
+/* The host answers every request before the target runs on, so from
+   here nothing ever waits.  */
+short
+__pic30_uart_revents (int file,
+	short events)
+{
+  return events & (POLLIN | POLLOUT);
+}
+
+int
+_fcntl (int file,
+	int cmd,
+	int arg)
+{
+  struct host_file *f;
+  struct stat st;
+  int mode;
+
+  if (file == 0)
+    mode = O_RDONLY;
+  else if (file == 1 || file == 2)
+    mode = O_WRONLY;
+  else if (file >= PIC30_SEMIHOST_FD0)
+    {
+      if ((f = host_slot (file)) == NULL)
+	return -1;
+      mode = f->flags;
+    }
+  else if (file > 2 && __romfs_fstat && __romfs_fstat (file, &st) == 0)
+    mode = O_RDONLY;
+  else
+    {
+      errno = EBADF;
+      return -1;
+    }
+
+  switch (cmd)
+    {
+    case F_GETFL:
+      return mode;
+    case F_SETFL:
+      /* Nothing waits, so O_NONBLOCK changes nothing.  */
+    case F_GETFD:
+    case F_SETFD:
+      return 0;
+    default:
+      errno = EINVAL;
+      return -1;
+    }
+}
+
+int
+fcntl (int file,
+	int cmd,
+	...)
+{
+  va_list ap;
+  int arg;
+
+  va_start (ap, cmd);
+  arg = va_arg (ap, int);
+  va_end (ap);
+  return _fcntl (file, cmd, arg);
+}
@@ -0,0 +1,124 @@
+/* signal.c -- signal, and the _kill behind raise, for pic30.
+
+   The library is built with SIGNAL_PROVIDED, so raise is _kill on
+   this process.  From task code, _kill first runs the handlers of the
+   signals already pending, then that of SIG.  From an interrupt
+   handler, or with the CPU priority raised as under a library lock,
+   it only marks SIG pending with one IOR to a word in memory, which
+   cannot be interrupted.  The handler then runs in task context at
+   the next sigpoll or raise, or __libc_yield of threads.c.
+   pic30_sigpost in pic30-signal.h does the same in an instruction or
+   two, for handlers that cannot spare the calls of raise.
+
+   As in the generic signal, a handler is reset to SIG_DFL before it
+   is called, and the default action is to do nothing; there is no
+   process to terminate.  The exception are the traps of sigtrap.S,
+   which reset the device under SIG_DFL as the default trap handler
+   does.  The table lives in near data for them, and takes no heap.  */
+
+#include <errno.h>
+#include <signal.h>
+#include <reent.h>
+#include <machine/atomic.h>
+#include "pic30-signal.h"
+
+/* sigtrap.S hardcodes these.  */
+typedef char sig_numbers_match_sigtrap[SIGFPE == 8 && SIGBUS == 10
+				       && SIGSEGV == 11 ? 1 : -1];
+typedef char sig_pending_holds_NSIG[NSIG <= 16 * PIC30_SIG_WORDS ? 1 : -1];
+
+#define SR_IPL		0x00e0
+#define CORCON_IPL3	0x0008
+
+_sig_func_ptr __pic30_sig_func[NSIG] __attribute__ ((__near__));
+
+static int
+in_interrupt (void)
+{
+  unsigned int sr, corcon;
+
+  __asm__ volatile ("mov\tSR, %0\n\tmov\tCORCON, %1"
+		    : "=r" (sr), "=r" (corcon));
+  return (sr & SR_IPL) != 0 || (corcon & CORCON_IPL3) != 0;
+}
+
+/* Run the handler of SIG.  Also called by the stack error trap.  */
+void
+__pic30_sig_deliver (int sig)
+{
+  _sig_func_ptr func = __pic30_sig_func[sig];
+
+  if (func == SIG_DFL || func == SIG_IGN)
+    return;
+  __pic30_sig_func[sig] = SIG_DFL;
+  func (sig);
+}
+
+int
+sigpoll (void)
+{
+  unsigned int i, bits;
+  int n = 0;
+
+  if (in_interrupt ())
+    return 0;
+  for (i = 0; i < PIC30_SIG_WORDS; i++)
+    if (__pic30_sig_pending[i] != 0)
+      {
+	/* Later posts land in the word again, for the next call.  */
+	bits = atom16_exchange (&__pic30_sig_pending[i], 0);
+	for (; bits != 0; bits &= bits - 1)
+	  {
+	    __pic30_sig_deliver (i * 16 + __builtin_ctz (bits));
+	    n++;
+	  }
+      }
+  return n;
+}
+
+int
+_kill (int pid,
+	int sig)
+{
+  if (sig < 0 || sig >= NSIG)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  if (sig == 0)
+    return 0;
+  if (in_interrupt ())
+    {
+      atom16_or (&__pic30_sig_pending[sig >> 4], 1u << (sig & 15));
+      return 0;
+    }
+  sigpoll ();
+  __pic30_sig_deliver (sig);
+  return 0;
+}
+
+_sig_func_ptr
+_signal_r (struct _reent *ptr,
+	int sig,
+	_sig_func_ptr func)
+{
+  _sig_func_ptr old_func;
+
+  if (sig <= 0 || sig >= NSIG)
+    {
+      ptr->_errno = EINVAL;
+      return SIG_ERR;
+    }
+  /* One store, so a trap or _kill in a handler sees one or the
+     other.  */
+  old_func = __pic30_sig_func[sig];
+  __pic30_sig_func[sig] = func;
+  return old_func;
+}
+
+_sig_func_ptr
+signal (int sig,
+	_sig_func_ptr func)
+{
+  return _signal_r (_REENT, sig, func);
+}
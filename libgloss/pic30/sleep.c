@@ -0,0 +1,225 @@
+/* sleep.c -- nanosleep, sleep and usleep for pic30.
+
+   Timer4 and Timer5 run as one 32-bit timer from the instruction
+   clock with no prescaler, its period set to the length of the sleep,
+   and the CPU waits for its interrupt in Idle mode with PWRSAV #1
+   rather than spinning.  Any other interrupt also ends Idle; its
+   handler runs and the CPU goes back to Idle unless it called
+   pic30_sleep_wake.  Idle is entered with the CPU priority raised to
+   7, which still lets an enabled interrupt wake the CPU but holds off
+   its handler until the priority is restored, so none can slip in
+   between the test for the end of the sleep and PWRSAV.  A sleep
+   longer than 2^32 cycles is made of several periods.
+
+   The timer is started SLEEP_ENTRY cycles after the call and the
+   caller resumes SLEEP_EXIT cycles after the timer interrupt, so the
+   period is shortened by their sum; a sleep that leaves no more than
+   SLEEP_SPIN cycles after that is spent polling the timer instead,
+   since waking from Idle takes longer than the sleep itself.  The
+   defaults are measured at -Os on a dsPIC33F; any of the settings
+   below can be overridden when the BSP is built.  */
+
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include "pic30-sleep.h"
+
+/* Instruction clock */
+#ifndef SLEEP_FCY
+#define SLEEP_FCY	40000000UL
+#endif
+/* Cycles spent around the timer period, and the shortest sleep in
+   Idle mode */
+#ifndef SLEEP_ENTRY
+#define SLEEP_ENTRY	90
+#endif
+#ifndef SLEEP_EXIT
+#define SLEEP_EXIT	40
+#endif
+#ifndef SLEEP_SPIN
+#define SLEEP_SPIN	200
+#endif
+/* The timer pair */
+#ifndef SLEEP_CON
+#define SLEEP_CON	T4CON
+#define SLEEP_LO	TMR4
+#define SLEEP_HLD	TMR5HLD
+#define SLEEP_PRLO	PR4
+#define SLEEP_PRHI	PR5
+#define SLEEP_VECTOR	_T5Interrupt
+#endif
+/* Where the interrupt flag and enable of the high timer live */
+#ifndef SLEEP_IFS
+#define SLEEP_IFS	IFS1
+#define SLEEP_IEC	IEC1
+#define SLEEP_BIT	12
+#endif
+
+#define XSTR(x) STR (x)
+#define STR(x) #x
+
+/* The SFRs are placed by the device linker script */
+#define SFR(x) extern volatile unsigned int x __attribute__ ((__sfr__))
+SFR (SR);
+SFR (SLEEP_CON);
+SFR (SLEEP_LO);
+SFR (SLEEP_HLD);
+SFR (SLEEP_PRLO);
+SFR (SLEEP_PRHI);
+SFR (SLEEP_IFS);
+
+/* On, 32-bit, instruction clock, 1:1 */
+#define TCON_ON		0x8008
+/* IPL<2:0> in SR */
+#define SR_IPL7		0x00e0
+
+#define SLEEP_IF_CLEAR() \
+  __asm__ volatile ("bclr\t" XSTR (SLEEP_IFS) ", #" XSTR (SLEEP_BIT) \
+		    : : : "memory")
+#define SLEEP_IE_OFF() \
+  __asm__ volatile ("bclr\t" XSTR (SLEEP_IEC) ", #" XSTR (SLEEP_BIT) \
+		    : : : "memory")
+#define SLEEP_IE_ON() \
+  __asm__ volatile ("bset\t" XSTR (SLEEP_IEC) ", #" XSTR (SLEEP_BIT) \
+		    : : : "memory")
+#define SLEEP_IF_SET() (SLEEP_IFS & (1u << SLEEP_BIT))
+
+/* 2^32 * SLEEP_FCY / 10^9 and 2^32 * 10^9 / SLEEP_FCY: cycles from
+   nanoseconds and nanoseconds from cycles below SLEEP_FCY */
+#define TICK_SCALE \
+  ((unsigned long long) (((unsigned long long) SLEEP_FCY << 32) \
+			 / 1000000000UL))
+#define NSEC_SCALE \
+  ((unsigned long long) ((1000000000ULL << 32) / SLEEP_FCY))
+
+#define SLEEP_OVERHEAD	(SLEEP_ENTRY + SLEEP_EXIT)
+
+static volatile unsigned char sleep_done, sleep_woken;
+
+void __attribute__ ((__interrupt__, __no_auto_psv__))
+SLEEP_VECTOR (void)
+{
+  SLEEP_IF_CLEAR ();
+  SLEEP_IE_OFF ();
+  sleep_done = 1;
+}
+
+void
+pic30_sleep_wake (void)
+{
+  sleep_woken = 1;
+}
+
+/* Start a period of TICKS cycles, at least 2.  */
+static void
+sleep_start (unsigned long ticks)
+{
+  SLEEP_CON = 0;
+  SLEEP_HLD = 0;
+  SLEEP_LO = 0;
+  --ticks;
+  SLEEP_PRLO = (unsigned int) ticks;
+  SLEEP_PRHI = (unsigned int) (ticks >> 16);
+  sleep_done = 0;
+  SLEEP_IF_CLEAR ();
+  SLEEP_CON = TCON_ON;
+}
+
+/* Cycles of the period started with TICKS left to run.  */
+static unsigned long
+sleep_left (unsigned long ticks)
+{
+  /* reading the low half latches the high half */
+  unsigned int lo = SLEEP_LO;
+  unsigned long t = ((unsigned long) SLEEP_HLD << 16) | lo;
+
+  return t < ticks ? ticks - t : 0;
+}
+
+int
+nanosleep (const struct timespec *rqtp,
+	struct timespec *rmtp)
+{
+  unsigned long long ticks;
+  unsigned long period;
+  unsigned int sr;
+
+  if (rqtp->tv_nsec < 0 || rqtp->tv_nsec >= 1000000000L || rqtp->tv_sec < 0)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  ticks = (unsigned long long) rqtp->tv_sec * SLEEP_FCY
+    + (((unsigned long) rqtp->tv_nsec * TICK_SCALE) >> 32);
+  sleep_woken = 0;
+
+  if (ticks <= SLEEP_OVERHEAD + SLEEP_SPIN)
+    {
+      if (ticks > SLEEP_ENTRY + 2)
+	{
+	  sleep_start ((unsigned long) ticks - SLEEP_ENTRY);
+	  while (!SLEEP_IF_SET ())
+	    ;
+	  SLEEP_CON = 0;
+	}
+      return 0;
+    }
+
+  ticks -= SLEEP_OVERHEAD;
+  do
+    {
+      period = ticks > 0xffffffffUL ? 0xffffffffUL : (unsigned long) ticks;
+      ticks -= period;
+      sleep_start (period);
+      SLEEP_IE_ON ();
+      while (!sleep_done && !sleep_woken)
+	{
+	  sr = SR;
+	  SR = sr | SR_IPL7;
+	  if (!sleep_done && !sleep_woken)
+	    __asm__ volatile ("pwrsav\t#1" : : : "memory");
+	  SR = sr;
+	}
+    }
+  while (!sleep_woken && ticks != 0);
+  SLEEP_IE_OFF ();
+  SLEEP_CON = 0;
+
+  if (!sleep_woken)
+    return 0;
+  if (!sleep_done)
+    ticks += sleep_left (period);
+  if (rmtp)
+    {
+      const unsigned long long sec = ticks / SLEEP_FCY;
+
+      rmtp->tv_sec = (time_t) sec;
+      rmtp->tv_nsec = (long) (((unsigned long) (ticks - sec * SLEEP_FCY)
+			       * NSEC_SCALE) >> 32);
+    }
+  errno = EINTR;
+  return -1;
+}
+
+unsigned int
+sleep (unsigned int seconds)
+{
+  struct timespec ts;
+
+  ts.tv_sec = seconds;
+  ts.tv_nsec = 0;
+  if (nanosleep (&ts, &ts) == 0)
+    return 0;
+  /* rounded up, as the seconds not slept */
+  return (unsigned int) ts.tv_sec + (ts.tv_nsec != 0);
+}
+
+int
+usleep (useconds_t useconds)
+{
+  struct timespec ts;
+
+  ts.tv_sec = useconds / 1000000UL;
+  ts.tv_nsec = (long) (useconds % 1000000UL) * 1000;
+  return nanosleep (&ts, NULL);
+}
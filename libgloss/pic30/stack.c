@@ -0,0 +1,50 @@
+/* stack.c -- the stack high-water mark, see pic30-stack.h.
+
+   The stack grows up, so the scan starts from the limit and walks
+   down over the painted words to the highest one written, which in
+   a stack with room to spare is a short walk.  */
+
+#include <stddef.h>
+#include "pic30-stack.h"
+
+/* Placed by the linker script; see crt0.S */
+extern unsigned int _SP_init[], _SPLIM_init[];
+
+void
+__task_stack_paint (void *base,
+	size_t size)
+{
+  unsigned int *p = base;
+  unsigned int *const end = p + size / sizeof *p;
+
+  while (p < end)
+    *p++ = PIC30_STACK_PAINT;
+}
+
+size_t
+__task_stack_high_water (const void *base,
+	size_t size)
+{
+  const unsigned int *const start = base;
+  const unsigned int *p = start + size / sizeof *p;
+
+  while (p > start && p[-1] == PIC30_STACK_PAINT)
+    --p;
+  return (size_t) ((const char *) p - (const char *) start);
+}
+
+/* crt0 paints up to and including the word at __SPLIM_init.  */
+#define STACK_SIZE \
+  ((size_t) ((char *) (_SPLIM_init + 1) - (char *) _SP_init))
+
+size_t
+__stack_high_water (void)
+{
+  return __task_stack_high_water (_SP_init, STACK_SIZE);
+}
+
+size_t
+__stack_free (void)
+{
+  return STACK_SIZE - __stack_high_water ();
+}
@@ -1,53 +1,42 @@
+#include <errno.h>
 #include <sys/stat.h>
+#include <sys/types.h>
 #include "../syscall.h"
-
-int
-_read (file, ptr, len)
-     int    file;
-     char * ptr;
-     int    len;
-{
-  
-  
-  return;
-}
-
-int
+#include "pic30-semihost.h"
+
+/* In romfs.c, which only a program that opens files links.  */
+extern off_t __romfs_lseek (int, off_t, int) __attribute__ ((weak));
+extern int __romfs_fstat (int, struct stat *) __attribute__ ((weak));
+extern int __romfs_close (int) __attribute__ ((weak));
+/* In semihost.c, in libsemi.a only.  */
+extern off_t __semihost_lseek (int, off_t, int) __attribute__ ((weak));
+extern int __semihost_fstat (int, struct stat *) __attribute__ ((weak));
+extern int __semihost_close (int) __attribute__ ((weak));
+extern void __semihost_exit (int) __attribute__ ((weak));
+
+off_t
 _lseek (file, ptr, dir)
      int file;
-     int ptr;
+     off_t ptr;
      int dir;
 {
-
-  
-  return;
-}
-
-int
-_write (file, ptr, len)
-     int    file;
-     char * ptr;
-     int    len;
-{
-
-  return;
-}
-
-int
-_open (path, flags)
-     const char * path;
-     int flags;
-{
-
-  
-  return;
+  if (file >= PIC30_SEMIHOST_FD0 && __semihost_lseek)
+    return __semihost_lseek (file, ptr, dir);
+  if (file > 2 && __romfs_lseek)
+    return __romfs_lseek (file, ptr, dir);
+  /* The console cannot seek.  */
+  errno = file >= 0 && file <= 2 ? ESPIPE : EBADF;
+  return -1;
 }
 
 int
 _close (file)
      int file;
 {
-
+  if (file >= PIC30_SEMIHOST_FD0 && __semihost_close)
+    return __semihost_close (file);
+  if (file > 2 && __romfs_close)
+    return __romfs_close (file);
   return 0;
 }
 
@@ -55,11 +44,12 @@ void
 _exit (n)
      int n;
 {
-
+  if (__semihost_exit)
+    __semihost_exit (n);
 }
 
 extern void _heap, _eheap;
-void *__curbrk;
+void *__curbrk __attribute__ ((__near__));
 
 int
 _brk(void *endds)
@@ -105,12 +95,22 @@ _sbrk(int incr)
 	return(oldbrk);
 }
 
+/* The stdio buffer size for the console, see __swhatbuf_r.  */
+#ifndef CONSOLE_BLKSIZE
+#define CONSOLE_BLKSIZE 128
+#endif
+
 int
 _fstat (file, st)
      int file;
      struct stat * st;
 {
+  if (file >= PIC30_SEMIHOST_FD0 && __semihost_fstat)
+    return __semihost_fstat (file, st);
+  if (file > 2 && __romfs_fstat)
+    return __romfs_fstat (file, st);
   st->st_mode = S_IFCHR;
+  st->st_blksize = CONSOLE_BLKSIZE;
   return 0;
 }
 
@@ -133,20 +133,6 @@ _raise ()
   return 0;
 }
 
-int
-_times ()
-{
-  return 0;
-}
-
-int
-_kill (pid, sig)
-     int pid;
-     int sig;
-{
-  return 0;
-}
-
 int
 _getpid (void)
 {
@@ -0,0 +1,692 @@
+/* threads.c -- C11 threads for pic30 on a cooperative scheduler.
+
+   A thread runs until it blocks in mtx_lock, cnd_wait, thrd_join or
+   thrd_sleep, or gives up the CPU with thrd_yield, and the next ready
+   thread in the order they were created then runs.  Nothing preempts
+   a thread, so the data the threads share needs no lock between two
+   of these calls, but a thread that loops without making one holds up
+   all the others.  A library built with --enable-newlib-yield-interval
+   calls __libc_yield from its long loops, and the one here yields
+   when it is called from thread code, so that qsort, memcpy, printf
+   and the like do not.
+
+   The first thrd_create turns main into a thread.  Each thread
+   created has its stack, PIC30_THREAD_STACK bytes unless
+   pic30_thread_stack_size says otherwise, and its own struct _reent
+   in one block from malloc.  The reent gives it its own errno, strtok
+   and the like, and shares the standard streams of main; a context
+   switch points _impure_ptr, and __pic30_reent in a library built
+   with __DYNAMIC_REENT__, at it.  In a library built with
+   retargetable locks, a thread that finds a lock held by another
+   blocks in __pic30_lock_wait until it is released.
+
+   When no thread is ready, the CPU waits in nanosleep for the first
+   timeout of a blocked thread, and spins if there is none.  The
+   timeouts of mtx_timedlock and cnd_timedwait are TIME_UTC times, of
+   clock_gettime, and like thrd_sleep need pic30_timer_init to have been
+   called.  Interrupt handlers must not call these functions.  */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+#include <time.h>
+#include <reent.h>
+#include "pic30-stack.h"
+#include "pic30-sleep.h"
+#include "pic30-thread.h"
+#include "pic30-timer.h"
+
+#define THREAD_READY	0
+#define THREAD_BLOCKED	1
+#define THREAD_DONE	2
+
+/* Bytes at the top of a stack above SPLIM, for the stack error trap */
+#define STACK_GUARD	32
+
+struct __pic30_thread
+{
+  void *sp;			/* w15 while switched out; first, see context.S */
+  unsigned int splim;		/* SPLIM of the stack */
+  struct __pic30_thread *next;	/* all threads, in a ring */
+  unsigned char state;
+  unsigned char detached;
+  unsigned char timed;		/* blocked with a timeout */
+  unsigned char timedout;	/* ... which has passed */
+  const void *chan;		/* what a blocked thread waits for */
+  struct timespec deadline;	/* CLOCK_MONOTONIC */
+  thrd_start_t func;
+  void *arg;
+  int res;
+  void *tss[PIC30_TSS_MAX];
+  struct _reent *reent;
+  void *stack;
+  size_t stack_size;
+};
+
+size_t pic30_thread_stack_size = PIC30_THREAD_STACK;
+
+/* main, once there are threads */
+static struct __pic30_thread main_thread;
+static struct __pic30_thread *current;
+/* A detached thread that has exited, freed by the next to run */
+static struct __pic30_thread *zombie;
+
+static tss_dtor_t tss_dtors[PIC30_TSS_MAX];
+static unsigned char tss_used[PIC30_TSS_MAX];
+
+extern struct _reent *__pic30_reent __attribute__ ((__weak__, __near__));
+
+/* context.S */
+extern void __pic30_context_switch (void **save_sp, void *sp,
+				    unsigned int splim);
+extern void *__pic30_context_init (void *stack);
+void __pic30_thread_start (void) __attribute__ ((__noreturn__));
+
+struct __lock;
+
+static void
+sched_init (void)
+{
+  unsigned int splim;
+
+  if (current != NULL)
+    return;
+  __asm__ volatile ("mov\tSPLIM, %0" : "=r" (splim));
+  main_thread.splim = splim;
+  main_thread.next = &main_thread;
+  main_thread.reent = _impure_ptr;
+  current = &main_thread;
+}
+
+static int
+ts_before (const struct timespec *a,
+	const struct timespec *b)
+{
+  return a->tv_sec < b->tv_sec
+    || (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
+/* Whether T may run, counting a timeout that has passed as a wakeup.  */
+static int
+thread_ready (struct __pic30_thread *t,
+	const struct timespec *now)
+{
+  if (t->state == THREAD_BLOCKED && t->timed
+      && !ts_before (now, &t->deadline))
+    {
+      t->state = THREAD_READY;
+      t->timedout = 1;
+    }
+  return t->state == THREAD_READY;
+}
+
+/* Unlink T from the ring; it is not the current thread.  */
+static void
+thread_unlink (struct __pic30_thread *t)
+{
+  struct __pic30_thread *p = current;
+
+  while (p->next != t)
+    p = p->next;
+  p->next = t->next;
+}
+
+/* Free the detached thread that exited last, from another stack.  */
+static void
+reap (void)
+{
+  if (zombie != NULL)
+    {
+      thread_unlink (zombie);
+      free (zombie);
+      zombie = NULL;
+    }
+}
+
+/* Switch to the next ready thread after the current one, which may be
+   itself, and return when the current one runs again.  */
+static void
+schedule (void)
+{
+  struct __pic30_thread *prev = current, *t = current;
+  struct __pic30_thread *first;
+  struct timespec now, wait;
+
+  for (;;)
+    {
+      clock_gettime (CLOCK_MONOTONIC, &now);
+      first = NULL;
+      do
+	{
+	  t = t->next;
+	  if (thread_ready (t, &now))
+	    goto found;
+	  if (t->state == THREAD_BLOCKED && t->timed
+	      && (first == NULL || ts_before (&t->deadline, &first->deadline)))
+	    first = t;
+	}
+      while (t != prev);
+
+      if (first == NULL)
+	continue;
+      wait.tv_sec = first->deadline.tv_sec - now.tv_sec;
+      wait.tv_nsec = first->deadline.tv_nsec - now.tv_nsec;
+      if (wait.tv_nsec < 0)
+	{
+	  wait.tv_nsec += 1000000000L;
+	  wait.tv_sec--;
+	}
+      nanosleep (&wait, NULL);
+    }
+
+found:
+  if (t == prev)
+    return;
+  current = t;
+  _impure_ptr = t->reent;
+  if (&__pic30_reent)
+    __pic30_reent = t->reent;
+  __pic30_context_switch (&prev->sp, t->sp, t->splim);
+
+  /* running again as prev */
+  reap ();
+}
+
+/* Give up the CPU until wake (CHAN), or until DEADLINE if not NULL.
+   Return nonzero if the deadline passed.  */
+static int
+block (const void *chan,
+	const struct timespec *deadline)
+{
+  current->chan = chan;
+  current->timed = deadline != NULL;
+  current->timedout = 0;
+  if (deadline)
+    current->deadline = *deadline;
+  current->state = THREAD_BLOCKED;
+  schedule ();
+  current->chan = NULL;
+  return current->timedout;
+}
+
+static void
+wake (const void *chan)
+{
+  struct __pic30_thread *t = current;
+
+  do
+    {
+      if (t->state == THREAD_BLOCKED && t->chan == chan)
+	t->state = THREAD_READY;
+      t = t->next;
+    }
+  while (t != current);
+}
+
+/* A TIME_UTC time as a CLOCK_MONOTONIC one, see timer.c.  */
+static struct timespec *
+monotonic (struct timespec *mono,
+	const struct timespec *utc)
+{
+  mono->tv_sec = utc->tv_sec - pic30_timer_epoch;
+  mono->tv_nsec = utc->tv_nsec;
+  return mono;
+}
+
+void
+__pic30_thread_start (void)
+{
+  reap ();
+  thrd_exit (current->func (current->arg));
+}
+
+int
+thrd_create (thrd_t *thr,
+	thrd_start_t func,
+	void *arg)
+{
+  struct __pic30_thread *t;
+  size_t stack_size = (pic30_thread_stack_size + 1) & ~1u;
+  char *p;
+
+  if (stack_size < 4 * STACK_GUARD)
+    stack_size = 4 * STACK_GUARD;
+  p = malloc (sizeof (*t) + sizeof (struct _reent) + stack_size);
+  if (p == NULL)
+    return thrd_nomem;
+  sched_init ();
+
+  t = (struct __pic30_thread *) p;
+  memset (t, 0, sizeof (*t));
+  t->reent = (struct _reent *) (p + sizeof (*t));
+  _REENT_INIT_PTR (t->reent);
+  /* the standard streams are those of main */
+  _REENT_SMALL_CHECK_INIT (_GLOBAL_REENT);
+  t->reent->__sdidinit = 1;
+  t->reent->_stdin = _GLOBAL_REENT->_stdin;
+  t->reent->_stdout = _GLOBAL_REENT->_stdout;
+  t->reent->_stderr = _GLOBAL_REENT->_stderr;
+
+  t->stack = p + sizeof (*t) + sizeof (struct _reent);
+  t->stack_size = stack_size;
+  __task_stack_paint (t->stack, stack_size);
+  t->sp = __pic30_context_init (t->stack);
+  t->splim = (unsigned int) t->stack + stack_size - STACK_GUARD;
+  t->func = func;
+  t->arg = arg;
+  t->state = THREAD_READY;
+
+  /* last in the ring, just before main */
+  {
+    struct __pic30_thread *last = &main_thread;
+
+    while (last->next != &main_thread)
+      last = last->next;
+    last->next = t;
+    t->next = &main_thread;
+  }
+  *thr = t;
+  return thrd_success;
+}
+
+thrd_t
+thrd_current (void)
+{
+  sched_init ();
+  return current;
+}
+
+int
+thrd_equal (thrd_t a,
+	thrd_t b)
+{
+  return a == b;
+}
+
+void
+thrd_yield (void)
+{
+  if (current != NULL)
+    schedule ();
+}
+
+int
+thrd_sleep (const struct timespec *duration,
+	struct timespec *remaining)
+{
+  struct timespec deadline;
+
+  if (duration->tv_sec < 0 || duration->tv_nsec < 0
+      || duration->tv_nsec >= 1000000000L)
+    return -2;
+  sched_init ();
+  clock_gettime (CLOCK_MONOTONIC, &deadline);
+  deadline.tv_sec += duration->tv_sec;
+  deadline.tv_nsec += duration->tv_nsec;
+  if (deadline.tv_nsec >= 1000000000L)
+    {
+      deadline.tv_nsec -= 1000000000L;
+      deadline.tv_sec++;
+    }
+  block (NULL, &deadline);
+  if (remaining)
+    {
+      remaining->tv_sec = 0;
+      remaining->tv_nsec = 0;
+    }
+  return 0;
+}
+
+void
+thrd_exit (int res)
+{
+  struct __pic30_thread *t;
+  unsigned int i, pass;
+  int again;
+
+  sched_init ();
+  for (pass = 0; pass < TSS_DTOR_ITERATIONS; pass++)
+    {
+      again = 0;
+      for (i = 0; i < PIC30_TSS_MAX; i++)
+	if (current->tss[i] != NULL && tss_dtors[i] != NULL)
+	  {
+	    void *v = current->tss[i];
+
+	    current->tss[i] = NULL;
+	    tss_dtors[i] (v);
+	    again = 1;
+	  }
+      if (!again)
+	break;
+    }
+
+  current->res = res;
+  current->state = THREAD_DONE;
+  wake (current);
+
+  /* the program ends with its last thread */
+  for (t = current->next; t != current; t = t->next)
+    if (t->state != THREAD_DONE)
+      break;
+  if (t == current)
+    exit (0);
+
+  if (current->detached && current != &main_thread)
+    zombie = current;
+  schedule ();
+  for (;;)
+    ;
+}
+
+int
+thrd_detach (thrd_t thr)
+{
+  if (thr->detached)
+    return thrd_error;
+  if (thr->state == THREAD_DONE)
+    {
+      if (thr != &main_thread)
+	{
+	  thread_unlink (thr);
+	  free (thr);
+	}
+      return thrd_success;
+    }
+  thr->detached = 1;
+  return thrd_success;
+}
+
+int
+thrd_join (thrd_t thr,
+	int *res)
+{
+  sched_init ();
+  if (thr == current || thr->detached)
+    return thrd_error;
+  while (thr->state != THREAD_DONE)
+    block (thr, NULL);
+  if (res)
+    *res = thr->res;
+  if (thr != &main_thread)
+    {
+      thread_unlink (thr);
+      free (thr);
+    }
+  return thrd_success;
+}
+
+/* The high-water mark of the stack of THR, see pic30-stack.h.  */
+size_t
+pic30_thread_stack_high_water (thrd_t thr)
+{
+  if (thr == &main_thread)
+    return __stack_high_water ();
+  return __task_stack_high_water (thr->stack, thr->stack_size);
+}
+
+int
+mtx_init (mtx_t *mtx,
+	int type)
+{
+  mtx->_owner = NULL;
+  mtx->_depth = 0;
+  mtx->_type = type;
+  return thrd_success;
+}
+
+void
+mtx_destroy (mtx_t *mtx)
+{
+}
+
+static int
+mtx_take (mtx_t *mtx,
+	const struct timespec *deadline)
+{
+  sched_init ();
+  while (mtx->_owner != NULL && mtx->_owner != current)
+    if (block (mtx, deadline))
+      return thrd_timedout;
+  if (mtx->_owner == current && !(mtx->_type & mtx_recursive))
+    return thrd_error;
+  mtx->_owner = current;
+  mtx->_depth++;
+  return thrd_success;
+}
+
+int
+mtx_lock (mtx_t *mtx)
+{
+  return mtx_take (mtx, NULL);
+}
+
+int
+mtx_timedlock (mtx_t *__restrict mtx,
+	const struct timespec *__restrict ts)
+{
+  struct timespec deadline;
+
+  return mtx_take (mtx, monotonic (&deadline, ts));
+}
+
+int
+mtx_trylock (mtx_t *mtx)
+{
+  sched_init ();
+  if (mtx->_owner != NULL
+      && (mtx->_owner != current || !(mtx->_type & mtx_recursive)))
+    return thrd_busy;
+  mtx->_owner = current;
+  mtx->_depth++;
+  return thrd_success;
+}
+
+int
+mtx_unlock (mtx_t *mtx)
+{
+  sched_init ();
+  if (mtx->_owner != current)
+    return thrd_error;
+  if (--mtx->_depth == 0)
+    {
+      mtx->_owner = NULL;
+      wake (mtx);
+    }
+  return thrd_success;
+}
+
+int
+cnd_init (cnd_t *cond)
+{
+  cond->_waiters = 0;
+  cond->_signals = 0;
+  return thrd_success;
+}
+
+void
+cnd_destroy (cnd_t *cond)
+{
+}
+
+int
+cnd_signal (cnd_t *cond)
+{
+  if (cond->_signals < cond->_waiters)
+    {
+      cond->_signals++;
+      wake (cond);
+    }
+  return thrd_success;
+}
+
+int
+cnd_broadcast (cnd_t *cond)
+{
+  if (cond->_signals < cond->_waiters)
+    {
+      cond->_signals = cond->_waiters;
+      wake (cond);
+    }
+  return thrd_success;
+}
+
+static int
+cnd_block (cnd_t *cond,
+	mtx_t *mtx,
+	const struct timespec *deadline)
+{
+  int ret = thrd_success;
+  unsigned int depth;
+
+  sched_init ();
+  if (mtx->_owner != current)
+    return thrd_error;
+  depth = mtx->_depth;
+  mtx->_depth = 1;
+  mtx_unlock (mtx);
+
+  cond->_waiters++;
+  while (cond->_signals == 0)
+    if (block (cond, deadline))
+      {
+	ret = thrd_timedout;
+	break;
+      }
+  if (ret == thrd_success)
+    cond->_signals--;
+  cond->_waiters--;
+  if (cond->_signals > cond->_waiters)
+    cond->_signals = cond->_waiters;
+
+  mtx_take (mtx, NULL);
+  mtx->_depth = depth;
+  return ret;
+}
+
+int
+cnd_wait (cnd_t *cond,
+	mtx_t *mtx)
+{
+  return cnd_block (cond, mtx, NULL);
+}
+
+int
+cnd_timedwait (cnd_t *__restrict cond,
+	mtx_t *__restrict mtx,
+	const struct timespec *__restrict ts)
+{
+  struct timespec deadline;
+
+  return cnd_block (cond, mtx, monotonic (&deadline, ts));
+}
+
+void
+call_once (once_flag *flag,
+	void (*func) (void))
+{
+  while (flag->_flags == 1)
+    thrd_yield ();
+  if (flag->_flags == 0)
+    {
+      flag->_flags = 1;
+      func ();
+      flag->_flags = 2;
+    }
+}
+
+int
+tss_create (tss_t *key,
+	tss_dtor_t dtor)
+{
+  unsigned int i;
+
+  for (i = 0; i < PIC30_TSS_MAX; i++)
+    if (!tss_used[i])
+      {
+	tss_used[i] = 1;
+	tss_dtors[i] = dtor;
+	*key = i;
+	return thrd_success;
+      }
+  return thrd_error;
+}
+
+void
+tss_delete (tss_t key)
+{
+  struct __pic30_thread *t;
+
+  if (key >= PIC30_TSS_MAX)
+    return;
+  tss_used[key] = 0;
+  tss_dtors[key] = NULL;
+  main_thread.tss[key] = NULL;
+  if (current != NULL)
+    for (t = current->next; t != current; t = t->next)
+      t->tss[key] = NULL;
+}
+
+void *
+tss_get (tss_t key)
+{
+  sched_init ();
+  return key < PIC30_TSS_MAX ? current->tss[key] : NULL;
+}
+
+int
+tss_set (tss_t key,
+	void *val)
+{
+  sched_init ();
+  if (key >= PIC30_TSS_MAX || !tss_used[key])
+    return thrd_error;
+  current->tss[key] = val;
+  return thrd_success;
+}
+
+/* The hooks of the retargetable locks, see libc/machine/pic30/lock.c.
+   A thread that finds a lock held can only be handed it by the holder
+   running, so waiting blocks until its release rather than spins.  */
+void *
+__pic30_lock_self (void)
+{
+  return current;
+}
+
+void
+__pic30_lock_wait (struct __lock *lock)
+{
+  block (lock, NULL);
+}
+
+void
+__pic30_lock_wake (struct __lock *lock)
+{
+  wake (lock);
+}
+
+/* Called from the long loops of the library, see <sys/yield.h>: yield
+   unless that is an interrupt handler, or code that raised the CPU
+   priority to hold them off.  */
+#define SR_IPL		0x00e0
+#define CORCON_IPL3	0x0008
+
+/* In signal.c, when the program uses signals */
+extern int sigpoll (void) __attribute__ ((__weak__));
+
+void __attribute__ ((__weak__))
+__libc_yield (void)
+{
+  unsigned int sr, corcon;
+
+  if (sigpoll)
+    sigpoll ();
+  if (current == NULL || current->next == current)
+    return;
+  __asm__ volatile ("mov\tSR, %0\n\tmov\tCORCON, %1"
+		    : "=r" (sr), "=r" (corcon));
+  if ((sr & SR_IPL) == 0 && (corcon & CORCON_IPL3) == 0)
+    schedule ();
+}
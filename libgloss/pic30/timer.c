@@ -0,0 +1,198 @@
+/* timer.c -- clock_gettime, _gettimeofday and _times for pic30.
+
+   Timer2 and Timer3 run as one 32-bit timer from the instruction
+   clock with no prescaler, so a tick is 1 / TIMER_FCY, 25 ns at 40
+   MIPS.  Its period interrupt, once every 2^32 ticks (107 seconds at
+   40 MIPS), counts the wraps that make up the high 32 bits of a
+   64-bit count.  A reader that finds the interrupt pending, because
+   it runs with it masked or in a handler of higher priority, counts
+   the wrap itself when the timer has already restarted from 0.
+
+   The count is turned into nanoseconds with a multiply by a scaled
+   reciprocal of TIMER_FCY rather than a second 64-bit divide.
+
+   The defaults suit the dsPIC33F and PIC24H families; any of the
+   settings below can be overridden when the BSP is built, together
+   with PIC30_TIMER_LO and PIC30_TIMER_HLD from pic30-timer.h.  */
+
+#include <errno.h>
+#include <time.h>
+#include <sys/time.h>
+#include <sys/times.h>
+#include "pic30-timer.h"
+
+/* Instruction clock */
+#ifndef TIMER_FCY
+#define TIMER_FCY	40000000UL
+#endif
+/* The control and period registers of the pair */
+#ifndef TIMER_CON
+#define TIMER_CON	T2CON
+#define TIMER_PRLO	PR2
+#define TIMER_PRHI	PR3
+#define TIMER_VECTOR	_T3Interrupt
+#endif
+/* Where the interrupt flag and enable of the high timer live */
+#ifndef TIMER_IFS
+#define TIMER_IFS	IFS0
+#define TIMER_IEC	IEC0
+#define TIMER_BIT	8
+#endif
+
+#define XSTR(x) STR (x)
+#define STR(x) #x
+
+/* The SFRs are placed by the device linker script */
+#define SFR(x) extern volatile unsigned int x __attribute__ ((__sfr__))
+SFR (TIMER_CON);
+SFR (TIMER_PRLO);
+SFR (TIMER_PRHI);
+SFR (TIMER_IFS);
+
+/* On, 32-bit, instruction clock, 1:1 */
+#define TCON_ON		0x8008
+
+#define TIMER_IF_CLEAR() \
+  __asm__ volatile ("bclr\t" XSTR (TIMER_IFS) ", #" XSTR (TIMER_BIT) \
+		    : : : "memory")
+#define TIMER_IE_OFF() \
+  __asm__ volatile ("bclr\t" XSTR (TIMER_IEC) ", #" XSTR (TIMER_BIT) \
+		    : : : "memory")
+#define TIMER_IE_ON() \
+  __asm__ volatile ("bset\t" XSTR (TIMER_IEC) ", #" XSTR (TIMER_BIT) \
+		    : : : "memory")
+#define TIMER_IF_SET() (TIMER_IFS & (1u << TIMER_BIT))
+
+/* 2^32 * 10^9 / TIMER_FCY: nanoseconds from ticks below TIMER_FCY,
+   whose product with it stays below 2^62 */
+#define NSEC_SCALE \
+  ((unsigned long long) ((1000000000ULL << 32) / TIMER_FCY))
+
+time_t pic30_timer_epoch;
+
+static volatile unsigned long timer_wraps;
+
+void __attribute__ ((__interrupt__, __no_auto_psv__))
+TIMER_VECTOR (void)
+{
+  TIMER_IF_CLEAR ();
+  ++timer_wraps;
+}
+
+void
+pic30_timer_init (void)
+{
+  TIMER_IE_OFF ();
+  TIMER_CON = 0;
+  PIC30_TIMER_HLD = 0;
+  PIC30_TIMER_LO = 0;
+  TIMER_PRLO = 0xffff;
+  TIMER_PRHI = 0xffff;
+  timer_wraps = 0;
+  TIMER_IF_CLEAR ();
+  TIMER_IE_ON ();
+  TIMER_CON = TCON_ON;
+}
+
+unsigned long long
+pic30_timer_ticks (void)
+{
+  unsigned long wraps, counted;
+  unsigned int lo, hi;
+
+  do
+    {
+      wraps = counted = timer_wraps;
+      lo = PIC30_TIMER_LO;
+      hi = PIC30_TIMER_HLD;
+      /* a wrap its handler has not counted yet */
+      if (TIMER_IF_SET () && hi < 0x8000)
+	++wraps;
+    }
+  while (counted != timer_wraps);
+  return ((unsigned long long) wraps << 32)
+    | ((unsigned long) hi << 16) | lo;
+}
+
+/* The time since pic30_timer_init in seconds and ticks.  */
+static time_t
+timer_split (unsigned long *ticks)
+{
+  const unsigned long long t = pic30_timer_ticks ();
+  const unsigned long long sec = t / TIMER_FCY;
+
+  *ticks = (unsigned long) (t - sec * TIMER_FCY);
+  return (time_t) sec;
+}
+
+static long
+ticks_to_nsec (unsigned long ticks)
+{
+  return (long) ((ticks * NSEC_SCALE) >> 32);
+}
+
+int
+clock_gettime (clockid_t clock_id,
+	struct timespec *tp)
+{
+  unsigned long ticks;
+
+  if (clock_id != CLOCK_MONOTONIC && clock_id != CLOCK_REALTIME)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  tp->tv_sec = timer_split (&ticks);
+  tp->tv_nsec = ticks_to_nsec (ticks);
+  if (clock_id == CLOCK_REALTIME)
+    tp->tv_sec += pic30_timer_epoch;
+  return 0;
+}
+
+int
+clock_getres (clockid_t clock_id,
+	struct timespec *res)
+{
+  if (clock_id != CLOCK_MONOTONIC && clock_id != CLOCK_REALTIME)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  if (res)
+    {
+      res->tv_sec = 0;
+      res->tv_nsec = (1000000000UL + TIMER_FCY - 1) / TIMER_FCY;
+    }
+  return 0;
+}
+
+int
+_gettimeofday (struct timeval *tv,
+	void *tz)
+{
+  unsigned long ticks;
+
+  if (tv)
+    {
+      tv->tv_sec = timer_split (&ticks) + pic30_timer_epoch;
+      tv->tv_usec = ticks_to_nsec (ticks) / 1000;
+    }
+  return 0;
+}
+
+/* Everything counts as user time, in CLOCKS_PER_SEC for clock.  */
+clock_t
+_times (struct tms *buf)
+{
+  const clock_t t = (clock_t) (pic30_timer_ticks ()
+			       / (TIMER_FCY / CLOCKS_PER_SEC));
+
+  if (buf)
+    {
+      buf->tms_utime = t;
+      buf->tms_stime = 0;
+      buf->tms_cutime = 0;
+      buf->tms_cstime = 0;
+    }
+  return t;
+}
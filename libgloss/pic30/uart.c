@@ -0,0 +1,693 @@
+/* uart.c -- DMA fed console output and interrupt fed input for pic30.
+
+   _write copies the bytes into a ring buffer and returns; a DMA
+   channel moves them to the UART, triggered by its transmit
+   interrupt, one contiguous stretch of the ring at a time.  The DMA
+   completion interrupt starts the next stretch.
+
+   The ring is split by three free running indices: the bytes from
+   tx_tail to tx_send are being sent, those from tx_send to tx_head are
+   waiting.  Dropping the oldest waiting byte only moves tx_send, and
+   the completion handler then takes tx_tail straight to tx_send.
+   _writev fills the ring from every vector before starting the DMA,
+   so a gathered write from stdio goes out as one long stretch.
+
+   The receive interrupt empties the UART FIFO into a second ring, so
+   _read hands a whole burst to __srefill_r in one call.  By default it
+   waits for the first byte; it can instead fail at once with EAGAIN,
+   or with ETIMEDOUT after a number of milliseconds, timed with REPEAT
+   delays from UART_FCY.
+
+   fcntl (fd, F_SETFL, O_NONBLOCK) makes the same calls on one of the
+   console descriptors fail with EAGAIN instead of waiting: _read as
+   with PIC30_UART_RX_NONBLOCK, and _write under PIC30_UART_BLOCK,
+   which then queues what fits and returns the short count.  poll
+   (poll.c) asks __pic30_uart_revents what is ready, and while it
+   sleeps the handlers here wake it when bytes arrive or leave.
+
+   The defaults suit UART1 and DMA channel 0 of the dsPIC33F and PIC24H
+   families; any of the settings below can be overridden when the BSP
+   is built.  The buffer must lie in DMA RAM on those parts.  */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include "pic30-uart.h"
+#include "poll.h"
+
+/* In romfs.c, which only a program that opens files links.  */
+extern int __romfs_read (int, char *, int) __attribute__ ((weak));
+extern int __romfs_fstat (int, struct stat *) __attribute__ ((weak));
+/* In sleep.c, which a program that polls links.  */
+extern void pic30_sleep_wake (void) __attribute__ ((weak));
+
+#ifndef UART_NUM
+#define UART_NUM	1
+#endif
+#ifndef UART_DMA_CHANNEL
+#define UART_DMA_CHANNEL 0
+#endif
+/* DMA request number of the UART transmit interrupt */
+#ifndef UART_DMA_IRQ
+#define UART_DMA_IRQ	0x0c
+#endif
+/* Where the interrupt flag and enable of the DMA channel live */
+#ifndef UART_DMA_IFS
+#define UART_DMA_IFS	IFS0
+#define UART_DMA_IEC	IEC0
+#define UART_DMA_BIT	4
+#endif
+/* Where the interrupt flag and enable of the receiver live */
+#ifndef UART_RX_IFS
+#define UART_RX_IFS	IFS0
+#define UART_RX_IEC	IEC0
+#define UART_RX_BIT	11
+#endif
+/* Powers of two */
+#ifndef UART_TX_SIZE
+#define UART_TX_SIZE	256
+#endif
+#ifndef UART_RX_SIZE
+#define UART_RX_SIZE	128
+#endif
+/* Instruction clock, for the receive timeout */
+#ifndef UART_FCY
+#define UART_FCY	40000000UL
+#endif
+#ifndef UART_DMA_SPACE
+#ifdef __HAS_EDS__
+#define UART_DMA_SPACE
+#else
+#define UART_DMA_SPACE	__attribute__ ((space (dma)))
+#endif
+#endif
+
+#define CONCAT3(a, b, c) a ## b ## c
+#define XCONCAT3(a, b, c) CONCAT3 (a, b, c)
+#define STR(x) #x
+#define XSTR(x) STR (x)
+
+#define UMODE		XCONCAT3 (U, UART_NUM, MODE)
+#define USTA		XCONCAT3 (U, UART_NUM, STA)
+#define UBRG		XCONCAT3 (U, UART_NUM, BRG)
+#define UTXREG		XCONCAT3 (U, UART_NUM, TXREG)
+#define URXREG		XCONCAT3 (U, UART_NUM, RXREG)
+#define DMACON		XCONCAT3 (DMA, UART_DMA_CHANNEL, CON)
+#define DMAREQ		XCONCAT3 (DMA, UART_DMA_CHANNEL, REQ)
+#define DMACNT		XCONCAT3 (DMA, UART_DMA_CHANNEL, CNT)
+#define DMAPAD		XCONCAT3 (DMA, UART_DMA_CHANNEL, PAD)
+#ifdef __HAS_EDS__
+#define DMASTA		XCONCAT3 (DMA, UART_DMA_CHANNEL, STAL)
+#define DMA_ADDR(p)	((unsigned int) (p))
+#else
+#define DMASTA		XCONCAT3 (DMA, UART_DMA_CHANNEL, STA)
+#define DMA_ADDR(p)	__builtin_dmaoffset (p)
+#endif
+#define DMA_VECTOR	XCONCAT3 (_DMA, UART_DMA_CHANNEL, Interrupt)
+#define RX_VECTOR	XCONCAT3 (_U, UART_NUM, RXInterrupt)
+
+/* The SFRs are placed by the device linker script */
+#define SFR(x) extern volatile unsigned int x __attribute__ ((__sfr__))
+SFR (UMODE);
+SFR (USTA);
+SFR (UBRG);
+SFR (UTXREG);
+SFR (URXREG);
+SFR (DMACON);
+SFR (DMAREQ);
+SFR (DMASTA);
+SFR (DMACNT);
+SFR (DMAPAD);
+SFR (UART_DMA_IFS);
+SFR (UART_RX_IFS);
+
+#define UMODE_UARTEN	0x8000
+#define USTA_UTXEN	0x0400
+#define USTA_UTXBF	0x0200
+#define USTA_TRMT	0x0100
+#define USTA_OERR_BIT	1
+#define USTA_URXDA	0x0001
+#define DMACON_CHEN	0x8000
+/* Bytes, memory to peripheral, one shot */
+#define DMACON_TX	0x6001
+#define DMAREQ_FORCE	0x8000
+/* DMAxCNT is ten bits */
+#define DMA_MAX		1024
+
+/* Single instructions, so safe against the other handlers that share
+   the registers.  */
+#define DMA_IF_CLEAR() \
+  __asm__ volatile ("bclr\t" XSTR (UART_DMA_IFS) ", #" XSTR (UART_DMA_BIT) \
+		    : : : "memory")
+#define DMA_IE_OFF() \
+  __asm__ volatile ("bclr\t" XSTR (UART_DMA_IEC) ", #" XSTR (UART_DMA_BIT) \
+		    : : : "memory")
+#define DMA_IE_ON() \
+  __asm__ volatile ("bset\t" XSTR (UART_DMA_IEC) ", #" XSTR (UART_DMA_BIT) \
+		    : : : "memory")
+#define DMA_IF_SET() (UART_DMA_IFS & (1u << UART_DMA_BIT))
+#define RX_IF_CLEAR() \
+  __asm__ volatile ("bclr\t" XSTR (UART_RX_IFS) ", #" XSTR (UART_RX_BIT) \
+		    : : : "memory")
+#define RX_IE_OFF() \
+  __asm__ volatile ("bclr\t" XSTR (UART_RX_IEC) ", #" XSTR (UART_RX_BIT) \
+		    : : : "memory")
+#define RX_IE_ON() \
+  __asm__ volatile ("bset\t" XSTR (UART_RX_IEC) ", #" XSTR (UART_RX_BIT) \
+		    : : : "memory")
+#define OERR_CLEAR() \
+  __asm__ volatile ("bclr\t" XSTR (USTA) ", #" XSTR (USTA_OERR_BIT) \
+		    : : : "memory")
+
+/* REPEAT counts to 16383 at most on the older families */
+#define US_CYCLES	(UART_FCY / 1000000UL)
+#define US_REPEAT	(US_CYCLES > 16 ? US_CYCLES - 12 : 4)
+
+#define TX_MASK (UART_TX_SIZE - 1)
+#define RX_MASK (UART_RX_SIZE - 1)
+
+static unsigned char tx_buf[UART_TX_SIZE] UART_DMA_SPACE;
+static unsigned int tx_head;
+static volatile unsigned int tx_send, tx_tail;
+static volatile unsigned char tx_busy;
+static unsigned char tx_ready;
+static unsigned char tx_policy = PIC30_UART_BLOCK;
+
+volatile unsigned long pic30_uart_dropped;
+
+static unsigned char rx_buf[UART_RX_SIZE];
+static volatile unsigned int rx_head;
+static unsigned int rx_tail;
+static unsigned char rx_mode = PIC30_UART_RX_BLOCK;
+static unsigned int rx_timeout;
+
+volatile unsigned long pic30_uart_overruns;
+
+/* Bit N set for O_NONBLOCK on descriptor N */
+static unsigned char nonblock;
+#define NONBLOCK(fd)	(nonblock & (1u << (fd)))
+
+/* Set by poll while it sleeps */
+volatile unsigned char __pic30_uart_polled;
+
+static void
+poll_wake (void)
+{
+  if (__pic30_uart_polled && pic30_sleep_wake)
+    pic30_sleep_wake ();
+}
+
+/* Hand the next stretch of waiting bytes to the DMA.  Runs with the
+   completion interrupt masked or from its handler.  */
+static void
+tx_start (void)
+{
+  unsigned int at = tx_send & TX_MASK;
+  unsigned int n = tx_head - tx_send;
+
+  if (n > UART_TX_SIZE - at)
+    n = UART_TX_SIZE - at;
+  if (n > DMA_MAX)
+    n = DMA_MAX;
+
+  DMASTA = DMA_ADDR (&tx_buf[at]);
+  DMACNT = n - 1;
+  tx_send += n;
+  tx_busy = 1;
+  DMACON |= DMACON_CHEN;
+  /* With room in the UART the transmit interrupt will not come by
+     itself, so push the first byte.  */
+  if (!(USTA & USTA_UTXBF))
+    DMAREQ |= DMAREQ_FORCE;
+}
+
+static void
+tx_complete (void)
+{
+  DMA_IF_CLEAR ();
+  tx_tail = tx_send;
+  tx_busy = 0;
+  if (tx_send != tx_head)
+    tx_start ();
+  poll_wake ();
+}
+
+void __attribute__ ((__interrupt__, __no_auto_psv__))
+DMA_VECTOR (void)
+{
+  tx_complete ();
+}
+
+/* Start the DMA if it is idle, and stand in for its handler if that
+   cannot run at the caller's priority.  */
+static void
+tx_kick (void)
+{
+  DMA_IE_OFF ();
+  if (DMA_IF_SET ())
+    tx_complete ();
+  else if (!tx_busy && tx_send != tx_head)
+    tx_start ();
+  DMA_IE_ON ();
+}
+
+/* Move what the UART has received into the ring */
+static void
+rx_service (void)
+{
+  unsigned int head = rx_head;
+
+  RX_IF_CLEAR ();
+  while (USTA & USTA_URXDA)
+    {
+      unsigned char c = URXREG;
+
+      if (head - rx_tail < UART_RX_SIZE)
+	rx_buf[head++ & RX_MASK] = c;
+      else
+	pic30_uart_overruns++;
+    }
+  if (rx_head != head)
+    {
+      rx_head = head;
+      poll_wake ();
+    }
+  /* The FIFO stops on an overrun until the flag is cleared */
+  if (USTA & (1u << USTA_OERR_BIT))
+    {
+      OERR_CLEAR ();
+      pic30_uart_overruns++;
+    }
+}
+
+void __attribute__ ((__interrupt__, __no_auto_psv__))
+RX_VECTOR (void)
+{
+  rx_service ();
+}
+
+/* Stand in for the receive handler if it cannot run at the caller's
+   priority, then say whether there is anything to read.  */
+static int
+rx_poll (void)
+{
+  RX_IE_OFF ();
+  rx_service ();
+  RX_IE_ON ();
+  return rx_head != rx_tail;
+}
+
+static void
+delay_us (void)
+{
+  __asm__ volatile ("repeat\t#%0\n\tnop" : : "i" (US_REPEAT));
+}
+
+void
+pic30_uart_init (unsigned int brg)
+{
+  DMA_IE_OFF ();
+  RX_IE_OFF ();
+  UMODE = 0;
+  UBRG = brg;
+  UMODE = UMODE_UARTEN;
+  USTA = USTA_UTXEN;
+
+  DMACON = DMACON_TX;
+  DMAREQ = UART_DMA_IRQ;
+  DMAPAD = (unsigned int) &UTXREG;
+  tx_head = tx_send = tx_tail = 0;
+  tx_busy = 0;
+  tx_ready = 1;
+  DMA_IF_CLEAR ();
+  DMA_IE_ON ();
+
+  rx_head = rx_tail = 0;
+  RX_IF_CLEAR ();
+  RX_IE_ON ();
+}
+
+void
+pic30_uart_rx_mode (int mode,
+	unsigned int timeout_ms)
+{
+  rx_mode = mode;
+  rx_timeout = timeout_ms;
+}
+
+unsigned int
+pic30_uart_rx_pending (void)
+{
+  return rx_head - rx_tail;
+}
+
+int
+pic30_uart_overflow (int policy)
+{
+  int old = tx_policy;
+
+  tx_policy = policy;
+  return old;
+}
+
+void
+pic30_uart_drain (void)
+{
+  if (!tx_ready)
+    return;
+  while (tx_busy || tx_send != tx_head)
+    tx_kick ();
+  while (!(USTA & USTA_TRMT))
+    ;
+}
+
+int
+pic30_uart_fflush (FILE *fp)
+{
+  int ret = fflush (fp);
+
+  pic30_uart_drain ();
+  return ret;
+}
+
+/* Copy LEN bytes into the ring, starting the DMA only when the ring
+   is full; the caller kicks it for the rest.  Return how many were
+   taken, which is less than LEN only if NB and the ring filled up, or
+   under PIC30_UART_OVERWRITE if the DMA is sending.  Dropped bytes
+   count as taken.
+
+   Under PIC30_UART_OVERWRITE a full ring drops only as many of the
+   oldest unsent bytes as the rest of LEN needs.  While the DMA is idle
+   TX_TAIL is TX_SEND and those bytes are free at once.  While it is
+   busy the bytes it is reading, from TX_TAIL to TX_SEND, hold the ring
+   until tx_complete moves TX_TAIL up to TX_SEND, so the room counted
+   from TX_SEND is what the next call will find; make it enough and
+   return short rather than wait.  */
+static unsigned int
+tx_put (const char *ptr,
+	unsigned int len,
+	int nb)
+{
+  unsigned int done = 0;
+  unsigned int room, at, n, k;
+  int busy;
+
+  while (done < len)
+    {
+      room = UART_TX_SIZE - (tx_head - tx_tail);
+      if (room == 0)
+	{
+	  if (tx_policy == PIC30_UART_DROP)
+	    {
+	      pic30_uart_dropped += len - done;
+	      return len;
+	    }
+	  if (tx_policy == PIC30_UART_OVERWRITE)
+	    {
+	      n = len - done;
+	      DMA_IE_OFF ();
+	      busy = tx_busy;
+	      k = tx_head - tx_send;
+	      if (busy)
+		{
+		  room = UART_TX_SIZE - k;
+		  n = n > room ? n - room : 0;
+		}
+	      if (n > k)
+		n = k;
+	      tx_send += n;
+	      if (!busy)
+		tx_tail = tx_send;
+	      DMA_IE_ON ();
+	      pic30_uart_dropped += n;
+	      if (busy || n == 0)
+		break;
+	      continue;
+	    }
+	  tx_kick ();
+	  if (nb && UART_TX_SIZE == tx_head - tx_tail)
+	    break;
+	  continue;
+	}
+
+      at = tx_head & TX_MASK;
+      n = len - done;
+      if (n > room)
+	n = room;
+      if (n > UART_TX_SIZE - at)
+	n = UART_TX_SIZE - at;
+      memcpy (&tx_buf[at], ptr + done, n);
+      tx_head += n;
+      done += n;
+    }
+  return done;
+}
+
+static int
+tx_check (int file)
+{
+  if (file != 1 && file != 2)
+    {
+      errno = EBADF;
+      return -1;
+    }
+  if (!tx_ready)
+    {
+      errno = EIO;
+      return -1;
+    }
+  return 0;
+}
+
+int
+_write (int file,
+	char *ptr,
+	int len)
+{
+  unsigned int n;
+
+  if (tx_check (file))
+    return -1;
+  n = tx_put (ptr, len, NONBLOCK (file));
+  tx_kick ();
+  if (n == 0 && len > 0)
+    {
+      errno = EAGAIN;
+      return -1;
+    }
+  return n;
+}
+
+ssize_t
+_writev (int file,
+	const struct iovec *iov,
+	int iovcnt)
+{
+  ssize_t len = 0;
+  unsigned int n;
+  int i;
+
+  if (tx_check (file))
+    return -1;
+  for (i = 0; i < iovcnt; i++)
+    {
+      n = tx_put (iov[i].iov_base, iov[i].iov_len, NONBLOCK (file));
+      len += n;
+      if (n < iov[i].iov_len)
+	break;
+    }
+  tx_kick ();
+  if (len == 0 && i < iovcnt)
+    {
+      errno = EAGAIN;
+      return -1;
+    }
+  return len;
+}
+
+/* The console hooks of _STDIO_DIRECT_CONSOLE in <stdio.h>.  With
+   nothing queued the byte goes straight into UxTXREG, once the UART
+   FIFO has room; otherwise it joins the ring behind what is queued,
+   so the order is kept.  Under O_NONBLOCK on stdout a full FIFO sends
+   it to the ring, and a full ring fails with EAGAIN.  */
+int
+__console_putc (int c)
+{
+  unsigned char b = c;
+
+  if (!tx_ready)
+    return EOF;
+  if (!tx_busy && tx_tail == tx_head
+      && !(NONBLOCK (1) && (USTA & USTA_UTXBF)))
+    {
+      while (USTA & USTA_UTXBF)
+	;
+      UTXREG = b;
+    }
+  else
+    {
+      if (tx_put ((const char *) &b, 1, NONBLOCK (1)) == 0)
+	{
+	  tx_kick ();
+	  errno = EAGAIN;
+	  return EOF;
+	}
+      tx_kick ();
+    }
+  return b;
+}
+
+int
+_read (int file,
+	char *ptr,
+	int len)
+{
+  unsigned int at, n, avail;
+  unsigned long us;
+  int done = 0;
+
+  if (file != 0)
+    {
+      if (file > 2 && __romfs_read)
+	return __romfs_read (file, ptr, len);
+      errno = EBADF;
+      return -1;
+    }
+  if (!tx_ready)
+    {
+      errno = EIO;
+      return -1;
+    }
+
+  if (rx_head == rx_tail && !rx_poll ())
+    {
+      if (rx_mode == PIC30_UART_RX_NONBLOCK || NONBLOCK (0))
+	{
+	  errno = EAGAIN;
+	  return -1;
+	}
+      us = (unsigned long) rx_timeout * 1000;
+      while (!rx_poll ())
+	{
+	  if (rx_mode == PIC30_UART_RX_TIMEOUT)
+	    {
+	      if (us-- == 0)
+		{
+		  errno = ETIMEDOUT;
+		  return -1;
+		}
+	      delay_us ();
+	    }
+	}
+    }
+
+  /* Everything that has arrived, in at most two pieces */
+  while (done < len && (avail = rx_head - rx_tail) != 0)
+    {
+      at = rx_tail & RX_MASK;
+      n = len - done;
+      if (n > avail)
+	n = avail;
+      if (n > UART_RX_SIZE - at)
+	n = UART_RX_SIZE - at;
+      memcpy (ptr + done, &rx_buf[at], n);
+      rx_tail += n;
+      done += n;
+    }
+  return done;
+}
+
+int
+__console_getc (void)
+{
+  unsigned char c;
+
+  return _read (0, (char *) &c, 1) == 1 ? c : EOF;
+}
+
+/* What of EVENTS is ready on console descriptor FILE, for poll.  */
+short
+__pic30_uart_revents (int file,
+	short events)
+{
+  short revents = 0;
+
+  if (!tx_ready)
+    return POLLERR;
+  if (file == 0)
+    {
+      if ((events & POLLIN) && (rx_head != rx_tail || rx_poll ()))
+	revents |= POLLIN;
+    }
+  else
+    {
+      /* Let a handler that cannot run at this priority make room */
+      if (UART_TX_SIZE == tx_head - tx_tail)
+	tx_kick ();
+      if ((events & POLLOUT) && UART_TX_SIZE != tx_head - tx_tail)
+	revents |= POLLOUT;
+    }
+  return revents;
+}
+
+int
+_fcntl (int file,
+	int cmd,
+	int arg)
+{
+  struct stat st;
+  int mode;
+
+  if (file == 0)
+    mode = O_RDONLY;
+  else if (file == 1 || file == 2)
+    mode = O_WRONLY;
+  else if (file > 2 && __romfs_fstat && __romfs_fstat (file, &st) == 0)
+    mode = O_RDONLY;
+  else
+    {
+      errno = EBADF;
+      return -1;
+    }
+
+  switch (cmd)
+    {
+    case F_GETFL:
+      return file <= 2 && NONBLOCK (file) ? mode | O_NONBLOCK : mode;
+    case F_SETFL:
+      /* Files in program memory never wait, so only the console
+	 keeps the flag.  */
+      if (file <= 2)
+	{
+	  if (arg & O_NONBLOCK)
+	    nonblock |= 1u << file;
+	  else
+	    nonblock &= ~(1u << file);
+	}
+      return 0;
+    case F_GETFD:
+    case F_SETFD:
+      return 0;
+    default:
+      errno = EINVAL;
+      return -1;
+    }
+}
+
+int
+fcntl (int file,
+	int cmd,
+	...)
+{
+  va_list ap;
+  int arg;
+
+  va_start (ap, cmd);
+  arg = va_arg (ap, int);
+  va_end (ap);
+  return _fcntl (file, cmd, arg);
+}
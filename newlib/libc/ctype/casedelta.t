@@ -0,0 +1,167 @@
+  {0, 0},
+  {32, 0},
+  {0, 65504},
+  {0, 743},
+  {0, 121},
+  {1, 0},
+  {0, 65535},
+  {65337, 0},
+  {0, 65304},
+  {65415, 0},
+  {0, 65236},
+  {0, 195},
+  {210, 0},
+  {206, 0},
+  {205, 0},
+  {79, 0},
+  {202, 0},
+  {203, 0},
+  {207, 0},
+  {0, 97},
+  {211, 0},
+  {209, 0},
+  {0, 163},
+  {213, 0},
+  {0, 130},
+  {214, 0},
+  {218, 0},
+  {217, 0},
+  {219, 0},
+  {0, 56},
+  {2, 0},
+  {1, 65535},
+  {0, 65534},
+  {0, 65457},
+  {65439, 0},
+  {65480, 0},
+  {65406, 0},
+  {10795, 0},
+  {65373, 0},
+  {10792, 0},
+  {0, 10815},
+  {65341, 0},
+  {69, 0},
+  {71, 0},
+  {0, 10783},
+  {0, 10780},
+  {0, 10782},
+  {0, 65326},
+  {0, 65330},
+  {0, 65331},
+  {0, 65334},
+  {0, 65333},
+  {0, 42319},
+  {0, 42315},
+  {0, 65329},
+  {0, 42280},
+  {0, 42308},
+  {0, 65327},
+  {0, 65325},
+  {0, 10743},
+  {0, 42305},
+  {0, 10749},
+  {0, 65323},
+  {0, 65322},
+  {0, 10727},
+  {0, 65318},
+  {0, 42282},
+  {0, 65467},
+  {0, 65319},
+  {0, 65465},
+  {0, 65317},
+  {0, 42261},
+  {0, 42258},
+  {0, 84},
+  {116, 0},
+  {38, 0},
+  {37, 0},
+  {64, 0},
+  {63, 0},
+  {0, 65498},
+  {0, 65499},
+  {0, 65505},
+  {0, 65472},
+  {0, 65473},
+  {8, 0},
+  {0, 65474},
+  {0, 65479},
+  {0, 65489},
+  {0, 65482},
+  {0, 65528},
+  {0, 65450},
+  {0, 65456},
+  {0, 7},
+  {0, 65420},
+  {65476, 0},
+  {0, 65440},
+  {65529, 0},
+  {80, 0},
+  {15, 0},
+  {0, 65521},
+  {48, 0},
+  {0, 65488},
+  {7264, 0},
+  {0, 3008},
+  {38864, 0},
+  {0, 59282},
+  {0, 59283},
+  {0, 59292},
+  {0, 59294},
+  {0, 59293},
+  {0, 59300},
+  {0, 59355},
+  {0, 35266},
+  {62528, 0},
+  {0, 35332},
+  {0, 3814},
+  {0, 65477},
+  {57921, 0},
+  {0, 8},
+  {65528, 0},
+  {0, 74},
+  {0, 86},
+  {0, 100},
+  {0, 128},
+  {0, 112},
+  {0, 126},
+  {0, 9},
+  {65462, 0},
+  {65527, 0},
+  {0, 58331},
+  {65450, 0},
+  {65436, 0},
+  {65424, 0},
+  {65408, 0},
+  {65410, 0},
+  {58019, 0},
+  {57153, 0},
+  {57274, 0},
+  {28, 0},
+  {0, 65508},
+  {16, 0},
+  {0, 65520},
+  {26, 0},
+  {0, 65510},
+  {54793, 0},
+  {61722, 0},
+  {54809, 0},
+  {0, 54741},
+  {0, 54744},
+  {54756, 0},
+  {54787, 0},
+  {54753, 0},
+  {54754, 0},
+  {54721, 0},
+  {0, 58272},
+  {30204, 0},
+  {23256, 0},
+  {23228, 0},
+  {23217, 0},
+  {23221, 0},
+  {23231, 0},
+  {23278, 0},
+  {23254, 0},
+  {23275, 0},
+  {928, 0},
+  {0, 64608},
+  {0, 26672},
@@ -8,6 +8,18 @@ struct _category {
   uint_least16_t delta;
 } __attribute__((packed));
 
+/* Below U+10000 the category takes two loads: category_index gives
+   the page of each 256 characters among the distinct ones in
+   category_pages, which hold 1 + the category, or 0 where none is
+   assigned.  The higher planes keep a range table.  */
+static const unsigned char category_index[256] = {
+#include "catindex.t"
+};
+
+static const unsigned char category_pages[][256] = {
+#include "catpages.t"
+};
+
 static const struct _category categories[] = {
 #include "categories.t"
 };
@@ -35,6 +47,9 @@ bisearch_cat(wint_t ucs, const struct _category *table, int max)
 
 enum category category(wint_t ucs)
 {
+  if (ucs < 0x10000)
+    return (enum category)
+	   (category_pages[category_index[ucs >> 8]][ucs & 0xff] - 1);
   return bisearch_cat(ucs, categories,
 		      sizeof(categories) / sizeof(*categories) - 1);
 }
@@ -1,1534 +1,3 @@
-    {CAT_Cc, 0x0000, 31},
-    {CAT_Zs, 0x0020, 0},
-    {CAT_Po, 0x0021, 2},
-    {CAT_Sc, 0x0024, 0},
-    {CAT_Po, 0x0025, 2},
-    {CAT_Ps, 0x0028, 0},
-    {CAT_Pe, 0x0029, 0},
-    {CAT_Po, 0x002A, 0},
-    {CAT_Sm, 0x002B, 0},
-    {CAT_Po, 0x002C, 0},
-    {CAT_Pd, 0x002D, 0},
-    {CAT_Po, 0x002E, 1},
-    {CAT_Nd, 0x0030, 9},
-    {CAT_Po, 0x003A, 1},
-    {CAT_Sm, 0x003C, 2},
-    {CAT_Po, 0x003F, 1},
-    {CAT_LC, 0x0041, 25},
-    {CAT_Ps, 0x005B, 0},
-    {CAT_Po, 0x005C, 0},
-    {CAT_Pe, 0x005D, 0},
-    {CAT_Sk, 0x005E, 0},
-    {CAT_Pc, 0x005F, 0},
-    {CAT_Sk, 0x0060, 0},
-    {CAT_LC, 0x0061, 25},
-    {CAT_Ps, 0x007B, 0},
-    {CAT_Sm, 0x007C, 0},
-    {CAT_Pe, 0x007D, 0},
-    {CAT_Sm, 0x007E, 0},
-    {CAT_Cc, 0x007F, 32},
-    {CAT_Zs, 0x00A0, 0},
-    {CAT_Po, 0x00A1, 0},
-    {CAT_Sc, 0x00A2, 3},
-    {CAT_So, 0x00A6, 0},
-    {CAT_Po, 0x00A7, 0},
-    {CAT_Sk, 0x00A8, 0},
-    {CAT_So, 0x00A9, 0},
-    {CAT_Lo, 0x00AA, 0},
-    {CAT_Pi, 0x00AB, 0},
-    {CAT_Sm, 0x00AC, 0},
-    {CAT_Cf, 0x00AD, 0},
-    {CAT_So, 0x00AE, 0},
-    {CAT_Sk, 0x00AF, 0},
-    {CAT_So, 0x00B0, 0},
-    {CAT_Sm, 0x00B1, 0},
-    {CAT_No, 0x00B2, 1},
-    {CAT_Sk, 0x00B4, 0},
-    {CAT_LC, 0x00B5, 0},
-    {CAT_Po, 0x00B6, 1},
-    {CAT_Sk, 0x00B8, 0},
-    {CAT_No, 0x00B9, 0},
-    {CAT_Lo, 0x00BA, 0},
-    {CAT_Pf, 0x00BB, 0},
-    {CAT_No, 0x00BC, 2},
-    {CAT_Po, 0x00BF, 0},
-    {CAT_LC, 0x00C0, 22},
-    {CAT_Sm, 0x00D7, 0},
-    {CAT_LC, 0x00D8, 6},
-    {CAT_Ll, 0x00DF, 0},
-    {CAT_LC, 0x00E0, 22},
-    {CAT_Sm, 0x00F7, 0},
-    {CAT_LC, 0x00F8, 63},
-    {CAT_Ll, 0x0138, 0},
-    {CAT_LC, 0x0139, 15},
-    {CAT_Ll, 0x0149, 0},
-    {CAT_LC, 0x014A, 66},
-    {CAT_Ll, 0x018D, 0},
-    {CAT_LC, 0x018E, 12},
-    {CAT_Ll, 0x019B, 0},
-    {CAT_LC, 0x019C, 13},
-    {CAT_Ll, 0x01AA, 1},
-    {CAT_LC, 0x01AC, 13},
-    {CAT_Ll, 0x01BA, 0},
-    {CAT_Lo, 0x01BB, 0},
-    {CAT_LC, 0x01BC, 1},
-    {CAT_Ll, 0x01BE, 0},
-    {CAT_LC, 0x01BF, 0},
-    {CAT_Lo, 0x01C0, 3},
-    {CAT_LC, 0x01C4, 0},
-    {CAT_Lt, 0x01C5, 0},
-    {CAT_LC, 0x01C6, 1},
-    {CAT_Lt, 0x01C8, 0},
-    {CAT_LC, 0x01C9, 1},
-    {CAT_Lt, 0x01CB, 0},
-    {CAT_LC, 0x01CC, 35},
-    {CAT_Ll, 0x01F0, 0},
-    {CAT_LC, 0x01F1, 0},
-    {CAT_Lt, 0x01F2, 0},
-    {CAT_LC, 0x01F3, 45},
-    {CAT_Ll, 0x0221, 0},
-    {CAT_LC, 0x0222, 17},
-    {CAT_Ll, 0x0234, 5},
-    {CAT_LC, 0x023A, 26},
-    {CAT_Ll, 0x0255, 0},
-    {CAT_LC, 0x0256, 1},
-    {CAT_Ll, 0x0258, 0},
-    {CAT_LC, 0x0259, 0},
-    {CAT_Ll, 0x025A, 0},
-    {CAT_LC, 0x025B, 1},
-    {CAT_Ll, 0x025D, 2},
-    {CAT_LC, 0x0260, 1},
-    {CAT_Ll, 0x0262, 0},
-    {CAT_LC, 0x0263, 0},
-    {CAT_Ll, 0x0264, 0},
-    {CAT_LC, 0x0265, 1},
-    {CAT_Ll, 0x0267, 0},
-    {CAT_LC, 0x0268, 4},
-    {CAT_Ll, 0x026D, 1},
-    {CAT_LC, 0x026F, 0},
-    {CAT_Ll, 0x0270, 0},
-    {CAT_LC, 0x0271, 1},
-    {CAT_Ll, 0x0273, 1},
-    {CAT_LC, 0x0275, 0},
-    {CAT_Ll, 0x0276, 6},
-    {CAT_LC, 0x027D, 0},
-    {CAT_Ll, 0x027E, 1},
-    {CAT_LC, 0x0280, 0},
-    {CAT_Ll, 0x0281, 1},
-    {CAT_LC, 0x0283, 0},
-    {CAT_Ll, 0x0284, 2},
-    {CAT_LC, 0x0287, 5},
-    {CAT_Ll, 0x028D, 4},
-    {CAT_LC, 0x0292, 0},
-    {CAT_Ll, 0x0293, 0},
-    {CAT_Lo, 0x0294, 0},
-    {CAT_Ll, 0x0295, 7},
-    {CAT_LC, 0x029D, 1},
-    {CAT_Ll, 0x029F, 16},
-    {CAT_Lm, 0x02B0, 17},
-    {CAT_Sk, 0x02C2, 3},
-    {CAT_Lm, 0x02C6, 11},
-    {CAT_Sk, 0x02D2, 13},
-    {CAT_Lm, 0x02E0, 4},
-    {CAT_Sk, 0x02E5, 6},
-    {CAT_Lm, 0x02EC, 0},
-    {CAT_Sk, 0x02ED, 0},
-    {CAT_Lm, 0x02EE, 0},
-    {CAT_Sk, 0x02EF, 16},
-    {CAT_Mn, 0x0300, 111},
-    {CAT_LC, 0x0370, 3},
-    {CAT_Lm, 0x0374, 0},
-    {CAT_Sk, 0x0375, 0},
-    {CAT_LC, 0x0376, 1},
-    {CAT_Lm, 0x037A, 0},
-    {CAT_LC, 0x037B, 2},
-    {CAT_Po, 0x037E, 0},
-    {CAT_LC, 0x037F, 0},
-    {CAT_Sk, 0x0384, 1},
-    {CAT_LC, 0x0386, 0},
-    {CAT_Po, 0x0387, 0},
-    {CAT_LC, 0x0388, 2},
-    {CAT_LC, 0x038C, 0},
-    {CAT_LC, 0x038E, 1},
-    {CAT_Ll, 0x0390, 0},
-    {CAT_LC, 0x0391, 16},
-    {CAT_LC, 0x03A3, 12},
-    {CAT_Ll, 0x03B0, 0},
-    {CAT_LC, 0x03B1, 32},
-    {CAT_Lu, 0x03D2, 2},
-    {CAT_LC, 0x03D5, 32},
-    {CAT_Sm, 0x03F6, 0},
-    {CAT_LC, 0x03F7, 4},
-    {CAT_Ll, 0x03FC, 0},
-    {CAT_LC, 0x03FD, 132},
-    {CAT_So, 0x0482, 0},
-    {CAT_Mn, 0x0483, 4},
-    {CAT_Me, 0x0488, 1},
-    {CAT_LC, 0x048A, 165},
-    {CAT_LC, 0x0531, 37},
-    {CAT_Lm, 0x0559, 0},
-    {CAT_Po, 0x055A, 5},
-    {CAT_Ll, 0x0560, 0},
-    {CAT_LC, 0x0561, 37},
-    {CAT_Ll, 0x0587, 1},
-    {CAT_Po, 0x0589, 0},
-    {CAT_Pd, 0x058A, 0},
-    {CAT_So, 0x058D, 1},
-    {CAT_Sc, 0x058F, 0},
-    {CAT_Mn, 0x0591, 44},
-    {CAT_Pd, 0x05BE, 0},
-    {CAT_Mn, 0x05BF, 0},
-    {CAT_Po, 0x05C0, 0},
-    {CAT_Mn, 0x05C1, 1},
-    {CAT_Po, 0x05C3, 0},
-    {CAT_Mn, 0x05C4, 1},
-    {CAT_Po, 0x05C6, 0},
-    {CAT_Mn, 0x05C7, 0},
-    {CAT_Lo, 0x05D0, 26},
-    {CAT_Lo, 0x05EF, 3},
-    {CAT_Po, 0x05F3, 1},
-    {CAT_Cf, 0x0600, 5},
-    {CAT_Sm, 0x0606, 2},
-    {CAT_Po, 0x0609, 1},
-    {CAT_Sc, 0x060B, 0},
-    {CAT_Po, 0x060C, 1},
-    {CAT_So, 0x060E, 1},
-    {CAT_Mn, 0x0610, 10},
-    {CAT_Po, 0x061B, 0},
-    {CAT_Cf, 0x061C, 0},
-    {CAT_Po, 0x061E, 1},
-    {CAT_Lo, 0x0620, 31},
-    {CAT_Lm, 0x0640, 0},
-    {CAT_Lo, 0x0641, 9},
-    {CAT_Mn, 0x064B, 20},
-    {CAT_Nd, 0x0660, 9},
-    {CAT_Po, 0x066A, 3},
-    {CAT_Lo, 0x066E, 1},
-    {CAT_Mn, 0x0670, 0},
-    {CAT_Lo, 0x0671, 98},
-    {CAT_Po, 0x06D4, 0},
-    {CAT_Lo, 0x06D5, 0},
-    {CAT_Mn, 0x06D6, 6},
-    {CAT_Cf, 0x06DD, 0},
-    {CAT_So, 0x06DE, 0},
-    {CAT_Mn, 0x06DF, 5},
-    {CAT_Lm, 0x06E5, 1},
-    {CAT_Mn, 0x06E7, 1},
-    {CAT_So, 0x06E9, 0},
-    {CAT_Mn, 0x06EA, 3},
-    {CAT_Lo, 0x06EE, 1},
-    {CAT_Nd, 0x06F0, 9},
-    {CAT_Lo, 0x06FA, 2},
-    {CAT_So, 0x06FD, 1},
-    {CAT_Lo, 0x06FF, 0},
-    {CAT_Po, 0x0700, 13},
-    {CAT_Cf, 0x070F, 0},
-    {CAT_Lo, 0x0710, 0},
-    {CAT_Mn, 0x0711, 0},
-    {CAT_Lo, 0x0712, 29},
-    {CAT_Mn, 0x0730, 26},
-    {CAT_Lo, 0x074D, 88},
-    {CAT_Mn, 0x07A6, 10},
-    {CAT_Lo, 0x07B1, 0},
-    {CAT_Nd, 0x07C0, 9},
-    {CAT_Lo, 0x07CA, 32},
-    {CAT_Mn, 0x07EB, 8},
-    {CAT_Lm, 0x07F4, 1},
-    {CAT_So, 0x07F6, 0},
-    {CAT_Po, 0x07F7, 2},
-    {CAT_Lm, 0x07FA, 0},
-    {CAT_Mn, 0x07FD, 0},
-    {CAT_Sc, 0x07FE, 1},
-    {CAT_Lo, 0x0800, 21},
-    {CAT_Mn, 0x0816, 3},
-    {CAT_Lm, 0x081A, 0},
-    {CAT_Mn, 0x081B, 8},
-    {CAT_Lm, 0x0824, 0},
-    {CAT_Mn, 0x0825, 2},
-    {CAT_Lm, 0x0828, 0},
-    {CAT_Mn, 0x0829, 4},
-    {CAT_Po, 0x0830, 14},
-    {CAT_Lo, 0x0840, 24},
-    {CAT_Mn, 0x0859, 2},
-    {CAT_Po, 0x085E, 0},
-    {CAT_Lo, 0x0860, 10},
-    {CAT_Lo, 0x08A0, 20},
-    {CAT_Lo, 0x08B6, 7},
-    {CAT_Mn, 0x08D3, 14},
-    {CAT_Cf, 0x08E2, 0},
-    {CAT_Mn, 0x08E3, 31},
-    {CAT_Mc, 0x0903, 0},
-    {CAT_Lo, 0x0904, 53},
-    {CAT_Mn, 0x093A, 0},
-    {CAT_Mc, 0x093B, 0},
-    {CAT_Mn, 0x093C, 0},
-    {CAT_Lo, 0x093D, 0},
-    {CAT_Mc, 0x093E, 2},
-    {CAT_Mn, 0x0941, 7},
-    {CAT_Mc, 0x0949, 3},
-    {CAT_Mn, 0x094D, 0},
-    {CAT_Mc, 0x094E, 1},
-    {CAT_Lo, 0x0950, 0},
-    {CAT_Mn, 0x0951, 6},
-    {CAT_Lo, 0x0958, 9},
-    {CAT_Mn, 0x0962, 1},
-    {CAT_Po, 0x0964, 1},
-    {CAT_Nd, 0x0966, 9},
-    {CAT_Po, 0x0970, 0},
-    {CAT_Lm, 0x0971, 0},
-    {CAT_Lo, 0x0972, 14},
-    {CAT_Mn, 0x0981, 0},
-    {CAT_Mc, 0x0982, 1},
-    {CAT_Lo, 0x0985, 7},
-    {CAT_Lo, 0x098F, 1},
-    {CAT_Lo, 0x0993, 21},
-    {CAT_Lo, 0x09AA, 6},
-    {CAT_Lo, 0x09B2, 0},
-    {CAT_Lo, 0x09B6, 3},
-    {CAT_Mn, 0x09BC, 0},
-    {CAT_Lo, 0x09BD, 0},
-    {CAT_Mc, 0x09BE, 2},
-    {CAT_Mn, 0x09C1, 3},
-    {CAT_Mc, 0x09C7, 1},
-    {CAT_Mc, 0x09CB, 1},
-    {CAT_Mn, 0x09CD, 0},
-    {CAT_Lo, 0x09CE, 0},
-    {CAT_Mc, 0x09D7, 0},
-    {CAT_Lo, 0x09DC, 1},
-    {CAT_Lo, 0x09DF, 2},
-    {CAT_Mn, 0x09E2, 1},
-    {CAT_Nd, 0x09E6, 9},
-    {CAT_Lo, 0x09F0, 1},
-    {CAT_Sc, 0x09F2, 1},
-    {CAT_No, 0x09F4, 5},
-    {CAT_So, 0x09FA, 0},
-    {CAT_Sc, 0x09FB, 0},
-    {CAT_Lo, 0x09FC, 0},
-    {CAT_Po, 0x09FD, 0},
-    {CAT_Mn, 0x09FE, 0},
-    {CAT_Mn, 0x0A01, 1},
-    {CAT_Mc, 0x0A03, 0},
-    {CAT_Lo, 0x0A05, 5},
-    {CAT_Lo, 0x0A0F, 1},
-    {CAT_Lo, 0x0A13, 21},
-    {CAT_Lo, 0x0A2A, 6},
-    {CAT_Lo, 0x0A32, 1},
-    {CAT_Lo, 0x0A35, 1},
-    {CAT_Lo, 0x0A38, 1},
-    {CAT_Mn, 0x0A3C, 0},
-    {CAT_Mc, 0x0A3E, 2},
-    {CAT_Mn, 0x0A41, 1},
-    {CAT_Mn, 0x0A47, 1},
-    {CAT_Mn, 0x0A4B, 2},
-    {CAT_Mn, 0x0A51, 0},
-    {CAT_Lo, 0x0A59, 3},
-    {CAT_Lo, 0x0A5E, 0},
-    {CAT_Nd, 0x0A66, 9},
-    {CAT_Mn, 0x0A70, 1},
-    {CAT_Lo, 0x0A72, 2},
-    {CAT_Mn, 0x0A75, 0},
-    {CAT_Po, 0x0A76, 0},
-    {CAT_Mn, 0x0A81, 1},
-    {CAT_Mc, 0x0A83, 0},
-    {CAT_Lo, 0x0A85, 8},
-    {CAT_Lo, 0x0A8F, 2},
-    {CAT_Lo, 0x0A93, 21},
-    {CAT_Lo, 0x0AAA, 6},
-    {CAT_Lo, 0x0AB2, 1},
-    {CAT_Lo, 0x0AB5, 4},
-    {CAT_Mn, 0x0ABC, 0},
-    {CAT_Lo, 0x0ABD, 0},
-    {CAT_Mc, 0x0ABE, 2},
-    {CAT_Mn, 0x0AC1, 4},
-    {CAT_Mn, 0x0AC7, 1},
-    {CAT_Mc, 0x0AC9, 0},
-    {CAT_Mc, 0x0ACB, 1},
-    {CAT_Mn, 0x0ACD, 0},
-    {CAT_Lo, 0x0AD0, 0},
-    {CAT_Lo, 0x0AE0, 1},
-    {CAT_Mn, 0x0AE2, 1},
-    {CAT_Nd, 0x0AE6, 9},
-    {CAT_Po, 0x0AF0, 0},
-    {CAT_Sc, 0x0AF1, 0},
-    {CAT_Lo, 0x0AF9, 0},
-    {CAT_Mn, 0x0AFA, 5},
-    {CAT_Mn, 0x0B01, 0},
-    {CAT_Mc, 0x0B02, 1},
-    {CAT_Lo, 0x0B05, 7},
-    {CAT_Lo, 0x0B0F, 1},
-    {CAT_Lo, 0x0B13, 21},
-    {CAT_Lo, 0x0B2A, 6},
-    {CAT_Lo, 0x0B32, 1},
-    {CAT_Lo, 0x0B35, 4},
-    {CAT_Mn, 0x0B3C, 0},
-    {CAT_Lo, 0x0B3D, 0},
-    {CAT_Mc, 0x0B3E, 0},
-    {CAT_Mn, 0x0B3F, 0},
-    {CAT_Mc, 0x0B40, 0},
-    {CAT_Mn, 0x0B41, 3},
-    {CAT_Mc, 0x0B47, 1},
-    {CAT_Mc, 0x0B4B, 1},
-    {CAT_Mn, 0x0B4D, 0},
-    {CAT_Mn, 0x0B56, 0},
-    {CAT_Mc, 0x0B57, 0},
-    {CAT_Lo, 0x0B5C, 1},
-    {CAT_Lo, 0x0B5F, 2},
-    {CAT_Mn, 0x0B62, 1},
-    {CAT_Nd, 0x0B66, 9},
-    {CAT_So, 0x0B70, 0},
-    {CAT_Lo, 0x0B71, 0},
-    {CAT_No, 0x0B72, 5},
-    {CAT_Mn, 0x0B82, 0},
-    {CAT_Lo, 0x0B83, 0},
-    {CAT_Lo, 0x0B85, 5},
-    {CAT_Lo, 0x0B8E, 2},
-    {CAT_Lo, 0x0B92, 3},
-    {CAT_Lo, 0x0B99, 1},
-    {CAT_Lo, 0x0B9C, 0},
-    {CAT_Lo, 0x0B9E, 1},
-    {CAT_Lo, 0x0BA3, 1},
-    {CAT_Lo, 0x0BA8, 2},
-    {CAT_Lo, 0x0BAE, 11},
-    {CAT_Mc, 0x0BBE, 1},
-    {CAT_Mn, 0x0BC0, 0},
-    {CAT_Mc, 0x0BC1, 1},
-    {CAT_Mc, 0x0BC6, 2},
-    {CAT_Mc, 0x0BCA, 2},
-    {CAT_Mn, 0x0BCD, 0},
-    {CAT_Lo, 0x0BD0, 0},
-    {CAT_Mc, 0x0BD7, 0},
-    {CAT_Nd, 0x0BE6, 9},
-    {CAT_No, 0x0BF0, 2},
-    {CAT_So, 0x0BF3, 5},
-    {CAT_Sc, 0x0BF9, 0},
-    {CAT_So, 0x0BFA, 0},
-    {CAT_Mn, 0x0C00, 0},
-    {CAT_Mc, 0x0C01, 2},
-    {CAT_Mn, 0x0C04, 0},
-    {CAT_Lo, 0x0C05, 7},
-    {CAT_Lo, 0x0C0E, 2},
-    {CAT_Lo, 0x0C12, 22},
-    {CAT_Lo, 0x0C2A, 15},
-    {CAT_Lo, 0x0C3D, 0},
-    {CAT_Mn, 0x0C3E, 2},
-    {CAT_Mc, 0x0C41, 3},
-    {CAT_Mn, 0x0C46, 2},
-    {CAT_Mn, 0x0C4A, 3},
-    {CAT_Mn, 0x0C55, 1},
-    {CAT_Lo, 0x0C58, 2},
-    {CAT_Lo, 0x0C60, 1},
-    {CAT_Mn, 0x0C62, 1},
-    {CAT_Nd, 0x0C66, 9},
-    {CAT_No, 0x0C78, 6},
-    {CAT_So, 0x0C7F, 0},
-    {CAT_Lo, 0x0C80, 0},
-    {CAT_Mn, 0x0C81, 0},
-    {CAT_Mc, 0x0C82, 1},
-    {CAT_Po, 0x0C84, 0},
-    {CAT_Lo, 0x0C85, 7},
-    {CAT_Lo, 0x0C8E, 2},
-    {CAT_Lo, 0x0C92, 22},
-    {CAT_Lo, 0x0CAA, 9},
-    {CAT_Lo, 0x0CB5, 4},
-    {CAT_Mn, 0x0CBC, 0},
-    {CAT_Lo, 0x0CBD, 0},
-    {CAT_Mc, 0x0CBE, 0},
-    {CAT_Mn, 0x0CBF, 0},
-    {CAT_Mc, 0x0CC0, 4},
-    {CAT_Mn, 0x0CC6, 0},
-    {CAT_Mc, 0x0CC7, 1},
-    {CAT_Mc, 0x0CCA, 1},
-    {CAT_Mn, 0x0CCC, 1},
-    {CAT_Mc, 0x0CD5, 1},
-    {CAT_Lo, 0x0CDE, 0},
-    {CAT_Lo, 0x0CE0, 1},
-    {CAT_Mn, 0x0CE2, 1},
-    {CAT_Nd, 0x0CE6, 9},
-    {CAT_Lo, 0x0CF1, 1},
-    {CAT_Mn, 0x0D00, 1},
-    {CAT_Mc, 0x0D02, 1},
-    {CAT_Lo, 0x0D05, 7},
-    {CAT_Lo, 0x0D0E, 2},
-    {CAT_Lo, 0x0D12, 40},
-    {CAT_Mn, 0x0D3B, 1},
-    {CAT_Lo, 0x0D3D, 0},
-    {CAT_Mc, 0x0D3E, 2},
-    {CAT_Mn, 0x0D41, 3},
-    {CAT_Mc, 0x0D46, 2},
-    {CAT_Mc, 0x0D4A, 2},
-    {CAT_Mn, 0x0D4D, 0},
-    {CAT_Lo, 0x0D4E, 0},
-    {CAT_So, 0x0D4F, 0},
-    {CAT_Lo, 0x0D54, 2},
-    {CAT_Mc, 0x0D57, 0},
-    {CAT_No, 0x0D58, 6},
-    {CAT_Lo, 0x0D5F, 2},
-    {CAT_Mn, 0x0D62, 1},
-    {CAT_Nd, 0x0D66, 9},
-    {CAT_No, 0x0D70, 8},
-    {CAT_So, 0x0D79, 0},
-    {CAT_Lo, 0x0D7A, 5},
-    {CAT_Mc, 0x0D82, 1},
-    {CAT_Lo, 0x0D85, 17},
-    {CAT_Lo, 0x0D9A, 23},
-    {CAT_Lo, 0x0DB3, 8},
-    {CAT_Lo, 0x0DBD, 0},
-    {CAT_Lo, 0x0DC0, 6},
-    {CAT_Mn, 0x0DCA, 0},
-    {CAT_Mc, 0x0DCF, 2},
-    {CAT_Mn, 0x0DD2, 2},
-    {CAT_Mn, 0x0DD6, 0},
-    {CAT_Mc, 0x0DD8, 7},
-    {CAT_Nd, 0x0DE6, 9},
-    {CAT_Mc, 0x0DF2, 1},
-    {CAT_Po, 0x0DF4, 0},
-    {CAT_Lo, 0x0E01, 47},
-    {CAT_Mn, 0x0E31, 0},
-    {CAT_Lo, 0x0E32, 1},
-    {CAT_Mn, 0x0E34, 6},
-    {CAT_Sc, 0x0E3F, 0},
-    {CAT_Lo, 0x0E40, 5},
-    {CAT_Lm, 0x0E46, 0},
-    {CAT_Mn, 0x0E47, 7},
-    {CAT_Po, 0x0E4F, 0},
-    {CAT_Nd, 0x0E50, 9},
-    {CAT_Po, 0x0E5A, 1},
-    {CAT_Lo, 0x0E81, 1},
-    {CAT_Lo, 0x0E84, 0},
-    {CAT_Lo, 0x0E87, 1},
-    {CAT_Lo, 0x0E8A, 0},
-    {CAT_Lo, 0x0E8D, 0},
-    {CAT_Lo, 0x0E94, 3},
-    {CAT_Lo, 0x0E99, 6},
-    {CAT_Lo, 0x0EA1, 2},
-    {CAT_Lo, 0x0EA5, 0},
-    {CAT_Lo, 0x0EA7, 0},
-    {CAT_Lo, 0x0EAA, 1},
-    {CAT_Lo, 0x0EAD, 3},
-    {CAT_Mn, 0x0EB1, 0},
-    {CAT_Lo, 0x0EB2, 1},
-    {CAT_Mn, 0x0EB4, 5},
-    {CAT_Mn, 0x0EBB, 1},
-    {CAT_Lo, 0x0EBD, 0},
-    {CAT_Lo, 0x0EC0, 4},
-    {CAT_Lm, 0x0EC6, 0},
-    {CAT_Mn, 0x0EC8, 5},
-    {CAT_Nd, 0x0ED0, 9},
-    {CAT_Lo, 0x0EDC, 3},
-    {CAT_Lo, 0x0F00, 0},
-    {CAT_So, 0x0F01, 2},
-    {CAT_Po, 0x0F04, 14},
-    {CAT_So, 0x0F13, 0},
-    {CAT_Po, 0x0F14, 0},
-    {CAT_So, 0x0F15, 2},
-    {CAT_Mn, 0x0F18, 1},
-    {CAT_So, 0x0F1A, 5},
-    {CAT_Nd, 0x0F20, 9},
-    {CAT_No, 0x0F2A, 9},
-    {CAT_So, 0x0F34, 0},
-    {CAT_Mn, 0x0F35, 0},
-    {CAT_So, 0x0F36, 0},
-    {CAT_Mn, 0x0F37, 0},
-    {CAT_So, 0x0F38, 0},
-    {CAT_Mn, 0x0F39, 0},
-    {CAT_Ps, 0x0F3A, 0},
-    {CAT_Pe, 0x0F3B, 0},
-    {CAT_Ps, 0x0F3C, 0},
-    {CAT_Pe, 0x0F3D, 0},
-    {CAT_Mc, 0x0F3E, 1},
-    {CAT_Lo, 0x0F40, 7},
-    {CAT_Lo, 0x0F49, 35},
-    {CAT_Mn, 0x0F71, 13},
-    {CAT_Mc, 0x0F7F, 0},
-    {CAT_Mn, 0x0F80, 4},
-    {CAT_Po, 0x0F85, 0},
-    {CAT_Mn, 0x0F86, 1},
-    {CAT_Lo, 0x0F88, 4},
-    {CAT_Mn, 0x0F8D, 10},
-    {CAT_Mn, 0x0F99, 35},
-    {CAT_So, 0x0FBE, 7},
-    {CAT_Mn, 0x0FC6, 0},
-    {CAT_So, 0x0FC7, 5},
-    {CAT_So, 0x0FCE, 1},
-    {CAT_Po, 0x0FD0, 4},
-    {CAT_So, 0x0FD5, 3},
-    {CAT_Po, 0x0FD9, 1},
-    {CAT_Lo, 0x1000, 42},
-    {CAT_Mc, 0x102B, 1},
-    {CAT_Mn, 0x102D, 3},
-    {CAT_Mc, 0x1031, 0},
-    {CAT_Mn, 0x1032, 5},
-    {CAT_Mc, 0x1038, 0},
-    {CAT_Mn, 0x1039, 1},
-    {CAT_Mc, 0x103B, 1},
-    {CAT_Mn, 0x103D, 1},
-    {CAT_Lo, 0x103F, 0},
-    {CAT_Nd, 0x1040, 9},
-    {CAT_Po, 0x104A, 5},
-    {CAT_Lo, 0x1050, 5},
-    {CAT_Mc, 0x1056, 1},
-    {CAT_Mn, 0x1058, 1},
-    {CAT_Lo, 0x105A, 3},
-    {CAT_Mn, 0x105E, 2},
-    {CAT_Lo, 0x1061, 0},
-    {CAT_Mc, 0x1062, 2},
-    {CAT_Lo, 0x1065, 1},
-    {CAT_Mc, 0x1067, 6},
-    {CAT_Lo, 0x106E, 2},
-    {CAT_Mn, 0x1071, 3},
-    {CAT_Lo, 0x1075, 12},
-    {CAT_Mn, 0x1082, 0},
-    {CAT_Mc, 0x1083, 1},
-    {CAT_Mn, 0x1085, 1},
-    {CAT_Mc, 0x1087, 5},
-    {CAT_Mn, 0x108D, 0},
-    {CAT_Lo, 0x108E, 0},
-    {CAT_Mc, 0x108F, 0},
-    {CAT_Nd, 0x1090, 9},
-    {CAT_Mc, 0x109A, 2},
-    {CAT_Mn, 0x109D, 0},
-    {CAT_So, 0x109E, 1},
-    {CAT_LC, 0x10A0, 37},
-    {CAT_LC, 0x10C7, 0},
-    {CAT_LC, 0x10CD, 0},
-    {CAT_LC, 0x10D0, 42},
-    {CAT_Po, 0x10FB, 0},
-    {CAT_Lm, 0x10FC, 0},
-    {CAT_LC, 0x10FD, 2},
-    {CAT_Lo, 0x1100, 328},
-    {CAT_Lo, 0x124A, 3},
-    {CAT_Lo, 0x1250, 6},
-    {CAT_Lo, 0x1258, 0},
-    {CAT_Lo, 0x125A, 3},
-    {CAT_Lo, 0x1260, 40},
-    {CAT_Lo, 0x128A, 3},
-    {CAT_Lo, 0x1290, 32},
-    {CAT_Lo, 0x12B2, 3},
-    {CAT_Lo, 0x12B8, 6},
-    {CAT_Lo, 0x12C0, 0},
-    {CAT_Lo, 0x12C2, 3},
-    {CAT_Lo, 0x12C8, 14},
-    {CAT_Lo, 0x12D8, 56},
-    {CAT_Lo, 0x1312, 3},
-    {CAT_Lo, 0x1318, 66},
-    {CAT_Mn, 0x135D, 2},
-    {CAT_Po, 0x1360, 8},
-    {CAT_No, 0x1369, 19},
-    {CAT_Lo, 0x1380, 15},
-    {CAT_So, 0x1390, 9},
-    {CAT_LC, 0x13A0, 85},
-    {CAT_LC, 0x13F8, 5},
-    {CAT_Pd, 0x1400, 0},
-    {CAT_Lo, 0x1401, 619},
-    {CAT_Po, 0x166D, 1},
-    {CAT_Lo, 0x166F, 16},
-    {CAT_Zs, 0x1680, 0},
-    {CAT_Lo, 0x1681, 25},
-    {CAT_Ps, 0x169B, 0},
-    {CAT_Pe, 0x169C, 0},
-    {CAT_Lo, 0x16A0, 74},
-    {CAT_Po, 0x16EB, 2},
-    {CAT_Nl, 0x16EE, 2},
-    {CAT_Lo, 0x16F1, 7},
-    {CAT_Lo, 0x1700, 12},
-    {CAT_Lo, 0x170E, 3},
-    {CAT_Mn, 0x1712, 2},
-    {CAT_Lo, 0x1720, 17},
-    {CAT_Mn, 0x1732, 2},
-    {CAT_Po, 0x1735, 1},
-    {CAT_Lo, 0x1740, 17},
-    {CAT_Mn, 0x1752, 1},
-    {CAT_Lo, 0x1760, 12},
-    {CAT_Lo, 0x176E, 2},
-    {CAT_Mn, 0x1772, 1},
-    {CAT_Lo, 0x1780, 51},
-    {CAT_Mn, 0x17B4, 1},
-    {CAT_Mc, 0x17B6, 0},
-    {CAT_Mn, 0x17B7, 6},
-    {CAT_Mc, 0x17BE, 7},
-    {CAT_Mn, 0x17C6, 0},
-    {CAT_Mc, 0x17C7, 1},
-    {CAT_Mn, 0x17C9, 10},
-    {CAT_Po, 0x17D4, 2},
-    {CAT_Lm, 0x17D7, 0},
-    {CAT_Po, 0x17D8, 2},
-    {CAT_Sc, 0x17DB, 0},
-    {CAT_Lo, 0x17DC, 0},
-    {CAT_Mn, 0x17DD, 0},
-    {CAT_Nd, 0x17E0, 9},
-    {CAT_No, 0x17F0, 9},
-    {CAT_Po, 0x1800, 5},
-    {CAT_Pd, 0x1806, 0},
-    {CAT_Po, 0x1807, 3},
-    {CAT_Mn, 0x180B, 2},
-    {CAT_Cf, 0x180E, 0},
-    {CAT_Nd, 0x1810, 9},
-    {CAT_Lo, 0x1820, 34},
-    {CAT_Lm, 0x1843, 0},
-    {CAT_Lo, 0x1844, 52},
-    {CAT_Lo, 0x1880, 4},
-    {CAT_Mn, 0x1885, 1},
-    {CAT_Lo, 0x1887, 33},
-    {CAT_Mn, 0x18A9, 0},
-    {CAT_Lo, 0x18AA, 0},
-    {CAT_Lo, 0x18B0, 69},
-    {CAT_Lo, 0x1900, 30},
-    {CAT_Mn, 0x1920, 2},
-    {CAT_Mc, 0x1923, 3},
-    {CAT_Mn, 0x1927, 1},
-    {CAT_Mc, 0x1929, 2},
-    {CAT_Mc, 0x1930, 1},
-    {CAT_Mn, 0x1932, 0},
-    {CAT_Mc, 0x1933, 5},
-    {CAT_Mn, 0x1939, 2},
-    {CAT_So, 0x1940, 0},
-    {CAT_Po, 0x1944, 1},
-    {CAT_Nd, 0x1946, 9},
-    {CAT_Lo, 0x1950, 29},
-    {CAT_Lo, 0x1970, 4},
-    {CAT_Lo, 0x1980, 43},
-    {CAT_Lo, 0x19B0, 25},
-    {CAT_Nd, 0x19D0, 9},
-    {CAT_No, 0x19DA, 0},
-    {CAT_So, 0x19DE, 33},
-    {CAT_Lo, 0x1A00, 22},
-    {CAT_Mn, 0x1A17, 1},
-    {CAT_Mc, 0x1A19, 1},
-    {CAT_Mn, 0x1A1B, 0},
-    {CAT_Po, 0x1A1E, 1},
-    {CAT_Lo, 0x1A20, 52},
-    {CAT_Mc, 0x1A55, 0},
-    {CAT_Mn, 0x1A56, 0},
-    {CAT_Mc, 0x1A57, 0},
-    {CAT_Mn, 0x1A58, 6},
-    {CAT_Mn, 0x1A60, 0},
-    {CAT_Mc, 0x1A61, 0},
-    {CAT_Mn, 0x1A62, 0},
-    {CAT_Mc, 0x1A63, 1},
-    {CAT_Mn, 0x1A65, 7},
-    {CAT_Mc, 0x1A6D, 5},
-    {CAT_Mn, 0x1A73, 9},
-    {CAT_Mn, 0x1A7F, 0},
-    {CAT_Nd, 0x1A80, 9},
-    {CAT_Nd, 0x1A90, 9},
-    {CAT_Po, 0x1AA0, 6},
-    {CAT_Lm, 0x1AA7, 0},
-    {CAT_Po, 0x1AA8, 5},
-    {CAT_Mn, 0x1AB0, 13},
-    {CAT_Me, 0x1ABE, 0},
-    {CAT_Mn, 0x1B00, 3},
-    {CAT_Mc, 0x1B04, 0},
-    {CAT_Lo, 0x1B05, 46},
-    {CAT_Mn, 0x1B34, 0},
-    {CAT_Mc, 0x1B35, 0},
-    {CAT_Mn, 0x1B36, 4},
-    {CAT_Mc, 0x1B3B, 0},
-    {CAT_Mn, 0x1B3C, 0},
-    {CAT_Mc, 0x1B3D, 4},
-    {CAT_Mn, 0x1B42, 0},
-    {CAT_Mc, 0x1B43, 1},
-    {CAT_Lo, 0x1B45, 6},
-    {CAT_Nd, 0x1B50, 9},
-    {CAT_Po, 0x1B5A, 6},
-    {CAT_So, 0x1B61, 9},
-    {CAT_Mn, 0x1B6B, 8},
-    {CAT_So, 0x1B74, 8},
-    {CAT_Mn, 0x1B80, 1},
-    {CAT_Mc, 0x1B82, 0},
-    {CAT_Lo, 0x1B83, 29},
-    {CAT_Mc, 0x1BA1, 0},
-    {CAT_Mn, 0x1BA2, 3},
-    {CAT_Mc, 0x1BA6, 1},
-    {CAT_Mn, 0x1BA8, 1},
-    {CAT_Mc, 0x1BAA, 0},
-    {CAT_Mn, 0x1BAB, 2},
-    {CAT_Lo, 0x1BAE, 1},
-    {CAT_Nd, 0x1BB0, 9},
-    {CAT_Lo, 0x1BBA, 43},
-    {CAT_Mn, 0x1BE6, 0},
-    {CAT_Mc, 0x1BE7, 0},
-    {CAT_Mn, 0x1BE8, 1},
-    {CAT_Mc, 0x1BEA, 2},
-    {CAT_Mn, 0x1BED, 0},
-    {CAT_Mc, 0x1BEE, 0},
-    {CAT_Mn, 0x1BEF, 2},
-    {CAT_Mc, 0x1BF2, 1},
-    {CAT_Po, 0x1BFC, 3},
-    {CAT_Lo, 0x1C00, 35},
-    {CAT_Mc, 0x1C24, 7},
-    {CAT_Mn, 0x1C2C, 7},
-    {CAT_Mc, 0x1C34, 1},
-    {CAT_Mn, 0x1C36, 1},
-    {CAT_Po, 0x1C3B, 4},
-    {CAT_Nd, 0x1C40, 9},
-    {CAT_Lo, 0x1C4D, 2},
-    {CAT_Nd, 0x1C50, 9},
-    {CAT_Lo, 0x1C5A, 29},
-    {CAT_Lm, 0x1C78, 5},
-    {CAT_Po, 0x1C7E, 1},
-    {CAT_LC, 0x1C80, 8},
-    {CAT_LC, 0x1C90, 42},
-    {CAT_LC, 0x1CBD, 2},
-    {CAT_Po, 0x1CC0, 7},
-    {CAT_Mn, 0x1CD0, 2},
-    {CAT_Po, 0x1CD3, 0},
-    {CAT_Mn, 0x1CD4, 12},
-    {CAT_Mc, 0x1CE1, 0},
-    {CAT_Mn, 0x1CE2, 6},
-    {CAT_Lo, 0x1CE9, 3},
-    {CAT_Mn, 0x1CED, 0},
-    {CAT_Lo, 0x1CEE, 3},
-    {CAT_Mc, 0x1CF2, 1},
-    {CAT_Mn, 0x1CF4, 0},
-    {CAT_Lo, 0x1CF5, 1},
-    {CAT_Mc, 0x1CF7, 0},
-    {CAT_Mn, 0x1CF8, 1},
-    {CAT_Ll, 0x1D00, 43},
-    {CAT_Lm, 0x1D2C, 62},
-    {CAT_Ll, 0x1D6B, 12},
-    {CAT_Lm, 0x1D78, 0},
-    {CAT_LC, 0x1D79, 0},
-    {CAT_Ll, 0x1D7A, 2},
-    {CAT_LC, 0x1D7D, 0},
-    {CAT_Ll, 0x1D7E, 28},
-    {CAT_Lm, 0x1D9B, 36},
-    {CAT_Mn, 0x1DC0, 57},
-    {CAT_Mn, 0x1DFB, 4},
-    {CAT_LC, 0x1E00, 149},
-    {CAT_Ll, 0x1E96, 4},
-    {CAT_LC, 0x1E9B, 0},
-    {CAT_Ll, 0x1E9C, 1},
-    {CAT_LC, 0x1E9E, 0},
-    {CAT_Ll, 0x1E9F, 0},
-    {CAT_LC, 0x1EA0, 117},
-    {CAT_LC, 0x1F18, 5},
-    {CAT_LC, 0x1F20, 37},
-    {CAT_LC, 0x1F48, 5},
-    {CAT_Ll, 0x1F50, 0},
-    {CAT_LC, 0x1F51, 0},
-    {CAT_Ll, 0x1F52, 0},
-    {CAT_LC, 0x1F53, 0},
-    {CAT_Ll, 0x1F54, 0},
-    {CAT_LC, 0x1F55, 0},
-    {CAT_Ll, 0x1F56, 0},
-    {CAT_LC, 0x1F57, 0},
-    {CAT_LC, 0x1F59, 0},
-    {CAT_LC, 0x1F5B, 0},
-    {CAT_LC, 0x1F5D, 0},
-    {CAT_LC, 0x1F5F, 30},
-    {CAT_LC, 0x1F80, 7},
-    {CAT_Lt, 0x1F88, 7},
-    {CAT_LC, 0x1F90, 7},
-    {CAT_Lt, 0x1F98, 7},
-    {CAT_LC, 0x1FA0, 7},
-    {CAT_Lt, 0x1FA8, 7},
-    {CAT_LC, 0x1FB0, 1},
-    {CAT_Ll, 0x1FB2, 0},
-    {CAT_LC, 0x1FB3, 0},
-    {CAT_Ll, 0x1FB4, 0},
-    {CAT_Ll, 0x1FB6, 1},
-    {CAT_LC, 0x1FB8, 3},
-    {CAT_Lt, 0x1FBC, 0},
-    {CAT_Sk, 0x1FBD, 0},
-    {CAT_LC, 0x1FBE, 0},
-    {CAT_Sk, 0x1FBF, 2},
-    {CAT_Ll, 0x1FC2, 0},
-    {CAT_LC, 0x1FC3, 0},
-    {CAT_Ll, 0x1FC4, 0},
-    {CAT_Ll, 0x1FC6, 1},
-    {CAT_LC, 0x1FC8, 3},
-    {CAT_Lt, 0x1FCC, 0},
-    {CAT_Sk, 0x1FCD, 2},
-    {CAT_LC, 0x1FD0, 1},
-    {CAT_Ll, 0x1FD2, 1},
-    {CAT_Ll, 0x1FD6, 1},
-    {CAT_LC, 0x1FD8, 3},
-    {CAT_Sk, 0x1FDD, 2},
-    {CAT_LC, 0x1FE0, 1},
-    {CAT_Ll, 0x1FE2, 2},
-    {CAT_LC, 0x1FE5, 0},
-    {CAT_Ll, 0x1FE6, 1},
-    {CAT_LC, 0x1FE8, 4},
-    {CAT_Sk, 0x1FED, 2},
-    {CAT_Ll, 0x1FF2, 0},
-    {CAT_LC, 0x1FF3, 0},
-    {CAT_Ll, 0x1FF4, 0},
-    {CAT_Ll, 0x1FF6, 1},
-    {CAT_LC, 0x1FF8, 3},
-    {CAT_Lt, 0x1FFC, 0},
-    {CAT_Sk, 0x1FFD, 1},
-    {CAT_Zs, 0x2000, 10},
-    {CAT_Cf, 0x200B, 4},
-    {CAT_Pd, 0x2010, 5},
-    {CAT_Po, 0x2016, 1},
-    {CAT_Pi, 0x2018, 0},
-    {CAT_Pf, 0x2019, 0},
-    {CAT_Ps, 0x201A, 0},
-    {CAT_Pi, 0x201B, 1},
-    {CAT_Pf, 0x201D, 0},
-    {CAT_Ps, 0x201E, 0},
-    {CAT_Pi, 0x201F, 0},
-    {CAT_Po, 0x2020, 7},
-    {CAT_Zl, 0x2028, 0},
-    {CAT_Zp, 0x2029, 0},
-    {CAT_Cf, 0x202A, 4},
-    {CAT_Zs, 0x202F, 0},
-    {CAT_Po, 0x2030, 8},
-    {CAT_Pi, 0x2039, 0},
-    {CAT_Pf, 0x203A, 0},
-    {CAT_Po, 0x203B, 3},
-    {CAT_Pc, 0x203F, 1},
-    {CAT_Po, 0x2041, 2},
-    {CAT_Sm, 0x2044, 0},
-    {CAT_Ps, 0x2045, 0},
-    {CAT_Pe, 0x2046, 0},
-    {CAT_Po, 0x2047, 10},
-    {CAT_Sm, 0x2052, 0},
-    {CAT_Po, 0x2053, 0},
-    {CAT_Pc, 0x2054, 0},
-    {CAT_Po, 0x2055, 9},
-    {CAT_Zs, 0x205F, 0},
-    {CAT_Cf, 0x2060, 4},
-    {CAT_Cf, 0x2066, 9},
-    {CAT_No, 0x2070, 0},
-    {CAT_Lm, 0x2071, 0},
-    {CAT_No, 0x2074, 5},
-    {CAT_Sm, 0x207A, 2},
-    {CAT_Ps, 0x207D, 0},
-    {CAT_Pe, 0x207E, 0},
-    {CAT_Lm, 0x207F, 0},
-    {CAT_No, 0x2080, 9},
-    {CAT_Sm, 0x208A, 2},
-    {CAT_Ps, 0x208D, 0},
-    {CAT_Pe, 0x208E, 0},
-    {CAT_Lm, 0x2090, 12},
-    {CAT_Sc, 0x20A0, 31},
-    {CAT_Mn, 0x20D0, 12},
-    {CAT_Me, 0x20DD, 3},
-    {CAT_Mn, 0x20E1, 0},
-    {CAT_Me, 0x20E2, 2},
-    {CAT_Mn, 0x20E5, 11},
-    {CAT_So, 0x2100, 1},
-    {CAT_Lu, 0x2102, 0},
-    {CAT_So, 0x2103, 3},
-    {CAT_Lu, 0x2107, 0},
-    {CAT_So, 0x2108, 1},
-    {CAT_Ll, 0x210A, 0},
-    {CAT_Lu, 0x210B, 2},
-    {CAT_Ll, 0x210E, 1},
-    {CAT_Lu, 0x2110, 2},
-    {CAT_Ll, 0x2113, 0},
-    {CAT_So, 0x2114, 0},
-    {CAT_Lu, 0x2115, 0},
-    {CAT_So, 0x2116, 1},
-    {CAT_Sm, 0x2118, 0},
-    {CAT_Lu, 0x2119, 4},
-    {CAT_So, 0x211E, 5},
-    {CAT_Lu, 0x2124, 0},
-    {CAT_So, 0x2125, 0},
-    {CAT_LC, 0x2126, 0},
-    {CAT_So, 0x2127, 0},
-    {CAT_Lu, 0x2128, 0},
-    {CAT_So, 0x2129, 0},
-    {CAT_LC, 0x212A, 1},
-    {CAT_Lu, 0x212C, 1},
-    {CAT_So, 0x212E, 0},
-    {CAT_Ll, 0x212F, 0},
-    {CAT_Lu, 0x2130, 1},
-    {CAT_LC, 0x2132, 0},
-    {CAT_Lu, 0x2133, 0},
-    {CAT_Ll, 0x2134, 0},
-    {CAT_Lo, 0x2135, 3},
-    {CAT_Ll, 0x2139, 0},
-    {CAT_So, 0x213A, 1},
-    {CAT_Ll, 0x213C, 1},
-    {CAT_Lu, 0x213E, 1},
-    {CAT_Sm, 0x2140, 4},
-    {CAT_Lu, 0x2145, 0},
-    {CAT_Ll, 0x2146, 3},
-    {CAT_So, 0x214A, 0},
-    {CAT_Sm, 0x214B, 0},
-    {CAT_So, 0x214C, 1},
-    {CAT_LC, 0x214E, 0},
-    {CAT_So, 0x214F, 0},
-    {CAT_No, 0x2150, 15},
-    {CAT_Nl, 0x2160, 34},
-    {CAT_LC, 0x2183, 1},
-    {CAT_Nl, 0x2185, 3},
-    {CAT_No, 0x2189, 0},
-    {CAT_So, 0x218A, 1},
-    {CAT_Sm, 0x2190, 4},
-    {CAT_So, 0x2195, 4},
-    {CAT_Sm, 0x219A, 1},
-    {CAT_So, 0x219C, 3},
-    {CAT_Sm, 0x21A0, 0},
-    {CAT_So, 0x21A1, 1},
-    {CAT_Sm, 0x21A3, 0},
-    {CAT_So, 0x21A4, 1},
-    {CAT_Sm, 0x21A6, 0},
-    {CAT_So, 0x21A7, 6},
-    {CAT_Sm, 0x21AE, 0},
-    {CAT_So, 0x21AF, 30},
-    {CAT_Sm, 0x21CE, 1},
-    {CAT_So, 0x21D0, 1},
-    {CAT_Sm, 0x21D2, 0},
-    {CAT_So, 0x21D3, 0},
-    {CAT_Sm, 0x21D4, 0},
-    {CAT_So, 0x21D5, 30},
-    {CAT_Sm, 0x21F4, 267},
-    {CAT_So, 0x2300, 7},
-    {CAT_Ps, 0x2308, 0},
-    {CAT_Pe, 0x2309, 0},
-    {CAT_Ps, 0x230A, 0},
-    {CAT_Pe, 0x230B, 0},
-    {CAT_So, 0x230C, 19},
-    {CAT_Sm, 0x2320, 1},
-    {CAT_So, 0x2322, 6},
-    {CAT_Ps, 0x2329, 0},
-    {CAT_Pe, 0x232A, 0},
-    {CAT_So, 0x232B, 80},
-    {CAT_Sm, 0x237C, 0},
-    {CAT_So, 0x237D, 29},
-    {CAT_Sm, 0x239B, 24},
-    {CAT_So, 0x23B4, 39},
-    {CAT_Sm, 0x23DC, 5},
-    {CAT_So, 0x23E2, 68},
-    {CAT_So, 0x2440, 10},
-    {CAT_No, 0x2460, 59},
-    {CAT_So, 0x249C, 77},
-    {CAT_No, 0x24EA, 21},
-    {CAT_So, 0x2500, 182},
-    {CAT_Sm, 0x25B7, 0},
-    {CAT_So, 0x25B8, 8},
-    {CAT_Sm, 0x25C1, 0},
-    {CAT_So, 0x25C2, 53},
-    {CAT_Sm, 0x25F8, 7},
-    {CAT_So, 0x2600, 110},
-    {CAT_Sm, 0x266F, 0},
-    {CAT_So, 0x2670, 247},
-    {CAT_Ps, 0x2768, 0},
-    {CAT_Pe, 0x2769, 0},
-    {CAT_Ps, 0x276A, 0},
-    {CAT_Pe, 0x276B, 0},
-    {CAT_Ps, 0x276C, 0},
-    {CAT_Pe, 0x276D, 0},
-    {CAT_Ps, 0x276E, 0},
-    {CAT_Pe, 0x276F, 0},
-    {CAT_Ps, 0x2770, 0},
-    {CAT_Pe, 0x2771, 0},
-    {CAT_Ps, 0x2772, 0},
-    {CAT_Pe, 0x2773, 0},
-    {CAT_Ps, 0x2774, 0},
-    {CAT_Pe, 0x2775, 0},
-    {CAT_No, 0x2776, 29},
-    {CAT_So, 0x2794, 43},
-    {CAT_Sm, 0x27C0, 4},
-    {CAT_Ps, 0x27C5, 0},
-    {CAT_Pe, 0x27C6, 0},
-    {CAT_Sm, 0x27C7, 30},
-    {CAT_Ps, 0x27E6, 0},
-    {CAT_Pe, 0x27E7, 0},
-    {CAT_Ps, 0x27E8, 0},
-    {CAT_Pe, 0x27E9, 0},
-    {CAT_Ps, 0x27EA, 0},
-    {CAT_Pe, 0x27EB, 0},
-    {CAT_Ps, 0x27EC, 0},
-    {CAT_Pe, 0x27ED, 0},
-    {CAT_Ps, 0x27EE, 0},
-    {CAT_Pe, 0x27EF, 0},
-    {CAT_Sm, 0x27F0, 15},
-    {CAT_So, 0x2800, 255},
-    {CAT_Sm, 0x2900, 130},
-    {CAT_Ps, 0x2983, 0},
-    {CAT_Pe, 0x2984, 0},
-    {CAT_Ps, 0x2985, 0},
-    {CAT_Pe, 0x2986, 0},
-    {CAT_Ps, 0x2987, 0},
-    {CAT_Pe, 0x2988, 0},
-    {CAT_Ps, 0x2989, 0},
-    {CAT_Pe, 0x298A, 0},
-    {CAT_Ps, 0x298B, 0},
-    {CAT_Pe, 0x298C, 0},
-    {CAT_Ps, 0x298D, 0},
-    {CAT_Pe, 0x298E, 0},
-    {CAT_Ps, 0x298F, 0},
-    {CAT_Pe, 0x2990, 0},
-    {CAT_Ps, 0x2991, 0},
-    {CAT_Pe, 0x2992, 0},
-    {CAT_Ps, 0x2993, 0},
-    {CAT_Pe, 0x2994, 0},
-    {CAT_Ps, 0x2995, 0},
-    {CAT_Pe, 0x2996, 0},
-    {CAT_Ps, 0x2997, 0},
-    {CAT_Pe, 0x2998, 0},
-    {CAT_Sm, 0x2999, 62},
-    {CAT_Ps, 0x29D8, 0},
-    {CAT_Pe, 0x29D9, 0},
-    {CAT_Ps, 0x29DA, 0},
-    {CAT_Pe, 0x29DB, 0},
-    {CAT_Sm, 0x29DC, 31},
-    {CAT_Ps, 0x29FC, 0},
-    {CAT_Pe, 0x29FD, 0},
-    {CAT_Sm, 0x29FE, 257},
-    {CAT_So, 0x2B00, 47},
-    {CAT_Sm, 0x2B30, 20},
-    {CAT_So, 0x2B45, 1},
-    {CAT_Sm, 0x2B47, 5},
-    {CAT_So, 0x2B4D, 38},
-    {CAT_So, 0x2B76, 31},
-    {CAT_So, 0x2B98, 48},
-    {CAT_So, 0x2BCA, 52},
-    {CAT_LC, 0x2C00, 46},
-    {CAT_LC, 0x2C30, 46},
-    {CAT_LC, 0x2C60, 16},
-    {CAT_Ll, 0x2C71, 0},
-    {CAT_LC, 0x2C72, 1},
-    {CAT_Ll, 0x2C74, 0},
-    {CAT_LC, 0x2C75, 1},
-    {CAT_Ll, 0x2C77, 4},
-    {CAT_Lm, 0x2C7C, 1},
-    {CAT_LC, 0x2C7E, 101},
-    {CAT_Ll, 0x2CE4, 0},
-    {CAT_So, 0x2CE5, 5},
-    {CAT_LC, 0x2CEB, 3},
-    {CAT_Mn, 0x2CEF, 2},
-    {CAT_LC, 0x2CF2, 1},
-    {CAT_Po, 0x2CF9, 3},
-    {CAT_No, 0x2CFD, 0},
-    {CAT_Po, 0x2CFE, 1},
-    {CAT_LC, 0x2D00, 37},
-    {CAT_LC, 0x2D27, 0},
-    {CAT_LC, 0x2D2D, 0},
-    {CAT_Lo, 0x2D30, 55},
-    {CAT_Lm, 0x2D6F, 0},
-    {CAT_Po, 0x2D70, 0},
-    {CAT_Mn, 0x2D7F, 0},
-    {CAT_Lo, 0x2D80, 22},
-    {CAT_Lo, 0x2DA0, 6},
-    {CAT_Lo, 0x2DA8, 6},
-    {CAT_Lo, 0x2DB0, 6},
-    {CAT_Lo, 0x2DB8, 6},
-    {CAT_Lo, 0x2DC0, 6},
-    {CAT_Lo, 0x2DC8, 6},
-    {CAT_Lo, 0x2DD0, 6},
-    {CAT_Lo, 0x2DD8, 6},
-    {CAT_Mn, 0x2DE0, 31},
-    {CAT_Po, 0x2E00, 1},
-    {CAT_Pi, 0x2E02, 0},
-    {CAT_Pf, 0x2E03, 0},
-    {CAT_Pi, 0x2E04, 0},
-    {CAT_Pf, 0x2E05, 0},
-    {CAT_Po, 0x2E06, 2},
-    {CAT_Pi, 0x2E09, 0},
-    {CAT_Pf, 0x2E0A, 0},
-    {CAT_Po, 0x2E0B, 0},
-    {CAT_Pi, 0x2E0C, 0},
-    {CAT_Pf, 0x2E0D, 0},
-    {CAT_Po, 0x2E0E, 8},
-    {CAT_Pd, 0x2E17, 0},
-    {CAT_Po, 0x2E18, 1},
-    {CAT_Pd, 0x2E1A, 0},
-    {CAT_Po, 0x2E1B, 0},
-    {CAT_Pi, 0x2E1C, 0},
-    {CAT_Pf, 0x2E1D, 0},
-    {CAT_Po, 0x2E1E, 1},
-    {CAT_Pi, 0x2E20, 0},
-    {CAT_Pf, 0x2E21, 0},
-    {CAT_Ps, 0x2E22, 0},
-    {CAT_Pe, 0x2E23, 0},
-    {CAT_Ps, 0x2E24, 0},
-    {CAT_Pe, 0x2E25, 0},
-    {CAT_Ps, 0x2E26, 0},
-    {CAT_Pe, 0x2E27, 0},
-    {CAT_Ps, 0x2E28, 0},
-    {CAT_Pe, 0x2E29, 0},
-    {CAT_Po, 0x2E2A, 4},
-    {CAT_Lm, 0x2E2F, 0},
-    {CAT_Po, 0x2E30, 9},
-    {CAT_Pd, 0x2E3A, 1},
-    {CAT_Po, 0x2E3C, 3},
-    {CAT_Pd, 0x2E40, 0},
-    {CAT_Po, 0x2E41, 0},
-    {CAT_Ps, 0x2E42, 0},
-    {CAT_Po, 0x2E43, 11},
-    {CAT_So, 0x2E80, 25},
-    {CAT_So, 0x2E9B, 88},
-    {CAT_So, 0x2F00, 213},
-    {CAT_So, 0x2FF0, 11},
-    {CAT_Zs, 0x3000, 0},
-    {CAT_Po, 0x3001, 2},
-    {CAT_So, 0x3004, 0},
-    {CAT_Lm, 0x3005, 0},
-    {CAT_Lo, 0x3006, 0},
-    {CAT_Nl, 0x3007, 0},
-    {CAT_Ps, 0x3008, 0},
-    {CAT_Pe, 0x3009, 0},
-    {CAT_Ps, 0x300A, 0},
-    {CAT_Pe, 0x300B, 0},
-    {CAT_Ps, 0x300C, 0},
-    {CAT_Pe, 0x300D, 0},
-    {CAT_Ps, 0x300E, 0},
-    {CAT_Pe, 0x300F, 0},
-    {CAT_Ps, 0x3010, 0},
-    {CAT_Pe, 0x3011, 0},
-    {CAT_So, 0x3012, 1},
-    {CAT_Ps, 0x3014, 0},
-    {CAT_Pe, 0x3015, 0},
-    {CAT_Ps, 0x3016, 0},
-    {CAT_Pe, 0x3017, 0},
-    {CAT_Ps, 0x3018, 0},
-    {CAT_Pe, 0x3019, 0},
-    {CAT_Ps, 0x301A, 0},
-    {CAT_Pe, 0x301B, 0},
-    {CAT_Pd, 0x301C, 0},
-    {CAT_Ps, 0x301D, 0},
-    {CAT_Pe, 0x301E, 1},
-    {CAT_So, 0x3020, 0},
-    {CAT_Nl, 0x3021, 8},
-    {CAT_Mn, 0x302A, 3},
-    {CAT_Mc, 0x302E, 1},
-    {CAT_Pd, 0x3030, 0},
-    {CAT_Lm, 0x3031, 4},
-    {CAT_So, 0x3036, 1},
-    {CAT_Nl, 0x3038, 2},
-    {CAT_Lm, 0x303B, 0},
-    {CAT_Lo, 0x303C, 0},
-    {CAT_Po, 0x303D, 0},
-    {CAT_So, 0x303E, 1},
-    {CAT_Lo, 0x3041, 85},
-    {CAT_Mn, 0x3099, 1},
-    {CAT_Sk, 0x309B, 1},
-    {CAT_Lm, 0x309D, 1},
-    {CAT_Lo, 0x309F, 0},
-    {CAT_Pd, 0x30A0, 0},
-    {CAT_Lo, 0x30A1, 89},
-    {CAT_Po, 0x30FB, 0},
-    {CAT_Lm, 0x30FC, 2},
-    {CAT_Lo, 0x30FF, 0},
-    {CAT_Lo, 0x3105, 42},
-    {CAT_Lo, 0x3131, 93},
-    {CAT_So, 0x3190, 1},
-    {CAT_No, 0x3192, 3},
-    {CAT_So, 0x3196, 9},
-    {CAT_Lo, 0x31A0, 26},
-    {CAT_So, 0x31C0, 35},
-    {CAT_Lo, 0x31F0, 15},
-    {CAT_So, 0x3200, 30},
-    {CAT_No, 0x3220, 9},
-    {CAT_So, 0x322A, 29},
-    {CAT_No, 0x3248, 7},
-    {CAT_So, 0x3250, 0},
-    {CAT_No, 0x3251, 14},
-    {CAT_So, 0x3260, 31},
-    {CAT_No, 0x3280, 9},
-    {CAT_So, 0x328A, 38},
-    {CAT_No, 0x32B1, 14},
-    {CAT_So, 0x32C0, 62},
-    {CAT_So, 0x3300, 255},
-    {CAT_Lo, 0x3400, 6581},
-    {CAT_So, 0x4DC0, 63},
-    {CAT_Lo, 0x4E00, 20975},
-    {CAT_Lo, 0xA000, 20},
-    {CAT_Lm, 0xA015, 0},
-    {CAT_Lo, 0xA016, 1142},
-    {CAT_So, 0xA490, 54},
-    {CAT_Lo, 0xA4D0, 39},
-    {CAT_Lm, 0xA4F8, 5},
-    {CAT_Po, 0xA4FE, 1},
-    {CAT_Lo, 0xA500, 267},
-    {CAT_Lm, 0xA60C, 0},
-    {CAT_Po, 0xA60D, 2},
-    {CAT_Lo, 0xA610, 15},
-    {CAT_Nd, 0xA620, 9},
-    {CAT_Lo, 0xA62A, 1},
-    {CAT_LC, 0xA640, 45},
-    {CAT_Lo, 0xA66E, 0},
-    {CAT_Mn, 0xA66F, 0},
-    {CAT_Me, 0xA670, 2},
-    {CAT_Po, 0xA673, 0},
-    {CAT_Mn, 0xA674, 9},
-    {CAT_Po, 0xA67E, 0},
-    {CAT_Lm, 0xA67F, 0},
-    {CAT_LC, 0xA680, 27},
-    {CAT_Lm, 0xA69C, 1},
-    {CAT_Mn, 0xA69E, 1},
-    {CAT_Lo, 0xA6A0, 69},
-    {CAT_Nl, 0xA6E6, 9},
-    {CAT_Mn, 0xA6F0, 1},
-    {CAT_Po, 0xA6F2, 5},
-    {CAT_Sk, 0xA700, 22},
-    {CAT_Lm, 0xA717, 8},
-    {CAT_Sk, 0xA720, 1},
-    {CAT_LC, 0xA722, 13},
-    {CAT_Ll, 0xA730, 1},
-    {CAT_LC, 0xA732, 61},
-    {CAT_Lm, 0xA770, 0},
-    {CAT_Ll, 0xA771, 7},
-    {CAT_LC, 0xA779, 14},
-    {CAT_Lm, 0xA788, 0},
-    {CAT_Sk, 0xA789, 1},
-    {CAT_LC, 0xA78B, 2},
-    {CAT_Ll, 0xA78E, 0},
-    {CAT_Lo, 0xA78F, 0},
-    {CAT_LC, 0xA790, 3},
-    {CAT_Ll, 0xA794, 1},
-    {CAT_LC, 0xA796, 24},
-    {CAT_Ll, 0xA7AF, 0},
-    {CAT_LC, 0xA7B0, 9},
-    {CAT_Lo, 0xA7F7, 0},
-    {CAT_Lm, 0xA7F8, 1},
-    {CAT_Ll, 0xA7FA, 0},
-    {CAT_Lo, 0xA7FB, 6},
-    {CAT_Mn, 0xA802, 0},
-    {CAT_Lo, 0xA803, 2},
-    {CAT_Mn, 0xA806, 0},
-    {CAT_Lo, 0xA807, 3},
-    {CAT_Mn, 0xA80B, 0},
-    {CAT_Lo, 0xA80C, 22},
-    {CAT_Mc, 0xA823, 1},
-    {CAT_Mn, 0xA825, 1},
-    {CAT_Mc, 0xA827, 0},
-    {CAT_So, 0xA828, 3},
-    {CAT_No, 0xA830, 5},
-    {CAT_So, 0xA836, 1},
-    {CAT_Sc, 0xA838, 0},
-    {CAT_So, 0xA839, 0},
-    {CAT_Lo, 0xA840, 51},
-    {CAT_Po, 0xA874, 3},
-    {CAT_Mc, 0xA880, 1},
-    {CAT_Lo, 0xA882, 49},
-    {CAT_Mc, 0xA8B4, 15},
-    {CAT_Mn, 0xA8C4, 1},
-    {CAT_Po, 0xA8CE, 1},
-    {CAT_Nd, 0xA8D0, 9},
-    {CAT_Mn, 0xA8E0, 17},
-    {CAT_Lo, 0xA8F2, 5},
-    {CAT_Po, 0xA8F8, 2},
-    {CAT_Lo, 0xA8FB, 0},
-    {CAT_Po, 0xA8FC, 0},
-    {CAT_Lo, 0xA8FD, 1},
-    {CAT_Mn, 0xA8FF, 0},
-    {CAT_Nd, 0xA900, 9},
-    {CAT_Lo, 0xA90A, 27},
-    {CAT_Mn, 0xA926, 7},
-    {CAT_Po, 0xA92E, 1},
-    {CAT_Lo, 0xA930, 22},
-    {CAT_Mn, 0xA947, 10},
-    {CAT_Mc, 0xA952, 1},
-    {CAT_Po, 0xA95F, 0},
-    {CAT_Lo, 0xA960, 28},
-    {CAT_Mn, 0xA980, 2},
-    {CAT_Mc, 0xA983, 0},
-    {CAT_Lo, 0xA984, 46},
-    {CAT_Mn, 0xA9B3, 0},
-    {CAT_Mc, 0xA9B4, 1},
-    {CAT_Mn, 0xA9B6, 3},
-    {CAT_Mc, 0xA9BA, 1},
-    {CAT_Mn, 0xA9BC, 0},
-    {CAT_Mc, 0xA9BD, 3},
-    {CAT_Po, 0xA9C1, 12},
-    {CAT_Lm, 0xA9CF, 0},
-    {CAT_Nd, 0xA9D0, 9},
-    {CAT_Po, 0xA9DE, 1},
-    {CAT_Lo, 0xA9E0, 4},
-    {CAT_Mn, 0xA9E5, 0},
-    {CAT_Lm, 0xA9E6, 0},
-    {CAT_Lo, 0xA9E7, 8},
-    {CAT_Nd, 0xA9F0, 9},
-    {CAT_Lo, 0xA9FA, 4},
-    {CAT_Lo, 0xAA00, 40},
-    {CAT_Mn, 0xAA29, 5},
-    {CAT_Mc, 0xAA2F, 1},
-    {CAT_Mn, 0xAA31, 1},
-    {CAT_Mc, 0xAA33, 1},
-    {CAT_Mn, 0xAA35, 1},
-    {CAT_Lo, 0xAA40, 2},
-    {CAT_Mn, 0xAA43, 0},
-    {CAT_Lo, 0xAA44, 7},
-    {CAT_Mn, 0xAA4C, 0},
-    {CAT_Mc, 0xAA4D, 0},
-    {CAT_Nd, 0xAA50, 9},
-    {CAT_Po, 0xAA5C, 3},
-    {CAT_Lo, 0xAA60, 15},
-    {CAT_Lm, 0xAA70, 0},
-    {CAT_Lo, 0xAA71, 5},
-    {CAT_So, 0xAA77, 2},
-    {CAT_Lo, 0xAA7A, 0},
-    {CAT_Mc, 0xAA7B, 0},
-    {CAT_Mn, 0xAA7C, 0},
-    {CAT_Mc, 0xAA7D, 0},
-    {CAT_Lo, 0xAA7E, 49},
-    {CAT_Mn, 0xAAB0, 0},
-    {CAT_Lo, 0xAAB1, 0},
-    {CAT_Mn, 0xAAB2, 2},
-    {CAT_Lo, 0xAAB5, 1},
-    {CAT_Mn, 0xAAB7, 1},
-    {CAT_Lo, 0xAAB9, 4},
-    {CAT_Mn, 0xAABE, 1},
-    {CAT_Lo, 0xAAC0, 0},
-    {CAT_Mn, 0xAAC1, 0},
-    {CAT_Lo, 0xAAC2, 0},
-    {CAT_Lo, 0xAADB, 1},
-    {CAT_Lm, 0xAADD, 0},
-    {CAT_Po, 0xAADE, 1},
-    {CAT_Lo, 0xAAE0, 10},
-    {CAT_Mc, 0xAAEB, 0},
-    {CAT_Mn, 0xAAEC, 1},
-    {CAT_Mc, 0xAAEE, 1},
-    {CAT_Po, 0xAAF0, 1},
-    {CAT_Lo, 0xAAF2, 0},
-    {CAT_Lm, 0xAAF3, 1},
-    {CAT_Mc, 0xAAF5, 0},
-    {CAT_Mn, 0xAAF6, 0},
-    {CAT_Lo, 0xAB01, 5},
-    {CAT_Lo, 0xAB09, 5},
-    {CAT_Lo, 0xAB11, 5},
-    {CAT_Lo, 0xAB20, 6},
-    {CAT_Lo, 0xAB28, 6},
-    {CAT_Ll, 0xAB30, 34},
-    {CAT_LC, 0xAB53, 0},
-    {CAT_Ll, 0xAB54, 6},
-    {CAT_Sk, 0xAB5B, 0},
-    {CAT_Lm, 0xAB5C, 3},
-    {CAT_Ll, 0xAB60, 5},
-    {CAT_LC, 0xAB70, 79},
-    {CAT_Lo, 0xABC0, 34},
-    {CAT_Mc, 0xABE3, 1},
-    {CAT_Mn, 0xABE5, 0},
-    {CAT_Mc, 0xABE6, 1},
-    {CAT_Mn, 0xABE8, 0},
-    {CAT_Mc, 0xABE9, 1},
-    {CAT_Po, 0xABEB, 0},
-    {CAT_Mc, 0xABEC, 0},
-    {CAT_Mn, 0xABED, 0},
-    {CAT_Nd, 0xABF0, 9},
-    {CAT_Lo, 0xAC00, 11171},
-    {CAT_Lo, 0xD7B0, 22},
-    {CAT_Lo, 0xD7CB, 48},
-    {CAT_Cs, 0xD800, 2047},
-    {CAT_Lo, 0xF900, 365},
-    {CAT_Lo, 0xFA70, 105},
-    {CAT_Ll, 0xFB00, 6},
-    {CAT_Ll, 0xFB13, 4},
-    {CAT_Lo, 0xFB1D, 0},
-    {CAT_Mn, 0xFB1E, 0},
-    {CAT_Lo, 0xFB1F, 9},
-    {CAT_Sm, 0xFB29, 0},
-    {CAT_Lo, 0xFB2A, 12},
-    {CAT_Lo, 0xFB38, 4},
-    {CAT_Lo, 0xFB3E, 0},
-    {CAT_Lo, 0xFB40, 1},
-    {CAT_Lo, 0xFB43, 1},
-    {CAT_Lo, 0xFB46, 107},
-    {CAT_Sk, 0xFBB2, 15},
-    {CAT_Lo, 0xFBD3, 362},
-    {CAT_Pe, 0xFD3E, 0},
-    {CAT_Ps, 0xFD3F, 0},
-    {CAT_Lo, 0xFD50, 63},
-    {CAT_Lo, 0xFD92, 53},
-    {CAT_Lo, 0xFDF0, 11},
-    {CAT_Sc, 0xFDFC, 0},
-    {CAT_So, 0xFDFD, 0},
-    {CAT_Mn, 0xFE00, 15},
-    {CAT_Po, 0xFE10, 6},
-    {CAT_Ps, 0xFE17, 0},
-    {CAT_Pe, 0xFE18, 0},
-    {CAT_Po, 0xFE19, 0},
-    {CAT_Mn, 0xFE20, 15},
-    {CAT_Po, 0xFE30, 0},
-    {CAT_Pd, 0xFE31, 1},
-    {CAT_Pc, 0xFE33, 1},
-    {CAT_Ps, 0xFE35, 0},
-    {CAT_Pe, 0xFE36, 0},
-    {CAT_Ps, 0xFE37, 0},
-    {CAT_Pe, 0xFE38, 0},
-    {CAT_Ps, 0xFE39, 0},
-    {CAT_Pe, 0xFE3A, 0},
-    {CAT_Ps, 0xFE3B, 0},
-    {CAT_Pe, 0xFE3C, 0},
-    {CAT_Ps, 0xFE3D, 0},
-    {CAT_Pe, 0xFE3E, 0},
-    {CAT_Ps, 0xFE3F, 0},
-    {CAT_Pe, 0xFE40, 0},
-    {CAT_Ps, 0xFE41, 0},
-    {CAT_Pe, 0xFE42, 0},
-    {CAT_Ps, 0xFE43, 0},
-    {CAT_Pe, 0xFE44, 0},
-    {CAT_Po, 0xFE45, 1},
-    {CAT_Ps, 0xFE47, 0},
-    {CAT_Pe, 0xFE48, 0},
-    {CAT_Po, 0xFE49, 3},
-    {CAT_Pc, 0xFE4D, 2},
-    {CAT_Po, 0xFE50, 2},
-    {CAT_Po, 0xFE54, 3},
-    {CAT_Pd, 0xFE58, 0},
-    {CAT_Ps, 0xFE59, 0},
-    {CAT_Pe, 0xFE5A, 0},
-    {CAT_Ps, 0xFE5B, 0},
-    {CAT_Pe, 0xFE5C, 0},
-    {CAT_Ps, 0xFE5D, 0},
-    {CAT_Pe, 0xFE5E, 0},
-    {CAT_Po, 0xFE5F, 2},
-    {CAT_Sm, 0xFE62, 0},
-    {CAT_Pd, 0xFE63, 0},
-    {CAT_Sm, 0xFE64, 2},
-    {CAT_Po, 0xFE68, 0},
-    {CAT_Sc, 0xFE69, 0},
-    {CAT_Po, 0xFE6A, 1},
-    {CAT_Lo, 0xFE70, 4},
-    {CAT_Lo, 0xFE76, 134},
-    {CAT_Cf, 0xFEFF, 0},
-    {CAT_Po, 0xFF01, 2},
-    {CAT_Sc, 0xFF04, 0},
-    {CAT_Po, 0xFF05, 2},
-    {CAT_Ps, 0xFF08, 0},
-    {CAT_Pe, 0xFF09, 0},
-    {CAT_Po, 0xFF0A, 0},
-    {CAT_Sm, 0xFF0B, 0},
-    {CAT_Po, 0xFF0C, 0},
-    {CAT_Pd, 0xFF0D, 0},
-    {CAT_Po, 0xFF0E, 1},
-    {CAT_Nd, 0xFF10, 9},
-    {CAT_Po, 0xFF1A, 1},
-    {CAT_Sm, 0xFF1C, 2},
-    {CAT_Po, 0xFF1F, 1},
-    {CAT_LC, 0xFF21, 25},
-    {CAT_Ps, 0xFF3B, 0},
-    {CAT_Po, 0xFF3C, 0},
-    {CAT_Pe, 0xFF3D, 0},
-    {CAT_Sk, 0xFF3E, 0},
-    {CAT_Pc, 0xFF3F, 0},
-    {CAT_Sk, 0xFF40, 0},
-    {CAT_LC, 0xFF41, 25},
-    {CAT_Ps, 0xFF5B, 0},
-    {CAT_Sm, 0xFF5C, 0},
-    {CAT_Pe, 0xFF5D, 0},
-    {CAT_Sm, 0xFF5E, 0},
-    {CAT_Ps, 0xFF5F, 0},
-    {CAT_Pe, 0xFF60, 0},
-    {CAT_Po, 0xFF61, 0},
-    {CAT_Ps, 0xFF62, 0},
-    {CAT_Pe, 0xFF63, 0},
-    {CAT_Po, 0xFF64, 1},
-    {CAT_Lo, 0xFF66, 9},
-    {CAT_Lm, 0xFF70, 0},
-    {CAT_Lo, 0xFF71, 44},
-    {CAT_Lm, 0xFF9E, 1},
-    {CAT_Lo, 0xFFA0, 30},
-    {CAT_Lo, 0xFFC2, 5},
-    {CAT_Lo, 0xFFCA, 5},
-    {CAT_Lo, 0xFFD2, 5},
-    {CAT_Lo, 0xFFDA, 2},
-    {CAT_Sc, 0xFFE0, 1},
-    {CAT_Sm, 0xFFE2, 0},
-    {CAT_Sk, 0xFFE3, 0},
-    {CAT_So, 0xFFE4, 0},
-    {CAT_Sc, 0xFFE5, 1},
-    {CAT_So, 0xFFE8, 0},
-    {CAT_Sm, 0xFFE9, 3},
-    {CAT_So, 0xFFED, 1},
-    {CAT_Cf, 0xFFF9, 2},
-    {CAT_So, 0xFFFC, 1},
     {CAT_Lo, 0x10000, 11},
     {CAT_Lo, 0x1000D, 25},
     {CAT_Lo, 0x10028, 18},
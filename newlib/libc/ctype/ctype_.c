@@ -85,7 +85,7 @@ static char sccsid[] = "@(#)ctype_.c	5.6 (Berkeley) 6/1/90";
 #ifndef __CYGWIN__
 const
 #endif
-char _ctype_b[128 + 256] = {
+char _ctype_b[128 + 256] __CTYPE_TABLE = {
 	_CTYPE_DATA_128_255,
 	_CTYPE_DATA_0_127,
 	_CTYPE_DATA_128_255
@@ -112,7 +112,7 @@ __asm__ ("					\n\
 #    endif
 #  else /* !__CYGWIN__ */
 
-const char _ctype_[1 + 256] = {
+const char _ctype_[1 + 256] __CTYPE_TABLE = {
 	0,
 	_CTYPE_DATA_0_127,
 	_CTYPE_DATA_128_255
@@ -121,7 +121,7 @@ const char _ctype_[1 + 256] = {
 
 #else	/* !ALLOW_NEGATIVE_CTYPE_INDEX */
 
-const char _ctype_[1 + 256] = {
+const char _ctype_[1 + 256] __CTYPE_TABLE = {
 	0,
 	_CTYPE_DATA_0_127,
 	_CTYPE_DATA_128_255
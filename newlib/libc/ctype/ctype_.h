@@ -1,13 +1,13 @@
 #include <ctype.h>
 
-#if (defined(__GNUC__) && !defined(__CHAR_UNSIGNED__) && !defined(COMPACT_CTYPE)) || defined (__CYGWIN__)
+#if (defined(__GNUC__) && !defined(__CHAR_UNSIGNED__) && !defined(COMPACT_CTYPE) && !defined(_WANT_C_LOCALE_CTYPE)) || defined (__CYGWIN__)
 #define ALLOW_NEGATIVE_CTYPE_INDEX
 #endif
 
 #ifdef ALLOW_NEGATIVE_CTYPE_INDEX
 
 #ifndef __CYGWIN__
-  extern const char _ctype_b[];
+  extern const char _ctype_b[] __CTYPE_TABLE;
 #else
   extern char _ctype_b[];
 #endif
@@ -475,7 +475,7 @@
 #ifndef __CYGWIN__
 static const
 #endif
-char __ctype_cp[26][128 + 256] = {
+char __ctype_cp[26][128 + 256] __CTYPE_TABLE = {
   { _CTYPE_CP437_128_254,
     0,
     _CTYPE_DATA_0_127,
@@ -636,7 +636,7 @@ char __ctype_cp[26][128 + 256] = {
 
 #else /* !defined(ALLOW_NEGATIVE_CTYPE_INDEX) */
 
-static const char __ctype_cp[26][1 + 256] = {
+static const char __ctype_cp[26][1 + 256] __CTYPE_TABLE = {
   { 0,
     _CTYPE_DATA_0_127,
     _CTYPE_CP437_128_254,
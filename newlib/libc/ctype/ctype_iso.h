@@ -279,7 +279,7 @@ extern int __iso_8859_index (const char *charset_ext);
 #ifndef __CYGWIN__
 static const
 #endif
-char __ctype_iso[15][128 + 256] = {
+char __ctype_iso[15][128 + 256] __CTYPE_TABLE = {
   { _CTYPE_ISO_8859_1_128_254,
     0,
     _CTYPE_DATA_0_127,
@@ -374,7 +374,7 @@ char __ctype_iso[15][128 + 256] = {
 
 #else /* !defined(ALLOW_NEGATIVE_CTYPE_INDEX) */
 
-static const char __ctype_iso[15][1 + 256] = {
+static const char __ctype_iso[15][1 + 256] __CTYPE_TABLE = {
   { 0,
     _CTYPE_DATA_0_127,
     _CTYPE_ISO_8859_1_128_254,
@@ -32,10 +32,16 @@
    the 'first' field could be reduced as needed, or larger ranges could
    be split up (reduce limit max=255 e.g. to max=127 or max=63 in 
    script mkcaseconv, check increasing table size).
+
+   Below U+10000 the table is only used by mkcaseconv, which turns it
+   into a two-stage one: caseconv_index gives the page of each 256
+   characters among the distinct ones in caseconv_pages, whose bytes
+   pick the pair of lower and upper case offsets, modulo 0x10000, in
+   caseconv_delta.  caseconv_table keeps the ranges above U+FFFF.
  */
 enum {TO1, TOLO, TOUP, TOBOTH};
 enum {EVENCAP, ODDCAP};
-static struct caseconv_entry {
+static const struct caseconv_entry {
   uint_least32_t first: 21;
   uint_least32_t diff: 8;
   uint_least32_t mode: 2;
@@ -44,6 +50,24 @@ static struct caseconv_entry {
 caseconv_table [] = {
 #include "caseconv.t"
 };
+
+static const unsigned char caseconv_index[256] = {
+#include "caseindex.t"
+};
+
+static const unsigned char caseconv_pages[][256] = {
+#include "casepages.t"
+};
+
+static const struct {
+  uint16_t lower;
+  uint16_t upper;
+} caseconv_delta[] = {
+#include "casedelta.t"
+};
+
+#define bmp_delta(c)	caseconv_delta[caseconv_pages[caseconv_index[(c) >> 8]][(c) & 0xff]]
+
 #define first(ce)	ce.first
 #define last(ce)	(ce.first + ce.diff)
 
@@ -72,6 +96,9 @@ bisearch (wint_t ucs, const struct caseconv_entry *table, int max)
 static wint_t
 toulower (wint_t c)
 {
+  if (c < 0x10000)
+    return (c + bmp_delta (c).lower) & 0xffff;
+
   const struct caseconv_entry * cce =
     bisearch(c, caseconv_table,
              sizeof(caseconv_table) / sizeof(*caseconv_table) - 1);
@@ -107,6 +134,9 @@ toulower (wint_t c)
 static wint_t
 touupper (wint_t c)
 {
+  if (c < 0x10000)
+    return (c + bmp_delta (c).upper) & 0xffff;
+
   const struct caseconv_entry * cce =
     bisearch(c, caseconv_table,
              sizeof(caseconv_table) / sizeof(*caseconv_table) - 1);
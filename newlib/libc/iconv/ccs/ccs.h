@@ -148,11 +148,57 @@ typedef struct
   int type;               /* Table type (builtin/external) */
   int optimization;       /* Table optimization type (speed/size) */ 
   const __uint16_t *tbl; /* Table's data */
+  int hint;               /* Last range found in a size-optimized table */
 } iconv_ccs_desc_t;
 
-/* Array containing all built-in CCS tables */
-extern const iconv_ccs_t *
+/*
+ * find_code_speed_8bit - find code in 8 bit speed-optimized table.
+ *
+ * PARAMETERS:
+ *     __uint16_t code - UCS-2 code whose mapping to find.
+ *     const unsigned char *tblp - "from UCS" table pointer.
+ *
+ * DESCRIPTION:
+ *     Used by the table CES converter and by the direct 8 bit loops of
+ *     the UCS-based conversion.
+ *
+ * RETURN:
+ *     Code that corresponds to 'code', or INVALC.
+ */
+static __inline __uint16_t
+find_code_speed_8bit (__uint16_t code,
+                             const unsigned char *tblp)
+{
+  int idx;
+  unsigned char ccs;
+
+  if (code == ((const __uint16_t *)tblp)[0])
+    return (__uint16_t)0xFF;
+ 
+  idx = ((const __uint16_t *)tblp)[1 + (code >> 8)];
+  
+  if (idx == INVBLK)
+    return (__uint16_t)INVALC;
+
+  ccs = tblp[(code & 0x00FF) + idx];
+
+  return ccs == 0xFF ? (__uint16_t)INVALC : (__uint16_t)ccs;
+}
+
+/*
+ * Attribute of the table declarations in ccsbi.h; ccsbi.c makes them
+ * weak with _ICONV_WEAK_CCS.
+ */
+#ifndef _ICONV_CCS_REF
+#  define _ICONV_CCS_REF
+#endif
+
+/* Array containing all built-in CCS tables, and its length without
+   the NULL at its end */
+extern const iconv_ccs_t *const
 _iconv_ccs[];
+extern const int
+_iconv_ccs_num;
 
 #endif /* __CCS_H__ */
 
@@ -3,12 +3,19 @@
  */
 
 #include <_ansi.h>
+/*
+ * With _ICONV_WEAK_CCS the tables are referenced weakly, so that only
+ * those the program references itself are linked; the others are NULL.
+ */
+#ifdef _ICONV_WEAK_CCS
+#  define _ICONV_CCS_REF __attribute__ ((__weak__))
+#endif
 #include "ccsbi.h"
 
 /*
  * The following array contains the list of built-in CCS tables.
  */
-const iconv_ccs_t *
+const iconv_ccs_t *const
 _iconv_ccs[] =
 {
 #if defined (ICONV_TO_UCS_CCS_CP775) \
@@ -177,3 +184,6 @@ _iconv_ccs[] =
 #endif
   NULL
 };
+
+const int
+_iconv_ccs_num = sizeof (_iconv_ccs) / sizeof (_iconv_ccs[0]) - 1;
@@ -62,6 +62,7 @@ my $NoTo;     # Don't generate "to_ucs" table (binary files only)
 my $NoFrom;   # Don't generate "from_ucs" table (binary files only)
 my $CCSCol;   # CCS column number in source file
 my $UCSCol;   # UCS column number in source file
+my $Packed;   # Output the binary image as a packed pic30 program memory array
 
 
 # DATA STRUCTURES WITH "TO_UCS" AND "FROM_UCS" SPEED/SIZE -OPTIMIZED TABLES
@@ -111,6 +112,10 @@ my $VarToUCSSpeed   = "to_ucs_speed_%s";
 my $VarFromUCSSize  = "from_ucs_size_%s";
 my $VarFromUCSSpeed = "from_ucs_speed_%s";
 my $VarBICCS             = "_iconv_ccs_%s";
+my $VarPacked            = "_iconv_ccs_packed_%s";
+my $MacroPacked          = 'PROGMEM_PACKED';
+# Binary image built in memory for packed output.
+my $Image;
 # Text block that visually separates tables.
 my $Separator = '=' x 70;
 
@@ -130,7 +135,8 @@ $_ = sprintf $_, $CCSName foreach +($VarToUCSSpeed,
                                     $VarToUCSSpeed,
                                     $VarFromUCSSpeed,
                                     $VarFromUCSSize,
-                                    $VarBICCS);
+                                    $VarBICCS,
+                                    $VarPacked);
 $_ = sprintf $_, "\U$CCSName" foreach +($GuardToUCS,
                                         $GuardFromUCS,
                                         $MacroCCSName);
@@ -139,7 +145,8 @@ $_ = sprintf $_, "\U$CCSName" foreach +($GuardToUCS,
 Err "Can't open \"$InFile\" file for reading: $!.\n", 1
 unless open(INFILE, '<', $InFile);
 Err "Can't open \"$OutFile\" file for writing: $!.\n", 1
-unless open(OUTFILE, '>', $OutFile);
+unless open(OUTFILE, '>', $Packed ? \$Image : $OutFile);
+binmode OUTFILE;
 
 # ==============================================================================
 # EXTRACT CODES MAP FROM INPUT FILE
@@ -498,6 +505,34 @@ else
 
 close INFILE;
 close OUTFILE;
+
+if ($Packed)
+{
+  # OUTPUT THE BINARY IMAGE AS A PACKED PROGRAM MEMORY ARRAY
+  my @bytes = unpack "C*", $Image;
+
+  Err "Can't open \"$OutFile\" file for writing: $!.\n", 1
+  unless open(OUTFILE, '>', $OutFile);
+  print OUTFILE
+"/*
+ * This file was generated automatically - don't edit it.
+ * File contains iconv CCS tables for $CCSName encoding, in the binary
+ * (.cct) format, packed three bytes to a pic30 program word.  Read them
+ * with pmem_read_packed () or pmem_memcpy_packed () from <pgmspace.h>.
+ */
+
+#include <pgmspace.h>
+
+const unsigned char $VarPacked\[] $MacroPacked =
+{";
+  for (my $i = 0; $i <= $#bytes; $i++)
+  {
+    print OUTFILE "\n\t" unless $i % 16;
+    printf OUTFILE "0x%.2X,", $bytes[$i];
+  }
+  print OUTFILE "\n};\n";
+  close OUTFILE;
+}
 exit 0;
 
 
@@ -1348,13 +1383,14 @@ sub ProcessOptions()
   my $nole_opt    = 'L'; # Don't generate big-endian tables
   my $noto_opt    = 't'; # Don't generate "to_ucs" table
   my $nofrom_opt  = 'f'; # Don't generate "from_ucs" table
+  my $packed_opt  = 'P'; # Generate a packed pic30 program memory array
 
   my %args;              # Command line arguments found by getopts()
 
   my $getopts_string = 
      "$help_opt$source_opt$enc_opt:$verbose_opt$input_opt:$output_opt:$plane_opt:"
    . "$nosize_opt$nospeed_opt$nobe_opt$nole_opt$noto_opt$nofrom_opt$ccscol_opt:"
-   . "$ucscol_opt:";
+   . "$ucscol_opt:$packed_opt";
 
   getopts($getopts_string, \%args) || Err "getopts() failed: $!.\n", 1;
 
@@ -1377,6 +1413,8 @@ Usage:
      -$nofrom_opt - don't generate "from_ucs" table;
      -$ccscol_opt - encoding's column number;
      -$ucscol_opt - UCS column number;
+     -$packed_opt - generate the binary tables as C source of a pic30 program
+          memory array packed three bytes to a word (Little Endian only);
      -$verbose_opt - verbose output.
 
 If output file name isn't specified, <infile>.c (for sources) or
@@ -1403,6 +1441,7 @@ END
   $Plane     = $args{$plane_opt};
   $InFile    = $args{$input_opt};
   $OutFile   = $args{$output_opt};
+  $Packed    = $args{$packed_opt};
   $CCSName   = $args{$enc_opt};
 
   Err "Error: input file isn't defined. Use -$help_opt for help.\n", 1
@@ -1414,7 +1453,7 @@ END
     $OutFile = $InFile;
     $OutFile =~ s/(.*\/)*([0-9a-zA-Z-_]*)(\..*)$/\L$2/;
     $OutFile =~ tr/-/_/;
-    if ($Source)
+    if ($Source || $Packed)
     {
       $OutFile = "$OutFile.c";
     }
@@ -1447,6 +1486,11 @@ END
     . "Source code always contains both speed- and size-optimized "
     . "tables in System Endian. Use -$help_opt for help.\n", 1
   if $Source and $NoSpeed || $NoSize || $NoBE || $NoLE || $NoTo || $NoFrom;
+
+  Err "-$packed_opt option can't be used with -$source_opt or -$nole_opt "
+    . "options.\n", 1 if $Packed and $Source || $NoLE;
+  # pic30 is little-endian.
+  $NoBE = 1 if $Packed;
   
   if (!$CCSCol && !$UCSCol)
   {
@@ -1470,7 +1514,8 @@ END
            "Use $OutFile file for output.\n",
            "Use $CCSName as CCS name.\n";
     print  "Generate C source file.\n"                if $Source;
-    print  "Generate binary file.\n"                  if !$Source;
+    print  "Generate binary file.\n"                  if !$Source && !$Packed;
+    print  "Generate packed program memory array.\n"  if $Packed;
     printf "Use plane N 0x%.4X.\n", hex $Plane if defined $Plane;
     printf "Use column N $CCSCol for $CCSName.\n";
     printf "Use column N $UCSCol for UCS.\n";
@@ -749,7 +749,7 @@ sub generate_ccsbi_h($)
   {
     print CCSBI_H "#if defined ($macro_to_ucs_ccs\U$ccs) \\\n";
     print CCSBI_H " || defined ($macro_from_ucs_ccs\U$ccs)\n";
-    print CCSBI_H "extern const iconv_ccs_t\n";
+    print CCSBI_H "extern const iconv_ccs_t _ICONV_CCS_REF\n";
     print CCSBI_H "$var_ccs$ccs;\n";
     print CCSBI_H "#endif\n";
   }
@@ -861,12 +861,19 @@ sub generate_ccsbi_c($)
 
   print CESBI_C "$comment_automatic\n\n";
   print CESBI_C "#include <_ansi.h>\n";
+  print CESBI_C "/*\n";
+  print CESBI_C " * With _ICONV_WEAK_CCS the tables are referenced weakly, so that only\n";
+  print CESBI_C " * those the program references itself are linked; the others are NULL.\n";
+  print CESBI_C " */\n";
+  print CESBI_C "#ifdef _ICONV_WEAK_CCS\n";
+  print CESBI_C "#  define _ICONV_CCS_REF __attribute__ ((__weak__))\n";
+  print CESBI_C "#endif\n";
   print CESBI_C "#include \"ccsbi.h\"\n\n";
   print CESBI_C "/*\n";
   print CESBI_C " * The following array contains the list of built-in CCS tables.\n";
   print CESBI_C " */\n";
 
-  print CESBI_C "const iconv_ccs_t *\n";
+  print CESBI_C "const iconv_ccs_t *const\n";
   print CESBI_C "_iconv_ccs[] =\n";
   print CESBI_C "{\n";
 
@@ -878,7 +885,9 @@ sub generate_ccsbi_c($)
     print CESBI_C "#endif\n";
   }
   print CESBI_C "  NULL\n";
-  print CESBI_C "};\n";
+  print CESBI_C "};\n\n";
+  print CESBI_C "const int\n";
+  print CESBI_C "_iconv_ccs_num = sizeof (_iconv_ccs) / sizeof (_iconv_ccs[0]) - 1;\n";
 
   close CESBI_C or err "Error while closing ../ccs/ccsbi.c file.";
 }
@@ -57,14 +57,11 @@
  */
 
 static ucs2_t
-find_code_size (ucs2_t code, const __uint16_t *tblp);
+find_code_size (ucs2_t code, const __uint16_t *tblp, int *hint);
 
 static __inline ucs2_t
 find_code_speed (ucs2_t code, const __uint16_t *tblp);
 
-static __inline ucs2_t
-find_code_speed_8bit (ucs2_t code, const unsigned char *tblp);
-
 #ifdef _ICONV_ENABLE_EXTERNAL_CCS
 static const iconv_ccs_desc_t *
 load_file (struct _reent *rptr, const char *name, int direction);
@@ -95,8 +92,8 @@ table_init_from_ucs (struct _reent *rptr,
   const iconv_ccs_t *biccsp = NULL;
   iconv_ccs_desc_t *ccsp;
   
-  for (i = 0; _iconv_ccs[i] != NULL; i++)
-    if (strcmp (_iconv_ccs[i]->name, encoding) == 0)
+  for (i = 0; i < _iconv_ccs_num; i++)
+    if (_iconv_ccs[i] != NULL && strcmp (_iconv_ccs[i]->name, encoding) == 0)
       {
         biccsp = _iconv_ccs[i]; 
         break;
@@ -113,6 +110,7 @@ table_init_from_ucs (struct _reent *rptr,
       ccsp->bits = biccsp->bits;
       ccsp->optimization = biccsp->from_ucs_type;
       ccsp->tbl = biccsp->from_ucs;
+      ccsp->hint = 0;
       
       return (void *)ccsp;
     }
@@ -130,7 +128,7 @@ table_convert_from_ucs (void *data,
                                unsigned char **outbuf,
                                size_t *outbytesleft)
 {
-  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
   ucs2_t code;
 
   if (in > 0xFFFF || in == INVALC)
@@ -150,7 +148,7 @@ table_convert_from_ucs (void *data,
   else if (ccsp->optimization == TABLE_SPEED_OPTIMIZED)
     code = find_code_speed ((ucs2_t)in, ccsp->tbl);
   else
-    code = find_code_size ((ucs2_t)in, ccsp->tbl);
+    code = find_code_size ((ucs2_t)in, ccsp->tbl, &ccsp->hint);
 
   if (code == INVALC)
     return (size_t)ICONV_CES_INVALID_CHARACTER;
@@ -176,8 +174,8 @@ table_init_to_ucs (struct _reent *rptr,
   const iconv_ccs_t *biccsp = NULL;
   iconv_ccs_desc_t *ccsp;
   
-  for (i = 0; _iconv_ccs[i] != NULL; i++)
-    if (strcmp (_iconv_ccs[i]->name, encoding) == 0)
+  for (i = 0; i < _iconv_ccs_num; i++)
+    if (_iconv_ccs[i] != NULL && strcmp (_iconv_ccs[i]->name, encoding) == 0)
       {
         biccsp = _iconv_ccs[i]; 
         break;
@@ -194,6 +192,7 @@ table_init_to_ucs (struct _reent *rptr,
       ccsp->bits = biccsp->bits;
       ccsp->optimization = biccsp->to_ucs_type;
       ccsp->tbl = biccsp->to_ucs;
+      ccsp->hint = 0;
       
       return (void *)ccsp;
     }
@@ -210,7 +209,7 @@ table_convert_to_ucs (void *data,
                              const unsigned char **inbuf,
                              size_t *inbytesleft)
 {
-  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
   ucs2_t ucs;
   
   if (ccsp->bits == TABLE_8BIT)
@@ -233,7 +232,7 @@ table_convert_to_ucs (void *data,
 
   if (ccsp->optimization == TABLE_SIZE_OPTIMIZED)
     ucs = find_code_size((ucs2_t)**inbuf << 8 | (ucs2_t)*(*inbuf + 1),
-                         ccsp->tbl);
+                         ccsp->tbl, &ccsp->hint);
   else
     ucs = find_code_speed((ucs2_t)**inbuf << 8 | (ucs2_t)*(*inbuf + 1),
                           ccsp->tbl);
@@ -308,36 +307,6 @@ find_code_speed (ucs2_t code,
   return (ucs2_t)tblp[(code & 0x00FF) + idx];
 }
 
-/*
- * find_code_speed_8bit - find code in 8 bit speed-optimized table.
- *
- * PARAMETERS:
- *     ucs2_t code - code whose mapping to find.
- *     const __uint16_t *tblp - table pointer.
- *
- * RETURN:
- *     Code that corresponds to 'code'.
- */
-static __inline ucs2_t
-find_code_speed_8bit (ucs2_t code,
-                             const unsigned char *tblp)
-{
-  int idx;
-  unsigned char ccs;
-
-  if (code == ((ucs2_t *)tblp)[0])
-    return (ucs2_t)0xFF;
- 
-  idx = ((ucs2_t *)tblp)[1 + (code >> 8)];
-  
-  if (idx == INVBLK)
-    return (ucs2_t)INVALC;
-
-  ccs = tblp[(code & 0x00FF) + idx];
-
-  return ccs == 0xFF ? (ucs2_t)INVALC : (ucs2_t)ccs;
-}
-
 /* Left range boundary */
 #define RANGE_LEFT(n)     (tblp[FIRST_RANGE_INDEX + (n)*3 + 0])
 /* Right range boundary */
@@ -353,18 +322,27 @@ find_code_speed_8bit (ucs2_t code,
  * PARAMETERS:
  *     ucs2_t code - code whose mapping to find.
  *     const __uint16_t *tblp - table pointer.
+ *     int *hint - the range of the last code found in it; text mostly
+ *                 stays in one range for a while, so that is tried
+ *                 before the binary search.
  *
  * RETURN:
  *     Code that corresponds to 'code'.
  */
 static ucs2_t
 find_code_size (ucs2_t code,
-                       const __uint16_t *tblp)
+                       const __uint16_t *tblp,
+                       int *hint)
 {
   int first, last, cur, center;
 
   if (tblp[RANGES_NUM_INDEX] > 0)
     {
+      cur = *hint;
+      if (cur < tblp[RANGES_NUM_INDEX]
+          && code >= RANGE_LEFT (cur) && code <= RANGE_RIGHT (cur))
+        return (ucs2_t)tblp[RANGE_INDEX (cur) + code - RANGE_LEFT (cur)];
+
       first = 0;
       last = tblp[RANGES_NUM_INDEX] - 1;
  
@@ -378,17 +356,26 @@ find_code_size (ucs2_t code,
           else if (code < RANGE_LEFT (cur))
             last = cur;
           else
-            return (ucs2_t)tblp[RANGE_INDEX (cur) + code - RANGE_LEFT (cur)];
+            {
+              *hint = cur;
+              return (ucs2_t)tblp[RANGE_INDEX (cur) + code - RANGE_LEFT (cur)];
+            }
         } while (center > 0);
 
         if (last - first == 1)
           {
             if (code >= RANGE_LEFT (first) && code <= RANGE_RIGHT (first))
-              return (ucs2_t)tblp[RANGE_INDEX (first)
-                                  + code - RANGE_LEFT (first)];
+              {
+                *hint = first;
+                return (ucs2_t)tblp[RANGE_INDEX (first)
+                                    + code - RANGE_LEFT (first)];
+              }
             if (code >= RANGE_LEFT (last) && code <= RANGE_RIGHT (last))
-              return (ucs2_t)tblp[RANGE_INDEX (last)
-                                  + code - RANGE_LEFT (last)];
+              {
+                *hint = last;
+                return (ucs2_t)tblp[RANGE_INDEX (last)
+                                    + code - RANGE_LEFT (last)];
+              }
           }
     }
   
@@ -57,6 +57,11 @@
 #define UTF_16BE "utf_16be"
 #define UTF_16LE "utf_16le"
 
+/*
+ * The data is two ints: the state, which changes once a BOM is written
+ * or read, and the state init chose, which set_state goes back to.
+ */
+
 static size_t
 utf_16_close (struct _reent *rptr,
                      void *data)
@@ -72,7 +77,7 @@ utf_16_init_from_ucs (struct _reent *rptr,
 {
   int *data;
   
-  if ((data = (int *)_malloc_r (rptr, sizeof (int))) == NULL)
+  if ((data = (int *)_malloc_r (rptr, 2 * sizeof (int))) == NULL)
     return (void *)NULL;
   
   if (strcmp (encoding, UTF_16LE) == 0)
@@ -81,6 +86,7 @@ utf_16_init_from_ucs (struct _reent *rptr,
     *data = UTF16_BIG_ENDIAN;
   else
     *data = UTF16_SYSTEM_ENDIAN;
+  data[1] = *data;
      
   return (void *)data;
 }
@@ -172,7 +178,7 @@ utf_16_init_to_ucs (struct _reent *rptr,
 {
   int *data;
   
-  if ((data = (int *)_malloc_r (rptr, sizeof (int))) == NULL)
+  if ((data = (int *)_malloc_r (rptr, 2 * sizeof (int))) == NULL)
     return (void *)NULL;
   
   if (strcmp (encoding, UTF_16BE) == 0)
@@ -181,6 +187,7 @@ utf_16_init_to_ucs (struct _reent *rptr,
     *data = UTF16_LITTLE_ENDIAN;
   else
     *data = UTF16_UNDEFINED;
+  data[1] = *data;
      
   return (void *)data;
 }
@@ -268,6 +275,22 @@ utf_16_get_mb_cur_max (void *data)
   return 6;
 }
 
+/*
+ * Only the initial state can be set, so that a reset descriptor writes
+ * or looks for a BOM again.
+ */
+static int
+utf_16_set_state (void *data,
+                         mbstate_t *state)
+{
+  int *d = (int *)data;
+
+  if (state->__count != 0)
+    return -1;
+  d[0] = d[1];
+  return 0;
+}
+
 #if defined (ICONV_TO_UCS_CES_UTF_16)
 const iconv_to_ucs_ces_handlers_t
 _iconv_to_ucs_ces_handlers_utf_16 = 
@@ -276,7 +299,7 @@ _iconv_to_ucs_ces_handlers_utf_16 =
   utf_16_close,
   utf_16_get_mb_cur_max,
   NULL,
-  NULL,
+  utf_16_set_state,
   NULL,
   utf_16_convert_to_ucs
 };
@@ -290,7 +313,7 @@ _iconv_from_ucs_ces_handlers_utf_16 =
   utf_16_close,
   utf_16_get_mb_cur_max,
   NULL,
-  NULL,
+  utf_16_set_state,
   NULL,
   utf_16_convert_from_ucs
 };
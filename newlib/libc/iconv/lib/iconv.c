@@ -77,6 +77,18 @@ to create a conversion specifier that can be used with <<iconv>>.
 The function <<iconv_close>> is used to close a conversion specifier after
 it is no longer needed.
 
+A call to <<iconv>> with a null <[inbuf]> and a null <[outbuf]> puts both
+sides of <[cd]> back to their initial state, so that it converts as if
+just opened; this is the cheap way to use one conversion specifier for
+many independent pieces of text.
+
+When newlib is built with <<ICONV_CACHE>> defined to a number of slots,
+<<iconv_close>> keeps that many conversion specifiers, reset, and
+<<iconv_open>> hands one back when it is asked for the same names,
+spelled the same way, up to 15 characters each.  Opening and closing
+a conversion for every message then allocates nothing and looks no
+name up once the first one has been closed.
+
 The <<_iconv_r>>, <<_iconv_open_r>>, and <<_iconv_close_r>> functions are
 reentrant versions of <<iconv>>, <<iconv_open>>, and <<iconv_close>>,
 respectively.  An additional reentrancy struct pointer: <[rptr]> is passed
@@ -111,6 +123,7 @@ No supporting OS subroutine calls are required.
 #include <iconv.h>
 #include <wchar.h>
 #include <sys/iconvnls.h>
+#include <sys/lock.h>
 #include "local.h"
 #include "conv.h"
 #include "ucsconv.h"
@@ -147,16 +160,153 @@ iconv_close (iconv_t cd)
 
 
 #ifndef _REENT_ONLY
+/*
+ * Put both sides of IC back to the state they were opened in.
+ */
+static void
+iconv_reset (iconv_conversion_t *ic)
+{
+  mbstate_t state_from = ICONV_ZERO_MB_STATE_T;
+  mbstate_t state_to = ICONV_ZERO_MB_STATE_T;
+
+  ic->handlers->set_state (ic->data, &state_from, 0);
+  ic->handlers->set_state (ic->data, &state_to, 1);
+}
+
+#ifdef ICONV_CACHE
+/* Longest name kept, with its NUL */
+#define ICONV_CACHE_NAME 16
+
+/*
+ * Descriptors of ICONV_CACHE recent conversions by the names they were
+ * opened with.  A busy slot's descriptor is open; an idle one's has been
+ * closed and reset, and is given out again or freed to make room.
+ */
+static struct
+{
+  iconv_conversion_t *ic;
+  int busy;
+  char to[ICONV_CACHE_NAME];
+  char from[ICONV_CACHE_NAME];
+} iconv_cache[ICONV_CACHE];
+
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT (static, __iconv_cache_lock);
+#  define ICONV_CACHE_LOCK() __lock_acquire (__iconv_cache_lock)
+#  define ICONV_CACHE_UNLOCK() __lock_release (__iconv_cache_lock)
+#else
+#  define ICONV_CACHE_LOCK()
+#  define ICONV_CACHE_UNLOCK()
+#endif
+
+/* An idle descriptor opened as TO and FROM, or NULL */
+static iconv_conversion_t *
+iconv_cache_take (const char *to,
+                         const char *from)
+{
+  iconv_conversion_t *ic = NULL;
+  int i;
+
+  ICONV_CACHE_LOCK ();
+  for (i = 0; i < ICONV_CACHE; i++)
+    if (iconv_cache[i].ic != NULL && !iconv_cache[i].busy
+        && strcmp (iconv_cache[i].to, to) == 0
+        && strcmp (iconv_cache[i].from, from) == 0)
+      {
+        iconv_cache[i].busy = 1;
+        ic = iconv_cache[i].ic;
+        break;
+      }
+  ICONV_CACHE_UNLOCK ();
+  return ic;
+}
+
+/* Keep the new descriptor IC, opened as TO and FROM, once it is closed */
+static void
+iconv_cache_put (struct _reent *rptr,
+                        iconv_conversion_t *ic,
+                        const char *to,
+                        const char *from)
+{
+  iconv_conversion_t *old = NULL;
+  int i, slot = -1;
+
+  if (strlen (to) >= ICONV_CACHE_NAME || strlen (from) >= ICONV_CACHE_NAME)
+    return;
+
+  ICONV_CACHE_LOCK ();
+  for (i = 0; i < ICONV_CACHE; i++)
+    {
+      if (iconv_cache[i].ic == NULL)
+        {
+          slot = i;
+          break;
+        }
+      if (!iconv_cache[i].busy && slot < 0)
+        slot = i;
+    }
+  if (slot >= 0)
+    {
+      old = iconv_cache[slot].ic;
+      iconv_cache[slot].ic = ic;
+      iconv_cache[slot].busy = 1;
+      strcpy (iconv_cache[slot].to, to);
+      strcpy (iconv_cache[slot].from, from);
+    }
+  ICONV_CACHE_UNLOCK ();
+
+  if (old != NULL)
+    {
+      old->handlers->close (rptr, old->data);
+      _free_r (rptr, (void *)old);
+    }
+}
+
+/*
+ * Whether IC is kept: 1 if it was open and is now idle, -1 if it was
+ * idle already, that is closed, and 0 if it is not in the cache.
+ */
+static int
+iconv_cache_release (iconv_conversion_t *ic)
+{
+  int i, found = 0;
+
+  ICONV_CACHE_LOCK ();
+  for (i = 0; i < ICONV_CACHE; i++)
+    if (iconv_cache[i].ic == ic)
+      {
+        if (iconv_cache[i].busy)
+          {
+            iconv_reset (ic);
+            iconv_cache[i].busy = 0;
+            found = 1;
+          }
+        else
+          found = -1;
+        break;
+      }
+  ICONV_CACHE_UNLOCK ();
+  return found;
+}
+#endif /* ICONV_CACHE */
+
+
 iconv_t
 _iconv_open_r (struct _reent *rptr,
                       const char *to,
                       const char *from)
 {
   iconv_conversion_t *ic;
+  const char *to_name = to, *from_name = from;
     
   if (to == NULL || from == NULL || *to == '\0' || *from == '\0')
     return (iconv_t)-1;
 
+#ifdef ICONV_CACHE
+  if ((ic = iconv_cache_take (to, from)) != NULL)
+    return (void *)ic;
+#endif
+
   if ((to = (const char *)_iconv_resolve_encoding_name (rptr, to)) == NULL)
     return (iconv_t)-1;
 
@@ -193,6 +343,10 @@ _iconv_open_r (struct _reent *rptr,
       return (iconv_t)-1;
     }
 
+#ifdef ICONV_CACHE
+  iconv_cache_put (rptr, ic, to_name, from_name);
+#endif
+
   return (void *)ic;
 }
 
@@ -219,16 +373,16 @@ _iconv_r (struct _reent *rptr,
     {
       mbstate_t state_null = ICONV_ZERO_MB_STATE_T;
       
-      if (!ic->handlers->is_stateful(ic->data, 1))
-        return (size_t)0;
-      
       if (outbuf == NULL || *outbuf == NULL)
         {
-          /* Reset shift state */
-          ic->handlers->set_state (ic->data, &state_null, 1);
+          /* Reset both sides, as if CD had just been opened */
+          iconv_reset (ic);
           
           return (size_t)0;
         }
+      
+      if (!ic->handlers->is_stateful(ic->data, 1))
+        return (size_t)0;
        
       if (outbytesleft != NULL)
         {
@@ -298,6 +452,17 @@ _iconv_close_r (struct _reent *rptr,
       return -1;
     }
 
+#ifdef ICONV_CACHE
+  switch (iconv_cache_release (ic))
+    {
+      case 1:
+        return 0;
+      case -1:
+        __errno_r (rptr) = EBADF;
+        return -1;
+    }
+#endif
+
   res = (int)ic->handlers->close (rptr, ic->data);
   
   _free_r (rptr, (void *)cd);
@@ -32,6 +32,9 @@
 #include "local.h"
 #include "conv.h"
 #include "ucsconv.h"
+#include "encnames.h"
+#include "../ces/cesbi.h"
+#include "../ccs/ccs.h"
 
 static int fake_data;
 
@@ -39,6 +42,283 @@ static int
 find_encoding_name (const char *searchee,
                             const char **names);
 
+/*
+ * UTF-8 <-> UTF-16LE (and UCS-2LE) conversions skip the UCS-4 pivot for
+ * the characters they can: ASCII and the rest of the BMP outside the
+ * surrogates and U+FFFE/U+FFFF.  Anything else - a 4-byte UTF-8 sequence,
+ * a surrogate pair, an invalid or truncated sequence, a full output
+ * buffer - stops the direct loop and takes the CES handlers' path, so
+ * the results and errors are theirs.
+ */
+#if defined (_ICONV_FROM_ENCODING_UTF_8) \
+ && (defined (_ICONV_TO_ENCODING_UTF_16LE) \
+  || defined (_ICONV_TO_ENCODING_UCS_2LE))
+#  define UTF_8_TO_16LE_DIRECT 1
+#endif
+#if defined (_ICONV_TO_ENCODING_UTF_8) \
+ && (defined (_ICONV_FROM_ENCODING_UTF_16LE) \
+  || defined (_ICONV_FROM_ENCODING_UCS_2LE))
+#  define UTF_16LE_TO_8_DIRECT 2
+#endif
+
+#ifdef UTF_8_TO_16LE_DIRECT
+static void
+utf_8_to_16le (const unsigned char **inbuf,
+                      size_t *inbytesleft,
+                      unsigned char **outbuf,
+                      size_t *outbytesleft,
+                      int save)
+{
+  const unsigned char *in = *inbuf;
+  const unsigned char *end = in + *inbytesleft;
+  unsigned char *out = *outbuf;
+  size_t left = *outbytesleft;
+
+  while (in < end && left >= 2)
+    {
+      ucs4_t ch = in[0];
+
+      if (ch < 0x80)
+        in += 1;
+      else if (ch >= 0xC2 && ch < 0xE0 && end - in >= 2
+               && (in[1] & 0xC0) == 0x80)
+        {
+          ch = ((ch & 0x1F) << 6) | (in[1] & 0x3F);
+          in += 2;
+        }
+      else if (ch >= 0xE0 && ch < 0xF0 && end - in >= 3
+               && (in[1] & 0xC0) == 0x80 && (in[2] & 0xC0) == 0x80)
+        {
+          ch = ((ch & 0x0F) << 12) | ((in[1] & 0x3F) << 6) | (in[2] & 0x3F);
+          if (ch < 0x800 || (ch >= 0xD800 && ch <= 0xDFFF) || ch >= 0xFFFE)
+            break;
+          in += 3;
+        }
+      else
+        break;
+
+      if (save)
+        {
+          out[0] = (unsigned char)ch;
+          out[1] = (unsigned char)(ch >> 8);
+          out += 2;
+        }
+      left -= 2;
+    }
+
+  *inbytesleft -= in - *inbuf;
+  *inbuf = in;
+  *outbuf = out;
+  *outbytesleft = left;
+}
+#endif /* UTF_8_TO_16LE_DIRECT */
+
+#ifdef UTF_16LE_TO_8_DIRECT
+static void
+utf_16le_to_8 (const unsigned char **inbuf,
+                      size_t *inbytesleft,
+                      unsigned char **outbuf,
+                      size_t *outbytesleft,
+                      int save)
+{
+  const unsigned char *in = *inbuf;
+  const unsigned char *end = in + (*inbytesleft & ~(size_t)1);
+  unsigned char *out = *outbuf;
+  size_t left = *outbytesleft;
+
+  while (in < end && left > 0)
+    {
+      ucs4_t ch = in[0] | ((ucs4_t)in[1] << 8);
+
+      if (ch < 0x80)
+        {
+          if (save)
+            *out++ = (unsigned char)ch;
+          left -= 1;
+        }
+      else if (ch < 0x800)
+        {
+          if (left < 2)
+            break;
+          if (save)
+            {
+              *out++ = (unsigned char)(0xC0 | (ch >> 6));
+              *out++ = (unsigned char)(0x80 | (ch & 0x3F));
+            }
+          left -= 2;
+        }
+      else if ((ch < 0xD800 || ch > 0xDFFF) && ch < 0xFFFE)
+        {
+          if (left < 3)
+            break;
+          if (save)
+            {
+              *out++ = (unsigned char)(0xE0 | (ch >> 12));
+              *out++ = (unsigned char)(0x80 | ((ch >> 6) & 0x3F));
+              *out++ = (unsigned char)(0x80 | (ch & 0x3F));
+            }
+          left -= 3;
+        }
+      else
+        break;
+      in += 2;
+    }
+
+  *inbytesleft -= in - *inbuf;
+  *inbuf = in;
+  *outbuf = out;
+  *outbytesleft = left;
+}
+#endif /* UTF_16LE_TO_8_DIRECT */
+
+/*
+ * The 8 bit CCSes of the table CES - KOI8-R, ISO-8859-*, the Windows code
+ * pages - convert to and from UTF-8, and to one another, in direct loops
+ * over uc->map:
+ *   - from such a CCS, its "to UCS" table, of the UCS-2 code of each byte;
+ *   - between two of them, the output byte of each input byte, made by
+ *     ucs_based_conversion_open;
+ *   - to such a CCS from UTF-8, its "from UCS" table.
+ * As above, what the loops don't convert - a character the output lacks,
+ * a 4-byte or invalid UTF-8 sequence, a full output buffer - is left to
+ * the CES handlers.
+ */
+#if defined (ICONV_TO_UCS_CES_TABLE) && defined (_ICONV_TO_ENCODING_UTF_8)
+#  define SBCS_TO_UTF_8_DIRECT 3
+#endif
+#if defined (ICONV_FROM_UCS_CES_TABLE) && defined (_ICONV_FROM_ENCODING_UTF_8)
+#  define UTF_8_TO_SBCS_DIRECT 4
+#endif
+#if defined (ICONV_TO_UCS_CES_TABLE) && defined (ICONV_FROM_UCS_CES_TABLE)
+#  define SBCS_TO_SBCS_DIRECT 5
+#endif
+
+#if defined (SBCS_TO_UTF_8_DIRECT) || defined (UTF_8_TO_SBCS_DIRECT) \
+ || defined (SBCS_TO_SBCS_DIRECT)
+#  define SBCS_DIRECT 1
+
+/* The table of the 8 bit CCS behind table CES data DATA, or NULL */
+#define SBCS_TABLE(data) \
+  (((const iconv_ccs_desc_t *)(data))->bits == TABLE_8BIT \
+   ? ((const iconv_ccs_desc_t *)(data))->tbl : NULL)
+
+static void
+sbcs_direct (const iconv_ucs_conversion_t *uc,
+                    const unsigned char **inbuf,
+                    size_t *inbytesleft,
+                    unsigned char **outbuf,
+                    size_t *outbytesleft,
+                    int save)
+{
+  const unsigned char *in = *inbuf;
+  const unsigned char *end = in + *inbytesleft;
+  unsigned char *out = *outbuf;
+  size_t left = *outbytesleft;
+  const __uint16_t *map = uc->map;
+  ucs4_t ch;
+
+  switch (uc->direct)
+    {
+#ifdef SBCS_TO_UTF_8_DIRECT
+    case SBCS_TO_UTF_8_DIRECT:
+      while (in < end && left > 0)
+        {
+          ch = map[*in];
+          if (ch < 0x80)
+            {
+              if (save)
+                *out++ = (unsigned char)ch;
+              left -= 1;
+            }
+          else if (ch < 0x800)
+            {
+              if (left < 2)
+                break;
+              if (save)
+                {
+                  *out++ = (unsigned char)(0xC0 | (ch >> 6));
+                  *out++ = (unsigned char)(0x80 | (ch & 0x3F));
+                }
+              left -= 2;
+            }
+          else
+            {
+              if (ch == INVALC || left < 3)
+                break;
+              if (save)
+                {
+                  *out++ = (unsigned char)(0xE0 | (ch >> 12));
+                  *out++ = (unsigned char)(0x80 | ((ch >> 6) & 0x3F));
+                  *out++ = (unsigned char)(0x80 | (ch & 0x3F));
+                }
+              left -= 3;
+            }
+          in += 1;
+        }
+      break;
+#endif
+#ifdef UTF_8_TO_SBCS_DIRECT
+    case UTF_8_TO_SBCS_DIRECT:
+      while (in < end && left > 0)
+        {
+          int n;
+
+          ch = in[0];
+          if (ch < 0x80)
+            n = 1;
+          else if (ch >= 0xC2 && ch < 0xE0 && end - in >= 2
+                   && (in[1] & 0xC0) == 0x80)
+            {
+              ch = ((ch & 0x1F) << 6) | (in[1] & 0x3F);
+              n = 2;
+            }
+          else if (ch >= 0xE0 && ch < 0xF0 && end - in >= 3
+                   && (in[1] & 0xC0) == 0x80 && (in[2] & 0xC0) == 0x80)
+            {
+              ch = ((ch & 0x0F) << 12) | ((in[1] & 0x3F) << 6)
+                   | (in[2] & 0x3F);
+              if (ch < 0x800 || (ch >= 0xD800 && ch <= 0xDFFF)
+                  || ch >= 0xFFFE)
+                break;
+              n = 3;
+            }
+          else
+            break;
+
+          ch = find_code_speed_8bit ((__uint16_t)ch,
+                                     (const unsigned char *)map);
+          if (ch == INVALC)
+            break;
+          if (save)
+            *out++ = (unsigned char)ch;
+          left -= 1;
+          in += n;
+        }
+      break;
+#endif
+#ifdef SBCS_TO_SBCS_DIRECT
+    case SBCS_TO_SBCS_DIRECT:
+      while (in < end && left > 0)
+        {
+          ch = map[*in];
+          if (ch == INVALC)
+            break;
+          if (save)
+            *out++ = (unsigned char)ch;
+          left -= 1;
+          in += 1;
+        }
+      break;
+#endif
+    }
+
+  *inbytesleft -= in - *inbuf;
+  *inbuf = in;
+  *outbuf = out;
+  *outbytesleft = left;
+}
+#endif /* SBCS_DIRECT */
+
 
 /*
  * UCS-based conversion interface functions implementation.
@@ -109,6 +389,55 @@ ucs_based_conversion_open (struct _reent *rptr,
   else
     uc->from_ucs.data = (void *)&fake_data;
 
+#ifdef UTF_8_TO_16LE_DIRECT
+  if (strcmp (from, ICONV_ENCODING_UTF_8) == 0
+      && (strcmp (to, ICONV_ENCODING_UTF_16LE) == 0
+          || strcmp (to, ICONV_ENCODING_UCS_2LE) == 0))
+    uc->direct = UTF_8_TO_16LE_DIRECT;
+#endif
+#ifdef UTF_16LE_TO_8_DIRECT
+  if (strcmp (to, ICONV_ENCODING_UTF_8) == 0
+      && (strcmp (from, ICONV_ENCODING_UTF_16LE) == 0
+          || strcmp (from, ICONV_ENCODING_UCS_2LE) == 0))
+    uc->direct = UTF_16LE_TO_8_DIRECT;
+#endif
+#ifdef SBCS_TO_UTF_8_DIRECT
+  if (uc->to_ucs.handlers == &_iconv_to_ucs_ces_handlers_table
+      && strcmp (to, ICONV_ENCODING_UTF_8) == 0
+      && (uc->map = SBCS_TABLE (uc->to_ucs.data)) != NULL)
+    uc->direct = SBCS_TO_UTF_8_DIRECT;
+#endif
+#ifdef UTF_8_TO_SBCS_DIRECT
+  if (uc->from_ucs.handlers == &_iconv_from_ucs_ces_handlers_table
+      && strcmp (from, ICONV_ENCODING_UTF_8) == 0
+      && (uc->map = SBCS_TABLE (uc->from_ucs.data)) != NULL)
+    uc->direct = UTF_8_TO_SBCS_DIRECT;
+#endif
+#ifdef SBCS_TO_SBCS_DIRECT
+  if (uc->to_ucs.handlers == &_iconv_to_ucs_ces_handlers_table
+      && uc->from_ucs.handlers == &_iconv_from_ucs_ces_handlers_table
+      && SBCS_TABLE (uc->to_ucs.data) != NULL
+      && SBCS_TABLE (uc->from_ucs.data) != NULL)
+    {
+      /* Compose the two tables; without the memory, go the long way */
+      const __uint16_t *to_tbl = SBCS_TABLE (uc->to_ucs.data);
+      const unsigned char *from_tbl =
+        (const unsigned char *)SBCS_TABLE (uc->from_ucs.data);
+      __uint16_t *map;
+      int i;
+
+      map = (__uint16_t *)_malloc_r (rptr, 256 * sizeof (__uint16_t));
+      if (map != NULL)
+        {
+          for (i = 0; i < 256; i++)
+            map[i] = to_tbl[i] == INVALC
+                     ? INVALC : find_code_speed_8bit (to_tbl[i], from_tbl);
+          uc->map = map;
+          uc->direct = SBCS_TO_SBCS_DIRECT;
+        }
+    }
+#endif
+
   return uc;
 
 error:
@@ -130,6 +459,11 @@ ucs_based_conversion_close (struct _reent *rptr,
 
   uc = (iconv_ucs_conversion_t *)data;
 
+#ifdef SBCS_TO_SBCS_DIRECT
+  if (uc->direct == SBCS_TO_SBCS_DIRECT)
+    _free_r (rptr, (void *)uc->map);
+#endif
+
   if (uc->from_ucs.handlers->close != NULL)  
     res = uc->from_ucs.handlers->close (rptr, uc->from_ucs.data);
   if (uc->to_ucs.handlers->close != NULL)
@@ -162,6 +496,40 @@ ucs_based_conversion_convert (struct _reent *rptr,
       const unsigned char *inbuf_save = *inbuf;
       size_t inbyteslef_save = *inbytesleft;
 
+#ifdef UTF_8_TO_16LE_DIRECT
+      if (uc->direct == UTF_8_TO_16LE_DIRECT)
+        {
+          utf_8_to_16le (inbuf, inbytesleft, outbuf, outbytesleft,
+                         !(flags & ICONV_DONT_SAVE_BIT));
+          if (*inbytesleft == 0)
+            break;
+          inbuf_save = *inbuf;
+          inbyteslef_save = *inbytesleft;
+        }
+#endif
+#ifdef UTF_16LE_TO_8_DIRECT
+      if (uc->direct == UTF_16LE_TO_8_DIRECT)
+        {
+          utf_16le_to_8 (inbuf, inbytesleft, outbuf, outbytesleft,
+                         !(flags & ICONV_DONT_SAVE_BIT));
+          if (*inbytesleft == 0)
+            break;
+          inbuf_save = *inbuf;
+          inbyteslef_save = *inbytesleft;
+        }
+#endif
+#ifdef SBCS_DIRECT
+      if (uc->map != NULL)
+        {
+          sbcs_direct (uc, inbuf, inbytesleft, outbuf, outbytesleft,
+                       !(flags & ICONV_DONT_SAVE_BIT));
+          if (*inbytesleft == 0)
+            break;
+          inbuf_save = *inbuf;
+          inbyteslef_save = *inbytesleft;
+        }
+#endif
+
       if (*outbytesleft == 0)
         {
           __errno_r (rptr) = E2BIG;
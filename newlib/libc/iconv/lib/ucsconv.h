@@ -276,6 +276,13 @@ typedef struct
 
   /* UCS -> destination encoding CES converter. */
   iconv_from_ucs_ces_desc_t from_ucs;
+
+  /* Direct loop for UTF-8 <-> UTF-16LE/UCS-2LE or 8 bit CCS, or 0
+     (see ucsconv.c). */
+  int direct;
+
+  /* The table the 8 bit direct loops read, or NULL. */
+  const __uint16_t *map;
 } iconv_ucs_conversion_t;
 
 
@@ -79,4 +79,31 @@
 #define _NOINLINE_STATIC
 #endif
 
+/* Constant tables and strings of the library that would otherwise
+   take RAM: on pic30, with -mconst-in-data or not, they are placed in
+   program memory and read through the auto-PSV window that the startup
+   code maps, with ordinary pointers.  _PSV_STR gives a string literal
+   the same placement; it is a GNU statement expression, so only for
+   use inside functions.  */
+#ifdef __dsPIC30__
+#define _PSV_CONST	__attribute__ ((space (auto_psv)))
+#define _PSV_STR(s) \
+  (__extension__ ({ static const char __psv_str[] _PSV_CONST = s; \
+		    (char *) __psv_str; }))
+#else
+#define _PSV_CONST
+#define _PSV_STR(s)	(s)
+#endif
+
+/* Library state touched on most calls that use it, such as the malloc
+   free list and the stack protector guard.  On pic30 it is pinned to
+   near RAM, the first 8K, which instructions address directly, even
+   when -mlarge-data would let the linker place it further up.  Every
+   declaration of such an object must carry it.  */
+#ifdef __dsPIC30__
+#define _NEAR_DATA	__attribute__ ((__near__))
+#else
+#define _NEAR_DATA
+#endif
+
 #endif /* _ANSIDECL_H_ */
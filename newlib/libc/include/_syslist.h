@@ -24,6 +24,7 @@
 #define _unlink unlink
 #define _wait wait
 #define _write write
+#define _writev writev
 #endif /* MISSING_SYSCALL_NAMES */
 
 #if defined MISSING_SYSCALL_NAMES || !defined HAVE_OPENDIR
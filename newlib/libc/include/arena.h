@@ -0,0 +1,75 @@
+/* arena.h -- scoped bump allocation with mark and release.  */
+
+#ifndef _INCLUDE_ARENA_H_
+#define _INCLUDE_ARENA_H_
+
+#include <_ansi.h>
+#include <stdint.h>
+
+#define __need_size_t
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Alignment of every block in an arena.  */
+#ifdef __BIGGEST_ALIGNMENT__
+#define ARENA_ALIGN	__BIGGEST_ALIGNMENT__
+#else
+#define ARENA_ALIGN	(2 * sizeof (void *))
+#endif
+
+/* An arena hands out blocks of a caller supplied buffer in order.
+   Each block is preceded by its size so that realloc can copy it;
+   freeing the most recent block gives its space back, anything else
+   is only reclaimed by arena_release or arena_reset.  The members are
+   private to arena.c and nano-mallocr.c.  */
+
+typedef struct _arena {
+  struct _arena *_next;	/* next arena known to free */
+  char *_start;
+  char *_ptr;		/* first unused byte */
+  char *_end;
+} arena_t;
+
+typedef char *arena_mark_t;
+
+/* Set up an arena over BUF.  With nano-malloc the arena is also made
+   known to free, so that blocks obtained through malloc while it was
+   in use can be passed to free at any time until arena_destroy.  */
+extern void arena_create (arena_t *, void *, size_t);
+extern void arena_destroy (arena_t *);
+
+extern void *arena_alloc (arena_t *, size_t);
+extern arena_mark_t arena_mark (arena_t *);
+extern void arena_release (arena_t *, arena_mark_t);
+extern void arena_reset (arena_t *);
+
+/* Make malloc, and so every allocation libc makes on behalf of the
+   calling thread, take its memory from the arena until the previous
+   setting, which is returned, is restored.  NULL selects the heap.
+   Requests the arena cannot satisfy still go to the heap.  Only
+   available with nano-malloc.  */
+extern arena_t *arena_use (arena_t *);
+
+/* Bump allocate S bytes aligned to ALIGN, a power of two no smaller
+   than ARENA_ALIGN.  Shared by arena_alloc and malloc.  */
+static __inline__ void *
+__arena_bump (arena_t *__a, size_t __align, size_t __s)
+{
+  char *__p = (char *) (((uintptr_t) __a->_ptr + sizeof (size_t)
+			 + __align - 1) & ~(uintptr_t) (__align - 1));
+
+  if (__p > __a->_end || __s > (size_t) (__a->_end - __p))
+    return (void *) 0;
+  ((size_t *) __p)[-1] = __s;
+  __a->_ptr = __p + __s;
+  return __p;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INCLUDE_ARENA_H_ */
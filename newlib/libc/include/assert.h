@@ -10,7 +10,17 @@ extern "C" {
 
 #undef assert
 
-#ifdef NDEBUG           /* required by ANSI standard */
+/* With ASSERT_COMPACT, assert stays enabled even under NDEBUG, but
+   keeps no strings: a failure passes ASSERT_FILE_ID, a 16-bit number
+   the build gives each source file, and the line to __assert_id.  See
+   libc/stdlib/assertid.py for the numbering and for decoding what the
+   default __assert_id logs.  */
+#ifdef ASSERT_COMPACT
+# ifndef ASSERT_FILE_ID
+#  define ASSERT_FILE_ID 0
+# endif
+# define assert(__e) ((__e) ? (void)0 : __assert_id (ASSERT_FILE_ID, __LINE__))
+#elif defined NDEBUG    /* required by ANSI standard */
 # define assert(__e) ((void)0)
 #else
 # define assert(__e) ((__e) ? (void)0 : __assert_func (__FILE__, __LINE__, \
@@ -40,6 +50,8 @@ void __assert (const char *, int, const char *)
 	    _ATTRIBUTE ((__noreturn__));
 void __assert_func (const char *, int, const char *, const char *)
 	    _ATTRIBUTE ((__noreturn__));
+void __assert_id (unsigned int, unsigned int)
+	    _ATTRIBUTE ((__noreturn__));
 
 #if __STDC_VERSION__ >= 201112L && !defined __cplusplus
 # define static_assert _Static_assert
@@ -0,0 +1,54 @@
+/* blog.h -- deferred binary logging.  */
+
+#ifndef _INCLUDE_BLOG_H_
+#define _INCLUDE_BLOG_H_
+
+#include <_ansi.h>
+#include <stddef.h>
+#include <stdarg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* blog_printf takes a printf format and arguments but formats
+   nothing: it stores the address of the format and the bytes of the
+   arguments as one record in a ring buffer, and a host program turns
+   the records back into text with the formats from the executable
+   (newlib/libc/stdio/blogdecode.py).  The format must therefore be a
+   string that stays where it is for the life of the program, such as
+   a literal.
+
+   A record is one byte giving the length of the rest, the address of
+   the format, then for each conversion its argument as it was passed:
+   an int or a long for the integer conversions and %c, a pointer for
+   %p, a double for %e, %f and %g, and the bytes and NUL of the string
+   for %s, cut to the precision and to the room left in the record.
+   A `*' width or precision stores its int.  %n and %% store nothing.
+   The fixed-point conversions are not supported.
+
+   When a record does not fit in what is left of the ring, it is
+   dropped and counted in blog_dropped.  Records are added and read
+   under a lock, so blog_printf may not be called from an interrupt
+   handler unless the locks are made to mask interrupts.  */
+
+/* Log into SIZE bytes at BUF, discarding what was logged before.  */
+extern void blog_init (void *, size_t);
+
+/* Returns the size of the record, or -1 if it was dropped.  */
+extern int blog_printf (const char *, ...);
+extern int vblog_printf (const char *, va_list);
+
+/* Move up to N of the oldest logged bytes to BUF, for sending to the
+   host, and return how many there were.  Records may be split across
+   calls.  */
+extern size_t blog_read (void *, size_t);
+
+/* Records dropped for want of room.  */
+extern unsigned long blog_dropped;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INCLUDE_BLOG_H_ */
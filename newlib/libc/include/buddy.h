@@ -0,0 +1,63 @@
+/* buddy.h -- power-of-two blocks aligned to their size.  */
+
+#ifndef _INCLUDE_BUDDY_H_
+#define _INCLUDE_BUDDY_H_
+
+#include <_ansi.h>
+
+#define __need_size_t
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of smallest blocks a buddy allocator is split into.  */
+#define BUDDY_UNITS	32
+#define BUDDY_ORDERS	6	/* log2 (BUDDY_UNITS) + 1 */
+
+/* A buddy allocator takes the biggest power of two block of a caller
+   supplied buffer that is aligned to its own size, and hands out
+   blocks of a power of two number of units, each aligned to its size.
+   That is the alignment of modulo addressed buffers and of most DMA
+   descriptors, and the rounding never costs more than the block's
+   own size.  Freed blocks merge with their buddy again.  Nothing is
+   stored in an allocated block.  The members are private to buddy.c
+   and nano-mallocr.c.  */
+
+typedef struct buddy {
+  struct buddy *_next;	/* next registered allocator */
+  char *_base;		/* first byte, aligned to the whole size */
+  unsigned char _shift;	/* log2 of the unit size */
+  unsigned char _top;	/* order of the whole block */
+  void *_free[BUDDY_ORDERS];	/* free blocks by order */
+  unsigned char _map[BUDDY_UNITS];	/* order and state by unit */
+} buddy_t;
+
+/* Set up over BUF.  Returns the bytes managed, which is zero if BUF
+   cannot hold the smallest allocator.  */
+extern size_t buddy_init (buddy_t *, void *, size_t);
+
+/* A block of at least SIZE bytes aligned to ALIGN, a power of two,
+   or NULL.  */
+extern void *buddy_alloc (buddy_t *, size_t, size_t);
+extern void buddy_free (buddy_t *, void *);
+
+/* Nonzero if the pointer lies in the allocator's memory.  */
+extern int buddy_owns (const buddy_t *, const void *);
+
+/* The size of the block at the pointer.  */
+extern size_t buddy_size (const buddy_t *, const void *);
+
+/* Once registered, nano-malloc's memalign, aligned_alloc and
+   posix_memalign serve alignments of at least MALLOC_BUDDY_ALIGN
+   from the allocator, and free, realloc and malloc_usable_size
+   recognise its blocks.  */
+extern int buddy_register (buddy_t *);
+extern void buddy_unregister (buddy_t *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INCLUDE_BUDDY_H_ */
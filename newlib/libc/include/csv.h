@@ -0,0 +1,40 @@
+/* csv.h -- parsing the fields of comma-separated records.  */
+
+#ifndef _INCLUDE_CSV_H_
+#define _INCLUDE_CSV_H_
+
+#include <_ansi.h>
+#include <machine/_default_types.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Where csv_next_i32, csv_next_f32 and csv_next_str are in a record.
+   After the last field of a record P points at the next record, past
+   its "\n" or "\r\n", or at the terminating null.  */
+struct csv_cursor
+{
+  const char *p;
+  int sep;
+  int done;
+};
+
+/* The results of the csv_next functions besides 0 and lengths; each
+   but CSV_END steps over the field.  */
+#define CSV_END		(-1)	/* no field left in the record */
+#define CSV_EMPTY	(-2)	/* a number was expected and none given */
+#define CSV_SYNTAX	(-3)	/* not a number, or a quote not closed */
+#define CSV_RANGE	(-4)	/* the number does not fit */
+
+extern void csv_init (struct csv_cursor *, const char *, int);
+extern int csv_next_i32 (struct csv_cursor *, __int32_t *);
+extern int csv_next_f32 (struct csv_cursor *, float *);
+extern int csv_next_str (struct csv_cursor *, char *, size_t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INCLUDE_CSV_H_ */
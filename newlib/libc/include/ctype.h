@@ -66,8 +66,16 @@ extern int toascii_l (int __c, locale_t __l);
 #define _X	0100
 #define	_B	0200
 
+/* On pic30 the class tables are kept in program memory and read
+   through the PSV window, so they take no RAM.  */
+#ifdef __dsPIC30__
+#define __CTYPE_TABLE	__attribute__ ((space (auto_psv)))
+#else
+#define __CTYPE_TABLE
+#endif
+
 /* For C++ backward-compatibility only.  */
-extern	__IMPORT const char	_ctype_[];
+extern	__IMPORT const char	_ctype_[] __CTYPE_TABLE;
 
 #ifdef __HAVE_LOCALE_INFO__
 const char *__locale_ctype_ptr (void);
@@ -89,16 +97,28 @@ const char *__locale_ctype_ptr (void);
    an out-of-bounds reference on a 64-bit machine.  */
 #define __ctype_lookup(__c) ((__CTYPE_PTR+sizeof(""[__c]))[(int)(__c)])
 
+#ifdef _WANT_C_LOCALE_CTYPE
+/* With only the C locale, the classes that are one run of ASCII are
+   each a single unsigned compare, which also leaves EOF and 128..255
+   outside.  */
+#define	isalpha(__c)	((((unsigned)(__c)|040)-'a')<26)
+#define	isupper(__c)	(((unsigned)(__c)-'A')<26)
+#define	islower(__c)	(((unsigned)(__c)-'a')<26)
+#define	isdigit(__c)	(((unsigned)(__c)-'0')<10)
+#define isprint(__c)	(((unsigned)(__c)-' ')<95)
+#define	isgraph(__c)	(((unsigned)(__c)-'!')<94)
+#else
 #define	isalpha(__c)	(__ctype_lookup(__c)&(_U|_L))
 #define	isupper(__c)	((__ctype_lookup(__c)&(_U|_L))==_U)
 #define	islower(__c)	((__ctype_lookup(__c)&(_U|_L))==_L)
 #define	isdigit(__c)	(__ctype_lookup(__c)&_N)
+#define isprint(__c)	(__ctype_lookup(__c)&(_P|_U|_L|_N|_B))
+#define	isgraph(__c)	(__ctype_lookup(__c)&(_P|_U|_L|_N))
+#endif
 #define	isxdigit(__c)	(__ctype_lookup(__c)&(_X|_N))
 #define	isspace(__c)	(__ctype_lookup(__c)&_S)
 #define ispunct(__c)	(__ctype_lookup(__c)&_P)
 #define isalnum(__c)	(__ctype_lookup(__c)&(_U|_L|_N))
-#define isprint(__c)	(__ctype_lookup(__c)&(_P|_U|_L|_N|_B))
-#define	isgraph(__c)	(__ctype_lookup(__c)&(_P|_U|_L|_N))
 #define iscntrl(__c)	(__ctype_lookup(__c)&_C)
 
 #if defined(__GNUC__) && __ISO_C_VISIBLE >= 1999
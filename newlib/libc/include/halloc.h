@@ -0,0 +1,52 @@
+/* halloc.h -- relocatable blocks reached through handles.  */
+
+#ifndef _INCLUDE_HALLOC_H_
+#define _INCLUDE_HALLOC_H_
+
+#include <_ansi.h>
+
+#define __need_size_t
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Alignment of every block.  */
+#ifdef __BIGGEST_ALIGNMENT__
+#define HALLOC_ALIGN	__BIGGEST_ALIGNMENT__
+#else
+#define HALLOC_ALIGN	(2 * sizeof (void *))
+#endif
+
+/* A handle names a block that may move.  The blocks live together in
+   a single zone, itself one chunk of the malloc heap, and hcompact
+   slides the unlocked ones down over the gaps so that the free space
+   is in one piece at the top, where the zone can give it back to the
+   heap.  A handle stays valid until hfree; the address of the block
+   is only valid between hlock and the matching hunlock, and *H must
+   not be kept across a call that can move blocks.  */
+
+typedef void **handle_t;
+
+/* Allocate a block of SIZE bytes and return its handle, or NULL and
+   ENOMEM if even after compaction there is no room.  */
+extern handle_t halloc (size_t);
+extern void hfree (handle_t);
+
+/* Pin the block of H and return its address.  Locks nest.  */
+extern void *hlock (handle_t);
+extern void hunlock (handle_t);
+
+extern size_t hsize (handle_t);
+
+/* Slide every unlocked block down and trim the zone.  Meant to be
+   called while the device is idle; returns the largest block that
+   halloc could then hand out without growing the zone.  */
+extern size_t hcompact (void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INCLUDE_HALLOC_H_ */
@@ -0,0 +1,36 @@
+/* isr_printf.h -- formatting from interrupt and fault handlers.  */
+
+#ifndef _INCLUDE_ISR_PRINTF_H_
+#define _INCLUDE_ISR_PRINTF_H_
+
+#include <_ansi.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* snprintf and vsnprintf for a handler that may have interrupted the
+   library anywhere.  They take no lock, touch no reent structure,
+   never set errno or allocate, and need only a fixed amount of stack,
+   so they can run at any priority, even while another snprintf is
+   half done.
+
+   Only the integer, string and character conversions of the nano
+   formatted I/O are printed: c, s, d, i, u, o, x, X, p, n and %%,
+   with the flags, width, precision and h, l modifiers.  A floating or
+   fixed-point conversion takes its argument and prints nothing.  The
+   output is cut to SIZE - 1 characters and terminated, and the return
+   value is the length it would have had, as for snprintf, or -1 if
+   SIZE is above INT_MAX.  Only the nano formatted I/O provides
+   them.  */
+extern int isr_snprintf (char *, size_t, const char *, ...)
+	_ATTRIBUTE ((__format__ (__printf__, 3, 4)));
+extern int isr_vsnprintf (char *, size_t, const char *, __VALIST)
+	_ATTRIBUTE ((__format__ (__printf__, 3, 0)));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INCLUDE_ISR_PRINTF_H_ */
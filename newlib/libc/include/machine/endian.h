@@ -20,6 +20,7 @@
 #define	BYTE_ORDER	_BYTE_ORDER
 #endif
 
+#ifndef __machine_bswap_defined
 #ifdef __GNUC__
 #define	__bswap16(_x)	__builtin_bswap16(_x)
 #define	__bswap32(_x)	__builtin_bswap32(_x)
@@ -51,6 +52,7 @@ __bswap64(__uint64_t _x)
 	    ((_x << 40) & ((__uint64_t)0xff << 48)) | ((_x << 56))));
 }
 #endif /* !__GNUC__ */
+#endif /* __machine_bswap_defined */
 
 #ifndef __machine_host_to_from_network_defined
 #if _BYTE_ORDER == _LITTLE_ENDIAN
@@ -490,6 +490,11 @@
 #ifdef __dsPIC30__
 #define __IEEE_LITTLE_ENDIAN
 #define __SMALL_BITFIELDS	/* 16 Bit INT */
+/* double is 32 bits unless -fno-short-double is given.  libm then
+   builds the double functions as wrappers of the float ones.  */
+#if __SIZEOF_DOUBLE__ == 4
+#define _DOUBLE_IS_32BITS
+#endif
 #endif
 
 #ifdef __CYGWIN__
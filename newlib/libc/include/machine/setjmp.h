@@ -329,7 +329,8 @@ _BEGIN_STD_C
 #endif
 
 #ifdef __dsPIC30__
-#define _JBLEN 22
+/* w8-w14, sp, pc<15:0>, pc<22:16>, CORCON */
+#define _JBLEN 11
 #define _JBTYPE unsigned int
 #endif
 
@@ -133,6 +133,112 @@ extern int malloc_trim (size_t);
 extern int _malloc_trim_r (struct _reent *, size_t);
 #endif
 
+/* Additional heap regions, nano-malloc only.  Region 0 is the sbrk
+   heap; <machine/malloc.h> may name the others.  */
+
+#ifndef MALLOC_REGIONS
+#define MALLOC_REGIONS 4
+#endif
+
+extern int malloc_region_add (int, void *, size_t);
+extern void *malloc_region (int, size_t);
+extern void *_malloc_region_r (struct _reent *, int, size_t);
+
+/* Alignments from MALLOC_BUDDY_ALIGN up are served by the buddy
+   allocators of <buddy.h>, nano-malloc only.  If MALLOC_BUDDY_SIZE is
+   not 0 and none is registered or none has room, memalign sets one
+   up over MALLOC_BUDDY_SIZE bytes of the heap, once; those bytes stay
+   taken for good, however little of them is used.  The default of 0
+   leaves the heap alone and aligns by padding instead.  */
+
+#ifndef MALLOC_BUDDY_ALIGN
+#define MALLOC_BUDDY_ALIGN 32
+#endif
+#ifndef MALLOC_BUDDY_SIZE
+#define MALLOC_BUDDY_SIZE 0
+#endif
+
+/* Heap counters, nano-malloc only.  malloc and free keep them up to
+   date, so reading them costs nothing.  They describe the sbrk heap;
+   regions, pools and arenas are not included.  Free chunk class I of
+   the histograms holds sizes from MALLOC_HIST_MIN << I up, the last
+   class everything bigger.  1 - largest_free / free is a measure of
+   fragmentation.  */
+
+#define MALLOC_HIST_MIN 16
+#define MALLOC_HIST_BINS 8
+
+struct mallcounters {
+  size_t peak;          /* most space ever obtained from sbrk */
+  size_t live;          /* bytes in allocated chunks, headers included */
+  size_t live_peak;     /* highest value of live */
+  size_t free;          /* bytes in free chunks */
+  size_t largest_free;  /* size of the biggest free chunk */
+  size_t nfree[MALLOC_HIST_BINS];  /* free chunks by size */
+  size_t nfail[MALLOC_HIST_BINS];  /* failed requests by size */
+};
+
+extern const struct mallcounters *malloc_counters (void);
+
+/* Nonzero once the startup code has cleared all the memory sbrk is
+   going to hand out, as the pic30 crt0 does when the program defines
+   __heap_clear.  nano-malloc's calloc then does not clear memory
+   that has never been allocated.  */
+
+extern char __malloc_sbrk_zeroed;
+
+/* Allocation trace, nano-malloc built with NANO_MALLOC_TRACE only.
+   malloc, free and realloc record each call in a ring of the last
+   MALLOC_TRACE_SIZE events, a power of two.  A realloc is two events,
+   the block given and the block returned.  The time is that of
+   __malloc_trace_clock, which returns 0 unless the program defines it
+   to read a free-running timer; it is called with the malloc lock
+   held.  malloc_trace returns the ring and stores the number of
+   events ever recorded, event N being at N % MALLOC_TRACE_SIZE.
+   malloc_trace_dump prints the ring to stderr, oldest first, for
+   libc/stdlib/malltrace.py.  */
+
+#ifndef MALLOC_TRACE_SIZE
+#define MALLOC_TRACE_SIZE 64
+#endif
+
+#define MALLOC_TRACE_MALLOC	1
+#define MALLOC_TRACE_FREE	2
+#define MALLOC_TRACE_REALLOC_FROM 3
+#define MALLOC_TRACE_REALLOC	4
+
+struct malltrace {
+  unsigned char op;     /* MALLOC_TRACE_* */
+  void *ptr;            /* block, NULL for a failed request */
+  size_t size;          /* bytes requested, 0 for a free */
+  void *caller;         /* return address of the call */
+  unsigned long time;   /* __malloc_trace_clock */
+};
+
+extern const struct malltrace *malloc_trace (unsigned long *);
+extern void malloc_trace_dump (void);
+extern unsigned long __malloc_trace_clock (void);
+
+/* Per-thread heap accounting and limits, nano-malloc built with
+   NANO_MALLOC_QUOTAS only.  While a quota is in use by a thread, the
+   heap chunks its malloc, realloc and memalign hand out are charged
+   to it, headers included, so current and peak say how much of the
+   sbrk heap the thread holds and has held.  A request that would take
+   current past a nonzero limit fails with ENOMEM instead.  Each chunk
+   records its quota in its header, at the cost of a pointer per
+   chunk, so whichever thread frees it or resizes it, the quota it was
+   charged to is the one credited.  Regions, pools and arenas are not
+   charged.  malloc_quota_use returns the previous setting; NULL stops
+   the accounting.  */
+
+typedef struct _mallquota {
+  size_t current;       /* bytes in chunks charged, less those freed */
+  size_t peak;          /* highest value of current */
+  size_t limit;         /* most current may reach, 0 for no limit */
+} mallquota_t;
+
+extern mallquota_t *malloc_quota_use (mallquota_t *);
+
 extern void __malloc_lock(struct _reent *);
 
 extern void __malloc_unlock(struct _reent *);
@@ -160,6 +266,16 @@ extern void _mstats_r (struct _reent *, char *);
 #define M_TOP_PAD           -2
 #define M_MMAP_THRESHOLD    -3 
 #define M_MMAP_MAX          -4
+#define M_POLICY            -5   /* nano-malloc only */
+
+/* M_POLICY values: the free chunk nano-malloc takes for a request.
+   Best fit wastes the least and suits long-lived blocks; next fit
+   goes on from where the last request was placed and suits blocks
+   freed in the order they were allocated.  */
+
+#define M_POLICY_FIRST_FIT  0
+#define M_POLICY_BEST_FIT   1
+#define M_POLICY_NEXT_FIT   2
 
 #ifndef __CYGWIN__
 /* Some systems provide this, so do too for compatibility.  */
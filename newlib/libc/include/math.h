@@ -217,7 +217,100 @@ extern int __signbitd (double);
  *       taking double arguments still exist for compatibility purposes
  *       (prototypes for them are earlier in this header).  */
 
-#if __GNUC_PREREQ (4, 4)
+#ifdef __dsPIC30__
+/* pic30 has no FPU, so the classification builtins become calls of the
+   soft-float compare routines.  A float, and a double while it is 32
+   bits wide, is classified from its two words instead: the high one
+   holds the sign, the exponent and the top of the mantissa.  Wider
+   types still go to the builtins.  */
+typedef union { float __f; unsigned short __w[2]; } __pic30_float_t;
+
+static __inline__ unsigned short
+__pic30_fhi (float __x)
+{
+  __pic30_float_t __u;
+
+  __u.__f = __x;
+  return __u.__w[1];
+}
+
+static __inline__ unsigned short
+__pic30_flo (float __x)
+{
+  __pic30_float_t __u;
+
+  __u.__f = __x;
+  return __u.__w[0];
+}
+
+static __inline__ int
+__pic30_fpclassifyf (float __x)
+{
+  unsigned short __hi = __pic30_fhi (__x) & 0x7fff;
+
+  if (__hi >= 0x7f80)
+    return (__hi != 0x7f80 || __pic30_flo (__x)) ? FP_NAN : FP_INFINITE;
+  if (__hi >= 0x0080)
+    return FP_NORMAL;
+  return (__hi | __pic30_flo (__x)) ? FP_SUBNORMAL : FP_ZERO;
+}
+
+static __inline__ int
+__pic30_isfinitef (float __x)
+{
+  return (__pic30_fhi (__x) & 0x7f80) != 0x7f80;
+}
+
+static __inline__ int
+__pic30_isinff (float __x)
+{
+  unsigned short __hi = __pic30_fhi (__x);
+
+  if ((__hi & 0x7fff) != 0x7f80 || __pic30_flo (__x))
+    return 0;
+  return (__hi & 0x8000) ? -1 : 1;
+}
+
+static __inline__ int
+__pic30_isnanf (float __x)
+{
+  unsigned short __hi = __pic30_fhi (__x) & 0x7fff;
+
+  return __hi > 0x7f80 || (__hi == 0x7f80 && __pic30_flo (__x));
+}
+
+static __inline__ int
+__pic30_isnormalf (float __x)
+{
+  unsigned short __exp = __pic30_fhi (__x) & 0x7f80;
+
+  return __exp != 0 && __exp != 0x7f80;
+}
+
+static __inline__ int
+__pic30_signbitf (float __x)
+{
+  return __pic30_fhi (__x) >> 15;
+}
+
+#define __PIC30_CLASSIFY(__x, __f, __b) \
+	((sizeof(__x) == sizeof(float)) ? __pic30_##__f##f(__x) : __b(__x))
+
+  #define fpclassify(__x) \
+	  ((sizeof(__x) == sizeof(float)) ? __pic30_fpclassifyf(__x) : \
+	   __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, \
+				 FP_SUBNORMAL, FP_ZERO, __x))
+  #ifndef isfinite
+    #define isfinite(__x) __PIC30_CLASSIFY(__x, isfinite, __builtin_isfinite)
+  #endif
+  #ifndef isinf
+    #define isinf(__x) __PIC30_CLASSIFY(__x, isinf, __builtin_isinf_sign)
+  #endif
+  #ifndef isnan
+    #define isnan(__x) __PIC30_CLASSIFY(__x, isnan, __builtin_isnan)
+  #endif
+  #define isnormal(__x) __PIC30_CLASSIFY(__x, isnormal, __builtin_isnormal)
+#elif __GNUC_PREREQ (4, 4)
   #define fpclassify(__x) (__builtin_fpclassify (FP_NAN, FP_INFINITE, \
 						 FP_NORMAL, FP_SUBNORMAL, \
 						 FP_ZERO, __x))
@@ -249,7 +342,16 @@ extern int __signbitd (double);
   #define isnormal(__x) (fpclassify(__x) == FP_NORMAL)
 #endif
 
-#if __GNUC_PREREQ (4, 0)
+#if defined (__dsPIC30__)
+  #if defined(_HAVE_LONG_DOUBLE)
+    #define signbit(__x) \
+	    ((sizeof(__x) == sizeof(float))  ? __pic30_signbitf(__x) : \
+	     (sizeof(__x) == sizeof(double)) ? __builtin_signbit (__x) : \
+					       __builtin_signbitl(__x))
+  #else
+    #define signbit(__x) __PIC30_CLASSIFY(__x, signbit, __builtin_signbit)
+  #endif
+#elif __GNUC_PREREQ (4, 0)
   #if defined(_HAVE_LONG_DOUBLE)
     #define signbit(__x) \
 	    ((sizeof(__x) == sizeof(float))  ? __builtin_signbitf(__x) : \
@@ -568,6 +670,12 @@ extern float pow10l (float);
 #endif /* __CYGWIN__ */
 #endif /* __GNU_VISIBLE */
 
+#if __MISC_VISIBLE
+/* Newlib extensions: x to an integer power by repeated squaring.  */
+extern double powi (double, int);
+extern float powif (float, int);
+#endif /* __MISC_VISIBLE */
+
 #if __MISC_VISIBLE || __XSI_VISIBLE
 /* The gamma functions use a global variable, signgam.  */
 #ifndef _REENT_ONLY
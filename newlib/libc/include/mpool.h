@@ -0,0 +1,57 @@
+/* mpool.h -- fixed-size block pools.  */
+
+#ifndef _INCLUDE_MPOOL_H_
+#define _INCLUDE_MPOOL_H_
+
+#include <_ansi.h>
+
+#define __need_size_t
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Alignment of every block in a pool.  */
+#ifdef __BIGGEST_ALIGNMENT__
+#define MPOOL_ALIGN	__BIGGEST_ALIGNMENT__
+#else
+#define MPOOL_ALIGN	(2 * sizeof (void *))
+#endif
+
+/* A pool carves a caller supplied buffer into blocks of one size and
+   keeps the free ones on an intrusive list, so alloc and free are a
+   pop and a push and blocks carry no header.  The members are private
+   to mpool.c and nano-mallocr.c.  */
+
+typedef struct mpool {
+  struct mpool *_next;	/* next registered pool, by block size */
+  void *_free;		/* first free block */
+  char *_start;		/* first block */
+  char *_end;		/* one past the last block */
+  size_t _size;		/* block size */
+  size_t _nfree;	/* number of free blocks */
+} mpool_t;
+
+/* Carve BUF into blocks of at least SIZE bytes.  Returns the number of
+   blocks, which is zero if BUF cannot hold a single one.  */
+extern size_t mpool_init (mpool_t *, void *, size_t, size_t);
+
+extern void *mpool_alloc (mpool_t *);
+extern void mpool_free (mpool_t *, void *);
+
+/* Nonzero if the pointer is a block of the pool.  */
+extern int mpool_owns (const mpool_t *, const void *);
+
+/* Once registered, malloc serves requests that fit in a block from the
+   pool with the smallest blocks that has one free, and free and
+   realloc recognise the blocks.  Only available with nano-malloc.  A
+   pool must not be unregistered while malloc'ed blocks are live.  */
+extern int mpool_register (mpool_t *);
+extern void mpool_unregister (mpool_t *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INCLUDE_MPOOL_H_ */
@@ -40,6 +40,8 @@
 #ifndef _NDBM_H_
 #define	_NDBM_H_
 
+#include <sys/reent.h>	/* __FILE */
+
 /* #include <db.h> */
 
 /*
@@ -85,6 +87,9 @@ int	 dbm_store(DBM *, datum, datum, int);
 #if __BSD_VISIBLE
 int	 dbm_dirfno(DBM *);
 #endif
+#if __MISC_VISIBLE
+DBM	*dbm_fopen(__FILE *, int);
+#endif
 __END_DECLS
 
 #endif /* !_NDBM_H_ */
@@ -0,0 +1,61 @@
+/* printf_plan.h -- formats parsed once and printed many times.  */
+
+#ifndef _INCLUDE_PRINTF_PLAN_H_
+#define _INCLUDE_PRINTF_PLAN_H_
+
+#include <_ansi.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Room in a plan for the conversions of a format, plus one for the
+   text after the last of them.  */
+#ifndef PRINTF_PLAN_OPS
+#define PRINTF_PLAN_OPS	8
+#endif
+
+/* A plan is a format cut into steps, each printing a run of literal
+   text and then one conversion, so running it does none of the
+   parsing printf does on every call.  The literal text is not copied:
+   the format passed to printf_plan_compile must outlive the plan.
+   The members are private to the nano formatted I/O, which is the
+   only implementation of these functions.  */
+
+struct __printf_op {
+  const char *_lit;		/* text printed before the conversion */
+  unsigned short _litlen;
+  char _code;			/* conversion, '\0' after the last one */
+  char _sign;			/* '+', ' ' or '\0' */
+  char _float;			/* nonzero for e, f and g */
+  char _fixed;			/* nonzero for r, R, k and K */
+  int _flags;
+  int _width;
+  int _prec;
+};
+
+typedef struct {
+  int _nops;
+  struct __printf_op _ops[PRINTF_PLAN_OPS];
+} printf_plan_t;
+
+/* Cut FMT into PLAN.  Returns 0, or -1 and EINVAL if FMT has more
+   conversions than the plan has room for.  */
+extern int printf_plan_compile (printf_plan_t *, const char *);
+
+/* Print the arguments as vfprintf and snprintf would with the format
+   the plan was compiled from.  */
+extern int vfprintf_plan (FILE *, const printf_plan_t *, __VALIST);
+extern int snprintf_plan (char *, size_t, const printf_plan_t *, ...);
+
+extern int _vfprintf_plan_r (struct _reent *, FILE *,
+			     const printf_plan_t *, __VALIST);
+extern int _snprintf_plan_r (struct _reent *, char *, size_t,
+			     const printf_plan_t *, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INCLUDE_PRINTF_PLAN_H_ */
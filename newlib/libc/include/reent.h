@@ -101,6 +101,7 @@ extern "C" {
 struct stat;
 struct tms;
 struct timeval;
+struct iovec;
 struct timezone;
 
 #if defined(REENTRANT_SYSCALLS_PROVIDED) && defined(MISSING_SYSCALL_NAMES)
@@ -126,6 +127,7 @@ struct timezone;
 #define _wait_r(__reent, __status)                wait(__status)
 #define _write_r(__reent, __fd, __buff, __cnt)    write(__fd, __buff, __cnt)
 #define _gettimeofday_r(__reent, __tp, __tzp)     gettimeofday(__tp, __tzp)
+#define _writev_r(__reent, __fd, __iov, __cnt)    writev(__fd, __iov, __cnt)
 
 #ifdef __LARGE64_FILES
 #define _lseek64_r(__reent, __fd, __off, __w)     lseek64(__fd, __off, __w)
@@ -160,6 +162,10 @@ extern _ssize_t _write_r (struct _reent *, int, const void *, size_t);
 /* This one is not guaranteed to be available on all targets.  */
 extern int _gettimeofday_r (struct _reent *, struct timeval *__tp, void *__tzp);
 
+/* Nor this one; without a _writev from the system it fails with
+   ENOSYS.  */
+extern _ssize_t _writev_r (struct _reent *, int, const struct iovec *, int);
+
 #ifdef __LARGE64_FILES
 
 
@@ -62,6 +62,7 @@ typedef struct {
 #define	REG_NEWLINE	0010
 #define	REG_NOSPEC	0020
 #define	REG_PEND	0040
+#define	REG_DFA		0100
 #define	REG_DUMP	0200
 
 /* regerror() flags */
@@ -98,6 +99,10 @@ size_t	regerror(int, const regex_t *__restrict, char *__restrict, size_t);
 int	regexec(const regex_t *__restrict, const char *__restrict,
 			size_t, regmatch_t [__restrict], int);
 void	regfree(regex_t *);
+/* regexec in a workspace of at least regwssize bytes, without malloc */
+int	regexec_ws(const regex_t *__restrict, const char *__restrict,
+			size_t, regmatch_t [__restrict], int, void *, size_t);
+size_t	regwssize(const regex_t *);
 __END_DECLS
 
 #endif /* !_REGEX_H_ */
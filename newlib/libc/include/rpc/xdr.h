@@ -324,6 +324,9 @@ extern bool_t xdr_union (XDR *, enum_t *, char *,
 extern bool_t xdr_char (XDR *, char *);
 extern bool_t xdr_u_char (XDR *, u_char *);
 extern bool_t xdr_vector (XDR *, char *, u_int, u_int, xdrproc_t);
+extern bool_t xdr_int16_array (XDR *, int16_t *, u_int);
+extern bool_t xdr_int32_array (XDR *, int32_t *, u_int);
+extern bool_t xdr_float_array (XDR *, float *, u_int);
 extern bool_t xdr_float (XDR *, float *);
 extern bool_t xdr_double (XDR *, double *);
 /* extern bool_t xdr_quadruple (XDR *, long double *); */
@@ -0,0 +1,61 @@
+/* scanf_plan.h -- formats parsed once and scanned with many times.  */
+
+#ifndef _INCLUDE_SCANF_PLAN_H_
+#define _INCLUDE_SCANF_PLAN_H_
+
+#include <_ansi.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Room in a plan for the conversions of a format, plus one for the
+   directives after the last of them.  */
+#ifndef SCANF_PLAN_OPS
+#define SCANF_PLAN_OPS	8
+#endif
+
+/* A plan is a format cut into steps, each matching a run of literal
+   directives and then doing one conversion, so running it does none
+   of the parsing scanf does on every call.  Neither the directives nor
+   the set of a %[ are copied: the format passed to scanf_plan_compile
+   must outlive the plan.  The members are private to the nano
+   formatted I/O, which is the only implementation of these
+   functions.  */
+
+struct __scanf_op {
+  const char *_lit;		/* directives matched before the conversion */
+  unsigned short _litlen;
+  char _conv;			/* conversion, '\0' after the last one */
+  char _code;			/* class of the conversion */
+  char _base;
+  int _flags;
+  size_t _width;
+  const char *_ccl;		/* the set of a %[, after the '[' */
+};
+
+typedef struct {
+  int _nops;
+  struct __scanf_op _ops[SCANF_PLAN_OPS];
+} scanf_plan_t;
+
+/* Cut FMT into PLAN.  Returns 0, or -1 and EINVAL if FMT has more
+   conversions than the plan has room for or ends within one.  */
+extern int scanf_plan_compile (scanf_plan_t *, const char *);
+
+/* Scan as vfscanf and sscanf would with the format the plan was
+   compiled from.  */
+extern int vfscanf_plan (FILE *, const scanf_plan_t *, __VALIST);
+extern int sscanf_plan (const char *, const scanf_plan_t *, ...);
+
+extern int _vfscanf_plan_r (struct _reent *, FILE *,
+			    const scanf_plan_t *, __VALIST);
+extern int _sscanf_plan_r (struct _reent *, const char *,
+			   const scanf_plan_t *, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INCLUDE_SCANF_PLAN_H_ */
@@ -42,6 +42,20 @@ struct hsearch_data
   size_t htablesize;
 };
 
+/* Bytes of buffer that hcreate_static_r needs for a table of N slots.
+   It uses the largest power of two slots that fit, so N should be one;
+   the table then holds up to N entries.  */
+#define HSEARCH_STATIC_SIZE(n) ((n) * (sizeof (ENTRY) + sizeof (void *)))
+
+/* A node for tsearch_node, to be embedded in the caller's data.  It is
+   laid out like the nodes tsearch allocates, so tfind and twalk take
+   the trees built from it.  */
+struct tnode
+{
+  const void *key;
+  struct tnode *llink, *rlink;
+};
+
 #ifndef __compar_fn_t_defined
 #define __compar_fn_t_defined
 typedef int (*__compar_fn_t) (const void *, const void *);
@@ -52,12 +66,15 @@ int	 hcreate(size_t);
 void	 hdestroy(void);
 ENTRY	*hsearch(ENTRY, ACTION);
 int	 hcreate_r(size_t, struct hsearch_data *);
+int	 hcreate_static_r(void *, size_t, struct hsearch_data *);
 void	 hdestroy_r(struct hsearch_data *);
 int	hsearch_r(ENTRY, ACTION, ENTRY **, struct hsearch_data *);
 void	*tdelete(const void *__restrict, void **__restrict, __compar_fn_t);
 void	tdestroy (void *, void (*)(void *));
 void	*tfind(const void *, void **, __compar_fn_t);
 void	*tsearch(const void *, void **, __compar_fn_t);
+void	*tsearch_node(const void *, struct tnode *, void **, __compar_fn_t);
+void	*tdelete_node(const void *__restrict, void **__restrict, __compar_fn_t);
 void      twalk(const void *, void (*)(const void *, VISIT, int));
 __END_DECLS
 
@@ -58,6 +58,20 @@ __END_DECLS
     __builtin___ ## fun ## _chk(dst, src, __ssp_bos0(dst)) : \
     __ ## fun ## _ichk(dst, src))
 
+/* A constant length that fits is decided here and the plain function
+   called, whether or not the compiler folds __builtin___*_chk itself,
+   so a fixed-size copy costs no more than without _FORTIFY_SOURCE.  */
+#define __ssp_bos_fold3(fun, dst, src, len) \
+    ((__builtin_constant_p(len) && (len) <= __ssp_bos0(dst)) ? \
+    __builtin_ ## fun(dst, src, len) : \
+    __ssp_bos_check3(fun, dst, src, len))
+
+#define __ssp_bos_fold2(fun, dst, src) \
+    ((__builtin_constant_p(__builtin_strlen(src)) && \
+    __builtin_strlen(src) < __ssp_bos0(dst)) ? \
+    __builtin_ ## fun(dst, src) : \
+    __ssp_bos_check2(fun, dst, src))
+
 #define __ssp_bos_icheck3_restrict(fun, type1, type2) \
 __ssp_inline type1 __ ## fun ## _ichk(type1 __restrict, type2 __restrict, size_t); \
 __ssp_inline type1 \
@@ -94,19 +108,19 @@ __ssp_bos_icheck3_restrict(strncpy, char *, const char *)
 __ssp_bos_icheck3_restrict(strncat, char *, const char *)
 __END_DECLS
 
-#define memcpy(dst, src, len) __ssp_bos_check3(memcpy, dst, src, len)
-#define memmove(dst, src, len) __ssp_bos_check3(memmove, dst, src, len)
+#define memcpy(dst, src, len) __ssp_bos_fold3(memcpy, dst, src, len)
+#define memmove(dst, src, len) __ssp_bos_fold3(memmove, dst, src, len)
 #if __GNU_VISIBLE
-#define mempcpy(dst, src, len) __ssp_bos_check3(mempcpy, dst, src, len)
+#define mempcpy(dst, src, len) __ssp_bos_fold3(mempcpy, dst, src, len)
 #endif
-#define memset(dst, val, len) __ssp_bos_check3(memset, dst, val, len)
+#define memset(dst, val, len) __ssp_bos_fold3(memset, dst, val, len)
 #if __POSIX_VISIBLE >= 200809
-#define stpcpy(dst, src) __ssp_bos_check2(stpcpy, dst, src)
+#define stpcpy(dst, src) __ssp_bos_fold2(stpcpy, dst, src)
 #if __GNUC_PREREQ__(4,8) || defined(__clang__)
 #define stpncpy(dst, src, len) __ssp_bos_check3(stpncpy, dst, src, len)
 #endif
 #endif
-#define strcpy(dst, src) __ssp_bos_check2(strcpy, dst, src)
+#define strcpy(dst, src) __ssp_bos_fold2(strcpy, dst, src)
 #define strcat(dst, src) __ssp_bos_check2(strcat, dst, src)
 #define strncpy(dst, src, len) __ssp_bos_check3(strncpy, dst, src, len)
 #define strncat(dst, src, len) __ssp_bos_check3(strncat, dst, src, len)
@@ -644,6 +644,27 @@ FILE *fopencookie (void *__cookie,
 		const char *__mode, cookie_io_functions_t __functions);
 FILE *_fopencookie_r (struct _reent *, void *__cookie,
 		const char *__mode, cookie_io_functions_t __functions);
+
+/* A stream over a device read and written in blocks, see fblockopen.c.  */
+struct fblock_ops
+{
+  int (*read) (void *__dev, unsigned long __block, void *__buf,
+	       size_t __count);
+  int (*write) (void *__dev, unsigned long __block, const void *__buf);
+  int (*close) (void *__dev);
+};
+FILE *fblockopen (void *__dev, const struct fblock_ops *__ops,
+		size_t __block_size, off_t __size, const char *__mode);
+FILE *_fblockopen_r (struct _reent *, void *__dev,
+		const struct fblock_ops *__ops, size_t __block_size,
+		off_t __size, const char *__mode);
+
+/* A stream that overwrites its oldest data, see fmemopen_ring.c.  */
+FILE *fmemopen_ring (void *__buf, size_t __size);
+FILE *_fmemopen_ring_r (struct _reent *, void *__buf, size_t __size);
+size_t fmemring_read (const void *__buf, unsigned long *__cursor,
+		void *__out, size_t __n);
+unsigned long fmemring_tell (const void *__buf);
 #endif /* __GNU_VISIBLE */
 
 #ifndef __CUSTOM_FILE_IO__
@@ -767,6 +788,32 @@ _putchar_unlocked(int _c)
 #define	getchar_unlocked()	_getchar_unlocked()
 #define	putchar_unlocked(_c)	_putchar_unlocked(_c)
 #endif
+
+#ifdef _STDIO_DIRECT_CONSOLE
+/* getchar, putchar and puts call the console byte hooks of the BSP
+   instead of going through stdin and stdout, so they neither buffer
+   nor lock.  Bytes still waiting in the buffer of stdout are not
+   written first: make stdout unbuffered where the two are mixed.  The
+   hooks return the byte, as an unsigned char, or EOF.  This is for
+   program code; the library itself is built without it.  */
+int	__console_getc (void);
+int	__console_putc (int);
+
+static __inline int
+_puts_direct(const char *_s)
+{
+	while (*_s)
+		if (__console_putc((unsigned char) *_s++) == EOF)
+			return (EOF);
+	return (__console_putc('\n'));
+}
+
+#undef	getchar
+#undef	putchar
+#define	getchar()	__console_getc()
+#define	putchar(_c)	__console_putc(_c)
+#define	puts(_s)	_puts_direct(_s)
+#endif /* _STDIO_DIRECT_CONSOLE */
 #endif /* __cplusplus */
 
 #if __MISC_VISIBLE
@@ -21,6 +21,12 @@ _BEGIN_STD_C
 
 void	 __fpurge (FILE *);
 int	 __fsetlocking (FILE *, int);
+const char *__fpeek (FILE *, size_t *);
+const char *_fpeek_r (struct _reent *, FILE *, size_t *);
+void	 __fconsume (FILE *, size_t);
+#ifdef _STDIO_STATS
+const struct __sFILE_stats *__fstats (FILE *);
+#endif
 
 /* TODO:
 
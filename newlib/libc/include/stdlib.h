@@ -64,7 +64,11 @@ typedef int (*__compar_fn_t) (const void *, const void *);
 
 int	__locale_mb_cur_max (void);
 
+#ifdef _WANT_C_LOCALE_ONLY
+#define MB_CUR_MAX ((size_t) 1)
+#else
 #define MB_CUR_MAX __locale_mb_cur_max()
+#endif
 
 void	abort (void) _ATTRIBUTE ((__noreturn__));
 int	abs (int);
@@ -73,6 +77,10 @@ __uint32_t arc4random (void);
 __uint32_t arc4random_uniform (__uint32_t);
 void    arc4random_buf (void *, size_t);
 #endif
+#if __MISC_VISIBLE
+__uint32_t xorshift32 (__uint32_t *);
+__uint16_t pcg16 (__uint32_t *);
+#endif
 int	atexit (void (*__func)(void));
 double	atof (const char *__nptr);
 #if __MISC_VISIBLE
@@ -317,6 +325,36 @@ void	__bsd_qsort_r (void *__base, size_t __nmemb, size_t __size, void *__thunk,
 # endif
 #endif
 
+#if __MISC_VISIBLE
+void	qsort_i16 (__int16_t *__base, size_t __nmemb);
+void	qsort_u16 (__uint16_t *__base, size_t __nmemb);
+void	qsort_i32 (__int32_t *__base, size_t __nmemb);
+void	qsort_f32 (float *__base, size_t __nmemb);
+void	mergesort_r (void *__base, size_t __nmemb, size_t __size,
+		     int (*_compar)(const void *, const void *, void *),
+		     void *__thunk, void *__scratch);
+const __uint16_t *bsearch_u16 (__uint16_t __key, const __uint16_t *__base,
+			       size_t __nmemb);
+const __uint32_t *bsearch_u32 (__uint32_t __key, const __uint32_t *__base,
+			       size_t __nmemb);
+void	eytzinger_u16 (__uint16_t *__tree, const __uint16_t *__sorted,
+		       size_t __nmemb);
+void	eytzinger_u32 (__uint32_t *__tree, const __uint32_t *__sorted,
+		       size_t __nmemb);
+const __uint16_t *bsearch_eytzinger_u16 (__uint16_t __key,
+					 const __uint16_t *__tree,
+					 size_t __nmemb);
+const __uint32_t *bsearch_eytzinger_u32 (__uint32_t __key,
+					 const __uint32_t *__tree,
+					 size_t __nmemb);
+__int16_t strtoi16 (const char *__restrict __n, char **__restrict __end_PTR,
+		   int __base);
+__uint16_t strtou16 (const char *__restrict __n, char **__restrict __end_PTR,
+		     int __base);
+__uint32_t strtou32 (const char *__restrict __n, char **__restrict __end_PTR,
+		     int __base);
+#endif
+
 /* On platforms where long double equals double.  */
 #ifdef _HAVE_LONG_DOUBLE
 extern long double _strtold_r (struct _reent *, const char *__restrict, char **__restrict);
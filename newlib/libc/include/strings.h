@@ -59,6 +59,13 @@ int	 ffsll(long long) __pure2;
 int	 fls(int) __pure2;
 int	 flsl(long) __pure2;
 int	 flsll(long long) __pure2;
+/* Defined for 0, which gives the width of the argument.  */
+unsigned int	 clz16(__uint16_t) __pure2;
+unsigned int	 clz32(__uint32_t) __pure2;
+unsigned int	 ctz16(__uint16_t) __pure2;
+unsigned int	 ctz32(__uint32_t) __pure2;
+unsigned int	 popcount16(__uint16_t) __pure2;
+unsigned int	 popcount32(__uint32_t) __pure2;
 #endif
 #if __BSD_VISIBLE || __POSIX_VISIBLE <= 200112
 char	*index(const char *, int) __pure;			/* LEGACY */
@@ -181,7 +181,11 @@ typedef void *_iconv_t;
 
 typedef	_CLOCK_T_	__clock_t;
 
-#if defined(_USE_LONG_TIME_T) || __LONG_MAX__ > 0x7fffffffL
+/* An unsigned 32-bit time_t runs from 1970 to 7th February 2106, and
+   keeps the time functions of a 16-bit target on 32-bit arithmetic.  */
+#if defined(_USE_UNSIGNED_TIME_T) && __LONG_MAX__ == 0x7fffffffL
+#define	_TIME_T_ unsigned long
+#elif defined(_USE_LONG_TIME_T) || __LONG_MAX__ > 0x7fffffffL
 #define	_TIME_T_ long
 #else
 #define	_TIME_T_ __int_least64_t
@@ -173,7 +173,14 @@
 #define MALLOC_ALIGNMENT 2
 #define _POINTER_INT int
 #define __BUFSIZ__ 16
+#define __FOPEN_MAX__ 8
 #define _REENT_SMALL
+/* stdin, stdout and stderr are shared and set up at link time, so no
+   stdio call has to run __sinit first.  See stdio/findfp.c.  */
+#define _REENT_GLOBAL_STDIO_STREAMS
+#define _REENT_STATIC_STD_STREAMS
+/* In near RAM, so that _REENT is a single load */
+#define __ATTRIBUTE_IMPURE_PTR__ __attribute__ ((__near__))
 #endif
 
 #ifdef __m32c__
@@ -301,6 +308,28 @@
 #endif
 #endif
 
+#ifdef _WANT_USE_UNSIGNED_TIME_T
+#ifndef _USE_UNSIGNED_TIME_T
+#define _USE_UNSIGNED_TIME_T
+#endif
+#endif
+
+/* The compact FILE is only laid out for the small reent, and the 64-bit
+   FILE has no compact form.  */
+#ifdef _STDIO_COMPACT_FILE
+#if !defined(_REENT_SMALL) || defined(__LARGE64_FILES)
+#undef _STDIO_COMPACT_FILE
+#endif
+#endif
+
+/* Static standard streams are only laid out for the small reent with
+   global streams.  */
+#ifdef _REENT_STATIC_STD_STREAMS
+#if !defined(_REENT_SMALL) || !defined(_REENT_GLOBAL_STDIO_STREAMS)
+#undef _REENT_STATIC_STD_STREAMS
+#endif
+#endif
+
 /* If _MB_EXTENDED_CHARSETS_ALL is set, we want all of the extended
    charsets.  The extended charsets add a few functions and a couple
    of tables of a few K each. */
@@ -147,6 +147,12 @@ struct __sbuf {
  * that does not match the previous one in _bf.  When this happens,
  * _ub._base becomes non-nil (i.e., a stream has ungetc() data iff
  * _ub._base!=NULL) and _up and _ur save the current values of _p and _r.
+ *
+ * With _STDIO_COMPACT_FILE the four operations live in a const table
+ * shared by every stream of a kind, and the ungetc state is allocated
+ * by the first ungetc() that needs it and kept until the stream is
+ * closed.  The fgetline() buffer, which nothing in newlib fills, is
+ * left out.
  */
 
 #if defined(_REENT_SMALL) && !defined(_REENT_GLOBAL_STDIO_STREAMS)
@@ -183,6 +189,41 @@ extern void   __sinit (struct _reent *);
 # define _REENT_SMALL_CHECK_INIT(ptr) /* nothing */
 #endif /* _REENT_SMALL && !_REENT_GLOBAL_STDIO_STREAMS */
 
+#ifdef _STDIO_COMPACT_FILE
+struct __sFILE_ops {
+  _READ_WRITE_RETURN_TYPE (*_read) (struct _reent *, void *,
+					   char *, _READ_WRITE_BUFSIZE_TYPE);
+  _READ_WRITE_RETURN_TYPE (*_write) (struct _reent *, void *,
+					    const char *,
+					    _READ_WRITE_BUFSIZE_TYPE);
+  _fpos_t (*_seek) (struct _reent *, void *, _fpos_t, int);
+  int (*_close) (struct _reent *, void *);
+};
+
+struct __sFILE_ungetc {
+  struct __sbuf _ub;	/* ungetc buffer */
+  unsigned char *_up;	/* saved _p when _p is doing ungetc data */
+  int	_ur;		/* saved _r when _r is counting ungetc data */
+  unsigned char _ubuf[3];	/* guarantee an ungetc() buffer */
+};
+#endif
+
+#ifdef _STDIO_STATS
+/* What a stream, or all of them, asked of its I/O functions; see
+   __fstats in <stdio_ext.h>.  */
+struct __sFILE_stats {
+  unsigned long _reads;		/* calls of the read function */
+  unsigned long _read_bytes;	/* bytes they returned */
+  unsigned long _writes;	/* calls of the write function */
+  unsigned long _write_bytes;	/* bytes they took */
+  unsigned long _flushes;	/* buffers flushed with something in them */
+  unsigned long _refills;	/* buffers refilled */
+  unsigned long _setups;	/* calls of __swsetup_r */
+  unsigned long _bufs;		/* buffers made by __smakebuf_r */
+  unsigned long _contended;	/* times the lock was held by another */
+};
+#endif
+
 struct __sFILE {
   unsigned char *_p;	/* current position in (some) buffer */
   int	_r;		/* read space left for getc() */
@@ -199,6 +240,12 @@ struct __sFILE {
   /* operations */
   void *	_cookie;	/* cookie passed to io functions */
 
+#ifdef _STDIO_COMPACT_FILE
+  const struct __sFILE_ops *_ops;
+  struct __sFILE_ungetc *_ungetc;	/* NULL until ungetc() needs it */
+
+  unsigned char _nbuf[1];	/* guarantee a getc() buffer */
+#else
   _READ_WRITE_RETURN_TYPE (*_read) (struct _reent *, void *,
 					   char *, _READ_WRITE_BUFSIZE_TYPE);
   _READ_WRITE_RETURN_TYPE (*_write) (struct _reent *, void *,
@@ -218,6 +265,7 @@ struct __sFILE {
 
   /* separate buffer for fgetline() when line crosses buffer boundary */
   struct __sbuf _lb;	/* buffer for fgetline() */
+#endif
 
   /* Unix stdio files get aligned to block boundaries on fseek() */
   int	_blksize;	/* stat.st_blksize (may be != _bf._size) */
@@ -232,6 +280,9 @@ struct __sFILE {
 #endif
   _mbstate_t _mbstate;	/* for wide char stdio functions. */
   int   _flags2;        /* for future use */
+#ifdef _STDIO_STATS
+  struct __sFILE_stats _stats;
+#endif
 };
 
 #ifdef __CUSTOM_FILE_IO__
@@ -286,6 +337,9 @@ struct __sFILE64 {
   _flock_t _lock;	/* for thread-safety locking */
 #endif
   _mbstate_t _mbstate;	/* for wide char stdio functions. */
+#ifdef _STDIO_STATS
+  struct __sFILE_stats _stats;
+#endif
 };
 typedef struct __sFILE64 __FILE;
 #else
@@ -421,34 +475,85 @@ struct _reent
   __FILE *__sf;			        /* file descriptors */
   struct _misc_reent *_misc;            /* strtok, multibyte states */
   char *_signal_buf;                    /* strsignal */
+  struct _arena *_malloc_arena;         /* arena_use */
+  struct _mallquota *_malloc_quota;     /* malloc_quota_use */
 };
 
+/* _REENT_INIT_WITH (var, ext) initializes the members that are
+   otherwise allocated on first use to ext (member), so a reent can be
+   given static storage for them.  With _REENT_STATIC_EXT, impure.c
+   does this for _impure_ptr from a struct _reent_ext, and the library
+   then mallocs none of them for it.  Other reents still allocate.  */
+#define _REENT_EXT_NONE(member) _NULL
+
+#ifdef _REENT_STATIC_EXT
+struct _reent_ext
+{
+  char _emergency[_REENT_EMERGENCY_SIZE];
+  struct _mprec _mp;
+  struct _rand48 _r48;
+  struct __tm _localtime_buf;
+  char _asctime_buf[_REENT_ASCTIME_SIZE];
+  struct _misc_reent _misc;
+  char _signal_buf[_REENT_SIGNAL_SIZE];
+};
+
+/* What the _REENT_CHECK macros would set the members to.  */
+# define _REENT_EXT_INIT \
+  { {0}, \
+    {_NULL, 0, _NULL, _NULL}, \
+    {{_RAND48_SEED_0, _RAND48_SEED_1, _RAND48_SEED_2}, \
+     {_RAND48_MULT_0, _RAND48_MULT_1, _RAND48_MULT_2}, \
+     _RAND48_ADD, 1}, \
+    {0}, \
+    {0}, \
+    {_NULL}, \
+    {0} \
+  }
+#endif /* _REENT_STATIC_EXT */
+
 #ifdef _REENT_GLOBAL_STDIO_STREAMS
 extern __FILE __sf[3];
 
-# define _REENT_INIT(var) \
+/* With _REENT_STATIC_STD_STREAMS, findfp.c sets __sf up at link time,
+   and a statically initialized reent starts out as __sinit would leave
+   the global one.  */
+#ifdef _REENT_STATIC_STD_STREAMS
+extern void _cleanup_r (struct _reent *);
+# define _REENT_INIT_SDIDINIT 1
+# define _REENT_INIT_CLEANUP _cleanup_r
+# define _REENT_INIT_SGLUE {_NULL, 3, &__sf[0]}
+#else
+# define _REENT_INIT_SDIDINIT 0
+# define _REENT_INIT_CLEANUP _NULL
+# define _REENT_INIT_SGLUE {_NULL, 0, _NULL}
+#endif
+
+# define _REENT_INIT(var) _REENT_INIT_WITH (var, _REENT_EXT_NONE)
+# define _REENT_INIT_WITH(var, ext) \
   { 0, \
     &__sf[0], \
     &__sf[1], \
     &__sf[2], \
-    0,   \
-    _NULL, \
     0, \
+    ext (_emergency), \
+    _REENT_INIT_SDIDINIT, \
     0, \
     _NULL, \
-    _NULL, \
-    _NULL, \
+    ext (_mp), \
+    _REENT_INIT_CLEANUP, \
     0, \
     0, \
     _NULL, \
-    _NULL, \
-    _NULL, \
-    _NULL, \
+    ext (_r48), \
+    ext (_localtime_buf), \
+    ext (_asctime_buf), \
     _NULL, \
     _REENT_INIT_ATEXIT \
-    {_NULL, 0, _NULL}, \
-    _NULL, \
+    _REENT_INIT_SGLUE, \
     _NULL, \
+    ext (_misc), \
+    ext (_signal_buf), \
     _NULL \
   }
 
@@ -464,29 +569,31 @@ extern const struct __sFILE_fake __sf_fake_stdin;
 extern const struct __sFILE_fake __sf_fake_stdout;
 extern const struct __sFILE_fake __sf_fake_stderr;
 
-# define _REENT_INIT(var) \
+# define _REENT_INIT(var) _REENT_INIT_WITH (var, _REENT_EXT_NONE)
+# define _REENT_INIT_WITH(var, ext) \
   { 0, \
     (__FILE *)&__sf_fake_stdin, \
     (__FILE *)&__sf_fake_stdout, \
     (__FILE *)&__sf_fake_stderr, \
     0, \
-    _NULL, \
+    ext (_emergency), \
     0, \
     0, \
     _NULL, \
-    _NULL, \
+    ext (_mp), \
     _NULL, \
     0, \
     0, \
     _NULL, \
-    _NULL, \
-    _NULL, \
-    _NULL, \
+    ext (_r48), \
+    ext (_localtime_buf), \
+    ext (_asctime_buf), \
     _NULL, \
     _REENT_INIT_ATEXIT \
     {_NULL, 0, _NULL}, \
     _NULL, \
-    _NULL, \
+    ext (_misc), \
+    ext (_signal_buf), \
     _NULL \
   }
 
@@ -607,6 +714,8 @@ extern const struct __sFILE_fake __sf_fake_stderr;
 #define _REENT_L64A_BUF(ptr)    ((ptr)->_misc->_l64a_buf)
 #define _REENT_GETDATE_ERR_P(ptr) (&((ptr)->_misc->_getdate_err))
 #define _REENT_SIGNAL_BUF(ptr)  ((ptr)->_signal_buf)
+#define _REENT_MALLOC_ARENA(ptr) ((ptr)->_malloc_arena)
+#define _REENT_MALLOC_QUOTA(ptr) ((ptr)->_malloc_quota)
 
 #else /* !_REENT_SMALL */
 
@@ -663,6 +772,8 @@ struct _reent
           _mbstate_t _wcrtomb_state;
           _mbstate_t _wcsrtombs_state;
 	  int _h_errno;
+	  struct _arena *_malloc_arena;
+	  struct _mallquota *_malloc_quota;
         } _reent;
   /* Two next two fields were once used by malloc.  They are no longer
      used. They are used to preserve the space used before so as to
@@ -794,6 +905,8 @@ extern __FILE __sf[3];
 #define _REENT_L64A_BUF(ptr)    ((ptr)->_new._reent._l64a_buf)
 #define _REENT_SIGNAL_BUF(ptr)  ((ptr)->_new._reent._signal_buf)
 #define _REENT_GETDATE_ERR_P(ptr) (&((ptr)->_new._reent._getdate_err))
+#define _REENT_MALLOC_ARENA(ptr) ((ptr)->_new._reent._malloc_arena)
+#define _REENT_MALLOC_QUOTA(ptr) ((ptr)->_new._reent._malloc_quota)
 
 #endif /* !_REENT_SMALL */
 
@@ -824,6 +937,13 @@ void _reclaim_reent (struct _reent *);
 /* #define _REENT_ONLY define this to get only reentrant routines */
 
 #if defined(__DYNAMIC_REENT__) && !defined(__SINGLE_THREAD__)
+#if defined(__dsPIC30__) && !defined(__getreent)
+/* The structure of the running task, which the RTOS stores here on each
+   context switch; it starts out as _impure_ptr.  Reading it is one
+   instruction, where a call to __getreent would be a dozen.  */
+extern struct _reent *__pic30_reent __ATTRIBUTE_IMPURE_PTR__;
+# define __getreent() (__pic30_reent)
+#endif
 #ifndef __getreent
   struct _reent * __getreent (void);
 #endif
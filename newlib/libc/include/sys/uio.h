@@ -0,0 +1,28 @@
+#ifndef	_SYS_UIO_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#define	_SYS_UIO_H
+
+#include <_ansi.h>
+#include <sys/_types.h>
+#include <sys/types.h>
+
+/* One of the regions written by writev.  */
+struct iovec {
+	void	*iov_base;		/* start of the region */
+	size_t	iov_len;		/* its length in bytes */
+};
+
+ssize_t writev (int, const struct iovec *, int);
+#ifdef _COMPILING_NEWLIB
+/* Optional: stdio hands a write that does not fit in a stream's
+   buffer to _writev when the system provides one, the buffered bytes
+   first, and copies through the buffer as before when it does not.  */
+_ssize_t _writev (int, const struct iovec *, int);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _SYS_UIO_H */
@@ -0,0 +1,55 @@
+#ifndef __SYS_YIELD_H__
+#define __SYS_YIELD_H__
+
+/* The cooperative yield hook of a library configured with
+   --enable-newlib-yield-interval=N.  qsort, regexec, the writes of the
+   stdio functions and, where the machine code does it, memcpy, memset
+   and memmove call __libc_yield about every _LIBC_YIELD_INTERVAL bytes
+   or steps, so that a cooperative scheduler can run other tasks or a
+   watchdog be served in the middle of a long call.
+
+   The program defines __libc_yield; without it the calls are skipped.
+   It may be called with a stream or another library lock held, so it
+   must not use the library itself.  */
+
+#include <newlib.h>
+#include <_ansi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void __libc_yield (void);
+
+#ifdef _LIBC_YIELD_INTERVAL
+
+#define __libc_yield_now() \
+  do { \
+    extern void __libc_yield (void) __attribute__ ((__weak__)); \
+    if (__libc_yield) \
+      __libc_yield (); \
+  } while (0)
+
+/* Add N steps to the unsigned COUNTER, and yield and start over once
+   it reaches the interval.  */
+#define __libc_yield_count(counter, n) \
+  do { \
+    if (((counter) += (n)) >= _LIBC_YIELD_INTERVAL) \
+      { \
+	(counter) = 0; \
+	__libc_yield_now (); \
+      } \
+  } while (0)
+
+#else /* !_LIBC_YIELD_INTERVAL */
+
+#define __libc_yield_now() ((void) 0)
+#define __libc_yield_count(counter, n) ((void) (counter))
+
+#endif /* !_LIBC_YIELD_INTERVAL */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SYS_YIELD_H__ */
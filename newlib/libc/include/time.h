@@ -73,6 +73,28 @@ extern size_t strftime_l (char *__restrict _s, size_t _maxsize,
 			  const struct tm *__restrict _t, locale_t _l);
 #endif
 
+#if __MISC_VISIBLE
+/* A strftime format compiled by strftime_plan_compile.  The format
+   itself must outlive it.  */
+#define _STRFTIME_PLAN_MAX	32
+struct strftime_plan
+{
+  const char *__fmt;
+  unsigned char __fast;		/* 0: strftime does everything */
+  unsigned char __len;		/* length of the output */
+  unsigned char __op[_STRFTIME_PLAN_MAX + 1];
+  char __text[_STRFTIME_PLAN_MAX];
+};
+
+int	   strftime_plan_compile (struct strftime_plan *__restrict _p,
+				  const char *__restrict _fmt);
+size_t	   strftime_plan (char *__restrict _s, size_t _maxsize,
+			  const struct strftime_plan *__restrict _p,
+			  const struct tm *__restrict _t);
+
+time_t	   timegm (struct tm *_timeptr);
+#endif
+
 char	  *asctime_r 	(const struct tm *__restrict,
 				 char *__restrict);
 char	  *ctime_r 	(const time_t *, char *);
@@ -36,7 +36,12 @@
 #define unctrl(c)		__unctrl[(c) & 0xff]
 #define unctrllen(ch)		__unctrllen[(ch) & 0xff]
 
+#ifdef __dsPIC30__
+/* In program memory, each string in place */
+extern __IMPORT const char __unctrl[256][5] _PSV_CONST;	/* Control strings. */
+#else
 extern __IMPORT const char * const __unctrl[256];	/* Control strings. */
-extern __IMPORT const char __unctrllen[256];	/* Control strings length. */
+#endif
+extern __IMPORT const char __unctrllen[256] _PSV_CONST;	/* Control strings length. */
 
 #endif /* _UNCTRL_H_ */
@@ -240,6 +240,9 @@ const struct __locale_t __C_locale =
 };
 #endif /* _MB_CAPABLE */
 
+#ifdef _WANT_C_LOCALE_ONLY
+const
+#endif
 struct __locale_t __global_locale =
 {
   { "C", "C", DEFAULT_LOCALE, "C", "C", "C", "C", },
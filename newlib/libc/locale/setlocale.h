@@ -151,7 +151,7 @@ struct lc_time_T
   const wchar_t	*walt_digits;
 #endif
 };
-extern const struct lc_time_T _C_time_locale;
+extern const struct lc_time_T _C_time_locale _PSV_CONST;
 
 struct	lc_messages_T
 {
@@ -209,8 +209,14 @@ extern size_t _wcsnrtombs_l (struct _reent *, char *, const wchar_t **,
 _ELIDABLE_INLINE struct __locale_t *
 __get_global_locale ()
 {
+#ifdef _WANT_C_LOCALE_ONLY
+  /* Nothing can change it, so it is const and stays out of RAM.  */
+  extern const struct __locale_t __global_locale;
+  return (struct __locale_t *) &__global_locale;
+#else
   extern struct __locale_t __global_locale;
   return &__global_locale;
+#endif
 }
 
 /* Per REENT locale.  This is newlib-internal. */
@@ -32,7 +32,7 @@
 
 #define LCTIME_SIZE (sizeof(struct lc_time_T) / sizeof(char *))
 
-const struct lc_time_T	_C_time_locale = {
+const struct lc_time_T	_C_time_locale _PSV_CONST = {
 	{
 		"Jan", "Feb", "Mar", "Apr", "May", "Jun",
 		"Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
@@ -0,0 +1,85 @@
+/* Assembler helpers for the pic30 (dsPIC30F/33F/33E, PIC24) machine
+   directory.  */
+
+#ifndef _PIC30_ASM_H
+#define _PIC30_ASM_H
+
+#include <newlib.h>
+
+/* XC16 prefixes C symbols with an underscore; newer versions of GNU cpp
+   tell us so via __USER_LABEL_PREFIX__.  */
+#ifndef __USER_LABEL_PREFIX__
+#define __USER_LABEL_PREFIX__ _
+#endif
+
+#define CONCAT1(a, b) CONCAT2(a, b)
+#define CONCAT2(a, b) a##b
+
+#define SYM(x) CONCAT1(__USER_LABEL_PREFIX__, x)
+
+/* ';' starts a comment for the pic30 assembler, so anything longer
+   than one statement is a gas macro rather than a cpp one.  */
+
+	.macro	func_start name
+	.text
+	.global	\name
+	.type	\name, @function
+\name:
+	.endm
+
+/* Start a global function in .text.  */
+#define FUNC_START(name) func_start SYM(name)
+
+#define FUNC_END(name)	\
+	.size	SYM(name), . - SYM(name)
+
+/* Largest count handed to a single REPEAT.  dsPIC30F and dsPIC33F only
+   honour the low 14 bits of the count register, so bigger blocks are
+   done in several chunks.  */
+#define REPEAT_CHUNK	0x2000
+
+/* Configured with --enable-newlib-yield-interval, the block functions
+   move at most about _LIBC_YIELD_INTERVAL bytes per REPEAT, and
+   between two of them "yield_point reg" calls __libc_yield (see
+   <sys/yield.h>) when it is defined and the count left in reg is not
+   0.  w0-w7 survive it.  */
+#ifdef _LIBC_YIELD_INTERVAL
+#if _LIBC_YIELD_INTERVAL < 2 * REPEAT_CHUNK
+#define WORD_CHUNK	((_LIBC_YIELD_INTERVAL + 1) / 2)
+#else
+#define WORD_CHUNK	REPEAT_CHUNK
+#endif
+#if _LIBC_YIELD_INTERVAL < REPEAT_CHUNK
+#define BYTE_CHUNK	_LIBC_YIELD_INTERVAL
+#else
+#define BYTE_CHUNK	REPEAT_CHUNK
+#endif
+
+	.weak	SYM(__libc_yield)
+	.macro	yield_point rest
+	cp0	\rest
+	bra	z, .Lno_yield\@
+	push.d	w0
+	push.d	w2
+	push.d	w4
+	push.d	w6
+	mov	#SYM(__libc_yield), w0
+	cp0	w0
+	bra	z, .Lyielded\@
+	call	SYM(__libc_yield)
+.Lyielded\@:
+	pop.d	w6
+	pop.d	w4
+	pop.d	w2
+	pop.d	w0
+.Lno_yield\@:
+	.endm
+#else
+#define WORD_CHUNK	REPEAT_CHUNK
+#define BYTE_CHUNK	REPEAT_CHUNK
+
+	.macro	yield_point rest
+	.endm
+#endif
+
+#endif /* _PIC30_ASM_H */
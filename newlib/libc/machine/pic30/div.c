@@ -0,0 +1,17 @@
+/* div for pic30: one div.s yields both results, already truncated
+   towards zero, so none of the sign fix-ups of the generic version
+   are needed.  */
+
+#include <_ansi.h>
+#include <stdlib.h>
+#include "divmod.h"
+
+div_t
+div (int num,
+	int denom)
+{
+	div_t r;
+
+	r.quot = __pic30_sdivmod16 (num, denom, &r.rem);
+	return (r);
+}
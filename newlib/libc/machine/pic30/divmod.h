@@ -0,0 +1,69 @@
+/* Hardware divide helpers for pic30.
+
+   The divide unit produces quotient and remainder together: after
+   "repeat #17; div.x" the quotient is in w0 and the remainder in w1.
+   These wrappers let C code get both from one divide instead of the
+   two libgcc calls "/" and "%" cost.  The operands must not live in
+   w0/w1 while the divide iterates, hence the early clobbers.  */
+
+#ifndef _PIC30_DIVMOD_H
+#define _PIC30_DIVMOD_H
+
+/* 16 / 16 unsigned.  */
+static __inline__ unsigned int
+__pic30_udivmod16 (unsigned int num, unsigned int den, unsigned int *rem)
+{
+  register unsigned int q __asm__ ("w0");
+  register unsigned int r __asm__ ("w1");
+
+  __asm__ ("repeat\t#17\n\tdiv.u\t%2, %3"
+	   : "=&r" (q), "=&r" (r)
+	   : "r" (num), "r" (den));
+  *rem = r;
+  return q;
+}
+
+/* 16 / 16 signed, truncating towards zero as C requires.  */
+static __inline__ int
+__pic30_sdivmod16 (int num, int den, int *rem)
+{
+  register int q __asm__ ("w0");
+  register int r __asm__ ("w1");
+
+  __asm__ ("repeat\t#17\n\tdiv.s\t%2, %3"
+	   : "=&r" (q), "=&r" (r)
+	   : "r" (num), "r" (den));
+  *rem = r;
+  return q;
+}
+
+/* 32 / 16 unsigned with a 16-bit quotient; the caller guarantees
+   num / den < 65536.  */
+static __inline__ unsigned int
+__pic30_udivmod32_16 (unsigned long num, unsigned int den, unsigned int *rem)
+{
+  register unsigned int q __asm__ ("w0");
+  register unsigned int r __asm__ ("w1");
+
+  __asm__ ("repeat\t#17\n\tdiv.ud\t%2, %3"
+	   : "=&r" (q), "=&r" (r)
+	   : "r" (num), "r" (den));
+  *rem = r;
+  return q;
+}
+
+/* Full 32 / 16 unsigned: schoolbook long division in two div.ud
+   steps, high word first.  The first remainder is below den, so the
+   second quotient always fits in 16 bits.  */
+static __inline__ unsigned long
+__pic30_udivmod32 (unsigned long num, unsigned int den, unsigned int *rem)
+{
+  unsigned int hi, lo, r;
+
+  hi = __pic30_udivmod16 ((unsigned int) (num >> 16), den, &r);
+  lo = __pic30_udivmod32_16 (((unsigned long) r << 16)
+			     | (unsigned int) num, den, rem);
+  return ((unsigned long) hi << 16) | lo;
+}
+
+#endif /* _PIC30_DIVMOD_H */
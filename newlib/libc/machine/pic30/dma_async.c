@@ -0,0 +1,91 @@
+/* memcpy_async, memset_async and memcpy_wait for pic30, see
+   machine/dma.h.
+
+   The DMA channels belong to the board: which ones are free for this,
+   which memory they reach (DMA RAM on the dsPIC33F and PIC24H) and how
+   a block is moved all differ, so the work is done by three hooks.
+   __pic30_dma_copy and __pic30_dma_fill start a block on a channel and
+   return a handle of at least 0 for __pic30_dma_busy, or return -1 if
+   they cannot, for example because every channel is in use or the
+   memory is out of reach of the DMA; the block is then done at once
+   with the assembly memcpy or memset.  Below __dma_async_min bytes,
+   setting up a channel costs more than the copy, so the hooks are not
+   asked at all.
+
+   The barriers keep the compiler from moving accesses to the buffers
+   across the start and the wait; there is no cache to maintain.  */
+
+#include <string.h>
+#include <machine/dma.h>
+
+size_t __dma_async_min = 64;
+
+int __attribute__ ((weak))
+__pic30_dma_copy (void *dst, const void *src, size_t n)
+{
+  return -1;
+}
+
+int __attribute__ ((weak))
+__pic30_dma_fill (void *dst, int c, size_t n)
+{
+  return -1;
+}
+
+int __attribute__ ((weak))
+__pic30_dma_busy (int handle)
+{
+  return 0;
+}
+
+void *
+memcpy_async (void *dst, const void *src, size_t n, dma_handle_t *handle)
+{
+  int h = -1;
+
+  __asm__ volatile ("" : : : "memory");
+  if (n >= __dma_async_min)
+    h = __pic30_dma_copy (dst, src, n);
+  if (h < 0)
+    {
+      memcpy (dst, src, n);
+      h = DMA_DONE;
+    }
+  *handle = h;
+  return dst;
+}
+
+void *
+memset_async (void *dst, int c, size_t n, dma_handle_t *handle)
+{
+  int h = -1;
+
+  __asm__ volatile ("" : : : "memory");
+  if (n >= __dma_async_min)
+    h = __pic30_dma_fill (dst, c, n);
+  if (h < 0)
+    {
+      memset (dst, c, n);
+      h = DMA_DONE;
+    }
+  *handle = h;
+  return dst;
+}
+
+int
+memcpy_done (dma_handle_t handle)
+{
+  int done = handle == DMA_DONE || !__pic30_dma_busy (handle);
+
+  __asm__ volatile ("" : : : "memory");
+  return done;
+}
+
+void
+memcpy_wait (dma_handle_t handle)
+{
+  if (handle != DMA_DONE)
+    while (__pic30_dma_busy (handle))
+      ;
+  __asm__ volatile ("" : : : "memory");
+}
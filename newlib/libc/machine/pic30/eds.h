@@ -0,0 +1,97 @@
+/* Helpers for the pic30 EDS functions, see edsspace.h.  */
+
+#ifndef _PIC30_EDS_H
+#define _PIC30_EDS_H
+
+#include <edsspace.h>
+
+/* Largest REPEAT count honoured by every family, see asm.h.  */
+#define REPEAT_CHUNK 0x2000
+
+/* For a data-space address: the page that reaches it, 0 for near data;
+   the pointer to it in the window; and the bytes from it to the end of
+   the page.  */
+#define EDS_PAGE(a)	((unsigned int) ((a) >> 15))
+#define EDS_PTR(a)	((unsigned int) (a) | ((a) >= 0x8000UL ? 0x8000U : 0))
+#define EDS_RUN(a)	(0x8000U - ((unsigned int) (a) & 0x7fffU))
+
+/* The same for the bytes before the address A, for copying down.  */
+#define EDS_RUN_DOWN(a)	(((unsigned int) ((a) - 1) & 0x7fffU) + 1)
+
+#define EDS_SAVE(r, w) \
+  __asm__ volatile ("mov\tDSRPAG, %0\n\tmov\tDSWPAG, %1" : "=r" (r), "=r" (w))
+#define EDS_RESTORE(r, w) \
+  __asm__ volatile ("mov\t%0, DSRPAG\n\tmov\t%1, DSWPAG" \
+		    : : "r" (r), "r" (w) : "memory")
+
+/* Select the pages for the next run.  Near data ignores them.  */
+static __inline__ void
+__pic30_eds_pages (unsigned int rpage, unsigned int wpage)
+{
+  if (rpage != 0)
+    __asm__ volatile ("mov\t%0, DSRPAG" : : "r" (rpage) : "memory");
+  if (wpage != 0)
+    __asm__ volatile ("mov\t%0, DSWPAG" : : "r" (wpage) : "memory");
+}
+
+/* Copy N bytes, 0 < N <= REPEAT_CHUNK, from S up to D within the
+   current pages.  */
+static __inline__ void
+__pic30_eds_copy_up (unsigned int d, unsigned int s, unsigned int n)
+{
+  if (((d ^ s) & 1) == 0 && n >= 2)
+    {
+      unsigned int w;
+
+      if (d & 1)
+	{
+	  __asm__ volatile ("mov.b\t[%1++], [%0++]"
+			    : "+r" (d), "+r" (s) : : "memory");
+	  n--;
+	}
+      w = n >> 1;
+      if (w != 0)
+	__asm__ volatile ("dec\t%2, %2\n\t"
+			  "repeat\t%2\n\t"
+			  "mov\t[%1++], [%0++]"
+			  : "+r" (d), "+r" (s), "+r" (w) : : "memory");
+      n &= 1;
+    }
+  if (n != 0)
+    __asm__ volatile ("dec\t%2, %2\n\t"
+		      "repeat\t%2\n\t"
+		      "mov.b\t[%1++], [%0++]"
+		      : "+r" (d), "+r" (s), "+r" (n) : : "memory");
+}
+
+/* Copy the N bytes, 0 < N <= REPEAT_CHUNK, that end just before S
+   down to those that end just before D, highest first.  */
+static __inline__ void
+__pic30_eds_copy_down (unsigned int d, unsigned int s, unsigned int n)
+{
+  if (((d ^ s) & 1) == 0 && n >= 2)
+    {
+      unsigned int w;
+
+      if (d & 1)
+	{
+	  __asm__ volatile ("mov.b\t[--%1], [--%0]"
+			    : "+r" (d), "+r" (s) : : "memory");
+	  n--;
+	}
+      w = n >> 1;
+      if (w != 0)
+	__asm__ volatile ("dec\t%2, %2\n\t"
+			  "repeat\t%2\n\t"
+			  "mov\t[--%1], [--%0]"
+			  : "+r" (d), "+r" (s), "+r" (w) : : "memory");
+      n &= 1;
+    }
+  if (n != 0)
+    __asm__ volatile ("dec\t%2, %2\n\t"
+		      "repeat\t%2\n\t"
+		      "mov.b\t[--%1], [--%0]"
+		      : "+r" (d), "+r" (s), "+r" (n) : : "memory");
+}
+
+#endif /* _PIC30_EDS_H */
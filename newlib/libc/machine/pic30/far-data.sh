@@ -0,0 +1,33 @@
+#! /bin/sh
+# List the data objects of a pic30 libc.a outside near RAM.
+#
+# Usage: far-data.sh [libc.a]
+#
+# Near data lives in the sections whose names begin with .n (.nbss,
+# .ndata, .nconst); everything else in .bss, .data and common may be
+# placed above the first 8K by -mlarge-data, where each access takes
+# a MOV through a W register.  Objects that most calls touch belong in
+# near RAM, marked with _NEAR_DATA from <_ansi.h>.  Set OBJDUMP to the
+# target objdump.
+
+lib=${1-libc.a}
+: ${OBJDUMP=objdump}
+
+$OBJDUMP -t "$lib" | awk '
+function hex(s,  i, n) {
+	n = 0
+	for (i = 1; i <= length(s); i++)
+		n = n * 16 + index("0123456789abcdef", tolower(substr(s, i, 1))) - 1
+	return n
+}
+/^In archive/	{ next }
+/:[ 	]+file format/	{ obj = $1; sub(/:$/, "", obj); next }
+/ O / {
+	sec = $(NF - 2); size = $(NF - 1); sym = $NF
+	if (sec != "*COM*" && sec !~ /^\.(f?bss|f?data)/)
+		next
+	n = hex(size)
+	printf "%-24s %-28s %-8s %6d\n", obj, sym, sec, n
+	total += n
+}
+END	{ printf "%-24s %-28s %-8s %6d\n", "total", "", "", total }'
@@ -0,0 +1,55 @@
+/* __getreent for pic30, built with __DYNAMIC_REENT__.
+
+   <sys/reent.h> then defines _REENT as a read of __pic30_reent, the
+   near word that holds the _reent structure of the running task, and
+   the function is only here for code that calls it by name.  An RTOS
+   stores the structure of the task it switches to in __pic30_reent as
+   part of the context switch, with one instruction:
+
+	mov	w0, ___pic30_reent
+
+   Until the first switch it is that of impure.c.  The object takes the
+   place of the generic one from libc/reent when libc.a is put
+   together.
+
+   Every task carries a struct _reent, so its size is checked here
+   against REENT_SIZE_MAX bytes when the library is built: 50 with one
+   16-bit word per member, which configure.host keeps by moving the
+   70 bytes of atexit data into the global list (_REENT_GLOBAL_ATEXIT;
+   only that of _impure_ptr was ever used).  What a task allocates on
+   first use lies behind the pointers, see _REENT_STATIC_EXT.  */
+
+#include <reent.h>
+
+#ifndef REENT_SIZE_MAX
+#ifdef _REENT_GLOBAL_ATEXIT
+#define REENT_SIZE_MAX	50
+#else
+#define REENT_SIZE_MAX	122
+#endif
+#endif
+
+/* A build that fails here grew struct _reent: raise REENT_SIZE_MAX
+   if that was meant.  */
+typedef char reent_size_within_REENT_SIZE_MAX
+  [sizeof (struct _reent) <= REENT_SIZE_MAX ? 1 : -1];
+
+#if defined (__DYNAMIC_REENT__) && !defined (__SINGLE_THREAD__)
+
+#undef __getreent
+
+struct _reent *
+__getreent (void)
+{
+  return __pic30_reent;
+}
+
+#else
+
+struct _reent *
+__getreent (void)
+{
+  return _impure_ptr;
+}
+
+#endif
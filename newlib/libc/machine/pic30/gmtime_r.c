@@ -0,0 +1,123 @@
+/* gmtime_r for pic30.  See libc/time/gmtime_r.c for the generic
+   version.
+
+   The generic code divides a time_t by SECSPERDAY and then a long by
+   the lengths of eras, centuries and years, each a libgcc call of 32
+   or 64 bits.  Here every divide is a div.u or a div.ud with a 16-bit
+   divisor and quotient:
+
+   - SECSPERDAY is 128 * 675, so the day count is the time shifted
+     right by 7 and divided by 675: one div.ud for a 32-bit time_t, a
+     chain of two, high word first, for a 64-bit one.  The remainder
+     and the 7 low bits make up the second of the day, whose hour
+     takes one more div.ud and whose minute and second one div.u.
+
+   - The date follows Neri and Schneider, "Euclidean affine functions
+     and their application to calendar algorithms" (2022): the day
+     count is shifted so that it starts on a 1st of March and is never
+     negative, centuries are (4 n + 3) / 146097, years within one
+     (4 n + 3) / 1461, and month and day come from the high and low
+     halves of 2141 n + 197913.  146097 is 3 * 48699, which makes the
+     century a div.ud and a div.u.
+
+   The shift covers the years an int tm_year can hold.  An unsigned
+   time_t needs no bias: shifted, it is below 2^25, whose quotient by
+   675 fits in 16 bits.  */
+
+#include "../../time/local.h"
+#include "divmod.h"
+
+/* The day count is shifted by ERAS 400-year eras and to start on
+   1st March of year 0, a Wednesday like every 1st March 400 n years
+   before it.  */
+#define ERAS		78
+#define SHIFT_DAYS	(719468UL + 146097UL * ERAS)
+#define SHIFT_WDAY	3
+
+/* Biases on the day count, added to the shifted time in units of
+   675: with 2^31 the 64-bit dividend is non-negative for any day count
+   that fits in a long; a 32-bit time_t shifted is above -2^24, and 2^15
+   also keeps the quotient below 2^16.  */
+#define DAYS_BIAS64	0x80000000UL
+#define DAYS_BIAS32	0x8000U
+
+struct tm *
+gmtime_r (const time_t *__restrict tim_p,
+	struct tm *__restrict res)
+{
+  const time_t lcltime = *tim_p;
+  unsigned long n, sod;
+  unsigned int r, q, cent, cday, z, ny, leap;
+
+  /* days and second of the day */
+  if ((time_t) -1 > 0 && sizeof (time_t) <= sizeof (long))
+    {
+      q = __pic30_udivmod32_16 ((unsigned long) lcltime >> 7, 675, &r);
+      n = q + SHIFT_DAYS;
+    }
+  else if (sizeof (time_t) <= sizeof (long))
+    {
+      const unsigned long t = ((long) lcltime >> 7) + 675L * DAYS_BIAS32;
+
+      q = __pic30_udivmod32_16 (t, 675, &r);
+      n = q + (SHIFT_DAYS - DAYS_BIAS32);
+    }
+  else
+    {
+      const unsigned long long t = ((long long) lcltime >> 7)
+	+ 675LL * DAYS_BIAS64;
+      unsigned int hi;
+
+      /* the high word is below 675 for any such day count */
+      r = (unsigned int) (t >> 32);
+      hi = __pic30_udivmod32_16 (((unsigned long) r << 16)
+				 | (unsigned int) (t >> 16), 675, &r);
+      q = __pic30_udivmod32_16 (((unsigned long) r << 16)
+				| (unsigned int) t, 675, &r);
+      n = (((unsigned long) hi << 16) | q) + (SHIFT_DAYS - DAYS_BIAS64);
+    }
+  sod = ((unsigned long) r << 7) | ((unsigned int) lcltime & 127);
+
+  /* compute hour, min, and sec */
+  res->tm_hour = __pic30_udivmod32_16 (sod, SECSPERHOUR, &r);
+  res->tm_min = __pic30_udivmod16 (r, SECSPERMIN, &r);
+  res->tm_sec = r;
+
+  /* compute day of week: n is below 2^26 and 2^16 is 2 mod 7, which
+     keeps the quotient to 16 bits */
+  __pic30_udivmod32_16 (2UL * (unsigned int) (n >> 16)
+			+ (unsigned int) n + SHIFT_WDAY, DAYSPERWEEK, &r);
+  res->tm_wday = r;
+
+  /* century, then day of the century */
+  q = __pic30_udivmod32_16 (4 * n + 3, 48699U, &r);
+  cent = __pic30_udivmod16 (q, 3, &cday);
+  cday = (unsigned int) ((cday * 48699UL + r) >> 2);	/* [0, 36524] */
+
+  /* year of the century, then day of the year from 1st March */
+  z = __pic30_udivmod32_16 (4UL * cday + 3, 1461, &r);	/* [0, 99] */
+  ny = r >> 2;					/* [0, 365] */
+
+  /* month and day */
+  n = 2141UL * ny + 197913UL;
+  res->tm_mday = (unsigned int) n / 2141 + 1;
+  res->tm_mon = (unsigned int) (n >> 16) - 1;
+
+  /* March to December belong to the calendar year 100 cent + z and
+     follow its 29th of February, if any; January and February to the
+     next */
+  leap = z != 0 ? (z & 3) == 0 : (cent & 3) == 0;
+  if (ny >= 306)
+    {
+      res->tm_yday = ny - 306;
+      res->tm_mon -= 12;
+      ++z;
+    }
+  else
+    res->tm_yday = ny + 59 + leap;
+  res->tm_year = 100 * ((int) cent - 4 * ERAS - YEAR_BASE / 100) + (int) z;
+
+  res->tm_isdst = 0;
+
+  return (res);
+}
@@ -0,0 +1,43 @@
+/* Access to data kept in the dsPIC33E/PIC24E extended data space.
+
+   Data memory above 32K is only visible through the upper half of the
+   data space, 0x8000-0xffff, with DSRPAG selecting the page that reads
+   see and DSWPAG the page that writes see.  The functions below take an
+   eds_addr_t, the full data-space address as a 32-bit number, so that
+   address arithmetic carries across pages like it does in near memory.
+   Addresses below 0x8000 are near data and need no page at all; read
+   pages from 0x200 up map program memory, so the read-only functions
+   accept PSV addresses too.  EDS_ADDR gives the address of an object,
+   near or placed with __eds__.
+
+   Each function works in runs that stay on one page of each operand,
+   setting the page registers once per run and moving words when the
+   operands' alignments agree.  DSRPAG and DSWPAG are put back before
+   returning.  */
+
+#ifndef _EDSSPACE_H_
+#define _EDSSPACE_H_
+
+#include "_ansi.h"
+#include <sys/cdefs.h>
+#include <stddef.h>
+
+_BEGIN_STD_C
+
+typedef unsigned long eds_addr_t;
+
+/* Data-space address of the object x.  */
+#define EDS_ADDR(x) \
+  ((__builtin_edsoffset (x) & 0x8000U) \
+   ? (((eds_addr_t) __builtin_edspage (x) << 15) \
+      | (__builtin_edsoffset (x) & 0x7fffU)) \
+   : (eds_addr_t) __builtin_edsoffset (x))
+
+eds_addr_t	memcpy_eds (eds_addr_t, eds_addr_t, size_t);
+eds_addr_t	memmove_eds (eds_addr_t, eds_addr_t, size_t);
+eds_addr_t	memset_eds (eds_addr_t, int, size_t);
+size_t		strlen_eds (eds_addr_t);
+
+_END_STD_C
+
+#endif /* _EDSSPACE_H_ */
@@ -0,0 +1,95 @@
+/* Access to constant data kept in pic30 program memory.
+
+   Program memory is addressed separately from data memory, so data
+   placed there with PROGMEM is named by a 24-bit program address
+   (TBLPAG:offset) rather than a data pointer.  The low 16 bits of each
+   instruction word are read as two consecutive bytes, the same packing
+   the PSV window uses, so byte address N+1 follows N across word and
+   page boundaries.
+
+   The functions below read through the table read instructions and so
+   only change TBLPAG, never PSVPAG/DSRPAG: constants the compiler left
+   in the auto-PSV window stay visible while they run.  */
+
+#ifndef _PGMSPACE_H_
+#define _PGMSPACE_H_
+
+#include "_ansi.h"
+#include <sys/cdefs.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+_BEGIN_STD_C
+
+typedef unsigned long prog_addr_t;
+#define PGM_P prog_addr_t
+
+#define PROGMEM __attribute__ ((space (prog)))
+
+/* Program address of an object placed with PROGMEM.  */
+#define PGM_ADDR(x) \
+  (((prog_addr_t) __builtin_tblpage (x) << 16) | __builtin_tbloffset (x))
+
+/* A string literal that lives only in program memory.  */
+#define PSTR(s) \
+  (__extension__ ({ static const char __pstr[] PROGMEM = (s); \
+		    PGM_ADDR (__pstr); }))
+
+static __inline__ unsigned char
+pgm_read_byte (prog_addr_t __addr)
+{
+  unsigned int __b;
+
+  __asm__ ("mov\t%d1, TBLPAG\n\ttblrdl.b\t[%1], %0"
+	   : "=r" (__b) : "r" (__addr));
+  return (unsigned char) __b;
+}
+
+/* __addr must be even.  */
+static __inline__ unsigned int
+pgm_read_word (prog_addr_t __addr)
+{
+  unsigned int __w;
+
+  __asm__ ("mov\t%d1, TBLPAG\n\ttblrdl\t[%1], %0"
+	   : "=r" (__w) : "r" (__addr));
+  return __w;
+}
+
+/* Packed program memory, placed with PROGMEM_PACKED, holds three bytes
+   in each instruction word instead of two: bytes 3K and 3K+1 in the
+   low 16 bits of word K, as PSV reads them, and byte 3K+2 in the upper
+   byte that only TBLRDH reaches.  Such an object is read by byte index
+   from its program address, which is that of word 0.  */
+#ifndef PROGMEM_PACKED
+#define PROGMEM_PACKED __attribute__ ((space (prog), __pack_upper_byte__))
+#endif
+
+/* All 24 bits of the instruction word at the even address __addr.  */
+static __inline__ unsigned long
+pmem_read24 (prog_addr_t __addr)
+{
+  unsigned long __v;
+
+  __asm__ ("mov\t%d1, TBLPAG\n\ttblrdl\t[%1], %0\n\ttblrdh\t[%1], %d0"
+	   : "=&r" (__v) : "r" (__addr));
+  return __v;
+}
+
+unsigned char	 pmem_read_packed (prog_addr_t, size_t);
+void	*pmem_memcpy_packed (void *, prog_addr_t, size_t, size_t);
+
+void	*memcpy_P (void *, prog_addr_t, size_t);
+size_t	 strlen_P (prog_addr_t);
+int	 strcmp_P (const char *, prog_addr_t);
+char	*strcpy_P (char *, prog_addr_t);
+char	*strncpy_P (char *, prog_addr_t, size_t);
+
+int	 printf_P (prog_addr_t, ...);
+int	 fprintf_P (FILE *, prog_addr_t, ...);
+int	 vfprintf_P (FILE *, prog_addr_t, va_list);
+
+_END_STD_C
+
+#endif /* _PGMSPACE_H_ */
@@ -0,0 +1,35 @@
+/* ldiv for pic30.  Divisors that fit in 16 bits are handled by two
+   hardware divides on the magnitudes; anything wider goes through the
+   libgcc 32-bit routines.  */
+
+#include <_ansi.h>
+#include <stdlib.h>
+#include "divmod.h"
+
+ldiv_t
+ldiv (long num,
+        long denom)
+{
+	ldiv_t r;
+	unsigned long n, d;
+	unsigned int rem;
+
+	n = num < 0 ? -(unsigned long) num : (unsigned long) num;
+	d = denom < 0 ? -(unsigned long) denom : (unsigned long) denom;
+
+	if (d <= 0xffffUL) {
+		/* Quotient takes the sign of num ^ denom, remainder the
+		   sign of num.  */
+		r.quot = (long) __pic30_udivmod32 (n, (unsigned int) d, &rem);
+		r.rem = (long) rem;
+		if ((num ^ denom) < 0)
+			r.quot = -r.quot;
+		if (num < 0)
+			r.rem = -r.rem;
+		return (r);
+	}
+
+	r.quot = num / denom;
+	r.rem = num % denom;
+	return (r);
+}
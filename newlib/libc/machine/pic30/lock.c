@@ -0,0 +1,324 @@
+/* The retargetable locks for pic30.  See libc/misc/lock.c for the
+   documentation of the interface.
+
+   On bare metal there are no threads to exclude, only interrupt
+   handlers, so a lock raises the CPU priority (SR.IPL) to __lock_ipl
+   for as long as it is held, as the malloc lock does.  Handlers at or
+   below that priority may use the library; those above it keep their
+   latency but must not.  Taking a lock at or above the ceiling costs
+   two SR reads.
+
+   With an RTOS, __pic30_lock_self returns the running task, and a
+   lock records its owner and depth instead.  The priority is raised
+   only while those are examined, so handlers run while a task holds a
+   lock and may no longer use the library.  A task that finds the lock
+   held by another calls __pic30_lock_wait, and the last release calls
+   __pic30_lock_wake when there are waiters.  The two must behave like
+   a counting semaphore per lock: a wake that comes before the wait
+   lets the wait return at once.  The wait may also return early, as
+   the lock is looked at again; the default returns at once, which
+   spins.  __pic30_lock_self must not change what it returns while a
+   lock is held, so it should return NULL until the scheduler runs.
+
+   Built with LOCK_DISI, the bare metal locks instead hold off
+   priorities 1 to 6 with DISI, which costs no SR update but expires
+   after 16384 cycles.  That is only safe where every locked section
+   is known to be shorter.
+
+   Built with LOCK_STATS, the outermost pair of a bare metal lock also
+   times how long it was held, for __libc_lockstats (lockstats.c).
+
+   Every lock is recursive: only the outermost pair changes the CPU
+   state or the owner.  The object takes the place of the generic one
+   from libc/misc when libc.a is put together.  */
+
+#include <stdlib.h>
+#include <machine/lock.h>
+
+#define SR_IPL		0x00e0
+#define SR_IPL_SHIFT	5
+
+/* Defaults to 7, which holds off every maskable interrupt.  */
+unsigned char __lock_ipl _NEAR_DATA = 7;
+
+#if !defined (__SINGLE_THREAD__) && defined (_RETARGETABLE_LOCKING)
+
+struct __lock
+{
+  void *owner;			/* the holding task, under an RTOS */
+  unsigned int depth;		/* how many times it is held */
+  unsigned int ipl;		/* SR.IPL before it was taken */
+  unsigned int waiters;		/* tasks in __pic30_lock_wait */
+#ifdef LOCK_STATS
+  unsigned long t0;		/* __lockstats_clock when taken */
+  void *caller;			/* where from */
+#endif
+};
+
+struct __lock __lock___sinit_recursive_mutex;
+struct __lock __lock___sfp_recursive_mutex;
+struct __lock __lock___atexit_recursive_mutex;
+struct __lock __lock___at_quick_exit_mutex;
+struct __lock __lock___malloc_recursive_mutex;
+struct __lock __lock___env_recursive_mutex;
+struct __lock __lock___tz_mutex;
+struct __lock __lock___dd_hash_mutex;
+struct __lock __lock___arc4random_mutex;
+/* Those of the standard streams, set up at link time in findfp.c.  */
+struct __lock __lock___sf_stdin_recursive_mutex;
+struct __lock __lock___sf_stdout_recursive_mutex;
+struct __lock __lock___sf_stderr_recursive_mutex;
+
+void * __attribute__ ((weak))
+__pic30_lock_self (void)
+{
+  return NULL;
+}
+
+void __attribute__ ((weak))
+__pic30_lock_wait (_LOCK_T lock)
+{
+}
+
+void __attribute__ ((weak))
+__pic30_lock_wake (_LOCK_T lock)
+{
+}
+
+#ifdef LOCK_DISI
+/* DISICNT is one counter for all the locks.  */
+static unsigned int disi_depth _NEAR_DATA;
+#ifdef LOCK_STATS
+/* So one hold is timed across all of them, charged to the first.  */
+static unsigned long disi_t0;
+static void *disi_caller;
+static _LOCK_T disi_lock;
+#endif
+#endif
+
+#ifdef LOCK_STATS
+/* The class __libc_lockstats counts a hold of LOCK under.  The locks
+   set up at run time are those of the streams.  */
+static unsigned int
+lock_class (_LOCK_T lock)
+{
+  if (lock == &__lock___malloc_recursive_mutex)
+    return LOCKSTAT_MALLOC;
+  if (lock == &__lock___env_recursive_mutex)
+    return LOCKSTAT_ENV;
+  if (lock == &__lock___tz_mutex)
+    return LOCKSTAT_TZ;
+  if (lock == &__lock___atexit_recursive_mutex
+      || lock == &__lock___at_quick_exit_mutex
+      || lock == &__lock___dd_hash_mutex
+      || lock == &__lock___arc4random_mutex)
+    return LOCKSTAT_OTHER;
+  return LOCKSTAT_STDIO;
+}
+#endif
+
+/* Raise SR.IPL to the ceiling and return what it was.  An interrupt
+   between the read and the write returns with SR as it found it, so
+   the read-modify-write needs no protection.  */
+static inline unsigned int
+ipl_raise (void)
+{
+  unsigned int sr, ceil = (unsigned int) __lock_ipl << SR_IPL_SHIFT;
+
+  __asm__ volatile ("mov\tSR, %0" : "=r" (sr));
+  if ((sr & SR_IPL) < ceil)
+    {
+      unsigned int raised = (sr & ~SR_IPL) | ceil;
+
+      __asm__ volatile ("mov\t%0, SR" : : "r" (raised) : "memory");
+    }
+  return sr & SR_IPL;
+}
+
+static inline void
+ipl_restore (unsigned int ipl)
+{
+  unsigned int sr;
+
+  __asm__ volatile ("mov\tSR, %0" : "=r" (sr));
+  sr = (sr & ~SR_IPL) | ipl;
+  __asm__ volatile ("mov\t%0, SR" : : "r" (sr) : "memory");
+}
+
+void
+__retarget_lock_init (_LOCK_T *lock)
+{
+  /* A lock that cannot be allocated is left NULL, and never excludes
+     anything.  */
+  *lock = calloc (1, sizeof (struct __lock));
+}
+
+void
+__retarget_lock_init_recursive (_LOCK_T *lock)
+{
+  __retarget_lock_init (lock);
+}
+
+void
+__retarget_lock_close (_LOCK_T lock)
+{
+  free (lock);
+}
+
+void
+__retarget_lock_close_recursive (_LOCK_T lock)
+{
+  free (lock);
+}
+
+/* Take LOCK for SELF if it is free or already SELF's, and return
+   nonzero if it was.  Otherwise, if WAIT, count SELF as a waiter.  */
+static int
+task_take (_LOCK_T lock,
+       void *self,
+       int wait)
+{
+  unsigned int ipl = ipl_raise ();
+  int taken = lock->owner == NULL || lock->owner == self;
+
+  if (taken)
+    {
+      lock->owner = self;
+      lock->depth++;
+    }
+  else if (wait)
+    lock->waiters++;
+  ipl_restore (ipl);
+  return taken;
+}
+
+/* The acquire of all the entry points, CALLER being where the library
+   took the lock.  */
+static void
+acquire (_LOCK_T lock,
+       void *caller)
+{
+  void *self;
+  unsigned int ipl;
+
+  if (lock == NULL)
+    return;
+  self = __pic30_lock_self ();
+  if (self == NULL)
+    {
+#ifdef LOCK_DISI
+      __asm__ volatile ("disi\t#0x3fff" : : : "memory");
+#ifdef LOCK_STATS
+      if (disi_depth++ == 0)
+	{
+	  disi_t0 = __lockstats_clock ();
+	  disi_caller = caller;
+	  disi_lock = lock;
+	}
+#else
+      disi_depth++;
+#endif
+#else
+      ipl = ipl_raise ();
+      if (lock->depth++ == 0)
+	{
+	  lock->ipl = ipl;
+#ifdef LOCK_STATS
+	  lock->t0 = __lockstats_clock ();
+	  lock->caller = caller;
+#endif
+	}
+#endif
+      return;
+    }
+  while (!task_take (lock, self, 1))
+    {
+      __pic30_lock_wait (lock);
+      ipl = ipl_raise ();
+      lock->waiters--;
+      ipl_restore (ipl);
+    }
+}
+
+void
+__retarget_lock_acquire_recursive (_LOCK_T lock)
+{
+  acquire (lock, __builtin_return_address (0));
+}
+
+void
+__retarget_lock_acquire (_LOCK_T lock)
+{
+  acquire (lock, __builtin_return_address (0));
+}
+
+int
+__retarget_lock_try_acquire_recursive (_LOCK_T lock)
+{
+  void *self;
+
+  if (lock == NULL)
+    return 1;
+  self = __pic30_lock_self ();
+  if (self == NULL)
+    {
+      /* Nothing can hold it while this runs.  */
+      acquire (lock, __builtin_return_address (0));
+      return 1;
+    }
+  return task_take (lock, self, 0);
+}
+
+int
+__retarget_lock_try_acquire (_LOCK_T lock)
+{
+  return __retarget_lock_try_acquire_recursive (lock);
+}
+
+void
+__retarget_lock_release_recursive (_LOCK_T lock)
+{
+  unsigned int ipl;
+  int wake = 0;
+
+  if (lock == NULL)
+    return;
+  if (lock->owner == NULL)
+    {
+#ifdef LOCK_DISI
+      if (--disi_depth == 0)
+	{
+#ifdef LOCK_STATS
+	  __lockstats_record (lock_class (disi_lock), disi_t0, disi_caller);
+#endif
+	  __asm__ volatile ("clr\tDISICNT" : : : "memory");
+	}
+#else
+      if (--lock->depth == 0)
+	{
+#ifdef LOCK_STATS
+	  __lockstats_record (lock_class (lock), lock->t0, lock->caller);
+#endif
+	  ipl_restore (lock->ipl);
+	}
+#endif
+      return;
+    }
+  ipl = ipl_raise ();
+  if (--lock->depth == 0)
+    {
+      lock->owner = NULL;
+      wake = lock->waiters != 0;
+    }
+  ipl_restore (ipl);
+  if (wake)
+    __pic30_lock_wake (lock);
+}
+
+void
+__retarget_lock_release (_LOCK_T lock)
+{
+  __retarget_lock_release_recursive (lock);
+}
+
+#endif /* !__SINGLE_THREAD__ && _RETARGETABLE_LOCKING */
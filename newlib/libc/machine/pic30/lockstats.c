@@ -0,0 +1,104 @@
+/* Hold times of the pic30 library locks, see <machine/lock.h>.  The
+   records are only written by the locks, with interrupts masked at the
+   ceiling, so they need no lock of their own.  */
+
+#include <string.h>
+#include <machine/lock.h>
+
+#define SR_IPL		0x00e0
+
+#ifdef LOCK_STATS
+
+static struct lockstat stats[LOCKSTAT_CLASSES];
+
+extern volatile unsigned int TMR2 __attribute__ ((__sfr__));
+extern volatile unsigned int TMR3HLD __attribute__ ((__sfr__));
+
+unsigned long __attribute__ ((weak))
+__lockstats_clock (void)
+{
+  /* Reading the low half latches the high half.  */
+  unsigned int lo = TMR2;
+
+  return ((unsigned long) TMR3HLD << 16) | lo;
+}
+
+void
+__lockstats_record (unsigned int cls,
+	unsigned long t0,
+	void *caller)
+{
+  unsigned long c = __lockstats_clock () - t0, h = c >> 4;
+  struct lockstat *s = &stats[cls];
+  unsigned int bin = 0;
+
+  while (h != 0 && bin < LOCKSTAT_BINS - 1)
+    {
+      h >>= 2;
+      bin++;
+    }
+  s->hist[bin]++;
+  s->count++;
+  if (c > s->max)
+    {
+      s->max = c;
+      s->max_caller = caller;
+    }
+}
+
+/* Run the copy or the clear at IPL 7, so that no lock is released in
+   the middle of it.  */
+static unsigned int
+mask (void)
+{
+  unsigned int sr, raised;
+
+  __asm__ volatile ("mov\tSR, %0" : "=r" (sr));
+  raised = sr | SR_IPL;
+  __asm__ volatile ("mov\t%0, SR" : : "r" (raised) : "memory");
+  return sr & SR_IPL;
+}
+
+static void
+unmask (unsigned int ipl)
+{
+  unsigned int sr;
+
+  __asm__ volatile ("mov\tSR, %0" : "=r" (sr));
+  sr = (sr & ~SR_IPL) | ipl;
+  __asm__ volatile ("mov\t%0, SR" : : "r" (sr) : "memory");
+}
+
+int
+__libc_lockstats (struct lockstat *dst)
+{
+  unsigned int ipl = mask ();
+
+  memcpy (dst, stats, sizeof stats);
+  unmask (ipl);
+  return 0;
+}
+
+void
+__libc_lockstats_reset (void)
+{
+  unsigned int ipl = mask ();
+
+  memset (stats, 0, sizeof stats);
+  unmask (ipl);
+}
+
+#else /* !LOCK_STATS */
+
+int
+__libc_lockstats (struct lockstat *dst)
+{
+  return -1;
+}
+
+void
+__libc_lockstats_reset (void)
+{
+}
+
+#endif /* !LOCK_STATS */
@@ -0,0 +1,49 @@
+/* Byte order for pic30, which is little-endian.
+
+   XC16's GCC has no __builtin_bswap16, and expands __builtin_bswap32
+   to a library call, so the swaps are SWAP instructions instead: one
+   for 16 bits, and one per word plus an EXCH for 32.  Constants are
+   still folded at compile time.  */
+
+#ifndef __MACHINE_ENDIAN_H__
+#error "must be included via <machine/endian.h>"
+#endif /* !__MACHINE_ENDIAN_H__ */
+
+#define	_LITTLE_ENDIAN	1234
+#define	_BIG_ENDIAN	4321
+#define	_PDP_ENDIAN	3412
+#define	_BYTE_ORDER	_LITTLE_ENDIAN
+
+#define	__machine_bswap_defined
+
+static __inline __uint16_t
+__pic30_bswap16(__uint16_t _x)
+{
+
+	__asm__("swap\t%0" : "+r" (_x));
+	return (_x);
+}
+
+static __inline __uint32_t
+__pic30_bswap32(__uint32_t _x)
+{
+
+	__asm__("swap\t%0\n\tswap\t%d0\n\texch\t%0, %d0" : "+r" (_x));
+	return (_x);
+}
+
+#define	__bswap16_const(_x)	\
+	((__uint16_t)((((__uint16_t)(_x)) >> 8) | (((__uint16_t)(_x)) << 8)))
+#define	__bswap32_const(_x)	\
+	((__uint32_t)((((__uint32_t)(_x)) >> 24) |	\
+	    ((((__uint32_t)(_x)) >> 8) & 0xff00UL) |	\
+	    ((((__uint32_t)(_x)) << 8) & 0xff0000UL) |	\
+	    (((__uint32_t)(_x)) << 24)))
+
+#define	__bswap16(_x)	(__builtin_constant_p(_x) ?	\
+	__bswap16_const(_x) : __pic30_bswap16(_x))
+#define	__bswap32(_x)	(__builtin_constant_p(_x) ?	\
+	__bswap32_const(_x) : __pic30_bswap32(_x))
+#define	__bswap64(_x)	\
+	((((__uint64_t)__bswap32((__uint32_t)(_x))) << 32) |	\
+	    __bswap32((__uint32_t)(((__uint64_t)(_x)) >> 32)))
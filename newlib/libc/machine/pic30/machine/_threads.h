@@ -0,0 +1,35 @@
+/* The C11 thread types for the cooperative scheduler of the pic30
+   BSP, see libgloss/pic30/threads.c.  */
+
+#ifndef _MACHINE__THREADS_H_
+#define	_MACHINE__THREADS_H_
+
+#include <machine/_default_types.h>
+
+struct __pic30_thread;
+
+typedef struct __pic30_thread *thrd_t;
+
+typedef struct {
+	struct __pic30_thread *_owner;	/* NULL when free */
+	unsigned int _depth;		/* times taken by _owner */
+	int _type;			/* mtx_plain, mtx_recursive, mtx_timed */
+} mtx_t;
+
+typedef struct {
+	unsigned int _waiters;		/* threads in cnd_wait */
+	unsigned int _signals;		/* of those, how many may return */
+} cnd_t;
+
+/* Index into the thread's table of PIC30_TSS_MAX values */
+typedef unsigned int tss_t;
+
+typedef struct {
+	unsigned char _flags;		/* 0, 1 running, 2 done */
+} once_flag;
+
+#define	ONCE_FLAG_INIT { 0 }
+
+#define	TSS_DTOR_ITERATIONS 4
+
+#endif /* _MACHINE__THREADS_H_ */
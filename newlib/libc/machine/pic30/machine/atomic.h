@@ -0,0 +1,220 @@
+/* Atomic operations on 16- and 32-bit words for pic30.
+
+   An interrupt is only taken between two instructions, so a single
+   instruction can't be interrupted partway.  That makes these atomic:
+   - 16-bit loads and stores;
+   - 32-bit loads and stores, which are one MOV.D;
+   - the 16-bit read-modify-writes without a result;
+   - the bit operations, BSET, BCLR, BTG and BTSTS on the word in
+     memory.
+   None of these touch the interrupt state.  The other operations are
+   a few instructions long.  A DISI holds off interrupts for just their
+   cycles, which costs one cycle and no SR update.
+
+   DISI does not hold off priority 7 interrupts.  A handler at that
+   priority must not share an object with code that uses anything but
+   the single-instruction operations.
+
+   The objects must be word aligned and in near or far data memory,
+   not in EDS.  <stdatomic.h> goes through the __sync functions in
+   libc/machine/pic30/sync.S, which work the same way.  */
+
+#ifndef	_MACHATOMIC_H_
+#define	_MACHATOMIC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __ATOM_STR(x)	__ATOM_XSTR (x)
+#define __ATOM_XSTR(x)	#x
+
+static __inline__ unsigned int
+atom16_load (const volatile unsigned int *__p)
+{
+  return *__p;
+}
+
+static __inline__ void
+atom16_store (volatile unsigned int *__p, unsigned int __v)
+{
+  *__p = __v;
+}
+
+/* *P += V and the like. */
+static __inline__ void
+atom16_add (volatile unsigned int *__p, unsigned int __v)
+{
+  __asm__ volatile ("add\t%1, [%0], [%0]"
+		    : : "r" (__p), "r" (__v) : "memory", "cc");
+}
+
+static __inline__ void
+atom16_sub (volatile unsigned int *__p, unsigned int __v)
+{
+  __asm__ volatile ("subr\t%1, [%0], [%0]"
+		    : : "r" (__p), "r" (__v) : "memory", "cc");
+}
+
+static __inline__ void
+atom16_and (volatile unsigned int *__p, unsigned int __v)
+{
+  __asm__ volatile ("and\t%1, [%0], [%0]"
+		    : : "r" (__p), "r" (__v) : "memory", "cc");
+}
+
+static __inline__ void
+atom16_or (volatile unsigned int *__p, unsigned int __v)
+{
+  __asm__ volatile ("ior\t%1, [%0], [%0]"
+		    : : "r" (__p), "r" (__v) : "memory", "cc");
+}
+
+static __inline__ void
+atom16_xor (volatile unsigned int *__p, unsigned int __v)
+{
+  __asm__ volatile ("xor\t%1, [%0], [%0]"
+		    : : "r" (__p), "r" (__v) : "memory", "cc");
+}
+
+/* Store V and return the old value.  */
+static __inline__ unsigned int
+atom16_exchange (volatile unsigned int *__p, unsigned int __v)
+{
+  unsigned int __old;
+
+  __asm__ volatile ("disi\t#1\n\t"
+		    "mov\t[%1], %0\n\t"
+		    "mov\t%2, [%1]"
+		    : "=&r" (__old) : "r" (__p), "r" (__v) : "memory");
+  return __old;
+}
+
+/* Add V and return the old value.  */
+static __inline__ unsigned int
+atom16_fetch_add (volatile unsigned int *__p, unsigned int __v)
+{
+  unsigned int __old;
+
+  __asm__ volatile ("disi\t#1\n\t"
+		    "mov\t[%1], %0\n\t"
+		    "add\t%0, %2, [%1]"
+		    : "=&r" (__old) : "r" (__p), "r" (__v) : "memory", "cc");
+  return __old;
+}
+
+/* Store V if *P is OLD.  Return what *P was; the store happened if
+   that is OLD.  The DISI covers the cycles up to the store.  */
+static __inline__ unsigned int
+atom16_cas (volatile unsigned int *__p, unsigned int __old, unsigned int __v)
+{
+  unsigned int __was;
+
+  __asm__ volatile ("disi\t#3\n\t"
+		    "mov\t[%1], %0\n\t"
+		    "cp\t%0, %2\n\t"
+		    "bra\tnz, 1f\n\t"
+		    "mov\t%3, [%1]\n"
+		    "1:"
+		    : "=&r" (__was) : "r" (__p), "r" (__old), "r" (__v)
+		    : "memory", "cc");
+  return __was;
+}
+
+static __inline__ unsigned long
+atom32_load (const volatile unsigned long *__p)
+{
+  unsigned long __v;
+
+  __asm__ volatile ("mov.d\t[%1], %0" : "=r" (__v) : "r" (__p) : "memory");
+  return __v;
+}
+
+static __inline__ void
+atom32_store (volatile unsigned long *__p, unsigned long __v)
+{
+  __asm__ volatile ("mov.d\t%1, [%0]" : : "r" (__p), "r" (__v) : "memory");
+}
+
+static __inline__ void
+atom32_add (volatile unsigned long *__p, unsigned long __v)
+{
+  __asm__ volatile ("disi\t#1\n\t"
+		    "add\t%1, [%0], [%0++]\n\t"
+		    "addc\t%d1, [%0], [%0--]"
+		    : : "r" (__p), "r" (__v) : "memory", "cc");
+}
+
+static __inline__ unsigned long
+atom32_exchange (volatile unsigned long *__p, unsigned long __v)
+{
+  unsigned long __old;
+
+  __asm__ volatile ("disi\t#3\n\t"
+		    "mov.d\t[%1], %0\n\t"
+		    "mov.d\t%2, [%1]"
+		    : "=&r" (__old) : "r" (__p), "r" (__v) : "memory");
+  return __old;
+}
+
+static __inline__ unsigned long
+atom32_fetch_add (volatile unsigned long *__p, unsigned long __v)
+{
+  unsigned long __old;
+
+  __asm__ volatile ("disi\t#3\n\t"
+		    "mov.d\t[%1], %0\n\t"
+		    "add\t%0, %2, [%1++]\n\t"
+		    "addc\t%d0, %d2, [%1--]"
+		    : "=&r" (__old) : "r" (__p), "r" (__v) : "memory", "cc");
+  return __old;
+}
+
+static __inline__ unsigned long
+atom32_cas (volatile unsigned long *__p, unsigned long __old,
+	    unsigned long __v)
+{
+  unsigned long __was;
+
+  __asm__ volatile ("disi\t#6\n\t"
+		    "mov.d\t[%1], %0\n\t"
+		    "cp\t%0, %2\n\t"
+		    "cpb\t%d0, %d2\n\t"
+		    "bra\tnz, 1f\n\t"
+		    "mov.d\t%3, [%1]\n"
+		    "1:"
+		    : "=&r" (__was) : "r" (__p), "r" (__old), "r" (__v)
+		    : "memory", "cc");
+  return __was;
+}
+
+/* Set, clear or toggle bit BIT, a constant from 0 to 15, of the word
+   at P.  */
+#define atom_bit_set(p, bit) \
+  __asm__ volatile ("bset\t[%0], #" __ATOM_STR (bit) \
+		    : : "r" ((volatile unsigned int *) (p)) : "memory")
+#define atom_bit_clear(p, bit) \
+  __asm__ volatile ("bclr\t[%0], #" __ATOM_STR (bit) \
+		    : : "r" ((volatile unsigned int *) (p)) : "memory")
+#define atom_bit_toggle(p, bit) \
+  __asm__ volatile ("btg\t[%0], #" __ATOM_STR (bit) \
+		    : : "r" ((volatile unsigned int *) (p)) : "memory")
+
+/* Set bit BIT of the word at P and return it as it was, 0 or 1.  */
+#define atom_bit_test_and_set(p, bit) \
+  (__extension__ ({ unsigned int __was; \
+		    __asm__ volatile ("mov\t#1, %0\n\t" \
+				      "btsts\t[%1], #" __ATOM_STR (bit) "\n\t" \
+				      "bra\tnz, 1f\n\t" \
+				      "clr\t%0\n" \
+				      "1:" \
+				      : "=&r" (__was) \
+				      : "r" ((volatile unsigned int *) (p)) \
+				      : "memory", "cc"); \
+		    __was; }))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _MACHATOMIC_H_ */
@@ -0,0 +1,46 @@
+/* Checksums of a block, alone or taken while copying it.
+
+   A protocol stack that copies a frame and then checksums the copy
+   reads every byte twice; memcpy_crc16 and its relatives read it once.
+   Each takes the checksum so far and returns it updated, so a frame
+   can be done in pieces:
+   - crc16 is the CCITT CRC, polynomial 0x1021, high bit first and
+     without a final inversion: start from 0xffff for CRC-16/CCITT-FALSE
+     or from 0 for XMODEM;
+   - crc32 is that of Ethernet and zlib, reflected and inverted at both
+     ends inside, so start from 0 and "123456789" gives 0xcbf43926;
+   - fletcher16 is the Fletcher checksum modulo 255, the second sum in
+     the high byte; start from 0.  */
+
+#ifndef	_MACHCRC_H_
+#define	_MACHCRC_H_
+
+#include <stddef.h>
+#include <sys/_stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint16_t memcrc16 (const void *, size_t, uint16_t);
+extern uint32_t memcrc32 (const void *, size_t, uint32_t);
+extern uint16_t memfletcher16 (const void *, size_t, uint16_t);
+
+/* Copy N bytes to DST, as memcpy, and checksum them on the way.  */
+extern uint16_t memcpy_crc16 (void *, const void *, size_t, uint16_t);
+extern uint32_t memcpy_crc32 (void *, const void *, size_t, uint32_t);
+extern uint16_t memcpy_fletcher16 (void *, const void *, size_t, uint16_t);
+
+extern size_t __crc_hw_min;
+
+/* Hooks for the CRC module of the board, see
+   libc/machine/pic30/memcpy_crc.c.  The defaults have no module to
+   offer, so every block is done in software.  */
+extern int __pic30_crc16 (void *, const void *, size_t, uint16_t *);
+extern int __pic30_crc32 (void *, const void *, size_t, uint32_t *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _MACHCRC_H_ */
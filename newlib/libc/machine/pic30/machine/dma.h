@@ -0,0 +1,43 @@
+#ifndef	_MACHDMA_H_
+#define	_MACHDMA_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A copy or fill running on a DMA channel, or DMA_DONE for one that
+   has already finished.  */
+typedef int dma_handle_t;
+
+#define DMA_DONE	(-1)
+
+/* Start copying or filling N bytes at DST and return DST; *HANDLE is
+   set for memcpy_wait.  Blocks smaller than __dma_async_min, 64 unless
+   changed, are done at once with memcpy or memset, and so are larger
+   ones when no channel is free.  Until memcpy_wait returns, DST must
+   not be looked at and SRC must not be changed.  */
+extern void *memcpy_async (void *, const void *, size_t, dma_handle_t *);
+extern void *memset_async (void *, int, size_t, dma_handle_t *);
+
+/* Wait for HANDLE to finish.  */
+extern void memcpy_wait (dma_handle_t);
+
+/* Nonzero once HANDLE has finished.  */
+extern int memcpy_done (dma_handle_t);
+
+extern size_t __dma_async_min;
+
+/* Hooks for the board's DMA channels, see libc/machine/pic30/dma_async.c.
+   The defaults have no channel to offer, so every block is done at
+   once.  */
+extern int __pic30_dma_copy (void *, const void *, size_t);
+extern int __pic30_dma_fill (void *, int, size_t);
+extern int __pic30_dma_busy (int);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _MACHDMA_H_ */
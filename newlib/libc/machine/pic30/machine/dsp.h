@@ -0,0 +1,192 @@
+/* Q15 block math kernels for pic30 (libm/machine/pic30).
+
+   q15_t is a signed 1.15 fraction, q31_t a signed 1.31 fraction.  On
+   parts with a DSP engine the kernels run on the MAC unit with
+   saturating accumulators; elsewhere portable C versions are used,
+   which agree with them whenever no intermediate sum saturates.
+
+   The prefetching kernels read one operand through the Y AGU, so on
+   DSP parts the arrays documented as "Y data space" must be placed
+   there, for example with __attribute__ ((space (ymemory))); all
+   other arrays must be in X data space, which is where ordinary data
+   goes by default.  */
+
+#ifndef _MACHINE_DSP_H_
+#define _MACHINE_DSP_H_
+
+#include "_ansi.h"
+
+_BEGIN_STD_C
+
+typedef int q15_t;
+typedef long q31_t;
+
+#define Q15(x) ((q15_t) ((x) < 1.0 ? (x) * 32768.0 : 32767))
+
+/* FIR state.  delay needs 2 * ntaps elements, zeroed, and pos must
+   start at 0.  coeffs (Y data space) are in natural order, h[0]
+   multiplying the newest sample.  */
+typedef struct
+{
+  const q15_t *coeffs;
+  q15_t *delay;
+  unsigned int ntaps;
+  unsigned int pos;
+} q15_fir_t;
+
+/* A complex Q15 value, as the FFTs store it.  */
+typedef struct
+{
+  q15_t re;
+  q15_t im;
+} q15c_t;
+
+/* The largest FFT, as log2 of its points.  */
+#define Q15_FFT_MAXLOG2	10
+
+/* Direct form I biquad section.  coeffs (Y data space) holds b0, b1,
+   b2, -a1, -a2 in Q14; state must start zeroed.  */
+typedef struct
+{
+  const q15_t *coeffs;
+  q15_t state[5];
+} q15_biquad_t;
+
+/* y in Y data space.  */
+q15_t	q15_dot (const q15_t *, const q15_t *, unsigned int);
+q31_t	q15_dot_q31 (const q15_t *, const q15_t *, unsigned int);
+void	q15_vadd (q15_t *, const q15_t *, const q15_t *, unsigned int);
+void	q15_vscale (q15_t *, const q15_t *, q15_t, unsigned int);
+void	q15_fir (q15_t *, const q15_t *, unsigned int, q15_fir_t *);
+void	q15_biquad (q15_t *, const q15_t *, unsigned int, q15_biquad_t *);
+
+/* In-place FFTs of 2^log2n points, 1 <= log2n <= Q15_FFT_MAXLOG2.
+   q15_fft scales by 1/2^log2n, so that nothing overflows for points
+   of magnitude up to 1, and q15_ifft does not scale, so that it
+   undoes q15_fft; it saturates where the exact inverse would not
+   fit.  q15_rfft takes 2^log2n real samples, 2 <= log2n, and leaves
+   bins 0 to 2^(log2n-1) - 1 of their spectrum, scaled likewise, as
+   complex values in place, with the real bin 2^(log2n-1) in the
+   imaginary part of bin 0.  q15_bitrev puts the points in
+   bit-reversed order.  On DSP parts the data must be in Y data space
+   and aligned to its size in bytes.  */
+void	q15_fft (q15c_t *, unsigned int);
+void	q15_ifft (q15c_t *, unsigned int);
+void	q15_rfft (q15_t *, unsigned int);
+void	q15_bitrev (q15c_t *, unsigned int);
+
+/* 16 CORDIC iterations of shifts and additions, good to 2 in 2^15.
+   Angles are fractions of pi, -1 to 1 covering -pi to pi.
+   cordic_polar_q15 (y, x, &r) returns the angle of (x, y) and stores
+   its magnitude, saturated to 0x7fff, in r; cordic_sincos_q15 (a, &s,
+   &c) stores the sine and cosine of a in s and c.  */
+q15_t	cordic_polar_q15 (q15_t, q15_t, q15_t *);
+void	cordic_sincos_q15 (q15_t, q15_t *, q15_t *);
+
+/* The square root of an integer below 2^16, respectively 2^32,
+   rounded down.  */
+unsigned int	isqrt16 (unsigned int);
+unsigned int	isqrt32 (unsigned long);
+
+/* Horner's rule: c[0] x^(n-1) + c[1] x^(n-2) + ... + c[n-1], with
+   each step y * x + c[i] summed in a wide accumulator and saturated
+   once; a step is within 2^-28 of the exact one.  c may be const data
+   in program memory.  n = 0 gives 0.  */
+q31_t	polyeval_q31 (q31_t, const q31_t *, unsigned int);
+
+/* Conversions between float and Q15 or Q31, without the soft-float
+   routines a cast would call.  Towards Q15 and Q31 the value is
+   rounded to nearest, ties away from zero, and saturated, NaN giving
+   0; towards float it is exact, except that a Q31 value with more
+   than 24 significant bits is rounded to nearest even.  The array
+   versions convert n elements of s into d.  */
+q15_t	f32_to_q15 (float);
+float	q15_to_f32 (q15_t);
+q31_t	f32_to_q31 (float);
+float	q31_to_f32 (q31_t);
+void	f32_to_q15_array (q15_t *, const float *, unsigned int);
+void	q15_to_f32_array (float *, const q15_t *, unsigned int);
+void	f32_to_q31_array (q31_t *, const float *, unsigned int);
+void	q31_to_f32_array (float *, const q31_t *, unsigned int);
+
+/* A circular buffer of Q15 samples, such as a filter delay line.  pos
+   is where the next sample goes, so the newest samples end just before
+   it.  len is at most 16384.
+
+   On DSP parts circ_dot_q15 runs one REPEAT'ed MAC loop across the
+   wrap, with X modulo addressing on the buffer.  It saves MODCON,
+   XMODSRT and XMODEND and restores them on the way out.  For that the
+   buffer must be in X data space and aligned to the smallest power of
+   two not below its size in bytes: 64 bytes for 17 to 32 samples.
+   Other buffers, and all buffers on other parts, take two runs, one
+   on each side of the wrap, summed before rounding.  While the loop
+   runs, an interrupt handler that used w8 as a pointer would see it
+   wrap too.  */
+typedef struct
+{
+  q15_t *buf;
+  unsigned int len;
+  unsigned int pos;
+} circbuf_t;
+
+/* Use the LEN samples at BUF, cleared, with pos at 0.  */
+void	circ_init (circbuf_t *, q15_t *, unsigned int);
+/* Append N samples; if N is more than len, the last len of them.  */
+void	circ_memcpy_in (circbuf_t *, const q15_t *, unsigned int);
+/* Copy out the N newest samples, N at most len, oldest first.  */
+void	circ_memcpy_out (q15_t *, const circbuf_t *, unsigned int);
+/* The dot product of the N newest samples, oldest first, with h (Y
+   data space), rounded and saturated to Q15 as by q15_dot.  h[0]
+   multiplies the oldest, so it holds the coefficients of q15_fir_t
+   reversed.  N is at most len.  */
+q15_t	circ_dot_q15 (const circbuf_t *, const q15_t *, unsigned int);
+
+/* PID controllers, stepped once per sample with the error (setpoint
+   minus measurement) and returning the new output, clamped to
+   [min, max].  ki and kd are per sample: Ki Ts and Kd / Ts.
+
+   The Q15 one works in the velocity form
+
+	u[n] = u[n-1] + 2^shift (a0 e[n] + a1 e[n-1] + a2 e[n-2])
+
+   with a0 = kp + ki + kd, a1 = -(kp + 2 kd) and a2 = kd, so the
+   integral is the clamped output itself and cannot wind up.  On DSP
+   parts the sum runs on accumulator A with 9.31 saturation and is
+   stored with SAC.R; the step has no loops and takes some 30 cycles,
+   so it can be called from an interrupt handler.  pid_q15_init
+   returns -1, leaving the controller alone, if a coefficient does not
+   fit in Q15, and 0 otherwise; the gains are kp, ki and kd times
+   2^shift, shift at most 15.  out may be set for a bumpless start.
+
+   The float one integrates separately and stops integrating while the
+   output is clamped and the error would drive it further out.  */
+typedef struct
+{
+  q15_t a[3];
+  q15_t e[2];
+  q15_t out;
+  q15_t min;
+  q15_t max;
+  int sft;	/* -shift, for SFTAC */
+} pid_q15_t;
+
+typedef struct
+{
+  float kp;
+  float ki;
+  float kd;
+  float min;
+  float max;
+  float integ;
+  float prev;
+} pid_f32_t;
+
+int	pid_q15_init (pid_q15_t *, q15_t, q15_t, q15_t, unsigned int,
+		      q15_t, q15_t);
+q15_t	pid_q15_step (pid_q15_t *, q15_t);
+void	pid_f32_init (pid_f32_t *, float, float, float, float, float);
+float	pid_f32_step (pid_f32_t *, float);
+
+_END_STD_C
+
+#endif /* _MACHINE_DSP_H_ */
@@ -0,0 +1,117 @@
+/* Reduced-accuracy float functions for pic30 (libm/machine/pic30).
+
+   These trade accuracy for speed where a control loop or filter
+   needs a few significant digits quickly.  Each is a short minimax
+   polynomial after a bit-level or one-step range reduction; none
+   sets errno or looks for NaN, infinity or the edges of its domain.
+   The worst errors, measured over the floats in the stated ranges,
+   are:
+
+	__fast_exp2f, __fast_expf	8e-5 relative; the result
+					saturates below 2^-125 and
+					above 2^127.99
+	__fast_log2f, __fast_logf	6e-5 relative, x positive and
+					normal
+	__fast_sinf, __fast_cosf	2e-5 absolute, |x| < 2^7 pi/2;
+					larger arguments lose about
+					2^-24 |x| more
+	__fast_atanf, __fast_atan2f	3e-5 absolute;
+					__fast_atan2f (0, 0) is 0
+	cordic_polarf			3e-5 absolute in the angle,
+					2e-7 relative in the
+					magnitude; (0, 0) gives 0, 0
+	cordic_sincosf			3e-5 absolute, |x| <= pi;
+					larger arguments lose about
+					2^-24 |x| more
+
+   cordic_polarf (y, x, &r) returns atan2 (y, x) and stores
+   hypot (x, y) in r, and cordic_sincosf (x, &s, &c) stores sin (x)
+   in s and cos (x) in c.  They run 16 CORDIC iterations of shifts
+   and additions on 32-bit integers, converting to float only at the
+   end.
+
+   rsqrtf (x) is 1 / sqrt (x) to within 0.7 ulp, from the same table
+   seed and Newton steps as the correctly rounded sqrtf; unlike the
+   others it handles zeros, infinities, NaNs and negative x as 1 / x
+   and sqrt would, but does not set errno.
+
+   __compact_expf, __compact_logf and __compact_powf are full-accuracy
+   versions of expf, logf and powf for parts short of flash: short
+   minimax polynomials after bit-level range reduction, with no table
+   and no division.  They handle every argument as fdlibm does and set
+   errno the same way when called through expf, logf and powf.
+   __compact_expf and __compact_logf are within 1 ulp; __compact_powf
+   is within 1.5 ulp while |y log2 x| < 8, and loses about 0.2 ulp per
+   unit of |y log2 x| beyond, a quarter of what the fdlibm powf loses.
+   Building newlib with -DLIBM_COMPACT makes them the functions behind
+   expf, logf and powf.
+
+   Including <fastmath.h> declares them under their own names.
+   Defining _FASTMATH_APPROX before it also maps expf, exp2f, logf,
+   log2f, sinf, cosf, atanf and atan2f to them, and the double
+   functions of the same names too when double is 32 bits.  */
+
+#ifndef _MACHFASTMATH_H
+#define _MACHFASTMATH_H
+
+#include "_ansi.h"
+#include <machine/ieeefp.h>
+
+_BEGIN_STD_C
+
+float	__fast_exp2f (float);
+float	__fast_expf (float);
+float	__fast_log2f (float);
+float	__fast_logf (float);
+float	__fast_sinf (float);
+float	__fast_cosf (float);
+float	__fast_atanf (float);
+float	__fast_atan2f (float, float);
+float	cordic_polarf (float, float, float *);
+void	cordic_sincosf (float, float *, float *);
+float	rsqrtf (float);
+float	__compact_expf (float);
+float	__compact_logf (float);
+float	__compact_powf (float, float);
+
+/* Horner's rule, c[0] x^(n-1) + ... + c[n-1], as polyeval_q31 in
+   <machine/dsp.h>; n = 0 gives 0.  */
+float	polyeval_f32 (float, const float *, unsigned int);
+
+#ifndef __cplusplus
+/* a * b without the C99 Annex G recovery of infinities from NaN
+   products that the * operator gets from __mulsc3; and the
+   cordic_polarf of z, returning its argument and storing its
+   magnitude in r.  */
+float _Complex	cmulf (float _Complex, float _Complex);
+float	cpolarf (float _Complex, float *);
+#endif
+
+_END_STD_C
+
+#ifdef _FASTMATH_APPROX
+
+#define expf(x)		__fast_expf (x)
+#define exp2f(x)	__fast_exp2f (x)
+#define logf(x)		__fast_logf (x)
+#define log2f(x)	__fast_log2f (x)
+#define sinf(x)		__fast_sinf (x)
+#define cosf(x)		__fast_cosf (x)
+#define atanf(x)	__fast_atanf (x)
+#define atan2f(y, x)	__fast_atan2f (y, x)
+
+#ifdef _DOUBLE_IS_32BITS
+#define exp(x)		((double) __fast_expf ((float) (x)))
+#define exp2(x)		((double) __fast_exp2f ((float) (x)))
+#define log(x)		((double) __fast_logf ((float) (x)))
+#undef log2		/* <math.h> has it as log (x) / ln 2 */
+#define log2(x)		((double) __fast_log2f ((float) (x)))
+#define sin(x)		((double) __fast_sinf ((float) (x)))
+#define cos(x)		((double) __fast_cosf ((float) (x)))
+#define atan(x)		((double) __fast_atanf ((float) (x)))
+#define atan2(y, x)	((double) __fast_atan2f ((float) (y), (float) (x)))
+#endif
+
+#endif /* _FASTMATH_APPROX */
+
+#endif /* _MACHFASTMATH_H */
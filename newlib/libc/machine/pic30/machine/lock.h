@@ -0,0 +1,73 @@
+#ifndef	_MACHLOCK_H_
+#define	_MACHLOCK_H_
+
+#include <sys/lock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Interrupt priority the library locks raise the CPU to while they are
+   held, or while they are examined under an RTOS.  Handlers above it
+   must not call the library.  */
+extern unsigned char __lock_ipl _NEAR_DATA;
+
+#ifdef _RETARGETABLE_LOCKING
+
+/* Hooks for an RTOS, see libc/machine/pic30/lock.c.  The defaults do
+   nothing and __pic30_lock_self returns NULL, which leaves the locks
+   excluding only interrupt handlers.  */
+extern void *__pic30_lock_self (void);
+extern void __pic30_lock_wait (_LOCK_T);
+extern void __pic30_lock_wake (_LOCK_T);
+
+#endif /* _RETARGETABLE_LOCKING */
+
+/* How long the library keeps interrupts masked, for a libc built with
+   LOCK_STATS.  Each time the outermost hold of a lock that raises
+   SR.IPL or uses DISI ends, its length in cycles of __lockstats_clock
+   is counted against the class of the lock: the number of holds, a
+   histogram and the longest, with the address the lock was taken
+   from.  Bin 0 of the histogram counts holds under 16 cycles, bin I
+   those under 16 << 2 I, and the last one all the rest.  What the
+   instrumentation adds, a few dozen cycles at each end, is not
+   counted.  Under an RTOS the locks only mask interrupts while they
+   are examined, and those holds are not counted.
+
+   __libc_lockstats copies the LOCKSTAT_CLASSES records to its
+   argument, with every maskable interrupt held off for the copy, and
+   returns 0; without LOCK_STATS it returns -1.
+   __libc_lockstats_reset clears them.  __lockstats_clock reads the
+   Timer2/3 pair that pic30_timer_init and the benchmarks count
+   cycles with; a program that runs another free-running counter may
+   define its own.  */
+#define LOCKSTAT_MALLOC	0
+#define LOCKSTAT_STDIO	1
+#define LOCKSTAT_ENV	2
+#define LOCKSTAT_TZ	3
+#define LOCKSTAT_OTHER	4	/* atexit, arc4random, ... */
+#define LOCKSTAT_CLASSES 5
+
+#define LOCKSTAT_BINS	8
+
+struct lockstat
+{
+  unsigned long count;
+  unsigned long max;
+  void *max_caller;
+  unsigned long hist[LOCKSTAT_BINS];
+};
+
+extern int __libc_lockstats (struct lockstat *);
+extern void __libc_lockstats_reset (void);
+extern unsigned long __lockstats_clock (void);
+
+/* Count a hold of class CLS that started at T0, taken from CALLER;
+   called by the locks with interrupts still masked.  */
+extern void __lockstats_record (unsigned int, unsigned long, void *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _MACHLOCK_H_ */
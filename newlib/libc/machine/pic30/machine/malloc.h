@@ -0,0 +1,23 @@
+#ifndef	_MACHMALLOC_H_
+#define	_MACHMALLOC_H_
+
+/* Heap regions for malloc_region.  The application hands each one a
+   buffer placed with the matching space attribute, e.g.
+
+	static char dma_heap[1024] __attribute__ ((space (dma)));
+	malloc_region_add (REGION_DMA, dma_heap, sizeof dma_heap);
+
+   Near data is reachable with single-instruction file register
+   addressing, EDS memory needs DSRPAG/DSWPAG and only DMA RAM can be
+   reached by the DMA controller on parts that restrict it.  */
+
+#define REGION_NEAR	1
+#define REGION_EDS	2
+#define REGION_DMA	3
+#define MALLOC_REGIONS	4
+
+/* Interrupt priority the malloc lock raises the CPU to.  Handlers
+   above it must not allocate.  */
+extern unsigned char __malloc_ipl _NEAR_DATA;
+
+#endif	/* _MACHMALLOC_H_ */
@@ -0,0 +1,69 @@
+/* Small matrix kernels for pic30 (libm/machine/pic30).
+
+   Matrices are arrays in row-major order: an M x N matrix holds row 0,
+   then row 1, and so on, N elements each.  The result of a product
+   must not overlap its operands.
+
+   The Q15 products sum each element on the MAC unit, as q15_dot does
+   (see <machine/dsp.h>), and round and saturate it once.  Its Y
+   prefetch can only step by a fixed amount, so the kernels take the
+   right hand operand transposed, one row for each column of the
+   result; q15_mat_mul and q15_mat_mul_q31 transpose B into BT first,
+   which then holds N x P elements and must be in Y data space.  The
+   _t versions take BT as it is, for a matrix that is stored
+   transposed to begin with, such as a constant gain.  N is at most
+   16384.
+
+   The float products on 2 x 2, 3 x 3 and 4 x 4 matrices are unrolled.
+   f32_mat3_inv returns -1, leaving D alone, when A is singular, and 0
+   otherwise; D may be A.  */
+
+#ifndef _MACHINE_MATRIX_H_
+#define _MACHINE_MATRIX_H_
+
+#include "_ansi.h"
+#include <machine/dsp.h>
+
+_BEGIN_STD_C
+
+/* C (M x P) = A (M x N) B (N x P).  */
+void	q15_mat_mul (q15_t *, const q15_t *, const q15_t *, q15_t *,
+		     unsigned int, unsigned int, unsigned int);
+void	q15_mat_mul_q31 (q31_t *, const q15_t *, const q15_t *, q15_t *,
+			 unsigned int, unsigned int, unsigned int);
+/* C (M x P) = A (M x N) BT (P x N) transposed; BT in Y data space.  */
+void	q15_mat_mul_t (q15_t *, const q15_t *, const q15_t *,
+		       unsigned int, unsigned int, unsigned int);
+void	q15_mat_mul_t_q31 (q31_t *, const q15_t *, const q15_t *,
+			   unsigned int, unsigned int, unsigned int);
+/* D (N x M) = S (M x N) transposed.  */
+void	q15_mat_trans (q15_t *, const q15_t *, unsigned int, unsigned int);
+
+void	f32_mat_mul (float *, const float *, const float *,
+		     unsigned int, unsigned int, unsigned int);
+void	f32_mat2_mul (float *, const float *, const float *);
+void	f32_mat3_mul (float *, const float *, const float *);
+void	f32_mat4_mul (float *, const float *, const float *);
+void	f32_mat_trans (float *, const float *, unsigned int, unsigned int);
+/* D = A + B, A - B and K A, over the N elements of each.  */
+void	f32_mat_add (float *, const float *, const float *, unsigned int);
+void	f32_mat_sub (float *, const float *, const float *, unsigned int);
+void	f32_mat_scale (float *, const float *, float, unsigned int);
+float	f32_mat3_det (const float *);
+int	f32_mat3_inv (float *, const float *);
+
+/* The Clarke transform of the phase currents A and B of a balanced
+   three-phase system to ALPHA and BETA; the Park transform of those,
+   with the sine and cosine of the rotor angle, to D and Q; and the
+   inverse Park transform back.  The Q15 versions round, and saturate
+   where the result would not fit.  */
+void	q15_clarke (q15_t, q15_t, q15_t *, q15_t *);
+void	q15_park (q15_t, q15_t, q15_t, q15_t, q15_t *, q15_t *);
+void	q15_ipark (q15_t, q15_t, q15_t, q15_t, q15_t *, q15_t *);
+void	f32_clarke (float, float, float *, float *);
+void	f32_park (float, float, float, float, float *, float *);
+void	f32_ipark (float, float, float, float, float *, float *);
+
+_END_STD_C
+
+#endif /* _MACHINE_MATRIX_H_ */
@@ -0,0 +1,135 @@
+/* A lock-free byte ring between one producer and one consumer.
+
+   It is for passing data between an interrupt handler and a task: a
+   UART receive handler and the task that reads the data, or a task
+   and the transmit handler that drains it.  Only the producer calls
+   ring_put and ring_write, and only the consumer calls ring_get and
+   ring_read.  Neither side needs a critical section, because:
+   - each index is written by one side and read by the other;
+   - a 16-bit store is atomic;
+   - a byte is stored before the index that publishes it.
+
+   The size is a power of two, up to 32768.  head and tail run freely
+   and are masked only to index the buffer, so a full ring holds all
+   its bytes.  Blocks such as CAN frames or pairs of ADC sample bytes
+   go in with ring_write, which writes all of them or none, so the
+   consumer never sees half of one.  */
+
+#ifndef	_MACHRING_H_
+#define	_MACHRING_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ring
+{
+  unsigned char *buf;
+  unsigned int mask;		/* size - 1 */
+  volatile unsigned int head;	/* bytes put, written by the producer */
+  volatile unsigned int tail;	/* bytes taken, written by the consumer */
+};
+
+/* For a static ring over the array BUF.  */
+#define RING_INITIALIZER(buf) { (buf), sizeof (buf) - 1, 0, 0 }
+
+/* Keeps the compiler from moving the buffer access past the index
+   update; the core does not reorder accesses to memory.  */
+#define __ring_barrier() __asm__ volatile ("" : : : "memory")
+
+static __inline__ void
+ring_init (struct ring *__r, unsigned char *__buf, unsigned int __size)
+{
+  __r->buf = __buf;
+  __r->mask = __size - 1;
+  __r->head = 0;
+  __r->tail = 0;
+}
+
+/* Bytes waiting, as seen from either side.  */
+static __inline__ unsigned int
+ring_count (const struct ring *__r)
+{
+  return __r->head - __r->tail;
+}
+
+/* Room left, as seen from either side.  */
+static __inline__ unsigned int
+ring_space (const struct ring *__r)
+{
+  return __r->mask + 1 - (__r->head - __r->tail);
+}
+
+/* Put C and return 1, or return 0 if the ring is full.  */
+static __inline__ int
+ring_put (struct ring *__r, unsigned char __c)
+{
+  unsigned int __h = __r->head;
+
+  if (__h - __r->tail > __r->mask)
+    return 0;
+  __r->buf[__h & __r->mask] = __c;
+  __ring_barrier ();
+  __r->head = __h + 1;
+  return 1;
+}
+
+/* Take and return the oldest byte, or return -1 if the ring is
+   empty.  */
+static __inline__ int
+ring_get (struct ring *__r)
+{
+  unsigned int __t = __r->tail;
+  unsigned char __c;
+
+  if (__r->head == __t)
+    return -1;
+  __c = __r->buf[__t & __r->mask];
+  __ring_barrier ();
+  __r->tail = __t + 1;
+  return __c;
+}
+
+/* Put the N bytes at SRC and return N, or return 0 if they do not all
+   fit.  */
+static __inline__ size_t
+ring_write (struct ring *__r, const void *__src, size_t __n)
+{
+  const unsigned char *__s = (const unsigned char *) __src;
+  unsigned int __h = __r->head;
+  size_t __i;
+
+  if (__n > __r->mask + 1 - (__h - __r->tail))
+    return 0;
+  for (__i = 0; __i < __n; __i++)
+    __r->buf[(__h + __i) & __r->mask] = __s[__i];
+  __ring_barrier ();
+  __r->head = __h + __n;
+  return __n;
+}
+
+/* Take up to N bytes into DST and return how many were taken.  */
+static __inline__ size_t
+ring_read (struct ring *__r, void *__dst, size_t __n)
+{
+  unsigned char *__d = (unsigned char *) __dst;
+  unsigned int __t = __r->tail;
+  unsigned int __avail = __r->head - __t;
+  size_t __i;
+
+  if (__n > __avail)
+    __n = __avail;
+  for (__i = 0; __i < __n; __i++)
+    __d[__i] = __r->buf[(__t + __i) & __r->mask];
+  __ring_barrier ();
+  __r->tail = __t + __n;
+  return __n;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _MACHRING_H_ */
@@ -0,0 +1,204 @@
+/* ISO/IEC TR 18037 fixed-point functions for pic30
+   (libm/machine/pic30).
+
+   The compiler's <stdfix.h> supplies the type names and limits; this
+   header adds the integer types and functions of TR 18037 7.18a, so a
+   program includes it instead.  It is a machine header because the
+   compiler's own <stdfix.h> comes first on the include path.  Nothing
+   is declared when the compiler has no fixed-point types.
+
+   Besides the functions for every type, _Accum has sqrtk, sink, cosk,
+   atan2k, expk and logk.  They work on the integer bits: the
+   transcendental ones interpolate 129-entry Q15 tables that stay in
+   program memory, and every result saturates to the range of _Accum.
+   Their error is within about 4e-5, relative for expk, plus one unit
+   in the last place of the result.  */
+
+#ifndef _MACHINE_STDFIX_H_
+#define _MACHINE_STDFIX_H_
+
+#include "_ansi.h"
+
+#ifdef __FRACT_FBIT__
+
+#include <stdfix.h>
+#include <machine/_default_types.h>
+
+_BEGIN_STD_C
+
+#if __SFRACT_IBIT__ + __SFRACT_FBIT__ < 8
+typedef __int8_t int_hr_t;
+#elif __SFRACT_IBIT__ + __SFRACT_FBIT__ < 16
+typedef __int16_t int_hr_t;
+#elif __SFRACT_IBIT__ + __SFRACT_FBIT__ < 32
+typedef __int32_t int_hr_t;
+#else
+typedef __int64_t int_hr_t;
+#endif
+#if __FRACT_IBIT__ + __FRACT_FBIT__ < 8
+typedef __int8_t int_r_t;
+#elif __FRACT_IBIT__ + __FRACT_FBIT__ < 16
+typedef __int16_t int_r_t;
+#elif __FRACT_IBIT__ + __FRACT_FBIT__ < 32
+typedef __int32_t int_r_t;
+#else
+typedef __int64_t int_r_t;
+#endif
+#if __LFRACT_IBIT__ + __LFRACT_FBIT__ < 8
+typedef __int8_t int_lr_t;
+#elif __LFRACT_IBIT__ + __LFRACT_FBIT__ < 16
+typedef __int16_t int_lr_t;
+#elif __LFRACT_IBIT__ + __LFRACT_FBIT__ < 32
+typedef __int32_t int_lr_t;
+#else
+typedef __int64_t int_lr_t;
+#endif
+#if __SACCUM_IBIT__ + __SACCUM_FBIT__ < 8
+typedef __int8_t int_hk_t;
+#elif __SACCUM_IBIT__ + __SACCUM_FBIT__ < 16
+typedef __int16_t int_hk_t;
+#elif __SACCUM_IBIT__ + __SACCUM_FBIT__ < 32
+typedef __int32_t int_hk_t;
+#else
+typedef __int64_t int_hk_t;
+#endif
+#if __ACCUM_IBIT__ + __ACCUM_FBIT__ < 8
+typedef __int8_t int_k_t;
+#elif __ACCUM_IBIT__ + __ACCUM_FBIT__ < 16
+typedef __int16_t int_k_t;
+#elif __ACCUM_IBIT__ + __ACCUM_FBIT__ < 32
+typedef __int32_t int_k_t;
+#else
+typedef __int64_t int_k_t;
+#endif
+#if __LACCUM_IBIT__ + __LACCUM_FBIT__ < 8
+typedef __int8_t int_lk_t;
+#elif __LACCUM_IBIT__ + __LACCUM_FBIT__ < 16
+typedef __int16_t int_lk_t;
+#elif __LACCUM_IBIT__ + __LACCUM_FBIT__ < 32
+typedef __int32_t int_lk_t;
+#else
+typedef __int64_t int_lk_t;
+#endif
+#if __USFRACT_IBIT__ + __USFRACT_FBIT__ <= 8
+typedef __uint8_t uint_uhr_t;
+#elif __USFRACT_IBIT__ + __USFRACT_FBIT__ <= 16
+typedef __uint16_t uint_uhr_t;
+#elif __USFRACT_IBIT__ + __USFRACT_FBIT__ <= 32
+typedef __uint32_t uint_uhr_t;
+#else
+typedef __uint64_t uint_uhr_t;
+#endif
+#if __UFRACT_IBIT__ + __UFRACT_FBIT__ <= 8
+typedef __uint8_t uint_ur_t;
+#elif __UFRACT_IBIT__ + __UFRACT_FBIT__ <= 16
+typedef __uint16_t uint_ur_t;
+#elif __UFRACT_IBIT__ + __UFRACT_FBIT__ <= 32
+typedef __uint32_t uint_ur_t;
+#else
+typedef __uint64_t uint_ur_t;
+#endif
+#if __ULFRACT_IBIT__ + __ULFRACT_FBIT__ <= 8
+typedef __uint8_t uint_ulr_t;
+#elif __ULFRACT_IBIT__ + __ULFRACT_FBIT__ <= 16
+typedef __uint16_t uint_ulr_t;
+#elif __ULFRACT_IBIT__ + __ULFRACT_FBIT__ <= 32
+typedef __uint32_t uint_ulr_t;
+#else
+typedef __uint64_t uint_ulr_t;
+#endif
+#if __USACCUM_IBIT__ + __USACCUM_FBIT__ <= 8
+typedef __uint8_t uint_uhk_t;
+#elif __USACCUM_IBIT__ + __USACCUM_FBIT__ <= 16
+typedef __uint16_t uint_uhk_t;
+#elif __USACCUM_IBIT__ + __USACCUM_FBIT__ <= 32
+typedef __uint32_t uint_uhk_t;
+#else
+typedef __uint64_t uint_uhk_t;
+#endif
+#if __UACCUM_IBIT__ + __UACCUM_FBIT__ <= 8
+typedef __uint8_t uint_uk_t;
+#elif __UACCUM_IBIT__ + __UACCUM_FBIT__ <= 16
+typedef __uint16_t uint_uk_t;
+#elif __UACCUM_IBIT__ + __UACCUM_FBIT__ <= 32
+typedef __uint32_t uint_uk_t;
+#else
+typedef __uint64_t uint_uk_t;
+#endif
+#if __ULACCUM_IBIT__ + __ULACCUM_FBIT__ <= 8
+typedef __uint8_t uint_ulk_t;
+#elif __ULACCUM_IBIT__ + __ULACCUM_FBIT__ <= 16
+typedef __uint16_t uint_ulk_t;
+#elif __ULACCUM_IBIT__ + __ULACCUM_FBIT__ <= 32
+typedef __uint32_t uint_ulk_t;
+#else
+typedef __uint64_t uint_ulk_t;
+#endif
+
+short _Fract	abshr (short _Fract);
+_Fract	absr (_Fract);
+long _Fract	abslr (long _Fract);
+short _Accum	abshk (short _Accum);
+_Accum	absk (_Accum);
+long _Accum	abslk (long _Accum);
+short _Fract	roundhr (short _Fract, int);
+_Fract	roundr (_Fract, int);
+long _Fract	roundlr (long _Fract, int);
+short _Accum	roundhk (short _Accum, int);
+_Accum	roundk (_Accum, int);
+long _Accum	roundlk (long _Accum, int);
+unsigned short _Fract	rounduhr (unsigned short _Fract, int);
+unsigned _Fract	roundur (unsigned _Fract, int);
+unsigned long _Fract	roundulr (unsigned long _Fract, int);
+unsigned short _Accum	rounduhk (unsigned short _Accum, int);
+unsigned _Accum	rounduk (unsigned _Accum, int);
+unsigned long _Accum	roundulk (unsigned long _Accum, int);
+int	countlshr (short _Fract);
+int	countlsr (_Fract);
+int	countlslr (long _Fract);
+int	countlshk (short _Accum);
+int	countlsk (_Accum);
+int	countlslk (long _Accum);
+int	countlsuhr (unsigned short _Fract);
+int	countlsur (unsigned _Fract);
+int	countlsulr (unsigned long _Fract);
+int	countlsuhk (unsigned short _Accum);
+int	countlsuk (unsigned _Accum);
+int	countlsulk (unsigned long _Accum);
+int_hr_t	bitshr (short _Fract);
+int_r_t	bitsr (_Fract);
+int_lr_t	bitslr (long _Fract);
+int_hk_t	bitshk (short _Accum);
+int_k_t	bitsk (_Accum);
+int_lk_t	bitslk (long _Accum);
+uint_uhr_t	bitsuhr (unsigned short _Fract);
+uint_ur_t	bitsur (unsigned _Fract);
+uint_ulr_t	bitsulr (unsigned long _Fract);
+uint_uhk_t	bitsuhk (unsigned short _Accum);
+uint_uk_t	bitsuk (unsigned _Accum);
+uint_ulk_t	bitsulk (unsigned long _Accum);
+short _Fract	hrbits (int_hr_t);
+_Fract	rbits (int_r_t);
+long _Fract	lrbits (int_lr_t);
+short _Accum	hkbits (int_hk_t);
+_Accum	kbits (int_k_t);
+long _Accum	lkbits (int_lk_t);
+unsigned short _Fract	uhrbits (uint_uhr_t);
+unsigned _Fract	urbits (uint_ur_t);
+unsigned long _Fract	ulrbits (uint_ulr_t);
+unsigned short _Accum	uhkbits (uint_uhk_t);
+unsigned _Accum	ukbits (uint_uk_t);
+unsigned long _Accum	ulkbits (uint_ulk_t);
+
+_Accum	sqrtk (_Accum);
+_Accum	sink (_Accum);
+_Accum	cosk (_Accum);
+_Accum	atan2k (_Accum, _Accum);
+_Accum	expk (_Accum);
+_Accum	logk (_Accum);
+
+_END_STD_C
+
+#endif /* __FRACT_FBIT__ */
+
+#endif /* _MACHINE_STDFIX_H_ */
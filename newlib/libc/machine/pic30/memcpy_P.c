@@ -0,0 +1,40 @@
+/* memcpy_P for pic30.  Each run that stays inside one TBLPAG page is
+   moved with a REPEAT'ed "tblrdl.b [Ws++], [Wd++]".  */
+
+#include <pgmspace.h>
+
+/* Largest REPEAT count honoured by every family, see asm.h.  */
+#define REPEAT_CHUNK 0x2000
+
+void *
+memcpy_P (void *dst, prog_addr_t src, size_t n)
+{
+  unsigned char *d = dst;
+  unsigned int page = (unsigned int) (src >> 16);
+  unsigned int off = (unsigned int) src;
+
+  while (n != 0)
+    {
+      /* Bytes left before the offset wraps into the next page; zero
+	 means a whole page.  */
+      unsigned int run = -off;
+      unsigned int cnt = n;
+
+      if (run != 0 && cnt > run)
+	cnt = run;
+      if (cnt > REPEAT_CHUNK)
+	cnt = REPEAT_CHUNK;
+      n -= cnt;
+
+      __asm__ volatile ("mov\t%3, TBLPAG\n\t"
+			"dec\t%2, %2\n\t"
+			"repeat\t%2\n\t"
+			"tblrdl.b\t[%1++], [%0++]"
+			: "+r" (d), "+r" (off), "+r" (cnt)
+			: "r" (page)
+			: "memory");
+      if (off == 0)
+	page++;
+    }
+  return dst;
+}
@@ -0,0 +1,167 @@
+/* memcpy_crc16, memcpy_crc32, memcpy_fletcher16 and the checksums
+   alone for pic30, see machine/crc.h.
+
+   The dsPIC33 and PIC24 CRC module is set up by the board, which may
+   also be using it, so it is reached through two hooks, like the DMA
+   channels of dma_async.c.  __pic30_crc16 and __pic30_crc32 checksum N
+   bytes at SRC into *CRC, copying them to DST on the way unless DST is
+   NULL, and return 0, or return -1 if they cannot; the block is then
+   done here.  *CRC is the register of the CRC, which for crc32 is the
+   inverted checksum.  Below __crc_hw_min bytes, setting up the module
+   costs more than the software, so the hooks are not asked at all.
+
+   In software each byte is loaded once, stored and folded into the
+   checksum in the same loop.  A REPEAT loop repeats one instruction,
+   so it cannot carry the fold, and the loops are left to the compiler.
+   The CRC16 fold takes no table; the CRC32 one takes 16 words in
+   flash, a nibble at a time.  */
+
+#include <stddef.h>
+#include <machine/crc.h>
+
+size_t __crc_hw_min = 32;
+
+int __attribute__ ((weak))
+__pic30_crc16 (void *dst, const void *src, size_t n, uint16_t *crc)
+{
+  return -1;
+}
+
+int __attribute__ ((weak))
+__pic30_crc32 (void *dst, const void *src, size_t n, uint32_t *crc)
+{
+  return -1;
+}
+
+static const uint32_t crc32_nibble[16] =
+{
+  0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+  0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+  0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+  0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+
+static __inline__ uint16_t
+crc16_byte (uint16_t crc,
+	unsigned char c)
+{
+  unsigned int x = (crc >> 8) ^ c;
+
+  x ^= x >> 4;
+  return (crc << 8) ^ (x << 12) ^ (x << 5) ^ x;
+}
+
+static __inline__ uint32_t
+crc32_byte (uint32_t crc,
+	unsigned char c)
+{
+  crc ^= c;
+  crc = (crc >> 4) ^ crc32_nibble[crc & 15];
+  return (crc >> 4) ^ crc32_nibble[crc & 15];
+}
+
+/* With 16-bit sums below 255 to start with, 21 bytes can be added
+   before the second sum may overflow.  */
+#define FLETCHER_RUN	21
+
+static uint16_t
+crc16_run (unsigned char *d,
+	const unsigned char *s,
+	size_t n,
+	uint16_t crc)
+{
+  if (n >= __crc_hw_min && __pic30_crc16 (d, s, n, &crc) == 0)
+    return crc;
+  if (d != NULL)
+    while (n-- != 0)
+      crc = crc16_byte (crc, *d++ = *s++);
+  else
+    while (n-- != 0)
+      crc = crc16_byte (crc, *s++);
+  return crc;
+}
+
+static uint32_t
+crc32_run (unsigned char *d,
+	const unsigned char *s,
+	size_t n,
+	uint32_t crc)
+{
+  crc = ~crc;
+  if (n >= __crc_hw_min && __pic30_crc32 (d, s, n, &crc) == 0)
+    return ~crc;
+  if (d != NULL)
+    while (n-- != 0)
+      crc = crc32_byte (crc, *d++ = *s++);
+  else
+    while (n-- != 0)
+      crc = crc32_byte (crc, *s++);
+  return ~crc;
+}
+
+static uint16_t
+fletcher16_run (unsigned char *d,
+	const unsigned char *s,
+	size_t n,
+	uint16_t sum)
+{
+  unsigned int a = (sum & 0xff) % 255, b = (sum >> 8) % 255;
+  size_t run;
+
+  while (n != 0)
+    {
+      run = n < FLETCHER_RUN ? n : FLETCHER_RUN;
+      n -= run;
+      if (d != NULL)
+	while (run-- != 0)
+	  {
+	    a += *d++ = *s++;
+	    b += a;
+	  }
+      else
+	while (run-- != 0)
+	  {
+	    a += *s++;
+	    b += a;
+	  }
+      a %= 255;
+      b %= 255;
+    }
+  return (b << 8) | a;
+}
+
+uint16_t
+memcrc16 (const void *src, size_t n, uint16_t crc)
+{
+  return crc16_run (NULL, src, n, crc);
+}
+
+uint16_t
+memcpy_crc16 (void *dst, const void *src, size_t n, uint16_t crc)
+{
+  return crc16_run (dst, src, n, crc);
+}
+
+uint32_t
+memcrc32 (const void *src, size_t n, uint32_t crc)
+{
+  return crc32_run (NULL, src, n, crc);
+}
+
+uint32_t
+memcpy_crc32 (void *dst, const void *src, size_t n, uint32_t crc)
+{
+  return crc32_run (dst, src, n, crc);
+}
+
+uint16_t
+memfletcher16 (const void *src, size_t n, uint16_t sum)
+{
+  return fletcher16_run (NULL, src, n, sum);
+}
+
+uint16_t
+memcpy_fletcher16 (void *dst, const void *src, size_t n, uint16_t sum)
+{
+  return fletcher16_run (dst, src, n, sum);
+}
@@ -0,0 +1,30 @@
+/* memcpy_eds for pic30.  */
+
+#include "eds.h"
+
+eds_addr_t
+memcpy_eds (eds_addr_t dst, eds_addr_t src, size_t n)
+{
+  eds_addr_t d = dst;
+  unsigned int r, w;
+
+  EDS_SAVE (r, w);
+  while (n != 0)
+    {
+      unsigned int cnt = n;
+
+      if (cnt > EDS_RUN (src))
+	cnt = EDS_RUN (src);
+      if (cnt > EDS_RUN (d))
+	cnt = EDS_RUN (d);
+      if (cnt > REPEAT_CHUNK)
+	cnt = REPEAT_CHUNK;
+      __pic30_eds_pages (EDS_PAGE (src), EDS_PAGE (d));
+      __pic30_eds_copy_up (EDS_PTR (d), EDS_PTR (src), cnt);
+      d += cnt;
+      src += cnt;
+      n -= cnt;
+    }
+  EDS_RESTORE (r, w);
+  return dst;
+}
@@ -0,0 +1,39 @@
+/* memmove_eds for pic30.  An overlapping copy to a higher address is
+   done from the top down in runs that end on page boundaries.  */
+
+#include "eds.h"
+
+eds_addr_t
+memmove_eds (eds_addr_t dst, eds_addr_t src, size_t n)
+{
+  eds_addr_t d;
+  unsigned int r, w;
+
+  if (dst <= src || dst >= src + n)
+    return memcpy_eds (dst, src, n);
+
+  d = dst + n;
+  src += n;
+  EDS_SAVE (r, w);
+  while (n != 0)
+    {
+      unsigned int cnt = n;
+
+      if (cnt > EDS_RUN_DOWN (src))
+	cnt = EDS_RUN_DOWN (src);
+      if (cnt > EDS_RUN_DOWN (d))
+	cnt = EDS_RUN_DOWN (d);
+      if (cnt > REPEAT_CHUNK)
+	cnt = REPEAT_CHUNK;
+      /* The window pointer just past the last byte may wrap to 0, which
+	 the pre-decrement turns back into 0xffff.  */
+      __pic30_eds_pages (EDS_PAGE (src - 1), EDS_PAGE (d - 1));
+      __pic30_eds_copy_down (EDS_PTR (d - 1) + 1, EDS_PTR (src - 1) + 1,
+			     cnt);
+      d -= cnt;
+      src -= cnt;
+      n -= cnt;
+    }
+  EDS_RESTORE (r, w);
+  return dst;
+}
@@ -0,0 +1,45 @@
+/* memset_eds for pic30.  */
+
+#include "eds.h"
+
+eds_addr_t
+memset_eds (eds_addr_t dst, int c, size_t n)
+{
+  eds_addr_t d = dst;
+  unsigned int v = (unsigned char) c * 0x0101U;
+  unsigned int r, w;
+
+  EDS_SAVE (r, w);
+  while (n != 0)
+    {
+      unsigned int cnt = n;
+      unsigned int p = EDS_PTR (d);
+
+      if (cnt > EDS_RUN (d))
+	cnt = EDS_RUN (d);
+      if (cnt > REPEAT_CHUNK)
+	cnt = REPEAT_CHUNK;
+      __pic30_eds_pages (0, EDS_PAGE (d));
+      d += cnt;
+      n -= cnt;
+      if (p & 1)
+	{
+	  __asm__ volatile ("mov.b\t%1, [%0++]"
+			    : "+r" (p) : "r" (v) : "memory");
+	  cnt--;
+	}
+      if (cnt >= 2)
+	{
+	  unsigned int words = cnt >> 1;
+
+	  __asm__ volatile ("dec\t%1, %1\n\t"
+			    "repeat\t%1\n\t"
+			    "mov\t%2, [%0++]"
+			    : "+r" (p), "+r" (words) : "r" (v) : "memory");
+	}
+      if (cnt & 1)
+	__asm__ volatile ("mov.b\t%1, [%0]" : : "r" (p), "r" (v) : "memory");
+    }
+  EDS_RESTORE (r, w);
+  return dst;
+}
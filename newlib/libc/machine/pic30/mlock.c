@@ -0,0 +1,94 @@
+/* __malloc_lock/__malloc_unlock for pic30.  See libc/stdlib/mlock.c
+   for the documentation.
+
+   There are no threads to exclude, only interrupt handlers, so the
+   lock raises the CPU priority (SR.IPL) to __malloc_ipl for as long
+   as it is held.  Handlers at or below that priority may allocate;
+   those above it keep their latency but must not call malloc.  The
+   priority is never lowered, so taking the lock at or above the
+   ceiling costs nothing.
+
+   Built with MALLOC_LOCK_DISI, the lock instead holds off priorities
+   1 to 6 with DISI, which costs no SR update but expires after 16384
+   cycles.  That is only safe where every malloc call is known to be
+   shorter, for example with the TLSF malloc and a small heap.
+
+   Built with LOCK_STATS, the outermost pair also times how long it was
+   held, for __libc_lockstats.
+
+   The lock is recursive: only the outermost pair changes the CPU
+   state.  The object takes the place of the generic one from
+   libc/stdlib when libc.a is put together.  */
+
+#include <malloc.h>
+#include <machine/lock.h>
+
+#ifndef MALLOC_PROVIDED
+
+#define SR_IPL		0x00e0
+#define SR_IPL_SHIFT	5
+
+/* Defaults to 7, which holds off every maskable interrupt.  */
+unsigned char __malloc_ipl _NEAR_DATA = 7;
+
+static unsigned int depth _NEAR_DATA;
+#ifndef MALLOC_LOCK_DISI
+static unsigned int saved_ipl _NEAR_DATA;
+#endif
+#ifdef LOCK_STATS
+static unsigned long t0;
+static void *caller;
+#endif
+
+void
+__malloc_lock (struct _reent *ptr)
+{
+#ifdef MALLOC_LOCK_DISI
+  __asm__ volatile ("disi\t#0x3fff" : : : "memory");
+  depth++;
+#else
+  unsigned int sr, ceil = (unsigned int) __malloc_ipl << SR_IPL_SHIFT;
+
+  /* An interrupt between the read and the write returns with SR as it
+     found it, so the read-modify-write needs no protection.  */
+  __asm__ volatile ("mov\tSR, %0" : "=r" (sr));
+  if ((sr & SR_IPL) < ceil)
+    {
+      unsigned int raised = (sr & ~SR_IPL) | ceil;
+
+      __asm__ volatile ("mov\t%0, SR" : : "r" (raised) : "memory");
+    }
+  if (depth++ == 0)
+    saved_ipl = sr & SR_IPL;
+#endif
+#ifdef LOCK_STATS
+  if (depth == 1)
+    {
+      t0 = __lockstats_clock ();
+      caller = __builtin_return_address (0);
+    }
+#endif
+}
+
+void
+__malloc_unlock (struct _reent *ptr)
+{
+  if (--depth != 0)
+    return;
+#ifdef LOCK_STATS
+  __lockstats_record (LOCKSTAT_MALLOC, t0, caller);
+#endif
+#ifdef MALLOC_LOCK_DISI
+  __asm__ volatile ("clr\tDISICNT" : : : "memory");
+#else
+  {
+    unsigned int sr;
+
+    __asm__ volatile ("mov\tSR, %0" : "=r" (sr));
+    sr = (sr & ~SR_IPL) | saved_ipl;
+    __asm__ volatile ("mov\t%0, SR" : : "r" (sr) : "memory");
+  }
+#endif
+}
+
+#endif /* MALLOC_PROVIDED */
@@ -0,0 +1,101 @@
+/* pmem_read_packed and pmem_memcpy_packed for pic30, see <pgmspace.h>.
+
+   Whole program words are copied three bytes at a time, one TBLRDL
+   and one TBLRDH each, for as many words as stay inside one TBLPAG
+   page.  REPEAT covers only a single instruction, so on parts with a
+   DSP engine the words are read under a DO loop instead; elsewhere in
+   a counted loop.  */
+
+#include <pgmspace.h>
+
+/* Largest count honoured by every family, see asm.h.  */
+#define REPEAT_CHUNK 0x2000
+
+/* Byte POS (0 to 2) of the word at ADDR.  */
+static unsigned char
+word_byte (prog_addr_t addr, unsigned int pos)
+{
+  unsigned int b;
+
+  if (pos == 2)
+    __asm__ ("mov\t%d1, TBLPAG\n\ttblrdh.b\t[%1], %0"
+	     : "=r" (b) : "r" (addr));
+  else
+    return pgm_read_byte (addr + pos);
+  return (unsigned char) b;
+}
+
+unsigned char
+pmem_read_packed (prog_addr_t table, size_t index)
+{
+  return word_byte (table + 2 * (prog_addr_t) (index / 3), index % 3);
+}
+
+void *
+pmem_memcpy_packed (void *dst, prog_addr_t table, size_t index, size_t n)
+{
+  unsigned char *d = dst;
+  prog_addr_t addr = table + 2 * (prog_addr_t) (index / 3);
+  unsigned int pos = index % 3;
+
+  /* The rest of a word the copy starts inside.  */
+  for (; pos != 0 && n != 0; n--)
+    {
+      *d++ = word_byte (addr, pos);
+      if (++pos == 3)
+	{
+	  pos = 0;
+	  addr += 2;
+	}
+    }
+
+  while (n >= 3)
+    {
+      unsigned int page = (unsigned int) (addr >> 16);
+      unsigned int off = (unsigned int) addr;
+      /* Words left before the offset wraps into the next page.  */
+      unsigned int cnt = (unsigned int) (0x10000UL - off) / 2;
+      unsigned int lo, hi;
+
+      if (cnt > n / 3)
+	cnt = n / 3;
+      if (cnt > REPEAT_CHUNK)
+	cnt = REPEAT_CHUNK;
+      n -= 3 * cnt;
+      addr += 2 * (prog_addr_t) cnt;
+
+#ifdef __HAS_DSP__
+      __asm__ volatile ("mov\t%5, TBLPAG\n\t"
+			"dec\t%2, %2\n\t"
+			"do\t%2, 1f\n\t"
+			"tblrdl\t[%1], %3\n\t"
+			"tblrdh\t[%1++], %4\n\t"
+			"mov.b\t%3, [%0++]\n\t"
+			"swap\t%3\n\t"
+			"mov.b\t%3, [%0++]\n"
+			"1:\tmov.b\t%4, [%0++]"
+			: "+r" (d), "+r" (off), "+r" (cnt),
+			  "=&r" (lo), "=&r" (hi)
+			: "r" (page)
+			: "memory");
+#else
+      __asm__ volatile ("mov\t%5, TBLPAG\n"
+			"1:\ttblrdl\t[%1], %3\n\t"
+			"tblrdh\t[%1++], %4\n\t"
+			"mov.b\t%3, [%0++]\n\t"
+			"swap\t%3\n\t"
+			"mov.b\t%3, [%0++]\n\t"
+			"mov.b\t%4, [%0++]\n\t"
+			"dec\t%2, %2\n\t"
+			"bra\tnz, 1b"
+			: "+r" (d), "+r" (off), "+r" (cnt),
+			  "=&r" (lo), "=&r" (hi)
+			: "r" (page)
+			: "memory");
+#endif
+    }
+
+  for (; n != 0; n--)
+    *d++ = word_byte (addr, pos++);
+  return dst;
+}
@@ -0,0 +1,45 @@
+/* printf_P, fprintf_P and vfprintf_P for pic30.
+
+   The format string is copied from program memory onto the stack for
+   the duration of the call and handed to vfprintf, which is the nano
+   formatter when newlib is configured with nano formatted I/O.  The
+   string costs RAM only while it is being printed.  */
+
+#include <_ansi.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <pgmspace.h>
+
+int
+vfprintf_P (FILE *fp, prog_addr_t fmt, va_list ap)
+{
+  size_t len = strlen_P (fmt) + 1;
+  char buf[len];
+
+  memcpy_P (buf, fmt, len);
+  return vfprintf (fp, buf, ap);
+}
+
+int
+fprintf_P (FILE *fp, prog_addr_t fmt, ...)
+{
+  int ret;
+  va_list ap;
+
+  va_start (ap, fmt);
+  ret = vfprintf_P (fp, fmt, ap);
+  va_end (ap);
+  return ret;
+}
+
+int
+printf_P (prog_addr_t fmt, ...)
+{
+  int ret;
+  va_list ap;
+
+  va_start (ap, fmt);
+  ret = vfprintf_P (stdout, fmt, ap);
+  va_end (ap);
+  return ret;
+}
@@ -0,0 +1,18 @@
+/* strcmp_P for pic30: compare a data-space string with one in program
+   memory.  */
+
+#include <pgmspace.h>
+
+int
+strcmp_P (const char *s1, prog_addr_t s2)
+{
+  unsigned char c1, c2;
+
+  do
+    {
+      c1 = (unsigned char) *s1++;
+      c2 = pgm_read_byte (s2++);
+    }
+  while (c1 != '\0' && c1 == c2);
+  return c1 - c2;
+}
@@ -0,0 +1,13 @@
+/* strcpy_P for pic30.  */
+
+#include <pgmspace.h>
+
+char *
+strcpy_P (char *dst, prog_addr_t src)
+{
+  char *d = dst;
+
+  while ((*d++ = pgm_read_byte (src++)) != '\0')
+    ;
+  return dst;
+}
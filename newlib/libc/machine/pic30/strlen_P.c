@@ -0,0 +1,13 @@
+/* strlen_P for pic30.  */
+
+#include <pgmspace.h>
+
+size_t
+strlen_P (prog_addr_t s)
+{
+  prog_addr_t p = s;
+
+  while (pgm_read_byte (p) != '\0')
+    p++;
+  return (size_t) (p - s);
+}
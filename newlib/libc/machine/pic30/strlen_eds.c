@@ -0,0 +1,28 @@
+/* strlen_eds for pic30.  Only DSRPAG is used, so the string may also be
+   in program memory through a PSV page.  */
+
+#include "eds.h"
+
+size_t
+strlen_eds (eds_addr_t s)
+{
+  eds_addr_t a = s;
+  unsigned int r, w;
+
+  EDS_SAVE (r, w);
+  for (;;)
+    {
+      unsigned int run = EDS_RUN (a);
+      unsigned int left = run;
+      const char *q = (const char *) EDS_PTR (a);
+
+      __pic30_eds_pages (EDS_PAGE (a), 0);
+      while (left != 0 && *q != '\0')
+	q++, left--;
+      a += run - left;
+      if (left != 0)
+	break;
+    }
+  EDS_RESTORE (r, w);
+  return (size_t) (a - s);
+}
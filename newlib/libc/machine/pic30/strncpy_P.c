@@ -0,0 +1,20 @@
+/* strncpy_P for pic30.  Like strncpy, the rest of dst is padded with
+   NULs once the source string ends.  */
+
+#include <pgmspace.h>
+
+char *
+strncpy_P (char *dst, prog_addr_t src, size_t n)
+{
+  char *d = dst;
+
+  while (n != 0)
+    {
+      n--;
+      if ((*d++ = pgm_read_byte (src++)) == '\0')
+	break;
+    }
+  while (n-- != 0)
+    *d++ = '\0';
+  return dst;
+}
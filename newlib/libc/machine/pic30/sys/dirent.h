@@ -0,0 +1,32 @@
+/* <sys/dirent.h> for pic30.  There is no kernel with getdents; the
+   directory functions are the BSP's, over its read-only romfs (see
+   pic30-romfs.h in libgloss), and a name is at most MAXNAMLEN bytes.  */
+
+#ifndef _SYS_DIRENT_H
+#define _SYS_DIRENT_H
+
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MAXNAMLEN	63
+
+#define DT_UNKNOWN	0
+#define DT_DIR		4
+#define DT_REG		8
+
+struct dirent {
+  ino_t  d_ino;
+  unsigned char d_type;
+  char   d_name[MAXNAMLEN + 1];
+};
+
+/* Opaque; the BSP keeps a few of them, so opendir allocates nothing.  */
+typedef struct __romfs_dir DIR;
+
+#ifdef __cplusplus
+}
+#endif
+#endif
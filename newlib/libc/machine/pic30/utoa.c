@@ -0,0 +1,72 @@
+/* __utoa/utoa for pic30: decimal goes through __u16toa, with no divide
+   at all; in other bases each digit costs a single div.u, which yields
+   the digit and the remaining value together.  See libc/stdlib/utoa.c
+   for the documentation.
+
+   Decimal takes at most 300 cycles, 400 on the parts with EDS; another
+   base 120 + 60 cycles a digit, or 160 + 80, so at most 1080 or 1440
+   for the 16 digits of base 2.  itoa adds 40, or 60.
+   newlib.bench/wcet.c checks these.  */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../../stdlib/local.h"
+#include "divmod.h"
+
+char *
+__utoa (unsigned value,
+        char *str,
+        int base)
+{
+  const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  int i, j;
+  unsigned remainder;
+  char c;
+
+  /* Check base is supported. */
+  if ((base < 2) || (base > 36))
+    {
+      str[0] = '\0';
+      return NULL;
+    }
+
+  /* Decimal needs no division.  */
+  if (base == 10)
+    {
+      char buf[5];
+      char *p = __u16toa (buf + sizeof buf, value);
+
+      i = buf + sizeof buf - p;
+      memcpy (str, p, i);
+      str[i] = '\0';
+      return str;
+    }
+
+  /* Convert to string. Digits are in reverse order.  */
+  i = 0;
+  do
+    {
+      value = __pic30_udivmod16 (value, (unsigned) base, &remainder);
+      str[i++] = digits[remainder];
+    } while (value != 0);
+
+  str[i] = '\0';
+
+  /* Reverse string.  */
+  for (j = 0, i--; j < i; j++, i--)
+    {
+      c = str[j];
+      str[j] = str[i];
+      str[i] = c;
+    }
+
+  return str;
+}
+
+char *
+utoa (unsigned value,
+        char *str,
+        int base)
+{
+  return __utoa (value, str, base);
+}
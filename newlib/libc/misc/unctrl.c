@@ -65,7 +65,11 @@ No supporting OS subroutines are required.
 static char sccsid[] = "@(#)unctrl.c	8.1 (Berkeley) 6/4/93";
 #endif /* LIBC_SCCS and not lint */
 
+#ifdef __dsPIC30__
+const char __unctrl[256][5] _PSV_CONST = {
+#else
 const char * const __unctrl[256] = {
+#endif
 	"^@",  "^A",  "^B",  "^C",  "^D",  "^E",  "^F",  "^G",
 	"^H",  "^I",  "^J",  "^K",  "^L",  "^M",  "^N",  "^O",
 	"^P",  "^Q",  "^R",  "^S",  "^T",  "^U",  "^V",  "^W",
@@ -101,7 +105,7 @@ const char * const __unctrl[256] = {
 	"0xf8", "0xf9",	"0xfa", "0xfb", "0xfc", "0xfd", "0xfe", "0xff",
 };
 
-const char __unctrllen[256] = {
+const char __unctrllen[256] _PSV_CONST = {
 	2, 2, 2, 2, 2, 2, 2, 2,
 	2, 2, 2, 2, 2, 2, 2, 2,
 	2, 2, 2, 2, 2, 2, 2, 2,
@@ -46,6 +46,8 @@
 #ifdef SNAMES
 #define	matcher	smatcher
 #define	fast	sfast
+#define	dfast	sdfast
+#define	dfastate	sdfastate
 #define	slow	sslow
 #define	dissect	sdissect
 #define	backref	sbackref
@@ -57,6 +59,8 @@
 #ifdef LNAMES
 #define	matcher	lmatcher
 #define	fast	lfast
+#define	dfast	ldfast
+#define	dfastate	ldfastate
 #define	slow	lslow
 #define	dissect	ldissect
 #define	backref	lbackref
@@ -81,6 +85,8 @@ struct match {
 	states fresh;		/* states for a fresh start */
 	states tmp;		/* temporary */
 	states empty;		/* empty set of states */
+	char *ws;		/* regexec_ws() workspace, or NULL */
+	unsigned int yield_steps;	/* see <sys/yield.h> */
 };
 
 /* ========= begin header generated by ./mkh ========= */
@@ -89,11 +95,13 @@ extern "C" {
 #endif
 
 /* === engine.c === */
-static int matcher(struct re_guts *g, char *string, size_t nmatch, regmatch_t pmatch[], int eflags);
+static int matcher(struct re_guts *g, char *string, size_t nmatch, regmatch_t pmatch[], int eflags, char *ws);
 static char *dissect(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static char *backref(struct match *m, char *start, char *stop, sopno startst, sopno stopst, sopno lev);
 static char *fast(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static char *slow(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
+static char *dfast(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
+static int dfastate(struct match *m, states st, states fresh, int bol, short *tr);
 static states step(struct re_guts *g, sopno start, sopno stop, states bef, int ch, states aft);
 #define	BOL	(OUT+1)
 #define	EOL	(BOL+1)
@@ -132,17 +140,21 @@ static char *pchar(int ch);
 /*
  - matcher - the actual matching engine
  == static int matcher(struct re_guts *g, char *string, \
- ==	size_t nmatch, regmatch_t pmatch[], int eflags);
+ ==	size_t nmatch, regmatch_t pmatch[], int eflags, char *ws);
+ *
+ * With a workspace ws (see regexec.c) it takes the space it needs from
+ * there instead of malloc().
  */
 static int			/* 0 success, REG_NOMATCH failure */
-matcher(g, string, nmatch, pmatch, eflags)
+matcher(g, string, nmatch, pmatch, eflags, ws)
 struct re_guts *g;
 char *string;
 size_t nmatch;
 regmatch_t pmatch[];
 int eflags;
+char *ws;
 {
-	char *endp;
+	char *endp = NULL;
 	int i;
 	struct match mv;
 	struct match *m = &mv;
@@ -219,26 +231,48 @@ int eflags;
 	/* match struct setup */
 	m->g = g;
 	m->eflags = eflags;
-	m->pmatch = NULL;
-	m->lastpos = NULL;
+	m->ws = ws;
+	if (ws != NULL) {
+		m->pmatch = (regmatch_t *)ws;
+		m->lastpos = (char **)(ws + WS_LASTPOS(g));
+	} else {
+		m->pmatch = NULL;
+		m->lastpos = NULL;
+	}
 	m->offp = string;
 	m->beginp = start;
 	m->endp = stop;
-	STATESETUP(m, 4);
+	m->yield_steps = 0;
+
+	/* Adjust start according to moffset, to speed things up */
+	if (g->moffset > -1)
+		start = ((dp - g->moffset) < start) ? start : dp - g->moffset;
+
+	/* with a DFA, a plain yes or no needs no state space at all */
+	if (g->dfa != NULL) {
+		endp = dfast(m, start, stop, gf, gl);
+		if (endp == NULL)
+			return(REG_NOMATCH);
+		if (nmatch == 0)
+			return(0);
+	}
+
+	STATESETUP(m, WS_NSETS);
 	SETUP(m->st);
 	SETUP(m->fresh);
 	SETUP(m->tmp);
 	SETUP(m->empty);
 	CLEAR(m->empty);
 
-	/* Adjust start according to moffset, to speed things up */
-	if (g->moffset > -1)
-		start = ((dp - g->moffset) < start) ? start : dp - g->moffset;
-
 	/* this loop does only one repetition except for backrefs */
 	for (;;) {
-		endp = fast(m, start, stop, gf, gl);
+		if (g->dfa == NULL)
+			endp = fast(m, start, stop, gf, gl);
 		if (endp == NULL) {		/* a miss */
+			if (m->pmatch != NULL && ws == NULL)
+				free((char *)m->pmatch);
+			if (m->lastpos != NULL && ws == NULL)
+				free((char *)m->lastpos);
 			STATETEARDOWN(m);
 			return(REG_NOMATCH);
 		}
@@ -332,9 +366,9 @@ int eflags;
 			}
 	}
 
-	if (m->pmatch != NULL)
+	if (m->pmatch != NULL && ws == NULL)
 		free((char *)m->pmatch);
-	if (m->lastpos != NULL)
+	if (m->lastpos != NULL && ws == NULL)
 		free((char *)m->lastpos);
 	STATETEARDOWN(m);
 	return(0);
@@ -561,6 +595,7 @@ sopno lev;			/* PLUS nesting level */
 	cset *cs;
 
 	AT("back", start, stop, startst, stopst);
+	__libc_yield_count(m->yield_steps, stopst - startst);
 	sp = start;
 
 	/* get as far as we can with easy stuff */
@@ -818,6 +853,7 @@ sopno stopst;
 		st = step(m->g, startst, stopst, tmp, c, st);
 		SP("aft", st, c);
 		assert(EQ(step(m->g, startst, stopst, st, NOTHING, st), st));
+		__libc_yield_count(m->yield_steps, stopst - startst);
 		p++;
 	}
 
@@ -829,6 +865,157 @@ sopno stopst;
 		return(NULL);
 }
 
+/*
+ - dfast - fast(), through the lazy DFA
+ == static char *dfast(struct match *m, char *start, char *stop, \
+ ==	sopno startst, sopno stopst);
+ *
+ * The states fast() would reach are those of the DFA states, and a
+ * character moves from one to the next in a table lookup once that
+ * transition has been taken before.  Only new transitions step through
+ * the strip, so the time is linear in the string with a far smaller
+ * constant.
+ */
+static char *			/* where tentative match ended, or NULL */
+dfast(m, start, stop, startst, stopst)
+struct match *m;
+char *start;
+char *stop;
+sopno startst;
+sopno stopst;
+{
+	struct re_dfa *d = m->g->dfa;
+	states st;
+	states fresh;
+	states tmp;
+	char *p = start;
+	int c = (start == m->beginp) ? OUT : *(start-1);
+	int flagch;
+	int i;
+	int cur;
+	int bol;
+	short *tr;
+	char *coldp = NULL;	/* last p after which no match was underway */
+
+	DFASETUP(st, 0);
+	DFASETUP(fresh, 1);
+	DFASETUP(tmp, 2);
+	CLEAR(st);
+	SET1(st, startst);
+	st = step(m->g, startst, stopst, st, NOTHING, st);
+	ASSIGN(fresh, st);
+	bol = m->g->nbol > 0 &&
+	    ((c == '\n' && m->g->cflags&REG_NEWLINE) ||
+	    (c == OUT && !(m->eflags&REG_NOTBOL)));
+	cur = dfastate(m, st, fresh, bol, (short *)NULL);
+
+	for (;; p++) {
+		if (d->flags[cur]&DFA_FRESH)
+			coldp = p;
+		if (p == stop)
+			break;
+		__libc_yield_count(m->yield_steps, 1);
+		tr = &d->trans[cur * d->nclass + d->class[(uch)*p]];
+		if (*tr == 0) {
+			/* first time here: do what fast() does */
+			DFALOAD(st, &d->sets[cur * d->setsize]);
+			c = *p;
+			flagch = '\0';
+			i = 0;
+			if (d->flags[cur]&DFA_BOL) {
+				flagch = BOL;
+				i = m->g->nbol;
+			}
+			if (c == '\n' && m->g->cflags&REG_NEWLINE) {
+				flagch = (flagch == BOL) ? BOLEOL : EOL;
+				i += m->g->neol;
+			}
+			for (; i > 0; i--)
+				st = step(m->g, startst, stopst, st, flagch, st);
+			if (ISSET(st, stopst))
+				*tr = 1;
+			else {
+				ASSIGN(tmp, st);
+				ASSIGN(st, fresh);
+				st = step(m->g, startst, stopst, tmp, c, st);
+				bol = m->g->nbol > 0 &&
+				    c == '\n' && m->g->cflags&REG_NEWLINE;
+				cur = dfastate(m, st, fresh, bol, tr);
+				continue;
+			}
+		}
+		if (*tr == 1) {
+			m->coldp = coldp;
+			return(p+1);
+		}
+		cur = *tr - 2;
+	}
+
+	/* the end of the string, as fast() sees it */
+	DFALOAD(st, &d->sets[cur * d->setsize]);
+	c = (p == m->endp) ? OUT : *p;
+	flagch = '\0';
+	i = 0;
+	if (d->flags[cur]&DFA_BOL) {
+		flagch = BOL;
+		i = m->g->nbol;
+	}
+	if ( (c == '\n' && m->g->cflags&REG_NEWLINE) ||
+			(c == OUT && !(m->eflags&REG_NOTEOL)) ) {
+		flagch = (flagch == BOL) ? BOLEOL : EOL;
+		i += m->g->neol;
+	}
+	for (; i > 0; i--)
+		st = step(m->g, startst, stopst, st, flagch, st);
+
+	assert(coldp != NULL);
+	m->coldp = coldp;
+	if (ISSET(st, stopst))
+		return(p+1);
+	else
+		return(NULL);
+}
+
+/*
+ - dfastate - find or add the DFA state for a set of states
+ == static int dfastate(struct match *m, states st, states fresh, \
+ ==	int bol, short *tr);
+ *
+ * Records the state in *tr too, as the transition that led to it,
+ * unless the DFA had to start over to make room.
+ */
+static int			/* DFA state number */
+dfastate(m, st, fresh, bol, tr)
+struct match *m;
+states st;
+states fresh;
+int bol;
+short *tr;
+{
+	struct re_dfa *d = m->g->dfa;
+	int flags = (bol ? DFA_BOL : 0) | (EQ(st, fresh) ? DFA_FRESH : 0);
+	int n;
+
+	for (n = 0; n < d->nused; n++)
+		if (d->flags[n] == flags && DFAEQ(&d->sets[n * d->setsize], st))
+			break;
+	if (n == d->nused) {
+		if (n == DFA_NSTATES) {
+			NOTE("dfa full");
+			memset(d->trans, 0,
+			    DFA_NSTATES * d->nclass * sizeof(short));
+			tr = NULL;
+			n = 0;
+		}
+		d->nused = n + 1;
+		DFASAVE(&d->sets[n * d->setsize], st);
+		d->flags[n] = flags;
+	}
+	if (tr != NULL)
+		*tr = n + 2;
+	return(n);
+}
+
 /*
  - slow - step through the string more deliberately
  == static char *slow(struct match *m, char *start, \
@@ -909,6 +1096,7 @@ sopno stopst;
 		st = step(m->g, startst, stopst, tmp, c, st);
 		SP("saft", st, c);
 		assert(EQ(step(m->g, startst, stopst, st, NOTHING, st), st));
+		__libc_yield_count(m->yield_steps, stopst - startst);
 		p++;
 	}
 
@@ -1132,6 +1320,8 @@ int ch;
 
 #undef	matcher
 #undef	fast
+#undef	dfast
+#undef	dfastate
 #undef	slow
 #undef	dissect
 #undef	backref
@@ -63,24 +63,35 @@ fnmatch(pattern, string, flags)
 	int flags;
 {
 	const char *stringstart;
+	const char *bt_pattern, *bt_string;
 	char *newp;
-	char c, test;
+	char c;
 
+	/*
+	 * Only the last '*' seen is ever backed up to: on a mismatch it
+	 * takes one more character and matching resumes after it.  An
+	 * earlier '*' matching more could only give what this one can,
+	 * so the time is at most the product of the lengths and no
+	 * recursion is needed.
+	 */
+	bt_pattern = bt_string = NULL;
 	for (stringstart = string;;)
 		switch (c = *pattern++) {
 		case EOS:
 			if ((flags & FNM_LEADING_DIR) && *string == '/')
 				return (0);
-			return (*string == EOS ? 0 : FNM_NOMATCH);
+			if (*string == EOS)
+				return (0);
+			goto backtrack;
 		case '?':
 			if (*string == EOS)
 				return (FNM_NOMATCH);
 			if (*string == '/' && (flags & FNM_PATHNAME))
-				return (FNM_NOMATCH);
+				goto backtrack;
 			if (*string == '.' && (flags & FNM_PERIOD) &&
 			    (string == stringstart ||
 			    ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
-				return (FNM_NOMATCH);
+				goto backtrack;
 			++string;
 			break;
 		case '*':
@@ -92,7 +103,7 @@ fnmatch(pattern, string, flags)
 			if (*string == '.' && (flags & FNM_PERIOD) &&
 			    (string == stringstart ||
 			    ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
-				return (FNM_NOMATCH);
+				goto backtrack;
 
 			/* Optimize for pattern with * at end or before /. */
 			if (c == EOS)
@@ -108,24 +119,19 @@ fnmatch(pattern, string, flags)
 				break;
 			}
 
-			/* General case, use recursion. */
-			while ((test = *string) != EOS) {
-				if (!fnmatch(pattern, string, flags & ~FNM_PERIOD))
-					return (0);
-				if (test == '/' && flags & FNM_PATHNAME)
-					break;
-				++string;
-			}
-			return (FNM_NOMATCH);
+			/* First let it match nothing. */
+			bt_pattern = pattern;
+			bt_string = string;
+			break;
 		case '[':
 			if (*string == EOS)
 				return (FNM_NOMATCH);
 			if (*string == '/' && (flags & FNM_PATHNAME))
-				return (FNM_NOMATCH);
+				goto backtrack;
 			if (*string == '.' && (flags & FNM_PERIOD) &&
 			    (string == stringstart ||
 			    ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
-				return (FNM_NOMATCH);
+				goto backtrack;
 
 			switch (rangematch(pattern, *string, flags, &newp)) {
 			case RANGE_ERROR:
@@ -134,7 +140,7 @@ fnmatch(pattern, string, flags)
 				pattern = newp;
 				break;
 			case RANGE_NOMATCH:
-				return (FNM_NOMATCH);
+				goto backtrack;
 			}
 			++string;
 			break;
@@ -154,8 +160,21 @@ fnmatch(pattern, string, flags)
 				 (tolower((unsigned char)c) ==
 				  tolower((unsigned char)*string)))
 				;
-			else
-				return (FNM_NOMATCH);
+			else {
+		backtrack:
+				/*
+				 * Have the last '*' match one more
+				 * character, which cannot be a '/' under
+				 * FNM_PATHNAME, and try again after it.
+				 */
+				if (bt_pattern == NULL || *bt_string == EOS)
+					return (FNM_NOMATCH);
+				if (*bt_string == '/' && (flags & FNM_PATHNAME))
+					return (FNM_NOMATCH);
+				pattern = bt_pattern;
+				string = ++bt_string;
+				break;
+			}
 			string++;
 			break;
 		}
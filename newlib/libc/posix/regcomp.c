@@ -125,6 +125,7 @@ static int altoffset(sop *scan, int offset, int mccs);
 static void computejumps(struct parse *p, struct re_guts *g);
 static void computematchjumps(struct parse *p, struct re_guts *g);
 static sopno pluscount(struct parse *p, struct re_guts *g);
+static void makedfa(struct parse *p, struct re_guts *g);
 
 #ifdef __cplusplus
 }
@@ -253,6 +254,7 @@ int cflags;
 	g->categories = &g->catspace[-(CHAR_MIN)];
 	(void) memset((char *)g->catspace, 0, NC*sizeof(cat_t));
 	g->backrefs = 0;
+	g->dfa = NULL;
 
 	/* do it */
 	EMIT(OEND, 0);
@@ -282,6 +284,8 @@ int cflags;
 		}
 	}
 	g->nplus = pluscount(p, g);
+	if (cflags&REG_DFA)
+		makedfa(p, g);
 	g->magic = MAGIC2;
 	preg->re_nsub = g->nsub;
 	preg->re_g = g;
@@ -2085,4 +2089,67 @@ struct re_guts *g;
 	return(maxnest);
 }
 
+/*
+ - makedfa - set up the lazy DFA of REG_DFA, if the RE can have one
+ == static void makedfa(struct parse *p, struct re_guts *g);
+ *
+ * Back references and word boundaries need more than a set of states
+ * to follow, so their REs keep the ordinary engine.  The input classes
+ * are the character categories, with newline split off when it may
+ * make ^ or $ match.
+ */
+static void
+makedfa(p, g)
+struct parse *p;
+struct re_guts *g;
+{
+	struct re_dfa *d;
+	sop *scan;
+	sop s;
+	int c;
+	int k;
+	int nl;
+	int nclass;
+	int setsize;
+	short cls[NC + 1];	/* input class of each category, newline last */
+
+	if (p->error != 0 || g->backrefs)
+		return;
+	scan = g->strip + 1;
+	do {
+		s = *scan++;
+		if (OP(s) == OBOW || OP(s) == OEOW)
+			return;
+	} while (OP(s) != OEND);
+
+	nl = (g->cflags&REG_NEWLINE) && (g->nbol > 0 || g->neol > 0);
+	for (k = 0; k <= NC; k++)
+		cls[k] = -1;
+	nclass = 0;
+	for (c = CHAR_MIN; c <= CHAR_MAX; c++) {
+		k = (nl && c == '\n') ? NC : g->categories[c];
+		if (cls[k] < 0)
+			cls[k] = nclass++;
+	}
+
+	setsize = g->nstates;
+	if (setsize < (int)sizeof(long))
+		setsize = sizeof(long);
+	d = (struct re_dfa *)calloc(1, sizeof(struct re_dfa) +
+	    DFA_NSTATES * (nclass * sizeof(short) + setsize + 1) +
+	    3 * g->nstates);
+	if (d == NULL)		/* not a fatal error */
+		return;
+
+	for (c = CHAR_MIN; c <= CHAR_MAX; c++)
+		d->class[(uch)c] = cls[(nl && c == '\n') ? NC : g->categories[c]];
+	d->nclass = nclass;
+	d->setsize = setsize;
+	d->trans = (short *)(d + 1);
+	d->sets = (char *)&d->trans[DFA_NSTATES * d->nclass];
+	d->flags = (uch *)&d->sets[DFA_NSTATES * setsize];
+	d->scratch = (char *)&d->flags[DFA_NSTATES];
+	g->dfa = d;
+}
+
 #endif /* !_NO_REGEX  */
@@ -133,6 +133,28 @@ typedef struct {
 /* stuff for character categories */
 typedef unsigned char cat_t;
 
+/*
+ * Lazily built DFA for REG_DFA (see engine.c).  Each of its states is a
+ * set of strip states together with DFA_BOL, whether a ^ may match
+ * before the next character, and its transitions are filled in the
+ * first time they are taken.  When all DFA_NSTATES are in use the
+ * automaton starts over, so its size is bounded.
+ */
+#define	DFA_NSTATES	32
+struct re_dfa {
+	int nclass;		/* number of input classes */
+	int setsize;		/* bytes per saved set of strip states */
+	int nused;		/* DFA states in use */
+	short *trans;		/* [DFA_NSTATES][nclass]: 0 not known yet, */
+				/* 1 match, 2 + n go to DFA state n */
+	char *sets;		/* [DFA_NSTATES][setsize] */
+	uch *flags;		/* [DFA_NSTATES] */
+#		define	DFA_BOL		01	/* ^ may match next */
+#		define	DFA_FRESH	02	/* no match underway */
+	char *scratch;		/* [3][nstates], for the large engine */
+	uch class[NC];		/* input class of each character */
+};
+
 /*
  * main compiled-expression structure
  */
@@ -164,6 +186,7 @@ struct re_guts {
 	size_t nsub;		/* copy of re_nsub */
 	int backrefs;		/* does it use back references? */
 	sopno nplus;		/* how deep does it nest +s? */
+	struct re_dfa *dfa;	/* REG_DFA automaton, or NULL */
 	/* catspace must be last */
 	cat_t catspace[1];	/* actually [NC] */
 };
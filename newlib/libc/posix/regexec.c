@@ -54,6 +54,7 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 #include <limits.h>
 #include <ctype.h>
 #include <regex.h>
+#include <sys/yield.h>
 
 #include "utils.h"
 #include "regex2.h"
@@ -62,6 +63,17 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 static int nope = 0;		/* for use in asserts; shuts lint up */
 #endif
 
+/*
+ * A regexec_ws() workspace, once aligned for a regmatch_t, holds what
+ * the engine would otherwise malloc() on each call: the subexpression
+ * matches, the + positions of the backref code and, for the large
+ * representation, its WS_NSETS state sets.
+ */
+#define	WS_ALIGN	sizeof(union { regmatch_t m; char *p; })
+#define	WS_LASTPOS(g)	(((g)->nsub + 1) * sizeof(regmatch_t))
+#define	WS_SPACE(g)	(WS_LASTPOS(g) + ((g)->nplus + 1) * sizeof(char *))
+#define	WS_NSETS	4
+
 /* macros for manipulating states, small version */
 #define	states	long
 #define	states1	states		/* for later use in regexec() decision */
@@ -84,6 +96,11 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) << (n))
 #define	BACK(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) >> (n))
 #define	ISSETBACK(v, n)	(((v) & ((unsigned long)here >> (n))) != 0)
+/* saving state sets in the REG_DFA automaton */
+#define	DFASETUP(v, n)	/* nothing */
+#define	DFASAVE(d, v)	memcpy(d, &(v), sizeof(v))
+#define	DFALOAD(v, d)	memcpy(&(v), d, sizeof(v))
+#define	DFAEQ(d, v)	(memcmp(d, &(v), sizeof(v)) == 0)
 /* function names */
 #define SNAMES			/* engine.c looks after details */
 
@@ -108,6 +125,10 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #undef	FWD
 #undef	BACK
 #undef	ISSETBACK
+#undef	DFASETUP
+#undef	DFASAVE
+#undef	DFALOAD
+#undef	DFAEQ
 #undef	SNAMES
 
 /* macros for manipulating states, large version */
@@ -119,10 +140,12 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	ASSIGN(d, s)	memcpy(d, s, m->g->nstates)
 #define	EQ(a, b)	(memcmp(a, b, m->g->nstates) == 0)
 #define	STATEVARS	long vn; char *space
-#define	STATESETUP(m, nv)	{ (m)->space = malloc((nv)*(m)->g->nstates); \
+#define	STATESETUP(m, nv)	{ (m)->space = ((m)->ws != NULL) ? \
+				(m)->ws + WS_SPACE((m)->g) : \
+				malloc((nv)*(m)->g->nstates); \
 				if ((m)->space == NULL) return(REG_ESPACE); \
 				(m)->vn = 0; }
-#define	STATETEARDOWN(m)	{ free((m)->space); }
+#define	STATETEARDOWN(m)	{ if ((m)->ws == NULL) free((m)->space); }
 #define	SETUP(v)	((v) = &m->space[m->vn++ * m->g->nstates])
 #define	onestate	long
 #define	INIT(o, n)	((o) = (n))
@@ -133,6 +156,11 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst)[here+(n)] |= (src)[here])
 #define	BACK(dst, src, n)	((dst)[here-(n)] |= (src)[here])
 #define	ISSETBACK(v, n)	((v)[here - (n)])
+/* saving state sets in the REG_DFA automaton */
+#define	DFASETUP(v, n)	((v) = &m->g->dfa->scratch[(n) * m->g->nstates])
+#define	DFASAVE(d, v)	memcpy(d, v, m->g->nstates)
+#define	DFALOAD(v, d)	memcpy(v, d, m->g->nstates)
+#define	DFAEQ(d, v)	(memcmp(d, v, m->g->nstates) == 0)
 /* function names */
 #define	LNAMES			/* flag */
 
@@ -176,9 +204,73 @@ int eflags;
 	eflags = GOODFLAGS(eflags);
 
 	if (g->nstates <= CHAR_BIT*sizeof(states1) && !(eflags&REG_LARGE))
-		return(smatcher(g, (char *)string, nmatch, pmatch, eflags));
+		return(smatcher(g, (char *)string, nmatch, pmatch, eflags,
+		    (char *)NULL));
+	else
+		return(lmatcher(g, (char *)string, nmatch, pmatch, eflags,
+		    (char *)NULL));
+}
+
+/*
+ - regexec_ws - regexec() in a caller's workspace
+ = extern int regexec_ws(const regex_t *__restrict, const char *__restrict,
+ =			size_t, regmatch_t [__restrict], int, void *, size_t);
+ *
+ * Does what regexec() does without calling malloc(), taking all the
+ * space it needs from the wssize bytes at ws; regwssize() tells how many
+ * are enough.  Too small a workspace gives REG_ESPACE.
+ */
+int				/* 0 success, REG_NOMATCH failure */
+regexec_ws(preg, string, nmatch, pmatch, eflags, ws, wssize)
+const regex_t *__restrict preg;
+const char *__restrict string;
+size_t nmatch;
+regmatch_t pmatch[__restrict];
+int eflags;
+void *ws;
+size_t wssize;
+{
+	struct re_guts *g = preg->re_g;
+	size_t skew;
+	int small;
+
+	if (preg->re_magic != MAGIC1 || g->magic != MAGIC2)
+		return(REG_BADPAT);
+	assert(!(g->iflags&BAD));
+	if (g->iflags&BAD)		/* backstop for no-debug case */
+		return(REG_BADPAT);
+	eflags = GOODFLAGS(eflags);
+
+	small = g->nstates <= CHAR_BIT*sizeof(states1) && !(eflags&REG_LARGE);
+	skew = (WS_ALIGN - (size_t)ws % WS_ALIGN) % WS_ALIGN;
+	if (ws == NULL || wssize < skew + WS_SPACE(g) +
+	    (small ? 0 : WS_NSETS * g->nstates))
+		return(REG_ESPACE);
+	if (small)
+		return(smatcher(g, (char *)string, nmatch, pmatch, eflags,
+		    (char *)ws + skew));
 	else
-		return(lmatcher(g, (char *)string, nmatch, pmatch, eflags));
+		return(lmatcher(g, (char *)string, nmatch, pmatch, eflags,
+		    (char *)ws + skew));
+}
+
+/*
+ - regwssize - workspace size regexec_ws() needs
+ = extern size_t regwssize(const regex_t *);
+ *
+ * Enough for any string and flags, at any alignment of the workspace.
+ */
+size_t
+regwssize(preg)
+const regex_t *preg;
+{
+	struct re_guts *g = preg->re_g;
+
+	if (preg->re_magic != MAGIC1 || g->magic != MAGIC2)
+		return(0);
+	return(WS_ALIGN - 1 + WS_SPACE(g) +
+	    (g->nstates <= CHAR_BIT*sizeof(states1) ? 0 :
+	    WS_NSETS * g->nstates));
 }
 
 #endif /* !_NO_REGEX  */
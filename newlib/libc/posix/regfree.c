@@ -80,6 +80,8 @@ regex_t *preg;
 		free(&g->charjump[CHAR_MIN]);
 	if (g->matchjump != NULL)
 		free(g->matchjump);
+	if (g->dfa != NULL)
+		free(g->dfa);
 	free((char *)g);
 }
 
@@ -20,9 +20,21 @@ extern const struct __sFILE_fake __sf_fake_stdout _ATTRIBUTE ((weak));
 extern const struct __sFILE_fake __sf_fake_stderr _ATTRIBUTE ((weak));
 #endif
 
+#if defined (_REENT_SMALL) && defined (_REENT_STATIC_EXT)
+/* The members of impure_data that would be malloced on first use.  */
+static struct _reent_ext __ATTRIBUTE_IMPURE_DATA__ impure_ext = _REENT_EXT_INIT;
+#define IMPURE_EXT(member) ((void *) &impure_ext.member)
+static struct _reent __ATTRIBUTE_IMPURE_DATA__ impure_data =
+  _REENT_INIT_WITH (impure_data, IMPURE_EXT);
+#else
 static struct _reent __ATTRIBUTE_IMPURE_DATA__ impure_data = _REENT_INIT (impure_data);
+#endif
 #ifdef __CYGWIN__
 extern struct _reent reent_data __attribute__ ((alias("impure_data")));
 #endif
 struct _reent *__ATTRIBUTE_IMPURE_PTR__ _impure_ptr = &impure_data;
 struct _reent *const __ATTRIBUTE_IMPURE_PTR__ _global_impure_ptr = &impure_data;
+#if defined (__dsPIC30__) && defined (__DYNAMIC_REENT__) \
+    && !defined (__SINGLE_THREAD__)
+struct _reent *__ATTRIBUTE_IMPURE_PTR__ __pic30_reent = &impure_data;
+#endif
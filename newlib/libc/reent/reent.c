@@ -27,6 +27,13 @@ int errno;
 
 #endif
 
+#ifdef _MPREC_POOL
+/* Bigints may come from the static arena in mprec.c.  */
+extern void __mprec_free (struct _reent *, void *);
+#else
+#define __mprec_free _free_r
+#endif
+
 /* Interim cleanup code */
 
 void
@@ -62,14 +69,14 @@ _reclaim_reent (struct _reent *ptr)
 		{
 		  thisone = nextone;
 		  nextone = nextone->_next;
-		  _free_r (ptr, thisone);
+		  __mprec_free (ptr, thisone);
 		}
 	    }    
 
-	  _free_r (ptr, _REENT_MP_FREELIST(ptr));
+	  __mprec_free (ptr, _REENT_MP_FREELIST(ptr));
 	}
       if (_REENT_MP_RESULT(ptr))
-	_free_r (ptr, _REENT_MP_RESULT(ptr));
+	__mprec_free (ptr, _REENT_MP_RESULT(ptr));
 #ifdef _REENT_SMALL
       }
 #endif
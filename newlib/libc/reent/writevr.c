@@ -0,0 +1,66 @@
+/* Reentrant version of writev system call. */
+
+#include <reent.h>
+#include <errno.h>
+#include <sys/uio.h>
+#include <_syslist.h>
+
+/* Some targets provides their own versions of this functions.  Those
+   targets should define REENTRANT_SYSCALLS_PROVIDED in TARGET_CFLAGS.  */
+
+#ifdef _REENT_ONLY
+#ifndef REENTRANT_SYSCALLS_PROVIDED
+#define REENTRANT_SYSCALLS_PROVIDED
+#endif
+#endif
+
+#ifndef REENTRANT_SYSCALLS_PROVIDED
+
+/* Few systems have it, so a missing one must not break the link.  */
+extern _ssize_t _writev (int, const struct iovec *, int) _ATTRIBUTE ((__weak__));
+
+/* We use the errno variable used by the system dependent layer.  */
+#undef errno
+extern int errno;
+
+/*
+FUNCTION
+	<<_writev_r>>---Reentrant version of writev
+	
+INDEX
+	_writev_r
+
+SYNOPSIS
+	#include <reent.h>
+	#include <sys/uio.h>
+	_ssize_t _writev_r(struct _reent *<[ptr]>,
+		           int <[fd]>, const struct iovec *<[iov]>,
+		           int <[iovcnt]>);
+
+DESCRIPTION
+	This is a reentrant version of <<writev>>.  It
+	takes a pointer to the global data block, which holds
+	<<errno>>.  If the system does not provide <<_writev>>,
+	it fails with <<ENOSYS>>.
+*/
+
+_ssize_t
+_writev_r (struct _reent *ptr,
+     int fd,
+     const struct iovec *iov,
+     int iovcnt)
+{
+  _ssize_t ret;
+
+  if (_writev == NULL)
+    {
+      ptr->_errno = ENOSYS;
+      return -1;
+    }
+  errno = 0;
+  if ((ret = _writev (fd, iov, iovcnt)) == -1 && errno != 0)
+    ptr->_errno = errno;
+  return ret;
+}
+
+#endif /* ! defined (REENTRANT_SYSCALLS_PROVIDED) */
@@ -0,0 +1,84 @@
+/* The body of bsearch_u16 and bsearch_u32 and their Eytzinger forms.
+
+   The including file defines BSEARCH_NAME, EYTZINGER_NAME,
+   EYTZINGER_FIND_NAME and the element type BSEARCH_TYPE.
+
+   The plain search keeps the last element not above the key in the
+   window [p, p + len), halving len each step without ever leaving
+   early, so every search of a table takes the same log2(n) steps and
+   the step is a compare and a masked add.  The Eytzinger search walks
+   the implicit tree, where the next candidates are always adjacent at
+   2k and 2k + 1, and recovers the lower bound from the path taken.  */
+
+#include <_ansi.h>
+#include <stdlib.h>
+
+const BSEARCH_TYPE *
+BSEARCH_NAME (BSEARCH_TYPE key,
+	const BSEARCH_TYPE *base,
+	size_t nmemb)
+{
+  const BSEARCH_TYPE *p = base;
+  size_t len = nmemb;
+
+  if (len == 0)
+    return NULL;
+  while (len > 1)
+    {
+      size_t half = len / 2;
+
+      p += half & -(size_t) (p[half] <= key);
+      len -= half;
+    }
+  return *p == key ? p : NULL;
+}
+
+void
+EYTZINGER_NAME (BSEARCH_TYPE *tree,
+	const BSEARCH_TYPE *sorted,
+	size_t nmemb)
+{
+  size_t k = 1;
+
+  if (nmemb == 0)
+    return;
+  /* Visit the nodes in order, putting the next element in each: from
+     the leftmost node, the successor is the leftmost of the right
+     subtree, or else the parent the path last went left from.  */
+  while (2 * k <= nmemb)
+    k *= 2;
+  for (;;)
+    {
+      tree[k - 1] = *sorted++;
+      if (2 * k + 1 <= nmemb)
+	{
+	  k = 2 * k + 1;
+	  while (2 * k <= nmemb)
+	    k *= 2;
+	}
+      else
+	{
+	  while (k & 1)
+	    k >>= 1;
+	  k >>= 1;
+	  if (k == 0)
+	    break;
+	}
+    }
+}
+
+const BSEARCH_TYPE *
+EYTZINGER_FIND_NAME (BSEARCH_TYPE key,
+	const BSEARCH_TYPE *tree,
+	size_t nmemb)
+{
+  size_t k = 1;
+
+  while (k <= nmemb)
+    k = 2 * k + (tree[k - 1] < key);
+  /* The last left turn was at the first node not below the key.  */
+  while (k & 1)
+    k >>= 1;
+  k >>= 1;
+  return k != 0 && tree[k - 1] == key ? &tree[k - 1] : NULL;
+}
@@ -0,0 +1,63 @@
+/*
+FUNCTION
+<<bsearch_u16>>, <<bsearch_u32>>, <<eytzinger_u16>>, <<eytzinger_u32>>---search a table of numbers
+
+INDEX
+	bsearch_u16
+INDEX
+	bsearch_u32
+INDEX
+	eytzinger_u16
+INDEX
+	eytzinger_u32
+INDEX
+	bsearch_eytzinger_u16
+INDEX
+	bsearch_eytzinger_u32
+
+SYNOPSIS
+	#include <stdlib.h>
+	const uint16_t *bsearch_u16(uint16_t <[key]>,
+		const uint16_t *<[base]>, size_t <[nmemb]>);
+	const uint32_t *bsearch_u32(uint32_t <[key]>,
+		const uint32_t *<[base]>, size_t <[nmemb]>);
+	void eytzinger_u16(uint16_t *<[tree]>, const uint16_t *<[sorted]>,
+		size_t <[nmemb]>);
+	void eytzinger_u32(uint32_t *<[tree]>, const uint32_t *<[sorted]>,
+		size_t <[nmemb]>);
+	const uint16_t *bsearch_eytzinger_u16(uint16_t <[key]>,
+		const uint16_t *<[tree]>, size_t <[nmemb]>);
+	const uint32_t *bsearch_eytzinger_u32(uint32_t <[key]>,
+		const uint32_t *<[tree]>, size_t <[nmemb]>);
+
+DESCRIPTION
+<<bsearch_u16>> and <<bsearch_u32>> look for <[key]> in the <[nmemb]>
+numbers at <[base]>, which must be in ascending order, like <<bsearch>>
+with the obvious comparison function.  The comparison is inline and
+the loop runs the same log2(<[nmemb]>) steps for any key, with no early
+exit to branch on.
+
+<<eytzinger_u16>> and <<eytzinger_u32>> copy the sorted table of
+<[nmemb]> numbers at <[sorted]> to <[tree]> in Eytzinger order, the
+breadth first order of its binary search tree, as a build step or at
+startup; the two must not overlap.  <<bsearch_eytzinger_u16>> and
+<<bsearch_eytzinger_u32>> search such a table.  The elements a search
+reads are then at the front of the table and close to each other,
+which suits a table read through the PSV window or from external
+memory.
+
+RETURNS
+The search functions return a pointer to an element equal to <[key]>,
+the last of several in <<bsearch_u16>> and <<bsearch_u32>> and the
+first in sorted order in the Eytzinger forms, or NULL if there is
+none.
+
+PORTABILITY
+These functions are newlib extensions.
+*/
+
+#define BSEARCH_NAME		bsearch_u16
+#define EYTZINGER_NAME		eytzinger_u16
+#define EYTZINGER_FIND_NAME	bsearch_eytzinger_u16
+#define BSEARCH_TYPE		__uint16_t
+#include "bsearch_typed.h"
@@ -0,0 +1,8 @@
+/* bsearch_u32, eytzinger_u32 and bsearch_eytzinger_u32: see
+   bsearch_u16.c.  */
+
+#define BSEARCH_NAME		bsearch_u32
+#define EYTZINGER_NAME		eytzinger_u32
+#define EYTZINGER_FIND_NAME	bsearch_eytzinger_u32
+#define BSEARCH_TYPE		__uint32_t
+#include "bsearch_typed.h"
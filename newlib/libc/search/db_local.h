@@ -36,6 +36,7 @@
 #include <sys/types.h>
 #include <sys/cdefs.h>
 #include <sys/config.h>
+#include <sys/reent.h>
 
 #include <limits.h>
 
@@ -207,6 +208,7 @@ DB *dbopen(const char *, int, int, DBTYPE, const void *);
 #ifdef __DBINTERFACE_PRIVATE
 DB	*__bt_open(const char *, int, int, const BTREEINFO *, int);
 DB	*__hash_open(const char *, int, int, int, const HASHINFO *);
+DB	*__hash_fopen(__FILE *, int, const HASHINFO *);
 DB	*__rec_open(const char *, int, int, const RECNOINFO *, int);
 void	 __dbpanic(DB *dbp);
 #endif
@@ -48,6 +48,8 @@ __uint16_t	 __find_last_page(HTAB *, BUFHEAD **);
 void	 __free_ovflpage(HTAB *, BUFHEAD *);
 BUFHEAD	*__get_buf(HTAB *, __uint32_t, BUFHEAD *, int);
 int	 __get_page(HTAB *, char *, __uint32_t, int, int, int);
+int	 __hash_read(HTAB *, off_t, void *, int);
+int	 __hash_write(HTAB *, off_t, const void *, int);
 int	 __ibitmap(HTAB *, int, int, int);
 __uint32_t	 __log2(__uint32_t);
 int	 __put_page(HTAB *, char *, __uint32_t, int, int);
@@ -68,6 +68,7 @@ static void *hash_realloc(SEGMENT **, int, int);
 static int   hash_seq(const DB *, DBT *, DBT *, u_int);
 static int   hash_sync(const DB *, u_int);
 static int   hdestroy(HTAB *);
+static DB   *hash_setup(HTAB *, const char *, const HASHINFO *, int);
 static HTAB *init_hash(HTAB *, const char *, const HASHINFO *);
 static int   init_htab(HTAB *, int);
 #if (BYTE_ORDER == LITTLE_ENDIAN)
@@ -114,8 +115,7 @@ __hash_open (const char *file,
 #else
 	struct stat statbuf;
 #endif
-	DB *dbp;
-	int bpages, hdrsize, new_table, nsegs, save_errno;
+	int new_table, save_errno;
 
 	if ((flags & O_ACCMODE) == O_WRONLY) {
 		errno = EINVAL;
@@ -163,6 +163,80 @@ __hash_open (const char *file,
 		(void)fcntl(hashp->fp, F_SETFD, 1);
 #endif
 	}
+	return (hash_setup(hashp, file, info, new_table));
+
+error0:
+	free(hashp);
+	errno = save_errno;
+	return (NULL);
+}
+
+/*
+ * Open a table on a stream, such as one funopen or fopencookie makes
+ * over a block device, rather than on a file.  The stream is made
+ * unbuffered and is closed with the table, or here if opening fails.
+ * Without O_TRUNC the table on it is used if its header is valid;
+ * otherwise, with O_CREAT, a new one is made.  There is no truncating
+ * a device, so pages the table has not written must read as zeros or
+ * erased flash, all ones: make a new table on an erased device.
+ *
+ * Unless O_SYNC is given, the buffer pool evicts clean pages before
+ * modified ones, so a page written several times is written to the
+ * device once, at sync or close, rather than each time it ages out.
+ */
+extern DB *
+__hash_fopen (FILE *stream,
+	int flags,
+	const HASHINFO *info)
+{
+	HTAB *hashp;
+	int new_table;
+
+	if ((flags & O_ACCMODE) == O_WRONLY) {
+		errno = EINVAL;
+		return (NULL);
+	}
+	if (!(hashp = (HTAB *)calloc(1, sizeof(HTAB))))
+		return (NULL);
+	hashp->fp = -1;
+	hashp->stream = stream;
+	hashp->batch = !(flags & O_SYNC);
+	hashp->flags = flags;
+	(void)setvbuf(stream, NULL, _IONBF, 0);
+
+	new_table = 0;
+	if (flags & O_TRUNC)
+		new_table = 1;
+	else if (__hash_read(hashp, 0, &hashp->hdr, sizeof(HASHHDR)) !=
+	    sizeof(HASHHDR))
+		new_table = (flags & O_CREAT) != 0;
+	else {
+#if (BYTE_ORDER == LITTLE_ENDIAN)
+		swap_header(hashp);
+#endif
+		if (hashp->MAGIC != HASHMAGIC)
+			new_table = (flags & O_CREAT) != 0;
+	}
+	if (new_table)
+		memset(&hashp->hdr, 0, sizeof(HASHHDR));
+	return (hash_setup(hashp, NULL, info, new_table));
+}
+
+/*
+ * The rest of opening a table, shared by __hash_open and __hash_fopen:
+ * make a new one, or read in the header of the one in the backing
+ * store, and set up the buffer pool and the DB.
+ */
+static DB *
+hash_setup(hashp, file, info, new_table)
+	HTAB *hashp;
+	const char *file;
+	const HASHINFO *info;
+	int new_table;
+{
+	DB *dbp;
+	int bpages, hdrsize, nsegs, save_errno;
+
 	if (new_table) {
 		if (!(hashp = init_hash(hashp, file, (HASHINFO *)info)))
 			RETURN_ERROR(errno, error1);
@@ -173,7 +247,7 @@ __hash_open (const char *file,
 		else
 			hashp->hash = __default_hash;
 
-		hdrsize = read(hashp->fp, &hashp->hdr, sizeof(HASHHDR));
+		hdrsize = __hash_read(hashp, 0, &hashp->hdr, sizeof(HASHHDR));
 #if (BYTE_ORDER == LITTLE_ENDIAN)
 		swap_header(hashp);
 #endif
@@ -223,7 +297,7 @@ __hash_open (const char *file,
 		__buf_init(hashp, DEF_BUFSIZE);
 
 	hashp->new_file = new_table;
-	hashp->save_file = file && (hashp->flags & O_RDWR);
+	hashp->save_file = (file || hashp->stream) && (hashp->flags & O_RDWR);
 	hashp->cbucket = -1;
 	if (!(dbp = (DB *)malloc(sizeof(DB)))) {
 		save_errno = errno;
@@ -266,10 +340,12 @@ __hash_open (const char *file,
 	return (dbp);
 
 error1:
-	if (hashp != NULL)
-		(void)close(hashp->fp);
-
-error0:
+	if (hashp != NULL) {
+		if (hashp->stream != NULL)
+			(void)fclose(hashp->stream);
+		else
+			(void)close(hashp->fp);
+	}
 	free(hashp);
 	errno = save_errno;
 	return (NULL);
@@ -472,7 +548,9 @@ hdestroy(hashp)
 		if (hashp->mapp[i])
 			free(hashp->mapp[i]);
 
-	if (hashp->fp != -1)
+	if (hashp->stream != NULL)
+		(void)fclose(hashp->stream);
+	else if (hashp->fp != -1)
 		(void)close(hashp->fp);
 
 	free(hashp);
@@ -527,7 +605,7 @@ flush_meta(hashp)
 #if (BYTE_ORDER == LITTLE_ENDIAN)
 	HASHHDR whdr;
 #endif
-	int fp, i, wsize;
+	int i, wsize;
 
 	if (!hashp->save_file)
 		return (0);
@@ -535,14 +613,12 @@ flush_meta(hashp)
 	hashp->HASH_VERSION = HASHVERSION;
 	hashp->H_CHARKEY = hashp->hash(CHARKEY, sizeof(CHARKEY));
 
-	fp = hashp->fp;
 	whdrp = &hashp->hdr;
 #if (BYTE_ORDER == LITTLE_ENDIAN)
 	whdrp = &whdr;
 	swap_header_copy(&hashp->hdr, whdrp);
 #endif
-	if ((lseek(fp, (off_t)0, SEEK_SET) == -1) ||
-	    ((wsize = write(fp, whdrp, sizeof(HASHHDR))) == -1))
+	if ((wsize = __hash_write(hashp, 0, whdrp, sizeof(HASHHDR))) == -1)
 		return (-1);
 	else
 		if (wsize != sizeof(HASHHDR)) {
@@ -37,6 +37,7 @@
 #define __need_size_t
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 
 /* Check that newlib understands the byte order of its target system.  */
 #ifndef BYTE_ORDER
@@ -114,6 +115,8 @@ typedef struct htab	 {		/* Memory resident data structure */
 	    (*hash)(const void *, size_t);
 	int		flags;		/* Flag values */
 	int		fp;		/* File pointer */
+	FILE		*stream;	/* Or the stream it lives on */
+	int		batch;		/* Evict clean buffers first */
 	char		*tmp_buf;	/* Temporary Buffer for BIG data */
 	char		*tmp_key;	/* Temporary Buffer for BIG keys */
 	BUFHEAD 	*cpage;		/* Current page */
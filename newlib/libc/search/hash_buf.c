@@ -50,6 +50,8 @@ static char sccsid[] = "@(#)hash_buf.c	8.5 (Berkeley) 7/15/94";
  *	__reclaim_buf
  * Internal
  *	newbuf
+ *	buf_alloc
+ *	buf_release
  */
 
 #include <sys/param.h>
@@ -68,6 +70,26 @@ static char sccsid[] = "@(#)hash_buf.c	8.5 (Berkeley) 7/15/94";
 #include "extern.h"
 
 static BUFHEAD *newbuf(HTAB *, __uint32_t, BUFHEAD *);
+static BUFHEAD *buf_alloc(HTAB *);
+static void buf_release(BUFHEAD *);
+
+/*
+ * With HASH_STATIC_BUFS, buffers of up to HASH_STATIC_BSIZE bytes
+ * come from a pool of that many in static memory, shared by the open
+ * tables, before any is malloc'd.  A table with pages that size, a
+ * flash page, and a cache of no more pages than that takes no buffer
+ * from the heap.
+ */
+#ifdef HASH_STATIC_BUFS
+#ifndef HASH_STATIC_BSIZE
+#define HASH_STATIC_BSIZE	256
+#endif
+static struct hash_sbuf {
+	BUFHEAD head;
+	__uint32_t page[HASH_STATIC_BSIZE / sizeof(__uint32_t)];
+	char used;
+} hash_sbufs[HASH_STATIC_BUFS];
+#endif
 
 /* Unlink B from its place in the lru */
 #define BUF_REMOVE(B) { \
@@ -170,30 +192,37 @@ newbuf(hashp, addr, prev_bp)
 	BUFHEAD *bp;		/* The buffer we're going to use */
 	BUFHEAD *xbp;		/* Temp pointer */
 	BUFHEAD *next_xbp;
+	BUFHEAD *keep;		/* Oldest of the buffers kept in batching */
 	SEGMENT segp;
-	int segment_ndx;
+	int i, segment_ndx;
 	__uint16_t oaddr, *shortp;
 
 	oaddr = 0;
 	bp = LRU;
+	/*
+	 * When batching writes, evict the least recently used buffer that
+	 * is clean rather than write out a modified one, looking past the
+	 * MIN_BUFFERS - 1 most recent, which the caller may be using.
+	 */
+	if (hashp->batch && !hashp->nbufs && (bp->flags & BUF_MOD)) {
+		keep = MRU;
+		for (i = 1; i < MIN_BUFFERS - 1 && keep != &hashp->bufhead; i++)
+			keep = keep->next;
+		for (xbp = bp; xbp != keep && xbp != &hashp->bufhead;
+		    xbp = xbp->prev)
+			if (!(xbp->flags & (BUF_MOD | BUF_PIN))) {
+				bp = xbp;
+				break;
+			}
+	}
 	/*
 	 * If LRU buffer is pinned, the buffer pool is too small. We need to
 	 * allocate more buffers.
 	 */
 	if (hashp->nbufs || (bp->flags & BUF_PIN)) {
 		/* Allocate a new one */
-		if ((bp = (BUFHEAD *)malloc(sizeof(BUFHEAD))) == NULL)
+		if ((bp = buf_alloc(hashp)) == NULL)
 			return (NULL);
-#ifdef PURIFY
-		memset(bp, 0xff, sizeof(BUFHEAD));
-#endif
-		if ((bp->page = (char *)malloc(hashp->BSIZE)) == NULL) {
-			free(bp);
-			return (NULL);
-		}
-#ifdef PURIFY
-		memset(bp->page, 0xff, hashp->BSIZE);
-#endif
 		if (hashp->nbufs)
 			hashp->nbufs--;
 	} else {
@@ -322,6 +351,7 @@ __buf_free(hashp, do_free, to_disk)
 	int do_free, to_disk;
 {
 	BUFHEAD *bp;
+	SEGMENT segp;
 
 	/* Need to make sure that buffer manager has been initialized */
 	if (!LRU)
@@ -329,17 +359,28 @@ __buf_free(hashp, do_free, to_disk)
 	for (bp = LRU; bp != &hashp->bufhead;) {
 		/* Check that the buffer is valid */
 		if (bp->addr || IS_BUCKET(bp->flags)) {
-			if (to_disk && (bp->flags & BUF_MOD) &&
-			    __put_page(hashp, bp->page,
-			    bp->addr, IS_BUCKET(bp->flags), 0))
-				return (-1);
+			if (to_disk && (bp->flags & BUF_MOD)) {
+				if (__put_page(hashp, bp->page,
+				    bp->addr, IS_BUCKET(bp->flags), 0))
+					return (-1);
+				/*
+				 * Written; the next sync need not again, and
+				 * once evicted the page is read back.
+				 */
+				bp->flags &= ~BUF_MOD;
+				if (IS_BUCKET(bp->flags)) {
+					segp = hashp->dir[bp->addr >>
+					    hashp->SSHIFT];
+					segp[bp->addr & (hashp->SGSIZE - 1)] =
+					    (BUFHEAD *)((ptrdiff_t)bp |
+					    BUF_DISK);
+				}
+			}
 		}
 		/* Check if we are freeing stuff */
 		if (do_free) {
-			if (bp->page)
-				free(bp->page);
 			BUF_REMOVE(bp);
-			free(bp);
+			buf_release(bp);
 			bp = LRU;
 		} else
 			bp = bp->prev;
@@ -347,6 +388,53 @@ __buf_free(hashp, do_free, to_disk)
 	return (0);
 }
 
+static BUFHEAD *
+buf_alloc(hashp)
+	HTAB *hashp;
+{
+	BUFHEAD *bp;
+#ifdef HASH_STATIC_BUFS
+	struct hash_sbuf *sb;
+
+	if (hashp->BSIZE <= HASH_STATIC_BSIZE)
+		for (sb = hash_sbufs; sb < hash_sbufs + HASH_STATIC_BUFS; sb++)
+			if (!sb->used) {
+				sb->used = 1;
+				sb->head.page = (char *)sb->page;
+				return (&sb->head);
+			}
+#endif
+	if ((bp = (BUFHEAD *)malloc(sizeof(BUFHEAD))) == NULL)
+		return (NULL);
+#ifdef PURIFY
+	memset(bp, 0xff, sizeof(BUFHEAD));
+#endif
+	if ((bp->page = (char *)malloc(hashp->BSIZE)) == NULL) {
+		free(bp);
+		return (NULL);
+	}
+#ifdef PURIFY
+	memset(bp->page, 0xff, hashp->BSIZE);
+#endif
+	return (bp);
+}
+
+static void
+buf_release(bp)
+	BUFHEAD *bp;
+{
+#ifdef HASH_STATIC_BUFS
+	if ((char *)bp >= (char *)hash_sbufs &&
+	    (char *)bp < (char *)(hash_sbufs + HASH_STATIC_BUFS)) {
+		((struct hash_sbuf *)bp)->used = 0;
+		return;
+	}
+#endif
+	if (bp->page)
+		free(bp->page);
+	free(bp);
+}
+
 extern void
 __reclaim_buf(hashp, bp)
 	HTAB *hashp;
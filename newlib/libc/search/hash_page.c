@@ -47,6 +47,8 @@ static char sccsid[] = "@(#)hash_page.c	8.7 (Berkeley) 8/16/94";
  * External
  *	__get_page
  *	__add_ovflpage
+ *	__hash_read
+ *	__hash_write
  * Internal
  *	overflow_page
  *	open_temp
@@ -519,14 +521,13 @@ __get_page(hashp, p, bucket, is_bucket, is_disk, is_bitmap)
 	__uint32_t bucket;
 	int is_bucket, is_disk, is_bitmap;
 {
-	int fd, page, size;
+	int page, size;
 	int rsize;
 	__uint16_t *bp;
 
-	fd = hashp->fp;
 	size = hashp->BSIZE;
 
-	if ((fd == -1) || !is_disk) {
+	if ((hashp->fp == -1 && hashp->stream == NULL) || !is_disk) {
 		PAGE_INIT(p);
 		return (0);
 	}
@@ -534,8 +535,8 @@ __get_page(hashp, p, bucket, is_bucket, is_disk, is_bitmap)
 		page = BUCKET_TO_PAGE(bucket);
 	else
 		page = OADDR_TO_PAGE(bucket);
-	if ((lseek(fd, (off_t)page << hashp->BSHIFT, SEEK_SET) == -1) ||
-	    ((rsize = read(fd, p, size)) == -1))
+	if ((rsize = __hash_read(hashp, (off_t)page << hashp->BSHIFT,
+	    p, size)) == -1)
 		return (-1);
 	bp = (__uint16_t *)p;
 	if (!rsize)
@@ -545,7 +546,9 @@ __get_page(hashp, p, bucket, is_bucket, is_disk, is_bitmap)
 			errno = EFTYPE;
 			return (-1);
 		}
-	if (!is_bitmap && !bp[0]) {
+	/* a page of a stream never written may read as erased flash */
+	if (!is_bitmap && (!bp[0] ||
+	    (hashp->stream != NULL && bp[0] == 0xffff))) {
 		PAGE_INIT(p);
 	} else
                if (hashp->LORDER != DB_BYTE_ORDER) {
@@ -579,13 +582,12 @@ __put_page(hashp, p, bucket, is_bucket, is_bitmap)
 	__uint32_t bucket;
 	int is_bucket, is_bitmap;
 {
-	int fd, page, size;
+	int page, size;
 	int wsize;
 
 	size = hashp->BSIZE;
-	if ((hashp->fp == -1) && open_temp(hashp))
+	if ((hashp->fp == -1) && (hashp->stream == NULL) && open_temp(hashp))
 		return (-1);
-	fd = hashp->fp;
 
        if (hashp->LORDER != DB_BYTE_ORDER) {
 		int i;
@@ -605,8 +607,8 @@ __put_page(hashp, p, bucket, is_bucket, is_bitmap)
 		page = BUCKET_TO_PAGE(bucket);
 	else
 		page = OADDR_TO_PAGE(bucket);
-	if ((lseek(fd, (off_t)page << hashp->BSHIFT, SEEK_SET) == -1) ||
-	    ((wsize = write(fd, p, size)) == -1))
+	if ((wsize = __hash_write(hashp, (off_t)page << hashp->BSHIFT,
+	    p, size)) == -1)
 		/* Errno is set */
 		return (-1);
 	if (wsize != size) {
@@ -616,6 +618,56 @@ __put_page(hashp, p, bucket, is_bucket, is_bitmap)
 	return (0);
 }
 
+/*
+ * Read or write size bytes at offset off of the backing store: the
+ * file descriptor, or the stream a table opened with __hash_fopen
+ * lives on, such as a funopen stream over a flash device.  The
+ * stream is unbuffered; the buffer pool does the caching.
+ *
+ * Returns:
+ *	the number of bytes moved, 0 at the end of the store
+ *	-1 ==>failure, errno set
+ */
+extern int
+__hash_read(hashp, off, p, size)
+	HTAB *hashp;
+	off_t off;
+	void *p;
+	int size;
+{
+	size_t n;
+
+	if (hashp->stream == NULL)
+		return (lseek(hashp->fp, off, SEEK_SET) == -1 ? -1 :
+		    read(hashp->fp, p, size));
+	if (fseeko(hashp->stream, off, SEEK_SET) == -1)
+		return (-1);
+	n = fread(p, 1, size, hashp->stream);
+	if (n == 0 && ferror(hashp->stream))
+		return (-1);
+	return ((int)n);
+}
+
+extern int
+__hash_write(hashp, off, p, size)
+	HTAB *hashp;
+	off_t off;
+	const void *p;
+	int size;
+{
+	size_t n;
+
+	if (hashp->stream == NULL)
+		return (lseek(hashp->fp, off, SEEK_SET) == -1 ? -1 :
+		    write(hashp->fp, p, size));
+	if (fseeko(hashp->stream, off, SEEK_SET) == -1)
+		return (-1);
+	n = fwrite(p, 1, size, hashp->stream);
+	if (n == 0 && ferror(hashp->stream))
+		return (-1);
+	return ((int)n);
+}
+
 #define BYTE_MASK	((1 << INT_BYTE_SHIFT) -1)
 /*
  * Initialize a new bitmap page.  Bitmap pages are left in memory
@@ -55,6 +55,23 @@ __RCSID("$NetBSD: hcreate.c,v 1.2 2001/02/19 21:26:04 ross Exp $");
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef HSEARCH_COMPACT
+/*
+ * With HSEARCH_COMPACT the table is open addressed: a power of two
+ * number of slots, each holding the entry and 16 bits of its hash,
+ * probed linearly.  Finding a slot takes a mask rather than a divide,
+ * entering an item allocates nothing, and the stored hash rules out
+ * nearly every strcmp of a key that does not match.  The table holds
+ * at most its size in entries; hcreate_r makes it half as large again
+ * as asked for, so that probe runs stay short up to NEL entries.  An
+ * empty slot has a NULL key.
+ */
+struct internal_entry {
+	ENTRY ent;
+	__uint16_t hash;
+};
+#define	SLOT_SIZE	(sizeof (struct internal_entry))
+#else
 /*
  * DO NOT MAKE THIS STRUCTURE LARGER THAN 32 BYTES (4 ptrs on 64-bit
  * ptr machine) without adjusting MAX_BUCKETS_LG2 below.
@@ -64,6 +81,8 @@ struct internal_entry {
 	ENTRY ent;
 };
 SLIST_HEAD(internal_head, internal_entry);
+#define	SLOT_SIZE	(sizeof (struct internal_head))
+#endif
 
 #define	MIN_BUCKETS_LG2	4
 #define	MIN_BUCKETS	(1 << MIN_BUCKETS_LG2)
@@ -80,14 +99,52 @@ SLIST_HEAD(internal_head, internal_entry);
 #endif
 #define	MAX_BUCKETS	((size_t)1 << MAX_BUCKETS_LG2)
 
+/*
+ * The size is a power of two, so its low bit is free to record a table
+ * in a buffer from hcreate_static_r, which hdestroy_r must not free.
+ */
+#define	HTABLE_STATIC	1
+#define	HTABLE_SIZE(htab) ((htab)->htablesize & ~(size_t)HTABLE_STATIC)
+
+#ifdef HSEARCH_COMPACT
+#define	SLOTS(htab)	((struct internal_entry *) (htab)->htable)
+
+/* A 16-bit string hash, made of shifts and adds only. */
+static __uint16_t
+hash16(const char *key)
+{
+	__uint16_t h = 5381;
+
+	while (*key != '\0')
+		h = (h << 5) + h + (unsigned char) *key++;
+	return h ^ (h >> 7);
+}
+#else
 /* Default hash function, from db/hash/hash_func.c */
 extern __uint32_t (*__default_hash)(const void *, size_t);
+#endif
+
+/* Empty the NEL slots at TABLE and make them the table of HTAB. */
+static void
+htable_init(void *table, size_t nel, struct hsearch_data *htab)
+{
+	size_t idx;
+
+	htab->htable = table;
+	htab->htablesize = nel;
+	for (idx = 0; idx < nel; idx++)
+#ifdef HSEARCH_COMPACT
+		SLOTS(htab)[idx].ent.key = NULL;
+#else
+		SLIST_INIT(&(htab->htable[idx]));
+#endif
+}
 
 int
 hcreate_r(size_t nel, struct hsearch_data *htab)
 {
-	size_t idx;
 	unsigned int p2;
+	void *table;
 
 	/* Make sure this this isn't called when a table already exists. */
 	if (htab->htable != NULL) {
@@ -95,6 +152,11 @@ hcreate_r(size_t nel, struct hsearch_data *htab)
 		return 0;
 	}
 
+#ifdef HSEARCH_COMPACT
+	/* Leave a third of the slots free when nel are used. */
+	nel += nel / 2;
+#endif
+
 	/* If nel is too small, make it min sized. */
 	if (nel < MIN_BUCKETS)
 		nel = MIN_BUCKETS;
@@ -111,16 +173,45 @@ hcreate_r(size_t nel, struct hsearch_data *htab)
 	}
 	
 	/* Allocate the table. */
-	htab->htablesize = nel;
-	htab->htable = malloc(htab->htablesize * sizeof htab->htable[0]);
-	if (htab->htable == NULL) {
+	table = malloc(nel * SLOT_SIZE);
+	if (table == NULL) {
 		errno = ENOMEM;
 		return 0;
 	}
 
 	/* Initialize it. */
-	for (idx = 0; idx < htab->htablesize; idx++)
-		SLIST_INIT(&(htab->htable[idx]));
+	htable_init(table, nel, htab);
+
+	return 1;
+}
+
+int
+hcreate_static_r(void *buf, size_t size, struct hsearch_data *htab)
+{
+	size_t nel;
+
+	/* Make sure this this isn't called when a table already exists. */
+	if (htab->htable != NULL) {
+		errno = EINVAL;
+		return 0;
+	}
+
+	/* Use the largest power of two slots that fit. */
+	nel = size / SLOT_SIZE;
+	if (nel == 0) {
+		errno = EINVAL;
+		return 0;
+	}
+	while ((nel & (nel - 1)) != 0)
+		nel &= nel - 1;
+	if (nel == HTABLE_STATIC) {
+		/* One slot would collide with the flag; two are needed. */
+		errno = EINVAL;
+		return 0;
+	}
+
+	htable_init(buf, nel, htab);
+	htab->htablesize |= HTABLE_STATIC;
 
 	return 1;
 }
@@ -145,10 +236,55 @@ hdestroy_r(struct hsearch_data *htab)
 		}
 	}
 #endif
-	free(htab->htable);
+	if (!(htab->htablesize & HTABLE_STATIC))
+		free(htab->htable);
 	htab->htable = NULL;
 }
 
+#ifdef HSEARCH_COMPACT
+int
+hsearch_r(ENTRY item, ACTION action, ENTRY **retval, struct hsearch_data *htab)
+{
+	struct internal_entry *ie;
+	size_t mask = HTABLE_SIZE(htab) - 1;
+	size_t idx, n;
+	__uint16_t hashval;
+
+	hashval = hash16(item.key);
+
+	idx = hashval & mask;
+	for (n = 0; n <= mask; n++) {
+		ie = &SLOTS(htab)[idx];
+		if (ie->ent.key == NULL)
+			break;
+		if (ie->hash == hashval && strcmp(ie->ent.key, item.key) == 0)
+          {
+            *retval = &ie->ent;
+            return 1;
+          }
+		idx = (idx + 1) & mask;
+	}
+
+	if (action == FIND)
+          {
+            *retval = NULL;
+            return 0;
+          }
+	if (n > mask)
+          {
+            /* Every slot is in use. */
+            errno = ENOMEM;
+            *retval = NULL;
+            return 0;
+          }
+
+	ie->ent.key = item.key;
+	ie->ent.data = item.data;
+	ie->hash = hashval;
+        *retval = &ie->ent;
+	return 1;
+}
+#else
 int
 hsearch_r(ENTRY item, ACTION action, ENTRY **retval, struct hsearch_data *htab)
 {
@@ -160,7 +296,7 @@ hsearch_r(ENTRY item, ACTION action, ENTRY **retval, struct hsearch_data *htab)
 	len = strlen(item.key);
 	hashval = (*__default_hash)(item.key, len);
 
-        head = &(htab->htable[hashval & (htab->htablesize - 1)]);
+        head = &(htab->htable[hashval & (HTABLE_SIZE(htab) - 1)]);
 	ie = SLIST_FIRST(head);
 	while (ie != NULL) {
 		if (strcmp(ie->ent.key, item.key) == 0)
@@ -192,3 +328,4 @@ hsearch_r(ENTRY item, ACTION action, ENTRY **retval, struct hsearch_data *htab)
         *retval = &ie->ent;
 	return 1;
 }
+#endif
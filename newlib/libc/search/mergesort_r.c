@@ -0,0 +1,507 @@
+/*
+FUNCTION
+<<mergesort_r>>---stable sort of an array
+
+INDEX
+	mergesort_r
+
+SYNOPSIS
+	#include <stdlib.h>
+	void mergesort_r(void *<[base]>, size_t <[nmemb]>, size_t <[size]>,
+			 int (*<[compar]>)(const void *, const void *, void *),
+			 void *<[thunk]>, void *<[scratch]>);
+
+DESCRIPTION
+<<mergesort_r>> sorts the <[nmemb]> objects of <[size]> bytes at
+<[base]> as <<qsort_r>> does, calling <[compar]> with two elements and
+<[thunk]>, but stably: elements that compare equal keep the order they
+had.  Records sorted by one key and then by another come out ordered
+by the second key and, among equal second keys, by the first.
+
+<[scratch]> is an area of at least (<[nmemb]> + 1) / 2 elements that
+the sort uses in place of allocating any, so the memory it needs is
+known before the call; it need not be aligned, but the elements are
+moved a word at a time when it, <[base]> and <[size]> all are.  Runs
+of up to 16 elements are sorted by binary insertion and then merged
+pairwise, a merge skipping the elements already in place and copying
+a block at a time once one side keeps winning; an input that is
+already sorted costs about one comparison an element.  The sort takes
+O(<[nmemb]> log <[nmemb]>) comparisons and a small fixed amount of
+stack.
+
+With <[scratch]> NULL the merges are done in place instead, by
+rotating blocks of elements, which needs no memory but moves each
+element O(log <[nmemb]>) times more; it is meant for small arrays.
+
+RETURNS
+<<mergesort_r>> does not return a result.
+
+PORTABILITY
+<<mergesort_r>> is a newlib extension.
+*/
+
+#include <_ansi.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/yield.h>
+
+/* Elements sorted by binary insertion before the first merges.  */
+#define RUN		16
+
+/* Elements one side of a merge must win in a row before the next are
+   found by galloping, exponential then binary search, and copied a
+   block at a time.  */
+#define GALLOP		7
+
+typedef int cmp_t (const void *, const void *, void *);
+
+struct sort
+{
+  size_t es;
+  size_t unit;			/* bytes moved at a time */
+  cmp_t *cmp;
+  void *thunk;
+  char *tmp;
+};
+
+#define CMP(s, x, y)	((s)->cmp ((x), (y), (s)->thunk))
+
+/* Elements are moved an int at a time, the word of pic30, or a short
+   at a time when the array, the scratch area and the element size are
+   only aligned for that.  */
+#define MOVE(type, s, dst, src) \
+  do \
+    { \
+      type *__d = (type *) (dst); \
+      const type *__p = (const type *) (src); \
+      size_t __i = (s)->es / sizeof (type); \
+ \
+      do \
+	*__d++ = *__p++; \
+      while (--__i > 0); \
+    } \
+  while (0)
+
+#define SWAP(type, s, x, y) \
+  do \
+    { \
+      type *__a = (type *) (x); \
+      type *__b = (type *) (y); \
+      size_t __i = (s)->es / sizeof (type); \
+ \
+      do \
+	{ \
+	  type __t = *__a; \
+	  *__a++ = *__b; \
+	  *__b++ = __t; \
+	} \
+      while (--__i > 0); \
+    } \
+  while (0)
+
+static inline void
+copy1 (const struct sort *s,
+	char *dst,
+	const char *src)
+{
+  if (s->unit == sizeof (int))
+    MOVE (unsigned int, s, dst, src);
+  else if (s->unit == sizeof (short))
+    MOVE (unsigned short, s, dst, src);
+  else
+    MOVE (char, s, dst, src);
+}
+
+static inline void
+swap1 (const struct sort *s,
+	char *x,
+	char *y)
+{
+  if (s->unit == sizeof (int))
+    SWAP (unsigned int, s, x, y);
+  else if (s->unit == sizeof (short))
+    SWAP (unsigned short, s, x, y);
+  else
+    SWAP (char, s, x, y);
+}
+
+/* Reverse the N elements at P.  */
+static void
+reverse (const struct sort *s,
+	char *p,
+	size_t n)
+{
+  char *q = p + (n - 1) * s->es;
+
+  for (; p < q; p += s->es, q -= s->es)
+    swap1 (s, p, q);
+}
+
+/* Exchange the N1 elements at P with the N2 that follow them.  */
+static void
+rotate (const struct sort *s,
+	char *p,
+	size_t n1,
+	size_t n2)
+{
+  if (n1 == 0 || n2 == 0)
+    return;
+  reverse (s, p, n1);
+  reverse (s, p + n1 * s->es, n2);
+  reverse (s, p, n1 + n2);
+}
+
+/* How many of the N elements at BASE, counted from the start or with
+   FROM_END from the end, are below KEY, or with STRICT clear not above
+   it; from the end, above KEY or not below it.  They are found by
+   probing elements 0, 1, 3, 7 ... in from that end and then searching
+   the last step by halves, which costs O(log k) comparisons for k
+   elements.  */
+static size_t
+gallop (const struct sort *s,
+	const char *key,
+	const char *base,
+	size_t n,
+	int from_end,
+	int strict)
+{
+  size_t lo = 0, hi = n, i = 0;
+
+#define PRED(i) \
+  (from_end \
+   ? (strict ? CMP (s, key, base + (n - 1 - (i)) * s->es) < 0 \
+	     : CMP (s, key, base + (n - 1 - (i)) * s->es) <= 0) \
+   : (strict ? CMP (s, base + (i) * s->es, key) < 0 \
+	     : CMP (s, base + (i) * s->es, key) <= 0))
+
+  while (i < n)
+    {
+      if (!PRED (i))
+	{
+	  hi = i;
+	  break;
+	}
+      lo = i + 1;
+      i = 2 * i + 1;
+    }
+  while (lo < hi)
+    {
+      size_t mid = lo + (hi - lo) / 2;
+
+      if (PRED (mid))
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo;
+#undef PRED
+}
+
+/* Sort the N elements at A by binary insertion.  */
+static void
+insertion_sort (const struct sort *s,
+	char *a,
+	size_t n)
+{
+  size_t i, lo, hi;
+
+  for (i = 1; i < n; i++)
+    {
+      char *v = a + i * s->es;
+
+      if (CMP (s, v - s->es, v) <= 0)
+	continue;
+
+      /* The first element above v.  */
+      lo = 0;
+      hi = i - 1;
+      while (lo < hi)
+	{
+	  size_t mid = lo + (hi - lo) / 2;
+
+	  if (CMP (s, v, a + mid * s->es) < 0)
+	    hi = mid;
+	  else
+	    lo = mid + 1;
+	}
+
+      if (s->tmp != NULL)
+	{
+	  copy1 (s, s->tmp, v);
+	  memmove (a + (lo + 1) * s->es, a + lo * s->es, (i - lo) * s->es);
+	  copy1 (s, a + lo * s->es, s->tmp);
+	}
+      else
+	for (; v > a + lo * s->es; v -= s->es)
+	  swap1 (s, v - s->es, v);
+    }
+}
+
+/* Merge the NA elements at A with the NB after them, NA not above NB:
+   A is copied out to the scratch area and merged back from the
+   start.  */
+static void
+merge_lo (const struct sort *s,
+	char *a,
+	size_t na,
+	size_t nb)
+{
+  const size_t es = s->es;
+  char *pa = s->tmp, *pb = a + na * es, *dst = a;
+  unsigned int wa = 0, wb = 0;
+  size_t k, kb;
+
+  memcpy (s->tmp, a, na * es);
+
+  /* The first of B goes first: the caller has skipped the elements of
+     A not above it.  */
+  copy1 (s, dst, pb);
+  dst += es;
+  pb += es;
+  nb--;
+
+  while (na != 0 && nb != 0)
+    {
+      if (wa < GALLOP && wb < GALLOP)
+	{
+	  if (CMP (s, pb, pa) < 0)
+	    {
+	      copy1 (s, dst, pb);
+	      pb += es;
+	      nb--;
+	      wb++;
+	      wa = 0;
+	    }
+	  else
+	    {
+	      copy1 (s, dst, pa);
+	      pa += es;
+	      na--;
+	      wa++;
+	      wb = 0;
+	    }
+	  dst += es;
+	  continue;
+	}
+
+      /* The elements of A not above the next of B, then those of B
+	 below the next of A.  */
+      k = gallop (s, pb, pa, na, 0, 0);
+      memcpy (dst, pa, k * es);
+      dst += k * es;
+      pa += k * es;
+      na -= k;
+      if (na == 0)
+	break;
+      kb = gallop (s, pa, pb, nb, 0, 1);
+      memmove (dst, pb, kb * es);
+      dst += kb * es;
+      pb += kb * es;
+      nb -= kb;
+
+      /* Go back to one at a time once neither block was long.  */
+      if (k < GALLOP && kb < GALLOP)
+	wa = wb = 0;
+    }
+
+  /* What is left of B is in place.  */
+  memcpy (dst, pa, na * es);
+}
+
+/* Merge the NA elements at A with the NB after them, NB below NA: B
+   is copied out to the scratch area and merged back from the end.  */
+static void
+merge_hi (const struct sort *s,
+	char *a,
+	size_t na,
+	size_t nb)
+{
+  const size_t es = s->es;
+  char *b = a + na * es;
+  char *dst = b + nb * es;
+  unsigned int wa = 0, wb = 0;
+  size_t k, kb;
+
+  memcpy (s->tmp, b, nb * es);
+
+  /* The last of A goes last: the caller has skipped the elements of B
+     not below it.  */
+  dst -= es;
+  copy1 (s, dst, a + (na - 1) * es);
+  na--;
+
+  while (na != 0 && nb != 0)
+    {
+      char *la = a + (na - 1) * es, *lb = s->tmp + (nb - 1) * es;
+
+      if (wa < GALLOP && wb < GALLOP)
+	{
+	  dst -= es;
+	  if (CMP (s, lb, la) < 0)
+	    {
+	      copy1 (s, dst, la);
+	      na--;
+	      wa++;
+	      wb = 0;
+	    }
+	  else
+	    {
+	      copy1 (s, dst, lb);
+	      nb--;
+	      wb++;
+	      wa = 0;
+	    }
+	  continue;
+	}
+
+      /* The elements of B not below the last of A, then those of A
+	 above the last of B.  */
+      kb = gallop (s, la, s->tmp, nb, 1, 0);
+      dst -= kb * es;
+      nb -= kb;
+      memcpy (dst, s->tmp + nb * es, kb * es);
+      if (nb == 0)
+	break;
+      lb = s->tmp + (nb - 1) * es;
+      k = gallop (s, lb, a, na, 1, 1);
+      dst -= k * es;
+      na -= k;
+      memmove (dst, a + na * es, k * es);
+
+      if (k < GALLOP && kb < GALLOP)
+	wa = wb = 0;
+    }
+
+  /* What is left of A is in place.  */
+  memcpy (a, s->tmp, nb * es);
+}
+
+/* Merge the NA elements at A with the NB after them without scratch:
+   split the longer run in half, find where its middle element goes in
+   the other, rotate the two inner parts past each other and merge each
+   side.  The smaller side is merged by recursion, so the depth stays
+   under twice the bits of size_t.  */
+static void
+merge_inplace (const struct sort *s,
+	char *a,
+	size_t na,
+	size_t nb)
+{
+  while (na != 0 && nb != 0)
+    {
+      char *b = a + na * s->es;
+      size_t c1, c2;
+
+      if (na + nb == 2)
+	{
+	  if (CMP (s, b, a) < 0)
+	    swap1 (s, a, b);
+	  return;
+	}
+      if (na >= nb)
+	{
+	  c1 = na / 2;
+	  c2 = gallop (s, a + c1 * s->es, b, nb, 0, 1);
+	}
+      else
+	{
+	  c2 = nb / 2;
+	  c1 = gallop (s, b + c2 * s->es, a, na, 0, 0);
+	}
+      rotate (s, a + c1 * s->es, na - c1, c2);
+      if (c1 + c2 < na + nb - c1 - c2)
+	{
+	  merge_inplace (s, a, c1, c2);
+	  a += (c1 + c2) * s->es;
+	  na -= c1;
+	  nb -= c2;
+	}
+      else
+	{
+	  merge_inplace (s, a + (c1 + c2) * s->es, na - c1, nb - c2);
+	  na = c1;
+	  nb = c2;
+	}
+    }
+}
+
+static void
+merge (const struct sort *s,
+	char *a,
+	size_t na,
+	size_t nb)
+{
+  char *b = a + na * s->es;
+  size_t k;
+
+  if (CMP (s, b - s->es, b) <= 0)
+    return;
+
+  /* Skip the start of A that is not above the first of B and the end
+     of B that is not below the last of A; neither can be all of its
+     run.  */
+  k = gallop (s, b, a, na, 0, 0);
+  a += k * s->es;
+  na -= k;
+  nb -= gallop (s, b - s->es, b, nb, 1, 0);
+
+  if (s->tmp == NULL)
+    merge_inplace (s, a, na, nb);
+  else if (na <= nb)
+    merge_lo (s, a, na, nb);
+  else
+    merge_hi (s, a, na, nb);
+}
+
+void
+mergesort_r (void *base,
+	size_t n,
+	size_t es,
+	cmp_t *cmp,
+	void *thunk,
+	void *scratch)
+{
+  struct sort s;
+  char *a = (char *) base;
+  size_t lo, w, align;
+  unsigned int yield_steps = 0;
+
+  if (n < 2 || es == 0)
+    return;
+
+  s.es = es;
+  s.cmp = cmp;
+  s.thunk = thunk;
+  s.tmp = (char *) scratch;
+  align = (size_t) ((char *) base - (char *) 0) | es;
+  if (scratch != NULL)
+    align |= (size_t) ((char *) scratch - (char *) 0);
+  if (align % sizeof (int) == 0)
+    s.unit = sizeof (int);
+  else if (align % sizeof (short) == 0)
+    s.unit = sizeof (short);
+  else
+    s.unit = 1;
+
+  for (lo = 0; lo < n; lo += RUN)
+    {
+      insertion_sort (&s, a + lo * es, n - lo < RUN ? n - lo : RUN);
+      __libc_yield_count (yield_steps, RUN);
+    }
+
+  /* Merge runs pairwise, each run of a pass as long as the two of the
+     pass before.  The right run of a pair is never the longer, so half
+     the elements, rounded up, fill the scratch area.  */
+  for (w = RUN; w < n; w *= 2)
+    {
+      for (lo = 0; lo + w < n; lo += 2 * w)
+	{
+	  size_t nb = n - lo - w < w ? n - lo - w : w;
+
+	  merge (&s, a + lo * es, w, nb);
+	  __libc_yield_count (yield_steps, w + nb);
+	}
+      if (w > (size_t) -1 / 2)
+	break;
+    }
+}
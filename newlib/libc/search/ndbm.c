@@ -82,6 +82,42 @@ dbm_open(const char *file, int flags, mode_t mode)
 	return ((DBM *)__hash_open(path, flags, mode, 0, &info));
 }
 
+/*
+ * Like dbm_open, on a stream such as one funopen makes over a flash
+ * device: see __hash_fopen.  The pages are DBM_STREAM_BSIZE bytes, a
+ * flash page, and DBM_STREAM_PAGES of them are cached, by default the
+ * static buffer pool when the library is built with HASH_STATIC_BUFS.
+ */
+#ifndef DBM_STREAM_BSIZE
+#ifdef HASH_STATIC_BSIZE
+#define DBM_STREAM_BSIZE	HASH_STATIC_BSIZE
+#else
+#define DBM_STREAM_BSIZE	256
+#endif
+#endif
+#ifndef DBM_STREAM_PAGES
+#ifdef HASH_STATIC_BUFS
+#define DBM_STREAM_PAGES	HASH_STATIC_BUFS
+#else
+#define DBM_STREAM_PAGES	8
+#endif
+#endif
+
+extern DBM *
+dbm_fopen(FILE *stream, int flags)
+{
+	HASHINFO info;
+
+	info.bsize = DBM_STREAM_BSIZE;
+	info.ffactor = 8;
+	info.nelem = 1;
+	info.cachesize = DBM_STREAM_PAGES * DBM_STREAM_BSIZE;
+	info.hash = NULL;
+	info.lorder = 0;
+
+	return ((DBM *)__hash_fopen(stream, flags, &info));
+}
+
 extern void
 dbm_close(DBM *db)
 {
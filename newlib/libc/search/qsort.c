@@ -65,6 +65,8 @@ PORTABILITY
 #include <_ansi.h>
 #include <sys/cdefs.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <sys/yield.h>
 
 #ifndef __GNUC__
 #define inline
@@ -145,6 +147,64 @@ __unused
               :(CMP(thunk, b, c) > 0 ? b : (CMP(thunk, a, c) < 0 ? a : c ));
 }
 
+#ifdef QSORT_INTROSORT
+/*
+ * Heapsort, for the partitions that quicksort has split too unevenly too
+ * often.  It needs no stack and is O(n log n) whatever the input.
+ */
+#if !defined(I_AM_QSORT_R) && !defined(I_AM_GNU_QSORT_R)
+#define HEAP_UNUSED __unused
+#else
+#define HEAP_UNUSED
+#endif
+
+/* Sift the element at root down into the heap of the first n. */
+static void
+heap_sift (char *a,
+	size_t root,
+	size_t n,
+	size_t es,
+	int swaptype,
+	cmp_t *cmp,
+	void *thunk HEAP_UNUSED)
+{
+	size_t child;
+
+	while ((child = 2 * root + 1) < n) {
+		if (child + 1 < n &&
+		    CMP(thunk, a + child * es, a + (child + 1) * es) < 0)
+			child++;
+		if (CMP(thunk, a + root * es, a + child * es) >= 0)
+			break;
+		swap(a + root * es, a + child * es);
+		root = child;
+	}
+}
+
+static void
+heapsort_es (char *a,
+	size_t n,
+	size_t es,
+	int swaptype,
+	cmp_t *cmp,
+	void *thunk)
+{
+	size_t i;
+	unsigned int yield_steps = 0;
+
+	for (i = n / 2; i > 0; i--) {
+		heap_sift(a, i - 1, n, es, swaptype, cmp, thunk);
+		__libc_yield_count(yield_steps, 1);
+	}
+	while (n > 1) {
+		n--;
+		swap(a, a + n * es);
+		heap_sift(a, 0, n, es, swaptype, cmp, thunk);
+		__libc_yield_count(yield_steps, 1);
+	}
+}
+#endif
+
 /*
  * Classical function call recursion wastes a lot of stack space. Each
  * recursion level requires a full stack frame comprising all local variables
@@ -158,8 +218,19 @@ __unused
  * the parameter stack array is chosen to be similar to the stack frame
  * excluding the array. Each function call recursion level can handle this
  * number of iterative recursion levels.
+ *
+ * With QSORT_INTROSORT the array holds one level per bit of size_t.  That
+ * is always enough, since the part that is sorted first is never more
+ * than half of its parent, so function call recursion is never used.
+ * Each level also carries what is left of the depth budget, 2 log2(n)
+ * partitions.  A part that runs out of it is heapsorted, which bounds the
+ * worst case at O(n log n) comparisons.
  */
+#ifdef QSORT_INTROSORT
+#define PARAMETER_STACK_LEVELS (sizeof (size_t) * CHAR_BIT)
+#else
 #define PARAMETER_STACK_LEVELS 8u
+#endif
 
 #if defined(I_AM_QSORT_R)
 void
@@ -189,10 +260,22 @@ qsort (void *a,
 	int cmp_result;
 	int swaptype, swap_cnt;
 	size_t recursion_level = 0;
+	/* Elements partitioned since the last call to __libc_yield */
+	unsigned int yield_steps = 0;
+#ifdef QSORT_INTROSORT
+	size_t depth = 0;
+	struct { void *a; size_t n; size_t depth; }
+	    parameter_stack[PARAMETER_STACK_LEVELS];
+
+	for (d = n; d > 1; d >>= 1)
+		depth += 2;
+#else
 	struct { void *a; size_t n; } parameter_stack[PARAMETER_STACK_LEVELS];
+#endif
 
 	SWAPINIT(a, es);
 loop:	swap_cnt = 0;
+	__libc_yield_count(yield_steps, n);
 	if (n < 7) {
 		/* Short arrays are insertion sorted. */
 		for (pm = (char *) a + es; pm < (char *) a + n * es; pm += es)
@@ -201,6 +284,13 @@ loop:	swap_cnt = 0;
 				swap(pl, pl - es);
 		goto pop;
 	}
+#ifdef QSORT_INTROSORT
+	if (depth == 0) {
+		heapsort_es(a, n, es, swaptype, cmp, thunk);
+		goto pop;
+	}
+	depth--;
+#endif
 
 	/* Select a pivot element, move it to the left. */
 	pm = (char *) a + (n / 2) * es;
@@ -252,6 +342,12 @@ loop:	swap_cnt = 0;
 		pb += es;
 		pc -= es;
 	}
+#ifndef QSORT_INTROSORT
+	/*
+	 * Without a swap the part looks sorted already.  Insertion sort
+	 * finishes that in linear time, but is quadratic when the look
+	 * deceives, so introsort does not take the shortcut.
+	 */
 	if (swap_cnt == 0) {  /* Switch to insertion sort */
 		for (pm = (char *) a + es; pm < (char *) a + n * es; pm += es)
 			for (pl = pm; pl > (char *) a && CMP(thunk, pl - es, pl) > 0;
@@ -259,6 +355,9 @@ loop:	swap_cnt = 0;
 				swap(pl, pl - es);
 		goto pop;
 	}
+#else
+	(void) swap_cnt;
+#endif
 
 	/*
 	 * Rearrange the array in three parts sorted like this:
@@ -310,6 +409,9 @@ loop:	swap_cnt = 0;
 			 */
 			parameter_stack[recursion_level].a = a;
 			parameter_stack[recursion_level].n = n / es;
+#ifdef QSORT_INTROSORT
+			parameter_stack[recursion_level].depth = depth;
+#endif
 			recursion_level++;
 			a = pa;
 			n = r / es;
@@ -340,6 +442,9 @@ pop:
 		recursion_level--;
 		a = parameter_stack[recursion_level].a;
 		n = parameter_stack[recursion_level].n;
+#ifdef QSORT_INTROSORT
+		depth = parameter_stack[recursion_level].depth;
+#endif
 		goto loop;
 	}
 }
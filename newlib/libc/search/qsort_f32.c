@@ -0,0 +1,22 @@
+/* qsort_f32: see qsort_i16.c.  */
+
+#include <_ansi.h>
+#include <string.h>
+#include <sys/types.h>
+
+/* The bits of x as an integer that orders like x does: flipping all
+   but the sign of a negative number turns sign and magnitude into
+   two's complement.  */
+static inline __int32_t
+f32_key (float x)
+{
+  __int32_t k;
+
+  memcpy (&k, &x, sizeof k);
+  return k ^ ((__int32_t) ((__uint32_t) (k >> 31) >> 1));
+}
+
+#define QSORT_NAME	qsort_f32
+#define QSORT_TYPE	float
+#define QSORT_LESS(x, y) (f32_key (x) < f32_key (y))
+#include "qsort_typed.h"
@@ -0,0 +1,6 @@
+/* qsort_i32: see qsort_i16.c.  */
+
+#define QSORT_NAME	qsort_i32
+#define QSORT_TYPE	__int32_t
+#define QSORT_LESS(x, y) ((x) < (y))
+#include "qsort_typed.h"
@@ -0,0 +1,159 @@
+/* The body of qsort_i16, qsort_u16, qsort_i32 and qsort_f32.
+
+   The including file defines QSORT_NAME, the element type QSORT_TYPE and
+   QSORT_LESS (x, y), true when x sorts before y.  The comparison is
+   expanded inline, so an element costs a load and a compare instead of
+   a call through a pointer.
+
+   The sort is an introsort: quicksort with a median of three pivot and
+   Hoare partitioning, which splits runs of equal keys evenly, over an
+   explicit stack with one entry per bit of size_t, pushing the larger
+   part so that the smaller one never exceeds half.  A part that has
+   been split 2 log2(n) times is heapsorted, and parts of up to
+   INSERTION_MAX elements are insertion sorted.  */
+
+#include <_ansi.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#define INSERTION_MAX	12
+
+#define SWAP(x, y) \
+  do { QSORT_TYPE __t = *(x); *(x) = *(y); *(y) = __t; } while (0)
+
+static void
+insertion_sort (QSORT_TYPE *a,
+	size_t n)
+{
+  size_t i, j;
+
+  for (i = 1; i < n; i++)
+    {
+      QSORT_TYPE v = a[i];
+
+      for (j = i; j > 0 && QSORT_LESS (v, a[j - 1]); j--)
+	a[j] = a[j - 1];
+      a[j] = v;
+    }
+}
+
+static void
+heap_sift (QSORT_TYPE *a,
+	size_t root,
+	size_t n)
+{
+  QSORT_TYPE v = a[root];
+  size_t child;
+
+  while ((child = 2 * root + 1) < n)
+    {
+      if (child + 1 < n && QSORT_LESS (a[child], a[child + 1]))
+	child++;
+      if (!QSORT_LESS (v, a[child]))
+	break;
+      a[root] = a[child];
+      root = child;
+    }
+  a[root] = v;
+}
+
+static void
+heap_sort (QSORT_TYPE *a,
+	size_t n)
+{
+  size_t i;
+
+  for (i = n / 2; i > 0; i--)
+    heap_sift (a, i - 1, n);
+  while (n > 1)
+    {
+      n--;
+      SWAP (a, a + n);
+      heap_sift (a, 0, n);
+    }
+}
+
+void
+QSORT_NAME (QSORT_TYPE *a,
+	size_t n)
+{
+  struct { QSORT_TYPE *a; size_t n; unsigned int depth; }
+    stack[sizeof (size_t) * CHAR_BIT];
+  unsigned int sp = 0;
+  unsigned int depth = 0;
+  size_t m;
+
+  for (m = n; m > 1; m >>= 1)
+    depth += 2;
+
+  for (;;)
+    {
+      while (n > INSERTION_MAX)
+	{
+	  QSORT_TYPE *i, *j, *hi = a + n - 1, *mid = a + n / 2;
+	  QSORT_TYPE pivot;
+	  size_t nl;
+
+	  if (depth == 0)
+	    {
+	      heap_sort (a, n);
+	      n = 0;
+	      break;
+	    }
+	  depth--;
+
+	  /* Order a[0], the middle and a[n - 1]; the outer two then stop
+	     both scans without bounds checks.  */
+	  if (QSORT_LESS (*mid, *a))
+	    SWAP (mid, a);
+	  if (QSORT_LESS (*hi, *mid))
+	    {
+	      SWAP (hi, mid);
+	      if (QSORT_LESS (*mid, *a))
+		SWAP (mid, a);
+	    }
+	  pivot = *mid;
+
+	  i = a + 1;
+	  j = hi - 1;
+	  for (;;)
+	    {
+	      while (QSORT_LESS (*i, pivot))
+		i++;
+	      while (QSORT_LESS (pivot, *j))
+		j--;
+	      if (i >= j)
+		break;
+	      SWAP (i, j);
+	      i++;
+	      j--;
+	    }
+
+	  /* [a, i) is not above the pivot and [i, a + n) not below it;
+	     both are non-empty.  Sort the smaller first.  */
+	  nl = i - a;
+	  stack[sp].depth = depth;
+	  if (nl < n - nl)
+	    {
+	      stack[sp].a = i;
+	      stack[sp].n = n - nl;
+	      n = nl;
+	    }
+	  else
+	    {
+	      stack[sp].a = a;
+	      stack[sp].n = nl;
+	      a = i;
+	      n -= nl;
+	    }
+	  sp++;
+	}
+      insertion_sort (a, n);
+      if (sp == 0)
+	break;
+      sp--;
+      a = stack[sp].a;
+      n = stack[sp].n;
+      depth = stack[sp].depth;
+    }
+}
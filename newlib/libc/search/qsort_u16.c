@@ -0,0 +1,6 @@
+/* qsort_u16: see qsort_i16.c.  */
+
+#define QSORT_NAME	qsort_u16
+#define QSORT_TYPE	__uint16_t
+#define QSORT_LESS(x, y) ((x) < (y))
+#include "qsort_typed.h"
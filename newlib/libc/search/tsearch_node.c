@@ -0,0 +1,86 @@
+/*
+ * tsearch and tdelete on nodes the caller provides, so that a tree
+ * costs no allocation.  The nodes are laid out like node_t, and tfind
+ * and twalk work on the trees these build; tdestroy, which frees every
+ * node, does not.
+ *
+ * Tree search generalized from Knuth (6.2.2) Algorithms T and D, as in
+ * tsearch.c and tdelete.c.
+ */
+
+#include <sys/cdefs.h>
+#include <assert.h>
+#define _SEARCH_PRIVATE
+#include <search.h>
+#include <stdlib.h>
+
+/* find datum in search tree, or insert it with NODE */
+void *
+tsearch_node (const void *vkey,		/* key to be located */
+	struct tnode *node,		/* storage for a new node */
+	void **vrootp,		/* address of tree root */
+	int (*compar)(const void *, const void *))
+{
+	node_t **rootp = (node_t **)vrootp;
+	node_t *q = (node_t *)node;
+
+	if (rootp == NULL || q == NULL)
+		return NULL;
+
+	while (*rootp != NULL) {	/* Knuth's T1: */
+		int r;
+
+		if ((r = (*compar)(vkey, (*rootp)->key)) == 0)	/* T2: */
+			return *rootp;		/* we found it! */
+
+		rootp = (r < 0) ?
+		    &(*rootp)->llink :		/* T3: follow left branch */
+		    &(*rootp)->rlink;		/* T4: follow right branch */
+	}
+
+	*rootp = q;				/* T5: link new node to old */
+	/* LINTED const castaway ok */
+	q->key = (void *)vkey;			/* initialize new node */
+	q->llink = q->rlink = NULL;
+	return q;
+}
+
+/* unlink node with given key and return it */
+void *
+tdelete_node (const void *__restrict vkey,	/* key to be deleted */
+	void      **__restrict vrootp,	/* address of the root of tree */
+	int       (*compar)(const void *, const void *))
+{
+	node_t **rootp = (node_t **)vrootp;
+	node_t *p, *q, *r;
+	int  cmp;
+
+	if (rootp == NULL || *rootp == NULL)
+		return NULL;
+
+	while ((cmp = (*compar)(vkey, (*rootp)->key)) != 0) {
+		rootp = (cmp < 0) ?
+		    &(*rootp)->llink :		/* follow llink branch */
+		    &(*rootp)->rlink;		/* follow rlink branch */
+		if (*rootp == NULL)
+			return NULL;		/* key not found */
+	}
+	p = *rootp;
+	r = p->rlink;				/* D1: */
+	if ((q = p->llink) == NULL)		/* Left NULL? */
+		q = r;
+	else if (r != NULL) {			/* Right link is NULL? */
+		if (r->llink == NULL) {		/* D2: Find successor */
+			r->llink = q;
+			q = r;
+		} else {			/* D3: Find NULL link */
+			for (q = r->llink; q->llink != NULL; q = r->llink)
+				r = q;
+			r->llink = q->rlink;
+			q->llink = p->llink;
+			q->rlink = p->rlink;
+		}
+	}
+	*rootp = q;				/* D4: link parent to new node */
+	return p;
+}
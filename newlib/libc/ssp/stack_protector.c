@@ -5,13 +5,12 @@
 #include <string.h>
 #include <unistd.h>
 
-#if defined(__AMDGCN__) || defined(__dsPIC30__)
+#if defined(__AMDGCN__)
 /* GCN does not support constructors, yet.  */
-/* PIC30 does not support constructors as well. Shame on MCHP! */
-uintptr_t __stack_chk_guard = 0x00000aff; /* 0, 0, '\n', 255  */
+uintptr_t __stack_chk_guard _NEAR_DATA = 0x00000aff; /* 0, 0, '\n', 255  */
 
 #else
-uintptr_t __stack_chk_guard = 0;
+uintptr_t __stack_chk_guard _NEAR_DATA = 0;
 
 void
 __attribute__((__constructor__))
@@ -22,6 +21,13 @@ __stack_chk_init (void)
 
 #if defined(__CYGWIN__) || defined(__rtems__)
   arc4random_buf(&__stack_chk_guard, sizeof(__stack_chk_guard));
+#elif defined(__dsPIC30__)
+  /* From the noise source of the BSP, if the program has one.  The
+     guard is 16 bits: otherwise 255, '\n', what fits of the terminator
+     canary.  */
+  if (getentropy (&__stack_chk_guard, sizeof (__stack_chk_guard)) != 0
+      || __stack_chk_guard == 0)
+    __stack_chk_guard = 0x0aff;
 #else
   /* If getentropy is not available, use the "terminator canary". */
   ((unsigned char *)&__stack_chk_guard)[0] = 0;
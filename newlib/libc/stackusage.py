@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+#
+# stackusage.py -- worst-case stack of each public function of a library.
+#
+# usage: stackusage.py [options] ARCHIVE...
+#
+# Combines the .su files GCC writes under -fstack-usage, found below
+# the --su directories, with a call graph taken from the disassembly
+# of the archives, and prints for each global function the bytes of
+# stack it can take with everything it calls: its own frame, the
+# return address of each call and the deepest callee.  The .su file
+# of lib_a-foo.o is lib_a-foo.su, so frames are matched to objects
+# and a static function is told apart from one of the same name
+# elsewhere.
+#
+# A function the graph cannot bound is flagged rather than guessed:
+#
+#	dynamic		its frame depends on its arguments (alloca, VLAs)
+#	indirect	it calls through a pointer, qsort's comparison or a
+#			hook, which is not counted
+#	recursive	it is on a cycle, which is counted once around
+#	nosu		no .su frame, an assembler routine; for pic30 the
+#			frame of its lnk is used
+#	extern		it calls something outside the archives, taken as 0
+#
+# A flag on a callee is shown on the caller too.  Calls are the CALL
+# and RCALL of pic30 and the call instructions of the usual hosts;
+# GOTO, JMP and branches to another function are tail calls and are
+# counted like calls, which may overstate by the caller's frame.
+
+import argparse
+import collections
+import os
+import re
+import subprocess
+
+SU = re.compile(r'^(?:.*?:\d+(?::\d+)?:)?(\S+)\s+(\d+)\s+(\S+)\s*$')
+OBJECT = re.compile(r'^(\S+?):\s+file format (\S+)')
+FUNC = re.compile(r'^([0-9a-f]+) <([^>]+)>:')
+INSN = re.compile(r'^\s*([0-9a-f]+):\s+(?:[0-9a-f]{2}\s)+\s*(\S+)\s*(.*)$')
+RELOC = re.compile(r'^\s*([0-9a-f]+):\s+R_\S+\s+([^\s+-]+)([+-]0x[0-9a-f]+)?')
+TARGET = re.compile(r'<([^>+]+)(?:\+0x([0-9a-f]+))?>')
+LNK = re.compile(r'#0x([0-9a-f]+)|#(\d+)')
+
+CALLS = {'call', 'rcall', 'callq', 'bl', 'blx', 'jal', 'jsr', 'bsr'}
+JUMPS = {'goto', 'jmp', 'jmpq', 'bra', 'b'}
+
+
+def read_su(dirs):
+    """Frames by (object, function), from every .su below DIRS."""
+    frames = {}
+    for top in dirs:
+        for root, _, files in os.walk(top):
+            for name in files:
+                if not name.endswith('.su'):
+                    continue
+                obj = name[:-3] + '.o'
+                with open(os.path.join(root, name)) as f:
+                    for line in f:
+                        m = SU.match(line)
+                        if m:
+                            func, size, kind = m.groups()
+                            frames[obj, func] = (int(size),
+                                                 kind.startswith('dynamic'))
+    return frames
+
+
+class Func:
+    def __init__(self, obj, name, start):
+        self.obj, self.name, self.start = obj, name, start
+        self.calls = set()          # (symbol, section offset or None)
+        self.indirect = False
+        self.lnk = None
+        self.frame = None
+        self.dynamic = False
+
+
+def disassemble(objdump, archive):
+    """Functions of each object of ARCHIVE, and the file format."""
+    out = subprocess.run([objdump, '-dr', archive], capture_output=True,
+                         text=True, check=True).stdout
+    funcs, fmt, obj, cur = [], None, None, None
+    # A call or jump waiting for the relocation, if any, that names its
+    # target: before linking the target shown is only a placeholder.
+    pending = None
+
+    def commit():
+        if pending is not None:
+            fn, op, t = pending
+            if t is None:
+                if op in CALLS:
+                    fn.indirect = True
+            elif op in CALLS or t[0] != fn.name:
+                fn.calls.add(t)
+
+    for line in out.splitlines():
+        m = RELOC.match(line)
+        if m:
+            if pending is not None:
+                # A negative addend is the bias of a PC-relative field.
+                add = int(m.group(3), 16) if m.group(3) else 0
+                off = max(add, 0)
+                fn, op, t = pending
+                pending = (fn, op, (m.group(2), off))
+            continue
+        commit()
+        pending = None
+        m = OBJECT.match(line)
+        if m:
+            obj, fmt, cur = os.path.basename(m.group(1)), m.group(2), None
+            continue
+        m = FUNC.match(line)
+        if m:
+            cur = Func(obj, m.group(2), int(m.group(1), 16))
+            funcs.append(cur)
+            continue
+        m = INSN.match(line)
+        if cur is None or not m:
+            continue
+        op, args = m.group(2).lower(), m.group(3)
+        if op == 'lnk' and cur.lnk is None:
+            lm = LNK.search(args)
+            if lm:
+                cur.lnk = int(lm.group(1), 16) if lm.group(1) else int(lm.group(2))
+        if op not in CALLS and op not in JUMPS:
+            continue
+        t = TARGET.search(args)
+        if t:
+            off = int(t.group(2), 16) if t.group(2) else 0
+            if t.group(1) == cur.name and op in JUMPS:
+                continue            # a branch within the function
+            target = (t.group(1), off if t.group(1).startswith('.') else None)
+            if t.group(1) == cur.name:
+                target = ('.', cur.start + off)
+            pending = (cur, op, target)
+        elif op in CALLS:
+            # Named by a relocation, or else through a pointer.
+            pending = (cur, op, None)
+    commit()
+    return funcs, fmt
+
+
+def strip_prefix(name, prefix):
+    return name[len(prefix):] if prefix and name.startswith(prefix) else name
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Worst-case stack per function.')
+    ap.add_argument('archives', nargs='+')
+    ap.add_argument('--su', action='append', default=[],
+                    help='directory to find .su files below (repeatable)')
+    ap.add_argument('--objdump', default='objdump')
+    ap.add_argument('--nm', default='nm')
+    ap.add_argument('--prefix', help='user label prefix (default: by format)')
+    ap.add_argument('--call-cost', type=int,
+                    help='bytes a call pushes (default: by format)')
+    ap.add_argument('--all', action='store_true',
+                    help='list static functions too')
+    opts = ap.parse_args()
+
+    frames = read_su(opts.su or ['.'])
+    funcs, fmt = [], ''
+    publics = set()
+    for a in opts.archives:
+        f, fmt = disassemble(opts.objdump, a)
+        funcs += f
+        out = subprocess.run([opts.nm, '-g', '--defined-only', a],
+                             capture_output=True, text=True, check=True)
+        for line in out.stdout.splitlines():
+            parts = line.split()
+            if len(parts) == 3 and parts[1] in 'TtW':
+                publics.add(parts[2])
+
+    pic30 = 'pic30' in fmt
+    prefix = opts.prefix if opts.prefix is not None else ('_' if pic30 else '')
+    cost = opts.call_cost
+    if cost is None:
+        cost = 8 if '64' in fmt else 4
+
+    by_obj = collections.defaultdict(list)
+    globl = {}
+    for fn in funcs:
+        by_obj[fn.obj].append(fn)
+        if fn.name in publics:
+            globl[fn.name] = fn
+        su = frames.get((fn.obj, strip_prefix(fn.name, prefix)))
+        if su:
+            fn.frame, fn.dynamic = su
+    for fs in by_obj.values():
+        fs.sort(key=lambda fn: fn.start)
+
+    def resolve(fn, sym, off):
+        if sym.startswith('.'):
+            # Section-relative: the function of this object at the offset.
+            hit = None
+            for g in by_obj[fn.obj]:
+                if g.start <= (off or 0):
+                    hit = g
+            return hit
+        for g in by_obj[fn.obj]:
+            if g.name == sym:
+                return g
+        return globl.get(sym)
+
+    memo, onpath = {}, set()
+
+    def worst(fn):
+        """(bytes, flags, deepest path) for FN."""
+        if fn in memo:
+            return memo[fn]
+        if fn in onpath:
+            return 0, {'recursive'}, []
+        onpath.add(fn)
+        flags = set()
+        if fn.frame is None:
+            flags.add('nosu')
+            own = fn.lnk or 0
+        else:
+            own = fn.frame
+        if fn.dynamic:
+            flags.add('dynamic')
+        if fn.indirect:
+            flags.add('indirect')
+        deep, path = 0, []
+        for sym, off in sorted(fn.calls, key=lambda c: (c[0], c[1] or 0)):
+            g = resolve(fn, sym, off)
+            if g is None:
+                flags.add('extern')
+                continue
+            if g is fn:
+                flags.add('recursive')
+                continue
+            n, f, p = worst(g)
+            flags |= f
+            if n + cost > deep:
+                deep, path = n + cost, [g] + p
+        onpath.discard(fn)
+        memo[fn] = (own + deep, flags, path)
+        return memo[fn]
+
+    shown = [fn for fn in funcs
+             if opts.all or fn.name in publics]
+    print('# worst-case stack in bytes, %s, %d bytes a call' % (fmt, cost))
+    print('# function  total  frame  flags  deepest path')
+    seen = set()
+    for fn in sorted(shown, key=lambda fn: (strip_prefix(fn.name, prefix),
+                                             fn.obj)):
+        key = (fn.obj, fn.name)
+        if key in seen:
+            continue
+        seen.add(key)
+        n, flags, path = worst(fn)
+        own = fn.frame if fn.frame is not None else (fn.lnk or 0)
+        print('%-24s %6d %6d  %-8s %s' % (
+            strip_prefix(fn.name, prefix), n, own,
+            ','.join(sorted(flags)) or '-',
+            ' > '.join(strip_prefix(g.name, prefix) for g in path)))
+
+
+if __name__ == '__main__':
+    main()
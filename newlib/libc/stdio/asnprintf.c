@@ -19,42 +19,13 @@ _asnprintf_r (struct _reent *__restrict ptr,
        size_t *lenp,
        const char *__restrict fmt, ...)
 {
-  int ret;
+  char *str;
   va_list ap;
-  FILE f;
-  size_t len = *lenp;
 
-  if (buf && len)
-    {
-      /* mark an existing buffer, but allow allocation of larger string */
-      f._flags = __SWR | __SSTR | __SOPT;
-    }
-  else
-    {
-      /* mark a zero-length reallocatable buffer */
-      f._flags = __SWR | __SSTR | __SMBF;
-      len = 0;
-      buf = NULL;
-    }
-  f._bf._base = f._p = (unsigned char *) buf;
-  /* For now, inherit the 32-bit signed limit of FILE._bf._size.
-     FIXME - it would be nice to rewrite sys/reent.h to support size_t
-     for _size.  */
-  if (len > INT_MAX)
-    {
-      ptr->_errno = EOVERFLOW;
-      return NULL;
-    }
-  f._bf._size = f._w = len;
-  f._file = -1;  /* No file. */
   va_start (ap, fmt);
-  ret = _svfprintf_r (ptr, &f, fmt, ap);
+  str = _vasnprintf_r (ptr, buf, lenp, fmt, ap);
   va_end (ap);
-  if (ret < 0)
-    return NULL;
-  *lenp = ret;
-  *f._p = '\0';
-  return (char *) f._bf._base;
+  return str;
 }
 
 #ifdef _NANO_FORMATTED_IO
@@ -70,43 +41,13 @@ asnprintf (char *__restrict buf,
        size_t *__restrict lenp,
        const char *__restrict fmt, ...)
 {
-  int ret;
+  char *str;
   va_list ap;
-  FILE f;
-  size_t len = *lenp;
-  struct _reent *ptr = _REENT;
 
-  if (buf && len)
-    {
-      /* mark an existing buffer, but allow allocation of larger string */
-      f._flags = __SWR | __SSTR | __SOPT;
-    }
-  else
-    {
-      /* mark a zero-length reallocatable buffer */
-      f._flags = __SWR | __SSTR | __SMBF;
-      len = 0;
-      buf = NULL;
-    }
-  f._bf._base = f._p = (unsigned char *) buf;
-  /* For now, inherit the 32-bit signed limit of FILE._bf._size.
-     FIXME - it would be nice to rewrite sys/reent.h to support size_t
-     for _size.  */
-  if (len > INT_MAX)
-    {
-      ptr->_errno = EOVERFLOW;
-      return NULL;
-    }
-  f._bf._size = f._w = len;
-  f._file = -1;  /* No file. */
   va_start (ap, fmt);
-  ret = _svfprintf_r (ptr, &f, fmt, ap);
+  str = _vasnprintf_r (_REENT, buf, lenp, fmt, ap);
   va_end (ap);
-  if (ret < 0)
-    return NULL;
-  *lenp = ret;
-  *f._p = '\0';
-  return (char *) f._bf._base;
+  return str;
 }
 
 #ifdef _NANO_FORMATTED_IO
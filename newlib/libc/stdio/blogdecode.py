@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+#
+# blogdecode.py -- turn the records of blog_printf back into text.
+#
+# usage: blogdecode.py [options] PROGRAM.elf LOG
+#
+# LOG holds the bytes blog_read returned on the target, in order.  The
+# formats are read from the loaded sections of the executable, so it
+# must be the one that wrote the log.  The sizes of the C types are
+# those of the target and default to pic30's; give the others with
+# the options.  Where a section is seen by the program at another
+# address than the one in the executable, as for constants read
+# through the pic30 PSV window, give that address with --map.
+#
+# The record layout is described in <blog.h>.
+
+import argparse
+import re
+import struct
+import sys
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+
+class Image:
+    """The loaded sections of an ELF file, by address."""
+
+    def __init__(self, path, maps):
+        with open(path, 'rb') as f:
+            data = f.read()
+        if data[:4] != b'\x7fELF':
+            sys.exit('%s: not an ELF file' % path)
+        wide = data[4] == 2
+        end = '<' if data[5] == 1 else '>'
+        if wide:
+            shoff, = struct.unpack_from(end + 'Q', data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(end + 'HHH',
+                                                            data, 0x3a)
+            fmt = end + 'IIQQQQIIQQ'
+        else:
+            shoff, = struct.unpack_from(end + 'I', data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(end + 'HHH',
+                                                            data, 0x2e)
+            fmt = end + 'IIIIIIIIII'
+        shdrs = [struct.unpack_from(fmt, data, shoff + i * shentsize)
+                 for i in range(shnum)]
+        strtab = shdrs[shstrndx]
+        strtab = data[strtab[4]:strtab[4] + strtab[5]]
+        self.sections = []
+        for h in shdrs:
+            name, typ, flags, addr, off, size = h[:6]
+            if not flags & SHF_ALLOC or typ == SHT_NOBITS:
+                continue
+            name = strtab[name:strtab.index(b'\0', name)].decode()
+            addr = maps.get(name, addr)
+            self.sections.append((addr, data[off:off + size]))
+
+    def string(self, addr):
+        for base, body in self.sections:
+            if base <= addr < base + len(body):
+                at = addr - base
+                stop = body.find(b'\0', at)
+                return body[at:stop if stop >= 0 else len(body)].decode(
+                    'latin-1')
+        return None
+
+
+CONV = re.compile(r'%([#\-0+ ]*)(\*|\d*)(?:\.(\*|\d*))?([hlL]?)(.?)', re.S)
+
+
+class Record:
+    def __init__(self, body, sizes, end):
+        self.body, self.at, self.sizes, self.end = body, 0, sizes, end
+
+    def take(self, n):
+        if self.at + n > len(self.body):
+            raise ValueError('record too short')
+        b = self.body[self.at:self.at + n]
+        self.at += n
+        return b
+
+    def int(self, kind, signed):
+        n = self.sizes[kind]
+        return int.from_bytes(self.take(n), 'little' if self.end == '<'
+                              else 'big', signed=signed)
+
+    def float(self, kind):
+        n = self.sizes[kind]
+        if n not in (4, 8):
+            raise ValueError('cannot decode a %d byte %s' % (n, kind))
+        return struct.unpack(self.end + ('f' if n == 4 else 'd'),
+                             self.take(n))[0]
+
+    def string(self):
+        stop = self.body.find(b'\0', self.at)
+        if stop < 0:
+            raise ValueError('unterminated string')
+        s = self.body[self.at:stop].decode('latin-1')
+        self.at = stop + 1
+        return s
+
+
+def render(fmt, rec):
+    out = []
+    pos = 0
+    for m in CONV.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, prec, length, conv = m.groups()
+        args = []
+        if width == '*':
+            args.append(rec.int('int', True))
+        if prec == '*':
+            args.append(rec.int('int', True))
+        spec = '%' + flags + width + ('' if prec is None else '.' + prec)
+        kind = 'long' if length == 'l' else 'int'
+        if conv and conv in 'di':
+            v = rec.int(kind, True)
+            if length == 'h':
+                v = (v & 0xffff) - ((v & 0x8000) << 1)
+            out.append((spec + 'd') % tuple(args + [v]))
+        elif conv and conv in 'ouxX':
+            v = rec.int(kind, False)
+            if length == 'h':
+                v &= 0xffff
+            out.append((spec + ('d' if conv == 'u' else conv))
+                       % tuple(args + [v]))
+        elif conv == 'c':
+            v = rec.int('int', False) & 0xff
+            out.append((spec + 'c') % tuple(args + [v]))
+        elif conv == 'p':
+            v = rec.int('ptr', False)
+            out.append((spec + 's') % tuple(args + ['0x%x' % v]))
+        elif conv and conv in 'eEfFgG':
+            v = rec.float('long double' if length == 'L' else 'double')
+            out.append((spec + conv) % tuple(args + [v]))
+        elif conv == 's':
+            out.append((spec + 's') % tuple(args + [rec.string()]))
+        elif conv == '%':
+            out.append('%')
+        elif conv == 'n' or conv == '':
+            pass
+        else:
+            out.append(conv)
+    out.append(fmt[pos:])
+    return ''.join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Decode a blog_printf log.')
+    ap.add_argument('elf')
+    ap.add_argument('log')
+    ap.add_argument('--int', type=int, default=2)
+    ap.add_argument('--long', type=int, default=4)
+    ap.add_argument('--ptr', type=int, default=2)
+    ap.add_argument('--double', type=int, default=4)
+    ap.add_argument('--long-double', type=int, default=8)
+    ap.add_argument('--big-endian', action='store_true')
+    ap.add_argument('--map', action='append', default=[],
+                    metavar='SECTION=ADDR',
+                    help='the address the program sees SECTION at')
+    opts = ap.parse_args()
+
+    maps = {}
+    for m in opts.map:
+        name, _, addr = m.partition('=')
+        maps[name] = int(addr, 0)
+    image = Image(opts.elf, maps)
+    sizes = {'int': opts.int, 'long': opts.long, 'ptr': opts.ptr,
+             'double': opts.double, 'long double': opts.long_double}
+    end = '>' if opts.big_endian else '<'
+
+    with open(opts.log, 'rb') as f:
+        log = f.read()
+    at = 0
+    while at < len(log):
+        n = log[at]
+        body = log[at + 1:at + 1 + n]
+        at += 1 + n
+        if len(body) < n:
+            print('<truncated record>')
+            break
+        rec = Record(body, sizes, end)
+        try:
+            addr = rec.int('ptr', False)
+            fmt = image.string(addr)
+            if fmt is None:
+                print('<no format at 0x%x>' % addr)
+                continue
+            sys.stdout.write(render(fmt, rec))
+        except ValueError as e:
+            print('<bad record: %s>' % e)
+
+
+if __name__ == '__main__':
+    main()
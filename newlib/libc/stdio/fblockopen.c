@@ -0,0 +1,327 @@
+/*
+FUNCTION
+<<fblockopen>>---open a stream on a block device
+
+INDEX
+	fblockopen
+INDEX
+	_fblockopen_r
+
+SYNOPSIS
+	#include <stdio.h>
+	FILE *fblockopen(void *<[dev]>, const struct fblock_ops *<[ops]>,
+			 size_t <[block_size]>, off_t <[size]>,
+			 const char *<[mode]>);
+	FILE *_fblockopen_r(struct _reent *<[reent]>, void *<[dev]>,
+			    const struct fblock_ops *<[ops]>,
+			    size_t <[block_size]>, off_t <[size]>,
+			    const char *<[mode]>);
+
+DESCRIPTION
+<<fblockopen>> creates a <<FILE>> stream over a device that is read
+and written in blocks of <[block_size]> bytes, such as SPI flash or an
+SD card.  The device is reached through <[ops]>:
+
+.	struct fblock_ops
+.	{
+.		int (*read) (void *dev, unsigned long block, void *buf,
+.			     size_t count);
+.		int (*write) (void *dev, unsigned long block,
+.			      const void *buf);
+.		int (*close) (void *dev);
+.	};
+
+<[ops->read]> reads <[count]> blocks, one or two, starting at
+<[block]> into <[buf]>, and <[ops->write]> writes the one block at
+<[buf]> to <[block]>.  Each is passed <[dev]> first and returns 0 on
+success or -1 with <<errno>> set on failure.  <[ops->write]> may only
+be NULL when <[mode]> does not write, and <[ops->close]>, which is
+called by <<fclose>>, may be NULL.  <[ops]> must stay valid while the
+stream is open.
+
+The stream holds <[size]> bytes from the start of block 0, and grows
+when it is written past its end; <[mode]> is treated as in <<fopen>>,
+so "w" starts it empty.  It keeps two blocks in memory.  When a read
+needs one that is not there, the next one is read with it, so a file
+read through in order costs one device call for every two blocks.
+Whole blocks that are not held are read straight into the caller's
+buffer instead, two at a time, so <[buf]> need not be one of the
+stream's; a driver that can only transfer to DMA memory must copy.  A
+block that was written goes back to the device once it is filled, when
+the stream needs its buffer for another block, and at <<fclose>>;
+<<fflush>> alone does not reach the device.
+
+The stream is made with <<fopencookie>>, and is buffered by stdio as
+any other.
+
+RETURNS
+The return value is an open FILE pointer on success.  On error,
+<<NULL>> is returned, and <<errno>> will be set to EINVAL if
+<[block_size]> is 0, a function is missing or <[mode]> is invalid,
+ENOMEM if the stream cannot be created, or EMFILE if too many streams
+are already open.
+
+PORTABILITY
+This function is a newlib extension.
+
+Supporting OS subroutines required: <<sbrk>>.
+*/
+
+#define _GNU_SOURCE
+#include <_ansi.h>
+#include <reent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include "local.h"
+
+#ifdef __LARGE64_FILES
+typedef _off64_t fb_off_t;
+#else
+typedef off_t fb_off_t;
+#endif
+
+#define FB_NONE ((unsigned long) -1)
+#define FB_BUF(b, i) ((b)->buf + (i) * (b)->bsize)
+
+struct fblock
+{
+  void *dev;
+  const struct fblock_ops *ops;
+  size_t bsize;
+  off_t pos;
+  off_t size;
+  unsigned long tag[2];		/* the block in each buffer, or FB_NONE */
+  unsigned char dirty[2];
+  unsigned char last;		/* the buffer used last */
+  unsigned char *buf;		/* the two buffers, one after the other */
+};
+
+static int
+fb_flush (struct fblock *b,
+       int i)
+{
+  if (b->dirty[i])
+    {
+      if (b->ops->write (b->dev, b->tag[i], FB_BUF (b, i)) < 0)
+	return -1;
+      b->dirty[i] = 0;
+    }
+  return 0;
+}
+
+/* Return the buffer holding block BLK, or NULL on a device error.
+   WHOLE means everything in it that is part of the stream is about to
+   be written, so it need not be read.  */
+static unsigned char *
+fb_get (struct fblock *b,
+       unsigned long blk,
+       int whole)
+{
+  unsigned long have = (b->size + b->bsize - 1) / b->bsize;
+  int i;
+
+  for (i = 0; i < 2; i++)
+    if (b->tag[i] == blk)
+      {
+	b->last = i;
+	return FB_BUF (b, i);
+      }
+
+  if (!whole && blk + 1 < have)
+    {
+      /* Read the next block with this one.  */
+      if (fb_flush (b, 0) < 0 || fb_flush (b, 1) < 0)
+	return NULL;
+      b->tag[0] = b->tag[1] = FB_NONE;
+      if (b->ops->read (b->dev, blk, b->buf, 2) < 0)
+	return NULL;
+      b->tag[0] = blk;
+      b->tag[1] = blk + 1;
+      b->last = 0;
+      return b->buf;
+    }
+
+  i = !b->last;
+  if (fb_flush (b, i) < 0)
+    return NULL;
+  b->tag[i] = FB_NONE;
+  if (!whole && blk < have)
+    {
+      if (b->ops->read (b->dev, blk, FB_BUF (b, i), 1) < 0)
+	return NULL;
+    }
+  else
+    memset (FB_BUF (b, i), 0, b->bsize);
+  b->tag[i] = blk;
+  b->last = i;
+  return FB_BUF (b, i);
+}
+
+#define FB_HELD(b, blk) ((b)->tag[0] == (blk) || (b)->tag[1] == (blk))
+
+static ssize_t
+fbreader (void *cookie,
+       char *buf,
+       size_t n)
+{
+  struct fblock *b = (struct fblock *) cookie;
+  unsigned char *p;
+  unsigned long blk;
+  size_t at, k, done = 0;
+
+  if (b->pos >= b->size)
+    return 0;
+  if ((off_t) n > b->size - b->pos)
+    n = b->size - b->pos;
+  while (done < n)
+    {
+      at = b->pos % b->bsize;
+      blk = b->pos / b->bsize;
+      if (at == 0 && n - done >= b->bsize && !FB_HELD (b, blk))
+	{
+	  /* No copy through the stream's buffers.  */
+	  k = n - done >= 2 * b->bsize && !FB_HELD (b, blk + 1) ? 2 : 1;
+	  if (b->ops->read (b->dev, blk, buf + done, k) < 0)
+	    return done ? (ssize_t) done : -1;
+	  k *= b->bsize;
+	}
+      else
+	{
+	  if ((p = fb_get (b, blk, 0)) == NULL)
+	    return done ? (ssize_t) done : -1;
+	  k = b->bsize - at;
+	  if (k > n - done)
+	    k = n - done;
+	  memcpy (buf + done, p + at, k);
+	}
+      done += k;
+      b->pos += k;
+    }
+  return done;
+}
+
+static ssize_t
+fbwriter (void *cookie,
+       const char *buf,
+       size_t n)
+{
+  struct fblock *b = (struct fblock *) cookie;
+  unsigned char *p;
+  size_t at, k, done = 0;
+
+  while (done < n)
+    {
+      at = b->pos % b->bsize;
+      k = b->bsize - at;
+      if (k > n - done)
+	k = n - done;
+      p = fb_get (b, b->pos / b->bsize,
+		  at == 0 && (k == b->bsize || b->pos + (off_t) k >= b->size));
+      if (p == NULL)
+	return done ? (ssize_t) done : -1;
+      memcpy (p + at, buf + done, k);
+      b->dirty[b->last] = 1;
+      done += k;
+      b->pos += k;
+      if (b->pos > b->size)
+	b->size = b->pos;
+      /* A full block goes back at once.  */
+      if (at + k == b->bsize && fb_flush (b, b->last) < 0)
+	return -1;
+    }
+  return done;
+}
+
+static int
+fbseeker (void *cookie,
+       fb_off_t *off,
+       int whence)
+{
+  struct fblock *b = (struct fblock *) cookie;
+  fb_off_t pos = *off;
+
+  if (whence == SEEK_CUR)
+    pos += b->pos;
+  else if (whence == SEEK_END)
+    pos += b->size;
+  else if (whence != SEEK_SET)
+    pos = -1;
+  if (pos < 0 || (off_t) pos != pos)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  *off = b->pos = pos;
+  return 0;
+}
+
+static int
+fbcloser (void *cookie)
+{
+  struct fblock *b = (struct fblock *) cookie;
+  int ret = 0;
+
+  if (fb_flush (b, 0) < 0 || fb_flush (b, 1) < 0)
+    ret = -1;
+  if (b->ops->close && b->ops->close (b->dev) < 0)
+    ret = -1;
+  _free_r (_REENT, b);
+  return ret;
+}
+
+FILE *
+_fblockopen_r (struct _reent *ptr,
+       void *dev,
+       const struct fblock_ops *ops,
+       size_t block_size,
+       off_t size,
+       const char *mode)
+{
+  cookie_io_functions_t fns;
+  struct fblock *b;
+  FILE *fp;
+
+  if (block_size == 0 || ops->read == NULL || size < 0)
+    {
+      ptr->_errno = EINVAL;
+      return NULL;
+    }
+  if (block_size > ((size_t) -1 - sizeof *b) / 2
+      || (b = (struct fblock *) _malloc_r (ptr, sizeof *b
+					   + 2 * block_size)) == NULL)
+    {
+      ptr->_errno = ENOMEM;
+      return NULL;
+    }
+  b->dev = dev;
+  b->ops = ops;
+  b->bsize = block_size;
+  b->pos = 0;
+  b->size = *mode == 'w' ? 0 : size;
+  b->tag[0] = b->tag[1] = FB_NONE;
+  b->dirty[0] = b->dirty[1] = 0;
+  b->last = 0;
+  b->buf = (unsigned char *) (b + 1);
+
+  fns.read = fbreader;
+  fns.write = ops->write ? fbwriter : NULL;
+  fns.seek = fbseeker;
+  fns.close = fbcloser;
+  if ((fp = _fopencookie_r (ptr, b, mode, fns)) == NULL)
+    _free_r (ptr, b);
+  return fp;
+}
+
+#ifndef _REENT_ONLY
+FILE *
+fblockopen (void *dev,
+       const struct fblock_ops *ops,
+       size_t block_size,
+       off_t size,
+       const char *mode)
+{
+  return _fblockopen_r (_REENT, dev, ops, block_size, size, mode);
+}
+#endif /* !_REENT_ONLY */
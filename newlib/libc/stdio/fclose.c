@@ -93,16 +93,18 @@ _fclose_r (struct _reent *rptr,
      byte processed as opposed to last byte read ahead into the buffer. */
   r = __sflush_r (rptr, fp);
 #endif
-  if (fp->_close != NULL && fp->_close (rptr, fp->_cookie) < 0)
+  if (_SOPS (fp)->_close != NULL
+      && _SOPS (fp)->_close (rptr, fp->_cookie) < 0)
     r = EOF;
   if (fp->_flags & __SMBF)
-    _free_r (rptr, (char *) fp->_bf._base);
+    __sfreebuf_r (rptr, (char *) fp->_bf._base);
   if (HASUB (fp))
     FREEUB (rptr, fp);
   if (HASLB (fp))
     FREELB (rptr, fp);
+  FREEUNGETC (rptr, fp);
   __sfp_lock_acquire ();
-  fp->_flags = 0;		/* release this FILE for reuse */
+  __sfp_free (fp);	/* release this FILE for reuse */
   if (!(fp->_flags2 & __SNLK))
     _funlockfile (fp);
 #ifndef __SINGLE_THREAD__
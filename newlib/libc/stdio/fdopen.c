@@ -100,10 +100,14 @@ _fdopen_r (struct _reent *ptr,
 #undef _seek
 #undef _close
 
+#ifdef _STDIO_COMPACT_FILE
+  fp->_ops = &__sstdops;
+#else
   fp->_read = __sread;
   fp->_write = __swrite;
   fp->_seek = __sseek;
   fp->_close = __sclose;
+#endif
 
 #ifdef __SCLE
   /* Explicit given mode results in explicit setting mode on fd */
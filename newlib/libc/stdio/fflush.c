@@ -58,6 +58,10 @@ descriptor, set the position of the file descriptor to match next
 unread byte, useful for obeying POSIX semantics when ending a process
 without consuming all input from the stream.
 
+If the file descriptor is non-blocking and cannot take all of the
+output, what it did not take stays buffered, and <<fflush>> fails with
+<<EAGAIN>>; a later <<fflush>> sends the rest.
+
 <<fflush_unlocked>> is a non-thread-safe version of <<fflush>>.
 <<fflush_unlocked>> may only safely be used within a scope
 protected by flockfile() (or ftrylockfile()) and funlockfile().  This
@@ -87,6 +91,7 @@ No supporting OS subroutines are required.
 #include <_ansi.h>
 #include <stdio.h>
 #include <errno.h>
+#include <string.h>
 #include "local.h"
 
 #ifdef __IMPL_UNLOCKED__
@@ -125,7 +130,8 @@ __sflush_r (struct _reent *ptr,
          this seek to be deferred until necessary, but we choose to do it here
          to make the change simpler, more contained, and less likely
          to miss a code scenario.  */
-      if ((fp->_r > 0 || fp->_ur > 0) && fp->_seek != NULL)
+      if ((fp->_r > 0 || (HASUB (fp) && _UR (fp) > 0))
+	  && _SOPS (fp)->_seek != NULL)
 	{
 	  int tmp_errno;
 #ifdef __LARGE64_FILES
@@ -151,7 +157,7 @@ __sflush_r (struct _reent *ptr,
 		curoff = fp->_seek64 (ptr, fp->_cookie, 0, SEEK_CUR);
 	      else
 #endif
-		curoff = fp->_seek (ptr, fp->_cookie, 0, SEEK_CUR);
+		curoff = _SOPS (fp)->_seek (ptr, fp->_cookie, 0, SEEK_CUR);
 	      if (curoff == -1L && ptr->_errno != 0)
 		{
 		  int result = EOF;
@@ -171,7 +177,7 @@ __sflush_r (struct _reent *ptr,
                  characters not yet read.  */
               curoff -= fp->_r;
               if (HASUB (fp))
-                curoff -= fp->_ur;
+                curoff -= _UR (fp);
             }
 	  /* Now physically seek to after byte last read.  */
 #ifdef __LARGE64_FILES
@@ -179,7 +185,7 @@ __sflush_r (struct _reent *ptr,
 	    curoff = fp->_seek64 (ptr, fp->_cookie, curoff, SEEK_SET);
 	  else
 #endif
-	    curoff = fp->_seek (ptr, fp->_cookie, curoff, SEEK_SET);
+	    curoff = _SOPS (fp)->_seek (ptr, fp->_cookie, curoff, SEEK_SET);
 	  if (curoff != -1 || ptr->_errno == 0
 	      || ptr->_errno == ESPIPE || ptr->_errno == EINVAL)
 	    {
@@ -219,11 +225,24 @@ __sflush_r (struct _reent *ptr,
   fp->_p = p;
   fp->_w = flags & (__SLBF | __SNBF) ? 0 : fp->_bf._size;
 
+  if (n > 0)
+    _STDIO_COUNT (fp, _flushes, 1);
   while (n > 0)
     {
-      t = fp->_write (ptr, fp->_cookie, (char *) p, n);
+      t = _SOPS (fp)->_write (ptr, fp->_cookie, (char *) p, n);
+      _STDIO_COUNT_IO (fp, _writes, _write_bytes, t);
       if (t <= 0)
 	{
+	  /* A non-blocking descriptor that cannot take any more keeps
+	     the rest in the buffer for the next flush.  */
+	  if (t < 0 && ptr->_errno == EAGAIN)
+	    {
+	      if (p > fp->_p)
+		memmove (fp->_p, p, n);
+	      fp->_p += n;
+	      if ((flags & (__SLBF | __SNBF)) == 0)
+		fp->_w -= n;
+	    }
           fp->_flags |= __SERR;
           return EOF;
 	}
@@ -286,7 +305,7 @@ int
 fflush (register FILE * fp)
 {
   if (fp == NULL)
-    return _fwalk_reent (_GLOBAL_REENT, _fflush_r);
+    return _fwalk_writers (_GLOBAL_REENT, _fflush_r);
 
   return _fflush_r (_REENT, fp);
 }
@@ -35,7 +35,103 @@ const struct __sFILE_fake __sf_fake_stderr =
     {_NULL, 0, 0, 0, 0, {_NULL, 0}, 0, _NULL};
 #endif
 
-#ifdef _REENT_GLOBAL_STDIO_STREAMS
+#if defined(_REENT_SMALL) && defined(_STDIO_STATIC_FILES)
+/* Every FILE, the standard streams of each reent included, comes from
+   this table.  Bit N of __sfstatic_free is set while __sfstatic[N] is
+   free, so __sfp finds a slot without walking the table and never
+   calls __sfmoreglue.  Both are guarded by the sfp lock.  */
+#if FOPEN_MAX > 32
+#error "FOPEN_MAX is too large for the static FILE table"
+#endif
+static FILE __sfstatic[FOPEN_MAX];
+static unsigned long __sfstatic_free =
+  (unsigned long) (((unsigned long long) 1 << FOPEN_MAX) - 1);
+#ifdef _REENT_STATIC_STD_STREAMS
+/* __sinit does not run to hang the table off the global reent, whose
+   glue holds the standard streams, so __sfp does.  */
+static struct _glue __sfstatic_glue = { NULL, FOPEN_MAX, &__sfstatic[0] };
+#endif
+#endif
+
+#if defined(_STDIO_COMPACT_FILE) && !defined(_STDIO_CLOSE_PER_REENT_STD_STREAMS)
+/* The standard streams are not closed, see std below.  */
+static const struct __sFILE_ops std_ops =
+  { __sread, __swrite, __sseek, NULL };
+#endif
+
+/* On platforms that have true file system I/O, we can verify whether
+   stdout is an interactive terminal or not, as part of __smakebuf on
+   first use of the stream.  For all other platforms, we will default
+   to line buffered mode here.  Technically, POSIX requires both stdin
+   and stdout to be line-buffered, but tradition leaves stdin alone on
+   systems without fcntl.  */
+#ifdef HAVE_FCNTL
+#define STDOUT_FLAGS __SWR
+#else
+#define STDOUT_FLAGS (__SWR | __SLBF)
+#endif
+
+/* POSIX requires stderr to be opened for reading and writing, even
+   when the underlying fd 2 is write-only.  */
+#define STDERR_FLAGS (__SRW | __SNBF)
+
+#ifdef _REENT_STATIC_STD_STREAMS
+/* The standard streams as std () below sets them up, so that they are
+   in .data and __sinit never has to run for them.  The other fields
+   start out as zero, as std () leaves them.  */
+#ifdef __SCLE
+#error "the text mode of the standard streams is only known at run time"
+#endif
+
+#ifdef _STDIO_COMPACT_FILE
+#ifdef _STDIO_CLOSE_PER_REENT_STD_STREAMS
+#define STD_OPS ._ops = &__sstdops
+#else
+#define STD_OPS ._ops = &std_ops
+#endif
+#else /* !_STDIO_COMPACT_FILE */
+#ifdef _STDIO_CLOSE_PER_REENT_STD_STREAMS
+#define STD_CLOSE __sclose
+#else
+#define STD_CLOSE NULL
+#endif
+#ifndef __LARGE64_FILES
+#define STD_OPS ._read = __sread, ._write = __swrite, ._seek = __sseek, \
+  ._close = STD_CLOSE
+#else
+#define STD_OPS ._read = __sread, ._write = __swrite64, ._seek = __sseek, \
+  ._close = STD_CLOSE, ._seek64 = __sseek64
+#endif
+#endif /* !_STDIO_COMPACT_FILE */
+
+#ifdef __LARGE64_FILES
+#define STD_L64 __SL64
+#else
+#define STD_L64 0
+#endif
+
+/* A lock of its own for each stream, as __lock_init_recursive would
+   give it, but not allocated.  The port provides them with the other
+   static locks.  */
+#if !defined(__SINGLE_THREAD__) && defined(_RETARGETABLE_LOCKING)
+extern struct __lock __lock___sf_stdin_recursive_mutex;
+extern struct __lock __lock___sf_stdout_recursive_mutex;
+extern struct __lock __lock___sf_stderr_recursive_mutex;
+#define STD_LOCK(lock) , ._lock = &lock
+#else
+#define STD_LOCK(lock)
+#endif
+
+#define STD_FILE(flags, file, lock) \
+  { ._flags = (flags) | STD_L64, ._file = (file), \
+    ._cookie = &__sf[file], STD_OPS STD_LOCK (lock) }
+
+__FILE __sf[3] = {
+  STD_FILE (__SRD, 0, __lock___sf_stdin_recursive_mutex),
+  STD_FILE (STDOUT_FLAGS, 1, __lock___sf_stdout_recursive_mutex),
+  STD_FILE (STDERR_FLAGS, 2, __lock___sf_stderr_recursive_mutex)
+};
+#elif defined(_REENT_GLOBAL_STDIO_STREAMS)
 __FILE __sf[3];
 #endif
 
@@ -58,7 +154,17 @@ std (FILE *ptr,
   ptr->_bf._size = 0;
   ptr->_lbfsize = 0;
   memset (&ptr->_mbstate, 0, sizeof (_mbstate_t));
+#ifdef _STDIO_STATS
+  memset (&ptr->_stats, 0, sizeof (ptr->_stats));
+#endif
   ptr->_cookie = ptr;
+#ifdef _STDIO_COMPACT_FILE
+#ifdef _STDIO_CLOSE_PER_REENT_STD_STREAMS
+  ptr->_ops = &__sstdops;
+#else
+  ptr->_ops = &std_ops;
+#endif
+#else
   ptr->_read = __sread;
 #ifndef __LARGE64_FILES
   ptr->_write = __swrite;
@@ -73,6 +179,7 @@ std (FILE *ptr,
 #else /* _STDIO_CLOSE_STD_STREAMS */
   ptr->_close = NULL;
 #endif /* _STDIO_CLOSE_STD_STREAMS */
+#endif /* _STDIO_COMPACT_FILE */
 #if !defined(__SINGLE_THREAD__) && !(defined(_REENT_SMALL) && !defined(_REENT_GLOBAL_STDIO_STREAMS))
   __lock_init_recursive (ptr->_lock);
   /*
@@ -96,25 +203,13 @@ stdin_init(FILE *ptr)
 static inline void
 stdout_init(FILE *ptr)
 {
-  /* On platforms that have true file system I/O, we can verify
-     whether stdout is an interactive terminal or not, as part of
-     __smakebuf on first use of the stream.  For all other platforms,
-     we will default to line buffered mode here.  Technically, POSIX
-     requires both stdin and stdout to be line-buffered, but tradition
-     leaves stdin alone on systems without fcntl.  */
-#ifdef HAVE_FCNTL
-  std (ptr, __SWR, 1);
-#else
-  std (ptr, __SWR | __SLBF, 1);
-#endif
+  std (ptr, STDOUT_FLAGS, 1);
 }
 
 static inline void
 stderr_init(FILE *ptr)
 {
-  /* POSIX requires stderr to be opened for reading and writing, even
-     when the underlying fd 2 is write-only.  */
-  std (ptr, __SRW | __SNBF, 2);
+  std (ptr, STDERR_FLAGS, 2);
 }
 
 struct glue_with_file {
@@ -148,12 +243,26 @@ __sfp (struct _reent *d)
 {
   FILE *fp;
   int n;
+#if !(defined(_REENT_SMALL) && defined(_STDIO_STATIC_FILES))
   struct _glue *g;
+#endif
 
   _newlib_sfp_lock_start ();
 
   if (!_GLOBAL_REENT->__sdidinit)
     __sinit (_GLOBAL_REENT);
+#if defined(_REENT_SMALL) && defined(_STDIO_STATIC_FILES)
+#ifdef _REENT_STATIC_STD_STREAMS
+  _GLOBAL_REENT->__sglue._next = &__sfstatic_glue;
+#endif
+  if (__sfstatic_free != 0)
+    {
+      n = __builtin_ffsl (__sfstatic_free) - 1;
+      __sfstatic_free &= ~(1UL << n);
+      fp = &__sfstatic[n];
+      goto found;
+    }
+#else
   for (g = &_GLOBAL_REENT->__sglue;; g = g->_next)
     {
       for (fp = g->_iobs, n = g->_niobs; --n >= 0; fp++)
@@ -163,6 +272,7 @@ __sfp (struct _reent *d)
 	  (g->_next = __sfmoreglue (d, NDYNAMIC)) == NULL)
 	break;
     }
+#endif
   _newlib_sfp_lock_exit ();
   d->_errno = ENOMEM;
   return NULL;
@@ -183,15 +293,89 @@ found:
   fp->_bf._size = 0;
   fp->_lbfsize = 0;		/* not line buffered */
   memset (&fp->_mbstate, 0, sizeof (_mbstate_t));
+#ifdef _STDIO_STATS
+  memset (&fp->_stats, 0, sizeof (fp->_stats));
+#endif
   /* fp->_cookie = <any>; */	/* caller sets cookie, _read/_write etc */
-  fp->_ub._base = NULL;		/* no ungetc buffer */
-  fp->_ub._size = 0;
-  fp->_lb._base = NULL;		/* no line buffer */
-  fp->_lb._size = 0;
+  CLEARUB (fp);			/* no ungetc buffer */
+  CLEARLB (fp);			/* no line buffer */
 
   return fp;
 }
 
+#if defined(_REENT_SMALL) && defined(_STDIO_STATIC_FILES)
+/*
+ * Give a FILE from __sfp back.  Called with the sfp lock held.
+ */
+
+void
+__sfp_free (FILE *fp)
+{
+  fp->_flags = 0;
+  if (fp >= __sfstatic && fp < &__sfstatic[FOPEN_MAX])
+    __sfstatic_free |= 1UL << (fp - __sfstatic);
+}
+#endif
+
+#ifdef _STDIO_STATS
+/* The counters of all streams together, see __fstats.  */
+struct __sFILE_stats __sstats;
+#endif
+
+#ifdef _STDIO_WRITERS
+/* The streams that have been set up for writing, so that refill,
+   fflush (NULL) and a flushing exit need not walk every FILE.  A slot
+   whose stream no longer writes is free again.  Once a writer finds
+   none, every walk goes back to _fwalk_reent for good.  Like the glue,
+   the table is read without the lock.  */
+static FILE *__swriters[_STDIO_WRITERS];
+static char __swriters_lost;
+
+void
+__swriter_add (FILE *fp)
+{
+  int i, slot = -1;
+
+  /* Neither string streams, which may be on the stack, nor cookie
+     streams, which _fwalk_reent skips too.  */
+  if ((fp->_flags & __SSTR) || fp->_file == -1)
+    return;
+  __sfp_lock_acquire ();
+  for (i = 0; i < _STDIO_WRITERS; i++)
+    {
+      if (__swriters[i] == fp)
+	{
+	  slot = i;
+	  break;
+	}
+      if (slot < 0
+	  && (__swriters[i] == NULL || !(__swriters[i]->_flags & __SWR)))
+	slot = i;
+    }
+  if (slot >= 0)
+    __swriters[slot] = fp;
+  else
+    __swriters_lost = 1;
+  __sfp_lock_release ();
+}
+
+int
+_fwalk_writers (struct _reent *ptr,
+       int (*reent_function) (struct _reent *, FILE *))
+{
+  FILE *fp;
+  int i, ret = 0;
+
+  if (__swriters_lost)
+    return _fwalk_reent (ptr, reent_function);
+  for (i = 0; i < _STDIO_WRITERS; i++)
+    if ((fp = __swriters[i]) != NULL && (fp->_flags & __SWR)
+	&& fp->_file != -1)
+      ret |= (*reent_function) (ptr, fp);
+  return ret;
+}
+#endif /* _STDIO_WRITERS */
+
 /*
  * exit() calls _cleanup() through *__cleanup, set whenever we
  * open or buffer a file.  This chicanery is done so that programs
@@ -225,6 +409,14 @@ _cleanup_r (struct _reent *ptr)
     (*cleanup_func) (ptr, ptr->_stdout);
   if (ptr->_stderr != &__sf[2])
     (*cleanup_func) (ptr, ptr->_stderr);
+#endif
+#if defined (_STDIO_BSD_SEMANTICS) || defined (_LITE_EXIT)
+  /* Only writers have anything to do.  */
+  if (ptr == _GLOBAL_REENT)
+    {
+      (void) _fwalk_writers (ptr, cleanup_func);
+      return;
+    }
 #endif
   (void) _fwalk_reent (ptr, cleanup_func);
 }
@@ -262,8 +454,20 @@ __sinit (struct _reent *s)
   s->__sglue._iobs = &s->__sf[0];
 # endif /* _REENT_GLOBAL_STDIO_STREAMS */
 #else
-  s->__sglue._niobs = 0;
-  s->__sglue._iobs = NULL;
+# ifdef _STDIO_STATIC_FILES
+  /* The table is walked through the global reent only, as the other
+     reents own no glue of their own.  */
+  if (s == _GLOBAL_REENT)
+    {
+      s->__sglue._niobs = FOPEN_MAX;
+      s->__sglue._iobs = &__sfstatic[0];
+    }
+  else
+# endif
+    {
+      s->__sglue._niobs = 0;
+      s->__sglue._iobs = NULL;
+    }
   /* Avoid infinite recursion when calling __sfp  for _GLOBAL_REENT.  The
      problem is that __sfp checks for _GLOBAL_REENT->__sdidinit and calls
      __sinit if it's 0. */
@@ -260,6 +260,11 @@ fmemcloser (struct _reent *ptr,
   return 0;
 }
 
+#ifdef _STDIO_COMPACT_FILE
+static const struct __sFILE_ops fmem_ops =
+  { fmemreader, fmemwriter, fmemseeker, fmemcloser };
+#endif
+
 /* Open a memstream around buffer BUF of SIZE bytes, using MODE.
    Return the new stream, or fail with NULL.  */
 FILE *
@@ -286,7 +291,7 @@ _fmemopen_r (struct _reent *ptr,
       == NULL)
     {
       _newlib_sfp_lock_start ();
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);	/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -341,6 +346,9 @@ _fmemopen_r (struct _reent *ptr,
   fp->_file = -1;
   fp->_flags = flags;
   fp->_cookie = c;
+#ifdef _STDIO_COMPACT_FILE
+  fp->_ops = &fmem_ops;
+#else
   fp->_read = flags & (__SRD | __SRW) ? fmemreader : NULL;
   fp->_write = flags & (__SWR | __SRW) ? fmemwriter : NULL;
   fp->_seek = fmemseeker;
@@ -349,6 +357,7 @@ _fmemopen_r (struct _reent *ptr,
   fp->_flags |= __SL64;
 #endif
   fp->_close = fmemcloser;
+#endif
   _newlib_flockfile_end (fp);
   return fp;
 }
@@ -0,0 +1,231 @@
+/*
+FUNCTION
+<<fmemopen_ring>>---open a stream that overwrites its oldest data
+
+INDEX
+	fmemopen_ring
+INDEX
+	_fmemopen_ring_r
+INDEX
+	fmemring_read
+INDEX
+	fmemring_tell
+
+SYNOPSIS
+	#include <stdio.h>
+	FILE *fmemopen_ring(void *<[buf]>, size_t <[size]>);
+	FILE *_fmemopen_ring_r(struct _reent *<[reent]>, void *<[buf]>,
+			       size_t <[size]>);
+	size_t fmemring_read(const void *<[buf]>,
+			     unsigned long *<[cursor]>, void *<[out]>,
+			     size_t <[n]>);
+	unsigned long fmemring_tell(const void *<[buf]>);
+
+DESCRIPTION
+<<fmemopen_ring>> creates a write-only <<FILE>> stream over the
+<[size]> bytes at <[buf]>, which must be aligned as for a <<long>>.
+The first few words of <[buf]> hold the state of the ring and the rest
+holds the data.  Once the data is full, each byte written replaces the
+oldest one, so the stream never fails for lack of room, and nothing
+is allocated beyond the <<FILE>> itself.  The stream is unbuffered, so
+every byte is in <[buf]> as soon as the call that writes it returns;
+<<setvbuf>> may give it a buffer, which then has to be flushed before
+the data is read.  It cannot seek.
+
+If <[buf]> already holds a consistent ring of the same size, as when it
+is in memory kept across a reset, the stream goes on after its data;
+otherwise the ring starts empty.  A reset during a write may leave the
+ring inconsistent, and the data is then lost.
+
+<<fmemring_read>> copies up to <[n]> bytes of the ring at <[buf]>, open
+or not, to <[out]>, starting at <[cursor]>.  The cursor counts the bytes
+ever written to the ring: start from 0 to read everything still held.
+If the data at <[cursor]> has already been overwritten, the read starts
+at the oldest byte held.  <[cursor]> is advanced past the bytes copied.
+<<fmemring_tell>> returns the cursor of the next byte to be written, so
+<<fmemring_tell>> less a cursor that was read up to then is the number
+of bytes written since.  Neither may run while the stream is written.
+
+RETURNS
+<<fmemopen_ring>> returns an open FILE pointer on success.  On error,
+<<NULL>> is returned, and <<errno>> will be set to EINVAL if <[size]>
+leaves no room for data, or EMFILE if too many streams are already
+open.
+
+<<fmemring_read>> returns the number of bytes copied, 0 once the reader
+has caught up or if <[buf]> holds no ring.  <<fmemring_tell>> returns 0
+if <[buf]> holds no ring.
+
+PORTABILITY
+<<fmemopen_ring>>, <<fmemring_read>> and <<fmemring_tell>> are newlib
+extensions.
+
+Supporting OS subroutines required: <<sbrk>>.
+*/
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/lock.h>
+#include "local.h"
+
+#define RING_MAGIC 0x52494e47UL	/* "RING" */
+
+/* The state at the start of BUF, then the data.  CHECK tells a ring
+   left by an earlier run from whatever the memory held.  */
+struct memring {
+  unsigned long check; /* ring_check of the rest */
+  unsigned long total; /* bytes ever written */
+  size_t cap; /* bytes of data */
+  size_t head; /* where the next byte goes */
+  size_t len; /* bytes of data held */
+};
+
+#define RING_DATA(r)	((char *) ((r) + 1))
+
+static unsigned long
+ring_check (const struct memring *r)
+{
+  return RING_MAGIC ^ r->total ^ r->cap ^ ((unsigned long) r->head << 8)
+	 ^ ((unsigned long) r->len << 16);
+}
+
+static int
+ring_valid (const struct memring *r)
+{
+  return r->check == ring_check (r) && r->cap != 0 && r->head < r->cap
+	 && r->len <= r->cap;
+}
+
+/* Write N bytes of BUF into the ring described by COOKIE, dropping the
+   oldest data as needed; return N.  */
+static _READ_WRITE_RETURN_TYPE
+ringwriter (struct _reent *ptr,
+       void *cookie,
+       const char *buf,
+       _READ_WRITE_BUFSIZE_TYPE n)
+{
+  struct memring *r = (struct memring *) cookie;
+  size_t left = n, chunk;
+
+  /* Only the last CAP bytes survive.  */
+  if (left > r->cap)
+    {
+      buf += left - r->cap;
+      r->head = (r->head + (left - r->cap)) % r->cap;
+      left = r->cap;
+    }
+  while (left > 0)
+    {
+      chunk = r->cap - r->head;
+      if (chunk > left)
+	chunk = left;
+      memcpy (RING_DATA (r) + r->head, buf, chunk);
+      buf += chunk;
+      left -= chunk;
+      r->head += chunk;
+      if (r->head == r->cap)
+	r->head = 0;
+      r->len = r->len + chunk > r->cap ? r->cap : r->len + chunk;
+    }
+  r->total += (unsigned long) n;
+  r->check = ring_check (r);
+  return n;
+}
+
+#ifdef _STDIO_COMPACT_FILE
+static const struct __sFILE_ops ring_ops =
+  { NULL, ringwriter, NULL, NULL };
+#endif
+
+FILE *
+_fmemopen_ring_r (struct _reent *ptr,
+       void *buf,
+       size_t size)
+{
+  struct memring *r = (struct memring *) buf;
+  FILE *fp;
+
+  if (buf == NULL || size <= sizeof *r)
+    {
+      ptr->_errno = EINVAL;
+      return NULL;
+    }
+  if ((fp = __sfp (ptr)) == NULL)
+    return NULL;
+
+  if (!ring_valid (r) || r->cap != size - sizeof *r)
+    {
+      r->total = 0;
+      r->cap = size - sizeof *r;
+      r->head = r->len = 0;
+      r->check = ring_check (r);
+    }
+
+  _newlib_flockfile_start (fp);
+  fp->_file = -1;
+  fp->_flags = __SWR | __SNBF;
+  fp->_cookie = r;
+#ifdef _STDIO_COMPACT_FILE
+  fp->_ops = &ring_ops;
+#else
+  fp->_read = NULL;
+  fp->_write = ringwriter;
+  fp->_seek = NULL;
+  fp->_close = NULL;
+#endif
+  _newlib_flockfile_end (fp);
+  return fp;
+}
+
+size_t
+fmemring_read (const void *buf,
+       unsigned long *cursor,
+       void *out,
+       size_t n)
+{
+  const struct memring *r = (const struct memring *) buf;
+  unsigned long behind;
+  size_t start, chunk, done = 0;
+
+  if (!ring_valid (r))
+    return 0;
+  /* Unsigned, so that a cursor from before TOTAL wrapped still works.  */
+  behind = r->total - *cursor;
+  if (behind > r->len)
+    behind = r->len;
+  if (n > behind)
+    n = behind;
+  /* The byte at the cursor is BEHIND bytes before HEAD.  */
+  start = (r->head + r->cap - (size_t) behind) % r->cap;
+  while (done < n)
+    {
+      chunk = r->cap - start;
+      if (chunk > n - done)
+	chunk = n - done;
+      memcpy ((char *) out + done, RING_DATA (r) + start, chunk);
+      done += chunk;
+      start = 0;
+    }
+  *cursor = r->total - behind + done;
+  return done;
+}
+
+unsigned long
+fmemring_tell (const void *buf)
+{
+  const struct memring *r = (const struct memring *) buf;
+
+  return ring_valid (r) ? r->total : 0;
+}
+
+#ifndef _REENT_ONLY
+FILE *
+fmemopen_ring (void *buf,
+       size_t size)
+{
+  return _fmemopen_ring_r (_REENT, buf, size);
+}
+#endif /* !_REENT_ONLY */
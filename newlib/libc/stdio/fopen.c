@@ -129,7 +129,7 @@ _fopen_r (struct _reent *ptr,
   if ((f = _open_r (ptr, file, oflags, 0666)) < 0)
     {
       _newlib_sfp_lock_start (); 
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);	/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -142,10 +142,14 @@ _fopen_r (struct _reent *ptr,
   fp->_file = f;
   fp->_flags = flags;
   fp->_cookie = (void *) fp;
+#ifdef _STDIO_COMPACT_FILE
+  fp->_ops = &__sstdops;
+#else
   fp->_read = __sread;
   fp->_write = __swrite;
   fp->_seek = __sseek;
   fp->_close = __sclose;
+#endif
 
   if (fp->_flags & __SAPP)
     _fseek_r (ptr, fp, 0, SEEK_END);
@@ -119,12 +119,12 @@ fcwriter (struct _reent *ptr,
 {
   int result;
   fccookie *c = (fccookie *) cookie;
-  if (c->fp->_flags & __SAPP && c->fp->_seek)
+  if (c->fp->_flags & __SAPP && _SOPS (c->fp)->_seek)
     {
 #ifdef __LARGE64_FILES
       c->fp->_seek64 (ptr, cookie, 0, SEEK_END);
 #else
-      c->fp->_seek (ptr, cookie, 0, SEEK_END);
+      _SOPS (c->fp)->_seek (ptr, cookie, 0, SEEK_END);
 #endif
     }
   errno = 0;
@@ -191,6 +191,13 @@ fccloser (struct _reent *ptr,
   return result;
 }
 
+#ifdef _STDIO_COMPACT_FILE
+static const struct __sFILE_ops fc_ops =
+  { fcreader, fcwriter, fcseeker, fccloser };
+static const struct __sFILE_ops fc_noseek_ops =
+  { fcreader, fcwriter, NULL, fccloser };
+#endif
+
 FILE *
 _fopencookie_r (struct _reent *ptr,
        void *cookie,
@@ -215,7 +222,7 @@ _fopencookie_r (struct _reent *ptr,
   if ((c = (fccookie *) _malloc_r (ptr, sizeof *c)) == NULL)
     {
       _newlib_sfp_lock_start ();
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);	/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -230,17 +237,21 @@ _fopencookie_r (struct _reent *ptr,
   c->fp = fp;
   fp->_cookie = c;
   c->readfn = functions.read;
-  fp->_read = fcreader;
   c->writefn = functions.write;
-  fp->_write = fcwriter;
   c->seekfn = functions.seek;
+  c->closefn = functions.close;
+#ifdef _STDIO_COMPACT_FILE
+  fp->_ops = functions.seek ? &fc_ops : &fc_noseek_ops;
+#else
+  fp->_read = fcreader;
+  fp->_write = fcwriter;
   fp->_seek = functions.seek ? fcseeker : NULL;
 #ifdef __LARGE64_FILES
   fp->_seek64 = functions.seek ? fcseeker64 : NULL;
   fp->_flags |= __SL64;
 #endif
-  c->closefn = functions.close;
   fp->_close = fccloser;
+#endif
   _newlib_flockfile_end (fp);
   return fp;
 }
@@ -0,0 +1,97 @@
+/*
+FUNCTION
+<<__fpeek>>, <<__fconsume>>---read a stream in place
+
+INDEX
+	__fpeek
+INDEX
+	_fpeek_r
+INDEX
+	__fconsume
+
+SYNOPSIS
+	#include <stdio.h>
+	#include <stdio_ext.h>
+	const char *__fpeek(FILE *<[fp]>, size_t *<[len]>);
+	void __fconsume(FILE *<[fp]>, size_t <[n]>);
+
+	const char *_fpeek_r(struct _reent *<[reent]>, FILE *<[fp]>,
+			     size_t *<[len]>);
+
+DESCRIPTION
+<<__fpeek>> returns a pointer to the bytes of <[fp]> that have been
+read into its buffer but not yet taken from it, and stores how many
+there are in *<[len]>.  When there are none, it refills the buffer
+first, as <<getc>> would.  The bytes stay in the stream: a parser can
+scan them in place, then take the ones it used with <<__fconsume>>,
+which skips <[n]> of them.  <[n]> must be no more than the *<[len]>
+of the last <<__fpeek>>; a larger value only skips those.
+
+The pointer is valid until the next operation on <[fp]> other than
+<<__fconsume>>.  Bytes pushed back with <<ungetc>> are peeked first and
+on their own.
+
+The alternate function <<_fpeek_r>> is a reentrant version, where the
+extra argument <[reent]> is a pointer to a reentrancy structure.
+
+RETURNS
+<<__fpeek>> returns NULL, with *<[len]> set to 0, at end of file or on
+a read error, which are told apart with <<feof>> and <<ferror>>.
+
+PORTABILITY
+These functions are newlib extensions.
+
+Supporting OS subroutines required: <<read>>.
+*/
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdio.h>
+#include <stdio_ext.h>
+#include "local.h"
+
+const char *
+_fpeek_r (struct _reent *ptr,
+       FILE *fp,
+       size_t *len)
+{
+  const char *p = NULL;
+
+  CHECK_INIT (ptr, fp);
+  _newlib_flockfile_start (fp);
+  ORIENT (fp, -1);
+  *len = 0;
+  if (fp->_r > 0 || __srefill_r (ptr, fp) == 0)
+    {
+      p = (const char *) fp->_p;
+      *len = fp->_r;
+    }
+  _newlib_flockfile_end (fp);
+  return p;
+}
+
+#ifndef _REENT_ONLY
+
+const char *
+__fpeek (FILE *fp,
+       size_t *len)
+{
+  return _fpeek_r (_REENT, fp, len);
+}
+
+#endif /* !_REENT_ONLY */
+
+void
+__fconsume (FILE *fp,
+       size_t n)
+{
+  _newlib_flockfile_start (fp);
+  if (fp->_r > 0)
+    {
+      if (n > (size_t) fp->_r)
+	n = fp->_r;
+      fp->_p += n;
+      fp->_r -= n;
+    }
+  _newlib_flockfile_end (fp);
+}
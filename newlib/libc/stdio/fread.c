@@ -83,9 +83,21 @@ Supporting OS subroutines required: <<close>>, <<fstat>>, <<isatty>>,
 #include <_ansi.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 #include <malloc.h>
 #include "local.h"
 
+/* Read straight into the caller's buffer on unbuffered streams, and
+   with _FREAD_DIRECT also when what is left of the request would fill
+   the stream's buffer, so that _read can hand it all to one transfer.
+   _FREAD_DIRECT works on size-optimized builds too.  */
+#ifdef _FREAD_DIRECT
+#define FREAD_DIRECT(fp, n) \
+  (((fp)->_flags & __SNBF) || (n) >= (size_t) (fp)->_r + (fp)->_bf._size)
+#elif !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+#define FREAD_DIRECT(fp, n) ((fp)->_flags & __SNBF)
+#endif
+
 #ifdef __IMPL_UNLOCKED__
 #define _fread_r _fread_unlocked_r
 #define fread fread_unlocked
@@ -164,10 +176,16 @@ _fread_r (struct _reent * ptr,
   total = resid;
   p = buf;
 
-#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+#ifdef FREAD_DIRECT
+
+#ifdef _FREAD_DIRECT
+  /* Give the stream its buffer first, so its size is known.  */
+  if (fp->_bf._base == NULL)
+    __smakebuf_r (ptr, fp);
+#endif
 
-  /* Optimize unbuffered I/O.  */
-  if (fp->_flags & __SNBF)
+  /* Optimize unbuffered I/O and large reads.  */
+  if (FREAD_DIRECT (fp, resid))
     {
       /* First copy any available characters from ungetc buffer.  */
       int copy_size = resid > fp->_r ? fp->_r : resid;
@@ -191,7 +209,7 @@ _fread_r (struct _reent * ptr,
 	  int old_size = fp->_bf._size;
 	  /* allow __refill to use user's buffer */
 	  fp->_bf._base = (unsigned char *) p;
-	  fp->_bf._size = resid;
+	  fp->_bf._size = resid > INT_MAX ? INT_MAX : resid;
 	  fp->_p = (unsigned char *) p;
 	  rc = __srefill_r (ptr, fp);
 	  /* restore fp buffering back to original state */
@@ -216,7 +234,7 @@ _fread_r (struct _reent * ptr,
 	}
     }
   else
-#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
+#endif /* FREAD_DIRECT */
     {
       while (resid > (r = fp->_r))
 	{
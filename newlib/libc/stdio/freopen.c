@@ -125,8 +125,8 @@ _freopen_r (struct _reent *ptr,
        * If close is NULL, closing is a no-op, hence pointless.
        * If file is NULL, the file should not be closed.
        */
-      if (fp->_close != NULL && file != NULL)
-	fp->_close (ptr, fp->_cookie);
+      if (_SOPS (fp)->_close != NULL && file != NULL)
+	_SOPS (fp)->_close (ptr, fp->_cookie);
     }
 
   /*
@@ -171,8 +171,8 @@ _freopen_r (struct _reent *ptr,
       if (f < 0)
 	{
 	  e = EBADF;
-	  if (fp->_close != NULL)
-	    fp->_close (ptr, fp->_cookie);
+	  if (_SOPS (fp)->_close != NULL)
+	    _SOPS (fp)->_close (ptr, fp->_cookie);
 	}
     }
 
@@ -184,7 +184,7 @@ _freopen_r (struct _reent *ptr,
    */
 
   if (fp->_flags & __SMBF)
-    _free_r (ptr, (char *) fp->_bf._base);
+    __sfreebuf_r (ptr, (char *) fp->_bf._base);
   fp->_w = 0;
   fp->_r = 0;
   fp->_p = NULL;
@@ -193,10 +193,10 @@ _freopen_r (struct _reent *ptr,
   fp->_lbfsize = 0;
   if (HASUB (fp))
     FREEUB (ptr, fp);
-  fp->_ub._size = 0;
+  FREEUNGETC (ptr, fp);
   if (HASLB (fp))
     FREELB (ptr, fp);
-  fp->_lb._size = 0;
+  CLEARLB (fp);
   fp->_flags &= ~__SORD;
   fp->_flags2 &= ~__SWID;
   memset (&fp->_mbstate, 0, sizeof (_mbstate_t));
@@ -204,7 +204,7 @@ _freopen_r (struct _reent *ptr,
   if (f < 0)
     {				/* did not get it after all */
       __sfp_lock_acquire ();
-      fp->_flags = 0;		/* set it free */
+      __sfp_free (fp);	/* set it free */
       ptr->_errno = e;		/* restore in case _close clobbered */
       if (!(oflags2 & __SNLK))
 	_funlockfile (fp);
@@ -221,10 +221,14 @@ _freopen_r (struct _reent *ptr,
   fp->_flags = flags;
   fp->_file = f;
   fp->_cookie = (void *) fp;
+#ifdef _STDIO_COMPACT_FILE
+  fp->_ops = &__sstdops;
+#else
   fp->_read = __sread;
   fp->_write = __swrite;
   fp->_seek = __sseek;
   fp->_close = __sclose;
+#endif
 
 #ifdef __SCLE
   if (__stextmode (fp->_file))
@@ -126,7 +126,7 @@ _fseeko_r (struct _reent *ptr,
 
   /* Have to be able to seek.  */
 
-  if ((seekfn = fp->_seek) == NULL)
+  if ((seekfn = _SOPS (fp)->_seek) == NULL)
     {
       ptr->_errno = ESPIPE;	/* ??? */
       _newlib_flockfile_exit (fp);
@@ -162,7 +162,7 @@ _fseeko_r (struct _reent *ptr,
 	{
 	  curoff -= fp->_r;
 	  if (HASUB (fp))
-	    curoff -= fp->_ur;
+	    curoff -= _UR (fp);
 	}
       else if (fp->_flags & __SWR && fp->_p != NULL)
 	curoff += fp->_p - fp->_bf._base;
@@ -250,7 +250,7 @@ _fseeko_r (struct _reent *ptr,
 	}
       curoff -= fp->_r;
       if (HASUB (fp))
-	curoff -= fp->_ur;
+	curoff -= _UR (fp);
     }
 
   /*
@@ -263,9 +263,9 @@ _fseeko_r (struct _reent *ptr,
   if (HASUB (fp))
     {
       curoff += fp->_r;       /* kill off ungetc */
-      n = fp->_up - fp->_bf._base;
+      n = _UP (fp) - fp->_bf._base;
       curoff -= n;
-      n += fp->_ur;
+      n += _UR (fp);
     }
   else
     {
@@ -0,0 +1,72 @@
+/*
+FUNCTION
+<<__fstats>>---count the I/O of a stream
+
+INDEX
+	__fstats
+
+SYNOPSIS
+	#include <stdio.h>
+	#include <stdio_ext.h>
+	const struct __sFILE_stats *__fstats(FILE *<[fp]>);
+
+DESCRIPTION
+In a newlib configured with <<--enable-newlib-stdio-stats>>, every
+stream counts what stdio asks of its read and write functions, which
+for a file are the <<read>> and <<write>> system calls.  <<__fstats>>
+returns the counters of <[fp]>, or, when <[fp]> is NULL, the sum over
+all streams since the program started:
+
+o+
+o _reads, _read_bytes
+calls of the read function and the bytes they returned
+
+o _writes, _write_bytes
+calls of the write function, or of <<writev>>, and the bytes they took
+
+o _flushes
+buffers flushed with something in them, line by line on a line
+buffered stream
+
+o _refills
+buffers refilled
+
+o _setups
+calls of <<__swsetup_r>>, made when a write finds the stream not yet
+set up for writing
+
+o _bufs
+buffers allocated
+
+o _contended
+times the stream lock was held by another thread when taken
+o-
+
+<<_write_bytes>> / <<_writes>> is the average size of a write; a
+small one on a buffered stream points at flushes forced by line
+buffering or <<fflush>>, which <<setvbuf>> with a bigger buffer or
+full buffering avoids.  The counters of a stream start from 0 when it
+is opened.  They are updated without atomics, under the stream lock,
+so the total is approximate when several threads do I/O at once.
+
+RETURNS
+A pointer to the counters, which go on counting.
+
+PORTABILITY
+<<__fstats>> is a newlib extension.
+
+No supporting OS subroutines are required.
+*/
+
+#include <_ansi.h>
+#include <stdio.h>
+#include <stdio_ext.h>
+#include "local.h"
+
+#ifdef _STDIO_STATS
+const struct __sFILE_stats *
+__fstats (FILE *fp)
+{
+  return fp != NULL ? &fp->_stats : &__sstats;
+}
+#endif
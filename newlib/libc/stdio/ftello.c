@@ -94,7 +94,7 @@ _ftello_r (struct _reent * ptr,
 
   _newlib_flockfile_start (fp);
 
-  if (fp->_seek == NULL)
+  if (_SOPS (fp)->_seek == NULL)
     {
       ptr->_errno = ESPIPE;
       _newlib_flockfile_exit (fp);
@@ -106,7 +106,7 @@ _ftello_r (struct _reent * ptr,
       fp->_p != NULL && fp->_p - fp->_bf._base > 0 &&
       (fp->_flags & __SAPP))
     {
-      pos = fp->_seek (ptr, fp->_cookie, (_fpos_t) 0, SEEK_END);
+      pos = _SOPS (fp)->_seek (ptr, fp->_cookie, (_fpos_t) 0, SEEK_END);
       if (pos == (_fpos_t) -1)
 	{
           _newlib_flockfile_exit (fp);
@@ -117,7 +117,7 @@ _ftello_r (struct _reent * ptr,
     pos = fp->_offset;
   else
     {
-      pos = fp->_seek (ptr, fp->_cookie, (_fpos_t) 0, SEEK_CUR);
+      pos = _SOPS (fp)->_seek (ptr, fp->_cookie, (_fpos_t) 0, SEEK_CUR);
       if (pos == (_fpos_t) -1)
         {
           _newlib_flockfile_exit (fp);
@@ -133,7 +133,7 @@ _ftello_r (struct _reent * ptr,
        */
       pos -= fp->_r;
       if (HASUB (fp))
-	pos -= fp->_ur;
+	pos -= _UR (fp);
     }
   else if ((fp->_flags & __SWR) && fp->_p != NULL)
     {
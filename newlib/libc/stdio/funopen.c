@@ -189,6 +189,13 @@ funcloser (struct _reent *ptr,
   return result;
 }
 
+#ifdef _STDIO_COMPACT_FILE
+static const struct __sFILE_ops fun_ops =
+  { funreader, funwriter, funseeker, funcloser };
+static const struct __sFILE_ops fun_noseek_ops =
+  { funreader, funwriter, NULL, funcloser };
+#endif
+
 FILE *
 _funopen_r (struct _reent *ptr,
        const void *cookie,
@@ -210,7 +217,7 @@ _funopen_r (struct _reent *ptr,
   if ((c = (funcookie *) _malloc_r (ptr, sizeof *c)) == NULL)
     {
       _newlib_sfp_lock_start ();
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);	/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -225,36 +232,39 @@ _funopen_r (struct _reent *ptr,
   if (readfn)
     {
       c->readfn = readfn;
-      fp->_read = funreader;
       if (writefn)
 	{
 	  fp->_flags = __SRW;
 	  c->writefn = writefn;
-	  fp->_write = funwriter;
 	}
       else
 	{
 	  fp->_flags = __SRD;
 	  c->writefn = NULL;
-	  fp->_write = NULL;
 	}
     }
   else
     {
       fp->_flags = __SWR;
       c->writefn = writefn;
-      fp->_write = funwriter;
       c->readfn = NULL;
-      fp->_read = NULL;
     }
   c->seekfn = seekfn;
+  c->closefn = closefn;
+#ifdef _STDIO_COMPACT_FILE
+  /* The read or write operation a stream lacks is never called, as
+     its flags do not allow it.  */
+  fp->_ops = seekfn ? &fun_ops : &fun_noseek_ops;
+#else
+  fp->_read = fp->_flags & __SWR ? NULL : funreader;
+  fp->_write = fp->_flags & __SRD ? NULL : funwriter;
   fp->_seek = seekfn ? funseeker : NULL;
 #ifdef __LARGE64_FILES
   fp->_seek64 = seekfn ? funseeker64 : NULL;
   fp->_flags |= __SL64;
 #endif
-  c->closefn = closefn;
   fp->_close = funcloser;
+#endif
   _newlib_flockfile_end (fp);
   return fp;
 }
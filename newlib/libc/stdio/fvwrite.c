@@ -22,6 +22,9 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <limits.h>
+#include <reent.h>
+#include <sys/uio.h>
+#include <sys/yield.h>
 #include "local.h"
 #include "fvwrite.h"
 
@@ -37,6 +40,107 @@
       iov++; \
     }
 
+#define	WRITEV_MAX	8	/* vectors handed to each _writev_r */
+
+/* Set once _writev_r has failed with ENOSYS: the system has no
+   _writev, and the buffer is used as it always was.  */
+static unsigned char writev_missing;
+
+/* Whether UIO goes to _writev rather than through the buffer: the
+   stream is on a file descriptor and the bytes do not fit.  */
+#ifdef __LARGE64_FILES
+#define WRITEV_STREAM(fp) \
+  (_SOPS (fp)->_write == __swrite || _SOPS (fp)->_write == __swrite64)
+#else
+#define WRITEV_STREAM(fp) (_SOPS (fp)->_write == __swrite)
+#endif
+#define USE_WRITEV(fp, uio) \
+  (!writev_missing && ((fp)->_flags & __SSTR) == 0 && WRITEV_STREAM (fp) \
+   && (uio)->uio_resid > (size_t) ((fp)->_bf._size \
+				   - ((fp)->_p - (fp)->_bf._base)))
+
+/*
+ * Write the buffered bytes and then UIO with as few _writev_r calls
+ * as WRITEV_MAX allows, leaving the buffer empty.  This does what
+ * __swrite would about append mode and the known offset.  Returns 1,
+ * having written nothing, if there turns out to be no _writev.
+ */
+static int
+__sfvwrite_gather (struct _reent *ptr,
+       register FILE *fp,
+       register struct __suio *uio)
+{
+  struct iovec v[WRITEV_MAX];
+  struct __siov *iov = uio->uio_iov;
+  int iovcnt = uio->uio_iovcnt;
+  const unsigned char *buf = fp->_bf._base;
+  size_t pend = fp->_p - fp->_bf._base;
+  size_t off = 0, n;
+  _ssize_t w;
+  int i, cnt, err = ptr->_errno;
+
+  if (fp->_flags & __SAPP)
+    _lseek_r (ptr, fp->_file, (_off_t) 0, SEEK_END);
+  fp->_flags &= ~__SOFF;	/* in case O_APPEND mode is set */
+
+  while (pend + uio->uio_resid != 0)
+    {
+      cnt = 0;
+      if (pend != 0)
+	{
+	  v[cnt].iov_base = (void *) buf;
+	  v[cnt++].iov_len = pend;
+	}
+      for (i = 0; i < iovcnt && cnt < WRITEV_MAX; i++)
+	{
+	  v[cnt].iov_base = (char *) iov[i].iov_base + (i == 0 ? off : 0);
+	  v[cnt++].iov_len = iov[i].iov_len - (i == 0 ? off : 0);
+	}
+
+      w = _writev_r (ptr, fp->_file, v, cnt);
+      if (w < 0 && ptr->_errno == ENOSYS
+	  && buf == fp->_bf._base && iov == uio->uio_iov && off == 0)
+	{
+	  writev_missing = 1;
+	  ptr->_errno = err;
+	  return 1;
+	}
+      _STDIO_COUNT_IO (fp, _writes, _write_bytes, w);
+      if (w <= 0)
+	goto err;
+
+      n = MIN ((size_t) w, pend);
+      buf += n;
+      pend -= n;
+      w -= n;
+      while (w > 0)
+	{
+	  n = MIN ((size_t) w, iov->iov_len - off);
+	  off += n;
+	  w -= n;
+	  uio->uio_resid -= n;
+	  if (off == iov->iov_len)
+	    {
+	      iov++;
+	      iovcnt--;
+	      off = 0;
+	    }
+	}
+    }
+  fp->_p = fp->_bf._base;
+  fp->_w = fp->_flags & (__SLBF | __SNBF) ? 0 : fp->_bf._size;
+  return 0;
+
+err:
+  /* Keep what was buffered and not written, as __sflush_r does.  */
+  if (pend != 0)
+    (void) memmove ((void *) fp->_bf._base, (void *) buf, pend);
+  fp->_p = fp->_bf._base + pend;
+  fp->_w = fp->_flags & (__SLBF | __SNBF) ? 0 : fp->_bf._size - pend;
+  fp->_flags |= __SERR;
+  return EOF;
+}
+
 /*
  * Write some memory regions.  Return zero on success, EOF on error.
  *
@@ -55,6 +159,7 @@ __sfvwrite_r (struct _reent *ptr,
   register _READ_WRITE_RETURN_TYPE w, s;
   char *nl;
   int nlknown, nldist;
+  unsigned int yield_bytes = 0;
 
   if ((len = uio->uio_resid) == 0)
     return 0;
@@ -86,6 +191,10 @@ __sfvwrite_r (struct _reent *ptr,
     }
 #endif
 
+  if (USE_WRITEV (fp, uio)
+      && (w = __sfvwrite_gather (ptr, fp, uio)) <= 0)
+    return w;
+
   if (fp->_flags & __SNBF)
     {
       /*
@@ -95,10 +204,12 @@ __sfvwrite_r (struct _reent *ptr,
       do
 	{
 	  GETIOV (;);
-	  w = fp->_write (ptr, fp->_cookie, p,
+	  w = _SOPS (fp)->_write (ptr, fp->_cookie, p,
 			  MIN (len, INT_MAX - INT_MAX % BUFSIZ));
+	  _STDIO_COUNT_IO (fp, _writes, _write_bytes, w);
 	  if (w <= 0)
 	    goto err;
+	  __libc_yield_count (yield_bytes, w);
 	  p += w;
 	  len -= w;
 	}
@@ -193,10 +304,12 @@ __sfvwrite_r (struct _reent *ptr,
 	    {
 	      /* write directly */
 	      w = ((int)MIN (len, INT_MAX)) / fp->_bf._size * fp->_bf._size;
-	      w = fp->_write (ptr, fp->_cookie, p, w);
+	      w = _SOPS (fp)->_write (ptr, fp->_cookie, p, w);
+	      _STDIO_COUNT_IO (fp, _writes, _write_bytes, w);
 	      if (w <= 0)
 		goto err;
 	    }
+	  __libc_yield_count (yield_bytes, w);
 	  p += w;
 	  len -= w;
 	}
@@ -234,7 +347,8 @@ __sfvwrite_r (struct _reent *ptr,
 	    }
 	  else if (s >= (w = fp->_bf._size))
 	    {
-	      w = fp->_write (ptr, fp->_cookie, p, w);
+	      w = _SOPS (fp)->_write (ptr, fp->_cookie, p, w);
+	      _STDIO_COUNT_IO (fp, _writes, _write_bytes, w);
 	      if (w <= 0)
 		goto err;
 	    }
@@ -252,6 +366,7 @@ __sfvwrite_r (struct _reent *ptr,
 		goto err;
 	      nlknown = 0;
 	    }
+	  __libc_yield_count (yield_bytes, w);
 	  p += w;
 	  len -= w;
 	}
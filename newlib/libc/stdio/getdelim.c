@@ -33,6 +33,7 @@ No supporting OS subroutines are directly required.
 #include <_ansi.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include "local.h"
 
@@ -45,12 +46,14 @@ __getdelim (char **bufptr,
        int delim,
        FILE *fp)
 {
+  struct _reent *reent = _REENT;
   char *buf;
-  char *ptr;
-  size_t newsize, numbytes;
-  int pos;
+  unsigned char *p, *end;
+  size_t newsize, pos, len, need;
+#ifdef __SCLE
+  unsigned char c;
   int ch;
-  int cont;
+#endif
 
   if (fp == NULL || bufptr == NULL || n == NULL)
     {
@@ -70,64 +73,82 @@ __getdelim (char **bufptr,
       *n = DEFAULT_LINE_SIZE;
     }
 
-  CHECK_INIT (_REENT, fp);
+  CHECK_INIT (reent, fp);
 
   _newlib_flockfile_start (fp);
 
-  numbytes = *n;
-  ptr = buf;
-
-  cont = 1;
-
-  while (cont)
+  pos = 0;
+  for (;;)
     {
-      /* fill buffer - leaving room for nul-terminator */
-      while (--numbytes > 0)
-        {
-          if ((ch = getc_unlocked (fp)) == EOF)
-            {
-	      cont = 0;
-              break;
-            }
-	  else 
-            {
-              *ptr++ = ch;
-              if (ch == delim)
-                {
-                  cont = 0;
-                  break;
-                }
-            }
-        }
-
-      if (cont)
+      /* Take what is in the stream buffer up to and including the
+	 delimiter, in one piece.  */
+      if (fp->_r <= 0 && __srefill_r (reent, fp))
+	break;
+      p = fp->_p;
+      len = fp->_r;
+#ifdef __SCLE
+      /* Line ends are converted one character at a time by getc.  */
+      if (fp->_flags & __SCLE)
+	{
+	  if ((ch = __sgetc_r (reent, fp)) == EOF)
+	    break;
+	  c = ch;
+	  p = &c;
+	  len = 1;
+	  end = ch == delim ? p : NULL;
+	}
+      else
+#endif
+	{
+	  end = memchr (p, (unsigned char) delim, len);
+	  if (end != NULL)
+	    len = end - p + 1;
+	}
+
+      /* Leave room for the nul-terminator.  */
+      need = pos + len + 1;
+      if (need > *n)
         {
-          /* Buffer is too small so reallocate a larger buffer.  */
-          pos = ptr - buf;
-          newsize = (*n << 1);
-          buf = realloc (buf, newsize);
-          if (buf == NULL)
-            {
-              cont = 0;
-              break;
-            }
-
-          /* After reallocating, continue in new buffer */          
-          *bufptr = buf;
-          *n = newsize;
-          ptr = buf + pos;
-          numbytes = newsize - pos;
+	  /* Buffer is too small so reallocate a larger buffer.  */
+	  for (newsize = *n; newsize < need; newsize <<= 1)
+	    if (newsize > (size_t) -1 / 2)
+	      {
+		newsize = need;
+		break;
+	      }
+	  buf = realloc (*bufptr, newsize);
+	  if (buf == NULL)
+	    {
+	      /* Keep what fits, and stop.  */
+	      buf = *bufptr;
+	      len = *n - 1 - pos;
+	      end = p;
+	    }
+	  else
+	    {
+	      *bufptr = buf;
+	      *n = newsize;
+	    }
         }
+      memcpy (buf + pos, p, len);
+      pos += len;
+      /* Unless getc took it already.  */
+      if (p == fp->_p)
+	{
+	  fp->_p += len;
+	  fp->_r -= len;
+	}
+      if (end != NULL)
+	break;
     }
 
   _newlib_flockfile_end (fp);
 
   /* if no input data, return failure */
-  if (ptr == buf)
+  if (pos == 0)
     return -1;
 
   /* otherwise, nul-terminate and return number of bytes read */
-  *ptr = '\0';
-  return (ssize_t)(ptr - buf);
+  buf[pos] = '\0';
+  return (ssize_t) pos;
 }
-
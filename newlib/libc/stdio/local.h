@@ -60,6 +60,38 @@
 #define _STDIO_WITH_THREAD_CANCELLATION_SUPPORT
 #endif
 
+/* With _STDIO_STATS, _STDIO_COUNT adds N to MEMBER of the counters of
+   FP and of the total, see __fstats; _STDIO_COUNT_IO counts a call of
+   a read or write function that returned RET, and the bytes it moved.  */
+#ifdef _STDIO_STATS
+extern struct __sFILE_stats __sstats;
+# define _STDIO_COUNT(fp, member, n) \
+	((fp)->_stats.member += (n), __sstats.member += (n))
+# define _STDIO_COUNT_IO(fp, calls, bytes, ret) \
+	(_STDIO_COUNT (fp, calls, 1), \
+	 (ret) > 0 ? (void) _STDIO_COUNT (fp, bytes, (ret)) : (void) 0)
+#else
+# define _STDIO_COUNT(fp, member, n) ((void) 0)
+# define _STDIO_COUNT_IO(fp, calls, bytes, ret) ((void) 0)
+#endif
+
+/* Take the lock of a stream, counting with _STDIO_STATS the times it
+   was held by another thread.  */
+#if defined(_STDIO_STATS) && !defined(__SINGLE_THREAD__) \
+    && !defined(__IMPL_UNLOCKED__)
+# define _newlib_flockfile_take(_fp) \
+	do \
+	  if (!((_fp)->_flags & __SSTR) \
+	      && __lock_try_acquire_recursive ((_fp)->_lock) != 0) \
+	    { \
+	      _STDIO_COUNT (_fp, _contended, 1); \
+	      _flockfile (_fp); \
+	    } \
+	while (0)
+#else
+# define _newlib_flockfile_take(_fp) _flockfile (_fp)
+#endif
+
 #if defined(__SINGLE_THREAD__) || defined(__IMPL_UNLOCKED__)
 
 # define _newlib_flockfile_start(_fp)
@@ -78,7 +110,7 @@
 	  int __oldfpcancel; \
 	  pthread_setcancelstate (PTHREAD_CANCEL_DISABLE, &__oldfpcancel); \
 	  if (!(_fp->_flags2 & __SNLK)) \
-	    _flockfile (_fp)
+	    _newlib_flockfile_take (_fp)
 
 /* Exit from a stream oriented critical section prematurely: */
 # define _newlib_flockfile_exit(_fp) \
@@ -116,7 +148,7 @@
 # define _newlib_flockfile_start(_fp) \
 	{ \
 		if (!(_fp->_flags2 & __SNLK)) \
-		  _flockfile (_fp)
+		  _newlib_flockfile_take (_fp)
 
 # define _newlib_flockfile_exit(_fp) \
 		if (!(_fp->_flags2 & __SNLK)) \
@@ -162,6 +194,11 @@ int	      _svfwprintf_r (struct _reent *, FILE *, const wchar_t *,
 int	      _svfiwprintf_r (struct _reent *, FILE *, const wchar_t *, 
 				  va_list);
 extern FILE  *__sfp (struct _reent *);
+#if defined (_REENT_SMALL) && defined (_STDIO_STATIC_FILES)
+extern void   __sfp_free (FILE *);
+#else
+#define __sfp_free(fp) ((fp)->_flags = 0)
+#endif
 extern int    __sflags (struct _reent *,const char*, int*);
 extern int    __sflush_r (struct _reent *,FILE *);
 #ifdef _STDIO_BSD_SEMANTICS
@@ -178,13 +215,27 @@ extern _READ_WRITE_RETURN_TYPE __swrite (struct _reent *, void *,
 						_READ_WRITE_BUFSIZE_TYPE);
 extern _fpos_t __sseek (struct _reent *, void *, _fpos_t, int);
 extern int    __sclose (struct _reent *, void *);
+#ifdef _STDIO_COMPACT_FILE
+extern const struct __sFILE_ops __sstdops;
+extern const struct __sFILE_ops __seofops;
+extern int    __smakeub_r (struct _reent *, FILE *);
+#endif
 extern int    __stextmode (int);
 extern void   __sinit (struct _reent *);
 extern void   _cleanup_r (struct _reent *);
 extern void   __smakebuf_r (struct _reent *, FILE *);
 extern int    __swhatbuf_r (struct _reent *, FILE *, size_t *, int *);
+extern void   __sfreebuf_r (struct _reent *, void *);
 extern int    _fwalk (struct _reent *, int (*)(FILE *));
 extern int    _fwalk_reent (struct _reent *, int (*)(struct _reent *, FILE *));
+#ifdef _STDIO_WRITERS
+/* The table of streams set up for writing, see findfp.c.  */
+extern void   __swriter_add (FILE *);
+extern int    _fwalk_writers (struct _reent *, int (*)(struct _reent *, FILE *));
+#else
+#define __swriter_add(fp)
+#define _fwalk_writers _fwalk_reent
+#endif
 struct _glue * __sfmoreglue (struct _reent *,int n);
 extern int __submore (struct _reent *, FILE *);
 
@@ -212,6 +263,11 @@ extern _READ_WRITE_RETURN_TYPE __swrite64 (struct _reent *, void *,
 	(fp) = _stderr_r(_check_init_ptr);			\
     }								\
   while (0)
+#elif defined(_REENT_STATIC_STD_STREAMS)
+/* The global reent and the standard streams start out set up, see
+   findfp.c, and the other reents share the streams, so nothing is
+   left to do.  */
+#define CHECK_INIT(ptr, fp) do { } while (0)
 #else /* !_REENT_SMALL || _REENT_GLOBAL_STDIO_STREAMS */
 #define CHECK_INIT(ptr, fp) \
   do								\
@@ -239,21 +295,64 @@ extern _READ_WRITE_RETURN_TYPE __swrite64 (struct _reent *, void *,
   ((((fp)->_flags & __SWR) == 0 || (fp)->_bf._base == NULL) && \
    __swsetup_r(ptr, fp))
 
+/* The operations and the ungetc state of a stream.  With
+   _STDIO_COMPACT_FILE they are reached through the FILE; the ungetc
+   fields may only be used once MAKEUB has succeeded, as HASUB implies.  */
+
+#ifdef _STDIO_COMPACT_FILE
+#define	_SOPS(fp)	((fp)->_ops)
+#define	_UB(fp)		((fp)->_ungetc->_ub)
+#define	_UP(fp)		((fp)->_ungetc->_up)
+#define	_UR(fp)		((fp)->_ungetc->_ur)
+#define	_UBUF(fp)	((fp)->_ungetc->_ubuf)
+#else
+#define	_SOPS(fp)	(fp)
+#define	_UB(fp)		((fp)->_ub)
+#define	_UP(fp)		((fp)->_up)
+#define	_UR(fp)		((fp)->_ur)
+#define	_UBUF(fp)	((fp)->_ubuf)
+#endif
+
 /* Test whether the given stdio file has an active ungetc buffer;
    release such a buffer, without restoring ordinary unread data.  */
 
+#ifdef _STDIO_COMPACT_FILE
+#define	HASUB(fp) ((fp)->_ungetc != NULL && (fp)->_ungetc->_ub._base != NULL)
+#else
 #define	HASUB(fp) ((fp)->_ub._base != NULL)
+#endif
 #define	FREEUB(ptr, fp) {                    \
-	if ((fp)->_ub._base != (fp)->_ubuf) \
-		_free_r(ptr, (char *)(fp)->_ub._base); \
-	(fp)->_ub._base = NULL; \
+	if (_UB (fp)._base != _UBUF (fp)) \
+		_free_r(ptr, (char *)_UB (fp)._base); \
+	_UB (fp)._base = NULL; \
 }
 
+/* Make sure there is ungetc state to start an ungetc buffer in, set
+   up a new FILE without one, and give the state back on close.  */
+
+#ifdef _STDIO_COMPACT_FILE
+#define	MAKEUB(ptr, fp) ((fp)->_ungetc != NULL || __smakeub_r (ptr, fp) == 0)
+#define	CLEARUB(fp) ((fp)->_ungetc = NULL)
+#define	FREEUNGETC(ptr, fp) { _free_r(ptr, (fp)->_ungetc); \
+      (fp)->_ungetc = NULL; }
+#else
+#define	MAKEUB(ptr, fp) 1
+#define	CLEARUB(fp) ((fp)->_ub._base = NULL, (fp)->_ub._size = 0)
+#define	FREEUNGETC(ptr, fp) { (fp)->_ub._size = 0; }
+#endif
+
 /* Test for an fgetline() buffer.  */
 
+#ifdef _STDIO_COMPACT_FILE
+#define	HASLB(fp) 0
+#define	FREELB(ptr, fp) { }
+#define	CLEARLB(fp) ((void) 0)
+#else
 #define	HASLB(fp) ((fp)->_lb._base != NULL)
 #define	FREELB(ptr, fp) { _free_r(ptr,(char *)(fp)->_lb._base); \
       (fp)->_lb._base = NULL; }
+#define	CLEARLB(fp) ((fp)->_lb._base = NULL, (fp)->_lb._size = 0)
+#endif
 
 #ifdef _WIDE_ORIENT
 /*
@@ -289,6 +388,17 @@ char *_llicvt (char *, long long, char);
 
 #define CVT_BUF_SIZE 128
 
+/* The asprintf family formats into a buffer of this size on the stack
+   first, so that output which fits costs one allocation of the exact
+   size and a copy.  */
+#ifndef AS_BUF_SIZE
+#ifdef _REENT_SMALL
+#define AS_BUF_SIZE 64
+#else
+#define AS_BUF_SIZE 128
+#endif
+#endif
+
 #define	NDYNAMIC 4	/* add four more whenever necessary */
 
 #ifdef __SINGLE_THREAD__
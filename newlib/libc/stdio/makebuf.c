@@ -26,6 +26,63 @@
 
 #define _DEFAULT_ASPRINTF_BUFSIZE 64
 
+#ifdef _STDIO_BUF_POOL
+/*
+ * Built with _STDIO_BUF_POOL set to a count of up to 16, stream buffers
+ * of up to _STDIO_BUF_POOL_SIZE bytes come from a static pool before
+ * the heap is tried.  String streams, which realloc their buffer,
+ * always use the heap.
+ */
+#ifndef _STDIO_BUF_POOL_SIZE
+#define _STDIO_BUF_POOL_SIZE BUFSIZ
+#endif
+
+static unsigned char __sbufpool[_STDIO_BUF_POOL][_STDIO_BUF_POOL_SIZE];
+static unsigned int __sbufpool_used;
+
+static void *
+__sbufpool_get (size_t size)
+{
+  void *p = NULL;
+  int i;
+
+  if (size > _STDIO_BUF_POOL_SIZE)
+    return NULL;
+  __sfp_lock_acquire ();
+  for (i = 0; i < _STDIO_BUF_POOL; i++)
+    if (!(__sbufpool_used & (1u << i)))
+      {
+	__sbufpool_used |= 1u << i;
+	p = __sbufpool[i];
+	break;
+      }
+  __sfp_lock_release ();
+  return p;
+}
+#endif /* _STDIO_BUF_POOL */
+
+/*
+ * Release a buffer obtained by __smakebuf_r, that is one with __SMBF.
+ */
+void
+__sfreebuf_r (struct _reent *ptr,
+       void *p)
+{
+#ifdef _STDIO_BUF_POOL
+  unsigned char *b = (unsigned char *) p;
+
+  if (b >= &__sbufpool[0][0] && b < &__sbufpool[_STDIO_BUF_POOL][0])
+    {
+      __sfp_lock_acquire ();
+      __sbufpool_used &= ~(1u << ((b - &__sbufpool[0][0])
+				  / _STDIO_BUF_POOL_SIZE));
+      __sfp_lock_release ();
+      return;
+    }
+#endif
+  _free_r (ptr, p);
+}
+
 /*
  * Allocate a file buffer, or switch to unbuffered I/O.
  * Per the ANSI C standard, ALL tty devices default to line buffered.
@@ -50,7 +107,14 @@ __smakebuf_r (struct _reent *ptr,
       return;
     }
   flags = __swhatbuf_r (ptr, fp, &size, &couldbetty);
-  if ((p = _malloc_r (ptr, size)) == NULL)
+  p = NULL;
+#ifdef _STDIO_BUF_POOL
+  if (!(fp->_flags & __SSTR))
+    p = __sbufpool_get (size);
+#endif
+  if (p == NULL)
+    p = _malloc_r (ptr, size);
+  if (p == NULL)
     {
       if (!(fp->_flags & __SSTR))
 	{
@@ -65,6 +129,7 @@ __smakebuf_r (struct _reent *ptr,
       fp->_flags |= __SMBF;
       fp->_bf._base = fp->_p = (unsigned char *) p;
       fp->_bf._size = size;
+      _STDIO_COUNT (fp, _bufs, 1);
       if (couldbetty && _isatty_r (ptr, fp->_file))
 	fp->_flags = (fp->_flags & ~__SNBF) | __SLBF;
       fp->_flags |= flags;
@@ -73,6 +138,8 @@ __smakebuf_r (struct _reent *ptr,
 
 /*
  * Internal routine to determine `proper' buffering for a file.
+ * With HAVE_BLKSIZE the size is the st_blksize that the system's fstat
+ * reports, which lets a BSP pick one per kind of device.
  */
 int
 __swhatbuf_r (struct _reent *ptr,
@@ -0,0 +1,243 @@
+/* Deferred binary logging, see <blog.h>.  The format is walked the
+   way _VFPRINTF_R in nano-vfprintf.c walks it, but each argument is
+   only copied into the record.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <sys/lock.h>
+#include <blog.h>
+#include "local.h"
+#include "nano-vfprintf_local.h"
+
+/* The largest record, which is built on the stack; the length byte
+   limits it to 256.  */
+#ifndef BLOG_RECMAX
+#define BLOG_RECMAX	64
+#endif
+
+static unsigned char *blog_buf;
+static size_t blog_size;
+static size_t blog_head;	/* where the next record goes */
+static size_t blog_used;	/* bytes not yet read */
+
+unsigned long blog_dropped;
+
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT (static, __blog_lock);
+#endif
+
+/* Copy N bytes from P to the ring position AT, wrapping.  */
+static void
+blog_copy_in (size_t at,
+       const unsigned char *p,
+       size_t n)
+{
+  size_t k = blog_size - at;
+
+  if (k > n)
+    k = n;
+  memcpy (blog_buf + at, p, k);
+  memcpy (blog_buf, p + k, n - k);
+}
+
+void
+blog_init (void *buf,
+       size_t size)
+{
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__blog_lock);
+#endif
+  blog_buf = buf;
+  blog_size = size;
+  blog_head = blog_used = 0;
+  blog_dropped = 0;
+#ifndef __SINGLE_THREAD__
+  __lock_release (__blog_lock);
+#endif
+}
+
+/* Append the bytes of V to the record, dropping it if they do not
+   fit.  */
+#define BLOG_STORE(v)					\
+  do							\
+    {							\
+      if ((size_t) (end - p) < sizeof (v))		\
+	goto drop;					\
+      memcpy (p, &(v), sizeof (v));			\
+      p += sizeof (v);					\
+    }							\
+  while (0)
+
+#define BLOG_PUT(type)					\
+  do							\
+    {							\
+      type v_ = va_arg (ap, type);			\
+      BLOG_STORE (v_);					\
+    }							\
+  while (0)
+
+int
+vblog_printf (const char *fmt,
+       va_list ap)
+{
+  unsigned char rec[BLOG_RECMAX > 256 ? 256 : BLOG_RECMAX];
+  unsigned char *p = rec + 1, *end = rec + sizeof (rec);
+  const char *s;
+  int flags, prec, n;
+
+  BLOG_STORE (fmt);
+
+  for (;;)
+    {
+      while (*fmt != '\0' && *fmt != '%')
+	fmt++;
+      if (*fmt == '\0')
+	break;
+      fmt++;
+
+      /* The flags and the width.  */
+      while (*fmt != '\0' && memchr ("#-0+ ", *fmt, 5) != NULL)
+	fmt++;
+      if (*fmt == '*')
+	{
+	  BLOG_PUT (int);
+	  fmt++;
+	}
+      else
+	while (is_digit (*fmt))
+	  fmt++;
+
+      /* The precision.  */
+      prec = -1;
+      if (*fmt == '.')
+	{
+	  fmt++;
+	  if (*fmt == '*')
+	    {
+	      prec = va_arg (ap, int);
+	      BLOG_STORE (prec);
+	      fmt++;
+	    }
+	  else
+	    for (prec = 0; is_digit (*fmt); fmt++)
+	      prec = 10 * prec + to_digit (*fmt);
+	}
+
+      /* The length modifiers.  */
+      flags = 0;
+      if (*fmt == 'h')
+	flags = SHORTINT;
+      else if (*fmt == 'l')
+	flags = LONGINT;
+      else if (*fmt == 'L')
+	flags = LONGDBL;
+      if (flags)
+	fmt++;
+
+      switch (*fmt)
+	{
+	case '\0':
+	  continue;
+	case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+	case 'c':
+	  if (flags & LONGINT)
+	    BLOG_PUT (long);
+	  else
+	    BLOG_PUT (int);
+	  break;
+	case 'p':
+	  BLOG_PUT (void *);
+	  break;
+	case 'e': case 'E': case 'f': case 'F': case 'g': case 'G':
+	  if (flags & LONGDBL)
+	    BLOG_PUT (_LONG_DOUBLE);
+	  else
+	    BLOG_PUT (double);
+	  break;
+	case 's':
+	  s = va_arg (ap, const char *);
+	  if (p == end)
+	    goto drop;
+	  /* Keep room for the NUL.  */
+	  n = end - p - 1;
+	  if (prec >= 0 && prec < n)
+	    n = prec;
+	  for (; n > 0 && *s != '\0'; n--)
+	    *p++ = *s++;
+	  *p++ = '\0';
+	  break;
+	case 'n':
+	  (void) va_arg (ap, void *);
+	  break;
+	default:
+	  break;
+	}
+      fmt++;
+    }
+
+  n = p - rec;
+  rec[0] = n - 1;
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__blog_lock);
+#endif
+  if (blog_size - blog_used < (size_t) n)
+    {
+#ifndef __SINGLE_THREAD__
+      __lock_release (__blog_lock);
+#endif
+      goto drop;
+    }
+  blog_copy_in (blog_head, rec, n);
+  blog_head += n;
+  if (blog_head >= blog_size)
+    blog_head -= blog_size;
+  blog_used += n;
+#ifndef __SINGLE_THREAD__
+  __lock_release (__blog_lock);
+#endif
+  return n;
+
+drop:
+  blog_dropped++;
+  return -1;
+}
+
+int
+blog_printf (const char *fmt, ...)
+{
+  int ret;
+  va_list ap;
+
+  va_start (ap, fmt);
+  ret = vblog_printf (fmt, ap);
+  va_end (ap);
+  return ret;
+}
+
+size_t
+blog_read (void *buf,
+       size_t n)
+{
+  size_t at, k;
+
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__blog_lock);
+#endif
+  if (n > blog_used)
+    n = blog_used;
+  at = blog_head >= blog_used ? blog_head - blog_used
+			      : blog_head + blog_size - blog_used;
+  k = blog_size - at;
+  if (k > n)
+    k = n;
+  memcpy (buf, blog_buf + at, k);
+  memcpy ((unsigned char *) buf + k, blog_buf, n - k);
+  blog_used -= n;
+#ifndef __SINGLE_THREAD__
+  __lock_release (__blog_lock);
+#endif
+  return n;
+}
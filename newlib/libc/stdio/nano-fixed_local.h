@@ -0,0 +1,124 @@
+/* The ISO/IEC TR 18037 fixed-point types as seen by the %r, %R, %k
+   and %K conversions of nano-vfprintf_fixed.c and nano-vfscanf_fixed.c.
+   A value is handled as the bits of its representation, an integer with
+   FBIT fraction bits, IBIT integer bits and, for the signed types, a
+   sign bit above them; nothing here needs the compiler's fixed-point
+   arithmetic.  */
+
+#ifndef NANO_FIXED_LOCAL
+#define NANO_FIXED_LOCAL
+
+#ifdef __FRACT_FBIT__
+
+#include <stdint.h>
+#include <string.h>
+
+typedef unsigned long long __fx_bits_t;
+
+/* Expand F (TYPE, IBIT, FBIT, SIGNED) for the type converted by CODE,
+   one of rRkK; H and L are the flags set for the h and l length
+   modifiers.  */
+#define FIXED_SELECT(code, flags, H, L, F)				\
+  if ((code) == 'r')							\
+    {									\
+      if ((flags) & (H))						\
+	F (short _Fract, __SFRACT_IBIT__, __SFRACT_FBIT__, 1);		\
+      else if ((flags) & (L))						\
+	F (long _Fract, __LFRACT_IBIT__, __LFRACT_FBIT__, 1);		\
+      else								\
+	F (_Fract, __FRACT_IBIT__, __FRACT_FBIT__, 1);			\
+    }									\
+  else if ((code) == 'R')						\
+    {									\
+      if ((flags) & (H))						\
+	F (unsigned short _Fract, __USFRACT_IBIT__, __USFRACT_FBIT__, 0); \
+      else if ((flags) & (L))						\
+	F (unsigned long _Fract, __ULFRACT_IBIT__, __ULFRACT_FBIT__, 0); \
+      else								\
+	F (unsigned _Fract, __UFRACT_IBIT__, __UFRACT_FBIT__, 0);	\
+    }									\
+  else if ((code) == 'k')						\
+    {									\
+      if ((flags) & (H))						\
+	F (short _Accum, __SACCUM_IBIT__, __SACCUM_FBIT__, 1);		\
+      else if ((flags) & (L))						\
+	F (long _Accum, __LACCUM_IBIT__, __LACCUM_FBIT__, 1);		\
+      else								\
+	F (_Accum, __ACCUM_IBIT__, __ACCUM_FBIT__, 1);			\
+    }									\
+  else									\
+    {									\
+      if ((flags) & (H))						\
+	F (unsigned short _Accum, __USACCUM_IBIT__, __USACCUM_FBIT__, 0); \
+      else if ((flags) & (L))						\
+	F (unsigned long _Accum, __ULACCUM_IBIT__, __ULACCUM_FBIT__, 0); \
+      else								\
+	F (unsigned _Accum, __UACCUM_IBIT__, __UACCUM_FBIT__, 0);	\
+    }
+
+/* The low NBITS bits set.  */
+#define FX_MASK(nbits) \
+  ((nbits) >= 64 ? ~(__fx_bits_t) 0 : ((__fx_bits_t) 1 << (nbits)) - 1)
+
+/* The SIZE bytes of the value at P, as an integer.  */
+static inline __fx_bits_t
+__fx_load (const void *p,
+	size_t size)
+{
+  uint8_t b;
+  uint16_t h;
+  uint32_t w;
+  uint64_t d;
+
+  switch (size)
+    {
+    case 1:
+      memcpy (&b, p, 1);
+      return b;
+    case 2:
+      memcpy (&h, p, 2);
+      return h;
+    case 4:
+      memcpy (&w, p, 4);
+      return w;
+    default:
+      memcpy (&d, p, 8);
+      return d;
+    }
+}
+
+/* Store the low SIZE bytes of BITS at P.  */
+static inline void
+__fx_store (void *p,
+	size_t size,
+	__fx_bits_t bits)
+{
+  uint8_t b;
+  uint16_t h;
+  uint32_t w;
+  uint64_t d;
+
+  switch (size)
+    {
+    case 1:
+      b = bits;
+      memcpy (p, &b, 1);
+      break;
+    case 2:
+      h = bits;
+      memcpy (p, &h, 2);
+      break;
+    case 4:
+      w = bits;
+      memcpy (p, &w, 4);
+      break;
+    default:
+      d = bits;
+      memcpy (p, &d, 8);
+      break;
+    }
+}
+
+#endif /* __FRACT_FBIT__ */
+
+#endif /* NANO_FIXED_LOCAL */
@@ -0,0 +1,201 @@
+/* isr_snprintf and isr_vsnprintf, see <isr_printf.h>.  The loop of
+   _VFPRINTF_R in nano-vfprintf.c without the stream: the conversions
+   go to _printf_i, which keeps its state in the caller's _prt_data_t
+   and only hands its reent pointer on to the output function, and
+   the output function here writes to the caller's buffer.  Neither
+   looks at a reent structure, so the pointer passed is NULL.  */
+
+#include <_ansi.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <isr_printf.h>
+#include "local.h"
+#include "nano-vfprintf_local.h"
+#include "nano-fixed_local.h"
+
+/* Where the output goes, passed to the output function in place of
+   the FILE: neither _printf_i nor _printf_common looks inside it.  */
+struct isr_sink
+{
+  char *p;
+  char *end;
+};
+
+static int
+isr_sputs (struct _reent *ptr,
+       FILE *fp,
+       const char *buf,
+       size_t len)
+{
+  struct isr_sink *s = (struct isr_sink *) fp;
+
+  if (len > (size_t) (s->end - s->p))
+    len = s->end - s->p;
+  if (len != 0)
+    {
+      memcpy (s->p, buf, len);
+      s->p += len;
+    }
+  return 0;
+}
+
+int
+isr_vsnprintf (char *str,
+       size_t size,
+       const char *fmt0,
+       va_list ap)
+{
+  register const char *fmt;
+  register int n, m;
+  register const char *cp;
+  const char *flag_chars;
+  struct _prt_data_t prt_data;
+  struct isr_sink sink;
+  va_list ap_copy;
+
+  /* What PRINT and PAD expect.  */
+  struct _reent *const data = NULL;
+  FILE *const fp = (FILE *) &sink;
+  int (*const pfunc)(struct _reent *, FILE *, const char *, size_t len)
+    = isr_sputs;
+
+  if (size > INT_MAX)
+    return -1;
+  sink.p = str;
+  sink.end = str + (size > 0 ? size - 1 : 0);
+
+  fmt = fmt0;
+  prt_data.ret = 0;
+  prt_data.blank = ' ';
+  prt_data.zero = '0';
+
+  va_copy (ap_copy, ap);
+
+  for (;;)
+    {
+      cp = fmt;
+      while (*fmt != '\0' && *fmt != '%')
+	fmt += 1;
+
+      if ((m = fmt - cp) != 0)
+	{
+	  PRINT (cp, m);
+	  prt_data.ret += m;
+	}
+      if (*fmt == '\0')
+	break;
+
+      fmt++;		/* Skip over '%'.  */
+
+      prt_data.flags = 0;
+      prt_data.width = 0;
+      prt_data.prec = -1;
+      prt_data.dprec = 0;
+      prt_data.l_buf[0] = '\0';
+#ifdef FLOATING_POINT
+      prt_data.lead = 0;
+#endif
+      flag_chars = "#-0+ ";
+      for (; cp = memchr (flag_chars, *fmt, 5); fmt++)
+	prt_data.flags |= (1 << (cp - flag_chars));
+
+      if (prt_data.flags & SPACESGN)
+	prt_data.l_buf[0] = ' ';
+      if (prt_data.flags & PLUSSGN)
+	prt_data.l_buf[0] = '+';
+
+      /* The width.  */
+      if (*fmt == '*')
+	{
+	  prt_data.width = GET_ARG (n, ap_copy, int);
+	  if (prt_data.width < 0)
+	    {
+	      prt_data.width = -prt_data.width;
+	      prt_data.flags |= LADJUST;
+	    }
+	  fmt++;
+	}
+      else
+	{
+	  for (; is_digit (*fmt); fmt++)
+	    prt_data.width = 10 * prt_data.width + to_digit (*fmt);
+	}
+
+      /* The precision.  */
+      if (*fmt == '.')
+	{
+	  fmt++;
+	  if (*fmt == '*')
+	    {
+	      fmt++;
+	      prt_data.prec = GET_ARG (n, ap_copy, int);
+	      if (prt_data.prec < 0)
+		prt_data.prec = -1;
+	    }
+	  else
+	    {
+	      prt_data.prec = 0;
+	      for (; is_digit (*fmt); fmt++)
+		prt_data.prec = 10 * prt_data.prec + to_digit (*fmt);
+	    }
+	}
+
+      /* The length modifiers.  */
+      flag_chars = "hlL";
+      if ((cp = memchr (flag_chars, *fmt, 3)) != NULL)
+	{
+	  prt_data.flags |= (SHORTINT << (cp - flag_chars));
+	  fmt++;
+	}
+
+      /* The conversion specifiers.  Floating and fixed-point arguments
+	 are taken as when their printers are not linked; printing them
+	 would need the reent structure or more stack than a handler
+	 should ask for.  */
+      if ((prt_data.code = *fmt) == '\0')
+	break;
+      fmt++;
+      if (memchr ("efgEFG", prt_data.code, 6))
+	{
+	  if (prt_data.flags & LONGDBL)
+	    GET_ARG (N, ap_copy, _LONG_DOUBLE);
+	  else
+	    GET_ARG (N, ap_copy, double);
+	  continue;
+	}
+#ifdef __FRACT_FBIT__
+      if (memchr ("rRkK", prt_data.code, 4))
+	{
+	  FIXED_SELECT (prt_data.code, prt_data.flags, SHORTINT, LONGINT,
+			SKIP_FIXED_ARG);
+	  continue;
+	}
+#endif
+      n = _printf_i (data, &prt_data, fp, pfunc, &ap_copy);
+      if (n == -1)
+	goto error;
+
+      prt_data.ret += n;
+    }
+error:
+  va_end (ap_copy);
+  if (size > 0)
+    *sink.p = '\0';
+  return prt_data.ret;
+}
+
+int
+isr_snprintf (char *str,
+       size_t size,
+       const char *fmt, ...)
+{
+  int ret;
+  va_list ap;
+
+  va_start (ap, fmt);
+  ret = isr_vsnprintf (str, size, fmt, ap);
+  va_end (ap);
+  return ret;
+}
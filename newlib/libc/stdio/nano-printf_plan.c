@@ -0,0 +1,94 @@
+/* Cut a format into the steps of a printf_plan_t.  The parsing is
+   that of _VFPRINTF_R in nano-vfprintf.c, done once.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <printf_plan.h>
+#include "local.h"
+#include "nano-vfprintf_local.h"
+
+int
+printf_plan_compile (printf_plan_t *plan,
+       const char *fmt)
+{
+  struct __printf_op *op;
+  const char *cp;
+  const char *flag_chars;
+
+  for (plan->_nops = 0; plan->_nops < PRINTF_PLAN_OPS; )
+    {
+      op = &plan->_ops[plan->_nops++];
+
+      cp = fmt;
+      while (*fmt != '\0' && *fmt != '%')
+	fmt++;
+      if (fmt - cp > USHRT_MAX)
+	break;
+      op->_lit = cp;
+      op->_litlen = fmt - cp;
+      op->_code = '\0';
+      if (*fmt == '\0' || *++fmt == '\0')
+	return 0;
+
+      /* The flags.  */
+      op->_flags = 0;
+      flag_chars = "#-0+ ";
+      for (; (cp = memchr (flag_chars, *fmt, 5)) != NULL; fmt++)
+	op->_flags |= (1 << (cp - flag_chars));
+
+      op->_sign = '\0';
+      if (op->_flags & SPACESGN)
+	op->_sign = ' ';
+      if (op->_flags & PLUSSGN)
+	op->_sign = '+';
+
+      /* The width.  */
+      op->_width = 0;
+      if (*fmt == '*')
+	{
+	  op->_width = PLAN_ARG;
+	  fmt++;
+	}
+      else
+	for (; is_digit (*fmt); fmt++)
+	  op->_width = 10 * op->_width + to_digit (*fmt);
+
+      /* The precision.  */
+      op->_prec = -1;
+      if (*fmt == '.')
+	{
+	  fmt++;
+	  if (*fmt == '*')
+	    {
+	      op->_prec = PLAN_ARG;
+	      fmt++;
+	    }
+	  else
+	    for (op->_prec = 0; is_digit (*fmt); fmt++)
+	      op->_prec = 10 * op->_prec + to_digit (*fmt);
+	}
+
+      /* The length modifiers.  */
+      flag_chars = "hlL";
+      if ((cp = memchr (flag_chars, *fmt, 3)) != NULL)
+	{
+	  op->_flags |= (SHORTINT << (cp - flag_chars));
+	  fmt++;
+	}
+
+      /* The conversion specifier.  */
+      if (*fmt == '\0')
+	return 0;
+      op->_code = *fmt++;
+      op->_float = memchr ("efgEFG", op->_code, 6) != NULL;
+      op->_fixed = memchr ("rRkK", op->_code, 4) != NULL;
+    }
+
+  _REENT->_errno = EINVAL;
+  return -1;
+}
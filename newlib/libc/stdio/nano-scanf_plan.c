@@ -0,0 +1,138 @@
+/* Cut a format into the steps of a scanf_plan_t.  The parsing is that
+   of __SVFSCANF_R in nano-vfscanf.c, done once.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <newlib.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <scanf_plan.h>
+#include "local.h"
+#include "nano-vfscanf_local.h"
+
+int
+scanf_plan_compile (scanf_plan_t *plan,
+       const char *fmt0)
+{
+  struct __scanf_op *op;
+  const u_char *fmt = (const u_char *) fmt0, *cp;
+  const char *p, *lp;
+  char ccltab[256];
+  int c;
+
+  plan->_nops = 0;
+  while (plan->_nops < SCANF_PLAN_OPS)
+    {
+      op = &plan->_ops[plan->_nops++];
+
+      cp = fmt;
+      while (*fmt != '\0' && *fmt != '%')
+	fmt++;
+      if (fmt - cp > USHRT_MAX)
+	break;
+      op->_lit = (const char *) cp;
+      op->_litlen = fmt - cp;
+      op->_conv = '\0';
+      if (*fmt == '\0')
+	return 0;
+      fmt++;
+
+      op->_width = 0;
+      op->_flags = 0;
+      if (*fmt == '*')
+	{
+	  op->_flags |= SUPPRESS;
+	  fmt++;
+	}
+
+      for (; is_digit (*fmt); fmt++)
+	op->_width = 10 * op->_width + to_digit (*fmt);
+
+      /* The length modifiers.  */
+      lp = "hlL";
+      if ((p = memchr (lp, *fmt, 3)) != NULL)
+	{
+	  op->_flags |= (SHORT << (p - lp));
+	  fmt++;
+	}
+
+      c = *fmt++;
+      op->_conv = c;
+      op->_ccl = NULL;
+      switch (c)
+	{
+	case '%':
+	case 'n':
+	  break;
+
+	case 'p':
+	  op->_flags |= POINTER;
+	case 'x':
+	case 'X':
+	  op->_flags |= PFXOK;
+	  op->_base = 16;
+	  goto number;
+	case 'd':
+	case 'u':
+	  op->_base = 10;
+	  goto number;
+	case 'i':
+	  op->_base = 0;
+	  goto number;
+	case 'o':
+	  op->_base = 8;
+	number:
+	  op->_code = (c < 'o') ? CT_INT : CT_UINT;
+	  break;
+
+	case '[':
+	  /* The set is decoded again on each run, to spare the plan a
+	     table per %[; this one only finds where it ends.  */
+	  op->_ccl = (const char *) fmt;
+	  fmt = __sccl (ccltab, (u_char *) fmt);
+	  op->_flags |= NOSKIP;
+	  op->_code = CT_CCL;
+	  break;
+	case 'c':
+	  op->_flags |= NOSKIP;
+	  op->_code = CT_CHAR;
+	  break;
+	case 's':
+	  op->_code = CT_STRING;
+	  break;
+
+	/* scanf returns EOF for these, every time: say so at once.  */
+	case '\0':
+	  goto bad;
+
+#ifdef FLOATING_POINT
+	case 'e': case 'E':
+	case 'f': case 'F':
+	case 'g': case 'G':
+	  op->_code = CT_FLOAT;
+	  break;
+#endif
+#ifdef __FRACT_FBIT__
+	case 'r': case 'R':
+	case 'k': case 'K':
+	  op->_code = CT_FIXED;
+	  op->_base = c;
+	  break;
+#endif
+	default:
+	  op->_conv = 'd';
+	  op->_code = CT_INT;
+	  op->_base = 10;
+	  break;
+	}
+    }
+
+bad:
+  _REENT->_errno = EINVAL;
+  return -1;
+}
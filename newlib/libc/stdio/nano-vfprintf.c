@@ -167,6 +167,7 @@ static char *rcsid = "$Id$";
 #include "fvwrite.h"
 #include "vfieeefp.h"
 #include "nano-vfprintf_local.h"
+#include "nano-fixed_local.h"
 
 /* The __ssputs_r function is shared between all versions of vfprintf
    and vfwprintf.  */
@@ -237,6 +238,23 @@ err:
   fp->_flags |= __SERR;
   return EOF;
 }
+
+/* The sink of sprintf, snprintf and the other fixed buffers, which
+   have nothing to grow: one bounds check and a copy.  What does not fit
+   is dropped, as by __ssputs_r.  */
+int
+__ssputs_fixed_r (struct _reent *ptr,
+       FILE *fp,
+       const char *buf,
+       size_t len)
+{
+  if (len > (size_t) fp->_w)
+    len = fp->_w;
+  memcpy (fp->_p, buf, len);
+  fp->_w -= len;
+  fp->_p += len;
+  return 0;
+}
 /* __ssprint_r is the original implementation of __SPRINT.  In nano
    version formatted IO it is reimplemented as __ssputs_r for non-wide
    char output, but __ssprint_r cannot be discarded because it is used
@@ -506,6 +524,8 @@ _VFPRINTF_R (struct _reent *data,
 	}
       fp->_bf._size = 64;
     }
+  if (!(fp->_flags & (__SMBF | __SOPT)))
+    pfunc = __ssputs_fixed_r;
 #endif
 
   fmt = (char *)fmt0;
@@ -632,6 +652,22 @@ _VFPRINTF_R (struct _reent *data,
             n = _printf_float (data, &prt_data, fp, pfunc, &ap_copy);
 	}
       else
+#endif
+#ifdef __FRACT_FBIT__
+      if (memchr ("rRkK", prt_data.code, 4))
+	{
+	  /* Likewise the fixed-point argument if _printf_fixed is not
+	     linked.  */
+	  if (_printf_fixed == NULL)
+	    {
+	      FIXED_SELECT (prt_data.code, prt_data.flags, SHORTINT, LONGINT,
+			    SKIP_FIXED_ARG);
+	      n = 0;
+	    }
+	  else
+	    n = _printf_fixed (data, &prt_data, fp, pfunc, &ap_copy);
+	}
+      else
 #endif
 	n = _printf_i (data, &prt_data, fp, pfunc, &ap_copy);
 
@@ -0,0 +1,137 @@
+/* The ISO/IEC TR 18037 conversions %r, %R, %k and %K of the nano
+   formatted output, for the fixed-point types.  Like _printf_float,
+   _printf_fixed is only referred to weakly: a program gets it with
+   -u _printf_fixed, and without it the conversions print nothing.
+   The digits come from the bits of the value with integer arithmetic,
+   so neither the fixed-point support routines nor floating point are
+   pulled in, and the last one printed is rounded half up.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdarg.h>
+#include "local.h"
+#include "../stdlib/local.h"
+#include "nano-vfprintf_local.h"
+#include "nano-fixed_local.h"
+
+#ifdef __FRACT_FBIT__
+
+#if __ULFRACT_FBIT__ > __ULACCUM_FBIT__
+# define FX_MAXFBIT	__ULFRACT_FBIT__
+#else
+# define FX_MAXFBIT	__ULACCUM_FBIT__
+#endif
+
+/* Room for the integer part of any of the types.  */
+#define FX_INTDIG	20
+
+int
+_printf_fixed (struct _reent *data,
+	       struct _prt_data_t *pdata,
+	       FILE *fp,
+	       int (*pfunc)(struct _reent *, FILE *,
+			    const char *, size_t len),
+	       va_list *ap)
+{
+  /* The integer digits end at the point and the FBIT or fewer
+     fraction digits that can be nonzero follow it; any further digits
+     the precision asks for are zeros and are not stored.  */
+  char buf[FX_INTDIG + 1 + FX_MAXFBIT];
+  char *cp, *ep, *p;
+  __fx_bits_t bits, mag, frac, one, ip;
+  int realsz, ndig, nzero, n;
+  int fbit, nbits, is_signed;
+
+#define FX_GET(type, ibit_, fbit_, signed_)	\
+  do						\
+    {						\
+      type v_ = GET_ARG (N, *ap, type);		\
+      bits = __fx_load (&v_, sizeof (v_));	\
+      nbits = (ibit_) + (fbit_);		\
+      fbit = (fbit_);				\
+      is_signed = (signed_);			\
+    }						\
+  while (0)
+
+  FIXED_SELECT (pdata->code, pdata->flags, SHORTINT, LONGINT, FX_GET);
+
+  mag = bits & FX_MASK (nbits);
+  if (is_signed && ((bits >> nbits) & 1))
+    {
+      /* Two's complement over the NBITS + 1 bits of the type; the
+	 most negative value has magnitude 2^NBITS.  */
+      mag = (FX_MASK (nbits) - mag) + 1;
+      pdata->l_buf[0] = '-';
+    }
+
+  /* With no precision, enough digits to tell apart any two values,
+     ceil (FBIT * log10 (2)).  */
+  if (pdata->prec < 0)
+    pdata->prec = (fbit * 1233 + 4095) >> 12;
+  ndig = pdata->prec < fbit ? pdata->prec : fbit;
+  nzero = pdata->prec - ndig;
+
+  one = (__fx_bits_t) 1 << fbit;
+  ip = mag >> fbit;
+  frac = mag & (one - 1);
+
+  cp = ep = buf + FX_INTDIG + 1;
+  for (n = 0; n < ndig; n++)
+    {
+      frac *= 10;
+      *ep++ = to_char ((int) (frac >> fbit));
+      frac &= one - 1;
+    }
+
+  /* Round half up: a value exactly halfway between two of the
+     printed ones goes to the one of greater magnitude, not to the even
+     one as %f does.  FBIT digits are exact, so this only happens when
+     the precision is shorter than that.  */
+  if (frac >= (one >> 1))
+    for (p = ep; ; )
+      {
+	if (p == cp)
+	  {
+	    ip++;
+	    break;
+	  }
+	if (*--p != '9')
+	  {
+	    ++*p;
+	    break;
+	  }
+	*p = '0';
+      }
+
+  if (pdata->prec || (pdata->flags & ALT))
+    *--cp = '.';
+  /* __u32toa and __u64toa multiply by reciprocals instead of
+     dividing.  */
+  if (ip <= 0xffffffffUL)
+    cp = __u32toa (cp, (__uint32_t) ip);
+  else
+    cp = __u64toa (cp, (__uint64_t) ip);
+
+  pdata->size = ep - cp + nzero;
+
+  /* Output.  */
+  n = _printf_common (data, pdata, &realsz, fp, pfunc);
+  if (n == -1)
+    goto error;
+
+  PRINT (cp, ep - cp);
+  PAD (nzero, pdata->zero);
+  /* Left-adjusting padding (always blank).  */
+  if (pdata->flags & LADJUST)
+    PAD (pdata->width - realsz, pdata->blank);
+
+  return (pdata->width > realsz ? pdata->width : realsz);
+error:
+  return -1;
+}
+
+#endif /* __FRACT_FBIT__ */
@@ -51,7 +51,7 @@
 
 char *__cvt (struct _reent *data, _PRINTF_FLOAT_TYPE value, int ndigits,
 	     int flags, char *sign, int *decpt, int ch, int *length,
-	     char *buf);
+	     int *zeros, char *buf);
 
 int __exponent (char *p0, int exp, int fmtch);
 
@@ -61,16 +61,23 @@ int __exponent (char *p0, int exp, int fmtch);
    with no decimal point, using NDIGITS precision and FLAGS as guides
    to whether trailing zeros must be included.  Set *SIGN to nonzero
    if VALUE was negative.  Set *DECPT to the exponent plus one.  Set
-   *LENGTH to the length of the returned string.  CH must be one of
-   [aAeEfFgG]; if it is [aA], then the return string lives in BUF,
-   otherwise the return value shares the mprec reentrant storage.  */
+   *LENGTH to the length of the digit string, of which the last *ZEROS
+   are zeros that are not stored.  CH must be one of [eEfFgG].  A
+   VALUE that is a float is converted into BUF, of FCVT_MAXDIG + 1
+   bytes; otherwise the return value shares the mprec reentrant
+   storage.  */
 char *
 __cvt (struct _reent *data, _PRINTF_FLOAT_TYPE value, int ndigits, int flags,
-       char *sign, int *decpt, int ch, int *length, char *buf)
+       char *sign, int *decpt, int ch, int *length, int *zeros, char *buf)
 {
   int mode, dsgn;
   char *digits, *bp, *rve;
   union double_union tmp;
+  union
+  {
+    float f;
+    uint32_t i;
+  } fv;
 
   tmp.d = value;
   /* This will check for "< 0" and "-0.0".  */
@@ -99,9 +106,23 @@ __cvt (struct _reent *data, _PRINTF_FLOAT_TYPE value, int ndigits, int flags,
       mode = 2;
     }
 
-  digits = _DTOA_R (data, value, mode, ndigits, decpt, &dsgn, &rve);
+  /* With a 32-bit double every value is a float, and _dtoa_r is not
+     needed.  */
+  fv.f = (float) value;
+#if DBL_MANT_DIG > FLT_MANT_DIG
+  if (fv.f == value)
+#endif
+    {
+      digits = buf;
+      rve = buf + __cvt_float (fv.i, ndigits, mode == 3, decpt, buf);
+    }
+#if DBL_MANT_DIG > FLT_MANT_DIG
+  else
+    digits = _DTOA_R (data, value, mode, ndigits, decpt, &dsgn, &rve);
+#endif
 
-  /* Print trailing zeros.  */
+  /* Count the trailing zeros.  */
+  *zeros = 0;
   if ((ch != 'g' && ch != 'G') || flags & ALT)
     {
       bp = digits + ndigits;
@@ -113,11 +134,11 @@ __cvt (struct _reent *data, _PRINTF_FLOAT_TYPE value, int ndigits, int flags,
 	}
       /* Kludge for __dtoa irregularity.  */
       if (value == 0)
-	rve = bp;
-      while (rve < bp)
-	*rve++ = '0';
+	rve = digits + 1;
+      if (rve < bp)
+	*zeros = bp - rve;
     }
-  *length = rve - digits;
+  *length = rve - digits + *zeros;
   return (digits);
 }
 
@@ -170,7 +191,7 @@ _printf_float (struct _reent *data,
 {
 #define _fpvalue (pdata->_double_)
 
-  char *decimal_point = _localeconv_r (data)->decimal_point;
+  char *decimal_point = __DECIMAL_POINT (data);
   size_t decp_len = strlen (decimal_point);
   /* Temporary negative sign for floats.  */
   char softsign;
@@ -180,6 +201,9 @@ _printf_float (struct _reent *data,
   int expsize = 0;
   /* Actual number of digits returned by cvt.  */
   int ndig = 0;
+  /* How many of them are zeros that cvt did not store.  */
+  int nzero = 0;
+  char buf[FCVT_MAXDIG + 1];
   char *cp;
   int n;
   /* Field size expanded by dprec(not for _printf_float).  */
@@ -237,7 +261,7 @@ _printf_float (struct _reent *data,
   pdata->flags |= FPT;
 
   cp = __cvt (data, _fpvalue, pdata->prec, pdata->flags, &softsign,
-	      &expt, code, &ndig, cp);
+	      &expt, code, &ndig, &nzero, buf);
 
   if (code == 'g' || code == 'G')
     {
@@ -317,17 +341,19 @@ print_float:
 		{
 		  PRINT (decimal_point, decp_len);
 		  PAD (-expt, pdata->zero);
-		  PRINT (cp, ndig);
+		  PRINTANDPAD (cp, cp + ndig - nzero, ndig, pdata->zero);
 		}
 	    }
 	  else
 	    {
 	      char *convbuf = cp;
-	      PRINTANDPAD (cp, convbuf + ndig, pdata->lead, pdata->zero);
+	      PRINTANDPAD (cp, convbuf + ndig - nzero, pdata->lead,
+			   pdata->zero);
 	      cp += pdata->lead;
 	      if (expt < ndig || pdata->flags & ALT)
 		PRINT (decimal_point, decp_len);
-	      PRINTANDPAD (cp, convbuf + ndig, ndig - expt, pdata->zero);
+	      PRINTANDPAD (cp, convbuf + ndig - nzero, ndig - expt,
+			   pdata->zero);
 	    }
 	}
       else
@@ -340,7 +366,8 @@ print_float:
 	      PRINT (decimal_point, decp_len);
 	      if (_fpvalue)
 		{
-		  PRINT (cp, ndig - 1);
+		  PRINTANDPAD (cp, cp + ndig - nzero - 1, ndig - 1,
+			       pdata->zero);
 		}
 	      /* "0.[0..]".  */
 	      else
@@ -104,6 +104,37 @@ _printf_common (struct _reent *data,
 error:
   return -1;
 }
+#if UINT_MAX < ULONG_MAX
+/* Write the digits of U in BASE, 8 or 16, so that they end just before
+   CP and return the first of them.  */
+static char *
+__uitoa (char *cp,
+	 u_int u,
+	 int base,
+	 const char *xdigs)
+{
+  if (base == 16)
+    {
+      do
+	{
+	  *--cp = xdigs[u & 15];
+	  u >>= 4;
+	}
+      while (u);
+    }
+  else
+    {
+      do
+	{
+	  *--cp = (u & 7) + '0';
+	  u >>= 3;
+	}
+      while (u);
+    }
+  return cp;
+}
+#endif
+
 int
 _printf_i (struct _reent *data, struct _prt_data_t *pdata, FILE *fp,
 	   int (*pfunc)(struct _reent *, FILE *, const char *, size_t len),
@@ -186,6 +217,19 @@ number:
        */
       if (_uquad != 0 || pdata->prec != 0)
 	{
+	  /* Decimal goes through __u32toa, which multiplies by
+	     reciprocals instead of dividing.  */
+	  if (base == 10 && _uquad <= 0xffffffffUL)
+	    cp = __u32toa (cp, (__uint32_t) _uquad);
+	  else
+#if UINT_MAX < ULONG_MAX
+	  /* Where int is narrower than long, a value that fits in an
+	     int is converted with native arithmetic instead of a long
+	     division per digit.  */
+	  if (_uquad <= UINT_MAX)
+	    cp = __uitoa (cp, (u_int) _uquad, base, xdigs);
+	  else
+#endif
 	  do
 	    {
 	      *--cp = xdigs[_uquad % base];
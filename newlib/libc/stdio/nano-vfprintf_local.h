@@ -143,6 +143,10 @@ typedef short *  short_ptr_t;
 /* Define as 0, to make SARG and UARG occupy fewer instructions.  */
 # define CHARINT	0
 
+/* Width or precision of a printf_plan_t step taken from the
+   arguments, for `*'.  */
+#define PLAN_ARG	(-2)
+
 /* Macros to support positional arguments.  */
 #define GET_ARG(n, ap, type) (va_arg ((ap), type))
 
@@ -209,6 +213,11 @@ struct _prt_data_t
 #endif
 };
 
+/* The sink of string output to a buffer that does not grow, see
+   nano-vfprintf.c.  */
+extern int
+__ssputs_fixed_r (struct _reent *, FILE *, const char *, size_t);
+
 extern int
 _printf_common (struct _reent *data,
 		struct _prt_data_t *pdata,
@@ -231,4 +240,20 @@ _printf_float (struct _reent *data,
 	       int (*pfunc)(struct _reent *, FILE *,
 			    const char *, size_t len),
 	       va_list *ap) _ATTRIBUTE((__weak__));
+
+#ifdef __FRACT_FBIT__
+/* Likewise _printf_fixed, for the fixed-point conversions.  */
+extern int
+_printf_fixed (struct _reent *data,
+	       struct _prt_data_t *pdata,
+	       FILE *fp,
+	       int (*pfunc)(struct _reent *, FILE *,
+			    const char *, size_t len),
+	       va_list *ap) _ATTRIBUTE((__weak__));
+
+/* For FIXED_SELECT in nano-fixed_local.h: consume the argument of a
+   fixed-point conversion when _printf_fixed is not linked.  */
+#define SKIP_FIXED_ARG(type, ibit, fbit, is_signed) \
+  do { (void) GET_ARG (N, ap_copy, type); } while (0)
+#endif
 #endif
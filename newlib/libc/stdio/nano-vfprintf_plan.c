@@ -0,0 +1,225 @@
+/* Run a printf_plan_t.  This is the loop of _VFPRINTF_R in
+   nano-vfprintf.c with the parsing taken out: each step of the plan
+   already holds what the format would have been decoded into.  Built
+   twice, like nano-vfprintf.c, the STRING_ONLY copy backing
+   snprintf_plan.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <printf_plan.h>
+#include "local.h"
+#include "fvwrite.h"
+#include "nano-vfprintf_local.h"
+#include "nano-fixed_local.h"
+
+#ifdef STRING_ONLY
+# define _VFPRINTF_PLAN_R _svfprintf_plan_r
+# define __SPRINT __ssputs_r
+#else
+# define _VFPRINTF_PLAN_R _vfprintf_plan_r
+# define __SPRINT __sfputs_r
+#endif
+
+int __SPRINT (struct _reent *, FILE *, const char *, size_t);
+int _VFPRINTF_PLAN_R (struct _reent *, FILE *, const printf_plan_t *,
+		      va_list);
+
+int
+_VFPRINTF_PLAN_R (struct _reent *data,
+       FILE * fp,
+       const printf_plan_t *plan,
+       va_list ap)
+{
+  const struct __printf_op *op, *end;
+  register int n;
+  struct _prt_data_t prt_data;
+  va_list ap_copy;
+
+  /* Output function pointer.  */
+  int (*pfunc)(struct _reent *, FILE *, const char *, size_t len);
+
+  pfunc = __SPRINT;
+
+#ifndef STRING_ONLY
+  /* Initialize std streams if not dealing with sprintf family.  */
+  CHECK_INIT (data, fp);
+  _newlib_flockfile_start (fp);
+
+  if (cantwrite (data, fp))
+    {
+      _newlib_flockfile_exit (fp);
+      return (EOF);
+    }
+#else
+  if (!(fp->_flags & (__SMBF | __SOPT)))
+    pfunc = __ssputs_fixed_r;
+#endif
+
+  prt_data.ret = 0;
+  prt_data.blank = ' ';
+  prt_data.zero = '0';
+
+  va_copy (ap_copy, ap);
+
+  for (op = plan->_ops, end = op + plan->_nops; op < end; op++)
+    {
+      if (op->_litlen != 0)
+	{
+	  PRINT (op->_lit, op->_litlen);
+	  prt_data.ret += op->_litlen;
+	}
+      if (op->_code == '\0')
+	break;
+
+      prt_data.flags = op->_flags;
+      prt_data.width = op->_width;
+      prt_data.prec = op->_prec;
+      prt_data.dprec = 0;
+      prt_data.l_buf[0] = op->_sign;
+#ifdef FLOATING_POINT
+      prt_data.lead = 0;
+#endif
+      if (prt_data.width == PLAN_ARG)
+	{
+	  prt_data.width = GET_ARG (n, ap_copy, int);
+	  if (prt_data.width < 0)
+	    {
+	      prt_data.width = -prt_data.width;
+	      prt_data.flags |= LADJUST;
+	    }
+	}
+      if (prt_data.prec == PLAN_ARG)
+	{
+	  prt_data.prec = GET_ARG (n, ap_copy, int);
+	  if (prt_data.prec < 0)
+	    prt_data.prec = -1;
+	}
+      prt_data.code = op->_code;
+
+#ifdef FLOATING_POINT
+      if (op->_float)
+	{
+	  /* Consume floating point argument if _printf_float is not
+	     linked.  */
+	  if (_printf_float == NULL)
+	    {
+	      if (prt_data.flags & LONGDBL)
+		GET_ARG (N, ap_copy, _LONG_DOUBLE);
+	      else
+		GET_ARG (N, ap_copy, double);
+	      continue;
+	    }
+	  n = _printf_float (data, &prt_data, fp, pfunc, &ap_copy);
+	}
+      else
+#endif
+#ifdef __FRACT_FBIT__
+      if (op->_fixed)
+	{
+	  /* Likewise the fixed-point argument if _printf_fixed is not
+	     linked.  */
+	  if (_printf_fixed == NULL)
+	    {
+	      FIXED_SELECT (prt_data.code, prt_data.flags, SHORTINT, LONGINT,
+			    SKIP_FIXED_ARG);
+	      continue;
+	    }
+	  n = _printf_fixed (data, &prt_data, fp, pfunc, &ap_copy);
+	}
+      else
+#endif
+	n = _printf_i (data, &prt_data, fp, pfunc, &ap_copy);
+
+      if (n == -1)
+	goto error;
+
+      prt_data.ret += n;
+    }
+error:
+#ifndef STRING_ONLY
+  _newlib_flockfile_end (fp);
+#endif
+  va_end (ap_copy);
+  return (__sferror (fp) ? EOF : prt_data.ret);
+}
+
+#ifdef STRING_ONLY
+int
+_snprintf_plan_r (struct _reent *ptr,
+       char *str,
+       size_t size,
+       const printf_plan_t *plan, ...)
+{
+  int ret;
+  va_list ap;
+  FILE f;
+
+  if (size > INT_MAX)
+    {
+      ptr->_errno = EOVERFLOW;
+      return EOF;
+    }
+  f._flags = __SWR | __SSTR;
+  f._bf._base = f._p = (unsigned char *) str;
+  f._bf._size = f._w = (size > 0 ? size - 1 : 0);
+  f._file = -1;  /* No file. */
+  va_start (ap, plan);
+  ret = _svfprintf_plan_r (ptr, &f, plan, ap);
+  va_end (ap);
+  if (ret < EOF)
+    ptr->_errno = EOVERFLOW;
+  if (size > 0)
+    *f._p = 0;
+  return (ret);
+}
+
+#ifndef _REENT_ONLY
+int
+snprintf_plan (char *str,
+       size_t size,
+       const printf_plan_t *plan, ...)
+{
+  int ret;
+  va_list ap;
+  FILE f;
+  struct _reent *ptr = _REENT;
+
+  if (size > INT_MAX)
+    {
+      ptr->_errno = EOVERFLOW;
+      return EOF;
+    }
+  f._flags = __SWR | __SSTR;
+  f._bf._base = f._p = (unsigned char *) str;
+  f._bf._size = f._w = (size > 0 ? size - 1 : 0);
+  f._file = -1;  /* No file. */
+  va_start (ap, plan);
+  ret = _svfprintf_plan_r (ptr, &f, plan, ap);
+  va_end (ap);
+  if (ret < EOF)
+    ptr->_errno = EOVERFLOW;
+  if (size > 0)
+    *f._p = 0;
+  return (ret);
+}
+#endif /* !_REENT_ONLY */
+
+#else /* !STRING_ONLY */
+
+#ifndef _REENT_ONLY
+int
+vfprintf_plan (FILE * fp,
+       const printf_plan_t *plan,
+       va_list ap)
+{
+  return _vfprintf_plan_r (_REENT, fp, plan, ap);
+}
+#endif /* !_REENT_ONLY */
+
+#endif /* !STRING_ONLY */
@@ -193,7 +193,7 @@ _sungetc_r (struct _reent *data,
 
   if (HASUB (fp))
     {
-      if (fp->_r >= fp->_ub._size && __submore (data, fp))
+      if (fp->_r >= _UB (fp)._size && __submore (data, fp))
         return EOF;
 
       *--fp->_p = c;
@@ -213,12 +213,14 @@ _sungetc_r (struct _reent *data,
 
   /* Create an ungetc buffer.
      Initially, we will use the `reserve' buffer.  */
-  fp->_ur = fp->_r;
-  fp->_up = fp->_p;
-  fp->_ub._base = fp->_ubuf;
-  fp->_ub._size = sizeof (fp->_ubuf);
-  fp->_ubuf[sizeof (fp->_ubuf) - 1] = c;
-  fp->_p = &fp->_ubuf[sizeof (fp->_ubuf) - 1];
+  if (!MAKEUB (data, fp))
+    return EOF;
+  _UR (fp) = fp->_r;
+  _UP (fp) = fp->_p;
+  _UB (fp)._base = _UBUF (fp);
+  _UB (fp)._size = sizeof (_UBUF (fp));
+  _UBUF (fp)[sizeof (_UBUF (fp)) - 1] = c;
+  fp->_p = &_UBUF (fp)[sizeof (_UBUF (fp)) - 1];
   fp->_r = 1;
   return c;
 }
@@ -233,9 +235,9 @@ __ssrefill_r (struct _reent * ptr,
   if (HASUB (fp))
     {
       FREEUB (ptr, fp);
-      if ((fp->_r = fp->_ur) != 0)
+      if ((fp->_r = _UR (fp)) != 0)
         {
-          fp->_p = fp->_up;
+          fp->_p = _UP (fp);
 	  return 0;
         }
     }
@@ -394,6 +396,14 @@ __SVFSCANF_R (struct _reent *rptr,
 	case 'g': case 'G':
 	  scan_data.code = CT_FLOAT;
 	  break;
+#endif
+#ifdef __FRACT_FBIT__
+	case 'r': case 'R':
+	case 'k': case 'K':
+	  scan_data.code = CT_FIXED;
+	  /* Which of the four is told to _scanf_fixed in base.  */
+	  scan_data.base = c;
+	  break;
 #endif
 	default:		/* compat.  */
 	  scan_data.code = CT_INT;
@@ -425,7 +435,19 @@ __SVFSCANF_R (struct _reent *rptr,
       if (scan_data.code < CT_INT)
 	ret = _scanf_chars (rptr, &scan_data, fp, &ap_copy);
       else if (scan_data.code < CT_FLOAT)
+#ifdef STRING_ONLY
+	ret = HASUB (fp) ? _scanf_i (rptr, &scan_data, fp, &ap_copy)
+			 : _sscanf_i (rptr, &scan_data, fp, &ap_copy);
+#else
 	ret = _scanf_i (rptr, &scan_data, fp, &ap_copy);
+#endif
+#ifdef __FRACT_FBIT__
+      else if (scan_data.code == CT_FIXED)
+	{
+	  if (_scanf_fixed)
+	    ret = _scanf_fixed (rptr, &scan_data, fp, &ap_copy);
+	}
+#endif
 #ifdef FLOATING_POINT
       else if (_scanf_float)
 	ret = _scanf_float (rptr, &scan_data, fp, &ap_copy);
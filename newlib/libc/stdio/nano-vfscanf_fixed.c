@@ -0,0 +1,143 @@
+/* The ISO/IEC TR 18037 conversions %r, %R, %k and %K of the nano
+   formatted input, for the fixed-point types.  Like _scanf_float,
+   _scanf_fixed is only referred to weakly: a program gets it with
+   -u _scanf_fixed.  The number is taken as [sign] digits [. digits]
+   and rounded to the nearest value of the type with integer
+   arithmetic, saturating at the ends of its range.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <newlib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdarg.h>
+#include "local.h"
+#include "nano-vfscanf_local.h"
+#include "nano-fixed_local.h"
+
+#ifdef __FRACT_FBIT__
+
+int
+_scanf_fixed (struct _reent *rptr,
+	      struct _scan_data_t *pdata,
+	      FILE *fp, va_list *ap)
+{
+  int c, neg = 0;
+  int ibit, fbit, nbits, is_signed;
+  char *p = pdata->buf, *fdig = NULL;
+  size_t width;
+  __fx_bits_t ip = 0, frac, max, bits;
+
+#define FX_PARAMS(type, ibit_, fbit_, signed_)	\
+  do						\
+    {						\
+      ibit = (ibit_);				\
+      fbit = (fbit_);				\
+      is_signed = (signed_);			\
+    }						\
+  while (0)
+
+  FIXED_SELECT (pdata->base, pdata->flags, SHORT, LONG, FX_PARAMS);
+  nbits = ibit + fbit;
+
+  width = pdata->width == 0 ? (size_t) -1 : pdata->width;
+  pdata->flags |= SIGNOK | NDIGITS | DPTOK;
+  for (; width; width--)
+    {
+      c = *fp->_p;
+      if (is_digit (c))
+	{
+	  pdata->flags &= ~(SIGNOK | NDIGITS);
+	  if (pdata->flags & DPTOK)
+	    {
+	      /* Past 2^IBIT the value can only saturate.  */
+	      if (ip <= ((__fx_bits_t) 1 << ibit))
+		ip = 10 * ip + to_digit (c);
+	    }
+	  else
+	    {
+	      /* The fraction digits are kept in buf, after any sign and
+		 point; the ones that do not fit are far below the
+		 resolution of the type.  */
+	      if (fdig == NULL)
+		fdig = p;
+	      if (p < pdata->buf + BUF)
+		*p++ = c;
+	    }
+	}
+      else if ((c == '+' || c == '-') && (pdata->flags & SIGNOK))
+	{
+	  pdata->flags &= ~SIGNOK;
+	  neg = c == '-';
+	  *p++ = c;
+	}
+      else if (c == '.' && (pdata->flags & DPTOK))
+	{
+	  pdata->flags &= ~(SIGNOK | DPTOK);
+	  if (pdata->flags & NDIGITS)
+	    *p++ = c;
+	}
+      else
+	break;
+
+      ++pdata->nread;
+      if (--fp->_r > 0)
+	fp->_p++;
+      else if (pdata->pfn_refill (rptr, fp))
+	/* "EOF".  */
+	break;
+    }
+
+  /* No digits: give back the sign and point.  */
+  if (pdata->flags & NDIGITS)
+    {
+      while (p > pdata->buf)
+	{
+	  pdata->pfn_ungetc (rptr, *--p, fp); /* "[-+.]".  */
+	  --pdata->nread;
+	}
+      return MATCH_FAILURE;
+    }
+
+  if ((pdata->flags & SUPPRESS) == 0)
+    {
+      /* The most negative value of a signed type is one more than the
+	 most positive.  */
+      max = FX_MASK (nbits) + (neg && is_signed);
+      /* The fraction times 2^(FBIT + 1), from the last digit to the
+	 first: the quotients are truncated, but the floor of a floor
+	 divided by 10 is the floor of the whole, so this is exact to
+	 below the rounding bit.  */
+      frac = 0;
+      if (fdig != NULL)
+	while (p > fdig)
+	  frac = (frac + ((__fx_bits_t) to_digit (*--p) << (fbit + 1))) / 10;
+      frac = (frac + 1) >> 1;
+      if (ip > (max >> fbit))
+	bits = max;
+      else
+	{
+	  bits = (ip << fbit) + frac;
+	  if (bits < frac || bits > max)
+	    bits = max;
+	}
+      if (neg)
+	bits = is_signed ? -bits : 0;
+
+#define FX_PUT(type, ibit_, fbit_, signed_)		\
+  do							\
+    {							\
+      type *vp_ = GET_ARG (N, *ap, type *);		\
+      __fx_store (vp_, sizeof (*vp_), bits);		\
+    }							\
+  while (0)
+
+      FIXED_SELECT (pdata->base, pdata->flags, SHORT, LONG, FX_PUT);
+      pdata->nassigned++;
+    }
+  return 0;
+}
+
+#endif /* __FRACT_FBIT__ */
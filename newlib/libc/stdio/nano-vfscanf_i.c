@@ -230,3 +230,100 @@ match_end:
   return 0;
 }
 
+
+/* _scanf_i for a string with nothing pushed back, so that the rest of
+   the input is all at fp->_p: the number is converted where it lies,
+   without the copy to pdata->buf, the refills and strtol.  The result,
+   errno on overflow included, is that of _scanf_i.  */
+int
+_sscanf_i (struct _reent *rptr,
+	   struct _scan_data_t *pdata,
+	   FILE *fp, va_list *ap)
+{
+  const u_char *s = fp->_p, *end;
+  u_long acc = 0, cutoff, limit;
+  unsigned int base = pdata->base, d, cutlim;
+  int neg = 0, any = 0, over = 0;
+
+  end = s + fp->_r;
+  if (pdata->width != 0 && pdata->width < (size_t) fp->_r)
+    end = s + pdata->width;
+
+  if (*s == '+' || *s == '-')
+    neg = *s++ == '-';
+  if (s < end && *s == '0')
+    {
+      any = 1;
+      s++;
+      /* The x of a "0x" not followed by a digit is left unread.  */
+      if ((base == 0 || base == 16) && s + 1 < end
+	  && (*s == 'x' || *s == 'X') && isxdigit (s[1]))
+	{
+	  base = 16;
+	  s++;
+	}
+      else if (base == 0)
+	base = 8;
+    }
+  if (base == 0)
+    base = 10;
+
+  cutoff = ULONG_MAX / base;
+  cutlim = ULONG_MAX % base;
+  for (; s < end; s++)
+    {
+      d = *s - '0';
+      if (d > 9)
+	{
+	  d = (*s | 0x20) - 'a';
+	  d = d < 6 ? d + 10 : base;
+	}
+      if (d >= base)
+	break;
+      any = 1;
+      if (acc > cutoff || (acc == cutoff && d > cutlim))
+	over = 1;
+      else
+	acc = acc * base + d;
+    }
+  /* A sign alone is no good, and nothing is read.  */
+  if (!any)
+    return MATCH_FAILURE;
+
+  if ((pdata->flags & SUPPRESS) == 0)
+    {
+      if (pdata->code == CT_INT)
+	{
+	  limit = neg ? (u_long) LONG_MAX + 1 : (u_long) LONG_MAX;
+	  if (over || acc > limit)
+	    {
+	      acc = neg ? (u_long) LONG_MIN : (u_long) LONG_MAX;
+	      rptr->_errno = ERANGE;
+	    }
+	  else if (neg)
+	    acc = -acc;
+	}
+      else if (over)
+	{
+	  acc = ULONG_MAX;
+	  rptr->_errno = ERANGE;
+	}
+      else if (neg)
+	acc = -acc;
+
+      if (pdata->flags & POINTER)
+	*GET_ARG (N, *ap, void **) = (void *) (uintptr_t) acc;
+      else if (pdata->flags & SHORT)
+	*GET_ARG (N, *ap, short *) = acc;
+      else if (pdata->flags & LONG)
+	*GET_ARG (N, *ap, long *) = acc;
+      else
+	*GET_ARG (N, *ap, int *) = acc;
+
+      pdata->nassigned++;
+    }
+  pdata->nread += s - fp->_p;
+  fp->_r -= s - fp->_p;
+  fp->_p = (u_char *) s;
+  return 0;
+}
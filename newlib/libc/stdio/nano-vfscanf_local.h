@@ -132,6 +132,7 @@
 #define	CT_INT		3	/* Integer, i.e., strtol.  */
 #define	CT_UINT		4	/* Unsigned integer, i.e., strtoul.  */
 #define	CT_FLOAT	5	/* Floating, i.e., strtod.  */
+#define	CT_FIXED	6	/* Fixed-point, %r %R %k %K.  */
 
 #define u_char unsigned char
 #define u_long unsigned long
@@ -168,6 +169,10 @@ extern int
 _scanf_i (struct _reent *rptr,
 	  struct _scan_data_t *pdata,
 	  FILE *fp, va_list *ap);
+extern int
+_sscanf_i (struct _reent *rptr,
+	   struct _scan_data_t *pdata,
+	   FILE *fp, va_list *ap);
 /* Make _scanf_float weak symbol, so it won't be linked in if target program
    does not need it.  */
 extern int
@@ -175,4 +180,12 @@ _scanf_float (struct _reent *rptr,
 	      struct _scan_data_t *pdata,
 	      FILE *fp, va_list *ap) _ATTRIBUTE((__weak__));
 
+#ifdef __FRACT_FBIT__
+/* Likewise _scanf_fixed, for the fixed-point conversions.  */
+extern int
+_scanf_fixed (struct _reent *rptr,
+	      struct _scan_data_t *pdata,
+	      FILE *fp, va_list *ap) _ATTRIBUTE((__weak__));
+#endif
+
 #endif
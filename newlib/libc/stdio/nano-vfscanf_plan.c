@@ -0,0 +1,250 @@
+/* Run a scanf_plan_t.  This is the loop of __SVFSCANF_R in
+   nano-vfscanf.c with the parsing taken out: each step of the plan
+   already holds what the format would have been decoded into.  Built
+   twice, like nano-vfscanf.c, the STRING_ONLY copy backing
+   sscanf_plan.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <newlib.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <scanf_plan.h>
+#include "local.h"
+#include "nano-vfscanf_local.h"
+
+#ifdef STRING_ONLY
+# define __SVFSCANF_PLAN_R __ssvfscanf_plan_r
+#else
+# define __SVFSCANF_PLAN_R __svfscanf_plan_r
+#endif
+
+int _sungetc_r (struct _reent *, int, FILE *);
+int __ssrefill_r (struct _reent *, FILE *);
+int __SVFSCANF_PLAN_R (struct _reent *, FILE *, const scanf_plan_t *,
+		       va_list);
+
+int
+__SVFSCANF_PLAN_R (struct _reent *rptr,
+       FILE *fp,
+       const scanf_plan_t *plan,
+       va_list ap)
+{
+  const struct __scanf_op *op, *end;
+  const u_char *lit, *lend;
+  char ccltab[256];
+  va_list ap_copy;
+  int ret;
+
+  struct _scan_data_t scan_data;
+
+  _newlib_flockfile_start (fp);
+
+  scan_data.nassigned = 0;
+  scan_data.nread = 0;
+  scan_data.ccltab = ccltab;
+  scan_data.pfn_ungetc = _ungetc_r;
+  scan_data.pfn_refill = __srefill_r;
+
+  va_copy (ap_copy, ap);
+
+  for (op = plan->_ops, end = op + plan->_nops; op < end; op++)
+    {
+      for (lit = (const u_char *) op->_lit, lend = lit + op->_litlen;
+	   lit < lend; lit++)
+	{
+	  if (isspace (*lit))
+	    {
+	      while ((fp->_r > 0 || !scan_data.pfn_refill (rptr, fp))
+		     && isspace (*fp->_p))
+		{
+		  scan_data.nread++;
+		  fp->_r--;
+		  fp->_p++;
+		}
+	      continue;
+	    }
+	  if ((fp->_r <= 0 && scan_data.pfn_refill (rptr, fp)))
+	    goto input_failure;
+	  if (*fp->_p != *lit)
+	    goto match_failure;
+	  fp->_r--, fp->_p++;
+	  scan_data.nread++;
+	}
+
+      switch (op->_conv)
+	{
+	case '\0':
+	  goto all_done;
+
+	case '%':
+	  if ((fp->_r <= 0 && scan_data.pfn_refill (rptr, fp)))
+	    goto input_failure;
+	  if (*fp->_p != '%')
+	    goto match_failure;
+	  fp->_r--, fp->_p++;
+	  scan_data.nread++;
+	  continue;
+
+	case 'n':
+	  if (op->_flags & SUPPRESS)	/* ???  */
+	    continue;
+
+	  if (op->_flags & SHORT)
+	    *GET_ARG (N, ap_copy, short *) = scan_data.nread;
+	  else if (op->_flags & LONG)
+	    *GET_ARG (N, ap_copy, long *) = scan_data.nread;
+	  else
+	    *GET_ARG (N, ap_copy, int *) = scan_data.nread;
+	  continue;
+
+	case '[':
+	  __sccl (ccltab, (u_char *) op->_ccl);
+	  break;
+	}
+
+      scan_data.width = op->_width;
+      scan_data.flags = op->_flags;
+      scan_data.base = op->_base;
+      scan_data.code = op->_code;
+
+      /* We have a conversion that requires input.  */
+      if ((fp->_r <= 0 && scan_data.pfn_refill (rptr, fp)))
+	goto input_failure;
+
+      /* Consume leading white space, except for formats that
+	 suppress this.  */
+      if ((scan_data.flags & NOSKIP) == 0)
+	{
+	  while (isspace (*fp->_p))
+	    {
+	      scan_data.nread++;
+	      if (--fp->_r > 0)
+		fp->_p++;
+	      else if (scan_data.pfn_refill (rptr, fp))
+		goto input_failure;
+	    }
+	}
+      ret = 0;
+      if (scan_data.code < CT_INT)
+	ret = _scanf_chars (rptr, &scan_data, fp, &ap_copy);
+      else if (scan_data.code < CT_FLOAT)
+#ifdef STRING_ONLY
+	ret = HASUB (fp) ? _scanf_i (rptr, &scan_data, fp, &ap_copy)
+			 : _sscanf_i (rptr, &scan_data, fp, &ap_copy);
+#else
+	ret = _scanf_i (rptr, &scan_data, fp, &ap_copy);
+#endif
+#ifdef __FRACT_FBIT__
+      else if (scan_data.code == CT_FIXED)
+	{
+	  if (_scanf_fixed)
+	    ret = _scanf_fixed (rptr, &scan_data, fp, &ap_copy);
+	}
+#endif
+#ifdef FLOATING_POINT
+      else if (_scanf_float)
+	ret = _scanf_float (rptr, &scan_data, fp, &ap_copy);
+#endif
+
+      if (ret == MATCH_FAILURE)
+	goto match_failure;
+      else if (ret == INPUT_FAILURE)
+	goto input_failure;
+    }
+  goto all_done;
+
+input_failure:
+  _newlib_flockfile_exit (fp);
+  va_end (ap_copy);
+  return scan_data.nassigned && !(fp->_flags & __SERR) ? scan_data.nassigned
+						       : EOF;
+match_failure:
+all_done:
+  _newlib_flockfile_end (fp);
+  va_end (ap_copy);
+  return scan_data.nassigned;
+}
+
+#ifdef STRING_ONLY
+int
+_sscanf_plan_r (struct _reent *ptr,
+       const char *str,
+       const scanf_plan_t *plan, ...)
+{
+  int ret;
+  va_list ap;
+  FILE f;
+
+  f._flags = __SRD | __SSTR;
+  f._bf._base = f._p = (unsigned char *) str;
+  f._bf._size = f._r = strlen (str);
+#ifdef _STDIO_COMPACT_FILE
+  f._ops = &__seofops;
+#else
+  f._read = __seofread;
+#endif
+  CLEARUB (&f);
+  CLEARLB (&f);
+  f._file = -1;  /* No file. */
+  va_start (ap, plan);
+  ret = __ssvfscanf_plan_r (ptr, &f, plan, ap);
+  va_end (ap);
+  return ret;
+}
+
+#ifndef _REENT_ONLY
+int
+sscanf_plan (const char *str,
+       const scanf_plan_t *plan, ...)
+{
+  int ret;
+  va_list ap;
+  FILE f;
+
+  f._flags = __SRD | __SSTR;
+  f._bf._base = f._p = (unsigned char *) str;
+  f._bf._size = f._r = strlen (str);
+#ifdef _STDIO_COMPACT_FILE
+  f._ops = &__seofops;
+#else
+  f._read = __seofread;
+#endif
+  CLEARUB (&f);
+  CLEARLB (&f);
+  f._file = -1;  /* No file. */
+  va_start (ap, plan);
+  ret = __ssvfscanf_plan_r (_REENT, &f, plan, ap);
+  va_end (ap);
+  return ret;
+}
+#endif /* !_REENT_ONLY */
+
+#else /* !STRING_ONLY */
+
+int
+_vfscanf_plan_r (struct _reent *data,
+       FILE *fp,
+       const scanf_plan_t *plan,
+       va_list ap)
+{
+  CHECK_INIT (data, fp);
+  return __svfscanf_plan_r (data, fp, plan, ap);
+}
+
+#ifndef _REENT_ONLY
+int
+vfscanf_plan (FILE *fp,
+       const scanf_plan_t *plan,
+       va_list ap)
+{
+  return _vfscanf_plan_r (_REENT, fp, plan, ap);
+}
+#endif /* !_REENT_ONLY */
+
+#endif /* !STRING_ONLY */
@@ -0,0 +1,394 @@
+/* Wide printf for the nano formatted I/O.  The format is walked here
+   and the numbers are left to the narrow engine, _printf_i,
+   _printf_float and _printf_fixed, through a sink that widens what
+   they print, which is ASCII.  Only the character and string
+   conversions, whose arguments may be wide, are done here, with the
+   padding of _printf_common.  So a wide printf costs this loop rather
+   than a second engine, and the narrow one serves both.  Built twice,
+   like nano-vfprintf.c, the STRING_ONLY copy backing swprintf.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <newlib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+#include <wchar.h>
+#include <sys/lock.h>
+#include <stdarg.h>
+#include "local.h"
+#include "../stdlib/local.h"
+#include "fvwrite.h"
+#include "vfieeefp.h"
+#include "nano-vfprintf_local.h"
+#include "nano-fixed_local.h"
+
+#ifdef STRING_ONLY
+# define _VFWPRINTF_R _svfwprintf_r
+# define __SPRINT __ssputs_r
+#else
+# define _VFWPRINTF_R _vfwprintf_r
+# define __SPRINT __sfputs_r
+#endif
+
+int __SPRINT (struct _reent *, FILE *, const char *, size_t);
+int _VFWPRINTF_R (struct _reent *, FILE *, const wchar_t *, va_list);
+
+/* The character of the format at FMT if it is ASCII, else 0, which
+   matches none of the flags and conversions.  */
+#define ASCII(fmt)	(*(fmt) < 0x80 ? (int) *(fmt) : 0)
+
+/* Write the N wide characters at WS.  */
+static int
+__wputs_r (struct _reent *data,
+       FILE *fp,
+       const wchar_t *ws,
+       size_t n)
+{
+#ifdef STRING_ONLY
+  if (!(fp->_flags & (__SMBF | __SOPT)))
+    return __ssputs_fixed_r (data, fp, (const char *) ws,
+			     n * sizeof (wchar_t));
+#endif
+  return __SPRINT (data, fp, (const char *) ws, n * sizeof (wchar_t));
+}
+
+/* The sink given to the narrow engine.  */
+static int
+__wnarrow_r (struct _reent *data,
+       FILE *fp,
+       const char *buf,
+       size_t len)
+{
+  wchar_t wbuf[16];
+  size_t i, n;
+
+  while (len > 0)
+    {
+      n = len < 16 ? len : 16;
+      for (i = 0; i < n; i++)
+	wbuf[i] = (unsigned char) buf[i];
+      if (__wputs_r (data, fp, wbuf, n) == EOF)
+	return EOF;
+      buf += n;
+      len -= n;
+    }
+  return 0;
+}
+
+/* Convert the multibyte character at S to *WC, as mbrtowc.  */
+static size_t
+__wconv_r (struct _reent *data,
+       wchar_t *wc,
+       const char *s,
+       mbstate_t *ps)
+{
+#ifdef _MB_CAPABLE
+  return _mbrtowc_r (data, wc, s, MB_CUR_MAX, ps);
+#else
+  *wc = (unsigned char) *s;
+  return *s != '\0';
+#endif
+}
+
+/* %c, %lc, %s and %ls, and a conversion WC that is not ASCII, which,
+   like any other unknown one, prints itself.  */
+static int
+_wprintf_s (struct _reent *data,
+       struct _prt_data_t *pdata,
+       FILE *fp,
+       wchar_t wc,
+       va_list *ap)
+{
+  int (*pfunc)(struct _reent *, FILE *, const char *, size_t len);
+  const wchar_t *ws = &wc;
+  const char *s = NULL, *p;
+  wchar_t wbuf[16];
+  size_t size = 1, n;
+  int i, realsz;
+  mbstate_t ps;
+  char c;
+
+  pfunc = __wnarrow_r;
+  memset (&ps, 0, sizeof ps);
+  switch (wc)
+    {
+    case L'C':
+      pdata->flags |= LONGINT;
+    case L'c':
+      if (pdata->flags & LONGINT)
+	wc = (wchar_t) GET_ARG (N, *ap, wint_t);
+      else
+	{
+	  c = (char) GET_ARG (N, *ap, int);
+	  if (c == '\0')
+	    wc = L'\0';
+	  else if ((n = __wconv_r (data, &wc, &c, &ps)) == (size_t) -1
+		   || n == (size_t) -2)
+	    goto ilseq;
+	}
+      break;
+
+    case L'S':
+      pdata->flags |= LONGINT;
+    case L's':
+      if (pdata->flags & LONGINT)
+	ws = GET_ARG (N, *ap, const wchar_t *);
+      else
+	ws = (const wchar_t *) (s = GET_ARG (N, *ap, char_ptr_t));
+#ifndef __OPTIMIZE_SIZE__
+      /* Mirror glibc, as vfwprintf does.  */
+      if (ws == NULL)
+	{
+	  ws = L"(null)";
+	  s = NULL;
+	}
+#endif
+      /* The number of wide characters printed, at most PREC.  */
+      if (s == NULL)
+	for (size = 0; size != (size_t) pdata->prec && ws[size] != L'\0';
+	     size++)
+	  ;
+      else
+	for (size = 0, p = s; size != (size_t) pdata->prec; size++, p += n)
+	  {
+	    n = __wconv_r (data, wbuf, p, &ps);
+	    if (n == 0)
+	      break;
+	    if (n == (size_t) -1 || n == (size_t) -2)
+	      goto ilseq;
+	  }
+      break;
+    }
+
+  pdata->size = size;
+  pdata->l_buf[0] = '\0';
+  if (_printf_common (data, pdata, &realsz, fp, pfunc) == -1)
+    goto error;
+
+  if (s == NULL)
+    {
+      if (__wputs_r (data, fp, ws, size) == EOF)
+	goto error;
+    }
+  else
+    {
+      memset (&ps, 0, sizeof ps);
+      while (size > 0)
+	{
+	  for (i = 0; i < 16 && size > 0; i++, size--)
+	    s += __wconv_r (data, &wbuf[i], s, &ps);
+	  if (__wputs_r (data, fp, wbuf, i) == EOF)
+	    goto error;
+	}
+    }
+  /* Left-adjusting padding (always blank).  */
+  if (pdata->flags & LADJUST)
+    PAD (pdata->width - realsz, pdata->blank);
+
+  return (pdata->width > realsz ? pdata->width : realsz);
+ilseq:
+  data->_errno = EILSEQ;
+  fp->_flags |= __SERR;
+error:
+  return -1;
+}
+
+#ifndef STRING_ONLY
+int
+vfwprintf (FILE *__restrict fp,
+       const wchar_t *__restrict fmt0,
+       va_list ap)
+{
+  return _vfwprintf_r (_REENT, fp, fmt0, ap);
+}
+
+int
+vfiwprintf (FILE *, const wchar_t *, __VALIST)
+       _ATTRIBUTE ((__alias__("vfwprintf")));
+#endif
+
+int
+_VFWPRINTF_R (struct _reent *data,
+       FILE * fp,
+       const wchar_t *fmt0,
+       va_list ap)
+{
+  register const wchar_t *fmt;	/* Format string.  */
+  register int n, m;	/* Handy integers (short term usage).  */
+  const wchar_t *wcp;
+  const char *cp;
+  const char *flag_chars;
+  struct _prt_data_t prt_data;	/* All data for decoding format string.  */
+  va_list ap_copy;
+  wchar_t wc;
+
+  /* Output function pointer.  */
+  int (*pfunc)(struct _reent *, FILE *, const char *, size_t len);
+
+  pfunc = __wnarrow_r;
+
+#ifndef STRING_ONLY
+  /* Initialize std streams if not dealing with sprintf family.  */
+  CHECK_INIT (data, fp);
+  _newlib_flockfile_start (fp);
+
+  ORIENT (fp, 1);
+
+  /* Sorry, fwprintf(read_only_file, L"") returns EOF, not 0.  */
+  if (cantwrite (data, fp))
+    {
+      _newlib_flockfile_exit (fp);
+      return (EOF);
+    }
+#endif
+
+  fmt = fmt0;
+  prt_data.ret = 0;
+  prt_data.blank = ' ';
+  prt_data.zero = '0';
+
+  va_copy (ap_copy, ap);
+
+  /* Scan the format for conversions (`%' character).  */
+  for (;;)
+    {
+      wcp = fmt;
+      while (*fmt != L'\0' && *fmt != L'%')
+	fmt += 1;
+
+      if ((m = fmt - wcp) != 0)
+	{
+	  if (__wputs_r (data, fp, wcp, m) == EOF)
+	    goto error;
+	  prt_data.ret += m;
+	}
+      if (*fmt == L'\0' || *++fmt == L'\0')
+	goto done;
+
+      prt_data.flags = 0;
+      prt_data.width = 0;
+      prt_data.prec = -1;
+      prt_data.dprec = 0;
+      prt_data.l_buf[0] = '\0';
+#ifdef FLOATING_POINT
+      prt_data.lead = 0;
+#endif
+      /* The flags.  */
+      flag_chars = "#-0+ ";
+      for (; (cp = memchr (flag_chars, ASCII (fmt), 5)) != NULL; fmt++)
+	prt_data.flags |= (1 << (cp - flag_chars));
+
+      if (prt_data.flags & SPACESGN)
+	prt_data.l_buf[0] = ' ';
+      if (prt_data.flags & PLUSSGN)
+	prt_data.l_buf[0] = '+';
+
+      /* The width.  */
+      if (*fmt == L'*')
+	{
+	  prt_data.width = GET_ARG (n, ap_copy, int);
+	  if (prt_data.width < 0)
+	    {
+	      prt_data.width = -prt_data.width;
+	      prt_data.flags |= LADJUST;
+	    }
+	  fmt++;
+	}
+      else
+	for (; is_digit (*fmt); fmt++)
+	  prt_data.width = 10 * prt_data.width + to_digit (*fmt);
+
+      /* The precision.  */
+      if (*fmt == L'.')
+	{
+	  fmt++;
+	  if (*fmt == L'*')
+	    {
+	      fmt++;
+	      prt_data.prec = GET_ARG (n, ap_copy, int);
+	      if (prt_data.prec < 0)
+		prt_data.prec = -1;
+	    }
+	  else
+	    for (prt_data.prec = 0; is_digit (*fmt); fmt++)
+	      prt_data.prec = 10 * prt_data.prec + to_digit (*fmt);
+	}
+
+      /* The length modifiers.  */
+      flag_chars = "hlL";
+      if ((cp = memchr (flag_chars, ASCII (fmt), 3)) != NULL)
+	{
+	  prt_data.flags |= (SHORTINT << (cp - flag_chars));
+	  fmt++;
+	}
+
+      /* The conversion specifiers.  */
+      if ((wc = *fmt) == L'\0')
+	goto done;
+      fmt++;
+      prt_data.code = ASCII (&wc);
+      if (prt_data.code == '\0' || memchr ("cCsS", prt_data.code, 4))
+	n = _wprintf_s (data, &prt_data, fp, wc, &ap_copy);
+      else
+#ifdef FLOATING_POINT
+      if (memchr ("efgEFG", prt_data.code, 6))
+	{
+	  /* Consume floating point argument if _printf_float is not
+	     linked.  */
+	  if (_printf_float == NULL)
+	    {
+	      if (prt_data.flags & LONGDBL)
+		GET_ARG (N, ap_copy, _LONG_DOUBLE);
+	      else
+		GET_ARG (N, ap_copy, double);
+	      n = 0;
+	    }
+	  else
+	    n = _printf_float (data, &prt_data, fp, pfunc, &ap_copy);
+	}
+      else
+#endif
+#ifdef __FRACT_FBIT__
+      if (memchr ("rRkK", prt_data.code, 4))
+	{
+	  /* Likewise the fixed-point argument if _printf_fixed is not
+	     linked.  */
+	  if (_printf_fixed == NULL)
+	    {
+	      FIXED_SELECT (prt_data.code, prt_data.flags, SHORTINT, LONGINT,
+			    SKIP_FIXED_ARG);
+	      n = 0;
+	    }
+	  else
+	    n = _printf_fixed (data, &prt_data, fp, pfunc, &ap_copy);
+	}
+      else
+#endif
+	n = _printf_i (data, &prt_data, fp, pfunc, &ap_copy);
+
+      if (n == -1)
+	goto error;
+
+      prt_data.ret += n;
+    }
+done:
+error:
+#ifndef STRING_ONLY
+  _newlib_flockfile_end (fp);
+#endif
+  va_end (ap_copy);
+  return (__sferror (fp) ? EOF : prt_data.ret);
+}
+
+#ifdef STRING_ONLY
+int
+_svfiwprintf_r (struct _reent *, FILE *, const wchar_t *, __VALIST)
+       _ATTRIBUTE ((__alias__("_svfwprintf_r")));
+#else
+int
+_vfiwprintf_r (struct _reent *, FILE *, const wchar_t *, __VALIST)
+       _ATTRIBUTE ((__alias__("_vfwprintf_r")));
+#endif
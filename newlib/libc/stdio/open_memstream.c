@@ -288,6 +288,11 @@ memcloser (struct _reent *ptr,
   return 0;
 }
 
+#ifdef _STDIO_COMPACT_FILE
+static const struct __sFILE_ops memstream_ops =
+  { NULL, memwriter, memseeker, memcloser };
+#endif
+
 /* Open a memstream that tracks a dynamic buffer in BUF and SIZE.
    Return the new stream, or fail with NULL.  */
 static FILE *
@@ -309,7 +314,7 @@ internal_open_memstream_r (struct _reent *ptr,
   if ((c = (memstream *) _malloc_r (ptr, sizeof *c)) == NULL)
     {
       _newlib_sfp_lock_start ();
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);	/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -334,7 +339,7 @@ internal_open_memstream_r (struct _reent *ptr,
   if (!*buf)
     {
       _newlib_sfp_lock_start ();
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);	/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -359,6 +364,9 @@ internal_open_memstream_r (struct _reent *ptr,
   fp->_file = -1;
   fp->_flags = __SWR;
   fp->_cookie = c;
+#ifdef _STDIO_COMPACT_FILE
+  fp->_ops = &memstream_ops;
+#else
   fp->_read = NULL;
   fp->_write = memwriter;
   fp->_seek = memseeker;
@@ -367,6 +375,7 @@ internal_open_memstream_r (struct _reent *ptr,
   fp->_flags |= __SL64;
 #endif
   fp->_close = memcloser;
+#endif
   ORIENT (fp, wide);
   _newlib_flockfile_end (fp);
   return fp;
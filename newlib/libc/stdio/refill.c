@@ -23,9 +23,11 @@
 #include "local.h"
 
 static int
-lflush (FILE *fp)
+lflush (struct _reent *ptr,
+       FILE *fp)
 {
-  if ((fp->_flags & (__SLBF | __SWR)) == (__SLBF | __SWR))
+  if ((fp->_flags & (__SLBF | __SWR)) == (__SLBF | __SWR)
+      && fp->_p != fp->_bf._base)
     return fflush (fp);
   return 0;
 }
@@ -84,9 +86,9 @@ __srefill_r (struct _reent * ptr,
       if (HASUB (fp))
 	{
 	  FREEUB (ptr, fp);
-	  if ((fp->_r = fp->_ur) != 0)
+	  if ((fp->_r = _UR (fp)) != 0)
 	    {
-	      fp->_p = fp->_up;
+	      fp->_p = _UP (fp);
 	      return 0;
 	    }
 	}
@@ -105,7 +107,7 @@ __srefill_r (struct _reent * ptr,
       /* Ignore this file in _fwalk to avoid potential deadlock. */
       short orig_flags = fp->_flags;
       fp->_flags = 1;
-      (void) _fwalk (_GLOBAL_REENT, lflush);
+      (void) _fwalk_writers (_GLOBAL_REENT, lflush);
       fp->_flags = orig_flags;
 
       /* Now flush this file without locking it. */
@@ -114,7 +116,9 @@ __srefill_r (struct _reent * ptr,
     }
 
   fp->_p = fp->_bf._base;
-  fp->_r = fp->_read (ptr, fp->_cookie, (char *) fp->_p, fp->_bf._size);
+  fp->_r = _SOPS (fp)->_read (ptr, fp->_cookie, (char *) fp->_p, fp->_bf._size);
+  _STDIO_COUNT (fp, _refills, 1);
+  _STDIO_COUNT_IO (fp, _reads, _read_bytes, fp->_r);
 #ifndef __CYGWIN__
   if (fp->_r <= 0)
 #else
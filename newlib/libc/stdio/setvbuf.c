@@ -122,7 +122,7 @@ setvbuf (register FILE * fp,
     FREEUB(reent, fp);
   fp->_r = fp->_lbfsize = 0;
   if (fp->_flags & __SMBF)
-    _free_r (reent, (void *) fp->_bf._base);
+    __sfreebuf_r (reent, (void *) fp->_bf._base);
   fp->_flags &= ~(__SLBF | __SNBF | __SMBF | __SOPT | __SNPT | __SEOF);
 
   if (mode == _IONBF)
@@ -210,6 +210,7 @@ nbf:
 	}
       else
         fp->_w = size;
+      __swriter_add (fp);
     }
   else
     {
@@ -92,9 +92,13 @@ siscanf (const char *str,
   f._flags = __SRD | __SSTR;
   f._bf._base = f._p = (unsigned char *) str;
   f._bf._size = f._r = strlen (str);
+#ifdef _STDIO_COMPACT_FILE
+  f._ops = &__seofops;
+#else
   f._read = __seofread;
-  f._ub._base = NULL;
-  f._lb._base = NULL;
+#endif
+  CLEARUB (&f);
+  CLEARLB (&f);
   f._file = -1;  /* No file. */
   va_start (ap, fmt);
   ret = __ssvfiscanf_r (_REENT, &f, fmt, ap);
@@ -116,9 +120,13 @@ _siscanf_r (struct _reent *ptr,
   f._flags = __SRD | __SSTR;
   f._bf._base = f._p = (unsigned char *) str;
   f._bf._size = f._r = strlen (str);
+#ifdef _STDIO_COMPACT_FILE
+  f._ops = &__seofops;
+#else
   f._read = __seofread;
-  f._ub._base = NULL;
-  f._lb._base = NULL;
+#endif
+  CLEARUB (&f);
+  CLEARLB (&f);
   f._file = -1;  /* No file. */
   va_start (ap, fmt);
   ret = __ssvfiscanf_r (ptr, &f, fmt, ap);
@@ -130,6 +130,15 @@ __sclose (struct _reent *ptr,
   return _close_r (ptr, fp->_file);
 }
 
+#ifdef _STDIO_COMPACT_FILE
+/* The operations of streams on a file descriptor, and of the string
+   streams that sscanf and friends read from.  */
+const struct __sFILE_ops __sstdops =
+  { __sread, __swrite, __sseek, __sclose };
+const struct __sFILE_ops __seofops =
+  { __seofread, NULL, NULL, NULL };
+#endif
+
 #ifdef __SCLE
 int
 __stextmode (int fd)
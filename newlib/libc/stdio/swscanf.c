@@ -424,9 +424,13 @@ swscanf (const wchar_t *__restrict str, const wchar_t *__restrict fmt, ...)
   f._flags = __SRD | __SSTR;
   f._bf._base = f._p = (unsigned char *) str;
   f._bf._size = f._r = wcslen (str) * sizeof (wchar_t);
+#ifdef _STDIO_COMPACT_FILE
+  f._ops = &__seofops;
+#else
   f._read = __seofread;
-  f._ub._base = NULL;
-  f._lb._base = NULL;
+#endif
+  CLEARUB (&f);
+  CLEARLB (&f);
   f._file = -1;  /* No file. */
   va_start (ap, fmt);
   ret = __ssvfwscanf_r (_REENT, &f, fmt, ap);
@@ -446,9 +450,13 @@ _swscanf_r (struct _reent *ptr, const wchar_t *str, const wchar_t *fmt, ...)
   f._flags = __SRD | __SSTR;
   f._bf._base = f._p = (unsigned char *) str;
   f._bf._size = f._r = wcslen (str) * sizeof (wchar_t);
+#ifdef _STDIO_COMPACT_FILE
+  f._ops = &__seofops;
+#else
   f._read = __seofread;
-  f._ub._base = NULL;
-  f._lb._base = NULL;
+#endif
+  CLEARUB (&f);
+  CLEARLB (&f);
   f._file = -1;  /* No file. */
   va_start (ap, fmt);
   ret = __ssvfwscanf_r (ptr, &f, fmt, ap);
@@ -83,32 +83,52 @@ __submore (struct _reent *rptr,
   register int i;
   register unsigned char *p;
 
-  if (fp->_ub._base == fp->_ubuf)
+  if (_UB (fp)._base == _UBUF (fp))
     {
       /*
        * Get a new buffer (rather than expanding the old one).
        */
       if ((p = (unsigned char *) _malloc_r (rptr, (size_t) BUFSIZ)) == NULL)
 	return EOF;
-      fp->_ub._base = p;
-      fp->_ub._size = BUFSIZ;
-      p += BUFSIZ - sizeof (fp->_ubuf);
-      for (i = sizeof (fp->_ubuf); --i >= 0;)
-	p[i] = fp->_ubuf[i];
+      _UB (fp)._base = p;
+      _UB (fp)._size = BUFSIZ;
+      p += BUFSIZ - sizeof (_UBUF (fp));
+      for (i = sizeof (_UBUF (fp)); --i >= 0;)
+	p[i] = _UBUF (fp)[i];
       fp->_p = p;
       return 0;
     }
-  i = fp->_ub._size;
-  p = (unsigned char *) _realloc_r (rptr, (void *) (fp->_ub._base), i << 1);
+  i = _UB (fp)._size;
+  p = (unsigned char *) _realloc_r (rptr, (void *) (_UB (fp)._base), i << 1);
   if (p == NULL)
     return EOF;
   (void) memcpy ((void *) (p + i), (void *) p, (size_t) i);
   fp->_p = p + i;
-  fp->_ub._base = p;
-  fp->_ub._size = i << 1;
+  _UB (fp)._base = p;
+  _UB (fp)._size = i << 1;
   return 0;
 }
 
+#ifdef _STDIO_COMPACT_FILE
+/*
+ * Allocate the ungetc state of a compact FILE.  It stays with the
+ * stream until fclose or freopen.
+ */
+
+int
+__smakeub_r (struct _reent *rptr,
+       register FILE *fp)
+{
+  fp->_ungetc = (struct __sFILE_ungetc *)
+    _malloc_r (rptr, sizeof (struct __sFILE_ungetc));
+  if (fp->_ungetc == NULL)
+    return EOF;
+  fp->_ungetc->_ub._base = NULL;
+  fp->_ungetc->_ub._size = 0;
+  return 0;
+}
+#endif
+
 int
 _ungetc_r (struct _reent *rptr,
        int c,
@@ -163,7 +183,7 @@ _ungetc_r (struct _reent *rptr,
 
   if (HASUB (fp))
     {
-      if (fp->_r >= fp->_ub._size && __submore (rptr, fp))
+      if (fp->_r >= _UB (fp)._size && __submore (rptr, fp))
         {
           _newlib_flockfile_exit (fp);
           return EOF;
@@ -193,12 +213,17 @@ _ungetc_r (struct _reent *rptr,
    * Initially, we will use the `reserve' buffer.
    */
 
-  fp->_ur = fp->_r;
-  fp->_up = fp->_p;
-  fp->_ub._base = fp->_ubuf;
-  fp->_ub._size = sizeof (fp->_ubuf);
-  fp->_ubuf[sizeof (fp->_ubuf) - 1] = c;
-  fp->_p = &fp->_ubuf[sizeof (fp->_ubuf) - 1];
+  if (!MAKEUB (rptr, fp))
+    {
+      _newlib_flockfile_exit (fp);
+      return EOF;
+    }
+  _UR (fp) = fp->_r;
+  _UP (fp) = fp->_p;
+  _UB (fp)._base = _UBUF (fp);
+  _UB (fp)._size = sizeof (_UBUF (fp));
+  _UBUF (fp)[sizeof (_UBUF (fp)) - 1] = c;
+  fp->_p = &_UBUF (fp)[sizeof (_UBUF (fp)) - 1];
   fp->_r = 1;
   _newlib_flockfile_end (fp);
   return c;
@@ -11,8 +11,34 @@
 #include <stdarg.h>
 #include <limits.h>
 #include <errno.h>
+#include <string.h>
 #include "local.h"
 
+/* Format into the LEN bytes at BUF, LEN at least 1, as vsnprintf
+   does, and return the length of the whole output.  */
+static int
+format_into (struct _reent *ptr,
+       char *buf,
+       size_t len,
+       const char *fmt,
+       va_list ap)
+{
+  int ret;
+  FILE f;
+
+  f._flags = __SWR | __SSTR;
+  f._bf._base = f._p = (unsigned char *) buf;
+  f._bf._size = f._w = len - 1;
+  f._file = -1;  /* No file. */
+  ret = _svfprintf_r (ptr, &f, fmt, ap);
+  *f._p = '\0';
+  return ret;
+}
+
+/* The output goes into BUF when it fits there, and otherwise into a
+   string on the stack; when it fits neither, that first pass has
+   still counted it.  Either way the result is allocated once, at its
+   exact size, instead of growing by realloc as it arrives.  */
 char *
 _vasnprintf_r (struct _reent *ptr,
        char *buf,
@@ -20,23 +46,17 @@ _vasnprintf_r (struct _reent *ptr,
        const char *fmt,
        va_list ap)
 {
-  int ret;
-  FILE f;
+  char tmp[AS_BUF_SIZE];
+  char *str;
+  va_list ap2;
+  int ret, ret2;
   size_t len = *lenp;
 
-  if (buf && len)
-    {
-      /* mark an existing buffer, but allow allocation of larger string */
-      f._flags = __SWR | __SSTR | __SOPT;
-    }
-  else
+  if (!buf || !len)
     {
-      /* mark a zero-length reallocatable buffer */
-      f._flags = __SWR | __SSTR | __SMBF;
-      len = 0;
-      buf = NULL;
+      buf = tmp;
+      len = sizeof (tmp);
     }
-  f._bf._base = f._p = (unsigned char *) buf;
   /* For now, inherit the 32-bit signed limit of FILE._bf._size.
      FIXME - it would be nice to rewrite sys/reent.h to support size_t
      for _size.  */
@@ -45,14 +65,28 @@ _vasnprintf_r (struct _reent *ptr,
       ptr->_errno = EOVERFLOW;
       return NULL;
     }
-  f._bf._size = f._w = len;
-  f._file = -1;  /* No file. */
-  ret = _svfprintf_r (ptr, &f, fmt, ap);
+  va_copy (ap2, ap);
+  ret = format_into (ptr, buf, len, fmt, ap);
   if (ret < 0)
-    return NULL;
-  *lenp = ret;
-  *f._p = '\0';
-  return (char *) f._bf._base;
+    str = NULL;
+  else if ((size_t) ret < len && buf != tmp)
+    str = buf;
+  else if ((str = (char *) _malloc_r (ptr, (size_t) ret + 1)) == NULL)
+    ptr->_errno = ENOMEM;
+  else if ((size_t) ret < len)
+    memcpy (str, tmp, (size_t) ret + 1);
+  else if ((ret2 = format_into (ptr, str, (size_t) ret + 1, fmt, ap2)) < 0
+	   || ret2 > ret)
+    {
+      _free_r (ptr, str);
+      str = NULL;
+    }
+  else
+    ret = ret2;
+  va_end (ap2);
+  if (str != NULL)
+    *lenp = ret;
+  return str;
 }
 
 #ifdef _NANO_FORMATTED_IO
@@ -52,20 +52,13 @@ _vasprintf_r (struct _reent *ptr,
        const char *fmt,
        va_list ap)
 {
-  int ret;
-  FILE f;
+  size_t len = 0;
+  char *str = _vasnprintf_r (ptr, NULL, &len, fmt, ap);
 
-  f._flags = __SWR | __SSTR | __SMBF ;
-  f._bf._base = f._p = NULL;
-  f._bf._size = f._w = 0;
-  f._file = -1;  /* No file. */
-  ret = _svfprintf_r (ptr, &f, fmt, ap);
-  if (ret >= 0)
-    {
-      *f._p = 0;
-      *strp = (char *) f._bf._base;
-    }
-  return ret;
+  if (str == NULL)
+    return EOF;
+  *strp = str;
+  return len;
 }
 
 #ifdef _NANO_FORMATTED_IO
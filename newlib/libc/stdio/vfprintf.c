@@ -462,7 +462,11 @@ __sbprintf (struct _reent *rptr,
 	fake._flags2 = fp->_flags2;
 	fake._file = fp->_file;
 	fake._cookie = fp->_cookie;
+#ifdef _STDIO_COMPACT_FILE
+	fake._ops = fp->_ops;
+#else
 	fake._write = fp->_write;
+#endif
 
 	/* set up the buffer */
 	fake._bf._base = fake._p = buf;
@@ -682,7 +686,7 @@ _VFPRINTF_R (struct _reent *data,
 	const char *grouping = NULL;
 #endif
 #ifdef FLOATING_POINT
-	char *decimal_point = _localeconv_r (data)->decimal_point;
+	char *decimal_point = __DECIMAL_POINT (data);
 	size_t decp_len = strlen (decimal_point);
 	char softsign;		/* temporary negative sign for floats */
 	union { int i; _PRINTF_FLOAT_TYPE fp; } _double_ = {0};
@@ -948,11 +952,14 @@ rflag:		ch = *fmt++;
 reswitch:	switch (ch) {
 #ifdef _WANT_IO_C99_FORMATS
 		case '\'':
+#ifndef _WANT_C_LOCALE_ONLY
+			/* The C locale has no thousands separator.  */
 			thousands_sep = _localeconv_r (data)->thousands_sep;
 			thsnd_len = strlen (thousands_sep);
 			grouping = _localeconv_r (data)->grouping;
 			if (thsnd_len > 0 && grouping && *grouping)
 			  flags |= GROUPING;
+#endif
 			goto rflag;
 #endif
 		case ' ':
@@ -1582,6 +1589,20 @@ number:			if ((dprec = prec) >= 0)
 					break;
 
 				case DEC:
+					/* __u32toa and __u64toa multiply by
+					   reciprocals instead of dividing.  */
+#ifdef _WANT_IO_C99_FORMATS
+					if (!(flags & GROUPING))
+#endif
+					{
+						if (_uquad <= 0xffffffffUL)
+							cp = __u32toa (cp,
+							    (__uint32_t) _uquad);
+						else
+							cp = __u64toa (cp,
+							    (__uint64_t) _uquad);
+						break;
+					}
 					/* many numbers are 1 digit */
 					if (_uquad < 10) {
 						*--cp = to_char(_uquad);
@@ -279,7 +279,7 @@ _sungetc_r (struct _reent *data,
 
   if (HASUB (fp))
     {
-      if (fp->_r >= fp->_ub._size && __submore (data, fp))
+      if (fp->_r >= _UB (fp)._size && __submore (data, fp))
         {
           return EOF;
         }
@@ -306,12 +306,16 @@ _sungetc_r (struct _reent *data,
    * Initially, we will use the `reserve' buffer.
    */
 
-  fp->_ur = fp->_r;
-  fp->_up = fp->_p;
-  fp->_ub._base = fp->_ubuf;
-  fp->_ub._size = sizeof (fp->_ubuf);
-  fp->_ubuf[sizeof (fp->_ubuf) - 1] = c;
-  fp->_p = &fp->_ubuf[sizeof (fp->_ubuf) - 1];
+  if (!MAKEUB (data, fp))
+    {
+      return EOF;
+    }
+  _UR (fp) = fp->_r;
+  _UP (fp) = fp->_p;
+  _UB (fp)._base = _UBUF (fp);
+  _UB (fp)._size = sizeof (_UBUF (fp));
+  _UBUF (fp)[sizeof (_UBUF (fp)) - 1] = c;
+  fp->_p = &_UBUF (fp)[sizeof (_UBUF (fp)) - 1];
   fp->_r = 1;
   return c;
 }
@@ -328,9 +332,9 @@ __ssrefill_r (struct _reent * ptr,
   if (HASUB (fp))
     {
       FREEUB (ptr, fp);
-      if ((fp->_r = fp->_ur) != 0)
+      if ((fp->_r = _UR (fp)) != 0)
         {
-          fp->_p = fp->_up;
+          fp->_p = _UP (fp);
 	  return 0;
         }
     }
@@ -1551,7 +1555,7 @@ __SVFSCANF_R (struct _reent *rptr,
 	  unsigned width_left = 0;
 	  char nancount = 0;
 	  char infcount = 0;
-	  const char *decpt = _localeconv_r (rptr)->decimal_point;
+	  const char *decpt = __DECIMAL_POINT (rptr);
 #ifdef _MB_CAPABLE
 	  int decptpos = 0;
 #endif
@@ -188,7 +188,11 @@ __sbwprintf (struct _reent *rptr,
 	fake._flags2 = fp->_flags2;
 	fake._file = fp->_file;
 	fake._cookie = fp->_cookie;
+#ifdef _STDIO_COMPACT_FILE
+	fake._ops = fp->_ops;
+#else
 	fake._write = fp->_write;
+#endif
 
 	/* set up the buffer */
 	fake._bf._base = fake._p = buf;
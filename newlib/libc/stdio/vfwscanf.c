@@ -279,7 +279,7 @@ _sungetwc_r (struct _reent *data,
 
   if (HASUB (fp))
     {
-      if (fp->_r >= fp->_ub._size && __submore (data, fp))
+      if (fp->_r >= _UB (fp)._size && __submore (data, fp))
         {
           return EOF;
         }
@@ -308,11 +308,15 @@ _sungetwc_r (struct _reent *data,
    * Initially, we will use the `reserve' buffer.
    */
 
-  fp->_ur = fp->_r;
-  fp->_up = fp->_p;
-  fp->_ub._base = fp->_ubuf;
-  fp->_ub._size = sizeof (fp->_ubuf);
-  fp->_p = &fp->_ubuf[sizeof (fp->_ubuf) - sizeof (wchar_t)];
+  if (!MAKEUB (data, fp))
+    {
+      return WEOF;
+    }
+  _UR (fp) = fp->_r;
+  _UP (fp) = fp->_p;
+  _UB (fp)._base = _UBUF (fp);
+  _UB (fp)._size = sizeof (_UBUF (fp));
+  fp->_p = &_UBUF (fp)[sizeof (_UBUF (fp)) - sizeof (wchar_t)];
   *(wchar_t *) fp->_p = wc;
   fp->_r = 2;
   return wc;
@@ -36,6 +36,7 @@ __swsetup_r (struct _reent *ptr,
   /* Make sure stdio is set up.  */
 
   CHECK_INIT (_REENT, fp);
+  _STDIO_COUNT (fp, _setups, 1);
 
   /*
    * If we are not writing, we had better be reading and writing.
@@ -89,5 +90,6 @@ __swsetup_r (struct _reent *ptr,
       fp->_flags |= __SERR;
       return EOF;
     }
+  __swriter_add (fp);
   return 0;
 }
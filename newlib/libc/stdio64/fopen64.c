@@ -80,7 +80,7 @@ _fopen64_r (struct _reent *ptr,
   if ((f = _open64_r (ptr, file, oflags, 0666)) < 0)
     {
       _newlib_sfp_lock_start ();
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);	/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -185,7 +185,7 @@ _freopen64_r (struct _reent *ptr,
    */
 
   if (fp->_flags & __SMBF)
-    _free_r (ptr, (char *) fp->_bf._base);
+    __sfreebuf_r (ptr, (char *) fp->_bf._base);
   fp->_w = 0;
   fp->_r = 0;
   fp->_p = NULL;
@@ -205,7 +205,7 @@ _freopen64_r (struct _reent *ptr,
   if (f < 0)
     {				/* did not get it after all */
       __sfp_lock_acquire ();
-      fp->_flags = 0;		/* set it free */
+      __sfp_free (fp);	/* set it free */
       ptr->_errno = e;		/* restore in case _close clobbered */
       if (!(oflags2 & __SNLK))
 	_funlockfile (fp);
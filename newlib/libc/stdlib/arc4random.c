@@ -46,7 +46,16 @@
 #define KEYSZ	32
 #define IVSZ	8
 #define BLOCKSZ	64
-#define RSBUFSZ	(16*BLOCKSZ)
+/* Keystream blocks made at a time; each batch gives up KEYSZ + IVSZ
+   bytes of the first block to rekey.  A target short of RAM can build
+   with fewer.  */
+#ifndef ARC4RANDOM_BLOCKS
+#define ARC4RANDOM_BLOCKS	16
+#endif
+#if ARC4RANDOM_BLOCKS < 1
+#error "ARC4RANDOM_BLOCKS must be at least 1"
+#endif
+#define RSBUFSZ	(ARC4RANDOM_BLOCKS*BLOCKSZ)
 
 /* Marked MAP_INHERIT_ZERO, so zero'd out in fork children. */
 static struct _rs {
@@ -0,0 +1,103 @@
+/* Scoped bump allocation, see <arena.h>.
+
+   Arenas created with nano-malloc present are kept on a list so that
+   free can tell their blocks from heap chunks whichever arena, if
+   any, is in use at the time.  */
+
+#include <_ansi.h>
+#include <newlib.h>
+#include <reent.h>
+#include <errno.h>
+#include <malloc.h>
+#include <arena.h>
+
+#ifdef _NANO_MALLOC
+/* Defined with nano_malloc */
+extern arena_t *__malloc_arenas;
+#endif
+
+void
+arena_create (arena_t *a,
+	void *buf,
+	size_t size)
+{
+  a->_start = a->_ptr = (char *) buf;
+  a->_end = (char *) buf + size;
+#ifdef _NANO_MALLOC
+  __malloc_lock (_REENT);
+  a->_next = __malloc_arenas;
+  __malloc_arenas = a;
+  __malloc_unlock (_REENT);
+#else
+  a->_next = NULL;
+#endif
+}
+
+void
+arena_destroy (arena_t *a)
+{
+#ifdef _NANO_MALLOC
+  arena_t **pp;
+
+  __malloc_lock (_REENT);
+  for (pp = &__malloc_arenas; *pp != NULL; pp = &(*pp)->_next)
+    if (*pp == a)
+      {
+	*pp = a->_next;
+	break;
+      }
+  __malloc_unlock (_REENT);
+#endif
+  a->_next = NULL;
+}
+
+void *
+arena_alloc (arena_t *a,
+	size_t size)
+{
+  void *p;
+
+  __malloc_lock (_REENT);
+  p = __arena_bump (a, ARENA_ALIGN, size);
+  __malloc_unlock (_REENT);
+  return p;
+}
+
+arena_mark_t
+arena_mark (arena_t *a)
+{
+  return a->_ptr;
+}
+
+void
+arena_release (arena_t *a,
+	arena_mark_t mark)
+{
+  __malloc_lock (_REENT);
+  if (mark >= a->_start && mark <= a->_ptr)
+    a->_ptr = mark;
+  __malloc_unlock (_REENT);
+}
+
+void
+arena_reset (arena_t *a)
+{
+  arena_release (a, a->_start);
+}
+
+arena_t *
+arena_use (arena_t *a)
+{
+  struct _reent *ptr = _REENT;
+  arena_t *prev;
+
+#ifdef _NANO_MALLOC
+  prev = _REENT_MALLOC_ARENA (ptr);
+  _REENT_MALLOC_ARENA (ptr) = a;
+#else
+  prev = NULL;
+  if (a != NULL)
+    ptr->_errno = ENOSYS;
+#endif
+  return prev;
+}
@@ -32,6 +32,13 @@ DESCRIPTION
 
 . (void(0))
 
+	Defining <<ASSERT_COMPACT>> instead keeps <<assert>> enabled,
+	whether or not <<NDEBUG>> is defined, without the strings: a
+	failure calls <<__assert_id>> with <<ASSERT_FILE_ID>>, a 16-bit
+	number the build gives each file, and the line number.  The
+	default <<__assert_id>> writes a binary record of them to file
+	descriptor 2 and calls <<abort>>; a program may define its own.
+
 RETURNS
 	<<assert>> does not return a value.
 
@@ -0,0 +1,31 @@
+/* __assert_id, what assert calls under ASSERT_COMPACT, see <assert.h>.
+
+   The default logs the failure as a six byte record on file descriptor
+   2 and aborts: 0xa5 0x5a, then the file ID and the line, each as two
+   bytes, low byte first.  It uses no stdio, so keeping asserts does not
+   link in the printf machinery.  assertid.py finds the records in a
+   capture of the console and names the files again.  A program may
+   define its own __assert_id, to keep the record in memory that
+   survives a reset for instance; it must not return.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <assert.h>
+#include <stdlib.h>
+
+void __attribute__ ((__weak__))
+__assert_id (unsigned int id,
+	unsigned int line)
+{
+  unsigned char rec[6];
+
+  rec[0] = 0xa5;
+  rec[1] = 0x5a;
+  rec[2] = id & 0xff;
+  rec[3] = (id >> 8) & 0xff;
+  rec[4] = line & 0xff;
+  rec[5] = (line >> 8) & 0xff;
+  _write_r (_REENT, 2, rec, sizeof rec);
+  abort ();
+  /* NOTREACHED */
+}
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+#
+# assertid.py -- file IDs for ASSERT_COMPACT, and decoding of failures.
+#
+# usage: assertid.py id [--flag] FILE...
+#        assertid.py decode [--map MAP] [FILE...] < CAPTURE
+#
+# Under ASSERT_COMPACT, assert passes a 16-bit ASSERT_FILE_ID and the
+# line instead of strings.  "id" prints the ID of each source file, the
+# CRC-16/CCITT of its name as given, so a makefile can compile each file
+# with -DASSERT_FILE_ID=$(shell assertid.py id --flag $<).  ID 0 is left
+# for files compiled without one, and a name that hashes to 0 or to the
+# ID of another one given is reported.  The output, without --flag, is
+# a map "decode" reads back with --map.
+#
+# "decode" finds the records the default __assert_id writes to fd 2,
+# 0xa5 0x5a, the ID and the line, each low byte first, in the raw bytes
+# of a console capture.  Other bytes around them are skipped.  Each is
+# printed as FILE:LINE, the file named from the map and from the names
+# given, which are hashed as "id" does.
+
+import argparse
+import sys
+
+MAGIC = b'\xa5\x5a'
+
+
+def crc16(data):
+    crc = 0xffff
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xffff
+    return crc
+
+
+def file_id(name):
+    return crc16(name.encode())
+
+
+def read_map(path):
+    names = {}
+    with open(path) as f:
+        for line in f:
+            fields = line.split(None, 1)
+            if len(fields) == 2:
+                names[int(fields[0], 0)] = fields[1].strip()
+    return names
+
+
+def records(data):
+    i = data.find(MAGIC)
+    while i >= 0 and i + 6 <= len(data):
+        yield (data[i + 2] | data[i + 3] << 8,
+               data[i + 4] | data[i + 5] << 8)
+        i = data.find(MAGIC, i + 6)
+
+
+def cmd_id(opts):
+    seen = {}
+    status = 0
+    for name in opts.files:
+        n = file_id(name)
+        if n == 0 or seen.get(n, name) != name:
+            print('%s: ID 0x%04x is taken by %s' % (name, n,
+                  seen.get(n, 'files without an ID')), file=sys.stderr)
+            status = 1
+        seen[n] = name
+        if opts.flag:
+            print('-DASSERT_FILE_ID=0x%04x' % n)
+        else:
+            print('0x%04x %s' % (n, name))
+    return status
+
+
+def cmd_decode(opts):
+    names = read_map(opts.map) if opts.map else {}
+    for name in opts.files:
+        names[file_id(name)] = name
+    found = 0
+    for n, line in records(sys.stdin.buffer.read()):
+        if n == 0:
+            where = '(no ID)'
+        else:
+            where = names.get(n, 'ID 0x%04x' % n)
+        print('assertion failed: %s:%d' % (where, line))
+        found += 1
+    if not found:
+        print('no assertion records', file=sys.stderr)
+        return 1
+    return 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description='ASSERT_COMPACT file IDs.')
+    sub = ap.add_subparsers(dest='cmd', required=True)
+    p = sub.add_parser('id', help='print the IDs of source files')
+    p.add_argument('--flag', action='store_true',
+                   help='print them as compiler options')
+    p.add_argument('files', nargs='+')
+    p = sub.add_parser('decode', help='decode records read from stdin')
+    p.add_argument('--map', help='output of "id" to name the files from')
+    p.add_argument('files', nargs='*')
+    opts = ap.parse_args()
+    sys.exit(cmd_id(opts) if opts.cmd == 'id' else cmd_decode(opts))
+
+
+if __name__ == '__main__':
+    main()
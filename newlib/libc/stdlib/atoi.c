@@ -49,7 +49,11 @@ No supporting OS subroutines are required.
 int
 atoi (const char *s)
 {
+#if __SIZEOF_INT__ == 2
+  return strtoi16 (s, NULL, 10);
+#else
   return (int) strtol (s, NULL, 10);
+#endif
 }
 #endif /* !_REENT_ONLY */
 
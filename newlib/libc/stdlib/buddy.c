@@ -0,0 +1,217 @@
+/* Buddy allocators, see <buddy.h>.
+
+   The memory is split into up to BUDDY_UNITS units of at least two
+   pointers.  A block of order K is 2^K units and starts at a multiple
+   of its size from the base, which is aligned to the whole size, so
+   every block is aligned to its own size.  _map holds the order of
+   the block starting at each unit, and whether it is free; a free
+   block is on the doubly linked list of its order, through its first
+   two words, so its buddy can be taken off without a walk.  Like the
+   pool operations, these take the malloc lock: registered allocators
+   are also used by memalign and free.  */
+
+#include <_ansi.h>
+#include <newlib.h>
+#include <reent.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <malloc.h>
+#include <buddy.h>
+
+#define MAP_START	0x40
+#define MAP_FREE	0x80
+#define MAP_ORDER	0x0f
+
+struct link {
+  struct link *next;
+  struct link *prev;
+};
+
+#define BLOCK(b, u)	((struct link *) ((b)->_base + ((size_t) (u) << (b)->_shift)))
+#define UNIT(b, p)	((unsigned int) (((const char *) (p) - (b)->_base) >> (b)->_shift))
+
+static void
+push (buddy_t *b,
+	unsigned int order,
+	unsigned int u)
+{
+  struct link *l = BLOCK (b, u);
+
+  l->prev = NULL;
+  l->next = b->_free[order];
+  if (l->next != NULL)
+    l->next->prev = l;
+  b->_free[order] = l;
+  b->_map[u] = MAP_START | MAP_FREE | order;
+}
+
+static void
+unlink_block (buddy_t *b,
+	unsigned int order,
+	struct link *l)
+{
+  if (l->prev != NULL)
+    l->prev->next = l->next;
+  else
+    b->_free[order] = l->next;
+  if (l->next != NULL)
+    l->next->prev = l->prev;
+}
+
+size_t
+buddy_init (buddy_t *b,
+	void *buf,
+	size_t size)
+{
+  unsigned int shift = 0, k;
+  uintptr_t start = (uintptr_t) buf, base;
+  size_t whole = 0;
+
+  memset (b, 0, sizeof *b);
+  while (((size_t) 1 << shift) < 2 * sizeof (void *))
+    shift++;
+
+  /* The biggest power of two block of BUF aligned to its size */
+  for (k = sizeof (size_t) * 8 - 1; k >= shift; k--)
+    {
+      whole = (size_t) 1 << k;
+      base = (start + whole - 1) & ~(uintptr_t) (whole - 1);
+      if (base >= start && base - start <= size
+	  && size - (base - start) >= whole)
+	break;
+    }
+  if (k < shift)
+    return 0;
+
+  if (k - shift > BUDDY_ORDERS - 1)
+    shift = k - (BUDDY_ORDERS - 1);
+  b->_base = (char *) base;
+  b->_shift = shift;
+  b->_top = k - shift;
+  push (b, b->_top, 0);
+  return whole;
+}
+
+void *
+buddy_alloc (buddy_t *b,
+	size_t size,
+	size_t align)
+{
+  size_t need = size > align ? size : align;
+  unsigned int order = 0, j, u;
+  struct link *l;
+
+  if (b->_base == NULL)
+    return NULL;
+  while (order <= b->_top && ((size_t) 1 << (b->_shift + order)) < need)
+    order++;
+  if (order > b->_top)
+    return NULL;
+
+  __malloc_lock (_REENT);
+  for (j = order; j <= b->_top && b->_free[j] == NULL; j++)
+    ;
+  if (j > b->_top)
+    {
+      __malloc_unlock (_REENT);
+      return NULL;
+    }
+  l = b->_free[j];
+  unlink_block (b, j, l);
+  u = UNIT (b, l);
+
+  /* Keep the lower half, the upper one is its buddy.  */
+  while (j > order)
+    {
+      j--;
+      push (b, j, u + (1u << j));
+    }
+  b->_map[u] = MAP_START | order;
+  __malloc_unlock (_REENT);
+  return l;
+}
+
+void
+buddy_free (buddy_t *b,
+	void *p)
+{
+  unsigned int u, bu, order;
+
+  if (p == NULL)
+    return;
+
+  __malloc_lock (_REENT);
+  u = UNIT (b, p);
+  order = b->_map[u] & MAP_ORDER;
+  while (order < b->_top)
+    {
+      bu = u ^ (1u << order);
+      if (b->_map[bu] != (MAP_START | MAP_FREE | order))
+	break;
+      unlink_block (b, order, BLOCK (b, bu));
+      if (bu < u)
+	{
+	  b->_map[u] = 0;
+	  u = bu;
+	}
+      else
+	b->_map[bu] = 0;
+      order++;
+    }
+  push (b, order, u);
+  __malloc_unlock (_REENT);
+}
+
+int
+buddy_owns (const buddy_t *b,
+	const void *p)
+{
+  return b->_base != NULL && (const char *) p >= b->_base
+	 && (const char *) p < b->_base + ((size_t) 1 << (b->_shift + b->_top));
+}
+
+size_t
+buddy_size (const buddy_t *b,
+	const void *p)
+{
+  return (size_t) 1 << (b->_shift + (b->_map[UNIT (b, p)] & MAP_ORDER));
+}
+
+#ifdef _NANO_MALLOC
+/* Defined with nano_malloc.  */
+extern buddy_t *__malloc_buddies;
+#endif
+
+int
+buddy_register (buddy_t *b)
+{
+#ifdef _NANO_MALLOC
+  __malloc_lock (_REENT);
+  b->_next = __malloc_buddies;
+  __malloc_buddies = b;
+  __malloc_unlock (_REENT);
+  return 0;
+#else
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
+void
+buddy_unregister (buddy_t *b)
+{
+#ifdef _NANO_MALLOC
+  buddy_t **bp;
+
+  __malloc_lock (_REENT);
+  for (bp = &__malloc_buddies; *bp != NULL; bp = &(*bp)->_next)
+    if (*bp == b)
+      {
+	*bp = b->_next;
+	break;
+      }
+  b->_next = NULL;
+  __malloc_unlock (_REENT);
+#endif
+}
@@ -0,0 +1,293 @@
+/*
+FUNCTION
+<<csv_next_i32>>, <<csv_next_f32>>, <<csv_next_str>>---parse the fields of a record
+
+INDEX
+	csv_init
+INDEX
+	csv_next_i32
+INDEX
+	csv_next_f32
+INDEX
+	csv_next_str
+
+SYNOPSIS
+	#include <csv.h>
+	void csv_init(struct csv_cursor *<[c]>, const char *<[record]>,
+		      int <[sep]>);
+	int csv_next_i32(struct csv_cursor *<[c]>, int32_t *<[value]>);
+	int csv_next_f32(struct csv_cursor *<[c]>, float *<[value]>);
+	int csv_next_str(struct csv_cursor *<[c]>, char *<[buf]>,
+			 size_t <[size]>);
+
+DESCRIPTION
+These functions take the fields of a record of text one by one, each
+converting its field as it finds where it ends, so that every byte is
+looked at once, where splitting the record with <<strtok_r>> and then
+converting each field looks at the bytes two or three times.
+
+<<csv_init>> sets the cursor <[c]> at the start of <[record]>, a null
+terminated string whose fields are split by the character <[sep]>.
+The record ends at a newline, a carriage return or the null; quoted
+strings aside, a field cannot hold any of them.  Each of the other
+functions parses the next field and steps over it and the separator
+after it.  Once the last field of the record is taken, <[c]>-><<p>>
+points at the next record, past its newline or "\r\n", or at the null,
+so the lines of a buffer can be parsed in turn by passing it to
+<<csv_init>> again.
+
+<<csv_next_i32>> reads a decimal integer with an optional sign, and
+<<csv_next_f32>> a number as <<strtof>> does in the "C" locale, with
+`.' as the decimal point.  Spaces and tabs around the number are
+skipped, unless they are the separator.  No locale is consulted, and
+an integer is accumulated in 32 bits against constant limits.
+
+<<csv_next_str>> copies the field to <[buf]>, cut to <[size]> - 1
+characters and null terminated, as it is, or without the quotes if it
+is quoted, a doubled quote standing for one.  A quoted field can hold
+the separator and newlines.
+
+Neither allocates memory nor keeps any state outside <[c]>.
+
+RETURNS
+<<csv_next_i32>> and <<csv_next_f32>> return 0 and store the value, or
+one of these, which leave <<*<[value]>>> alone except as said:
+
+o+
+o <<CSV_END>>
+no field is left in the record; the cursor does not move.
+
+o <<CSV_EMPTY>>
+the field is empty or only blanks.
+
+o <<CSV_SYNTAX>>
+the field is not a number, or something follows the number.
+
+o <<CSV_RANGE>>
+the number does not fit; the largest value of the sign, or an
+infinity, is stored.
+o-
+
+<<csv_next_str>> returns the length of the field, which was cut if it
+is <[size]> or more, <<CSV_END>>, or <<CSV_SYNTAX>> if a quote is not
+closed or something follows the closing quote.
+
+PORTABILITY
+These functions are newlib extensions.
+<<csv_next_f32>> may set <<errno>> to <<ERANGE>>, as <<strtof>> does.
+
+No supporting OS subroutines are required.
+*/
+
+#define _GNU_SOURCE
+#include <_ansi.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <csv.h>
+#include "local.h"
+
+#define IS_BLANK(ch)	((ch) == ' ' || (ch) == '\t')
+#define IS_EOR(ch)	((ch) == '\0' || (ch) == '\n' || (ch) == '\r')
+
+void
+csv_init (struct csv_cursor *c,
+	const char *record,
+	int sep)
+{
+  c->p = record;
+  c->sep = (unsigned char) sep;
+  c->done = 0;
+}
+
+/* Blanks that are not the separator.  */
+static const unsigned char *
+skip_blanks (const struct csv_cursor *c,
+	const unsigned char *s)
+{
+  while (IS_BLANK (*s) && *s != c->sep)
+    s++;
+  return s;
+}
+
+/* End the field whose value ended at S: after blanks, anything but
+   the separator or the end of the record makes STATUS CSV_SYNTAX and
+   is skipped.  Leave the cursor after the separator, or at the next
+   record.  */
+static int
+field_end (struct csv_cursor *c,
+	const unsigned char *s,
+	int status)
+{
+  for (s = skip_blanks (c, s); *s != c->sep; s++)
+    if (IS_EOR (*s))
+      {
+	if (*s == '\r')
+	  s++;
+	if (*s == '\n')
+	  s++;
+	c->p = (const char *) s;
+	c->done = 1;
+	return status;
+      }
+    else
+      status = CSV_SYNTAX;
+  c->p = (const char *) s + 1;
+  return status;
+}
+
+static int
+field_empty (const struct csv_cursor *c,
+	const unsigned char *s)
+{
+  return *s == c->sep || IS_EOR (*s);
+}
+
+int
+csv_next_i32 (struct csv_cursor *c,
+	__int32_t *value)
+{
+  const unsigned char *s = (const unsigned char *) c->p;
+  __uint32_t acc = 0;
+  unsigned int cutlim = 7;
+  int neg = 0, any = 0, status = 0;
+
+  if (c->done)
+    return CSV_END;
+  s = skip_blanks (c, s);
+  if (field_empty (c, s))
+    return field_end (c, s, CSV_EMPTY);
+  if (*s == '-')
+    {
+      neg = 1;
+      cutlim = 8;
+      s++;
+    }
+  else if (*s == '+')
+    s++;
+
+  /* 2147483647 and 2147483648 are 214748364 tens and 7 or 8.  */
+  for (; *s >= '0' && *s <= '9'; s++)
+    {
+      unsigned int d = *s - '0';
+
+      any = 1;
+      if (acc > 214748364UL || (acc == 214748364UL && d > cutlim))
+	status = CSV_RANGE;
+      else
+	acc = acc * 10 + d;
+    }
+  if (!any)
+    status = CSV_SYNTAX;
+  status = field_end (c, s, status);
+
+  if (status == CSV_RANGE)
+    acc = 214748364UL * 10 + cutlim;
+  else if (status != 0)
+    return status;
+  *value = neg ? (__int32_t) (0 - acc) : (__int32_t) acc;
+  return status;
+}
+
+#ifndef _REENT_ONLY
+
+int
+csv_next_f32 (struct csv_cursor *c,
+	float *value)
+{
+  const unsigned char *s = (const unsigned char *) c->p;
+  const unsigned char *digits;
+  char *end;
+  float f = 0;
+  int status = 0;
+
+  if (c->done)
+    return CSV_END;
+  s = skip_blanks (c, s);
+  if (field_empty (c, s))
+    return field_end (c, s, CSV_EMPTY);
+
+  /* Nothing below a space, so that strtof skips no white space.  */
+  if (*s > ' ')
+    {
+      f = strtof_l ((const char *) s, &end, __get_C_locale ());
+      digits = s + (*s == '-' || *s == '+');
+      if ((const unsigned char *) end == s)
+	status = CSV_SYNTAX;
+      else if (isinf (f) && (*digits == '.' || (*digits >= '0'
+						&& *digits <= '9')))
+	status = CSV_RANGE;
+      s = (const unsigned char *) end;
+    }
+  else
+    status = CSV_SYNTAX;
+  status = field_end (c, s, status);
+
+  if (status == 0 || status == CSV_RANGE)
+    *value = f;
+  return status;
+}
+
+#endif /* !_REENT_ONLY */
+
+int
+csv_next_str (struct csv_cursor *c,
+	char *buf,
+	size_t size)
+{
+  const unsigned char *s = (const unsigned char *) c->p;
+  const unsigned char *start;
+  size_t n = 0, k;
+  int status = 0;
+
+  if (c->done)
+    return CSV_END;
+
+  if (*s == '"')
+    {
+      /* Copy between the doubled quotes.  */
+      for (start = ++s;; s++)
+	{
+	  if (*s == '\0')
+	    {
+	      status = CSV_SYNTAX;
+	      break;
+	    }
+	  if (*s != '"')
+	    continue;
+	  k = s - start;
+	  if (n < size)
+	    memcpy (buf + n, start, k < size - n ? k : size - n);
+	  n += k;
+	  if (s[1] != '"')
+	    {
+	      s++;
+	      break;
+	    }
+	  start = ++s;
+	}
+      if (status != 0)
+	{
+	  k = s - start;
+	  if (n < size)
+	    memcpy (buf + n, start, k < size - n ? k : size - n);
+	  n += k;
+	}
+    }
+  else
+    {
+      for (start = s; *s != c->sep && !IS_EOR (*s); s++)
+	;
+      n = s - start;
+      if (size != 0)
+	memcpy (buf, start, n < size ? n : size);
+    }
+  if (size != 0)
+    buf[n < size ? n : size - 1] = '\0';
+
+  status = field_end (c, s, status);
+  if (status != 0)
+    return status;
+  return n < INT_MAX ? (int) n : INT_MAX;
+}
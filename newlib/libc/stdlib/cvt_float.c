@@ -0,0 +1,247 @@
+/* __cvt_float -- exact decimal digits of a float, on the stack.
+
+   A float is converted with 16-bit limbs on the stack instead of by
+   _dtoa_r and its Bigints on the heap: the integer part is cut into
+   four digits at a time by dividing by 10000, and the fraction gives
+   four more at a time by multiplying by 10000.  The %.Nf of a value
+   with a fraction, for N of up to 9, takes a single integer rounding
+   instead.  nano printf, ecvt, fcvt and gcvt use it for values that
+   are floats.  */
+
+#include <_ansi.h>
+#include <stdlib.h>
+#include <string.h>
+#include "local.h"
+
+/* The integer part of a float is below 2^128 and its fraction has at
+   most 149 bits.  */
+#define FCVT_ILIMBS	8
+#define FCVT_FLIMBS	10
+
+/* The most fraction digits %f takes with a single integer rounding:
+   the 24-bit significand times 10^9 still fits in 64 bits.  */
+#define FCVT_FASTDIG	9
+
+static const __uint32_t fcvt_pow10[FCVT_FASTDIG + 1] =
+{
+  1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL,
+  100000000UL, 1000000000UL
+};
+
+struct fcvt
+{
+  __uint16_t f[FCVT_FLIMBS];	/* The fraction, least significant limb
+				   first, with the point above the last.  */
+  int lo;			/* f[0] to f[lo - 1] are zero.  */
+  char d[40];			/* The digits of the integer part, then
+				   of the fraction four at a time.  */
+  int at, nd;			/* The digits d[at] to d[nd - 1] are next.  */
+};
+
+/* Set the limbs V to M times 2^POS.  */
+static void
+fcvt_place (__uint16_t *v, int nv, __uint32_t m, int pos)
+{
+  int i = pos / 16, s = pos % 16;
+
+  memset (v, 0, nv * sizeof (*v));
+  v[i] = (__uint16_t) (m << s);
+  m >>= 16 - s;
+  if (++i < nv)
+    v[i] = (__uint16_t) m;
+  if (++i < nv)
+    v[i] = (__uint16_t) (m >> 16);
+}
+
+/* Return the next digit of the value, or -1 if all the rest are
+   zero.  */
+static int
+fcvt_next (struct fcvt *s)
+{
+  __uint32_t t;
+  __uint16_t carry;
+  int i;
+
+  if (s->at == s->nd)
+    {
+      if (s->lo == FCVT_FLIMBS)
+	return -1;
+      for (carry = 0, i = s->lo; i < FCVT_FLIMBS; i++)
+	{
+	  t = (__uint32_t) s->f[i] * 10000 + carry;
+	  s->f[i] = (__uint16_t) t;
+	  carry = t >> 16;
+	}
+      while (s->lo < FCVT_FLIMBS && s->f[s->lo] == 0)
+	s->lo++;
+      for (i = 4; i-- > 0; carry /= 10)
+	s->d[i] = carry % 10;
+      s->at = 0;
+      s->nd = 4;
+    }
+  return s->d[s->at++];
+}
+
+/* Whether any digit after the last one returned is nonzero.  */
+static int
+fcvt_rest (struct fcvt *s)
+{
+  int i;
+
+  for (i = s->at; i < s->nd; i++)
+    if (s->d[i])
+      return 1;
+  return s->lo < FCVT_FLIMBS;
+}
+
+/* The digits of the finite, positive float with the bits BITS, as
+   _dtoa_r gives them: in mode 3 when FMODE, to NDIGITS places after
+   the point, and in mode 2 otherwise, NDIGITS of them in all, which
+   must then be at least 1.  They go into BUF, of FCVT_MAXDIG + 1
+   bytes, without trailing zeros, and the point goes after the first
+   *DECPT of them.  The digits are correctly rounded, ties to even, as
+   _dtoa_r rounds them.  Returns how many there are, which is never
+   more than FCVT_MAXDIG whatever NDIGITS asks for: every digit past
+   those is a zero, for the caller to pad with.  */
+int
+__cvt_float (__uint32_t bits, int ndigits, int fmode, int *decpt, char *buf)
+{
+  struct fcvt s;
+  __uint16_t v[FCVT_ILIMBS];
+  __uint32_t m = bits & 0x7fffff, t;
+  int e = (bits >> 23) & 0xff;
+  int i, top, c, n, want;
+
+  if (e == 0 && m == 0)
+    {
+      buf[0] = '0';
+      buf[1] = '\0';
+      *decpt = 1;
+      return 1;
+    }
+  if (e)
+    m |= 0x800000;
+  else
+    e = 1;
+  e -= 150;
+
+  /* %.Nf of a value with a fraction, the common "%.2f": M * 10^N is
+     exact in 64 bits, and one shift rounds it to the integer whose
+     digits are the ones to print.  */
+  if (fmode && ndigits >= 0 && ndigits <= FCVT_FASTDIG && e < 0)
+    {
+      __uint64_t x = (__uint64_t) m * fcvt_pow10[ndigits], q, half;
+
+      if (-e < 64)
+	{
+	  q = x >> -e;
+	  half = (__uint64_t) 1 << (-e - 1);
+	  x &= 2 * half - 1;
+	  if (x > half || (x == half && (q & 1)))
+	    q++;
+	}
+      else
+	q = 0;
+      if (q == 0)
+	{
+	  *decpt = -ndigits;
+	  buf[0] = '\0';
+	  return 0;
+	}
+      n = buf + FCVT_MAXDIG - __u64toa (buf + FCVT_MAXDIG, q);
+      memmove (buf, buf + FCVT_MAXDIG - n, n);
+      *decpt = n - ndigits;
+      while (buf[n - 1] == '0')
+	n--;
+      buf[n] = '\0';
+      return n;
+    }
+
+  /* Split the value M * 2^E into its integer part V and its fraction
+     F.  */
+  if (e >= 0)
+    {
+      fcvt_place (v, FCVT_ILIMBS, m, e);
+      s.lo = FCVT_FLIMBS;
+    }
+  else
+    {
+      fcvt_place (v, FCVT_ILIMBS, -e < 24 ? m >> -e : 0, 0);
+      fcvt_place (s.f, FCVT_FLIMBS,
+		  -e < 24 ? m & ((1UL << -e) - 1) : m, 16 * FCVT_FLIMBS + e);
+      for (s.lo = 0; s.lo < FCVT_FLIMBS && s.f[s.lo] == 0; s.lo++)
+	;
+    }
+
+  /* The digits of the integer part, four at a time from the end.  */
+  s.at = s.nd = sizeof (s.d);
+  for (top = FCVT_ILIMBS - 1; top >= 0 && v[top] == 0; top--)
+    ;
+  while (top >= 0)
+    {
+      for (t = 0, i = top; i >= 0; i--)
+	{
+	  t = (t << 16) | v[i];
+	  v[i] = t / 10000;
+	  t %= 10000;
+	}
+      if (v[top] == 0)
+	top--;
+      for (i = 4; i-- > 0; t /= 10)
+	s.d[--s.at] = t % 10;
+    }
+  while (s.at < s.nd && s.d[s.at] == 0)
+    s.at++;
+
+  /* Find the first significant digit.  */
+  *decpt = s.nd - s.at;
+  while ((c = fcvt_next (&s)) == 0)
+    if (--*decpt < -ndigits && fmode)
+      {
+	/* Below half the last place %f shows.  */
+	*decpt = -ndigits;
+	buf[0] = '\0';
+	return 0;
+      }
+
+  /* The digits come four at a time, so stop at the most a float has
+     rather than run past BUF into the zeros after them.  */
+  want = fmode ? *decpt + ndigits : ndigits;
+  if (want > FCVT_MAXDIG)
+    want = FCVT_MAXDIG;
+  n = 0;
+  if (want > 0)
+    {
+      buf[n++] = c;
+      while (n < want && (c = fcvt_next (&s)) >= 0)
+	buf[n++] = c;
+      c = n == want ? fcvt_next (&s) : -1;
+    }
+  else if (want < 0)
+    {
+      /* Below half the last place, which is left of the first digit.  */
+      *decpt = -ndigits;
+      c = 0;
+    }
+
+  /* Round the digit C and the rest away.  */
+  if (c > 5 || (c == 5 && (fcvt_rest (&s) || (n && (buf[n - 1] & 1)))))
+    {
+      while (n > 0 && buf[n - 1] == 9)
+	n--;
+      if (n == 0)
+	{
+	  buf[n++] = 1;
+	  ++*decpt;
+	}
+      else
+	buf[n - 1]++;
+    }
+
+  while (n > 0 && buf[n - 1] == 0)
+    n--;
+  for (i = 0; i < n; i++)
+    buf[i] = buf[i] + '0';
+  buf[n] = '\0';
+  return n;
+}
@@ -51,12 +51,55 @@ Supporting OS subroutines required: <<close>>, <<fstat>>, <<isatty>>,
 */
 
 #include <_ansi.h>
+#include <float.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include <reent.h>
 #include "mprec.h"
 #include "local.h"
 
+/* _dtoa_r in MODE 2 or 3, except that a value that is a float is
+   converted into BUF without Bigints.  BUF takes FCVT_MAXDIG digits
+   and a NUL however large NDIGIT is: the digits past those are zeros,
+   and are left for the caller to pad with as it does the trailing
+   zeros _dtoa_r drops.  */
+static char *
+cvt (struct _reent *ptr,
+	double value,
+	int mode,
+	int ndigit,
+	int *decpt,
+	int *sign,
+	char **end,
+	char *buf)
+{
+  union
+  {
+    float f;
+    __uint32_t i;
+  } fv;
+  char *p;
+
+  *sign = signbit (value) != 0;
+  if (!isfinite (value))
+    {
+      *decpt = 9999;
+      p = isinf (value) ? "Infinity" : "NaN";
+      *end = p + strlen (p);
+      return p;
+    }
+  fv.f = (float) value;
+#if DBL_MANT_DIG > FLT_MANT_DIG
+  if (fv.f != value)
+    return _dtoa_r (ptr, value, mode, ndigit, decpt, sign, end);
+#endif
+  if (mode == 2 && ndigit <= 0)
+    ndigit = 1;
+  *end = buf + __cvt_float (fv.i & 0x7fffffff, ndigit, mode == 3, decpt, buf);
+  return buf;
+}
+
 static void
 print_f (struct _reent *ptr,
 	char *buf,
@@ -69,8 +112,9 @@ print_f (struct _reent *ptr,
   int decpt;
   int sign;
   char *p, *start, *end;
+  char digits[FCVT_MAXDIG + 1];
 
-  start = p = _dtoa_r (ptr, invalue, mode, ndigit, &decpt, &sign, &end);
+  start = p = cvt (ptr, invalue, mode, ndigit, &decpt, &sign, &end, digits);
 
   if (decpt == 9999)
     {
@@ -139,8 +183,9 @@ print_e (struct _reent *ptr,
   int decpt;
   int top;
   int ndigit = width;
+  char digits[FCVT_MAXDIG + 1];
 
-  p = _dtoa_r (ptr, invalue, 2, width + 1, &decpt, &sign, &end);
+  p = cvt (ptr, invalue, 2, width + 1, &decpt, &sign, &end, digits);
 
   if (decpt == 9999)
     {
@@ -227,6 +272,7 @@ fcvtbuf (double invalue,
   char *p;
   char *end;
   int done = 0;
+  char digits[FCVT_MAXDIG + 1];
 
   if (fcvt_buf == NULL)
     {
@@ -244,7 +290,7 @@ fcvtbuf (double invalue,
 
   save = fcvt_buf;
 
-  p = _dtoa_r (reent, invalue, 3, ndigit, decpt, sign, &end);
+  p = cvt (reent, invalue, 3, ndigit, decpt, sign, &end, digits);
 
   /* Now copy */
 
@@ -276,6 +322,7 @@ ecvtbuf (double invalue,
   char *p;
   char *end;
   int done = 0;
+  char digits[FCVT_MAXDIG + 1];
 
   if (fcvt_buf == NULL)
     {
@@ -293,7 +340,7 @@ ecvtbuf (double invalue,
 
   save = fcvt_buf;
 
-  p = _dtoa_r (reent, invalue, 2, ndigit, decpt, sign, &end);
+  p = cvt (reent, invalue, 2, ndigit, decpt, sign, &end, digits);
 
   /* Now copy */
 
@@ -323,12 +370,18 @@ _gcvt (struct _reent *ptr,
 	int dot)
 {
   char *save = buf;
+  double tens;
+  int i;
 
   if (invalue < 0)
     {
       invalue = -invalue;
     }
 
+  /* 10^ndigit, as _mprec_log10 makes it, without linking mprec.  */
+  for (tens = 1, i = ndigit; i > 0; i--)
+    tens *= 10;
+
   if (invalue == 0)
     {
       *buf++ = '0';
@@ -340,7 +393,7 @@ _gcvt (struct _reent *ptr,
        than precision digits before is printed in e with the qualification
        that trailing zeroes are removed from the fraction portion.  */
 
-  if (0.0001 >= invalue || invalue >= _mprec_log10 (ndigit))
+  if (0.0001 >= invalue || invalue >= tens)
     {
       /* We subtract 1 from ndigit because in the 'e' format the precision is
 	 the number of digits after the . but in 'g' format it is the number
@@ -357,11 +410,12 @@ _gcvt (struct _reent *ptr,
       int sign;
       char *end;
       char *p;
+      char digits[FCVT_MAXDIG + 1];
 
       /* We always want ndigits of precision, even if that means printing
        * a bunch of leading zeros for numbers < 1.0
        */
-      p = _dtoa_r (ptr, invalue, 2, ndigit, &decpt, &sign, &end);
+      p = cvt (ptr, invalue, 2, ndigit, &decpt, &sign, &end, digits);
 
       if (decpt == 9999)
 	{
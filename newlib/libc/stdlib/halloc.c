@@ -0,0 +1,319 @@
+/* Relocatable blocks through handles, see <halloc.h>.
+
+   The zone is a single malloc chunk.  Blocks sit back to back from
+   _start up to _top and nothing lies between _top and _end.  Every
+   block begins with a header holding its size, header included, the
+   master pointer that refers to it, NULL once the block is free, and
+   its lock count.  A handle is the address of a master pointer.  The
+   master pointers come from malloc in groups and never move; free
+   ones are chained through themselves.
+
+   The zone itself can only be moved by realloc while no block is
+   locked, so while one is, halloc has to make do with compaction.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <errno.h>
+#include <string.h>
+#include <stdint.h>
+#include <malloc.h>
+#include <halloc.h>
+
+#define MASTERS_PER_GROUP 8
+
+typedef struct hblock {
+  size_t _size;
+  void **_master;
+  unsigned int _locks;
+} hblock_t;
+
+#define ROUND(s) \
+  (((s) + HALLOC_ALIGN - 1) & ~(size_t) (HALLOC_ALIGN - 1))
+#define HDR_SIZE ROUND (sizeof (hblock_t))
+#define BLOCK(h) ((hblock_t *) ((char *) *(h) - HDR_SIZE))
+#define NEXT(b) ((hblock_t *) ((char *) (b) + (b)->_size))
+
+static struct {
+  char *_mem;			/* as returned by malloc */
+  char *_start;
+  char *_top;
+  char *_end;
+  unsigned int _locked;		/* blocks with a nonzero lock count */
+  void **_free_masters;
+} zone;
+
+static void **
+new_master (struct _reent *ptr)
+{
+  void **m = zone._free_masters;
+  int i;
+
+  if (m != NULL)
+    {
+      zone._free_masters = (void **) *m;
+      return m;
+    }
+
+  m = (void **) _malloc_r (ptr, MASTERS_PER_GROUP * sizeof (void *));
+  if (m == NULL)
+    return NULL;
+  for (i = 1; i < MASTERS_PER_GROUP - 1; i++)
+    m[i] = &m[i + 1];
+  m[MASTERS_PER_GROUP - 1] = NULL;
+  zone._free_masters = &m[1];
+  return m;
+}
+
+static void
+free_master (void **m)
+{
+  *m = zone._free_masters;
+  zone._free_masters = m;
+}
+
+/* Give the zone room for WANT bytes of blocks, moving it if need be.
+   Only called with no block locked.  */
+static int
+zone_resize (struct _reent *ptr,
+	size_t want)
+{
+  size_t used = zone._top - zone._start;
+  size_t offset = zone._start - zone._mem;
+  char *mem, *start, *old;
+  hblock_t *b;
+
+  if (want == 0)
+    {
+      _free_r (ptr, zone._mem);
+      zone._mem = zone._start = zone._top = zone._end = NULL;
+      return 1;
+    }
+
+  mem = (char *) _realloc_r (ptr, zone._mem, want + HALLOC_ALIGN - 1);
+  if (mem == NULL)
+    return 0;
+
+  /* realloc keeps the offset of the blocks in the chunk, which may no
+     longer be the one that aligns them.  */
+  start = (char *) ROUND ((uintptr_t) mem);
+  old = mem + offset;
+  if (old != start)
+    memmove (start, old, used);
+
+  zone._mem = mem;
+  if (start != zone._start)
+    {
+      zone._start = start;
+      zone._top = start + used;
+      for (b = (hblock_t *) start; (char *) b < zone._top; b = NEXT (b))
+	if (b->_master != NULL)
+	  *b->_master = (char *) b + HDR_SIZE;
+    }
+  zone._end = start + want;
+  return 1;
+}
+
+/* Find SIZE bytes, header included, first fit among the free blocks
+   and then above _top.  Neighbouring free blocks are merged on the
+   way and a free run that ends at _top is handed back to it.  */
+static hblock_t *
+take (size_t size)
+{
+  hblock_t *b, *n;
+
+  for (b = (hblock_t *) zone._start; (char *) b < zone._top; b = NEXT (b))
+    {
+      if (b->_master != NULL)
+	continue;
+      while ((char *) (n = NEXT (b)) < zone._top && n->_master == NULL)
+	b->_size += n->_size;
+      if ((char *) n == zone._top)
+	{
+	  zone._top = (char *) b;
+	  break;
+	}
+      if (b->_size >= size)
+	{
+	  if (b->_size - size >= HDR_SIZE)
+	    {
+	      n = (hblock_t *) ((char *) b + size);
+	      n->_size = b->_size - size;
+	      n->_master = NULL;
+	      b->_size = size;
+	    }
+	  return b;
+	}
+    }
+
+  if (size > (size_t) (zone._end - zone._top))
+    return NULL;
+  b = (hblock_t *) zone._top;
+  b->_size = size;
+  zone._top += size;
+  return b;
+}
+
+/* Slide the unlocked blocks down over the free ones.  A locked block
+   stays put and the space below it becomes one free block.  */
+static void
+compact (void)
+{
+  hblock_t *b, *n;
+  char *dst = zone._start;
+
+  for (b = (hblock_t *) zone._start; (char *) b < zone._top; b = n)
+    {
+      n = NEXT (b);
+      if (b->_master == NULL)
+	continue;
+      if (b->_locks != 0)
+	{
+	  if ((char *) b != dst)
+	    {
+	      ((hblock_t *) dst)->_size = (char *) b - dst;
+	      ((hblock_t *) dst)->_master = NULL;
+	    }
+	  dst = (char *) n;
+	  continue;
+	}
+      if ((char *) b != dst)
+	{
+	  memmove (dst, b, b->_size);
+	  b = (hblock_t *) dst;
+	  *b->_master = dst + HDR_SIZE;
+	}
+      dst += b->_size;
+    }
+  zone._top = dst;
+}
+
+/* The largest request take can meet at present */
+static size_t
+largest_free (void)
+{
+  hblock_t *b;
+  size_t largest = zone._end - zone._top;
+
+  for (b = (hblock_t *) zone._start; (char *) b < zone._top; b = NEXT (b))
+    if (b->_master == NULL && b->_size > largest)
+      largest = b->_size;
+  return largest > HDR_SIZE ? largest - HDR_SIZE : 0;
+}
+
+handle_t
+halloc (size_t size)
+{
+  struct _reent *ptr = _REENT;
+  hblock_t *b;
+  void **m;
+  size_t need, want;
+
+  if (size > (size_t) -1 / 2)
+    {
+      ptr->_errno = ENOMEM;
+      return NULL;
+    }
+  need = HDR_SIZE + ROUND (size);
+
+  __malloc_lock (ptr);
+  m = new_master (ptr);
+  b = NULL;
+  if (m != NULL)
+    {
+      b = take (need);
+      if (b == NULL)
+	{
+	  compact ();
+	  b = take (need);
+	}
+      if (b == NULL && zone._locked == 0)
+	{
+	  /* Grow by half as much again to make the copies rare */
+	  want = (zone._top - zone._start) + need;
+	  if ((want + want / 2 > want && zone_resize (ptr, want + want / 2))
+	      || zone_resize (ptr, want))
+	    b = take (need);
+	}
+      if (b == NULL)
+	free_master (m);
+    }
+  if (b == NULL)
+    {
+      __malloc_unlock (ptr);
+      ptr->_errno = ENOMEM;
+      return NULL;
+    }
+  b->_master = m;
+  b->_locks = 0;
+  *m = (char *) b + HDR_SIZE;
+  __malloc_unlock (ptr);
+  return m;
+}
+
+void
+hfree (handle_t h)
+{
+  struct _reent *ptr = _REENT;
+  hblock_t *b;
+
+  if (h == NULL)
+    return;
+
+  __malloc_lock (ptr);
+  b = BLOCK (h);
+  if (b->_locks != 0)
+    zone._locked--;
+  b->_master = NULL;
+  if ((char *) NEXT (b) == zone._top)
+    zone._top = (char *) b;
+  free_master (h);
+  __malloc_unlock (ptr);
+}
+
+void *
+hlock (handle_t h)
+{
+  struct _reent *ptr = _REENT;
+  void *p;
+
+  __malloc_lock (ptr);
+  if (BLOCK (h)->_locks++ == 0)
+    zone._locked++;
+  p = *h;
+  __malloc_unlock (ptr);
+  return p;
+}
+
+void
+hunlock (handle_t h)
+{
+  struct _reent *ptr = _REENT;
+  hblock_t *b;
+
+  __malloc_lock (ptr);
+  b = BLOCK (h);
+  if (b->_locks != 0 && --b->_locks == 0)
+    zone._locked--;
+  __malloc_unlock (ptr);
+}
+
+size_t
+hsize (handle_t h)
+{
+  return BLOCK (h)->_size - HDR_SIZE;
+}
+
+size_t
+hcompact (void)
+{
+  struct _reent *ptr = _REENT;
+  size_t largest;
+
+  __malloc_lock (ptr);
+  compact ();
+  if (zone._locked == 0 && zone._mem != NULL)
+    zone_resize (ptr, zone._top - zone._start);
+  largest = largest_free ();
+  __malloc_unlock (ptr);
+  return largest;
+}
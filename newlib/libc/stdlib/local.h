@@ -5,8 +5,27 @@
 
 char *	_gcvt (struct _reent *, double , int , char *, char, int);
 
+/* The decimal digits of a value, ending just before the first
+   argument; returns the first digit.  See u32toa.c.  */
+char *	__u16toa (char *, __uint16_t);
+char *	__u32toa (char *, __uint32_t);
+char *	__u64toa (char *, __uint64_t);
+
+/* The most significant digits the decimal expansion of a float can
+   have, which are those of (2^24 - 1) * 2^-149.  */
+#define FCVT_MAXDIG	112
+
+/* The digits of a float with no Bigints.  See cvt_float.c.  */
+int	__cvt_float (__uint32_t, int, int, int *, char *);
+
 #include "../locale/setlocale.h"
 
+#ifdef _DOUBLE_IS_32BITS
+/* strtod for a float-sized double, see strtodf.c.  */
+float	__strtodf (struct _reent *, const char *__restrict, char **__restrict,
+		   locale_t);
+#endif
+
 #ifndef __machine_mbstate_t_defined
 #include <wchar.h>
 #endif
@@ -29,7 +48,11 @@ wctomb_f __big5_wctomb;
 #endif
 #endif
 
+#ifdef _WANT_C_LOCALE_ONLY
+#define __WCTOMB __ascii_wctomb
+#else
 #define __WCTOMB (__get_current_locale ()->wctomb)
+#endif
 
 typedef int mbtowc_f (struct _reent *, wchar_t *, const char *, size_t,
 		      mbstate_t *);
@@ -50,7 +73,18 @@ mbtowc_f __big5_mbtowc;
 #endif
 #endif
 
+#ifdef _WANT_C_LOCALE_ONLY
+#define __MBTOWC __ascii_mbtowc
+#else
 #define __MBTOWC (__get_current_locale ()->mbtowc)
+#endif
+
+/* The decimal point printf and scanf use.  */
+#ifdef _WANT_C_LOCALE_ONLY
+#define __DECIMAL_POINT(ptr) ((char *) ".")
+#else
+#define __DECIMAL_POINT(ptr) (_localeconv_r (ptr)->decimal_point)
+#endif
 
 extern wchar_t __iso_8859_conv[14][0x60];
 int __iso_8859_val_index (int);
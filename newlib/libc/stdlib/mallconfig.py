@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+#
+# mallconfig.py -- size classes and pools for nano-malloc from a profile.
+#
+# usage: mallconfig.py [options] INPUT... -o malloc_config.h
+#
+# Each INPUT is either the text of malloc_trace_dump, as malltrace.py
+# reads it, or a histogram of request sizes, one "SIZE COUNT [PEAK]"
+# line per size, PEAK being the most blocks of that size ever live at
+# once; '#' starts a comment.  A histogram is what a program that
+# counts its own requests can print without the trace.
+#
+# The header written configures a libc built with
+#
+#	-DNANO_MALLOC_BINS -DNANO_MALLOC_CONFIG='"malloc_config.h"'
+#
+# MALLOC_BIN_SIZES gets the --bins classes, up to --bin-max bytes,
+# that waste the fewest bytes over the requests rounded up to them.
+# MALLOC_CONFIG_POOLS gets a pool for each of the --pools sizes asked
+# for most often, as long as each has --pool-share of the requests,
+# with room for the peak of its blocks live at once plus --headroom.
+# The peak is replayed from a trace; a histogram without PEAK gets no
+# pools.  A block of a pool serves every request up to its size that
+# the next smaller pool does not, so the peak counted is that of the
+# requests between the two.  Region storage, which a trace does not
+# record, is passed through from --region ID=BYTES into
+# MALLOC_CONFIG_REGIONS.  The comments of the header give the share
+# of requests binned and pooled and the split of the memory between
+# the pools, the regions and the heap the trace peaked at.
+
+import argparse
+import collections
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import malltrace                # noqa: E402
+
+HIST = re.compile(r'^\s*(\d+)\s+(\d+)(?:\s+(\d+))?\s*$')
+
+
+def round_up(n, a):
+    return (n + a - 1) // a * a
+
+
+def read_input(path, counts, peaks, events):
+    """Add the requests of PATH to COUNTS, and its PEAKs or events."""
+    with open(path, errors='replace') as f:
+        text = f.read()
+    if re.search(r'^malloc trace \d+\s*$', text, re.M):
+        _, ev = malltrace.read_dump(path)
+        for op, ptr, size, caller, time in ev:
+            if op in ('malloc', 'realloc') and size:
+                counts[size] += 1
+        events.append(ev)
+        return
+    for line in text.splitlines():
+        line = line.split('#', 1)[0]
+        if not line.strip():
+            continue
+        m = HIST.match(line)
+        if not m:
+            sys.exit('%s: not a trace or a histogram: %s' % (path, line))
+        size, n = int(m.group(1)), int(m.group(2))
+        counts[size] += n
+        if m.group(3) is not None:
+            peaks[size] = max(peaks.get(size, 0), int(m.group(3)))
+
+
+def choose_classes(counts, k, top, align):
+    """Up to K classes ending with the largest request up to TOP; the
+    classes and the bytes they waste."""
+    w = collections.Counter()
+    for size, n in counts.items():
+        if size <= top:
+            w[round_up(max(size, 1), align)] += n
+    cand = sorted(w)
+    if not cand:
+        return [], 0
+    k = min(k, len(cand))
+    # Prefix sums make the waste of a class over a run of sizes O(1).
+    cnt, byt = [0], [0]
+    for c in cand:
+        cnt.append(cnt[-1] + w[c])
+        byt.append(byt[-1] + w[c] * c)
+
+    def waste(i, j):
+        """cand[i..j] rounded up to cand[j]."""
+        return (cnt[j + 1] - cnt[i]) * cand[j] - (byt[j + 1] - byt[i])
+
+    inf = float('inf')
+    n = len(cand)
+    best = [[inf] * n for _ in range(k + 1)]
+    back = [[-1] * n for _ in range(k + 1)]
+    for j in range(n):
+        best[1][j] = waste(0, j)
+    for c in range(2, k + 1):
+        for j in range(c - 1, n):
+            for i in range(c - 2, j):
+                v = best[c - 1][i] + waste(i + 1, j)
+                if v < best[c][j]:
+                    best[c][j], back[c][j] = v, i
+    classes, j, c = [], n - 1, k
+    while c >= 1:
+        classes.append(cand[j])
+        j, c = back[c][j], c - 1
+    classes.reverse()
+    return classes, best[k][n - 1]
+
+
+def choose_pools(counts, npools, share, align):
+    total = sum(counts.values())
+    by_block = collections.Counter()
+    for size, n in counts.items():
+        by_block[round_up(max(size, 1), align)] += n
+    picked = [b for b, n in by_block.most_common(npools)
+              if total and n >= share * total]
+    return sorted(picked)
+
+
+def pool_of(size, pools):
+    for b in pools:
+        if size <= b:
+            return b
+    return None
+
+
+def replay_peaks(events, pools):
+    """The most blocks served by each pool live at once, and the peak
+    of the live bytes, over each trace."""
+    peak = collections.Counter()
+    heap = 0
+    for ev in events:
+        live, now, nbytes, top = {}, collections.Counter(), 0, 0
+        for op, ptr, size, caller, time in ev:
+            if op in ('free', 'realloc-from'):
+                old = live.pop(ptr, None)
+                if old is not None:
+                    nbytes -= old
+                    b = pool_of(old, pools)
+                    if b:
+                        now[b] -= 1
+            elif op in ('malloc', 'realloc') and ptr:
+                live[ptr] = size
+                nbytes += size
+                top = max(top, nbytes)
+                b = pool_of(size, pools)
+                if b:
+                    now[b] += 1
+                    peak[b] = max(peak[b], now[b])
+        heap = max(heap, top)
+    return peak, heap
+
+
+def hist_peaks(peaks, pools):
+    peak = collections.Counter()
+    for size, n in peaks.items():
+        b = pool_of(size, pools)
+        if b:
+            peak[b] += n
+    return peak
+
+
+def main():
+    ap = argparse.ArgumentParser(
+        description='Tune nano-malloc to an allocation profile.')
+    ap.add_argument('inputs', nargs='+', metavar='INPUT')
+    ap.add_argument('-o', '--output', default='malloc_config.h')
+    ap.add_argument('--bins', type=int, default=6,
+                    help='number of size classes, MALLOC_BIN_COUNT')
+    ap.add_argument('--bin-max', type=int, default=64,
+                    help='largest request to bin')
+    ap.add_argument('--align', type=int, default=2,
+                    help='CHUNK_ALIGN of the target, 2 for pic30')
+    ap.add_argument('--pools', type=int, default=2,
+                    help='most pools to set up')
+    ap.add_argument('--pool-share', type=float, default=0.1,
+                    help='least share of the requests a pool must serve')
+    ap.add_argument('--pool-align', type=int, default=2,
+                    help='MPOOL_ALIGN of the target, 2 for pic30')
+    ap.add_argument('--headroom', type=int, default=25,
+                    help='blocks added to each pool peak, in percent')
+    ap.add_argument('--region', action='append', default=[],
+                    metavar='ID=BYTES', help='region storage (repeatable)')
+    opts = ap.parse_args()
+
+    counts, peaks, events = collections.Counter(), {}, []
+    for path in opts.inputs:
+        read_input(path, counts, peaks, events)
+    total = sum(counts.values())
+    if not total:
+        sys.exit('no requests in %s' % ', '.join(opts.inputs))
+
+    classes, waste = choose_classes(counts, opts.bins, opts.bin_max,
+                                    opts.align)
+    binned = sum(n for s, n in counts.items() if classes and s <= classes[-1])
+
+    pools = choose_pools(counts, opts.pools, opts.pool_share,
+                         opts.pool_align)
+    heap = None
+    if events:
+        live, heap = replay_peaks(events, pools)
+    elif peaks:
+        live = hist_peaks(peaks, pools)
+    else:
+        live = collections.Counter()
+    pools = [(b, live[b] + (live[b] * opts.headroom + 99) // 100)
+             for b in pools if live[b]]
+    blocks = [b for b, _ in pools]
+    pooled = sum(n for s, n in counts.items() if pool_of(s, blocks))
+    pool_bytes = sum(round_up(max(b, 2), opts.pool_align) * n
+                     for b, n in pools)
+
+    regions = []
+    for r in opts.region:
+        try:
+            rid, nbytes = (int(x, 0) for x in r.split('='))
+        except ValueError:
+            sys.exit('--region %s: want ID=BYTES' % r)
+        regions.append((rid, nbytes))
+
+    with open(opts.output, 'w') as f:
+        w = f.write
+        w('/* Generated by mallconfig.py from %s: %d requests.\n'
+          % (', '.join(os.path.basename(p) for p in opts.inputs), total))
+        w('   Build libc with -DNANO_MALLOC_BINS and\n'
+          '   -DNANO_MALLOC_CONFIG=\'"%s"\'.  */\n\n'
+          % os.path.basename(opts.output))
+        w('#ifndef _MALLOC_CONFIG_H_\n#define _MALLOC_CONFIG_H_\n\n')
+        if classes:
+            w('/* %d%% of the requests binned, rounding up wastes %.1f bytes a'
+              ' request.  */\n' % (binned * 100 // total,
+                                   waste / binned if binned else 0))
+            w('#define MALLOC_BIN_COUNT %d\n' % len(classes))
+            w('#define MALLOC_BIN_MIN (%dU)\n' % classes[0])
+            w('#define MALLOC_BIN_MAX (%dU)\n' % classes[-1])
+            w('#define MALLOC_BIN_SIZES %s\n'
+              % ', '.join('%dU' % c for c in classes))
+        if pools:
+            w('\n/* %d%% of the requests fit a pool, %d bytes of blocks:'
+              ' peak live\n   blocks and %d%%.  */\n'
+              % (pooled * 100 // total, pool_bytes, opts.headroom))
+            w('#define MALLOC_CONFIG_POOLS(P) \\\n')
+            w(' \\\n'.join('  P(%d, %d)' % p for p in pools) + '\n')
+        if regions:
+            w('\n/* %d bytes of regions.  */\n'
+              % sum(n for _, n in regions))
+            w('#define MALLOC_CONFIG_REGIONS(R) \\\n')
+            w(' \\\n'.join('  R(%d, %d)' % r for r in regions) + '\n')
+        if heap is not None:
+            w('\n/* The trace peaked at %d live bytes in the heap and'
+              ' pools.  */\n' % heap)
+        w('\n#endif /* _MALLOC_CONFIG_H_ */\n')
+
+
+if __name__ == '__main__':
+    main()
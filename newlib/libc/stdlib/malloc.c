@@ -97,7 +97,12 @@ case <<reallocf>> will free the original object passed in whereas
 
 The <<memalign>> function returns a block of size <[nbytes]> aligned
 to a <[align]> boundary.  The <[align]> argument must be a power of
-two.
+two.  In nano-malloc, an <[align]> of <<MALLOC_BUDDY_ALIGN>> or more
+is first tried from the buddy allocators registered with
+<<buddy_register>>.  If newlib is built with a nonzero
+<<MALLOC_BUDDY_SIZE>>, the first such request none of them can serve
+takes a buddy allocator of that many bytes from the heap, which is
+not returned to it; the default of 0 never does.
 
 The <<malloc_usable_size>> function takes a pointer to a block
 allocated by <<malloc>>.  It returns the amount of space that is
@@ -173,6 +173,11 @@ int _dummy_mallocr = 1;
   MALLOC_ALIGNMENT          (default: NOT defined)
      Define this to 16 if you need 16 byte alignment instead of 8 byte alignment
      which is the normal default.
+  MALLOC_SMALL_BINS         (default: defined for dsPIC30 in newlib)
+     Define this for a 16-bit size_t and a heap of at most a few tens
+     of K: 64 bins instead of 128, exact bins for chunks under 64
+     bytes whatever MALLOC_ALIGNMENT is, and sbrk and trim steps
+     sized for such a heap.
   REALLOC_ZERO_BYTES_FREES (default: NOT defined) 
      Define this if you think that realloc(p, 0) should be equivalent
      to free(p). Otherwise, since malloc returns a unique pointer for
@@ -316,8 +321,22 @@ extern "C" {
 # undef WIN32
 #endif
 
+/* The 16-bit parts: few bins, and small sbrk and trim steps so that
+   a heap of a few K is not taken in one go.  */
+#if defined (__dsPIC30__) && !defined (MALLOC_SMALL_BINS)
+#define MALLOC_SMALL_BINS
+#endif
+
+#ifdef MALLOC_SMALL_BINS
+#ifndef DEFAULT_TRIM_THRESHOLD
+#define DEFAULT_TRIM_THRESHOLD (2048L)
+#endif
+#endif
+
 #ifndef _WIN32
-#ifdef SMALL_MEMORY
+#ifdef MALLOC_SMALL_BINS
+#define malloc_getpagesize (64)
+#elif defined (SMALL_MEMORY)
 #define malloc_getpagesize (128)
 #else
 #define malloc_getpagesize (4096)
@@ -520,7 +539,16 @@ Void_t* memmove();
 #endif
 #endif
 
-#if USE_MEMCPY
+#ifdef MALLOC_SMALL_BINS
+
+/* Chunk sizes are then any multiple of MALLOC_ALIGNMENT, not always an
+   odd number of INTERNAL_SIZE_T units past the header, so leave it to
+   the library routines, which are smaller code too. */
+
+#define MALLOC_ZERO(charp, nbytes)    memset((charp), 0, (nbytes))
+#define MALLOC_COPY(dest,src,nbytes)  memmove(dest, src, nbytes)
+
+#elif USE_MEMCPY
 
 /* The following macros are only invoked with (2n+1)-multiples of
    INTERNAL_SIZE_T units, with a positive integer n. This is exploited
@@ -1435,7 +1463,12 @@ nextchunk-> +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
 /* size field is or'ed with IS_MMAPPED if the chunk was obtained with mmap() */
 
+#if HAVE_MMAP
 #define IS_MMAPPED 0x2
+#else
+/* Never set, so sizes may use the bit with a MALLOC_ALIGNMENT of 2 */
+#define IS_MMAPPED 0
+#endif
 
 /* Bits to mask off when extracting size */
 
@@ -1560,7 +1593,11 @@ nextchunk-> +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 #define av_ malloc_av_
 #endif
 
+#ifdef MALLOC_SMALL_BINS
+#define NAV              64   /* number of bins */
+#else
 #define NAV             128   /* number of bins */
+#endif
 
 typedef struct malloc_chunk* mbinptr;
 
@@ -1604,6 +1641,7 @@ STATIC mbinptr av_[NAV * 2 + 2] = {
  IAV(40),  IAV(41),  IAV(42),  IAV(43),  IAV(44),  IAV(45),  IAV(46),  IAV(47),
  IAV(48),  IAV(49),  IAV(50),  IAV(51),  IAV(52),  IAV(53),  IAV(54),  IAV(55),
  IAV(56),  IAV(57),  IAV(58),  IAV(59),  IAV(60),  IAV(61),  IAV(62),  IAV(63),
+#ifndef MALLOC_SMALL_BINS
  IAV(64),  IAV(65),  IAV(66),  IAV(67),  IAV(68),  IAV(69),  IAV(70),  IAV(71),
  IAV(72),  IAV(73),  IAV(74),  IAV(75),  IAV(76),  IAV(77),  IAV(78),  IAV(79),
  IAV(80),  IAV(81),  IAV(82),  IAV(83),  IAV(84),  IAV(85),  IAV(86),  IAV(87),
@@ -1612,6 +1650,7 @@ STATIC mbinptr av_[NAV * 2 + 2] = {
  IAV(104), IAV(105), IAV(106), IAV(107), IAV(108), IAV(109), IAV(110), IAV(111),
  IAV(112), IAV(113), IAV(114), IAV(115), IAV(116), IAV(117), IAV(118), IAV(119),
  IAV(120), IAV(121), IAV(122), IAV(123), IAV(124), IAV(125), IAV(126), IAV(127)
+#endif
 };
 #else
 extern mbinptr av_[NAV * 2 + 2];
@@ -1628,6 +1667,34 @@ extern mbinptr av_[NAV * 2 + 2];
   Indexing into bins
 */
 
+#ifdef MALLOC_SMALL_BINS
+
+/*
+  With MALLOC_SMALL_BINS, chunks under 64 bytes get a bin for each even
+  size, so the small bins hold a single size even with 2-byte
+  alignment.  Bigger ones get four bins for each power of two up to
+  16K, and the last bin holds everything from 14K up.  binblocks then
+  fits in a 16-bit size field.
+*/
+
+#define bin_index(sz)                                                          \
+((((unsigned long)(sz)) <    64) ?       (((unsigned long)(sz)) >>  1): \
+ (((unsigned long)(sz)) <   128) ?  28 + (((unsigned long)(sz)) >>  4): \
+ (((unsigned long)(sz)) <   256) ?  32 + (((unsigned long)(sz)) >>  5): \
+ (((unsigned long)(sz)) <   512) ?  36 + (((unsigned long)(sz)) >>  6): \
+ (((unsigned long)(sz)) <  1024) ?  40 + (((unsigned long)(sz)) >>  7): \
+ (((unsigned long)(sz)) <  2048) ?  44 + (((unsigned long)(sz)) >>  8): \
+ (((unsigned long)(sz)) <  4096) ?  48 + (((unsigned long)(sz)) >>  9): \
+ (((unsigned long)(sz)) <  8192) ?  52 + (((unsigned long)(sz)) >> 10): \
+ (((unsigned long)(sz)) < 16384) ?  56 + (((unsigned long)(sz)) >> 11): \
+                                          63)
+
+#define MAX_SMALLBIN_SIZE    64
+#define SMALLBIN_WIDTH        2
+#define SMALLBIN_WIDTH_BITS   1
+
+#else /* !MALLOC_SMALL_BINS */
+
 #define bin_index(sz)                                                          \
 (((((unsigned long)(sz)) >> 9) ==    0) ?       (((unsigned long)(sz)) >>  3): \
  ((((unsigned long)(sz)) >> 9) <=    4) ?  56 + (((unsigned long)(sz)) >>  6): \
@@ -1644,6 +1711,8 @@ extern mbinptr av_[NAV * 2 + 2];
 #define MAX_SMALLBIN_SIZE   512
 #define SMALLBIN_WIDTH        8
 #define SMALLBIN_WIDTH_BITS   3
+
+#endif /* !MALLOC_SMALL_BINS */
 #define MAX_SMALLBIN        (MAX_SMALLBIN_SIZE / SMALLBIN_WIDTH) - 1
 
 #define smallbin_index(sz)  (((unsigned long)(sz)) >> SMALLBIN_WIDTH_BITS)
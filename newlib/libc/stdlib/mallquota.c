@@ -0,0 +1,27 @@
+/* Per-thread heap accounting, see <malloc.h>.  nano-malloc built with
+   NANO_MALLOC_QUOTAS charges the quota of the calling reent as it
+   hands out chunks, and credits the one a chunk records as it takes it
+   back; this only selects it.  */
+
+#include <_ansi.h>
+#include <newlib.h>
+#include <reent.h>
+#include <errno.h>
+#include <malloc.h>
+
+mallquota_t *
+malloc_quota_use (mallquota_t *q)
+{
+  struct _reent *ptr = _REENT;
+  mallquota_t *prev;
+
+#if defined (_NANO_MALLOC) && defined (NANO_MALLOC_QUOTAS)
+  prev = _REENT_MALLOC_QUOTA (ptr);
+  _REENT_MALLOC_QUOTA (ptr) = q;
+#else
+  prev = NULL;
+  if (q != NULL)
+    ptr->_errno = ENOSYS;
+#endif
+  return prev;
+}
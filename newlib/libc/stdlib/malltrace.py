@@ -0,0 +1,311 @@
+#!/usr/bin/env python3
+#
+# malltrace.py -- replay the allocation trace of malloc_trace_dump.
+#
+# usage: malltrace.py [options] DUMP
+#
+# DUMP is the text malloc_trace_dump printed on the target, as
+# captured from the console; other lines around it are skipped.  The
+# events are replayed in order to report the requests by size class,
+# the callers, the blocks still live at the end and the peak of the
+# live bytes.  --timeline draws the live bytes event by event and
+# --map the heap as the trace leaves it.  With --elf, the callers are
+# named by addr2line.  --c writes the events as the table that
+# testsuite/newlib.bench/malloc-replay.c replays, blocks renamed to
+# slots and each realloc pair merged into one operation.
+#
+# The ring only holds the last MALLOC_TRACE_SIZE events, so blocks
+# allocated before it starts are unknown; their frees are counted but
+# otherwise ignored.  Sizes are those requested, without chunk headers.
+# The size classes default to those of NANO_MALLOC_BINS.
+
+import argparse
+import collections
+import re
+import subprocess
+import sys
+
+EVENT = re.compile(r'^(malloc|free|realloc-from|realloc)'
+                   r' (\S+) (\d+) (\S+) (\d+)\s*$')
+HEADER = re.compile(r'^malloc trace (\d+)\s*$')
+
+
+def addr(s):
+    """An address as %p prints it, with or without 0x, or (nil)."""
+    if s in ('(nil)', '0'):
+        return 0
+    return int(s, 16)
+
+
+def read_dump(path):
+    total = None
+    events = []
+    with open(path, errors='replace') as f:
+        for line in f:
+            m = HEADER.match(line)
+            if m:
+                # A later dump replaces an earlier one.
+                total = int(m.group(1))
+                events = []
+                continue
+            m = EVENT.match(line)
+            if m and total is not None:
+                op, ptr, size, caller, time = m.groups()
+                events.append((op, addr(ptr), int(size), addr(caller),
+                               int(time)))
+    if total is None:
+        sys.exit('%s: no malloc trace' % path)
+    return total, events
+
+
+class Replay:
+    def __init__(self, bin_min, bins):
+        self.bin_min, self.bins = bin_min, bins
+        self.live = {}           # ptr -> (size, caller, event)
+        self.live_bytes = 0
+        self.peak = 0
+        self.timeline = []
+        self.unknown_frees = 0
+        self.failures = collections.Counter()
+        self.classes = collections.Counter()
+        self.sizes = collections.Counter()
+        self.callers = collections.defaultdict(lambda: [0, 0])
+        self.lifetimes = collections.defaultdict(list)
+        self.pending = None
+        self.first = self.last = None
+
+    def size_class(self, size):
+        c, i = self.bin_min, 0
+        while i < self.bins and size > c:
+            c <<= 1
+            i += 1
+        return i
+
+    def allocate(self, ptr, size, caller, n):
+        self.sizes[size] += 1
+        self.classes[self.size_class(size)] += 1
+        self.callers[caller][0] += 1
+        self.callers[caller][1] += size
+        if ptr == 0:
+            self.failures[size] += 1
+            return
+        self.live[ptr] = (size, caller, n)
+        self.live_bytes += size
+        self.peak = max(self.peak, self.live_bytes)
+
+    def release(self, ptr, n, time):
+        block = self.live.pop(ptr, None)
+        if block is None:
+            self.unknown_frees += 1
+            return None
+        size, caller, born = block
+        self.live_bytes -= size
+        self.lifetimes[self.size_class(size)].append(n - born)
+        return block
+
+    def run(self, events):
+        for n, (op, ptr, size, caller, time) in enumerate(events):
+            if self.first is None:
+                self.first = time
+            self.last = time
+            if op == 'malloc':
+                self.allocate(ptr, size, caller, n)
+            elif op == 'free':
+                self.release(ptr, n, time)
+            elif op == 'realloc-from':
+                self.pending = self.release(ptr, n, time) if ptr else None
+            elif op == 'realloc':
+                if ptr == 0 and size != 0 and self.pending is not None:
+                    # A failed realloc leaves the old block alone.
+                    old_size, old_caller, born = self.pending
+                    self.live[events[n - 1][1]] = self.pending
+                    self.live_bytes += old_size
+                    self.failures[size] += 1
+                elif ptr != 0 or size != 0:
+                    self.allocate(ptr, size, caller, n)
+                self.pending = None
+            self.timeline.append(self.live_bytes)
+
+
+class Names:
+    """Callers by name, through addr2line on the executable."""
+
+    def __init__(self, elf, tool):
+        self.elf, self.tool, self.cache = elf, tool, {}
+
+    def lookup(self, addrs):
+        want = [a for a in addrs if a not in self.cache]
+        if not self.elf or not want:
+            return
+        out = subprocess.run([self.tool, '-f', '-s', '-e', self.elf]
+                             + ['0x%x' % a for a in want],
+                             capture_output=True, text=True, check=True)
+        lines = out.stdout.splitlines()
+        for i, a in enumerate(want):
+            func, where = lines[2 * i:2 * i + 2] or ('??', '??')
+            self.cache[a] = '%s (%s)' % (func, where)
+
+    def __call__(self, a):
+        return self.cache.get(a, '0x%x' % a)
+
+
+def write_c(path, events, dump):
+    """The events as a replay_op table for malloc-replay.c."""
+    slots = {}                   # ptr -> slot
+    spare = []
+    used = 0
+    ops = []
+
+    def take(ptr):
+        nonlocal used
+        if spare:
+            s = spare.pop()
+        else:
+            s, used = used, used + 1
+        if ptr:
+            slots[ptr] = s
+        else:
+            spare.append(s)      # a failed request holds nothing
+        return s
+
+    pending = old = None
+    for op, ptr, size, caller, time in events:
+        if op == 'malloc':
+            ops.append(('m', take(ptr), size))
+        elif op == 'free':
+            s = slots.pop(ptr, None)
+            if s is not None:
+                ops.append(('f', s, 0))
+                spare.append(s)
+        elif op == 'realloc-from':
+            old = ptr
+            pending = slots.pop(ptr, None) if ptr else None
+        elif op == 'realloc':
+            if pending is None:
+                if size:
+                    ops.append(('m', take(ptr), size))
+            else:
+                ops.append(('r', pending, size))
+                if ptr == 0 and size != 0:
+                    slots[old] = pending   # failed, the old block stays
+                elif ptr:
+                    slots[ptr] = pending
+                else:
+                    spare.append(pending)
+            pending = None
+    with open(path, 'w') as f:
+        f.write('/* Generated by malltrace.py --c from %s.  */\n\n' % dump)
+        f.write('#define REPLAY_SLOTS %d\n\n' % max(used, 1))
+        f.write('static const struct replay_op replay_trace[] = {\n')
+        for op, s, size in ops:
+            f.write("  { '%s', %d, %d },\n" % (op, s, size))
+        f.write('};\n')
+
+
+def bar(value, top, width):
+    return '#' * (value * width // top if top else 0)
+
+
+def report(r, total, events, names, top):
+    print('%d events of %d, %d in time units' % (
+        len(events), total, (r.last or 0) - (r.first or 0)))
+    if total > len(events):
+        print('the ring starts after %d events; %d frees of earlier blocks'
+              % (total - len(events), r.unknown_frees))
+    print('live at the end %d bytes in %d blocks, peak %d bytes'
+          % (r.live_bytes, len(r.live), r.peak))
+    if r.failures:
+        print('failed requests: %s' % ', '.join(
+            '%d x %d' % (n, s) for s, n in sorted(r.failures.items())))
+
+    print('\nrequests by size class')
+    most = max(r.classes.values(), default=0)
+    for i in range(r.bins + 1):
+        lo = 0 if i == 0 else (r.bin_min << (i - 1)) + 1
+        hi = '' if i == r.bins else str(r.bin_min << i)
+        life = sorted(r.lifetimes[i])
+        med = (' median life %d events' % life[len(life) // 2]) if life else ''
+        print('  %5d..%-5s %6d %s%s' % (lo, hi, r.classes[i],
+                                        bar(r.classes[i], most, 30), med))
+
+    print('\nmost requested sizes')
+    for size, n in r.sizes.most_common(top):
+        print('  %6d bytes %6d' % (size, n))
+
+    by_bytes = sorted(r.callers.items(), key=lambda c: -c[1][1])[:top]
+    still = collections.Counter()
+    for size, caller, born in r.live.values():
+        still[caller] += size
+    names.lookup([c for c, _ in by_bytes] + list(still))
+    print('\ncallers by bytes requested')
+    for caller, (n, nbytes) in by_bytes:
+        print('  %8d bytes %6d calls %6d live  %s' % (
+            nbytes, n, still[caller], names(caller)))
+
+
+def timeline(r, width, height):
+    if not r.timeline:
+        return
+    step = max(1, (len(r.timeline) + width - 1) // width)
+    cols = [max(r.timeline[i:i + step])
+            for i in range(0, len(r.timeline), step)]
+    top = max(cols) or 1
+    print('\nlive bytes, %d events a column, top %d' % (step, top))
+    for row in range(height, 0, -1):
+        print('  |' + ''.join('#' if c * height >= row * top else ' '
+                              for c in cols))
+    print('  +' + '-' * len(cols))
+
+
+def heap_map(r, width):
+    if not r.live:
+        return
+    # From the lowest live block to the end of the highest.
+    lo = min(r.live)
+    hi = max(p + s for p, (s, _, _) in r.live.items())
+    span = max(1, hi - lo)
+    cell = (span + width - 1) // width
+    used = [0] * ((span + cell - 1) // cell)
+    for p, (s, _, _) in r.live.items():
+        a, b = p - lo, p - lo + s
+        while a < b:
+            c = a // cell
+            end = min(b, (c + 1) * cell)
+            used[c] += end - a
+            a = end
+    print('\nlive blocks from 0x%x to 0x%x, %d bytes a cell' % (lo, hi, cell))
+    print('  ' + ''.join('#' if u >= cell else '+' if u else '.'
+                         for u in used))
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Replay a malloc trace.')
+    ap.add_argument('dump')
+    ap.add_argument('--bin-min', type=int, default=4,
+                    help='smallest size class, MALLOC_BIN_MIN')
+    ap.add_argument('--bins', type=int, default=6,
+                    help='number of size classes, MALLOC_BIN_COUNT')
+    ap.add_argument('--top', type=int, default=10)
+    ap.add_argument('--timeline', action='store_true')
+    ap.add_argument('--map', action='store_true')
+    ap.add_argument('--width', type=int, default=72)
+    ap.add_argument('--elf', help='executable to name the callers from')
+    ap.add_argument('--addr2line', default='xc16-addr2line')
+    ap.add_argument('--c', metavar='FILE',
+                    help='write the events as a table for malloc-replay.c')
+    opts = ap.parse_args()
+
+    total, events = read_dump(opts.dump)
+    r = Replay(opts.bin_min, opts.bins)
+    r.run(events)
+    report(r, total, events, Names(opts.elf, opts.addr2line), opts.top)
+    if opts.timeline:
+        timeline(r, opts.width, 12)
+    if opts.map:
+        heap_map(r, opts.width)
+    if opts.c:
+        write_c(opts.c, events, opts.dump)
+
+
+if __name__ == '__main__':
+    main()
@@ -69,6 +69,10 @@ PORTABILITY
 #include <stdlib.h>
 #include <stdio.h>
 #include <errno.h>
+#include "local.h"
+
+/* C is a byte from 1 to 0x7f.  */
+#define ASCII_NZ(c)	((unsigned int) ((c) - 1) < 0x7f)
 
 size_t
 _mbsnrtowcs_r (struct _reent *r,
@@ -83,13 +87,16 @@ _mbsnrtowcs_r (struct _reent *r,
   size_t max;
   size_t count = 0;
   int bytes;
-
 #ifdef _MB_CAPABLE
+  int ascii = __MBTOWC == __utf8_mbtowc || __MBTOWC == __ascii_mbtowc;
+
   if (ps == NULL)
     {
       _REENT_CHECK_MISC(r);
       ps = &(_REENT_MBSRTOWCS_STATE(r));
     }
+#else
+  const int ascii = 1;
 #endif
 
   if (dst == NULL)
@@ -104,6 +111,44 @@ _mbsnrtowcs_r (struct _reent *r,
   max = len;
   while (len > 0)
     {
+      const unsigned char *s = (const unsigned char *) *src;
+
+      /* In UTF-8 and the C locale a byte below 0x80 stands for itself
+	 and leaves the state alone, so a run of them, up to a NUL,
+	 needs no call through the locale.  Two bytes are checked at a
+	 time from an aligned halfword.  */
+      if (ascii && nms > 0 && ASCII_NZ (*s)
+#ifdef _MB_CAPABLE
+	  && ps->__count == 0
+#endif
+	  )
+	{
+	  do
+	    {
+	      if (ptr)
+		*ptr++ = *s;
+	      s++, nms--, len--, count++;
+	    }
+	  while (((__uintptr_t) s & 1) && len > 0 && nms > 0
+		 && ASCII_NZ (*s));
+	  while (!((__uintptr_t) s & 1) && len >= 2 && nms >= 2)
+	    {
+	      __uint16_t w = *(const __uint16_t *) s;
+
+	      if ((w & 0x8080) || !(w & 0x00ff) || !(w & 0xff00))
+		break;
+	      if (ptr)
+		{
+		  ptr[0] = s[0];
+		  ptr[1] = s[1];
+		  ptr += 2;
+		}
+	      s += 2, nms -= 2, len -= 2, count += 2;
+	    }
+	  *src = (const char *) s;
+	  continue;
+	}
+
       bytes = _mbrtowc_r (r, ptr, *src, nms, ps);
       if (bytes > 0)
 	{
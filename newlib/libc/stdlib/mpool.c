@@ -0,0 +1,132 @@
+/* Fixed-size block pools, see <mpool.h>.
+
+   Free blocks are linked through their first word, so a block is at
+   least a pointer wide and nothing is stored in an allocated one.
+   The pool operations take the malloc lock: registered pools are also
+   used by malloc and free.  */
+
+#include <_ansi.h>
+#include <newlib.h>
+#include <reent.h>
+#include <errno.h>
+#include <stdint.h>
+#include <malloc.h>
+#include <mpool.h>
+
+#define ALIGN_UP(x, a)	(((x) + (a) - 1) & ~((a) - 1))
+
+size_t
+mpool_init (mpool_t *pool,
+	void *buf,
+	size_t buf_size,
+	size_t size)
+{
+  char *start = (char *) ALIGN_UP ((uintptr_t) buf, MPOOL_ALIGN);
+  char *p;
+  size_t n;
+
+  if (size < sizeof (void *))
+    size = sizeof (void *);
+  size = ALIGN_UP (size, MPOOL_ALIGN);
+
+  pool->_next = NULL;
+  pool->_free = NULL;
+  pool->_start = start;
+  pool->_size = size;
+
+  if ((size_t) (start - (char *) buf) > buf_size)
+    n = 0;
+  else
+    n = (buf_size - (start - (char *) buf)) / size;
+  pool->_end = start + n * size;
+  pool->_nfree = n;
+
+  /* Chain the blocks in address order.  */
+  for (p = pool->_end; p != start; )
+    {
+      p -= size;
+      *(void **) p = pool->_free;
+      pool->_free = p;
+    }
+  return n;
+}
+
+void *
+mpool_alloc (mpool_t *pool)
+{
+  void *p;
+
+  __malloc_lock (_REENT);
+  p = pool->_free;
+  if (p != NULL)
+    {
+      pool->_free = *(void **) p;
+      pool->_nfree--;
+    }
+  __malloc_unlock (_REENT);
+  return p;
+}
+
+void
+mpool_free (mpool_t *pool,
+	void *p)
+{
+  if (p == NULL)
+    return;
+
+  __malloc_lock (_REENT);
+  *(void **) p = pool->_free;
+  pool->_free = p;
+  pool->_nfree++;
+  __malloc_unlock (_REENT);
+}
+
+int
+mpool_owns (const mpool_t *pool,
+	const void *p)
+{
+  return (const char *) p >= pool->_start && (const char *) p < pool->_end;
+}
+
+#ifdef _NANO_MALLOC
+/* Defined with nano_malloc, kept sorted by increasing block size.  */
+extern mpool_t *__malloc_pools;
+#endif
+
+int
+mpool_register (mpool_t *pool)
+{
+#ifdef _NANO_MALLOC
+  mpool_t **pp;
+
+  __malloc_lock (_REENT);
+  for (pp = &__malloc_pools; *pp != NULL; pp = &(*pp)->_next)
+    if ((*pp)->_size > pool->_size)
+      break;
+  pool->_next = *pp;
+  *pp = pool;
+  __malloc_unlock (_REENT);
+  return 0;
+#else
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
+void
+mpool_unregister (mpool_t *pool)
+{
+#ifdef _NANO_MALLOC
+  mpool_t **pp;
+
+  __malloc_lock (_REENT);
+  for (pp = &__malloc_pools; *pp != NULL; pp = &(*pp)->_next)
+    if (*pp == pool)
+      {
+	*pp = pool->_next;
+	break;
+      }
+  pool->_next = NULL;
+  __malloc_unlock (_REENT);
+#endif
+}
@@ -84,6 +84,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <reent.h>
+#include <sys/lock.h>
 #include "mprec.h"
 
 /* This is defined in sys/reent.h as (sizeof (size_t) << 3) now, as in NetBSD.
@@ -93,6 +94,76 @@
 #define _Kmax 15
 */
 
+#ifdef _MPREC_POOL
+/* Bigints are only ever given back to the freelists, never to the
+   heap, so with _MPREC_POOL they are carved from a static arena of
+   _MPREC_POOL_SIZE bytes and the heap is only used once that runs out.
+   The default is what the double conversions of strtod and of dtoa,
+   with up to 40 digits, were seen to keep.  */
+#ifndef _MPREC_POOL_SIZE
+#define MPREC_BIGINT(k)	(sizeof (_Bigint) + ((1 << (k)) - 1) * sizeof (__ULong))
+#ifdef _DOUBLE_IS_32BITS
+#define _MPREC_POOL_SIZE ((_Kmax + 1) * sizeof (_Bigint *)		\
+			  + 12 * MPREC_BIGINT (1)			\
+			  + 6 * (MPREC_BIGINT (2) + MPREC_BIGINT (3)	\
+				 + MPREC_BIGINT (4))			\
+			  + 2 * MPREC_BIGINT (5))
+#else
+#define _MPREC_POOL_SIZE ((_Kmax + 1) * sizeof (_Bigint *)		\
+			  + 12 * MPREC_BIGINT (2)			\
+			  + 6 * (MPREC_BIGINT (3) + MPREC_BIGINT (4)	\
+				 + MPREC_BIGINT (5) + MPREC_BIGINT (6))	\
+			  + 2 * MPREC_BIGINT (7))
+#endif
+#endif
+
+typedef union { __ULong l; void *p; } mprec_align;
+
+static mprec_align mprec_pool[(_MPREC_POOL_SIZE + sizeof (mprec_align) - 1)
+			      / sizeof (mprec_align)];
+static size_t mprec_pool_used;
+
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT (static, __mprec_pool_lock);
+#endif
+
+/* Zeroed memory for N bytes that are kept for good.  */
+static void *
+mprec_calloc (struct _reent *ptr, size_t n)
+{
+  void *p = NULL;
+
+  n = (n + sizeof (mprec_align) - 1) / sizeof (mprec_align);
+#ifndef __SINGLE_THREAD__
+  __lock_acquire (__mprec_pool_lock);
+#endif
+  if (n <= sizeof (mprec_pool) / sizeof (mprec_align) - mprec_pool_used)
+    {
+      p = &mprec_pool[mprec_pool_used];
+      mprec_pool_used += n;
+    }
+#ifndef __SINGLE_THREAD__
+  __lock_release (__mprec_pool_lock);
+#endif
+  if (p == NULL)
+    p = _calloc_r (ptr, n, sizeof (mprec_align));
+  return p;
+}
+
+/* Free P, from Balloc, when a reent is reclaimed.  What was carved from
+   the arena stays there.  */
+void
+__mprec_free (struct _reent *ptr, void *p)
+{
+  if ((mprec_align *) p < mprec_pool
+      || (mprec_align *) p >= mprec_pool + sizeof (mprec_pool)
+			      / sizeof (mprec_align))
+    _free_r (ptr, p);
+}
+#else
+#define mprec_calloc(ptr, n)	_calloc_r (ptr, 1, n)
+#endif /* _MPREC_POOL */
+
 _Bigint *
 Balloc (struct _reent *ptr, int k)
 {
@@ -103,9 +174,8 @@ Balloc (struct _reent *ptr, int k)
   if (_REENT_MP_FREELIST(ptr) == NULL)
     {
       /* Allocate a list of pointers to the mprec objects */
-      _REENT_MP_FREELIST(ptr) = (struct _Bigint **) _calloc_r (ptr, 
-						      sizeof (struct _Bigint *),
-						      _Kmax + 1);
+      _REENT_MP_FREELIST(ptr) = (struct _Bigint **) mprec_calloc (ptr,
+				      sizeof (struct _Bigint *) * (_Kmax + 1));
       if (_REENT_MP_FREELIST(ptr) == NULL)
 	{
 	  return NULL;
@@ -120,10 +190,9 @@ Balloc (struct _reent *ptr, int k)
     {
       x = 1 << k;
       /* Allocate an mprec Bigint and stick in in the freelist */
-      rv = (_Bigint *) _calloc_r (ptr,
-				  1,
-				  sizeof (_Bigint) +
-				  (x-1) * sizeof(rv->_x));
+      rv = (_Bigint *) mprec_calloc (ptr,
+				     sizeof (_Bigint) +
+				     (x-1) * sizeof(rv->_x));
       if (rv == NULL) return NULL;
       rv->_k = k;
       rv->_maxwds = x;
@@ -36,6 +36,9 @@
 #include <string.h>
 #include <errno.h>
 #include <malloc.h>
+#include <mpool.h>
+#include <arena.h>
+#include <buddy.h>
 
 #if DEBUG
 #include <assert.h>
@@ -64,6 +67,13 @@
 
 #define RERRNO reent_ptr->_errno
 
+/* The arena selected by arena_use for this thread, if any */
+#define CURRENT_ARENA _REENT_MALLOC_ARENA(reent_ptr)
+/* The quota of this thread, with NANO_MALLOC_QUOTAS */
+#ifdef NANO_MALLOC_QUOTAS
+#define CURRENT_QUOTA _REENT_MALLOC_QUOTA(reent_ptr)
+#endif
+
 #define nano_malloc		_malloc_r
 #define nano_free		_free_r
 #define nano_realloc		_realloc_r
@@ -76,6 +86,7 @@
 #define nano_malloc_stats	_malloc_stats_r
 #define nano_mallinfo		_mallinfo_r
 #define nano_mallopt		_mallopt_r
+#define nano_malloc_region	_malloc_region_r
 
 #else /* ! INTERNAL_NEWLIB */
 
@@ -99,12 +110,30 @@
 #define nano_malloc_stats	malloc_stats
 #define nano_mallinfo		mallinfo
 #define nano_mallopt		mallopt
+#define nano_malloc_region	malloc_region
 #endif /* ! INTERNAL_NEWLIB */
 
 /* Redefine names to avoid conflict with user names */
 #define free_list __malloc_free_list
 #define sbrk_start __malloc_sbrk_start
 #define current_mallinfo __malloc_current_mallinfo
+#define insert_free_chunk __malloc_insert_free_chunk
+#define bins __malloc_bins
+#define pools __malloc_pools
+#define arenas __malloc_arenas
+#define buddies __malloc_buddies
+#define regions __malloc_regions
+#define counters __malloc_counters
+#define find_largest __malloc_find_largest
+#define heap_fence __malloc_heap_fence
+#define trace_ring __malloc_trace_ring
+#define trace_count __malloc_trace_count
+#define trace_quiet __malloc_trace_quiet
+#define fit_policy __malloc_fit_policy
+#define rover __malloc_rover
+#define top_pad __malloc_top_pad
+#define trim_threshold __malloc_trim_threshold
+#define sbrk_mark __malloc_sbrk_mark
 
 #define ALIGN_PTR(ptr, align) \
     (((ptr) + (align) - (intptr_t)1) & ~((align) - (intptr_t)1))
@@ -113,12 +142,22 @@
 
 /* Alignment of allocated block */
 #define MALLOC_ALIGN (8U)
+#ifdef NANO_MALLOC_TAGS
+/* Two bits of every size are taken for the tags */
+#define CHUNK_ALIGN (MAX(sizeof(void*), 4U))
+#else
 #define CHUNK_ALIGN (sizeof(void*))
+#endif
 #define MALLOC_PADDING ((MAX(MALLOC_ALIGN, CHUNK_ALIGN)) - CHUNK_ALIGN)
 
 /* as well as the minimal allocation size
  * to hold a free pointer */
+#ifdef NANO_MALLOC_TAGS
+/* next, prev and the footer */
+#define MALLOC_MINSIZE (3 * sizeof(void *))
+#else
 #define MALLOC_MINSIZE (sizeof(void *))
+#endif
 #define MALLOC_PAGE_ALIGN (0x1000)
 #define MAX_ALLOC_SIZE (0x80000000U)
 
@@ -127,7 +166,9 @@ typedef size_t malloc_size_t;
 typedef struct malloc_chunk
 {
     /*          --------------------------------------
-     *   chunk->| size                               |
+     *   chunk->| quota, with NANO_MALLOC_QUOTAS     |
+     *          --------------------------------------
+     *          | size                               |
      *          --------------------------------------
      *          | Padding for alignment              |
      *          | This includes padding inserted by  |
@@ -135,22 +176,30 @@ typedef struct malloc_chunk
      *          | explicit padding inserted by this  |
      *          | implementation. If any explicit    |
      *          | padding is being used then the     |
-     *          | sizeof (size) bytes at             |
-     *          | mem_ptr - CHUNK_OFFSET must be     |
+     *          | size field of the chunk header     |
+     *          | that ends at mem_ptr must be       |
      *          | initialized with the negative      |
-     *          | offset to size.                    |
+     *          | offset to the chunk.               |
      *          --------------------------------------
      * mem_ptr->| When allocated: data               |
      *          | When freed: pointer to next free   |
      *          | chunk                              |
      *          --------------------------------------
      */
+#ifdef CURRENT_QUOTA
+    /* the quota an allocated chunk is charged to */
+    mallquota_t * quota;
+#endif
+
     /* size of the allocated payload area, including size before
        CHUNK_OFFSET */
     long size;
 
     /* since here, the memory is either the next free block, or data load */
     struct malloc_chunk * next;
+#ifdef NANO_MALLOC_TAGS
+    struct malloc_chunk * prev;
+#endif
 }chunk;
 
 
@@ -158,16 +207,126 @@ typedef struct malloc_chunk
 
 /* size of smallest possible chunk. A memory piece smaller than this size
  * won't be able to create a chunk */
+#ifdef NANO_MALLOC_TAGS
+#define MALLOC_MINCHUNK \
+    ALIGN_SIZE(CHUNK_OFFSET + MALLOC_PADDING + MALLOC_MINSIZE, CHUNK_ALIGN)
+#else
 #define MALLOC_MINCHUNK (CHUNK_OFFSET + MALLOC_PADDING + MALLOC_MINSIZE)
+#endif
+
+#ifdef NANO_MALLOC_TAGS
+/* Boundary tags.  The two low bits of every size say whether the
+ * chunk is on a free list and whether the chunk just below it is, and
+ * a free chunk ends with a pointer to its own head.  The free lists
+ * are doubly linked, so free finds and unlinks both neighbours without
+ * walking a list.  They are kept in address order, as without tags:
+ * a chunk that merges keeps the place of its neighbour, and only one
+ * that merges with neither walks the list for its place, but first fit
+ * then packs the low end of the heap instead of scattering live chunks
+ * over all of it.  Binned chunks
+ * count as allocated.  Every run of chunks ends in a fence, a size
+ * zero allocated header, that nothing merges across.  */
+#define CHUNK_FREE 1L
+#define CHUNK_PREV_FREE 2L
+#define CHUNK_SIZE(c) ((c)->size & ~(CHUNK_FREE | CHUNK_PREV_FREE))
+#define SET_CHUNK_SIZE(c, s) \
+    ((c)->size = (long)(s) | ((c)->size & CHUNK_PREV_FREE))
+#define NEXT_CHUNK(c) ((chunk *)((char *)(c) + CHUNK_SIZE(c)))
+/* The footer of the free chunk that ends where C starts */
+#define PREV_CHUNK(c) (((chunk **)(c))[-1])
+#define FENCE_SIZE ((malloc_size_t)(&(((chunk *)0)->size)) + sizeof(long))
+#define SET_FENCE(p) (((chunk *)(p))->size = 0)
+#else
+#define CHUNK_SIZE(c) ((c)->size)
+#define SET_CHUNK_SIZE(c, s) ((c)->size = (s))
+#define FENCE_SIZE 0
+#define SET_FENCE(p) ((void)0)
+#endif
+
+#ifdef NANO_MALLOC_CONFIG
+/* Size classes and pools tuned to one program, in the header that
+ * libc/stdlib/mallconfig.py writes from its allocation trace.  */
+#include NANO_MALLOC_CONFIG
+#endif
+
+#ifdef NANO_MALLOC_BINS
+/* Small chunks are kept out of the address ordered free list, in
+ * segregated bins by payload class: bin i holds chunks with at least
+ * BIN_SIZE(i) bytes of payload, MALLOC_BIN_MIN << i unless the
+ * configuration lists the classes in MALLOC_BIN_SIZES.  Small
+ * requests are rounded up to their class so that a freed chunk always
+ * serves its class again, and both malloc and free of them are a
+ * single list pop or push.  Binned chunks are not coalesced, so each
+ * bin keeps at most MALLOC_BIN_DEPTH of them; a chunk freed into a
+ * full bin goes to the free list and merges with its neighbours, and
+ * the rest are returned there if the heap runs out.  */
+#ifdef MALLOC_BIN_SIZES
+static const malloc_size_t bin_sizes[MALLOC_BIN_COUNT] = { MALLOC_BIN_SIZES };
+#ifndef MALLOC_BIN_MIN
+#define MALLOC_BIN_MIN (bin_sizes[0])
+#endif
+#ifndef MALLOC_BIN_MAX
+#define MALLOC_BIN_MAX (bin_sizes[MALLOC_BIN_COUNT - 1])
+#endif
+#define BIN_SIZE(i) (bin_sizes[i])
+#else
+#ifndef MALLOC_BIN_MIN
+#define MALLOC_BIN_MIN (4U)
+#endif
+#ifndef MALLOC_BIN_COUNT
+#define MALLOC_BIN_COUNT 6
+#endif
+#define MALLOC_BIN_MAX (MALLOC_BIN_MIN << (MALLOC_BIN_COUNT - 1))
+#define BIN_SIZE(i) (MALLOC_BIN_MIN << (i))
+#endif
+#ifndef MALLOC_BIN_DEPTH
+#define MALLOC_BIN_DEPTH 8
+#endif
+#endif
+
+/* Regions added with malloc_region_add.  Each has its own free list
+ * and is carved from the bottom up without sbrk.
+ * Entry 0 stands for the sbrk heap and is unused.  */
+typedef struct malloc_region
+{
+    chunk * free_list;
+    char * start;
+    char * brk;         /* first byte never handed out */
+    char * end;
+} region;
 
 /* Forward data declarations */
-extern chunk * free_list;
-extern char * sbrk_start;
+extern chunk * free_list _NEAR_DATA;
+extern region regions[MALLOC_REGIONS];
+extern char * sbrk_start _NEAR_DATA;
 extern struct mallinfo current_mallinfo;
+extern mpool_t * pools;
+extern arena_t * arenas;
+extern buddy_t * buddies;
+extern struct mallcounters counters;
+#ifdef NANO_MALLOC_BINS
+extern chunk * bins[MALLOC_BIN_COUNT] _NEAR_DATA;
+extern unsigned char bin_fill[MALLOC_BIN_COUNT] _NEAR_DATA;
+#endif
+#ifdef NANO_MALLOC_TAGS
+extern chunk * heap_fence;
+#endif
+extern unsigned char fit_policy _NEAR_DATA;
+extern chunk * rover _NEAR_DATA;
+extern malloc_size_t top_pad;
+extern malloc_size_t trim_threshold;
+extern char * sbrk_mark;
+#ifdef NANO_MALLOC_TRACE
+extern struct malltrace trace_ring[MALLOC_TRACE_SIZE];
+extern unsigned long trace_count;
+extern unsigned int trace_quiet _NEAR_DATA;
+#endif
 
 /* Forward function declarations */
 extern void * nano_malloc(RARG malloc_size_t);
 extern void nano_free (RARG void * free_p);
+extern void insert_free_chunk (RARG chunk ** list, chunk * p_to_free);
+extern void find_largest (void);
 extern void nano_cfree(RARG void * ptr);
 extern void * nano_calloc(RARG malloc_size_t n, malloc_size_t elem);
 extern void nano_malloc_stats(RONEARG);
@@ -175,6 +334,7 @@ extern malloc_size_t nano_malloc_usable_size(RARG void * ptr);
 extern void * nano_realloc(RARG void * ptr, malloc_size_t size);
 extern void * nano_memalign(RARG size_t align, size_t s);
 extern int nano_mallopt(RARG int parameter_number, int parameter_value);
+extern void * nano_malloc_region(RARG int id, malloc_size_t s);
 extern void * nano_valloc(RARG size_t s);
 extern void * nano_pvalloc(RARG size_t s);
 
@@ -191,12 +351,409 @@ static inline chunk * get_chunk_from_ptr(void * ptr)
     return c;
 }
 
+/* Pools registered with mpool_register serve the requests that fit in
+ * their blocks before the heap is looked at.  The list is sorted by
+ * block size, so the first pool with a free block that fits is also
+ * the tightest.  Called with the lock held.  */
+static inline void * pool_alloc(malloc_size_t s)
+{
+    mpool_t * pool;
+    void * p;
+
+    for (pool = pools; pool; pool = pool->_next)
+    {
+        if (pool->_size >= s && (p = pool->_free) != NULL)
+        {
+            pool->_free = *(void **)p;
+            pool->_nfree--;
+            return p;
+        }
+    }
+    return NULL;
+}
+
+/* The registered pool that PTR belongs to, if any */
+static inline mpool_t * pool_of(void * ptr)
+{
+    mpool_t * pool;
+
+    for (pool = pools; pool; pool = pool->_next)
+        if ((char *)ptr >= pool->_start && (char *)ptr < pool->_end)
+            return pool;
+    return NULL;
+}
+
+/* The arena that PTR was allocated from, if any */
+static inline arena_t * arena_of(void * ptr)
+{
+    arena_t * a;
+
+    for (a = arenas; a; a = a->_next)
+        if ((char *)ptr >= a->_start && (char *)ptr < a->_end)
+            return a;
+    return NULL;
+}
+
+/* The registered buddy allocator that PTR belongs to, if any */
+static inline buddy_t * buddy_of(void * ptr)
+{
+    buddy_t * b;
+
+    for (b = buddies; b; b = b->_next)
+        if (buddy_owns(b, ptr))
+            return b;
+    return NULL;
+}
+
+/* The added region that chunk C lies in, or 0 for the sbrk heap */
+static inline int region_of(chunk * c)
+{
+    int i;
+
+    for (i = 1; i < MALLOC_REGIONS; i++)
+        if ((char *)c >= regions[i].start && (char *)c < regions[i].end)
+            return i;
+    return 0;
+}
+
+/* Histogram class of SIZE bytes, see struct mallcounters */
+static inline int hist_class(size_t size)
+{
+    size_t c = MALLOC_HIST_MIN << 1;
+    int i = 0;
+
+    while (i < MALLOC_HIST_BINS - 1 && size >= c)
+    {
+        c <<= 1;
+        i++;
+    }
+    return i;
+}
+
+/* The counters cover the free chunks of the sbrk heap only, that is
+ * those on free_list and in the bins.  Called with the lock held.  */
+static inline void count_free(long size)
+{
+    counters.nfree[hist_class(size)]++;
+    counters.free += size;
+    if ((size_t)size > counters.largest_free)
+        counters.largest_free = size;
+}
+
+/* A free chunk of SIZE bytes is being merged into a bigger one, which
+ * is counted afterwards, so the largest stays the largest.  */
+static inline void uncount_free(long size)
+{
+    counters.nfree[hist_class(size)]--;
+    counters.free -= size;
+}
+
+/* A free chunk of SIZE bytes has been taken off its list */
+static inline void uncount_taken(long size)
+{
+    uncount_free(size);
+    if ((size_t)size == counters.largest_free)
+        find_largest();
+}
+
+static inline void count_live(long delta)
+{
+    counters.live += delta;
+    if (counters.live > counters.live_peak)
+        counters.live_peak = counters.live;
+}
+
+#ifdef CURRENT_QUOTA
+/* Whether SIZE more bytes would take Q past its limit */
+static inline int quota_full(mallquota_t * q, malloc_size_t size)
+{
+    return q != NULL && q->limit != 0
+           && (q->current > q->limit || size > q->limit - q->current);
+}
+
+/* Charge DELTA bytes of heap chunks to Q, the quota each chunk
+ * records in its header; current never goes below 0 */
+static inline void charge_quota(mallquota_t * q, long delta)
+{
+    if (q == NULL)
+        return;
+    if (delta < 0 && (size_t)-delta > q->current)
+        q->current = 0;
+    else
+        q->current += delta;
+    if (q->current > q->peak)
+        q->peak = q->current;
+}
+
+#define QUOTA_FULL(q, size) quota_full(q, size)
+#define CHARGE_QUOTA(q, delta) charge_quota(q, delta)
+#define CHUNK_QUOTA(c) ((c)->quota)
+#define SET_CHUNK_QUOTA(c, q) ((c)->quota = (q))
+#else
+#define QUOTA_FULL(q, size) 0
+#define CHARGE_QUOTA(q, delta) ((void)0)
+#define CHUNK_QUOTA(c) NULL
+#define SET_CHUNK_QUOTA(c, q) ((void)0)
+#endif
+
+static inline void count_failure(malloc_size_t s)
+{
+    counters.nfail[hist_class(s)]++;
+}
+
+#ifdef NANO_MALLOC_TRACE
+typedef char trace_size_is_power_of_two
+    [(MALLOC_TRACE_SIZE & (MALLOC_TRACE_SIZE - 1)) == 0 ? 1 : -1];
+
+/* Put an event in the ring, unless realloc is making its own calls
+ * to malloc and free.  Called with the lock held.  */
+static inline void trace_event(int op, void * ptr, malloc_size_t size,
+                               void * caller)
+{
+    struct malltrace * e;
+
+    if (trace_quiet)
+        return;
+    e = &trace_ring[(unsigned int)trace_count & (MALLOC_TRACE_SIZE - 1)];
+    e->op = op;
+    e->ptr = ptr;
+    e->size = size;
+    e->caller = caller;
+    e->time = __malloc_trace_clock();
+    trace_count++;
+}
+#endif /* NANO_MALLOC_TRACE */
+
+#ifdef NANO_MALLOC_TAGS
+/* Take free chunk C off *LIST */
+static inline void unlink_chunk(chunk ** list, chunk * c)
+{
+    if (c == rover)
+        rover = c->prev;
+    if (c->prev)
+        c->prev->next = c->next;
+    else
+        *list = c->next;
+    if (c->next)
+        c->next->prev = c->prev;
+}
+#endif
+
+#ifdef NANO_MALLOC_BINS
+/* Index of the smallest class that holds S bytes, S <= MALLOC_BIN_MAX */
+static inline int bin_for_request(malloc_size_t s)
+{
+    int i = 0;
+
+#ifdef MALLOC_BIN_SIZES
+    while (bin_sizes[i] < s)
+        i++;
+#else
+    malloc_size_t c = MALLOC_BIN_MIN;
+
+    while (c < s)
+    {
+        c <<= 1;
+        i++;
+    }
+#endif
+    return i;
+}
+
+/* Index of the largest class a chunk of SIZE bytes can serve, or -1
+ * if it belongs on the free list */
+static inline int bin_for_chunk(long size)
+{
+    malloc_size_t payload = size - CHUNK_OFFSET - MALLOC_PADDING;
+    int i = 0;
+
+    if (size < (long)(CHUNK_OFFSET + MALLOC_PADDING + MALLOC_BIN_MIN)
+        || payload > MALLOC_BIN_MAX)
+        return -1;
+
+#ifdef MALLOC_BIN_SIZES
+    for (i = MALLOC_BIN_COUNT - 1; bin_sizes[i] > payload; i--)
+        ;
+#else
+    for (payload /= MALLOC_BIN_MIN; payload > 1; payload >>= 1)
+        i++;
+#endif
+    return i;
+}
+#endif /* NANO_MALLOC_BINS */
+
 #ifdef DEFINE_MALLOC
 /* List list header of free blocks */
-chunk * free_list = NULL;
+chunk * free_list _NEAR_DATA = NULL;
 
 /* Starting point of memory allocated from system */
-char * sbrk_start = NULL;
+char * sbrk_start _NEAR_DATA = NULL;
+
+/* Pools registered for small requests */
+mpool_t * pools = NULL;
+
+/* Arenas known to free */
+arena_t * arenas = NULL;
+
+/* Buddy allocators registered for memalign */
+buddy_t * buddies = NULL;
+
+/* Added regions */
+region regions[MALLOC_REGIONS];
+
+/* Heap counters */
+struct mallcounters counters;
+
+#ifdef NANO_MALLOC_TAGS
+/* Fence at the top of the sbrk heap */
+chunk * heap_fence = NULL;
+#endif
+
+/* The mallopt settings.  Next fit searches from the chunk after the
+ * rover, the chunk before the last one taken from free_list, or from
+ * the head of the list when it is NULL.  */
+unsigned char fit_policy _NEAR_DATA = M_POLICY_FIRST_FIT;
+chunk * rover _NEAR_DATA = NULL;
+malloc_size_t top_pad = 0;
+malloc_size_t trim_threshold = (malloc_size_t)-1;
+
+/* The highest break before a trim, so that calloc knows the memory
+ * between it and the break has been handed out before */
+char * sbrk_mark = NULL;
+
+#ifdef NANO_MALLOC_TRACE
+/* The last MALLOC_TRACE_SIZE events, and the count of all of them */
+struct malltrace trace_ring[MALLOC_TRACE_SIZE];
+unsigned long trace_count;
+
+/* Set while realloc runs, which records its calls as one event */
+unsigned int trace_quiet _NEAR_DATA;
+
+/* No clock unless the program brings one */
+__attribute__((__weak__)) unsigned long __malloc_trace_clock(void)
+{
+    return 0;
+}
+#endif
+
+/* Find the biggest free chunk again, once the one that was has been
+ * taken.  Called with the lock held.  */
+void find_largest(void)
+{
+    chunk * c;
+    size_t largest = 0;
+
+    for (c = free_list; c; c = c->next)
+        if ((size_t)CHUNK_SIZE(c) > largest)
+            largest = CHUNK_SIZE(c);
+#ifdef NANO_MALLOC_BINS
+    {
+        int i;
+
+        /* Only the top non-empty bin can hold anything bigger */
+        for (i = MALLOC_BIN_COUNT - 1; i >= 0 && bins[i] == NULL; i--)
+            ;
+        if (i >= 0)
+            for (c = bins[i]; c; c = c->next)
+                if ((size_t)CHUNK_SIZE(c) > largest)
+                    largest = CHUNK_SIZE(c);
+    }
+#endif
+    counters.largest_free = largest;
+}
+
+/* Hand the memory at START of SIZE bytes to malloc as region ID */
+int malloc_region_add(int id, void * start, size_t size)
+{
+    char * p = (char *)ALIGN_PTR((uintptr_t)start, CHUNK_ALIGN);
+    region * rg;
+#ifdef INTERNAL_NEWLIB
+    struct _reent * reent_ptr = _REENT;
+#endif
+
+    if (id <= 0 || id >= MALLOC_REGIONS
+        || (size_t)(p - (char *)start) + FENCE_SIZE >= size)
+    {
+        RERRNO = EINVAL;
+        return -1;
+    }
+
+    /* Two threads adding the same ID must not both see it unused */
+    MALLOC_LOCK;
+    if (regions[id].end != NULL)
+    {
+        MALLOC_UNLOCK;
+        RERRNO = EINVAL;
+        return -1;
+    }
+    rg = &regions[id];
+    rg->free_list = NULL;
+    rg->start = rg->brk = p;
+    rg->end = (char *)start + size;
+    SET_FENCE(rg->brk);
+    MALLOC_UNLOCK;
+    return 0;
+}
+
+#if defined(MALLOC_CONFIG_POOLS) || defined(MALLOC_CONFIG_REGIONS)
+/* The pools and regions of the configuration, set up before main
+ * over storage of their own.  MALLOC_CONFIG_POOLS(P) lists them as
+ * P(block size, blocks) and MALLOC_CONFIG_REGIONS(R) as R(id, bytes);
+ * a malloc from a constructor that runs earlier is served from the
+ * heap.  */
+#define CONFIG_POOL(size, count) \
+    { \
+        static mpool_t pool; \
+        static char buf[(count) * ALIGN_SIZE(MAX((size), sizeof(void *)), \
+                                             MPOOL_ALIGN)] \
+            __attribute__((__aligned__(MPOOL_ALIGN))); \
+        mpool_init(&pool, buf, sizeof buf, (size)); \
+        mpool_register(&pool); \
+    }
+#define CONFIG_REGION(id, bytes) \
+    { \
+        static char buf[bytes]; \
+        malloc_region_add((id), buf, sizeof buf); \
+    }
+
+static void __attribute__((__constructor__)) malloc_configure(void)
+{
+#ifdef MALLOC_CONFIG_POOLS
+    MALLOC_CONFIG_POOLS(CONFIG_POOL)
+#endif
+#ifdef MALLOC_CONFIG_REGIONS
+    MALLOC_CONFIG_REGIONS(CONFIG_REGION)
+#endif
+}
+#endif /* MALLOC_CONFIG_POOLS || MALLOC_CONFIG_REGIONS */
+
+#ifdef NANO_MALLOC_BINS
+/* Heads of the small chunk bins, and how many chunks each holds */
+chunk * bins[MALLOC_BIN_COUNT] _NEAR_DATA;
+unsigned char bin_fill[MALLOC_BIN_COUNT] _NEAR_DATA;
+
+/* Return every binned chunk to the free list so that it can be
+ * coalesced.  Called with the lock held once sbrk has failed; returns
+ * nonzero if anything was moved.  */
+static int flush_bins(RONEARG)
+{
+    chunk * c;
+    int i, moved = 0;
+
+    for (i = 0; i < MALLOC_BIN_COUNT; i++)
+    {
+        while ((c = bins[i]) != NULL)
+        {
+            bins[i] = c->next;
+            uncount_free(CHUNK_SIZE(c));
+            insert_free_chunk(RCALL &free_list, c);
+            moved = 1;
+        }
+        bin_fill[i] = 0;
+    }
+    return moved;
+}
+#endif /* NANO_MALLOC_BINS */
 
 /** Function sbrk_aligned
   * Algorithm:
@@ -225,21 +782,341 @@ static void* sbrk_aligned(RARG malloc_size_t s)
         if (p == (void *)-1)
             return p;
     }
+    if ((size_t)(align_p + s - sbrk_start) > counters.peak)
+        counters.peak = align_p + s - sbrk_start;
     return align_p;
 }
 
+/* Find the link to a free chunk of at least ALLOC_SIZE bytes on
+ * *LIST under fit_policy, or NULL.  Next fit only applies to
+ * free_list.  */
+static chunk ** find_fit(chunk ** list, malloc_size_t alloc_size)
+{
+    chunk ** link, ** best = NULL;
+
+    if (fit_policy == M_POLICY_NEXT_FIT && list == &free_list
+        && rover != NULL)
+    {
+        chunk * stop = rover->next;
+
+        /* On from the rover, then round from the head */
+        for (link = &rover->next; *link; link = &(*link)->next)
+            if (CHUNK_SIZE(*link) >= (long)alloc_size)
+                return link;
+        for (link = list; *link != stop; link = &(*link)->next)
+            if (CHUNK_SIZE(*link) >= (long)alloc_size)
+                return link;
+        return NULL;
+    }
+
+    for (link = list; *link; link = &(*link)->next)
+    {
+        long size = CHUNK_SIZE(*link);
+
+        if (size < (long)alloc_size)
+            continue;
+        if (fit_policy != M_POLICY_BEST_FIT)
+            return link;
+        if (best == NULL || size < CHUNK_SIZE(*best))
+        {
+            best = link;
+            if (size == (long)alloc_size)
+                break;
+        }
+    }
+    return best;
+}
+
+/* Take a chunk of ALLOC_SIZE bytes from the fit in *LIST, splitting
+ * it when the rest is big enough to be a chunk of its own.  Called
+ * with the lock held.  */
+#ifdef NANO_MALLOC_TAGS
+static chunk * take_fit(chunk ** list, malloc_size_t alloc_size)
+{
+    chunk ** link = find_fit(list, alloc_size);
+    chunk * r, * before;
+    long size, rem;
+
+    if (link == NULL)
+        return NULL;
+    r = *link;
+    before = r->prev;
+    size = CHUNK_SIZE(r);
+    rem = size - (long)alloc_size;
+    if (rem >= (long)MALLOC_MINCHUNK)
+    {
+        /* The rest takes the place of R on the list */
+        chunk * t = (chunk *)((char *)r + alloc_size);
+
+        t->size = rem | CHUNK_FREE;
+        t->next = r->next;
+        t->prev = r->prev;
+        if (t->prev)
+            t->prev->next = t;
+        else
+            *list = t;
+        if (t->next)
+            t->next->prev = t;
+        PREV_CHUNK(NEXT_CHUNK(t)) = t;
+        r->size = alloc_size;
+        if (list == &free_list)
+            count_free(rem);
+    }
+    else
+    {
+        unlink_chunk(list, r);
+        r->size = size;
+        NEXT_CHUNK(r)->size &= ~CHUNK_PREV_FREE;
+    }
+    if (list == &free_list)
+    {
+        rover = before;
+        uncount_taken(size);
+    }
+    return r;
+}
+#else
+static chunk * take_fit(chunk ** list, malloc_size_t alloc_size)
+{
+    chunk ** link = find_fit(list, alloc_size);
+    chunk * r;
+    long size, rem;
+
+    if (link == NULL)
+        return NULL;
+    r = *link;
+    size = r->size;
+    rem = size - (long)alloc_size;
+    if (rem >= (long)MALLOC_MINCHUNK)
+    {
+        /* Break it into two chunks and return the first one */
+        chunk * t = (chunk *)((char *)r + alloc_size);
+
+        t->size = rem;
+        t->next = r->next;
+        r->size = alloc_size;
+        *link = t;
+        if (list == &free_list)
+            count_free(rem);
+    }
+    else
+    {
+        /* Exactly the size or slightly bigger than requested,
+         * just remove it from the list */
+        *link = r->next;
+    }
+    if (list == &free_list)
+    {
+        /* The chunk holding LINK, if it is not the head */
+        rover = link == list ? NULL : (chunk *)((char *)link - CHUNK_OFFSET);
+        uncount_taken(size);
+    }
+    return r;
+}
+#endif /* NANO_MALLOC_TAGS */
+
+#ifdef NANO_MALLOC_TAGS
+/* Get a chunk of ALLOC_SIZE bytes from sbrk.  If nothing else moved
+ * the break since the last call, the new memory goes on from the
+ * fence and takes in the free chunk below it, if any, so sbrk is only
+ * asked for the difference.  Returns NULL on failure.  Called with
+ * the lock held.  */
+static chunk * sbrk_chunk(RARG malloc_size_t alloc_size)
+{
+    chunk * r = heap_fence;
+
+    if (r != NULL && (char *)_SBRK_R(RCALL 0) == (char *)r + FENCE_SIZE)
+    {
+        long more = alloc_size;
+
+        if (r->size & CHUNK_PREV_FREE)
+        {
+            r = PREV_CHUNK(r);
+            more -= CHUNK_SIZE(r);
+        }
+        assert(more > 0);
+        if (_SBRK_R(RCALL more) == (void *)-1)
+            return NULL;
+        if (r != heap_fence)
+        {
+            unlink_chunk(&free_list, r);
+            uncount_taken(CHUNK_SIZE(r));
+        }
+        if ((size_t)((char *)r + alloc_size + FENCE_SIZE - sbrk_start)
+            > counters.peak)
+            counters.peak = (char *)r + alloc_size + FENCE_SIZE - sbrk_start;
+    }
+    else
+    {
+        r = sbrk_aligned(RCALL alloc_size + FENCE_SIZE);
+        if (r == (void *)-1)
+            return NULL;
+    }
+    r->size = alloc_size;
+    heap_fence = (chunk *)((char *)r + alloc_size);
+    SET_FENCE(heap_fence);
+    return r;
+}
+#else
+/* Get a chunk of ALLOC_SIZE bytes from sbrk, or NULL.  */
+static chunk * sbrk_chunk(RARG malloc_size_t alloc_size)
+{
+    chunk * r = sbrk_aligned(RCALL alloc_size);
+
+    if (r == (void *)-1)
+        return NULL;
+    r->size = alloc_size;
+    return r;
+}
+#endif /* NANO_MALLOC_TAGS */
+
+/* Grow the heap by a chunk of ALLOC_SIZE bytes, asking sbrk for
+ * top_pad bytes more when it can have them.  They go on free_list
+ * for the requests to come.  Called with the lock held.  */
+static chunk * grow_heap(RARG malloc_size_t alloc_size)
+{
+    chunk * r = NULL;
+
+    if (top_pad != 0 && alloc_size + top_pad > alloc_size)
+        r = sbrk_chunk(RCALL alloc_size + top_pad);
+    if (r == NULL)
+        return sbrk_chunk(RCALL alloc_size);
+    if (top_pad >= MALLOC_MINCHUNK)
+    {
+        chunk * t = (chunk *)((char *)r + alloc_size);
+
+        SET_CHUNK_SIZE(r, alloc_size);
+        t->size = top_pad;
+        insert_free_chunk(RCALL &free_list, t);
+    }
+    return r;
+}
+
+/* Turn chunk R of ALLOC_SIZE bytes into the pointer handed out */
+static void * chunk_to_mem(chunk * r, malloc_size_t alloc_size)
+{
+    char * ptr, * align_ptr;
+    int offset;
+
+    ptr = (char *)r + CHUNK_OFFSET;
+
+    align_ptr = (char *)ALIGN_PTR((uintptr_t)ptr, MALLOC_ALIGN);
+    offset = align_ptr - ptr;
+
+    if (offset)
+    {
+        /* Initialize the size field of the header that ends at
+           align_ptr, at align_ptr - CHUNK_OFFSET, with the negative
+           offset to the start of the chunk.
+
+           The negative offset to size from align_ptr - CHUNK_OFFSET is
+           the size of any remaining padding minus CHUNK_OFFSET.  This is
+           equivalent to the total size of the padding, because the size of
+           any remaining padding is the total size of the padding minus
+           CHUNK_OFFSET.
+
+           Note that the size of the padding must be at least CHUNK_OFFSET.
+
+           The rest of the padding is not initialized.  */
+        ((chunk *)((char *)r + offset))->size = -offset;
+    }
+
+    assert(align_ptr + alloc_size - CHUNK_OFFSET - MALLOC_PADDING
+           <= (char *)r + alloc_size);
+    return align_ptr;
+}
+
+/** Function nano_malloc_region
+  * Allocate from region ID, the fit from its free list and then from
+  * its untouched top.  Region 0 is the sbrk heap.
+  */
+void * nano_malloc_region(RARG int id, malloc_size_t s)
+{
+    region * rg;
+    chunk * r;
+    malloc_size_t alloc_size;
+
+    if (id == 0)
+        return nano_malloc(RCALL s);
+
+    if (id < 0 || id >= MALLOC_REGIONS || regions[id].end == NULL)
+    {
+        RERRNO = EINVAL;
+        return NULL;
+    }
+    rg = &regions[id];
+
+    alloc_size = ALIGN_SIZE(s, CHUNK_ALIGN); /* size of aligned data load */
+    alloc_size += MALLOC_PADDING; /* padding */
+    alloc_size += CHUNK_OFFSET; /* size of chunk head */
+    alloc_size = MAX(alloc_size, MALLOC_MINCHUNK);
+
+    if (alloc_size >= MAX_ALLOC_SIZE || alloc_size < s)
+    {
+        RERRNO = ENOMEM;
+        return NULL;
+    }
+
+    MALLOC_LOCK;
+    r = take_fit(&rg->free_list, alloc_size);
+    if (r == NULL)
+    {
+        if (alloc_size + FENCE_SIZE > (malloc_size_t)(rg->end - rg->brk))
+        {
+            RERRNO = ENOMEM;
+            MALLOC_UNLOCK;
+            return NULL;
+        }
+        /* Under the tags this keeps the fence's note of a free chunk
+         * below */
+        r = (chunk *)rg->brk;
+        SET_CHUNK_SIZE(r, alloc_size);
+        rg->brk += alloc_size;
+        SET_FENCE(rg->brk);
+    }
+    MALLOC_UNLOCK;
+
+    return chunk_to_mem(r, alloc_size);
+}
+
+#if defined(INTERNAL_NEWLIB) && !defined(_REENT_ONLY)
+void * malloc_region(int id, size_t s)
+{
+    return _malloc_region_r(_REENT, id, s);
+}
+#endif
+
 /** Function nano_malloc
   * Algorithm:
-  *   Walk through the free list to find the first match. If fails to find
-  *   one, call sbrk to allocate a new chunk.
+  *   Pop the bin of a small request if it is not empty.  Otherwise
+  *   walk through the free list to find the first match. If fails to
+  *   find one, call sbrk to allocate a new chunk.
+  *   With NANO_MALLOC_TRACE this is malloc_untraced, which the
+  *   nano_malloc after it wraps.
   */
+#ifdef NANO_MALLOC_TRACE
+static void * malloc_untraced(RARG malloc_size_t s)
+#else
 void * nano_malloc(RARG malloc_size_t s)
+#endif
 {
-    chunk *p, *r;
-    char * ptr, * align_ptr;
-    int offset;
+    chunk *r;
+#ifndef NANO_MALLOC_TAGS
+    chunk *p;
+#endif
+    char * ptr;
 
     malloc_size_t alloc_size;
+    malloc_size_t req = s;
+#ifdef NANO_MALLOC_BINS
+    int bin = -1;
+
+    if (s <= MALLOC_BIN_MAX)
+    {
+        bin = bin_for_request(s);
+        s = BIN_SIZE(bin);
+    }
+#endif
 
     alloc_size = ALIGN_SIZE(s, CHUNK_ALIGN); /* size of aligned data load */
     alloc_size += MALLOC_PADDING; /* padding */
@@ -248,80 +1125,87 @@ void * nano_malloc(RARG malloc_size_t s)
 
     if (alloc_size >= MAX_ALLOC_SIZE || alloc_size < s)
     {
+        count_failure(req);
         RERRNO = ENOMEM;
         return NULL;
     }
 
     MALLOC_LOCK;
 
-    p = free_list;
-    r = p;
+#ifdef CURRENT_ARENA
+    if (CURRENT_ARENA != NULL
+        && (ptr = __arena_bump(CURRENT_ARENA, MAX(MALLOC_ALIGN, ARENA_ALIGN),
+                               req)) != NULL)
+    {
+        MALLOC_UNLOCK;
+        return ptr;
+    }
+#endif
 
-    while (r)
+    if (pools != NULL && (ptr = pool_alloc(req)) != NULL)
     {
-        int rem = r->size - alloc_size;
-        if (rem >= 0)
-        {
-            if (rem >= MALLOC_MINCHUNK)
-            {
-                if (p == r)
-                {
-                    /* First item in the list, break it into two chunks
-                    *  and return the first one */
-                    r->size = alloc_size;
-                    free_list = (chunk *)((char *)r + alloc_size);
-                    free_list->size = rem;
-                    free_list->next = r->next;
-                } else {
-                    /* Any other item in the list. Split and return
-                    * the first one */
-                    r->size = alloc_size;
-                    p->next = (chunk *)((char *)r + alloc_size);
-                    p->next->size = rem;
-                    p->next->next = r->next;
-                }
-            }
-            /* Find a chunk that is exactly the size or slightly bigger
-             * than requested size, just return this chunk */
-            else if (p == r)
-            {
-                /* Now it implies p==r==free_list. Move the free_list
-                 * to next chunk */
-                free_list = r->next;
-            }
-            else
-            {
-                /* Normal case. Remove it from free_list */
-                p->next = r->next;
-            }
-            break;
-        }
-        p=r;
-        r=r->next;
+        MALLOC_UNLOCK;
+        return ptr;
+    }
+
+    if (QUOTA_FULL(CURRENT_QUOTA, alloc_size))
+    {
+        count_failure(req);
+        RERRNO = ENOMEM;
+        MALLOC_UNLOCK;
+        return NULL;
     }
 
+#ifdef NANO_MALLOC_BINS
+    if (bin >= 0 && (r = bins[bin]) != NULL)
+    {
+        bins[bin] = r->next;
+        bin_fill[bin]--;
+        uncount_taken(CHUNK_SIZE(r));
+        goto found;
+    }
+
+retry:
+#endif
+    r = take_fit(&free_list, alloc_size);
+
     /* Failed to find a appropriate chunk. Ask for more memory */
+#ifdef NANO_MALLOC_TAGS
+    if (r == NULL && (r = grow_heap(RCALL alloc_size)) == NULL)
+    {
+#ifdef NANO_MALLOC_BINS
+        /* Coalesce what the bins are holding and look again */
+        if (flush_bins(RONECALL))
+            goto retry;
+#endif
+        count_failure(req);
+        RERRNO = ENOMEM;
+        MALLOC_UNLOCK;
+        return NULL;
+    }
+#else
     if (r == NULL)
     {
-        r = sbrk_aligned(RCALL alloc_size);
+        r = grow_heap(RCALL alloc_size);
 
-        /* sbrk returns -1 if fail to allocate */
-        if (r == (void *)-1)
+        if (r == NULL)
         {
+#ifdef NANO_MALLOC_BINS
+            /* Coalesce what the bins are holding and look again */
+            if (flush_bins(RONECALL))
+                goto retry;
+#endif
             /* sbrk didn't have the requested amount. Let's check
              * if the last item in the free list is adjacent to the
              * current heap end (sbrk(0)). In that case, only ask
              * for the difference in size and merge them */
-            p = free_list;
-            r = p;
+            chunk ** link = &free_list;
 
-            while (r)
-            {
-                p=r;
-                r=r->next;
-            }
+            while (*link && (*link)->next)
+                link = &(*link)->next;
+            p = *link;
 
-            if ((char *)p + p->size == (char *)_SBRK_R(RCALL 0))
+            if (p != NULL && (char *)p + p->size == (char *)_SBRK_R(RCALL 0))
             {
                /* The last free item has the heap end as neighbour.
                 * Let's ask for a smaller amount and merge */
@@ -333,11 +1217,17 @@ void * nano_malloc(RARG malloc_size_t s)
 
                if (sbrk_aligned(RCALL alloc_size) != (void *)-1)
                {
+                   /* The merged chunk leaves the free list */
+                   *link = NULL;
+                   if (rover == p)
+                       rover = NULL;
+                   uncount_taken(p->size);
                    p->size += alloc_size;
                    r = p;
                }
                else
                {
+                   count_failure(req);
                    RERRNO = ENOMEM;
                    MALLOC_UNLOCK;
                    return NULL;
@@ -345,49 +1235,86 @@ void * nano_malloc(RARG malloc_size_t s)
             }
             else
             {
+                count_failure(req);
                 RERRNO = ENOMEM;
                 MALLOC_UNLOCK;
                 return NULL;
             }
         }
-        else
-        {
-            r->size = alloc_size;
-        }
     }
+#endif /* NANO_MALLOC_TAGS */
+#ifdef NANO_MALLOC_BINS
+found:
+#endif
+    count_live(CHUNK_SIZE(r));
+    SET_CHUNK_QUOTA(r, CURRENT_QUOTA);
+    CHARGE_QUOTA(CURRENT_QUOTA, CHUNK_SIZE(r));
     MALLOC_UNLOCK;
 
-    ptr = (char *)r + CHUNK_OFFSET;
-
-    align_ptr = (char *)ALIGN_PTR((uintptr_t)ptr, MALLOC_ALIGN);
-    offset = align_ptr - ptr;
-
-    if (offset)
-    {
-        /* Initialize sizeof (malloc_chunk.size) bytes at
-           align_ptr - CHUNK_OFFSET with negative offset to the
-           size field (at the start of the chunk).
-
-           The negative offset to size from align_ptr - CHUNK_OFFSET is
-           the size of any remaining padding minus CHUNK_OFFSET.  This is
-           equivalent to the total size of the padding, because the size of
-           any remaining padding is the total size of the padding minus
-           CHUNK_OFFSET.
-
-           Note that the size of the padding must be at least CHUNK_OFFSET.
+    return chunk_to_mem(r, alloc_size);
+}
 
-           The rest of the padding is not initialized.  */
-        *(long *)((char *)r + offset) = -offset;
-    }
+#ifdef NANO_MALLOC_TRACE
+/* The lock is recursive, so it can be held across the event.  The
+ * return address is the caller of malloc as long as the compiler
+ * makes a tail call of the one in malloc.c.  */
+void * nano_malloc(RARG malloc_size_t s)
+{
+    void * mem;
 
-    assert(align_ptr + size <= (char *)r + alloc_size);
-    return align_ptr;
+    MALLOC_LOCK;
+    mem = malloc_untraced(RCALL s);
+    trace_event(MALLOC_TRACE_MALLOC, mem, s, __builtin_return_address(0));
+    MALLOC_UNLOCK;
+    return mem;
 }
+#endif /* NANO_MALLOC_TRACE */
 #endif /* DEFINE_MALLOC */
 
 #ifdef DEFINE_FREE
 #define MALLOC_CHECK_DOUBLE_FREE
 
+/* Give the top of the sbrk heap back to sbrk once the free chunk
+ * there is bigger than trim_threshold, keeping top_pad bytes of it.
+ * Without the tags this walks free_list to its last chunk.  Called
+ * with the lock held.  */
+static void trim_top(RONEARG)
+{
+    chunk * top;
+    long size, keep;
+
+#ifdef NANO_MALLOC_TAGS
+    if (heap_fence == NULL || !(heap_fence->size & CHUNK_PREV_FREE))
+        return;
+    top = PREV_CHUNK(heap_fence);
+#else
+    if ((top = free_list) == NULL)
+        return;
+    while (top->next)
+        top = top->next;
+#endif
+    size = CHUNK_SIZE(top);
+    keep = ALIGN_SIZE(MAX(top_pad, MALLOC_MINCHUNK), CHUNK_ALIGN);
+    if ((malloc_size_t)size <= trim_threshold || size <= keep
+        || (char *)_SBRK_R(RCALL 0) != (char *)top + size + FENCE_SIZE
+        || _SBRK_R(RCALL -(size - keep)) == (void *)-1)
+        return;
+    if ((char *)top + size + FENCE_SIZE > sbrk_mark)
+        sbrk_mark = (char *)top + size + FENCE_SIZE;
+
+    /* The flags are below CHUNK_ALIGN, so they stay as they are */
+    top->size -= size - keep;
+#ifdef NANO_MALLOC_TAGS
+    heap_fence = NEXT_CHUNK(top);
+    heap_fence->size = CHUNK_PREV_FREE;
+    PREV_CHUNK(heap_fence) = top;
+#endif
+    uncount_free(size);
+    count_free(keep);
+    if ((size_t)size == counters.largest_free)
+        find_largest();
+}
+
 /** Function nano_free
   * Implementation of libc free.
   * Algorithm:
@@ -396,23 +1323,206 @@ void * nano_malloc(RARG malloc_size_t s)
   *  When free, insert the to-be-freed chunk into free list. The place to
   *  insert should make sure all chunks are sorted by address from low to
   *  high.  Then merge with neighbor chunks if adjacent.
+  *  With NANO_MALLOC_TAGS the neighbours are found from the boundary
+  *  tags instead, and the list is only walked when neither is free.
+  *  With NANO_MALLOC_TRACE this is free_untraced, which the nano_free
+  *  after it wraps.
   */
+#ifdef NANO_MALLOC_TRACE
+static void free_untraced (RARG void * free_p)
+#else
 void nano_free (RARG void * free_p)
+#endif
 {
     chunk * p_to_free;
-    chunk * p, * q;
 
     if (free_p == NULL) return;
 
+    MALLOC_LOCK;
+
+    if (arenas != NULL)
+    {
+        arena_t * a = arena_of(free_p);
+
+        if (a != NULL)
+        {
+            /* Only the most recent block can be given back */
+            if ((char *)free_p + ((size_t *)free_p)[-1] == a->_ptr)
+                a->_ptr = (char *)free_p - sizeof(size_t);
+            MALLOC_UNLOCK;
+            return;
+        }
+    }
+
+    if (pools != NULL)
+    {
+        mpool_t * pool = pool_of(free_p);
+
+        if (pool != NULL)
+        {
+            *(void **)free_p = pool->_free;
+            pool->_free = free_p;
+            pool->_nfree++;
+            MALLOC_UNLOCK;
+            return;
+        }
+    }
+
+    if (buddies != NULL)
+    {
+        buddy_t * b = buddy_of(free_p);
+
+        if (b != NULL)
+        {
+            buddy_free(b, free_p);
+            MALLOC_UNLOCK;
+            return;
+        }
+    }
+
     p_to_free = get_chunk_from_ptr(free_p);
 
+#if defined(NANO_MALLOC_TAGS) && defined(MALLOC_CHECK_DOUBLE_FREE)
+    if (p_to_free->size & CHUNK_FREE)
+    {
+        /* Report double free fault */
+        RERRNO = ENOMEM;
+        MALLOC_UNLOCK;
+        return;
+    }
+#endif
+
+    {
+        int id = region_of(p_to_free);
+
+        if (id != 0)
+        {
+            insert_free_chunk(RCALL &regions[id].free_list, p_to_free);
+            MALLOC_UNLOCK;
+            return;
+        }
+    }
+    count_live(-CHUNK_SIZE(p_to_free));
+    CHARGE_QUOTA(CHUNK_QUOTA(p_to_free), -CHUNK_SIZE(p_to_free));
+#ifdef NANO_MALLOC_BINS
+    {
+        int bin = bin_for_chunk(CHUNK_SIZE(p_to_free));
+
+        if (bin >= 0 && bin_fill[bin] < MALLOC_BIN_DEPTH)
+        {
+            p_to_free->next = bins[bin];
+            bins[bin] = p_to_free;
+            bin_fill[bin]++;
+            count_free(CHUNK_SIZE(p_to_free));
+            MALLOC_UNLOCK;
+            return;
+        }
+    }
+#endif
+    insert_free_chunk(RCALL &free_list, p_to_free);
+    if (trim_threshold != (malloc_size_t)-1)
+        trim_top(RONECALL);
+    MALLOC_UNLOCK;
+}
+
+#ifdef NANO_MALLOC_TRACE
+void nano_free (RARG void * free_p)
+{
+    if (free_p == NULL) return;
+
     MALLOC_LOCK;
+    free_untraced(RCALL free_p);
+    trace_event(MALLOC_TRACE_FREE, free_p, 0, __builtin_return_address(0));
+    MALLOC_UNLOCK;
+}
+#endif /* NANO_MALLOC_TRACE */
+
+#ifdef NANO_MALLOC_TAGS
+/* Merge P_TO_FREE with whichever of its neighbours are free and put
+ * the result in its place on the address ordered *LIST.  Called with
+ * the lock held.  */
+void insert_free_chunk (RARG chunk ** list, chunk * p_to_free)
+{
+    int counted = list == &free_list;
+    int linked = 0;
+    chunk * p = p_to_free;
+    chunk * q = NEXT_CHUNK(p_to_free);
+    chunk * before, * after;
+    long size = CHUNK_SIZE(p_to_free);
+
+    if (p->size & CHUNK_PREV_FREE)
+    {
+        /* The chunk below stays where it is on the list */
+        p = PREV_CHUNK(p);
+        if (counted)
+            uncount_free(CHUNK_SIZE(p));
+        size += CHUNK_SIZE(p);
+        linked = 1;
+    }
+    if (q->size & CHUNK_FREE)
+    {
+        if (counted)
+            uncount_free(CHUNK_SIZE(q));
+        size += CHUNK_SIZE(q);
+        if (linked)
+            unlink_chunk(list, q);
+        else
+        {
+            /* P takes the place of the chunk above */
+            p->next = q->next;
+            p->prev = q->prev;
+            if (p->prev)
+                p->prev->next = p;
+            else
+                *list = p;
+            if (p->next)
+                p->next->prev = p;
+            if (rover == q)
+                rover = p;
+            linked = 1;
+        }
+    }
+
+    /* The chunk below a free chunk is never free itself */
+    p->size = size | CHUNK_FREE;
+    q = NEXT_CHUNK(p);
+    q->size |= CHUNK_PREV_FREE;
+    PREV_CHUNK(q) = p;
+
+    if (!linked)
+    {
+        for (before = NULL, after = *list; after && after < p;
+             after = after->next)
+            before = after;
+        p->prev = before;
+        p->next = after;
+        if (before)
+            before->next = p;
+        else
+            *list = p;
+        if (after)
+            after->prev = p;
+    }
+    if (counted)
+        count_free(size);
+}
+#else
+/* Insert P_TO_FREE into the address ordered free list at *LIST,
+ * merging it with its neighbours.  Called with the lock held.  */
+void insert_free_chunk (RARG chunk ** list, chunk * p_to_free)
+{
+    /* Only the sbrk heap is counted; taken before the name is reused */
+    int counted = list == &free_list;
+    chunk * p, * q;
+    chunk * free_list = *list;
+
     if (free_list == NULL)
     {
         /* Set first free list element */
         p_to_free->next = free_list;
-        free_list = p_to_free;
-        MALLOC_UNLOCK;
+        *list = p_to_free;
+        if (counted)
+            count_free(p_to_free->size);
         return;
     }
 
@@ -422,6 +1532,10 @@ void nano_free (RARG void * free_p)
         {
             /* Chunk to free is just before the first element of
              * free list  */
+            if (counted)
+                uncount_free(free_list->size);
+            if (rover == free_list)
+                rover = p_to_free;
             p_to_free->size += free_list->size;
             p_to_free->next = free_list->next;
         }
@@ -430,8 +1544,9 @@ void nano_free (RARG void * free_p)
             /* Insert before current free_list */
             p_to_free->next = free_list;
         }
-        free_list = p_to_free;
-        MALLOC_UNLOCK;
+        *list = p_to_free;
+        if (counted)
+            count_free(p_to_free->size);
         return;
     }
 
@@ -450,21 +1565,28 @@ void nano_free (RARG void * free_p)
     {
         /* Chunk to be freed is adjacent
          * to a free chunk before it */
+        if (counted)
+            uncount_free(p->size);
         p->size += p_to_free->size;
         /* If the merged chunk is also adjacent
          * to the chunk after it, merge again */
         if ((char *)p + p->size == (char *) q)
         {
+            if (counted)
+                uncount_free(q->size);
+            if (rover == q)
+                rover = p;
             p->size += q->size;
             p->next = q->next;
         }
+        if (counted)
+            count_free(p->size);
     }
 #ifdef MALLOC_CHECK_DOUBLE_FREE
     else if ((char *)p + p->size > (char *)p_to_free)
     {
         /* Report double free fault */
         RERRNO = ENOMEM;
-        MALLOC_UNLOCK;
         return;
     }
 #endif
@@ -472,9 +1594,15 @@ void nano_free (RARG void * free_p)
     {
         /* Chunk to be freed is adjacent
          * to a free chunk after it */
+        if (counted)
+            uncount_free(q->size);
+        if (rover == q)
+            rover = p_to_free;
         p_to_free->size += q->size;
         p_to_free->next = q->next;
         p->next = p_to_free;
+        if (counted)
+            count_free(p_to_free->size);
     }
     else
     {
@@ -482,9 +1610,11 @@ void nano_free (RARG void * free_p)
          * a fragment. */
         p_to_free->next = q;
         p->next = p_to_free;
+        if (counted)
+            count_free(p_to_free->size);
     }
-    MALLOC_UNLOCK;
 }
+#endif /* NANO_MALLOC_TAGS */
 #endif /* DEFINE_FREE */
 
 #ifdef DEFINE_CFREE
@@ -495,32 +1625,196 @@ void nano_cfree(RARG void * ptr)
 #endif /* DEFINE_CFREE */
 
 #ifdef DEFINE_CALLOC
+/* Set by the startup code once it has cleared the memory sbrk hands
+ * out, see <malloc.h> */
+char __malloc_sbrk_zeroed = 0;
+
 /* Function nano_calloc
- * Implement calloc simply by calling malloc and set zero */
+ * Implement calloc by calling malloc and set zero.  With
+ * __malloc_sbrk_zeroed, the part of the block that sbrk has just
+ * handed out for the first time is left alone: the break before the
+ * call, or the highest break there was, bounds the memory used
+ * before.  */
 void * nano_calloc(RARG malloc_size_t n, malloc_size_t elem)
 {
     malloc_size_t bytes;
-    void * mem;
+    char * mem, * virgin, * top;
 
     if (__builtin_mul_overflow (n, elem, &bytes))
     {
         RERRNO = ENOMEM;
         return NULL;
     }
+    if (!__malloc_sbrk_zeroed)
+    {
+        mem = nano_malloc(RCALL bytes);
+        if (mem != NULL) memset(mem, 0, bytes);
+        return mem;
+    }
+
+    MALLOC_LOCK;
+    virgin = _SBRK_R(RCALL 0);
+    if (virgin < sbrk_mark)
+        virgin = sbrk_mark;
     mem = nano_malloc(RCALL bytes);
-    if (mem != NULL) memset(mem, 0, bytes);
+    top = _SBRK_R(RCALL 0);
+    MALLOC_UNLOCK;
+    if (mem == NULL)
+        return NULL;
+
+    /* Blocks of pools and arenas lie outside the sbrk heap */
+    if (mem >= sbrk_start && mem + bytes <= top && mem + bytes > virgin)
+        memset(mem, 0, mem < virgin ? (size_t)(virgin - mem) : 0);
+    else
+        memset(mem, 0, bytes);
     return mem;
 }
 #endif /* DEFINE_CALLOC */
 
 #ifdef DEFINE_REALLOC
+/* Try to make the heap chunk holding PTR big enough for SIZE bytes
+ * without moving it, by taking in the free chunk that follows it
+ * and, if the chunk then ends at the top of the heap or region ID,
+ * by raising the top.  Whatever is left over beyond SIZE is split
+ * off and freed, which is also how a shrink is done.  */
+static int resize_in_place(RARG int id, void * ptr, malloc_size_t size)
+{
+    chunk * c = get_chunk_from_ptr(ptr);
+    chunk ** list = id ? &regions[id].free_list : &free_list;
+#ifndef NANO_MALLOC_TAGS
+    chunk ** link;
+#endif
+    chunk * q;
+    char * end;
+    long need, avail, rem, old;
+    int ok = 0;
+
+    if (size >= MAX_ALLOC_SIZE) return 0;
+
+    need = ((char *)ptr - (char *)c) + ALIGN_SIZE(size, CHUNK_ALIGN);
+    need = MAX(need, (long)MALLOC_MINCHUNK);
+
+    MALLOC_LOCK;
+
+    old = CHUNK_SIZE(c);
+    if (need > old)
+    {
+        if (id == 0 && QUOTA_FULL(CHUNK_QUOTA(c), need - old))
+            goto out;
+        end = (char *)c + old;
+        avail = old;
+
+#ifdef NANO_MALLOC_TAGS
+        q = (chunk *)end;
+        if (q->size & CHUNK_FREE)
+        {
+            avail += CHUNK_SIZE(q);
+            end += CHUNK_SIZE(q);
+        }
+        else
+            q = NULL;
+#else
+        /* The free list is address ordered; find what follows C */
+        for (link = list; (q = *link) != NULL && (char *)q < end;
+             link = &q->next)
+            ;
+
+        if (q != NULL && (char *)q == end)
+        {
+            avail += q->size;
+            end += q->size;
+        }
+        else
+            q = NULL;
+#endif
+
+        if (avail < need)
+        {
+            malloc_size_t more = ALIGN_SIZE(need - avail, CHUNK_ALIGN);
+
+            if (id)
+            {
+                region * rg = &regions[id];
+
+                if (end != rg->brk
+                    || more + FENCE_SIZE > (malloc_size_t)(rg->end - rg->brk))
+                    goto out;
+                rg->brk += more;
+                SET_FENCE(rg->brk);
+            }
+            else
+            {
+#ifdef NANO_MALLOC_TAGS
+                if ((chunk *)end != heap_fence
+                    || (char *)_SBRK_R(RCALL 0) != end + FENCE_SIZE
+                    || _SBRK_R(RCALL more) == (void *)-1)
+                    goto out;
+                heap_fence = (chunk *)(end + more);
+                SET_FENCE(heap_fence);
+#else
+                if (end != (char *)_SBRK_R(RCALL 0)
+                    || (char *)_SBRK_R(RCALL more) != end)
+                    goto out;
+#endif
+                if ((size_t)(end + more + FENCE_SIZE - sbrk_start)
+                    > counters.peak)
+                    counters.peak = end + more + FENCE_SIZE - sbrk_start;
+            }
+            avail += more;
+        }
+
+        if (q != NULL)
+        {
+#ifdef NANO_MALLOC_TAGS
+            unlink_chunk(list, q);
+#else
+            *link = q->next;
+            if (rover == q)
+                rover = NULL;
+#endif
+            if (id == 0)
+                uncount_taken(CHUNK_SIZE(q));
+        }
+        SET_CHUNK_SIZE(c, avail);
+#ifdef NANO_MALLOC_TAGS
+        NEXT_CHUNK(c)->size &= ~CHUNK_PREV_FREE;
+#endif
+    }
+
+    rem = CHUNK_SIZE(c) - need;
+    if (rem >= (long)MALLOC_MINCHUNK)
+    {
+        chunk * t = (chunk *)((char *)c + need);
+
+        t->size = rem;
+        SET_CHUNK_SIZE(c, need);
+        insert_free_chunk(RCALL list, t);
+    }
+    if (id == 0)
+    {
+        count_live(CHUNK_SIZE(c) - old);
+        CHARGE_QUOTA(CHUNK_QUOTA(c), CHUNK_SIZE(c) - old);
+    }
+    ok = 1;
+out:
+    MALLOC_UNLOCK;
+    return ok;
+}
+
 /* Function nano_realloc
- * Implement realloc by malloc + memcpy */
+ * Resize heap chunks in place when possible, otherwise implement
+ * realloc by malloc + memcpy.  With NANO_MALLOC_TRACE this is
+ * realloc_untraced, which the nano_realloc after it wraps.  */
+#ifdef NANO_MALLOC_TRACE
+static void * realloc_untraced(RARG void * ptr, malloc_size_t size)
+#else
 void * nano_realloc(RARG void * ptr, malloc_size_t size)
+#endif
 {
     void * mem;
     chunk * p_to_realloc;
     malloc_size_t old_size;
+    int id;
 
     if (ptr == NULL) return nano_malloc(RCALL size);
 
@@ -531,10 +1825,24 @@ void * nano_realloc(RARG void * ptr, malloc_size_t size)
     }
 
     old_size = nano_malloc_usable_size(RCALL ptr);
-    if (size <= old_size && (old_size >> 1) < size)
-      return ptr;
 
-    mem = nano_malloc(RCALL size);
+    id = 0;
+    if ((pools == NULL || pool_of(ptr) == NULL)
+        && (arenas == NULL || arena_of(ptr) == NULL)
+        && (buddies == NULL || buddy_of(ptr) == NULL))
+    {
+        /* A heap chunk stays in the region it came from */
+        id = region_of(get_chunk_from_ptr(ptr));
+        if (resize_in_place(RCALL id, ptr, size))
+            return ptr;
+    }
+    else if (size <= old_size)
+        return ptr;
+
+    if (id != 0)
+        mem = nano_malloc_region(RCALL id, size);
+    else
+        mem = nano_malloc(RCALL size);
     if (mem != NULL)
     {
 	if (old_size > size)
@@ -544,6 +1852,25 @@ void * nano_realloc(RARG void * ptr, malloc_size_t size)
     }
     return mem;
 }
+
+#ifdef NANO_MALLOC_TRACE
+/* The malloc and free realloc makes are left out of the ring, so the
+ * lock is held across the copy as well.  */
+void * nano_realloc(RARG void * ptr, malloc_size_t size)
+{
+    void * mem;
+    void * caller = __builtin_return_address(0);
+
+    MALLOC_LOCK;
+    trace_quiet++;
+    mem = realloc_untraced(RCALL ptr, size);
+    trace_quiet--;
+    trace_event(MALLOC_TRACE_REALLOC_FROM, ptr, 0, caller);
+    trace_event(MALLOC_TRACE_REALLOC, mem, size, caller);
+    MALLOC_UNLOCK;
+    return mem;
+}
+#endif /* NANO_MALLOC_TRACE */
 #endif /* DEFINE_REALLOC */
 
 #ifdef DEFINE_MALLINFO
@@ -552,9 +1879,8 @@ struct mallinfo current_mallinfo={0,0,0,0,0,0,0,0,0,0};
 struct mallinfo nano_mallinfo(RONEARG)
 {
     char * sbrk_now;
-    chunk * pf;
-    size_t free_size = 0;
-    size_t total_size;
+    size_t total_size, nfree = 0;
+    int i;
 
     MALLOC_LOCK;
 
@@ -568,16 +1894,22 @@ struct mallinfo nano_mallinfo(RONEARG)
             total_size = (size_t) (sbrk_now - sbrk_start);
     }
 
-    for (pf = free_list; pf; pf = pf->next)
-        free_size += pf->size;
+    for (i = 0; i < MALLOC_HIST_BINS; i++)
+        nfree += counters.nfree[i];
 
     current_mallinfo.arena = total_size;
-    current_mallinfo.fordblks = free_size;
-    current_mallinfo.uordblks = total_size - free_size;
+    current_mallinfo.ordblks = nfree;
+    current_mallinfo.fordblks = counters.free;
+    current_mallinfo.uordblks = total_size - counters.free;
 
     MALLOC_UNLOCK;
     return current_mallinfo;
 }
+
+const struct mallcounters * malloc_counters(void)
+{
+    return &counters;
+}
 #endif /* DEFINE_MALLINFO */
 
 #ifdef DEFINE_MALLOC_STATS
@@ -585,31 +1917,139 @@ void nano_malloc_stats(RONEARG)
 {
     nano_mallinfo(RONECALL);
     fiprintf(stderr, "max system bytes = %10u\n",
-             current_mallinfo.arena);
+             counters.peak);
     fiprintf(stderr, "system bytes     = %10u\n",
              current_mallinfo.arena);
     fiprintf(stderr, "in use bytes     = %10u\n",
              current_mallinfo.uordblks);
+    fiprintf(stderr, "largest free     = %10u\n",
+             counters.largest_free);
+}
+
+#ifdef NANO_MALLOC_TRACE
+const struct malltrace * malloc_trace(unsigned long * count)
+{
+    *count = trace_count;
+    return trace_ring;
+}
+
+/* One line per event, oldest first: op, ptr, size, caller, time.
+ * Only the events before the call are printed.  Each is copied under
+ * the lock, and the dump stops at one that the allocations of stdio
+ * have written over meanwhile.  */
+void malloc_trace_dump(void)
+{
+    static const char * const names[] = {
+        "?", "malloc", "free", "realloc-from", "realloc"
+    };
+    unsigned long count, i;
+#ifdef INTERNAL_NEWLIB
+    struct _reent * reent_ptr = _REENT;
+#endif
+
+    MALLOC_LOCK;
+    count = trace_count;
+    MALLOC_UNLOCK;
+
+    fiprintf(stderr, "malloc trace %lu\n", count);
+    i = count > MALLOC_TRACE_SIZE ? count - MALLOC_TRACE_SIZE : 0;
+    for (; i < count; i++)
+    {
+        struct malltrace e;
+
+        MALLOC_LOCK;
+        if (trace_count - i > MALLOC_TRACE_SIZE)
+        {
+            MALLOC_UNLOCK;
+            break;
+        }
+        e = trace_ring[(unsigned int)i & (MALLOC_TRACE_SIZE - 1)];
+        MALLOC_UNLOCK;
+
+        fiprintf(stderr, "%s %p %u %p %lu\n",
+                 names[e.op <= MALLOC_TRACE_REALLOC ? e.op : 0],
+                 e.ptr, (unsigned int)e.size, e.caller, e.time);
+    }
 }
+#endif /* NANO_MALLOC_TRACE */
 #endif /* DEFINE_MALLOC_STATS */
 
 #ifdef DEFINE_MALLOC_USABLE_SIZE
 malloc_size_t nano_malloc_usable_size(RARG void * ptr)
 {
     chunk * c = (chunk *)((char *)ptr - CHUNK_OFFSET);
-    int size_or_offset = c->size;
+    int size_or_offset;
+    mpool_t * pool;
+    buddy_t * b;
+
+    if (arenas != NULL && arena_of(ptr) != NULL)
+        return ((size_t *)ptr)[-1];
+
+    if (pools != NULL && (pool = pool_of(ptr)) != NULL)
+        return pool->_size;
+
+    if (buddies != NULL && (b = buddy_of(ptr)) != NULL)
+        return buddy_size(b, ptr);
+
+    size_or_offset = c->size;
 
     if (size_or_offset < 0)
     {
         /* Padding is used. Excluding the padding size */
         c = (chunk *)((char *)c + c->size);
-        return c->size - CHUNK_OFFSET + size_or_offset;
+        return CHUNK_SIZE(c) - CHUNK_OFFSET + size_or_offset;
     }
-    return c->size - CHUNK_OFFSET;
+    return CHUNK_SIZE(c) - CHUNK_OFFSET;
 }
 #endif /* DEFINE_MALLOC_USABLE_SIZE */
 
 #ifdef DEFINE_MEMALIGN
+/* Serve an alignment of MALLOC_BUDDY_ALIGN or more from the buddy
+ * allocators, which waste no more than the rounding of S up to a
+ * power of two.  If MALLOC_BUDDY_SIZE is not 0, the first time none
+ * can, one is set up over that many bytes of the heap, as long as the
+ * request fits in it.  Those bytes are never given back.  */
+static void * buddy_memalign(RARG size_t align, size_t s)
+{
+#if MALLOC_BUDDY_SIZE != 0
+    static buddy_t heap_buddy;
+    static char tried;
+#endif
+    buddy_t * b;
+    void * p = NULL;
+
+    MALLOC_LOCK;
+    for (b = buddies; b && p == NULL; b = b->_next)
+        p = buddy_alloc(b, s, align);
+#if MALLOC_BUDDY_SIZE != 0
+    if (p == NULL && !tried && MAX(s, align) <= MALLOC_BUDDY_SIZE)
+    {
+        /* Set before, so the memalign below takes the split path */
+        tried = 1;
+#ifdef CURRENT_QUOTA
+        {
+            /* The buddy heap is shared, not the caller's */
+            mallquota_t * q = CURRENT_QUOTA;
+
+            CURRENT_QUOTA = NULL;
+            p = nano_memalign(RCALL MALLOC_BUDDY_SIZE, MALLOC_BUDDY_SIZE);
+            CURRENT_QUOTA = q;
+        }
+#else
+        p = nano_memalign(RCALL MALLOC_BUDDY_SIZE, MALLOC_BUDDY_SIZE);
+#endif
+        if (p != NULL)
+        {
+            buddy_init(&heap_buddy, p, MALLOC_BUDDY_SIZE);
+            buddy_register(&heap_buddy);
+            p = buddy_alloc(&heap_buddy, s, align);
+        }
+    }
+#endif
+    MALLOC_UNLOCK;
+    return p;
+}
+
 /* Function nano_memalign
  * Allocate memory block aligned at specific boundary.
  *   align: required alignment. Must be power of 2. Return NULL
@@ -620,7 +2060,8 @@ malloc_size_t nano_malloc_usable_size(RARG void * ptr)
  * Algorithm: Malloc a big enough block, padding pointer to aligned
  *            address, then truncate and free the tail if too big.
  *            Record the offset of align pointer and original pointer
- *            in the padding area.
+ *            in the padding area.  Big alignments are first tried
+ *            from the buddy allocators.
  */
 void * nano_memalign(RARG size_t align, size_t s)
 {
@@ -633,6 +2074,10 @@ void * nano_memalign(RARG size_t align, size_t s)
 
     align = MAX(align, MALLOC_ALIGN);
 
+    if (align >= MALLOC_BUDDY_ALIGN
+        && (aligned_p = buddy_memalign(RCALL align, s)) != NULL)
+        return aligned_p;
+
     /* Make sure ma_size does not overflow */
     if (s > __SIZE_MAX__ - CHUNK_ALIGN)
     {
@@ -649,6 +2094,35 @@ void * nano_memalign(RARG size_t align, size_t s)
     }
     size_with_padding = ma_size + (align - MALLOC_ALIGN);
 
+    /* The chunk is cut up below, so it must not come from a pool */
+    if (pools != NULL)
+    {
+        mpool_t * pool;
+
+        for (pool = pools; pool->_next; pool = pool->_next)
+            ;
+        if (size_with_padding <= pool->_size)
+            size_with_padding = pool->_size + 1;
+    }
+
+#ifdef CURRENT_ARENA
+    if (CURRENT_ARENA != NULL)
+    {
+        arena_t * a = CURRENT_ARENA;
+
+        MALLOC_LOCK;
+        aligned_p = __arena_bump(a, MAX(align, ARENA_ALIGN), s);
+        MALLOC_UNLOCK;
+        if (aligned_p != NULL)
+            return aligned_p;
+
+        /* Take the chunk below from the heap */
+        CURRENT_ARENA = NULL;
+        allocated = nano_malloc(RCALL size_with_padding);
+        CURRENT_ARENA = a;
+    }
+    else
+#endif
     allocated = nano_malloc(RCALL size_with_padding);
     if (allocated == NULL) return NULL;
 
@@ -665,8 +2139,9 @@ void * nano_memalign(RARG size_t align, size_t s)
             /* Padding is too large, free it */
             chunk * front_chunk = chunk_p;
             chunk_p = (chunk *)((char *)chunk_p + offset);
-            chunk_p->size = front_chunk->size - offset;
-            front_chunk->size = offset;
+            chunk_p->size = CHUNK_SIZE(front_chunk) - offset;
+            SET_CHUNK_QUOTA(chunk_p, CHUNK_QUOTA(front_chunk));
+            SET_CHUNK_SIZE(front_chunk, offset);
             nano_free(RCALL (char *)front_chunk + CHUNK_OFFSET);
         }
         else
@@ -674,19 +2149,20 @@ void * nano_memalign(RARG size_t align, size_t s)
             /* Padding is used. Need to set a jump offset for aligned pointer
             * to get back to chunk head */
             assert(offset >= sizeof(int));
-            *(long *)((char *)chunk_p + offset) = -offset;
+            ((chunk *)((char *)chunk_p + offset))->size = -offset;
         }
     }
 
-    size_allocated = chunk_p->size;
+    size_allocated = CHUNK_SIZE(chunk_p);
     if ((char *)chunk_p + size_allocated >
          (aligned_p + ma_size + MALLOC_MINCHUNK))
     {
         /* allocated much more than what's required for padding, free
          * tail part */
         chunk * tail_chunk = (chunk *)(aligned_p + ma_size);
-        chunk_p->size = aligned_p + ma_size - (char *)chunk_p;
-        tail_chunk->size = size_allocated - chunk_p->size;
+        SET_CHUNK_SIZE(chunk_p, aligned_p + ma_size - (char *)chunk_p);
+        tail_chunk->size = size_allocated - CHUNK_SIZE(chunk_p);
+        SET_CHUNK_QUOTA(tail_chunk, CHUNK_QUOTA(chunk_p));
         nano_free(RCALL (char *)tail_chunk + CHUNK_OFFSET);
     }
     return aligned_p;
@@ -694,8 +2170,34 @@ void * nano_memalign(RARG size_t align, size_t s)
 #endif /* DEFINE_MEMALIGN */
 
 #ifdef DEFINE_MALLOPT
+/* Function nano_mallopt
+ * M_POLICY picks the placement policy, M_TOP_PAD the bytes sbrk is
+ * asked for beyond a request and M_TRIM_THRESHOLD the size of free
+ * chunk at the top of the heap that free gives back, negative for
+ * never.  Returns 1, or 0 for an unknown parameter or value.  */
 int nano_mallopt(RARG int parameter_number, int parameter_value)
 {
+    switch (parameter_number)
+    {
+    case M_POLICY:
+        if (parameter_value < M_POLICY_FIRST_FIT
+            || parameter_value > M_POLICY_NEXT_FIT)
+            return 0;
+        MALLOC_LOCK;
+        fit_policy = parameter_value;
+        rover = NULL;
+        MALLOC_UNLOCK;
+        return 1;
+    case M_TOP_PAD:
+        if (parameter_value < 0)
+            return 0;
+        top_pad = ALIGN_SIZE((malloc_size_t)parameter_value, CHUNK_ALIGN);
+        return 1;
+    case M_TRIM_THRESHOLD:
+        trim_threshold = parameter_value < 0
+            ? (malloc_size_t)-1 : (malloc_size_t)parameter_value;
+        return 1;
+    }
     return 0;
 }
 #endif /* DEFINE_MALLOPT */
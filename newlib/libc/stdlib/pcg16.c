@@ -0,0 +1,16 @@
+/* pcg16 -- see xorshift32.c for the documentation.  */
+
+#include <stdlib.h>
+
+__uint16_t
+pcg16 (__uint32_t *state)
+{
+  __uint32_t old = *state;
+  __uint16_t x;
+  unsigned int rot;
+
+  *state = old * 747796405UL + 2891336453UL;
+  x = (__uint16_t) (((old >> 10) ^ old) >> 12);
+  rot = (unsigned int) (old >> 28);
+  return (__uint16_t) ((x >> rot) | (x << ((-rot) & 15)));
+}
@@ -0,0 +1,22 @@
+/* POSIX posix_memalign, over memalign.  */
+
+#include <reent.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <malloc.h>
+
+int
+posix_memalign (void **memptr, size_t align, size_t size)
+{
+  void *p;
+
+  if (align == 0 || (align & (align - 1)) != 0
+      || align % sizeof (void *) != 0)
+    return EINVAL;
+
+  p = _memalign_r (_REENT, align, size);
+  if (p == NULL && size != 0)
+    return ENOMEM;
+  *memptr = p;
+  return 0;
+}
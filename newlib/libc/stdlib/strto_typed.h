@@ -0,0 +1,134 @@
+/* The parser behind strtoi16, strtou16 and strtou32.
+
+   The including file defines STRTO_NAME and the unsigned accumulator
+   type STRTO_TYPE.  STRTO_NAME parses like strtoul, accepting values
+   up to LIM_POS, or a magnitude up to LIM_NEG after a minus sign, and
+   returns the value, negated modulo the width of STRTO_TYPE after a
+   minus sign.
+
+   The errors are its own, not strtoul's, which here takes any BASE.
+   A BASE below 0, of 1 or above 36 sets errno to EINVAL and returns 0
+   without reading the string or storing *ENDPTR.  Otherwise the only
+   error is ERANGE, set when the digits exceed LIM_POS, or LIM_NEG
+   after a minus sign; the result is then LIM_POS, or the negated
+   LIM_NEG when SGN says the type is signed, and *ENDPTR is still past
+   the last digit.  No digits is not an error: 0 is returned and
+   *ENDPTR is NPTR.
+
+   It is inline so that the limits are constants in each caller, and
+   the cutoffs for base 10 fold to constants with them.  Power of two
+   bases shift and mask; only other bases divide, once per call.  */
+
+#include <_ansi.h>
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+
+static __inline__ STRTO_TYPE
+STRTO_NAME (const char *__restrict nptr,
+	char **__restrict endptr,
+	int base,
+	STRTO_TYPE lim_pos,
+	STRTO_TYPE lim_neg,
+	int sgn)
+{
+  const unsigned char *s = (const unsigned char *) nptr;
+  STRTO_TYPE acc, lim, cutoff;
+  int c, cutlim, neg = 0, any = 0, shift = 0;
+
+  if (base < 0 || base == 1 || base > 36)
+    {
+      errno = EINVAL;
+      return 0;
+    }
+
+  do
+    c = *s++;
+  while (isspace (c));
+  if (c == '-')
+    {
+      neg = 1;
+      c = *s++;
+    }
+  else if (c == '+')
+    c = *s++;
+  if ((base == 0 || base == 16)
+      && c == '0' && (*s == 'x' || *s == 'X'))
+    {
+      c = s[1];
+      s += 2;
+      base = 16;
+    }
+  if (base == 0)
+    base = c == '0' ? 8 : 10;
+
+  acc = 0;
+  if (base == 10)
+    {
+      cutoff = neg ? lim_neg / 10 : lim_pos / 10;
+      cutlim = neg ? lim_neg % 10 : lim_pos % 10;
+      for (;; c = *s++)
+	{
+	  if (c < '0' || c > '9')
+	    break;
+	  c -= '0';
+	  if (any < 0 || acc > cutoff || (acc == cutoff && c > cutlim))
+	    any = -1;
+	  else
+	    {
+	      any = 1;
+	      acc = acc * 10 + c;
+	    }
+	}
+    }
+  else
+    {
+      lim = neg ? lim_neg : lim_pos;
+      if ((base & (base - 1)) == 0)
+	{
+	  while ((1 << shift) < base)
+	    shift++;
+	  cutoff = lim >> shift;
+	  cutlim = (int) (lim & (base - 1));
+	}
+      else
+	{
+	  cutoff = lim / base;
+	  cutlim = (int) (lim % base);
+	}
+      for (;; c = *s++)
+	{
+	  if (c >= '0' && c <= '9')
+	    c -= '0';
+	  else if (c >= 'A' && c <= 'Z')
+	    c -= 'A' - 10;
+	  else if (c >= 'a' && c <= 'z')
+	    c -= 'a' - 10;
+	  else
+	    break;
+	  if (c >= base)
+	    break;
+	  if (any < 0 || acc > cutoff || (acc == cutoff && c > cutlim))
+	    any = -1;
+	  else
+	    {
+	      any = 1;
+	      if (shift)
+		acc = (acc << shift) | c;
+	      else
+		acc = acc * base + c;
+	    }
+	}
+    }
+
+  if (any < 0)
+    {
+      acc = sgn && neg ? (STRTO_TYPE) -lim_neg : lim_pos;
+      errno = ERANGE;
+    }
+  else if (neg)
+    acc = -acc;
+  if (endptr != 0)
+    *endptr = (char *) (any ? (const char *) s - 1 : nptr);
+  return acc;
+}
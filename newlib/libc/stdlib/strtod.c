@@ -68,8 +68,9 @@ DESCRIPTION
 
 	This implementation returns the nearest machine number to the
 	input decimal string.  Ties are broken by using the IEEE
-	round-even rule.  However, <<strtof>> is currently subject to
-	double rounding errors.
+	round-even rule.  Plain decimal numbers of up to 19 significant
+	digits are converted directly; <<strtof>> is subject to double
+	rounding errors only for the others.
 
 	<<strtod_l>>, <<strtof_l>>, <<strtold_l>> are like <<strtod>>,
 	<<strtof>>, <<strtold>> but perform the conversion based on the
@@ -144,6 +145,19 @@ THIS SOFTWARE.
 /* #endif */
 
 #include "locale.h"
+#include "local.h"
+
+#ifdef _DOUBLE_IS_32BITS
+
+/* A float-sized double needs none of the Bigint machinery below.  */
+double
+_strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
+	   locale_t loc)
+{
+	return __strtodf (ptr, s00, se, loc);
+}
+
+#else /* !_DOUBLE_IS_32BITS */
 
 #ifdef IEEE_Arith
 #ifndef NO_IEEE_Scale
@@ -239,6 +253,294 @@ ULtod (__ULong *L,
 }
 #endif /* !NO_HEX_FP */
 
+#if defined(IEEE_Arith) && !defined(Honor_FLT_ROUNDS) && !defined(SET_INEXACT)
+#define Fast_Path
+
+/* The Eisel-Lemire conversion, for plain decimal numbers of up to 19
+ * significant digits and with moderate exponents: W * 10^Q is rounded
+ * to the nearest binary number from the 128-bit truncation of 5^Q,
+ * with no Bigints.  It gives up in the rare cases that the truncation
+ * can not settle, and those go to the full conversion.
+ */
+
+#define EL_QMIN	(-65)
+#define EL_QMAX	38
+
+static const __uint64_t el_pow5[EL_QMAX - EL_QMIN + 1][2] = {
+	{ 0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL },	/* 5^-65 */
+	{ 0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL },	/* 5^-64 */
+	{ 0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL },	/* 5^-63 */
+	{ 0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL },	/* 5^-62 */
+	{ 0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL },	/* 5^-61 */
+	{ 0xcdb02555653131b6ULL, 0x3792f412cb06794dULL },	/* 5^-60 */
+	{ 0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL },	/* 5^-59 */
+	{ 0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL },	/* 5^-58 */
+	{ 0xc8de047564d20a8bULL, 0xf245825a5a445275ULL },	/* 5^-57 */
+	{ 0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL },	/* 5^-56 */
+	{ 0x9ced737bb6c4183dULL, 0x55464dd69685606bULL },	/* 5^-55 */
+	{ 0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL },	/* 5^-54 */
+	{ 0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL },	/* 5^-53 */
+	{ 0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL },	/* 5^-52 */
+	{ 0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL },	/* 5^-51 */
+	{ 0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL },	/* 5^-50 */
+	{ 0x95a8637627989aadULL, 0xdde7001379a44aa8ULL },	/* 5^-49 */
+	{ 0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL },	/* 5^-48 */
+	{ 0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL },	/* 5^-47 */
+	{ 0x9226712162ab070dULL, 0xcab3961304ca70e8ULL },	/* 5^-46 */
+	{ 0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL },	/* 5^-45 */
+	{ 0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL },	/* 5^-44 */
+	{ 0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL },	/* 5^-43 */
+	{ 0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL },	/* 5^-42 */
+	{ 0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL },	/* 5^-41 */
+	{ 0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL },	/* 5^-40 */
+	{ 0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL },	/* 5^-39 */
+	{ 0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL },	/* 5^-38 */
+	{ 0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL },	/* 5^-37 */
+	{ 0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL },	/* 5^-36 */
+	{ 0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL },	/* 5^-35 */
+	{ 0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL },	/* 5^-34 */
+	{ 0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL },	/* 5^-33 */
+	{ 0xcfb11ead453994baULL, 0x67de18eda5814af2ULL },	/* 5^-32 */
+	{ 0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL },	/* 5^-31 */
+	{ 0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL },	/* 5^-30 */
+	{ 0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL },	/* 5^-29 */
+	{ 0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL },	/* 5^-28 */
+	{ 0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL },	/* 5^-27 */
+	{ 0xc612062576589ddaULL, 0x95364afe032a819eULL },	/* 5^-26 */
+	{ 0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL },	/* 5^-25 */
+	{ 0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL },	/* 5^-24 */
+	{ 0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL },	/* 5^-23 */
+	{ 0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL },	/* 5^-22 */
+	{ 0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL },	/* 5^-21 */
+	{ 0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL },	/* 5^-20 */
+	{ 0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL },	/* 5^-19 */
+	{ 0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL },	/* 5^-18 */
+	{ 0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL },	/* 5^-17 */
+	{ 0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL },	/* 5^-16 */
+	{ 0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL },	/* 5^-15 */
+	{ 0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL },	/* 5^-14 */
+	{ 0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL },	/* 5^-13 */
+	{ 0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL },	/* 5^-12 */
+	{ 0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL },	/* 5^-11 */
+	{ 0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL },	/* 5^-10 */
+	{ 0x89705f4136b4a597ULL, 0x31680a88f8953031ULL },	/* 5^-9 */
+	{ 0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL },	/* 5^-8 */
+	{ 0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL },	/* 5^-7 */
+	{ 0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL },	/* 5^-6 */
+	{ 0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL },	/* 5^-5 */
+	{ 0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL },	/* 5^-4 */
+	{ 0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL },	/* 5^-3 */
+	{ 0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL },	/* 5^-2 */
+	{ 0xccccccccccccccccULL, 0xcccccccccccccccdULL },	/* 5^-1 */
+	{ 0x8000000000000000ULL, 0x0000000000000000ULL },	/* 5^0 */
+	{ 0xa000000000000000ULL, 0x0000000000000000ULL },	/* 5^1 */
+	{ 0xc800000000000000ULL, 0x0000000000000000ULL },	/* 5^2 */
+	{ 0xfa00000000000000ULL, 0x0000000000000000ULL },	/* 5^3 */
+	{ 0x9c40000000000000ULL, 0x0000000000000000ULL },	/* 5^4 */
+	{ 0xc350000000000000ULL, 0x0000000000000000ULL },	/* 5^5 */
+	{ 0xf424000000000000ULL, 0x0000000000000000ULL },	/* 5^6 */
+	{ 0x9896800000000000ULL, 0x0000000000000000ULL },	/* 5^7 */
+	{ 0xbebc200000000000ULL, 0x0000000000000000ULL },	/* 5^8 */
+	{ 0xee6b280000000000ULL, 0x0000000000000000ULL },	/* 5^9 */
+	{ 0x9502f90000000000ULL, 0x0000000000000000ULL },	/* 5^10 */
+	{ 0xba43b74000000000ULL, 0x0000000000000000ULL },	/* 5^11 */
+	{ 0xe8d4a51000000000ULL, 0x0000000000000000ULL },	/* 5^12 */
+	{ 0x9184e72a00000000ULL, 0x0000000000000000ULL },	/* 5^13 */
+	{ 0xb5e620f480000000ULL, 0x0000000000000000ULL },	/* 5^14 */
+	{ 0xe35fa931a0000000ULL, 0x0000000000000000ULL },	/* 5^15 */
+	{ 0x8e1bc9bf04000000ULL, 0x0000000000000000ULL },	/* 5^16 */
+	{ 0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL },	/* 5^17 */
+	{ 0xde0b6b3a76400000ULL, 0x0000000000000000ULL },	/* 5^18 */
+	{ 0x8ac7230489e80000ULL, 0x0000000000000000ULL },	/* 5^19 */
+	{ 0xad78ebc5ac620000ULL, 0x0000000000000000ULL },	/* 5^20 */
+	{ 0xd8d726b7177a8000ULL, 0x0000000000000000ULL },	/* 5^21 */
+	{ 0x878678326eac9000ULL, 0x0000000000000000ULL },	/* 5^22 */
+	{ 0xa968163f0a57b400ULL, 0x0000000000000000ULL },	/* 5^23 */
+	{ 0xd3c21bcecceda100ULL, 0x0000000000000000ULL },	/* 5^24 */
+	{ 0x84595161401484a0ULL, 0x0000000000000000ULL },	/* 5^25 */
+	{ 0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL },	/* 5^26 */
+	{ 0xcecb8f27f4200f3aULL, 0x0000000000000000ULL },	/* 5^27 */
+	{ 0x813f3978f8940984ULL, 0x4000000000000000ULL },	/* 5^28 */
+	{ 0xa18f07d736b90be5ULL, 0x5000000000000000ULL },	/* 5^29 */
+	{ 0xc9f2c9cd04674edeULL, 0xa400000000000000ULL },	/* 5^30 */
+	{ 0xfc6f7c4045812296ULL, 0x4d00000000000000ULL },	/* 5^31 */
+	{ 0x9dc5ada82b70b59dULL, 0xf020000000000000ULL },	/* 5^32 */
+	{ 0xc5371912364ce305ULL, 0x6c28000000000000ULL },	/* 5^33 */
+	{ 0xf684df56c3e01bc6ULL, 0xc732000000000000ULL },	/* 5^34 */
+	{ 0x9a130b963a6c115cULL, 0x3c7f400000000000ULL },	/* 5^35 */
+	{ 0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL },	/* 5^36 */
+	{ 0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL },	/* 5^37 */
+	{ 0x96769950b50d88f4ULL, 0x1314448000000000ULL },	/* 5^38 */
+	};
+
+struct el_format {
+	int mbits;		/* explicit mantissa bits */
+	int emin;		/* minus the exponent bias */
+	int einf;		/* biased exponent of infinity */
+	int rte_min, rte_max;	/* range of Q where ties can be exact */
+	};
+
+static const struct el_format el_double = { 52, -1023, 0x7ff, -4, 23 };
+static const struct el_format el_float = { 23, -127, 0xff, -17, 10 };
+
+ static __uint64_t
+el_mul (__uint64_t a, __uint64_t b, __uint64_t *lo)
+{
+	__uint64_t al = (__ULong)a, ah = a >> 32;
+	__uint64_t bl = (__ULong)b, bh = b >> 32;
+	__uint64_t ll = al * bl, lh = al * bh, hl = ah * bl;
+	__uint64_t mid = (ll >> 32) + (__ULong)lh + (__ULong)hl;
+
+	*lo = (mid << 32) | (__ULong)ll;
+	return ah * bh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+}
+
+/* Parse the plain decimal number at S, returning the character after
+ * it, its sign, and its significant digits W and exponent Q.  Return
+ * NULL for what is left to the full parse: hex, infinity and NaN, more
+ * than 19 digits, and no number at all.
+ */
+ static const char *
+el_scan (const char *s, const char *decimal_point, int dec_len,
+	int *sign, __uint64_t *w, int *q)
+{
+	__uint64_t v = 0;
+	const char *s1;
+	int c, e = 0, e1, esign, frac = 0, nd = 0, nz = 0, any = 0;
+
+	while(*s == ' ' || (*s >= '\t' && *s <= '\r'))
+		s++;
+	*sign = 0;
+	if (*s == '-') {
+		*sign = 1;
+		s++;
+		}
+	else if (*s == '+')
+		s++;
+	if (*s == '0' && (s[1] == 'x' || s[1] == 'X'))
+		return NULL;
+	for(;; s++) {
+		c = *s;
+		if (c >= '0' && c <= '9') {
+			any = 1;
+			if (frac && --e < -19999)
+				return NULL;
+			if (c == '0') {
+				if (nd)
+					nz++;
+				continue;
+				}
+			if (nd + nz >= 19)
+				return NULL;
+			for(; nz; nz--, nd++)
+				v *= 10;
+			v = 10*v + c - '0';
+			nd++;
+			}
+		else if (!frac && strncmp (s, decimal_point, dec_len) == 0) {
+			frac = 1;
+			s += dec_len - 1;
+			}
+		else
+			break;
+		}
+	if (!any)
+		return NULL;
+	e += nz;
+	if (*s == 'e' || *s == 'E') {
+		s1 = s;
+		esign = 0;
+		switch(c = *++s) {
+			case '-':
+				esign = 1;
+			case '+':
+				c = *++s;
+			}
+		if (c >= '0' && c <= '9') {
+			for(e1 = 0; c >= '0' && c <= '9'; c = *++s)
+				if (e1 < 19999)
+					e1 = 10*e1 + c - '0';
+			e += esign ? -e1 : e1;
+			}
+		else
+			s = s1;
+		}
+	*w = v;
+	*q = e;
+	return s;
+}
+
+/* Set *BITS to the format F encoding of the nonzero W * 10^Q, and
+ * return 1, or return 0 if that needs the full conversion.
+ */
+ static int
+el_convert (__uint64_t w, int q, const struct el_format *f, __uint64_t *bits)
+{
+	const __uint64_t *t;
+	__uint64_t hi, lo, hi2, lo2, m, mask;
+	int lz, upper, shift, e;
+
+	if (q < EL_QMIN || q > EL_QMAX)
+		return 0;
+	t = el_pow5[q - EL_QMIN];
+	lz = w >> 32 ? hi0bits((__ULong)(w >> 32))
+		     : 32 + hi0bits((__ULong)w);
+	w <<= lz;
+
+	/* The high product is enough unless the bits below the ones
+	 * that are kept are all ones.
+	 */
+	hi = el_mul(w, t[0], &lo);
+	mask = ~(__uint64_t)0 >> (f->mbits + 3);
+	if ((hi & mask) == mask) {
+		hi2 = el_mul(w, t[1], &lo2);
+		lo += hi2;
+		if (hi2 > lo)
+			hi++;
+		}
+	if (lo == ~(__uint64_t)0 && (q < -27 || q > 55))
+		return 0;
+
+	upper = hi >> 63;
+	shift = upper + 64 - f->mbits - 3;
+	m = hi >> shift;
+	/* floor (Q * log2 (10)) + 63 */
+	e = (int)(((Long)217706 * q) >> 16) + 63 + upper - lz - f->emin;
+	if (e <= 0) {
+		/* Subnormal, or zero.  */
+		if (-e + 1 >= 64)
+			m = 0;
+		else {
+			m >>= -e + 1;
+			m += m & 1;
+			m >>= 1;
+			}
+		e = m >> f->mbits ? 1 : 0;
+		}
+	else {
+		/* A tie rounds to even; only a product that is exact can be
+		 * one.
+		 */
+		if (lo <= 1 && q >= f->rte_min && q <= f->rte_max
+		 && (m & 3) == 1 && (m << shift) == hi)
+			m &= ~(__uint64_t)1;
+		m += m & 1;
+		m >>= 1;
+		if (m >> (f->mbits + 1)) {
+			m >>= 1;
+			e++;
+			}
+		if (e >= f->einf) {
+			e = f->einf;
+			m = 0;
+			}
+		}
+	*bits = (m & (((__uint64_t)1 << f->mbits) - 1))
+		| (__uint64_t)e << f->mbits;
+	return 1;
+}
+#endif /* IEEE_Arith && !Honor_FLT_ROUNDS && !SET_INEXACT */
+
 double
 _strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
 	   locale_t loc)
@@ -265,6 +567,28 @@ _strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
 #endif
 	const char *decimal_point = __get_numeric_locale(loc)->decimal_point;
 	int dec_len = strlen (decimal_point);
+#ifdef Fast_Path
+	__uint64_t w, b;
+
+	if ((s = el_scan(s00, decimal_point, dec_len, &sign, &w, &e)) != NULL) {
+		b = 0;
+#ifdef _DOUBLE_IS_32BITS
+		if (!w || el_convert(w, e, &el_float, &b)) {
+			dword0(rv) = (__ULong)b;
+#else
+		if (!w || el_convert(w, e, &el_double, &b)) {
+			dword0(rv) = (__ULong)(b >> 32);
+			dword1(rv) = (__ULong)b;
+#endif
+#ifndef NO_ERRNO
+			if ((dword0(rv) & Exp_mask) == Exp_mask
+			 || (w && !b))
+				ptr->_errno = ERANGE;
+#endif
+			goto ret;
+			}
+		}
+#endif /* Fast_Path */
 
 	delta = bs = bd = NULL;
 	sign = nz0 = nz = decpt = 0;
@@ -1262,6 +1586,8 @@ _strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
 	return sign ? -dval(rv) : dval(rv);
 }
 
+#endif /* !_DOUBLE_IS_32BITS */
+
 double
 _strtod_r (struct _reent *ptr,
 	const char *__restrict s00,
@@ -1284,33 +1610,59 @@ strtod (const char *__restrict s00, char **__restrict se)
   return _strtod_l (_REENT, s00, se, __get_current_locale ());
 }
 
-float
-strtof_l (const char *__restrict s00, char **__restrict se, locale_t loc)
+/* strtof converts plain decimal numbers straight to float; the others
+   go through double.  A float-sized double is converted as one.  */
+static float
+_strtof_l (struct _reent *ptr, const char *__restrict s00,
+	   char **__restrict se, locale_t loc)
 {
-  double val = _strtod_l (_REENT, s00, se, loc);
+#ifdef _DOUBLE_IS_32BITS
+  return __strtodf (ptr, s00, se, loc);
+#else
+#ifdef Fast_Path
+  const char *decimal_point = __get_numeric_locale (loc)->decimal_point;
+  const char *s;
+  int sign, q;
+  __uint64_t w, b;
+  union { float f; __ULong i; } u;
+
+  s = el_scan (s00, decimal_point, strlen (decimal_point), &sign, &w, &q);
+  b = 0;
+  if (s != NULL && (!w || el_convert (w, q, &el_float, &b)))
+    {
+      u.i = (__ULong) b;
+#ifndef NO_ERRNO
+      if (isinf (u.f) || (w && !b))
+	ptr->_errno = ERANGE;
+#endif
+      if (se)
+	*se = (char *) s;
+      return sign ? -u.f : u.f;
+    }
+#endif /* Fast_Path */
+  double val = _strtod_l (ptr, s00, se, loc);
   if (isnan (val))
     return signbit (val) ? -nanf ("") : nanf ("");
   float retval = (float) val;
 #ifndef NO_ERRNO
-  if (isinf (retval) && !isinf (val))
-    _REENT->_errno = ERANGE;
+  if ((isinf (retval) && !isinf (val)) || (retval == 0 && val != 0))
+    ptr->_errno = ERANGE;
 #endif
   return retval;
+#endif /* !_DOUBLE_IS_32BITS */
+}
+
+float
+strtof_l (const char *__restrict s00, char **__restrict se, locale_t loc)
+{
+  return _strtof_l (_REENT, s00, se, loc);
 }
 
 float
 strtof (const char *__restrict s00,
 	char **__restrict se)
 {
-  double val = _strtod_l (_REENT, s00, se, __get_current_locale ());
-  if (isnan (val))
-    return signbit (val) ? -nanf ("") : nanf ("");
-  float retval = (float) val;
-#ifndef NO_ERRNO
-  if (isinf (retval) && !isinf (val))
-    _REENT->_errno = ERANGE;
-#endif
-  return retval;
+  return _strtof_l (_REENT, s00, se, __get_current_locale ());
 }
 
 #endif
@@ -0,0 +1,563 @@
+/* __strtodf -- strtod for a 32-bit double, with no Bigints.
+
+   When double is float, correct rounding needs far less than the
+   mprec machinery that strtod.c brings in.  The first 18 significant
+   digits are gathered in two 32-bit halves and joined with one 64-bit
+   multiply; that times a 64-bit truncated power of five fixes the
+   float and a bound on how wrong it can be.  Only when a halfway
+   point between two floats falls within that bound is the digit
+   string compared with the exact decimal expansion of the halfway
+   point, made in 16-bit limbs on the stack.  Hex input is exact from
+   its first 32 bits and a sticky bit.  strtod, strtof, atof and the
+   scanf %f conversions all come here on such targets.  */
+
+#include <_ansi.h>
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "local.h"
+
+#ifdef _DOUBLE_IS_32BITS
+
+#define QMIN	(-63)
+#define QMAX	38
+
+/* 5^Q scaled into [2^63, 2^64) and truncated.  */
+static const __uint64_t pow5[QMAX - QMIN + 1] =
+{
+	0xd29fe4b18e88640eULL,	/* 5^-63 */
+	0x83a3eeeef9153e89ULL,	/* 5^-62 */
+	0xa48ceaaab75a8e2bULL,	/* 5^-61 */
+	0xcdb02555653131b6ULL,	/* 5^-60 */
+	0x808e17555f3ebf11ULL,	/* 5^-59 */
+	0xa0b19d2ab70e6ed6ULL,	/* 5^-58 */
+	0xc8de047564d20a8bULL,	/* 5^-57 */
+	0xfb158592be068d2eULL,	/* 5^-56 */
+	0x9ced737bb6c4183dULL,	/* 5^-55 */
+	0xc428d05aa4751e4cULL,	/* 5^-54 */
+	0xf53304714d9265dfULL,	/* 5^-53 */
+	0x993fe2c6d07b7fabULL,	/* 5^-52 */
+	0xbf8fdb78849a5f96ULL,	/* 5^-51 */
+	0xef73d256a5c0f77cULL,	/* 5^-50 */
+	0x95a8637627989aadULL,	/* 5^-49 */
+	0xbb127c53b17ec159ULL,	/* 5^-48 */
+	0xe9d71b689dde71afULL,	/* 5^-47 */
+	0x9226712162ab070dULL,	/* 5^-46 */
+	0xb6b00d69bb55c8d1ULL,	/* 5^-45 */
+	0xe45c10c42a2b3b05ULL,	/* 5^-44 */
+	0x8eb98a7a9a5b04e3ULL,	/* 5^-43 */
+	0xb267ed1940f1c61cULL,	/* 5^-42 */
+	0xdf01e85f912e37a3ULL,	/* 5^-41 */
+	0x8b61313bbabce2c6ULL,	/* 5^-40 */
+	0xae397d8aa96c1b77ULL,	/* 5^-39 */
+	0xd9c7dced53c72255ULL,	/* 5^-38 */
+	0x881cea14545c7575ULL,	/* 5^-37 */
+	0xaa242499697392d2ULL,	/* 5^-36 */
+	0xd4ad2dbfc3d07787ULL,	/* 5^-35 */
+	0x84ec3c97da624ab4ULL,	/* 5^-34 */
+	0xa6274bbdd0fadd61ULL,	/* 5^-33 */
+	0xcfb11ead453994baULL,	/* 5^-32 */
+	0x81ceb32c4b43fcf4ULL,	/* 5^-31 */
+	0xa2425ff75e14fc31ULL,	/* 5^-30 */
+	0xcad2f7f5359a3b3eULL,	/* 5^-29 */
+	0xfd87b5f28300ca0dULL,	/* 5^-28 */
+	0x9e74d1b791e07e48ULL,	/* 5^-27 */
+	0xc612062576589ddaULL,	/* 5^-26 */
+	0xf79687aed3eec551ULL,	/* 5^-25 */
+	0x9abe14cd44753b52ULL,	/* 5^-24 */
+	0xc16d9a0095928a27ULL,	/* 5^-23 */
+	0xf1c90080baf72cb1ULL,	/* 5^-22 */
+	0x971da05074da7beeULL,	/* 5^-21 */
+	0xbce5086492111aeaULL,	/* 5^-20 */
+	0xec1e4a7db69561a5ULL,	/* 5^-19 */
+	0x9392ee8e921d5d07ULL,	/* 5^-18 */
+	0xb877aa3236a4b449ULL,	/* 5^-17 */
+	0xe69594bec44de15bULL,	/* 5^-16 */
+	0x901d7cf73ab0acd9ULL,	/* 5^-15 */
+	0xb424dc35095cd80fULL,	/* 5^-14 */
+	0xe12e13424bb40e13ULL,	/* 5^-13 */
+	0x8cbccc096f5088cbULL,	/* 5^-12 */
+	0xafebff0bcb24aafeULL,	/* 5^-11 */
+	0xdbe6fecebdedd5beULL,	/* 5^-10 */
+	0x89705f4136b4a597ULL,	/* 5^-9 */
+	0xabcc77118461cefcULL,	/* 5^-8 */
+	0xd6bf94d5e57a42bcULL,	/* 5^-7 */
+	0x8637bd05af6c69b5ULL,	/* 5^-6 */
+	0xa7c5ac471b478423ULL,	/* 5^-5 */
+	0xd1b71758e219652bULL,	/* 5^-4 */
+	0x83126e978d4fdf3bULL,	/* 5^-3 */
+	0xa3d70a3d70a3d70aULL,	/* 5^-2 */
+	0xccccccccccccccccULL,	/* 5^-1 */
+	0x8000000000000000ULL,	/* 5^0 */
+	0xa000000000000000ULL,	/* 5^1 */
+	0xc800000000000000ULL,	/* 5^2 */
+	0xfa00000000000000ULL,	/* 5^3 */
+	0x9c40000000000000ULL,	/* 5^4 */
+	0xc350000000000000ULL,	/* 5^5 */
+	0xf424000000000000ULL,	/* 5^6 */
+	0x9896800000000000ULL,	/* 5^7 */
+	0xbebc200000000000ULL,	/* 5^8 */
+	0xee6b280000000000ULL,	/* 5^9 */
+	0x9502f90000000000ULL,	/* 5^10 */
+	0xba43b74000000000ULL,	/* 5^11 */
+	0xe8d4a51000000000ULL,	/* 5^12 */
+	0x9184e72a00000000ULL,	/* 5^13 */
+	0xb5e620f480000000ULL,	/* 5^14 */
+	0xe35fa931a0000000ULL,	/* 5^15 */
+	0x8e1bc9bf04000000ULL,	/* 5^16 */
+	0xb1a2bc2ec5000000ULL,	/* 5^17 */
+	0xde0b6b3a76400000ULL,	/* 5^18 */
+	0x8ac7230489e80000ULL,	/* 5^19 */
+	0xad78ebc5ac620000ULL,	/* 5^20 */
+	0xd8d726b7177a8000ULL,	/* 5^21 */
+	0x878678326eac9000ULL,	/* 5^22 */
+	0xa968163f0a57b400ULL,	/* 5^23 */
+	0xd3c21bcecceda100ULL,	/* 5^24 */
+	0x84595161401484a0ULL,	/* 5^25 */
+	0xa56fa5b99019a5c8ULL,	/* 5^26 */
+	0xcecb8f27f4200f3aULL,	/* 5^27 */
+	0x813f3978f8940984ULL,	/* 5^28 */
+	0xa18f07d736b90be5ULL,	/* 5^29 */
+	0xc9f2c9cd04674edeULL,	/* 5^30 */
+	0xfc6f7c4045812296ULL,	/* 5^31 */
+	0x9dc5ada82b70b59dULL,	/* 5^32 */
+	0xc5371912364ce305ULL,	/* 5^33 */
+	0xf684df56c3e01bc6ULL,	/* 5^34 */
+	0x9a130b963a6c115cULL,	/* 5^35 */
+	0xc097ce7bc90715b3ULL,	/* 5^36 */
+	0xf0bdc21abb48db20ULL,	/* 5^37 */
+	0x96769950b50d88f4ULL,	/* 5^38 */
+};
+
+/* The high 64 bits of A * B, and the low ones in *LO.  */
+static __uint64_t
+mul64 (__uint64_t a,
+	__uint64_t b,
+	__uint64_t *lo)
+{
+  __uint64_t al = (__uint32_t) a, ah = a >> 32;
+  __uint64_t bl = (__uint32_t) b, bh = b >> 32;
+  __uint64_t ll = al * bl, lh = al * bh, hl = ah * bl;
+  __uint64_t mid = (ll >> 32) + (__uint32_t) lh + (__uint32_t) hl;
+
+  *lo = (mid << 32) | (__uint32_t) ll;
+  return ah * bh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+}
+
+/* Round N * 2^(X - 63), N having its top bit set, to the float bits
+   in *BITS.  The true value is up to ERR units of N's last bit above
+   that; if ERR is 0 it is exact, but a little above when BELOW is set.
+   Return 0 if that bound straddles a halfway point between floats:
+   then *BITS is the float below it, and the halfway point is
+   *HALF * 2^*Y.  */
+static int
+round_bits (__uint64_t n,
+	int x,
+	unsigned int err,
+	int below,
+	__uint32_t *bits,
+	__uint32_t *half,
+	int *y)
+{
+  __uint64_t r, m;
+  __uint32_t base;
+  int shift;
+
+  if (x > 127)
+    {
+      *bits = 0x7f800000;
+      return 1;
+    }
+  if (x < -150)
+    {
+      *bits = 0;
+      return 1;
+    }
+  /* Keep 24 bits, or those down to 2^-149, and the rounding bit.
+     Adding the leading bit of a normal number to BASE steps its
+     exponent up to the right one.  */
+  shift = 63 - (x >= -126 ? 24 : x + 150);
+  base = x >= -126 ? (__uint32_t) (x + 126) << 23 : 0;
+  m = n >> shift;
+  r = n & (((__uint64_t) 1 << shift) - 1);
+  if (err && ((m & 1) ? r == 0 : r > ((__uint64_t) 1 << shift) - err))
+    {
+      *bits = base + (__uint32_t) (m >> 1);
+      *half = (__uint32_t) (m | 1);
+      *y = x - 63 + shift;
+      return 0;
+    }
+  if ((m & 1) && r == 0 && !below && !(m & 2))
+    m--;				/* a tie, to even */
+  *bits = base + (__uint32_t) ((m + 1) >> 1);
+  return 1;
+}
+
+/* The next digit of the number from *SP to END, or -1 at END.  */
+static int
+next_digit (const char **sp,
+	const char *end,
+	const char *dp,
+	size_t dplen)
+{
+  const char *s = *sp;
+
+  if (s < end && (*s < '0' || *s > '9'))
+    s += dplen;
+  if (s >= end)
+    return -1;
+  *sp = s + 1;
+  return *s - '0';
+}
+
+/* Compare the decimal number from S to END, whose first digit is
+   nonzero, at 10^P, with the odd HALF * 2^Y.  The digits of the
+   latter come from its integer part, below 2^129, or its fraction of
+   at most 150 bits at the top of 160.  */
+static int
+cmp_half (const char *s,
+	const char *end,
+	const char *dp,
+	size_t dplen,
+	int p,
+	__uint32_t half,
+	int y)
+{
+  __uint16_t v[10];
+  char d[40];
+  __uint64_t h;
+  __uint32_t t;
+  int i, top, at, nd, lo, pm, c, started;
+
+  memset (v, 0, sizeof v);
+  at = nd = sizeof d;
+  lo = 10;
+  if (y >= 0)
+    {
+      h = (__uint64_t) half << y % 16;
+      for (i = y / 16; h; h >>= 16)
+	v[i++] = (__uint16_t) h;
+      /* The integer digits, four at a time from the end.  */
+      for (top = 9; top >= 0 && v[top] == 0; top--)
+	;
+      while (top >= 0)
+	{
+	  for (t = 0, i = top; i >= 0; i--)
+	    {
+	      t = (t << 16) | v[i];
+	      v[i] = (__uint16_t) (t / 10000);
+	      t %= 10000;
+	    }
+	  if (v[top] == 0)
+	    top--;
+	  for (i = 4; i-- > 0; t /= 10)
+	    d[--at] = t % 10;
+	}
+    }
+  else
+    {
+      if (-y < 32)
+	{
+	  for (t = half >> -y; t; t /= 10)
+	    d[--at] = t % 10;
+	  half &= ((__uint32_t) 1 << -y) - 1;
+	}
+      h = (__uint64_t) half << (160 + y) % 16;
+      for (i = (160 + y) / 16; h; h >>= 16)
+	v[i++] = (__uint16_t) h;
+      for (lo = 0; lo < 10 && v[lo] == 0; lo++)
+	;
+    }
+  while (at < nd && d[at] == 0)
+    at++;
+
+  /* Where the first digit of HALF * 2^Y is.  */
+  pm = nd - at - 1;
+  started = at < nd;
+  for (;;)
+    {
+      if (at == nd)
+	{
+	  if (lo == 10)
+	    {
+	      /* HALF * 2^Y has no more digits.  */
+	      while ((c = next_digit (&s, end, dp, dplen)) == 0)
+		;
+	      return c > 0;
+	    }
+	  /* The next fraction digit, carried out of the top limb.  */
+	  for (t = 0, i = lo; i < 10; i++)
+	    {
+	      t += (__uint32_t) v[i] * 10;
+	      v[i] = (__uint16_t) t;
+	      t >>= 16;
+	    }
+	  while (lo < 10 && v[lo] == 0)
+	    lo++;
+	  d[--at] = (char) t;
+	  if (!started && t == 0)
+	    {
+	      /* A leading zero of the fraction.  */
+	      at++;
+	      pm--;
+	      continue;
+	    }
+	  started = 1;
+	}
+      if (p != pm)
+	return p > pm ? 1 : -1;
+      c = next_digit (&s, end, dp, dplen);
+      if (c < 0)
+	{
+	  /* The number has no more digits.  */
+	  while (at < nd && d[at] == 0)
+	    at++;
+	  return at < nd || lo < 10 ? -1 : 0;
+	}
+      if (c != d[at])
+	return c - d[at];
+      at++;
+      p--;
+      pm--;
+    }
+}
+
+static int
+match (const char **sp,
+	const char *t)
+{
+  const char *s = *sp;
+
+  for (; *t; s++, t++)
+    if ((*s | 0x20) != *t)
+      return 0;
+  *sp = s;
+  return 1;
+}
+
+static int
+hexval (int c)
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  c |= 0x20;
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+}
+
+/* The optional exponent at *SP, clamped; *SP is left alone if there
+   is none.  */
+static int
+expon (const char **sp)
+{
+  const char *s = *sp + 1;
+  int esign = 0, e = 0;
+
+  if (*s == '-' || *s == '+')
+    esign = *s++ == '-';
+  if (*s < '0' || *s > '9')
+    return 0;
+  for (; *s >= '0' && *s <= '9'; s++)
+    if (e < 19999)
+      e = 10 * e + *s - '0';
+  *sp = s;
+  return esign ? -e : e;
+}
+
+float
+__strtodf (struct _reent *ptr,
+	const char *__restrict s00,
+	char **__restrict se,
+	locale_t loc)
+{
+  static const __uint32_t ten[10] =
+    { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+      1000000000 };
+  const char *dp = __get_numeric_locale (loc)->decimal_point;
+  size_t dplen = strlen (dp);
+  const char *s = s00, *first = NULL, *end;
+  union { float f; __uint32_t i; } u;
+  __uint32_t hi9 = 0, lo9 = 0, m, half;
+  __uint64_t w, n, lo;
+  int sign = 0, frac = 0, any = 0, sticky = 0, nd = 0, nlo = 0;
+  int p = 0, e = 0, q, x, lz, y, c;
+  unsigned int err;
+
+  u.i = 0;
+  while (*s == ' ' || (*s >= '\t' && *s <= '\r'))
+    s++;
+  if (*s == '-' || *s == '+')
+    sign = *s++ == '-';
+
+  if (*s == '0' && (s[1] | 0x20) == 'x'
+      && (hexval (s[2]) >= 0
+	  || (strncmp (s + 2, dp, dplen) == 0 && hexval (s[2 + dplen]) >= 0)))
+    {
+      /* The first 32 bits, then only whether any of the rest is set.  */
+      for (m = 0, s += 2;; s++)
+	{
+	  if ((c = hexval (*s)) >= 0)
+	    {
+	      if (m >> 28)
+		{
+		  sticky |= c;
+		  if (!frac && e < 10000)
+		    e += 4;
+		}
+	      else
+		{
+		  m = (m << 4) | c;
+		  if (frac && e > -10000)
+		    e -= 4;
+		}
+	    }
+	  else if (!frac && strncmp (s, dp, dplen) == 0)
+	    {
+	      frac = 1;
+	      s += dplen - 1;
+	    }
+	  else
+	    break;
+	}
+      if ((*s | 0x20) == 'p')
+	e += expon (&s);
+      if (m)
+	{
+	  lz = __builtin_clzll ((__uint64_t) m);
+	  round_bits ((__uint64_t) m << lz, 63 - lz + e, 0, sticky, &u.i,
+		      &half, &y);
+	  first = s;
+	}
+      goto done;
+    }
+
+  for (;; s++)
+    {
+      c = *s;
+      if (c >= '0' && c <= '9')
+	{
+	  any = 1;
+	  if (first == NULL)
+	    {
+	      if (frac && p > -10000)
+		p--;
+	      if (c == '0')
+		continue;
+	      first = s;
+	    }
+	  else if (!frac && p < 10000)
+	    p++;
+	  c -= '0';
+	  if (nd < 9)
+	    hi9 = 10 * hi9 + c;
+	  else if (nd < 18)
+	    {
+	      lo9 = 10 * lo9 + c;
+	      nlo++;
+	    }
+	  else
+	    {
+	      sticky |= c;
+	      continue;
+	    }
+	  nd++;
+	}
+      else if (!frac && strncmp (s, dp, dplen) == 0)
+	{
+	  frac = 1;
+	  s += dplen - 1;
+	}
+      else
+	break;
+    }
+  end = s;
+  if (!any)
+    {
+      s = s00;
+      while (*s == ' ' || (*s >= '\t' && *s <= '\r'))
+	s++;
+      if (*s == '-' || *s == '+')
+	s++;
+      if (match (&s, "inf"))
+	{
+	  match (&s, "inity");
+	  u.i = 0x7f800000;
+	}
+      else if (match (&s, "nan"))
+	{
+	  const char *t = s;
+	  __uint32_t payload = 0;
+
+	  /* A payload of hex digits in parentheses sets the low bits.  */
+	  u.i = 0x7fc00000;
+	  if (*t++ == '(')
+	    {
+	      for (c = 1; (*t >= '0' && *t <= '9') || *t == '_'
+		   || ((*t | 0x20) >= 'a' && (*t | 0x20) <= 'z'); t++)
+		if (hexval (*t) >= 0)
+		  payload = (payload << 4) | hexval (*t);
+		else
+		  c = 0;
+	      if (*t == ')')
+		{
+		  s = t + 1;
+		  if (c)
+		    u.i |= payload & 0x3fffff;
+		}
+	    }
+	}
+      else
+	{
+	  s = s00;
+	  sign = 0;
+	}
+      goto done;
+    }
+  if ((*s | 0x20) == 'e')
+    p += expon (&s);
+  if (first == NULL)
+    goto done;
+
+  /* The first digit is at 10^P; below 10^-46 is below 2^-150.  */
+  if (p > 38)
+    u.i = 0x7f800000;
+  else if (p >= -46)
+    {
+      w = (__uint64_t) hi9 * ten[nlo] + lo9;
+      q = p - nd + 1;
+      lz = __builtin_clzll (w);
+      n = mul64 (w << lz, pow5[q - QMIN], &lo);
+      /* The power is exact for small Q; otherwise truncating it costs
+	 up to two units of N, and dropping digits up to 2^LZ more.  */
+      err = q >= 0 && q <= 27 && !sticky ? 0 : 2 + (sticky ? 1U << lz : 0);
+      /* floor (Q * log2 (10)) */
+      x = (int) (((long) 217706 * q) >> 16) + 63 - lz;
+      if (n >> 63)
+	x++;
+      else
+	{
+	  n = (n << 1) | (lo >> 63);
+	  lo <<= 1;
+	  err <<= 1;
+	}
+      if (!round_bits (n, x, err, lo != 0, &u.i, &half, &y)
+	  && ((c = cmp_half (first, end, dp, dplen, p, half, y)) > 0
+	      || (c == 0 && (u.i & 1))))
+	u.i++;
+    }
+
+done:
+#ifndef NO_ERRNO
+  if (first != NULL && ((u.i & 0x7fffffff) == 0 || u.i == 0x7f800000))
+    ptr->_errno = ERANGE;
+#endif
+  if (se)
+    *se = (char *) s;
+  if (sign)
+    u.i |= 0x80000000;
+  return u.f;
+}
+
+#endif /* _DOUBLE_IS_32BITS */
@@ -0,0 +1,63 @@
+/*
+FUNCTION
+<<strtoi16>>, <<strtou16>>, <<strtou32>>---string to fixed-width integer
+
+INDEX
+	strtoi16
+INDEX
+	strtou16
+INDEX
+	strtou32
+
+SYNOPSIS
+	#include <stdlib.h>
+	int16_t strtoi16(const char *restrict <[s]>,
+			 char **restrict <[ptr]>, int <[base]>);
+	uint16_t strtou16(const char *restrict <[s]>,
+			  char **restrict <[ptr]>, int <[base]>);
+	uint32_t strtou32(const char *restrict <[s]>,
+			  char **restrict <[ptr]>, int <[base]>);
+
+DESCRIPTION
+These functions parse <<*<[s]>>> exactly as <<strtol>> (for
+<<strtoi16>>) and <<strtoul>> (for the other two) do, but into a 16 or
+32-bit value, with arithmetic no wider than the result.  Overflow is
+found against constant limits for base 10, and with shifts and masks
+for bases 2, 4, 8, 16 and 32, so those bases never divide; other bases
+divide once per call.  Letters are digits whatever the locale, and
+leading white space is what <<isspace>> accepts.
+
+<<atoi>> uses <<strtoi16>> where <<int>> is 16 bits wide.
+
+RETURNS
+The converted value, or <<0>> if no conversion was made.  If the value
+does not fit, <<strtoi16>> returns <<INT16_MAX>> or <<INT16_MIN>>, and
+<<strtou16>> and <<strtou32>> return <<UINT16_MAX>> and <<UINT32_MAX>>,
+and <<errno>> is set to <<ERANGE>>.  If <[base]> is not 0 or 2 to 36
+they return <<0>> and set <<errno>> to <<EINVAL>>.
+
+PORTABILITY
+These functions are newlib extensions.
+
+No supporting OS subroutines are required.
+*/
+
+#define STRTO_NAME	__strtou16
+#define STRTO_TYPE	__uint16_t
+#include "strto_typed.h"
+
+__int16_t
+strtoi16 (const char *__restrict nptr,
+	char **__restrict endptr,
+	int base)
+{
+  return (__int16_t) __strtou16 (nptr, endptr, base, 0x7fff, 0x8000, 1);
+}
+
+__uint16_t
+strtou16 (const char *__restrict nptr,
+	char **__restrict endptr,
+	int base)
+{
+  return __strtou16 (nptr, endptr, base, 0xffff, 0xffff, 0);
+}
@@ -0,0 +1,13 @@
+/* strtou32: see strtoi16.c.  */
+
+#define STRTO_NAME	__strtou32
+#define STRTO_TYPE	__uint32_t
+#include "strto_typed.h"
+
+__uint32_t
+strtou32 (const char *__restrict nptr,
+	char **__restrict endptr,
+	int base)
+{
+  return __strtou32 (nptr, endptr, base, 0xffffffffUL, 0xffffffffUL, 0);
+}
@@ -0,0 +1,736 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Implementation of <<malloc>> <<free>> <<calloc>> <<realloc>> with
+ * bounded execution time, after "TLSF: a New Dynamic Memory Allocator
+ * for Real-Time Systems" (Masmano, Ripoll, Crespo and Real, 2004).
+ * Selected with --enable-newlib-tlsf-malloc, in place of nano-malloc.
+ *
+ * Interface documentation refer to malloc.c.
+ *
+ * Free blocks are kept on segregated lists indexed by two levels: the
+ * first by the position of the top bit of the block size, the second
+ * by the next TLSF_SL_LOG2 bits.  A bitmap per level records which
+ * lists are non-empty, so finding a free block large enough for any
+ * request is two find-first-set operations, and the lists are never
+ * searched.  Every block starts with its size, the low bits of which
+ * say whether the block and its lower neighbour are free; a free
+ * block ends with a pointer back to its start, so free merges with
+ * both neighbours without searching either.
+ *
+ * Neither malloc nor free contain a loop, apart from the one in
+ * sbrk when the heap has to grow.  The worst case of malloc is
+ * mapping the size, two find-first-set, unlinking one block, and
+ * splitting it, which frees the remainder.  The worst case of free is
+ * unlinking both neighbours and linking the merged block.  realloc
+ * adds the memcpy when the block cannot be resized in place, and
+ * memalign the freeing of the leading padding.  The cycle counts of
+ * these paths on a given part are what newlib.bench/malloc-wcet.c
+ * reports; it checks that they do not grow with the number of free
+ * blocks.  On pic30, with the heap already grown, malloc takes at most
+ * 1000 cycles and free 800 on the parts without EDS, 1400 and 1100 on
+ * those with it, which malloc-wcet.c checks too.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <malloc.h>
+
+#define _SBRK_R(X) _sbrk_r(X)
+
+#ifdef INTERNAL_NEWLIB
+
+#include <sys/config.h>
+#include <reent.h>
+
+#define RARG struct _reent *reent_ptr,
+#define RONEARG struct _reent *reent_ptr
+#define RCALL reent_ptr,
+#define RONECALL reent_ptr
+
+#define MALLOC_LOCK __malloc_lock(reent_ptr)
+#define MALLOC_UNLOCK __malloc_unlock(reent_ptr)
+
+#define RERRNO reent_ptr->_errno
+
+#define tlsf_malloc		_malloc_r
+#define tlsf_free		_free_r
+#define tlsf_realloc		_realloc_r
+#define tlsf_memalign		_memalign_r
+#define tlsf_valloc		_valloc_r
+#define tlsf_pvalloc		_pvalloc_r
+#define tlsf_calloc		_calloc_r
+#define tlsf_cfree		_cfree_r
+#define tlsf_malloc_usable_size _malloc_usable_size_r
+#define tlsf_malloc_stats	_malloc_stats_r
+#define tlsf_mallinfo		_mallinfo_r
+#define tlsf_mallopt		_mallopt_r
+
+#else /* ! INTERNAL_NEWLIB */
+
+#define RARG
+#define RONEARG
+#define RCALL
+#define RONECALL
+#define MALLOC_LOCK
+#define MALLOC_UNLOCK
+#define RERRNO errno
+
+#define tlsf_malloc		malloc
+#define tlsf_free		free
+#define tlsf_realloc		realloc
+#define tlsf_memalign		memalign
+#define tlsf_valloc		valloc
+#define tlsf_pvalloc		pvalloc
+#define tlsf_calloc		calloc
+#define tlsf_cfree		cfree
+#define tlsf_malloc_usable_size malloc_usable_size
+#define tlsf_malloc_stats	malloc_stats
+#define tlsf_mallinfo		mallinfo
+#define tlsf_mallopt		mallopt
+#endif /* ! INTERNAL_NEWLIB */
+
+/* Redefine names to avoid conflict with user names */
+#define control __malloc_tlsf
+#define current_mallinfo __malloc_current_mallinfo
+#define take_block __malloc_tlsf_take
+#define trim_block __malloc_tlsf_trim
+#define release_block __malloc_tlsf_release
+
+#define ALIGN_PTR(ptr, align) \
+    (((ptr) + (align) - (intptr_t)1) & ~((align) - (intptr_t)1))
+#define ALIGN_SIZE(size, align) \
+    (((size) + (align) - (size_t)1) & ~((align) - (size_t)1))
+
+/* Alignment of blocks and of allocated memory.  Two words, so
+ * that the two flag bits below are free in every block size.  */
+#define TLSF_ALIGN (2 * sizeof(void *))
+#if __SIZEOF_POINTER__ == 2
+#define TLSF_ALIGN_LOG2 2
+#elif __SIZEOF_POINTER__ == 4
+#define TLSF_ALIGN_LOG2 3
+#else
+#define TLSF_ALIGN_LOG2 4
+#endif
+
+/* Number of second level lists per first level, as a power of two,
+ * and the top bit of the largest block.  The defaults suit the whole
+ * of a 16-bit address space; smaller values of TLSF_FL_MAX save two
+ * words per list on parts with less memory to manage.  */
+#ifndef TLSF_SL_LOG2
+#if __SIZEOF_SIZE_T__ == 2
+#define TLSF_SL_LOG2 3
+#else
+#define TLSF_SL_LOG2 4
+#endif
+#endif
+
+#ifndef TLSF_FL_MAX
+#if __SIZEOF_SIZE_T__ == 2
+#define TLSF_FL_MAX 15
+#else
+#define TLSF_FL_MAX 30
+#endif
+#endif
+
+#define SL_COUNT (1 << TLSF_SL_LOG2)
+#define FL_SHIFT (TLSF_SL_LOG2 + TLSF_ALIGN_LOG2)
+#define FL_COUNT (TLSF_FL_MAX - FL_SHIFT + 2)
+
+/* Blocks below this size all map to the first level list 0, in
+ * steps of TLSF_ALIGN.  */
+#define SMALL_BLOCK ((size_t)1 << FL_SHIFT)
+
+#define MALLOC_PAGE_ALIGN (0x1000)
+
+typedef size_t malloc_size_t;
+
+typedef struct tlsf_block
+{
+    /*          --------------------------------------
+     *   block->| size | BLOCK_PREV_FREE | BLOCK_FREE |
+     *          --------------------------------------
+     * mem_ptr->| When allocated: data               |
+     *          | When freed: next and previous free |
+     *          | block on the same list ...         |
+     *          |                                    |
+     *          | ... and at the end, a pointer to   |
+     *          | the block                          |
+     *          --------------------------------------
+     */
+    /* size of the whole block, including this word */
+    size_t size;
+
+    /* since here, the memory is either list links, or data load */
+    struct tlsf_block * next_free;
+    struct tlsf_block * prev_free;
+} block;
+
+#define BLOCK_FREE ((size_t)1)
+#define BLOCK_PREV_FREE ((size_t)2)
+#define BLOCK_SIZE(b) ((b)->size & ~(BLOCK_FREE | BLOCK_PREV_FREE))
+
+#define BLOCK_OFFSET (sizeof(size_t))
+#define BLOCK_MIN ALIGN_SIZE(sizeof(block) + sizeof(block *), TLSF_ALIGN)
+
+/* Largest block a request may need, so that rounding it up to the
+ * start of the next list stays within the first level.  */
+#define BLOCK_MAX ((size_t)1 << TLSF_FL_MAX)
+
+#define MEM_TO_BLOCK(p) ((block *)((char *)(p) - BLOCK_OFFSET))
+#define BLOCK_TO_MEM(b) ((void *)((char *)(b) + BLOCK_OFFSET))
+#define NEXT_BLOCK(b) ((block *)((char *)(b) + BLOCK_SIZE(b)))
+#define PREV_BLOCK(b) (((block **)(b))[-1])
+
+#if FL_COUNT < 16
+typedef unsigned int fl_map_t;
+#else
+typedef unsigned long fl_map_t;
+#endif
+
+struct tlsf_control
+{
+    fl_map_t fl_map;
+    unsigned int sl_map[FL_COUNT];
+    block * lists[FL_COUNT][SL_COUNT];
+
+    /* End marker of the memory most recently taken from sbrk: a used
+     * block of size zero, which the next contiguous piece of sbrk
+     * memory starts at.  */
+    block * top;
+
+    char * sbrk_start;
+    size_t free_bytes;
+};
+
+/* Forward data declarations */
+extern struct tlsf_control control;
+extern struct mallinfo current_mallinfo;
+
+/* Forward function declarations */
+extern void * tlsf_malloc(RARG malloc_size_t);
+extern void tlsf_free (RARG void * free_p);
+extern block * take_block (RARG size_t size);
+extern void trim_block (RARG block * b, size_t size);
+extern void release_block (RARG block * b);
+extern void tlsf_cfree(RARG void * ptr);
+extern void * tlsf_calloc(RARG malloc_size_t n, malloc_size_t elem);
+extern void tlsf_malloc_stats(RONEARG);
+extern malloc_size_t tlsf_malloc_usable_size(RARG void * ptr);
+extern void * tlsf_realloc(RARG void * ptr, malloc_size_t size);
+extern void * tlsf_memalign(RARG size_t align, size_t s);
+extern int tlsf_mallopt(RARG int parameter_number, int parameter_value);
+extern void * tlsf_valloc(RARG size_t s);
+extern void * tlsf_pvalloc(RARG size_t s);
+
+/* Index of the highest and lowest set bit.  On pic30 these are the
+ * ff1l and ff1r instructions.  */
+static inline int fls_size(size_t x)
+{
+    return (int)(sizeof(unsigned long) * 8 - 1)
+           - __builtin_clzl((unsigned long)x);
+}
+
+static inline int ffs_map(unsigned long x)
+{
+    return __builtin_ctzl(x);
+}
+
+/* Block size needed for a request of S bytes, or 0 if it is too big */
+static inline size_t request_to_size(malloc_size_t s)
+{
+    size_t size;
+
+    if (s > BLOCK_MAX - BLOCK_OFFSET - TLSF_ALIGN)
+        return 0;
+    size = ALIGN_SIZE(s + BLOCK_OFFSET, TLSF_ALIGN);
+    return size < BLOCK_MIN ? BLOCK_MIN : size;
+}
+
+/* The list a free block of SIZE bytes belongs on */
+static inline void mapping_insert(size_t size, int * fl, int * sl)
+{
+    if (size < SMALL_BLOCK)
+    {
+        *fl = 0;
+        *sl = (int)(size >> TLSF_ALIGN_LOG2);
+    }
+    else
+    {
+        int f = fls_size(size);
+
+        *sl = (int)(size >> (f - TLSF_SL_LOG2)) ^ SL_COUNT;
+        *fl = f - FL_SHIFT + 1;
+    }
+}
+
+static inline void insert_block(block * b)
+{
+    int fl, sl;
+    block * head;
+
+    mapping_insert(BLOCK_SIZE(b), &fl, &sl);
+    head = control.lists[fl][sl];
+    b->next_free = head;
+    b->prev_free = NULL;
+    if (head != NULL)
+        head->prev_free = b;
+    control.lists[fl][sl] = b;
+    control.fl_map |= (fl_map_t)1 << fl;
+    control.sl_map[fl] |= 1U << sl;
+    control.free_bytes += BLOCK_SIZE(b);
+}
+
+static inline void remove_block(block * b)
+{
+    int fl, sl;
+
+    mapping_insert(BLOCK_SIZE(b), &fl, &sl);
+    if (b->next_free != NULL)
+        b->next_free->prev_free = b->prev_free;
+    if (b->prev_free != NULL)
+        b->prev_free->next_free = b->next_free;
+    else
+    {
+        control.lists[fl][sl] = b->next_free;
+        if (b->next_free == NULL)
+        {
+            control.sl_map[fl] &= ~(1U << sl);
+            if (control.sl_map[fl] == 0)
+                control.fl_map &= ~((fl_map_t)1 << fl);
+        }
+    }
+    control.free_bytes -= BLOCK_SIZE(b);
+}
+
+#ifdef DEFINE_MALLOC
+struct tlsf_control control;
+
+/* Take the first block of a list that only holds blocks of at least
+ * SIZE bytes, or NULL */
+static block * find_block(size_t size)
+{
+    int fl, sl;
+    unsigned int sl_map;
+    fl_map_t fl_map;
+
+    /* Round up to the next list so that any block on it will do */
+    if (size >= SMALL_BLOCK)
+        size += ((size_t)1 << (fls_size(size) - TLSF_SL_LOG2)) - 1;
+    mapping_insert(size, &fl, &sl);
+
+    sl_map = control.sl_map[fl] & (~0U << sl);
+    if (sl_map == 0)
+    {
+        fl_map = control.fl_map & (~(fl_map_t)0 << (fl + 1));
+        if (fl_map == 0)
+            return NULL;
+        fl = ffs_map(fl_map);
+        sl_map = control.sl_map[fl];
+    }
+    sl = ffs_map(sl_map);
+    return control.lists[fl][sl];
+}
+
+/* Get a free block of at least SIZE bytes from sbrk, merged with the
+ * free block at the top of the heap if there is one, or NULL */
+static block * grow_heap(RARG size_t size)
+{
+    block * b = control.top;
+    block * prev = NULL;
+    char * p;
+    size_t want = size, lead;
+
+    if (control.sbrk_start == NULL)
+        control.sbrk_start = _SBRK_R(RCALL 0);
+
+    if (b != NULL && (char *)_SBRK_R(RCALL 0) == (char *)b + BLOCK_OFFSET)
+    {
+        /* Carry on from the end marker */
+        if (b->size & BLOCK_PREV_FREE)
+        {
+            prev = PREV_BLOCK(b);
+
+            /* Too small for the list searched, but big enough */
+            if (BLOCK_SIZE(prev) >= size)
+            {
+                remove_block(prev);
+                return prev;
+            }
+            want -= BLOCK_SIZE(prev);
+        }
+        p = _SBRK_R(RCALL want);
+        if (p == (void *)-1)
+            return NULL;
+        b->size = want | (b->size & BLOCK_PREV_FREE);
+    }
+    else
+    {
+        /* Start afresh, with room for the end marker */
+        p = _SBRK_R(RCALL size + BLOCK_OFFSET);
+        if (p == (void *)-1)
+            return NULL;
+
+        /* Ask for a few more bytes if P + BLOCK_OFFSET is not aligned */
+        lead = (char *)ALIGN_PTR((uintptr_t)p + BLOCK_OFFSET, TLSF_ALIGN)
+               - (p + BLOCK_OFFSET);
+        if (lead != 0 && _SBRK_R(RCALL lead) == (void *)-1)
+            return NULL;
+        b = (block *)(p + lead);
+        b->size = size;
+    }
+
+    control.top = NEXT_BLOCK(b);
+    control.top->size = 0;
+
+    if (prev != NULL)
+    {
+        remove_block(prev);
+        prev->size += want;
+        b = prev;
+    }
+    return b;
+}
+
+/* Take a block of at least SIZE bytes off its free list, or from the
+ * system, and cut it down to SIZE.  Called with the lock held.  */
+block * take_block(RARG size_t size)
+{
+    block * b = find_block(size);
+
+    if (b != NULL)
+        remove_block(b);
+    else if ((b = grow_heap(RCALL size)) == NULL)
+        return NULL;
+
+    b->size &= ~BLOCK_FREE;
+    NEXT_BLOCK(b)->size &= ~BLOCK_PREV_FREE;
+    trim_block(RCALL b, size);
+    return b;
+}
+
+/** Function tlsf_malloc
+  * Algorithm:
+  *   Round the request up to a block size and take the first block of
+  *   the first non-empty list whose blocks are all big enough, found
+  *   through the bitmaps.  Split off and free the remainder.  If there
+  *   is no such list, extend the heap with sbrk.
+  */
+void * tlsf_malloc(RARG malloc_size_t s)
+{
+    size_t size = request_to_size(s);
+    block * b;
+
+    if (size == 0)
+    {
+        RERRNO = ENOMEM;
+        return NULL;
+    }
+
+    MALLOC_LOCK;
+    b = take_block(RCALL size);
+    MALLOC_UNLOCK;
+
+    if (b == NULL)
+    {
+        RERRNO = ENOMEM;
+        return NULL;
+    }
+    return BLOCK_TO_MEM(b);
+}
+#endif /* DEFINE_MALLOC */
+
+#ifdef DEFINE_FREE
+/* Mark B free, merge it with its free neighbours and put it on its
+ * list.  Called with the lock held.  */
+void release_block(RARG block * b)
+{
+    size_t size = BLOCK_SIZE(b);
+    block * next = NEXT_BLOCK(b);
+
+    if (b->size & BLOCK_PREV_FREE)
+    {
+        b = PREV_BLOCK(b);
+        remove_block(b);
+        size += BLOCK_SIZE(b);
+    }
+    if (next->size & BLOCK_FREE)
+    {
+        remove_block(next);
+        size += BLOCK_SIZE(next);
+    }
+
+    /* The block below a free block is never free */
+    b->size = size | BLOCK_FREE;
+    next = NEXT_BLOCK(b);
+    PREV_BLOCK(next) = b;
+    next->size |= BLOCK_PREV_FREE;
+    insert_block(b);
+}
+
+/* Free the tail of the used block B beyond SIZE bytes, if it is big
+ * enough to be a block.  Called with the lock held.  */
+void trim_block(RARG block * b, size_t size)
+{
+    size_t rest = BLOCK_SIZE(b) - size;
+    block * r;
+
+    if (rest < BLOCK_MIN)
+        return;
+
+    b->size = size | (b->size & BLOCK_PREV_FREE);
+    r = NEXT_BLOCK(b);
+    r->size = rest;
+    release_block(RCALL r);
+}
+
+/** Function tlsf_free
+  * Implementation of libc free.
+  * Algorithm:
+  *  Merge the block with the neighbours that are free, found through
+  *  the flags and the back pointer at the end of a free block, and
+  *  link the result at the head of its list.
+  */
+void tlsf_free (RARG void * free_p)
+{
+    block * b;
+
+    if (free_p == NULL) return;
+
+    b = MEM_TO_BLOCK(free_p);
+
+    MALLOC_LOCK;
+    if (b->size & BLOCK_FREE)
+    {
+        /* Report double free fault */
+        MALLOC_UNLOCK;
+        RERRNO = ENOMEM;
+        return;
+    }
+    release_block(RCALL b);
+    MALLOC_UNLOCK;
+}
+#endif /* DEFINE_FREE */
+
+#ifdef DEFINE_CFREE
+void tlsf_cfree(RARG void * ptr)
+{
+    tlsf_free(RCALL ptr);
+}
+#endif /* DEFINE_CFREE */
+
+#ifdef DEFINE_CALLOC
+/* Function tlsf_calloc
+ * Implement calloc simply by calling malloc and set zero */
+void * tlsf_calloc(RARG malloc_size_t n, malloc_size_t elem)
+{
+    malloc_size_t bytes;
+    void * mem;
+
+    if (__builtin_mul_overflow (n, elem, &bytes))
+    {
+        RERRNO = ENOMEM;
+        return NULL;
+    }
+    mem = tlsf_malloc(RCALL bytes);
+    if (mem != NULL) memset(mem, 0, bytes);
+    return mem;
+}
+#endif /* DEFINE_CALLOC */
+
+#ifdef DEFINE_REALLOC
+/* Function tlsf_realloc
+ * Shrink in place, grow into a free upper neighbour when it is big
+ * enough, otherwise implement realloc by malloc + memcpy */
+void * tlsf_realloc(RARG void * ptr, malloc_size_t size)
+{
+    void * mem;
+    block * b, * next;
+    size_t need, old_size;
+
+    if (ptr == NULL) return tlsf_malloc(RCALL size);
+
+    if (size == 0)
+    {
+        tlsf_free(RCALL ptr);
+        return NULL;
+    }
+
+    need = request_to_size(size);
+    if (need == 0)
+    {
+        RERRNO = ENOMEM;
+        return NULL;
+    }
+
+    b = MEM_TO_BLOCK(ptr);
+    old_size = BLOCK_SIZE(b);
+
+    MALLOC_LOCK;
+    next = NEXT_BLOCK(b);
+    if (need > old_size && (next->size & BLOCK_FREE)
+        && old_size + BLOCK_SIZE(next) >= need)
+    {
+        remove_block(next);
+        b->size += BLOCK_SIZE(next);
+        NEXT_BLOCK(b)->size &= ~BLOCK_PREV_FREE;
+    }
+    if (need <= BLOCK_SIZE(b))
+    {
+        trim_block(RCALL b, need);
+        MALLOC_UNLOCK;
+        return ptr;
+    }
+    MALLOC_UNLOCK;
+
+    mem = tlsf_malloc(RCALL size);
+    if (mem != NULL)
+    {
+        memcpy(mem, ptr, old_size - BLOCK_OFFSET);
+        tlsf_free(RCALL ptr);
+    }
+    return mem;
+}
+#endif /* DEFINE_REALLOC */
+
+#ifdef DEFINE_MALLINFO
+struct mallinfo current_mallinfo={0,0,0,0,0,0,0,0,0,0};
+
+struct mallinfo tlsf_mallinfo(RONEARG)
+{
+    char * sbrk_now;
+    size_t total_size;
+
+    MALLOC_LOCK;
+
+    if (control.sbrk_start == NULL) total_size = 0;
+    else {
+        sbrk_now = _SBRK_R(RCALL 0);
+
+        if (sbrk_now == (void *)-1)
+            total_size = (size_t)-1;
+        else
+            total_size = (size_t) (sbrk_now - control.sbrk_start);
+    }
+
+    current_mallinfo.arena = total_size;
+    current_mallinfo.fordblks = control.free_bytes;
+    current_mallinfo.uordblks = total_size - control.free_bytes;
+
+    MALLOC_UNLOCK;
+    return current_mallinfo;
+}
+#endif /* DEFINE_MALLINFO */
+
+#ifdef DEFINE_MALLOC_STATS
+void tlsf_malloc_stats(RONEARG)
+{
+    tlsf_mallinfo(RONECALL);
+    fiprintf(stderr, "max system bytes = %10u\n",
+             current_mallinfo.arena);
+    fiprintf(stderr, "system bytes     = %10u\n",
+             current_mallinfo.arena);
+    fiprintf(stderr, "in use bytes     = %10u\n",
+             current_mallinfo.uordblks);
+}
+#endif /* DEFINE_MALLOC_STATS */
+
+#ifdef DEFINE_MALLOC_USABLE_SIZE
+malloc_size_t tlsf_malloc_usable_size(RARG void * ptr)
+{
+    return BLOCK_SIZE(MEM_TO_BLOCK(ptr)) - BLOCK_OFFSET;
+}
+#endif /* DEFINE_MALLOC_USABLE_SIZE */
+
+#ifdef DEFINE_MEMALIGN
+/* Function tlsf_memalign
+ * Allocate memory block aligned at specific boundary.
+ *   align: required alignment. Must be power of 2. Return NULL
+ *          if not power of 2.
+ *   s: required size.
+ * Return: allocated memory pointer aligned to align
+ * Algorithm: Take a block big enough to hold an aligned block of the
+ *            size after a leading free block, then free the leading
+ *            part and the tail.
+ */
+void * tlsf_memalign(RARG size_t align, size_t s)
+{
+    size_t size = request_to_size(s);
+    size_t lead;
+    block * b, * r;
+    char * mem, * aligned_p;
+
+    /* Return NULL if align isn't power of 2 */
+    if ((align & (align-1)) != 0) return NULL;
+
+    if (align <= TLSF_ALIGN)
+        return tlsf_malloc(RCALL s);
+
+    if (size == 0 || align >= BLOCK_MAX
+        || size > BLOCK_MAX - align - BLOCK_MIN)
+    {
+        RERRNO = ENOMEM;
+        return NULL;
+    }
+
+    MALLOC_LOCK;
+    b = take_block(RCALL size + align + BLOCK_MIN);
+    if (b == NULL)
+    {
+        MALLOC_UNLOCK;
+        RERRNO = ENOMEM;
+        return NULL;
+    }
+
+    mem = BLOCK_TO_MEM(b);
+    aligned_p = (char *)ALIGN_PTR((uintptr_t)mem, (uintptr_t)align);
+    lead = aligned_p - mem;
+    if (lead != 0)
+    {
+        /* The leading part must be big enough to be a free block */
+        if (lead < BLOCK_MIN)
+            lead += align;
+        r = (block *)((char *)b + lead);
+        r->size = BLOCK_SIZE(b) - lead;
+        b->size = lead | (b->size & BLOCK_PREV_FREE);
+        release_block(RCALL b);
+        b = r;
+    }
+    trim_block(RCALL b, size);
+    MALLOC_UNLOCK;
+    return BLOCK_TO_MEM(b);
+}
+#endif /* DEFINE_MEMALIGN */
+
+#ifdef DEFINE_MALLOPT
+int tlsf_mallopt(RARG int parameter_number, int parameter_value)
+{
+    return 0;
+}
+#endif /* DEFINE_MALLOPT */
+
+#ifdef DEFINE_VALLOC
+void * tlsf_valloc(RARG size_t s)
+{
+    return tlsf_memalign(RCALL MALLOC_PAGE_ALIGN, s);
+}
+#endif /* DEFINE_VALLOC */
+
+#ifdef DEFINE_PVALLOC
+void * tlsf_pvalloc(RARG size_t s)
+{
+    /* Make sure size given to tlsf_valloc does not overflow */
+    if (s > __SIZE_MAX__ - MALLOC_PAGE_ALIGN)
+    {
+	RERRNO = ENOMEM;
+	return NULL;
+    }
+    return tlsf_valloc(RCALL ALIGN_SIZE(s, MALLOC_PAGE_ALIGN));
+}
+#endif /* DEFINE_PVALLOC */
@@ -0,0 +1,160 @@
+/* __u16toa, __u32toa, __u64toa -- decimal conversion without division.
+
+   Each step takes two digits off with a multiply by a scaled
+   reciprocal of 100 and a shift, and looks them up in a table of the
+   100 pairs.  The multiply is 16 x 16 -> 32, one instruction on a
+   16-bit CPU where a divide is a libgcc call or an 18 cycle loop.  A
+   value wider than 16 bits first loses four digits at a time to a
+   reciprocal of 10000, from the high half of a 32 x 32 product made
+   of 16-bit multiplies.  A value wider than 32 bits is cut into
+   limbs of nine digits by a reciprocal of 10^9, so printf's %lld
+   never calls the 64-bit divide.  When optimizing for size there is no
+   table and each step takes one digit off.
+
+   All three write the digits so that they end just before END and return
+   the first of them; nothing is written at END.  utoa, itoa and the
+   printf integer conversions use them.  */
+
+#include <_ansi.h>
+#include <stdlib.h>
+#include "local.h"
+
+#if !defined (__OPTIMIZE_SIZE__) && !defined (PREFER_SIZE_OVER_SPEED)
+static const char digit_pairs[200] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+/* U / 100 for any 16-bit U; 100 is 4 * 25, and a quarter of U leaves
+   room for a 16-bit reciprocal precise enough.  */
+#define DIV100(u) \
+  ((__uint16_t) (((__uint32_t) (__uint16_t) ((u) >> 2) * 0x147bU) >> 17))
+#else
+/* U / 10 for any 16-bit U.  */
+#define DIV10(u) \
+  ((__uint16_t) (((__uint32_t) (__uint16_t) (u) * 0xcccdU) >> 19))
+#endif
+
+char *
+__u16toa (char *end,
+	__uint16_t u)
+{
+  __uint16_t q;
+
+#if !defined (__OPTIMIZE_SIZE__) && !defined (PREFER_SIZE_OVER_SPEED)
+  unsigned int r;
+
+  while (u >= 100)
+    {
+      q = DIV100 (u);
+      r = (__uint16_t) (u - q * 100);
+      end -= 2;
+      end[0] = digit_pairs[2 * r];
+      end[1] = digit_pairs[2 * r + 1];
+      u = q;
+    }
+  if (u >= 10)
+    {
+      end -= 2;
+      end[0] = digit_pairs[2 * u];
+      end[1] = digit_pairs[2 * u + 1];
+    }
+  else
+    *--end = u + '0';
+#else
+  do
+    {
+      q = DIV10 (u);
+      *--end = (__uint16_t) (u - q * 10) + '0';
+      u = q;
+    }
+  while (u);
+#endif
+  return end;
+}
+
+/* A * B from 16-bit multiplies, which a 16-bit CPU has; a plain
+   64-bit product would be a libgcc call.  */
+static __inline__ __uint64_t
+mul32 (__uint32_t a,
+	__uint32_t b)
+{
+  __uint16_t a0 = (__uint16_t) a, a1 = (__uint16_t) (a >> 16);
+  __uint16_t b0 = (__uint16_t) b, b1 = (__uint16_t) (b >> 16);
+  __uint32_t lo = (__uint32_t) a0 * b0;
+  __uint32_t m1 = (__uint32_t) a0 * b1;
+  __uint32_t m2 = (__uint32_t) a1 * b0;
+  __uint32_t mid = (lo >> 16) + (__uint16_t) m1 + (__uint16_t) m2;
+  __uint32_t hi = (__uint32_t) a1 * b1 + (m1 >> 16) + (m2 >> 16)
+    + (mid >> 16);
+
+  return ((__uint64_t) hi << 32) | (mid << 16) | (__uint16_t) lo;
+}
+
+/* The high 32 bits of A * B.  */
+static __inline__ __uint32_t
+mulhi32 (__uint32_t a,
+	__uint32_t b)
+{
+  return (__uint32_t) (mul32 (a, b) >> 32);
+}
+
+/* U / 1000000000 for any 64-bit U.  10^9 is 2^9 * 1953125, and a
+   55-bit reciprocal of 1953125 scaled by 2^75 is exact for the 55 bits
+   of U >> 9.  The quotient is the high half of that 64 x 64 product,
+   shifted.  */
+static __inline__ __uint64_t
+div1e9 (__uint64_t u)
+{
+  const __uint32_t m1 = 0x44b82fUL, m0 = 0xa09b5a53UL;
+  __uint64_t x = u >> 9;
+  __uint32_t x1 = (__uint32_t) (x >> 32), x0 = (__uint32_t) x;
+  __uint64_t lo = mul32 (x0, m0), a = mul32 (x1, m0), b = mul32 (x0, m1);
+  __uint64_t mid = (lo >> 32) + (__uint32_t) a + (__uint32_t) b;
+
+  return (mul32 (x1, m1) + (a >> 32) + (b >> 32) + (mid >> 32)) >> 11;
+}
+
+char *
+__u32toa (char *end,
+	__uint32_t u)
+{
+  __uint32_t q;
+  char *p;
+
+  while (u > 0xffff)
+    {
+      /* U / 10000, exact for any 32-bit U.  The remainder is below
+	 10000, so 16-bit arithmetic gives it.  */
+      q = mulhi32 (u, 0xd1b71759UL) >> 13;
+      p = __u16toa (end, (__uint16_t) ((__uint16_t) u
+				       - (__uint16_t) q * 10000U));
+      end -= 4;
+      while (p > end)
+	*--p = '0';
+      u = q;
+    }
+  return __u16toa (end, (__uint16_t) u);
+}
+
+char *
+__u64toa (char *end,
+	__uint64_t u)
+{
+  __uint64_t q;
+  char *p;
+
+  while (u > 0xffffffffUL)
+    {
+      /* The remainder is below 10^9, so the low 32 bits give it.  */
+      q = div1e9 (u);
+      p = __u32toa (end, (__uint32_t) u - (__uint32_t) q * 1000000000UL);
+      end -= 9;
+      while (p > end)
+	*--p = '0';
+      u = q;
+    }
+  return __u32toa (end, (__uint32_t) u);
+}
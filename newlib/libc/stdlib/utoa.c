@@ -26,6 +26,8 @@ No supporting OS subroutine calls are required.
 */
 
 #include <stdlib.h>
+#include <string.h>
+#include "local.h"
 
 char *
 __utoa (unsigned value,
@@ -44,6 +46,18 @@ __utoa (unsigned value,
       return NULL;
     }  
     
+  /* Decimal needs no division.  */
+  if (base == 10)
+    {
+      char buf[10];
+      char *p = __u32toa (buf + sizeof buf, value);
+
+      i = buf + sizeof buf - p;
+      memcpy (str, p, i);
+      str[i] = '\0';
+      return str;
+    }
+
   /* Convert to string. Digits are in reverse order.  */
   i = 0;
   do 
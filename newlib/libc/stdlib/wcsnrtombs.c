@@ -72,6 +72,9 @@ PORTABILITY
 #include "local.h"
 #include "../locale/setlocale.h"
 
+/* C is a character from 1 to 0x7f.  */
+#define ASCII_NZ(c)	((c) > 0 && (c) < 0x80)
+
 size_t
 _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
 	       size_t len, mbstate_t *ps, struct __locale_t *loc)
@@ -81,13 +84,16 @@ _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
   wchar_t *pwcs;
   size_t n;
   int i;
-
 #ifdef _MB_CAPABLE
+  int ascii = loc->wctomb == __utf8_wctomb || loc->wctomb == __ascii_wctomb;
+
   if (ps == NULL)
     {
       _REENT_CHECK_MISC(r);
       ps = &(_REENT_WCSRTOMBS_STATE(r));
     }
+#else
+  const int ascii = 1;
 #endif
 
   /* If no dst pointer, treat len as maximum possible value. */
@@ -97,11 +103,30 @@ _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
   n = 0;
   pwcs = (wchar_t *)(*src);
 
-  while (n < len && nwc-- > 0)
+  while (n < len && nwc > 0)
     {
+      /* In UTF-8 and the C locale a character below 0x80 is the byte
+	 of the same value and leaves the state alone, so a run of them,
+	 up to a NUL, needs no call through the locale.  */
+      if (ascii && ps->__count == 0 && ASCII_NZ (*pwcs))
+	{
+	  do
+	    {
+	      if (dst)
+		{
+		  *ptr++ = (char) *pwcs;
+		  ++(*src);
+		}
+	      ++pwcs, ++n, --nwc;
+	    }
+	  while (n < len && nwc > 0 && ASCII_NZ (*pwcs));
+	  continue;
+	}
+
       int count = ps->__count;
       wint_t wch = ps->__value.__wch;
       int bytes = loc->wctomb (r, buff, *pwcs, ps);
+      --nwc;
       if (bytes == -1)
 	{
 	  r->_errno = EILSEQ;
@@ -0,0 +1,54 @@
+/*
+FUNCTION
+<<xorshift32>>, <<pcg16>>---fast pseudo-random numbers
+
+INDEX
+	xorshift32
+INDEX
+	pcg16
+
+SYNOPSIS
+	#include <stdlib.h>
+	uint32_t xorshift32(uint32_t *<[state]>);
+	uint16_t pcg16(uint32_t *<[state]>);
+
+DESCRIPTION
+These generators keep all of their state in the 32-bit word at
+<[state]>, which the caller owns, so each user can have its own
+sequence with no locking and no reentrancy structure.  Neither is
+suitable where the numbers must be unpredictable; use <<arc4random>>
+for that.
+
+<<xorshift32>> is Marsaglia's xorshift generator with the shifts
+13, 17 and 5: three shifts and three exclusive ors per number, with no
+multiply.  It steps through every nonzero 32-bit value before it
+repeats, so *<[state]> must not start at zero, which it never leaves.
+
+<<pcg16>> steps a 32-bit linear congruential generator and returns 16
+bits of it permuted by a shift and a rotation (O'Neill's PCG-XSH-RR
+32/16).  The output is of better statistical quality than that of
+<<xorshift32>>, at the cost of a 32-bit multiply.  Any starting
+*<[state]>, zero included, gives a period of 2^32.
+
+RETURNS
+<<xorshift32>> returns the new state, which is the next number.
+<<pcg16>> returns the next number.
+
+PORTABILITY
+<<xorshift32>> and <<pcg16>> are newlib extensions.
+
+No supporting OS subroutines are required.
+*/
+
+#include <stdlib.h>
+
+__uint32_t
+xorshift32 (__uint32_t *state)
+{
+  __uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return *state = x;
+}
@@ -0,0 +1,11 @@
+/* bswap16_array -- swap the bytes of each element of an array.  */
+
+#include <sys/endian.h>
+
+void
+bswap16_array(__uint16_t *dst, const __uint16_t *src, size_t n)
+{
+
+	while (n-- != 0)
+		*dst++ = bswap16(*src++);
+}
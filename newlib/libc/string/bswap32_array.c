@@ -0,0 +1,11 @@
+/* bswap32_array -- swap the bytes of each element of an array.  */
+
+#include <sys/endian.h>
+
+void
+bswap32_array(__uint32_t *dst, const __uint32_t *src, size_t n)
+{
+
+	while (n-- != 0)
+		*dst++ = bswap32(*src++);
+}
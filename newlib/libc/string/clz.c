@@ -0,0 +1,25 @@
+/* clz16, clz32 -- count leading zero bits.
+
+   As with ctz16 and ctz32, a zero argument gives the width of the
+   type.  */
+
+#include <strings.h>
+#include <limits.h>
+
+unsigned int
+clz16(__uint16_t x)
+{
+
+	if (x == 0)
+		return 16;
+	return (__builtin_clz(x) - (sizeof(int) * CHAR_BIT - 16));
+}
+
+unsigned int
+clz32(__uint32_t x)
+{
+
+	if (x == 0)
+		return 32;
+	return (__builtin_clzl(x) - (sizeof(long) * CHAR_BIT - 32));
+}
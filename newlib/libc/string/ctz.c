@@ -0,0 +1,22 @@
+/* ctz16, ctz32 -- count trailing zero bits.
+
+   Unlike __builtin_ctz, a zero argument is defined: it gives the width
+   of the type, so a bitmap scan needs no separate test for an empty
+   word.  */
+
+#include <strings.h>
+#include <limits.h>
+
+unsigned int
+ctz16(__uint16_t x)
+{
+
+	return (x == 0 ? 16 : __builtin_ctz(x));
+}
+
+unsigned int
+ctz32(__uint32_t x)
+{
+
+	return (x == 0 ? 32 : __builtin_ctzl(x));
+}
@@ -1,8 +1,13 @@
 #include <_ansi.h>
+#include <string.h>
 #include <../ctype/local.h>
 
 /* internal function to compute width of wide char. */
 int __wcwidth (wint_t);
+#ifdef _MB_CAPABLE
+/* the same for a given CJK width mode, see wcwidth.c */
+int __wcwidth_cjk (wint_t, int);
+#endif
 
 /*
    Taken from glibc:
@@ -18,3 +23,55 @@ int __wcwidth (wint_t);
 #endif
 
 
+
+/* The set of the bytes in a string, one bit for each of the 256 byte
+   values, for strspn and its relatives.  Building it once per call keeps
+   a scan linear in the length of the string scanned, however many bytes
+   the set holds.  The terminating NUL is not in the set.  */
+#define __BYTESET_SIZE	32
+
+static inline void
+__byteset_of (unsigned char *set,
+	const char *s)
+{
+  int i;
+
+  for (i = 0; i < __BYTESET_SIZE; i++)
+    set[i] = 0;
+  while (*s)
+    {
+      unsigned char c = *s++;
+      set[c >> 3] |= 1 << (c & 7);
+    }
+}
+
+#define __byteset_add(set, c) \
+  ((set)[(unsigned char) (c) >> 3] |= 1 << ((unsigned char) (c) & 7))
+#define __byteset_has(set, c) \
+  ((set)[(unsigned char) (c) >> 3] & (1 << ((unsigned char) (c) & 7)))
+
+/* The case fold of the byte C, an unsigned char, for strcasecmp and its
+   relatives: a load from the table in casefold.c rather than a call to
+   tolower.  The table folds ASCII alone, which is all that tolower does
+   in every locale but those of the extended charsets, where a byte from
+   0x80 up may be a letter and is left to tolower.  */
+extern const unsigned char __casefold[256];
+
+#if defined (_MB_EXTENDED_CHARSETS_ISO) || defined (_MB_EXTENDED_CHARSETS_WINDOWS)
+#define __casefold_of(c) ((c) < 0x80 ? __casefold[c] : tolower (c))
+#else
+#define __casefold_of(c) (__casefold[c])
+#endif
+
+/* The length of S, at most N, as strnlen.  The bounded copies find the
+   length of what they copy first and then move it with memcpy and
+   memset, so that they run at the speed of the memchr, memcpy and
+   memset the target provides rather than that of a byte loop.  */
+static inline size_t
+__strnlen (const char *s,
+	size_t n)
+{
+  const char *p = memchr (s, '\0', n);
+
+  return p != NULL ? (size_t) (p - s) : n;
+}
@@ -0,0 +1,17 @@
+/* popcount16, popcount32 -- count the bits set.  */
+
+#include <strings.h>
+
+unsigned int
+popcount16(__uint16_t x)
+{
+
+	return (__builtin_popcount(x));
+}
+
+unsigned int
+popcount32(__uint32_t x)
+{
+
+	return (__builtin_popcountl(x));
+}
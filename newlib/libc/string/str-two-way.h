@@ -56,7 +56,22 @@
 # define LONG_NEEDLE_THRESHOLD SIZE_MAX
 #endif
 
+/* The type of an entry in the shift table.  With a 16-bit size_t the
+   table of size_t would take 512 bytes of stack, too much for the small
+   stacks of such targets, so the entries are bytes that saturate at
+   UCHAR_MAX instead.  A saturated entry is less than the true shift and
+   so still safe; only needles longer than UCHAR_MAX lose part of their
+   skip, and the Two-Way bounds are unchanged.  */
+#if SIZE_MAX <= 0xffffU
+# define SHIFT_TYPE unsigned char
+# define SHIFT_MAX UCHAR_MAX
+#else
+# define SHIFT_TYPE size_t
+# define SHIFT_MAX SIZE_MAX
+#endif
+
 #define MAX(a, b) ((a < b) ? (b) : (a))
+#define MIN(a, b) ((a < b) ? (a) : (b))
 
 #ifndef CANON_ELEMENT
 # define CANON_ELEMENT(c) c
@@ -297,7 +312,7 @@ two_way_long_needle (const unsigned char *haystack, size_t haystack_len,
   size_t j; /* Index into current window of HAYSTACK.  */
   size_t period; /* The period of the right half of needle.  */
   size_t suffix; /* The index of the right half of needle.  */
-  size_t shift_table[1U << CHAR_BIT]; /* See below.  */
+  SHIFT_TYPE shift_table[1U << CHAR_BIT]; /* See below.  */
 
   /* Factor the needle into two halves, such that the left half is
      smaller than the global period, and the right half is
@@ -307,11 +322,13 @@ two_way_long_needle (const unsigned char *haystack, size_t haystack_len,
   /* Populate shift_table.  For each possible byte value c,
      shift_table[c] is the distance from the last occurrence of c to
      the end of NEEDLE, or NEEDLE_LEN if c is absent from the NEEDLE.
-     shift_table[NEEDLE[NEEDLE_LEN - 1]] contains the only 0.  */
+     shift_table[NEEDLE[NEEDLE_LEN - 1]] contains the only 0.  Both
+     are limited to SHIFT_MAX.  */
   for (i = 0; i < 1U << CHAR_BIT; i++)
-    shift_table[i] = needle_len;
+    shift_table[i] = MIN (needle_len, SHIFT_MAX);
   for (i = 0; i < needle_len; i++)
-    shift_table[CANON_ELEMENT (needle[i])] = needle_len - i - 1;
+    shift_table[CANON_ELEMENT (needle[i])] = MIN (needle_len - i - 1,
+						  SHIFT_MAX);
 
   /* Perform the search.  Each iteration compares the right half
      first.  */
@@ -330,11 +347,12 @@ two_way_long_needle (const unsigned char *haystack, size_t haystack_len,
 	  shift = shift_table[CANON_ELEMENT (haystack[j + needle_len - 1])];
 	  if (0 < shift)
 	    {
-	      if (memory && shift < period)
+	      if (memory && shift < period && shift < SHIFT_MAX)
 		{
 		  /* Since needle is periodic, but the last period has
 		     a byte out of place, there can be no match until
-		     after the mismatch.  */
+		     after the mismatch.  A saturated shift says nothing
+		     of where that byte is, so it is just taken.  */
 		  shift = needle_len - period;
 		}
 	      memory = 0;
@@ -413,4 +431,7 @@ two_way_long_needle (const unsigned char *haystack, size_t haystack_len,
 #undef CANON_ELEMENT
 #undef CMP_FUNC
 #undef MAX
+#undef MIN
 #undef RETURN_TYPE
+#undef SHIFT_MAX
+#undef SHIFT_TYPE
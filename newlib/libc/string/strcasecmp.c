@@ -25,8 +25,9 @@ RETURNS
 PORTABILITY
 <<strcasecmp>> is in the Berkeley Software Distribution.
 
-<<strcasecmp>> requires no supporting OS subroutines. It uses
-tolower() from elsewhere in this library.
+<<strcasecmp>> requires no supporting OS subroutines. It folds
+ASCII with a table and uses tolower() from elsewhere in this library
+only for the other bytes of the extended charsets.
 
 QUICKREF
 	strcasecmp
@@ -34,16 +35,54 @@ QUICKREF
 
 #include <strings.h>
 #include <ctype.h>
+#include <limits.h>
+#include "local.h"
+
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+/* Nonzero if either X or Y is not aligned on a "long" boundary.  */
+#define UNALIGNED(X, Y) \
+  (((long)X & (sizeof (long) - 1)) | ((long)Y & (sizeof (long) - 1)))
+
+/* DETECTNULL returns nonzero if (long)X contains a NULL byte. */
+#if LONG_MAX == 2147483647L
+#define DETECTNULL(X) (((X) - 0x01010101) & ~(X) & 0x80808080)
+#else
+#if LONG_MAX == 9223372036854775807L
+#define DETECTNULL(X) (((X) - 0x0101010101010101) & ~(X) & 0x8080808080808080)
+#else
+#error long int is not a 32bit or 64bit type.
+#endif
+#endif
+#endif
 
 int
 strcasecmp (const char *s1,
 	const char *s2)
 {
-  int d = 0;
+  const unsigned char *p1 = (const unsigned char *) s1;
+  const unsigned char *p2 = (const unsigned char *) s2;
+  int c1, c2, d = 0;
   for ( ; ; )
     {
-      const int c1 = tolower(*s1++);
-      const int c2 = tolower(*s2++);
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+      /* Words that are the same and hold no NUL fold the same, so they
+	 are skipped whole; only a word in which the strings differ, in
+	 case or otherwise, is folded a byte at a time.  */
+      if (!UNALIGNED (p1, p2))
+	{
+	  const unsigned long *a1 = (const unsigned long *) p1;
+	  const unsigned long *a2 = (const unsigned long *) p2;
+	  while (*a1 == *a2 && !DETECTNULL (*a1))
+	    {
+	      a1++;
+	      a2++;
+	    }
+	  p1 = (const unsigned char *) a1;
+	  p2 = (const unsigned char *) a2;
+	}
+#endif
+      c1 = __casefold_of (*p1++);
+      c2 = __casefold_of (*p2++);
       if (((d = c1 - c2) != 0) || (c2 == '\0'))
         break;
     }
@@ -23,8 +23,9 @@ RETURNS
 PORTABILITY
 <<strcasestr>> is in the Berkeley Software Distribution.
 
-<<strcasestr>> requires no supporting OS subroutines. It uses
-tolower() from elsewhere in this library.
+<<strcasestr>> requires no supporting OS subroutines. It folds
+ASCII with a table and uses tolower() from elsewhere in this library
+only for the other bytes of the extended charsets.
 
 QUICKREF
 	strcasestr
@@ -71,13 +72,14 @@ QUICKREF
 #include <ctype.h>
 #include <string.h>
 #include <strings.h>
+#include "local.h"
 
 #if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
 # define RETURN_TYPE char *
 # define AVAILABLE(h, h_l, j, n_l)			\
   (!memchr ((h) + (h_l), '\0', (j) + (n_l) - (h_l))	\
    && ((h_l) = (j) + (n_l)))
-# define CANON_ELEMENT(c) tolower (c)
+# define CANON_ELEMENT(c) __casefold_of (c)
 #if __GNUC_PREREQ (4, 2)
 /* strncasecmp uses signed char, CMP_FUNC is expected to use unsigned char. */
 #pragma GCC diagnostic ignored "-Wpointer-sign"
@@ -100,13 +102,13 @@ strcasestr (const char *s,
 	size_t len;
 
 	if ((c = *find++) != 0) {
-		c = tolower((unsigned char)c);
+		c = __casefold_of((unsigned char)c);
 		len = strlen(find);
 		do {
 			do {
 				if ((sc = *s++) == 0)
 					return (NULL);
-			} while ((char)tolower((unsigned char)sc) != c);
+			} while ((char)__casefold_of((unsigned char)sc) != c);
 		} while (strncasecmp(s, find, len) != 0);
 		s--;
 	}
@@ -125,8 +127,8 @@ strcasestr (const char *s,
      HAYSTACK is at least as long (no point processing all of a long
      NEEDLE if HAYSTACK is too short).  */
   while (*haystack && *needle)
-    ok &= (tolower ((unsigned char) *haystack++)
-	   == tolower ((unsigned char) *needle++));
+    ok &= (__casefold_of ((unsigned char) *haystack++)
+	   == __casefold_of ((unsigned char) *needle++));
   if (*needle)
     return NULL;
   if (ok)
@@ -24,25 +24,20 @@ PORTABILITY
  */
 
 #include <string.h>
+#include "local.h"
 
 size_t
 strcspn (const char *s1,
 	const char *s2)
 {
   const char *s = s1;
-  const char *c;
-
-  while (*s1)
-    {
-      for (c = s2; *c; c++)
-	{
-	  if (*s1 == *c)
-	    break;
-	}
-      if (*c)
-	break;
-      s1++;
-    }
+  unsigned char set[__BYTESET_SIZE];
+
+  /* With the NUL in the set, one test stops at either.  */
+  __byteset_of (set, s2);
+  __byteset_add (set, '\0');
+  while (!__byteset_has (set, *s1))
+    s1++;
 
   return s1 - s;
 }
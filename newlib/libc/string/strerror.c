@@ -396,495 +396,495 @@ _strerror_r (struct _reent *ptr,
   switch (errnum)
     {
     case 0:
-      error = "Success";
+      error = _PSV_STR ("Success");
       break;
 /* go32 defines EPERM as EACCES */
 #if defined (EPERM) && (!defined (EACCES) || (EPERM != EACCES))
     case EPERM:
-      error = "Not owner";
+      error = _PSV_STR ("Not owner");
       break;
 #endif
 #ifdef ENOENT
     case ENOENT:
-      error = "No such file or directory";
+      error = _PSV_STR ("No such file or directory");
       break;
 #endif
 #ifdef ESRCH
     case ESRCH:
-      error = "No such process";
+      error = _PSV_STR ("No such process");
       break;
 #endif
 #ifdef EINTR
     case EINTR:
-      error = "Interrupted system call";
+      error = _PSV_STR ("Interrupted system call");
       break;
 #endif
 #ifdef EIO
     case EIO:
-      error = "I/O error";
+      error = _PSV_STR ("I/O error");
       break;
 #endif
 /* go32 defines ENXIO as ENODEV */
 #if defined (ENXIO) && (!defined (ENODEV) || (ENXIO != ENODEV))
     case ENXIO:
-      error = "No such device or address";
+      error = _PSV_STR ("No such device or address");
       break;
 #endif
 #ifdef E2BIG
     case E2BIG:
-      error = "Arg list too long";
+      error = _PSV_STR ("Arg list too long");
       break;
 #endif
 #ifdef ENOEXEC
     case ENOEXEC:
-      error = "Exec format error";
+      error = _PSV_STR ("Exec format error");
       break;
 #endif
 #ifdef EALREADY
     case EALREADY:
-      error = "Socket already connected";
+      error = _PSV_STR ("Socket already connected");
       break;
 #endif
 #ifdef EBADF
     case EBADF:
-      error = "Bad file number";
+      error = _PSV_STR ("Bad file number");
       break;
 #endif
 #ifdef ECHILD
     case ECHILD:
-      error = "No children";
+      error = _PSV_STR ("No children");
       break;
 #endif
 #ifdef EDESTADDRREQ
     case EDESTADDRREQ:
-      error = "Destination address required";
+      error = _PSV_STR ("Destination address required");
       break;
 #endif
 #ifdef EAGAIN
     case EAGAIN:
-      error = "No more processes";
+      error = _PSV_STR ("No more processes");
       break;
 #endif
 #ifdef ENOMEM
     case ENOMEM:
-      error = "Not enough space";
+      error = _PSV_STR ("Not enough space");
       break;
 #endif
 #ifdef EACCES
     case EACCES:
-      error = "Permission denied";
+      error = _PSV_STR ("Permission denied");
       break;
 #endif
 #ifdef EFAULT
     case EFAULT:
-      error = "Bad address";
+      error = _PSV_STR ("Bad address");
       break;
 #endif
 #ifdef ENOTBLK
     case ENOTBLK:
-      error = "Block device required";
+      error = _PSV_STR ("Block device required");
       break;
 #endif
 #ifdef EBUSY
     case EBUSY:
-      error = "Device or resource busy";
+      error = _PSV_STR ("Device or resource busy");
       break;
 #endif
 #ifdef EEXIST
     case EEXIST:
-      error = "File exists";
+      error = _PSV_STR ("File exists");
       break;
 #endif
 #ifdef EXDEV
     case EXDEV:
-      error = "Cross-device link";
+      error = _PSV_STR ("Cross-device link");
       break;
 #endif
 #ifdef ENODEV
     case ENODEV:
-      error = "No such device";
+      error = _PSV_STR ("No such device");
       break;
 #endif
 #ifdef ENOTDIR
     case ENOTDIR:
-      error = "Not a directory";
+      error = _PSV_STR ("Not a directory");
       break;
 #endif
 #ifdef EHOSTDOWN
     case EHOSTDOWN:
-      error = "Host is down";
+      error = _PSV_STR ("Host is down");
       break;
 #endif
 #ifdef EINPROGRESS
     case EINPROGRESS:
-      error = "Connection already in progress";
+      error = _PSV_STR ("Connection already in progress");
       break;
 #endif
 #ifdef EISDIR
     case EISDIR:
-      error = "Is a directory";
+      error = _PSV_STR ("Is a directory");
       break;
 #endif
 #ifdef EINVAL
     case EINVAL:
-      error = "Invalid argument";
+      error = _PSV_STR ("Invalid argument");
       break;
 #endif
 #ifdef ENETDOWN
     case ENETDOWN:
-      error = "Network interface is not configured";
+      error = _PSV_STR ("Network interface is not configured");
       break;
 #endif
 #ifdef ENETRESET
     case ENETRESET:
-      error = "Connection aborted by network";
+      error = _PSV_STR ("Connection aborted by network");
       break;
 #endif
 #ifdef ENFILE
     case ENFILE:
-      error = "Too many open files in system";
+      error = _PSV_STR ("Too many open files in system");
       break;
 #endif
 #ifdef EMFILE
     case EMFILE:
-      error = "File descriptor value too large";
+      error = _PSV_STR ("File descriptor value too large");
       break;
 #endif
 #ifdef ENOTTY
     case ENOTTY:
-      error = "Not a character device";
+      error = _PSV_STR ("Not a character device");
       break;
 #endif
 #ifdef ETXTBSY
     case ETXTBSY:
-      error = "Text file busy";
+      error = _PSV_STR ("Text file busy");
       break;
 #endif
 #ifdef EFBIG
     case EFBIG:
-      error = "File too large";
+      error = _PSV_STR ("File too large");
       break;
 #endif
 #ifdef EHOSTUNREACH
     case EHOSTUNREACH:
-      error = "Host is unreachable";
+      error = _PSV_STR ("Host is unreachable");
       break;
 #endif
 #ifdef ENOSPC
     case ENOSPC:
-      error = "No space left on device";
+      error = _PSV_STR ("No space left on device");
       break;
 #endif
 #ifdef ENOTSUP
     case ENOTSUP:
-      error = "Not supported";
+      error = _PSV_STR ("Not supported");
       break;
 #endif
 #ifdef ESPIPE
     case ESPIPE:
-      error = "Illegal seek";
+      error = _PSV_STR ("Illegal seek");
       break;
 #endif
 #ifdef EROFS
     case EROFS:
-      error = "Read-only file system";
+      error = _PSV_STR ("Read-only file system");
       break;
 #endif
 #ifdef EMLINK
     case EMLINK:
-      error = "Too many links";
+      error = _PSV_STR ("Too many links");
       break;
 #endif
 #ifdef EPIPE
     case EPIPE:
-      error = "Broken pipe";
+      error = _PSV_STR ("Broken pipe");
       break;
 #endif
 #ifdef EDOM
     case EDOM:
-      error = "Mathematics argument out of domain of function";
+      error = _PSV_STR ("Mathematics argument out of domain of function");
       break;
 #endif
 #ifdef ERANGE
     case ERANGE:
-      error = "Result too large";
+      error = _PSV_STR ("Result too large");
       break;
 #endif
 #ifdef ENOMSG
     case ENOMSG:
-      error = "No message of desired type";
+      error = _PSV_STR ("No message of desired type");
       break;
 #endif
 #ifdef EIDRM
     case EIDRM:
-      error = "Identifier removed";
+      error = _PSV_STR ("Identifier removed");
       break;
 #endif
 #ifdef EILSEQ
     case EILSEQ:
-      error = "Illegal byte sequence";
+      error = _PSV_STR ("Illegal byte sequence");
       break;
 #endif
 #ifdef EDEADLK
     case EDEADLK:
-      error = "Deadlock";
+      error = _PSV_STR ("Deadlock");
       break;
 #endif
 #ifdef ENETUNREACH
     case  ENETUNREACH:
-      error = "Network is unreachable";
+      error = _PSV_STR ("Network is unreachable");
       break;
 #endif
 #ifdef ENOLCK
     case ENOLCK:
-      error = "No lock";
+      error = _PSV_STR ("No lock");
       break;
 #endif
 #ifdef ENOSTR
     case ENOSTR:
-      error = "Not a stream";
+      error = _PSV_STR ("Not a stream");
       break;
 #endif
 #ifdef ETIME
     case ETIME:
-      error = "Stream ioctl timeout";
+      error = _PSV_STR ("Stream ioctl timeout");
       break;
 #endif
 #ifdef ENOSR
     case ENOSR:
-      error = "No stream resources";
+      error = _PSV_STR ("No stream resources");
       break;
 #endif
 #ifdef ENONET
     case ENONET:
-      error = "Machine is not on the network";
+      error = _PSV_STR ("Machine is not on the network");
       break;
 #endif
 #ifdef ENOPKG
     case ENOPKG:
-      error = "No package";
+      error = _PSV_STR ("No package");
       break;
 #endif
 #ifdef EREMOTE
     case EREMOTE:
-      error = "Resource is remote";
+      error = _PSV_STR ("Resource is remote");
       break;
 #endif
 #ifdef ENOLINK
     case ENOLINK:
-      error = "Virtual circuit is gone";
+      error = _PSV_STR ("Virtual circuit is gone");
       break;
 #endif
 #ifdef EADV
     case EADV:
-      error = "Advertise error";
+      error = _PSV_STR ("Advertise error");
       break;
 #endif
 #ifdef ESRMNT
     case ESRMNT:
-      error = "Srmount error";
+      error = _PSV_STR ("Srmount error");
       break;
 #endif
 #ifdef ECOMM
     case ECOMM:
-      error = "Communication error";
+      error = _PSV_STR ("Communication error");
       break;
 #endif
 #ifdef EPROTO
     case EPROTO:
-      error = "Protocol error";
+      error = _PSV_STR ("Protocol error");
       break;
 #endif
 #ifdef EPROTONOSUPPORT
     case EPROTONOSUPPORT:
-      error = "Unknown protocol";
+      error = _PSV_STR ("Unknown protocol");
       break;
 #endif
 #ifdef EMULTIHOP
     case EMULTIHOP:
-      error = "Multihop attempted";
+      error = _PSV_STR ("Multihop attempted");
       break;
 #endif
 #ifdef EBADMSG
     case EBADMSG:
-      error = "Bad message";
+      error = _PSV_STR ("Bad message");
       break;
 #endif
 #ifdef ELIBACC
     case ELIBACC:
-      error = "Cannot access a needed shared library";
+      error = _PSV_STR ("Cannot access a needed shared library");
       break;
 #endif
 #ifdef ELIBBAD
     case ELIBBAD:
-      error = "Accessing a corrupted shared library";
+      error = _PSV_STR ("Accessing a corrupted shared library");
       break;
 #endif
 #ifdef ELIBSCN
     case ELIBSCN:
-      error = ".lib section in a.out corrupted";
+      error = _PSV_STR (".lib section in a.out corrupted");
       break;
 #endif
 #ifdef ELIBMAX
     case ELIBMAX:
-      error = "Attempting to link in more shared libraries than system limit";
+      error = _PSV_STR ("Attempting to link in more shared libraries than system limit");
       break;
 #endif
 #ifdef ELIBEXEC
     case ELIBEXEC:
-      error = "Cannot exec a shared library directly";
+      error = _PSV_STR ("Cannot exec a shared library directly");
       break;
 #endif
 #ifdef ENOSYS
     case ENOSYS:
-      error = "Function not implemented";
+      error = _PSV_STR ("Function not implemented");
       break;
 #endif
 #ifdef ENMFILE
     case ENMFILE:
-      error = "No more files";
+      error = _PSV_STR ("No more files");
       break;
 #endif
 #ifdef ENOTEMPTY
     case ENOTEMPTY:
-      error = "Directory not empty";
+      error = _PSV_STR ("Directory not empty");
       break;
 #endif
 #ifdef ENAMETOOLONG
     case ENAMETOOLONG:
-      error = "File or path name too long";
+      error = _PSV_STR ("File or path name too long");
       break;
 #endif
 #ifdef ELOOP
     case ELOOP:
-      error = "Too many symbolic links";
+      error = _PSV_STR ("Too many symbolic links");
       break;
 #endif
 #ifdef ENOBUFS
     case ENOBUFS:
-      error = "No buffer space available";
+      error = _PSV_STR ("No buffer space available");
       break;
 #endif
 #ifdef ENODATA
     case ENODATA:
-      error = "No data";
+      error = _PSV_STR ("No data");
       break;
 #endif
 #ifdef EAFNOSUPPORT
     case EAFNOSUPPORT:
-      error = "Address family not supported by protocol family";
+      error = _PSV_STR ("Address family not supported by protocol family");
       break;
 #endif
 #ifdef EPROTOTYPE
     case EPROTOTYPE:
-      error = "Protocol wrong type for socket";
+      error = _PSV_STR ("Protocol wrong type for socket");
       break;
 #endif
 #ifdef ENOTSOCK
     case ENOTSOCK:
-      error = "Socket operation on non-socket";
+      error = _PSV_STR ("Socket operation on non-socket");
       break;
 #endif
 #ifdef ENOPROTOOPT
     case ENOPROTOOPT:
-      error = "Protocol not available";
+      error = _PSV_STR ("Protocol not available");
       break;
 #endif
 #ifdef ESHUTDOWN
     case ESHUTDOWN:
-      error = "Can't send after socket shutdown";
+      error = _PSV_STR ("Can't send after socket shutdown");
       break;
 #endif
 #ifdef ECONNREFUSED
     case ECONNREFUSED:
-      error = "Connection refused";
+      error = _PSV_STR ("Connection refused");
       break;
 #endif
 #ifdef ECONNRESET
     case ECONNRESET:
-      error = "Connection reset by peer";
+      error = _PSV_STR ("Connection reset by peer");
       break;
 #endif
 #ifdef EADDRINUSE
     case EADDRINUSE:
-      error = "Address already in use";
+      error = _PSV_STR ("Address already in use");
       break;
 #endif
 #ifdef EADDRNOTAVAIL
     case EADDRNOTAVAIL:
-      error = "Address not available";
+      error = _PSV_STR ("Address not available");
       break;
 #endif
 #ifdef ECONNABORTED
     case ECONNABORTED:
-      error = "Software caused connection abort";
+      error = _PSV_STR ("Software caused connection abort");
       break;
 #endif
 #if (defined(EWOULDBLOCK) && (!defined (EAGAIN) || (EWOULDBLOCK != EAGAIN)))
     case EWOULDBLOCK:
-        error = "Operation would block";
+        error = _PSV_STR ("Operation would block");
         break;
 #endif
 #ifdef ENOTCONN
     case ENOTCONN:
-        error = "Socket is not connected";
+        error = _PSV_STR ("Socket is not connected");
         break;
 #endif
 #ifdef ESOCKTNOSUPPORT
     case ESOCKTNOSUPPORT:
-        error = "Socket type not supported";
+        error = _PSV_STR ("Socket type not supported");
         break;
 #endif
 #ifdef EISCONN
     case EISCONN:
-        error = "Socket is already connected";
+        error = _PSV_STR ("Socket is already connected");
         break;
 #endif
 #ifdef ECANCELED
     case ECANCELED:
-        error = "Operation canceled";
+        error = _PSV_STR ("Operation canceled");
         break;
 #endif
 #ifdef ENOTRECOVERABLE
     case ENOTRECOVERABLE:
-        error = "State not recoverable";
+        error = _PSV_STR ("State not recoverable");
         break;
 #endif
 #ifdef EOWNERDEAD
     case EOWNERDEAD:
-        error = "Previous owner died";
+        error = _PSV_STR ("Previous owner died");
         break;
 #endif
 #ifdef ESTRPIPE
     case ESTRPIPE:
-	error = "Streams pipe error";
+	error = _PSV_STR ("Streams pipe error");
 	break;
 #endif
 #if defined(EOPNOTSUPP) && (!defined(ENOTSUP) || (ENOTSUP != EOPNOTSUPP))
     case EOPNOTSUPP:
-        error = "Operation not supported on socket";
+        error = _PSV_STR ("Operation not supported on socket");
         break;
 #endif
 #ifdef EOVERFLOW
     case EOVERFLOW:
-      error = "Value too large for defined data type";
+      error = _PSV_STR ("Value too large for defined data type");
       break;
 #endif
 #ifdef EMSGSIZE
     case EMSGSIZE:
-        error = "Message too long";
+        error = _PSV_STR ("Message too long");
         break;
 #endif
 #ifdef ETIMEDOUT
     case ETIMEDOUT:
-        error = "Connection timed out";
+        error = _PSV_STR ("Connection timed out");
         break;
 #endif
     default:
       if (!errptr)
         errptr = &ptr->_errno;
       if ((error = _user_strerror (errnum, internal, errptr)) == 0)
-        error = "";
+        error = _PSV_STR ("");
       break;
     }
 
@@ -33,6 +33,7 @@ static char *rcsid = "$OpenBSD: strlcat.c,v 1.8 2001/05/13 15:40:15 deraadt Exp
 
 #include <sys/types.h>
 #include <string.h>
+#include "local.h"
 
 /*
  * Appends src to string dst of size siz (unlike strncat, siz is the
@@ -46,28 +47,18 @@ strlcat (char *dst,
 	const char *src,
 	size_t siz)
 {
-        register char *d = dst;
-        register const char *s = src;
-        register size_t n = siz;
-        size_t dlen;
-
-        /* Find the end of dst and adjust bytes left but don't go past end */
-        while (n-- != 0 && *d != '\0')
-                d++;
-        dlen = d - dst;
-        n = siz - dlen;
+        size_t dlen = __strnlen(dst, siz);
+        size_t slen = strlen(src);
+        size_t n = siz - dlen;
 
         if (n == 0)
-                return(dlen + strlen(s));
-        while (*s != '\0') {
-                if (n != 1) {
-                        *d++ = *s;
-                        n--;
-                }
-                s++;
-        }
-        *d = '\0';
+                return(dlen + slen);
+        if (slen < n)
+                n = slen;
+        else
+                n--;
+        memcpy(dst + dlen, src, n);
+        dst[dlen + n] = '\0';
 
-        return(dlen + (s - src));        /* count does not include NUL */
+        return(dlen + slen);        /* count does not include NUL */
 }
-
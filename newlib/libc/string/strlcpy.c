@@ -33,6 +33,7 @@ static char *rcsid = "$OpenBSD: strlcpy.c,v 1.5 2001/05/13 15:40:16 deraadt Exp
 
 #include <sys/types.h>
 #include <string.h>
+#include "local.h"
 
 /*
  * Copy src to string dst of size siz.  At most siz-1 characters
@@ -44,26 +45,14 @@ strlcpy (char *dst,
 	const char *src,
 	size_t siz)
 {
-        register char *d = dst;
-        register const char *s = src;
-        register size_t n = siz;
+        size_t len = strlen(src);
+        size_t n;
 
-        /* Copy as many bytes as will fit */
-        if (n != 0 && --n != 0) {
-                do {
-                        if ((*d++ = *s++) == 0)
-                                break;
-                } while (--n != 0);
+        if (siz != 0) {
+                n = len < siz ? len : siz - 1;
+                memcpy(dst, src, n);
+                dst[n] = '\0';                /* NUL-terminate dst */
         }
 
-        /* Not enough room in dst, add NUL and traverse rest of src */
-        if (n == 0) {
-                if (siz != 0)
-                        *d = '\0';                /* NUL-terminate dst */
-                while (*s++)
-                        ;
-        }
-
-        return(s - src - 1);        /* count does not include NUL */
+        return(len);        /* count does not include NUL */
 }
-
@@ -1,21 +1,16 @@
 #include <reent.h>
 #include <stdlib.h>
 #include <string.h>
+#include "local.h"
 
 char *
 _strndup_r (struct _reent *reent_ptr,
         const char   *str,
         size_t n)
 {
-  const char *ptr = str;
-  size_t len;
+  size_t len = __strnlen (str, n);
   char *copy;
 
-  while (n-- > 0 && *ptr)
-    ptr++;
-
-  len = ptr - str;
-
   copy = _malloc_r (reent_ptr, len + 1);
   if (copy)
     {
@@ -28,15 +28,11 @@ PORTABILITY
 #undef __STRICT_ANSI__
 #include <_ansi.h>
 #include <string.h>
+#include "local.h"
 
 size_t
 strnlen (const char *str,
 	size_t n)
 {
-  const char *start = str;
-
-  while (n-- > 0 && *str)
-    str++;
-
-  return str - start;
+  return __strnlen (str, n);
 }
@@ -23,29 +23,18 @@ PORTABILITY
 */
 
 #include <string.h>
+#include "local.h"
 
 char *
 strpbrk (const char *s1,
 	const char *s2)
 {
-  const char *c = s2;
-  if (!*s1)
-    return (char *) NULL;
-
-  while (*s1)
-    {
-      for (c = s2; *c; c++)
-	{
-	  if (*s1 == *c)
-	    break;
-	}
-      if (*c)
-	break;
-      s1++;
-    }
-
-  if (*c == '\0')
-    s1 = NULL;
-
-  return (char *) s1;
+  unsigned char set[__BYTESET_SIZE];
+
+  __byteset_of (set, s2);
+  __byteset_add (set, '\0');
+  while (!__byteset_has (set, *s1))
+    s1++;
+
+  return *s1 ? (char *) s1 : NULL;
 }
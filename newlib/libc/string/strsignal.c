@@ -73,27 +73,27 @@ strsignal (int signal)
   switch (signal) {
 #ifdef SIGHUP
     case SIGHUP:
-      buffer = "Hangup";
+      buffer = _PSV_STR ("Hangup");
       break;
 #endif
 #ifdef SIGINT
     case SIGINT:
-      buffer = "Interrupt";
+      buffer = _PSV_STR ("Interrupt");
       break;
 #endif
 #ifdef SIGQUIT
     case SIGQUIT:
-      buffer = "Quit";
+      buffer = _PSV_STR ("Quit");
       break;
 #endif
 #ifdef SIGILL
     case SIGILL:
-      buffer = "Illegal instruction";
+      buffer = _PSV_STR ("Illegal instruction");
       break;
 #endif
 #ifdef SIGTRAP
     case SIGTRAP:
-      buffer = "Trace/breakpoint trap";
+      buffer = _PSV_STR ("Trace/breakpoint trap");
       break;
 #endif
 #ifdef SIGIOT
@@ -101,72 +101,72 @@ strsignal (int signal)
     case SIGABRT:
   #endif
     case SIGIOT:
-      buffer = "IOT trap";
+      buffer = _PSV_STR ("IOT trap");
       break;
 #endif
 #ifdef SIGEMT
     case SIGEMT:
-      buffer = "EMT trap";
+      buffer = _PSV_STR ("EMT trap");
       break;
 #endif
 #ifdef SIGFPE
     case SIGFPE:
-      buffer = "Floating point exception";
+      buffer = _PSV_STR ("Floating point exception");
       break;
 #endif
 #ifdef SIGKILL
     case SIGKILL:
-      buffer = "Killed";
+      buffer = _PSV_STR ("Killed");
       break;
 #endif
 #ifdef SIGBUS
     case SIGBUS:
-      buffer = "Bus error";
+      buffer = _PSV_STR ("Bus error");
       break;
 #endif
 #ifdef SIGSEGV
     case SIGSEGV:
-      buffer = "Segmentation fault";
+      buffer = _PSV_STR ("Segmentation fault");
       break;
 #endif
 #ifdef SIGSYS
     case SIGSYS:
-      buffer = "Bad system call";
+      buffer = _PSV_STR ("Bad system call");
       break;
 #endif
 #ifdef SIGPIPE
     case SIGPIPE:
-      buffer = "Broken pipe";
+      buffer = _PSV_STR ("Broken pipe");
       break;
 #endif
 #ifdef SIGALRM
     case SIGALRM:
-      buffer = "Alarm clock";
+      buffer = _PSV_STR ("Alarm clock");
       break;
 #endif
 #ifdef SIGTERM
     case SIGTERM:
-      buffer = "Terminated";
+      buffer = _PSV_STR ("Terminated");
       break;
 #endif
 #ifdef SIGURG
     case SIGURG:
-      buffer = "Urgent I/O condition";
+      buffer = _PSV_STR ("Urgent I/O condition");
       break;
 #endif
 #ifdef SIGSTOP
     case SIGSTOP:
-      buffer = "Stopped (signal)";
+      buffer = _PSV_STR ("Stopped (signal)");
       break;
 #endif
 #ifdef SIGTSTP
     case SIGTSTP:
-      buffer = "Stopped";
+      buffer = _PSV_STR ("Stopped");
       break;
 #endif
 #ifdef SIGCONT
     case SIGCONT:
-      buffer = "Continued";
+      buffer = _PSV_STR ("Continued");
       break;
 #endif
 #ifdef SIGCHLD
@@ -174,17 +174,17 @@ strsignal (int signal)
     case SIGCLD:
   #endif
     case SIGCHLD:
-      buffer = "Child exited";
+      buffer = _PSV_STR ("Child exited");
       break;
 #endif
 #ifdef SIGTTIN
     case SIGTTIN:
-      buffer = "Stopped (tty input)";
+      buffer = _PSV_STR ("Stopped (tty input)");
       break;
 #endif
 #ifdef SIGTTOUT
     case SIGTTOUT:
-      buffer = "Stopped (tty output)";
+      buffer = _PSV_STR ("Stopped (tty output)");
       break;
 #endif
 #ifdef SIGIO
@@ -192,52 +192,52 @@ strsignal (int signal)
     case SIGPOLL:
   #endif
     case SIGIO:
-      buffer = "I/O possible";
+      buffer = _PSV_STR ("I/O possible");
       break;
 #endif
 #ifdef SIGWINCH
     case SIGWINCH:
-      buffer = "Window changed";
+      buffer = _PSV_STR ("Window changed");
       break;
 #endif
 #ifdef SIGUSR1
     case SIGUSR1:
-      buffer = "User defined signal 1";
+      buffer = _PSV_STR ("User defined signal 1");
       break;
 #endif
 #ifdef SIGUSR2
     case SIGUSR2:
-      buffer = "User defined signal 2";
+      buffer = _PSV_STR ("User defined signal 2");
       break;
 #endif
 #ifdef SIGPWR
     case SIGPWR:
-      buffer = "Power Failure";
+      buffer = _PSV_STR ("Power Failure");
       break;
 #endif
 #ifdef SIGXCPU
     case SIGXCPU:
-      buffer = "CPU time limit exceeded";
+      buffer = _PSV_STR ("CPU time limit exceeded");
       break;
 #endif
 #ifdef SIGXFSZ
     case SIGXFSZ:
-      buffer = "File size limit exceeded";
+      buffer = _PSV_STR ("File size limit exceeded");
       break;
 #endif
 #ifdef SIGVTALRM 
     case SIGVTALRM :
-      buffer = "Virtual timer expired";
+      buffer = _PSV_STR ("Virtual timer expired");
       break;
 #endif
 #ifdef SIGPROF
     case SIGPROF:
-      buffer = "Profiling timer expired";
+      buffer = _PSV_STR ("Profiling timer expired");
       break;
 #endif
 #if defined(SIGLOST) && SIGLOST != SIGPWR
     case SIGLOST:
-      buffer = "Resource lost";
+      buffer = _PSV_STR ("Resource lost");
       break;
 #endif
     default:
@@ -28,25 +28,19 @@ QUICKREF
 */
 
 #include <string.h>
+#include "local.h"
 
 size_t
 strspn (const char *s1,
 	const char *s2)
 {
   const char *s = s1;
-  const char *c;
-
-  while (*s1)
-    {
-      for (c = s2; *c; c++)
-	{
-	  if (*s1 == *c)
-	    break;
-	}
-      if (*c == '\0')
-	break;
-      s1++;
-    }
+  unsigned char set[__BYTESET_SIZE];
+
+  /* The NUL is not in the set, so the scan stops there.  */
+  __byteset_of (set, s2);
+  while (__byteset_has (set, *s1))
+    s1++;
 
   return s1 - s;
 }
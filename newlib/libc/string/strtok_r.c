@@ -28,6 +28,7 @@
  */
 
 #include <string.h>
+#include "local.h"
 
 char *
 __strtok_r (register char *s,
@@ -35,8 +36,7 @@ __strtok_r (register char *s,
 	char **lasts,
 	int skip_leading_delim)
 {
-	register char *spanp;
-	register int c, sc;
+	unsigned char set[__BYTESET_SIZE];
 	char *tok;
 
 
@@ -44,48 +44,37 @@ __strtok_r (register char *s,
 		return (NULL);
 
 	/*
-	 * Skip (span) leading delimiters (s += strspn(s, delim), sort of).
+	 * Build the delimiter set once, so that each byte of s is tested
+	 * in constant time rather than against every delimiter.
 	 */
-cont:
-	c = *s++;
-	for (spanp = (char *)delim; (sc = *spanp++) != 0;) {
-		if (c == sc) {
-			if (skip_leading_delim) {
-				goto cont;
-			}
-			else {
-				*lasts = s;
-				s[-1] = 0;
-				return (s - 1);
-			}
-		}
-	}
+	__byteset_of(set, delim);
 
-	if (c == 0) {		/* no non-delimiter characters */
+	/*
+	 * Skip (span) leading delimiters (s += strspn(s, delim)).
+	 */
+	if (skip_leading_delim)
+		while (__byteset_has(set, *s))
+			s++;
+
+	if (*s == 0) {		/* no non-delimiter characters */
 		*lasts = NULL;
 		return (NULL);
 	}
-	tok = s - 1;
+	tok = s;
 
 	/*
-	 * Scan token (scan for delimiters: s += strcspn(s, delim), sort of).
-	 * Note that delim must have one NUL; we stop if we see that, too.
+	 * Scan token (s += strcspn(s, delim)).  The NUL joins the set so
+	 * that one test stops at the end of the string, too.
 	 */
-	for (;;) {
-		c = *s++;
-		spanp = (char *)delim;
-		do {
-			if ((sc = *spanp++) == c) {
-				if (c == 0)
-					s = NULL;
-				else
-					s[-1] = 0;
-				*lasts = s;
-				return (tok);
-			}
-		} while (sc != 0);
-	}
-	/* NOTREACHED */
+	__byteset_add(set, 0);
+	while (!__byteset_has(set, *s))
+		s++;
+	if (*s == 0)
+		s = NULL;
+	else
+		*s++ = 0;
+	*lasts = s;
+	return (tok);
 }
 
 char *
@@ -42,8 +42,17 @@ wcscasecmp (const wchar_t *s1,
   int d = 0;
   for ( ; ; )
     {
-      const int c1 = towlower (*s1++);
-      const int c2 = towlower (*s2++);
+      const wchar_t w1 = *s1++;
+      const wchar_t w2 = *s2++;
+      /* Equal characters need no case mapping.  */
+      if (w1 == w2)
+	{
+	  if (w2 == L'\0')
+	    break;
+	  continue;
+	}
+      const int c1 = towlower (w1);
+      const int c2 = towlower (w2);
       if (((d = c1 - c2) != 0) || (c2 == '\0'))
         break;
     }
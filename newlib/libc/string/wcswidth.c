@@ -39,12 +39,24 @@ wcswidth (const wchar_t *pwcs,
 
 {
   int w, len = 0;
+#ifdef _MB_CAPABLE
+  int cjk_lang;
+#endif
   if (!pwcs || n == 0)
     return 0;
+#ifdef _MB_CAPABLE
+  cjk_lang = __locale_cjk_lang ();
+#endif
   do {
     wint_t wi = *pwcs;
 
 #ifdef _MB_CAPABLE
+  /* Printable ASCII needs neither _jp2uc nor the width tables. */
+  if (wi >= 0x20 && wi < 0x7f)
+    {
+      len++;
+      continue;
+    }
   wi = _jp2uc (wi);
   /* First half of a surrogate pair? */
   if (sizeof (wchar_t) == 2 && wi >= 0xd800 && wi <= 0xdbff)
@@ -57,9 +69,12 @@ wcswidth (const wchar_t *pwcs,
       /* Compute actual unicode value to use in call to __wcwidth. */
       wi = (((wi & 0x3ff) << 10) | (wi2 & 0x3ff)) + 0x10000;
     }
-#endif /* _MB_CAPABLE */
+    if ((w = __wcwidth_cjk (wi, cjk_lang)) < 0)
+      return -1;
+#else
     if ((w = __wcwidth (wi)) < 0)
       return -1;
+#endif /* _MB_CAPABLE */
     len += w;
   } while (*pwcs++ && --n > 0);
   return len;
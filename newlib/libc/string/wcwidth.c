@@ -124,6 +124,52 @@ bisearch(wint_t ucs, const struct interval *table, int max)
 
   return 0;
 }
+
+/* width classes of the map below */
+#define WIDTH_OTHER	0
+#define WIDTH_AMBIGUOUS	1
+#define WIDTH_COMBINING	2
+#define WIDTH_WIDE	3
+
+/* Width class of each character below U+20000, 2 bits each, in pages
+   of 64 characters; widthindex.t gives the page of each 64 (see
+   mkunidata).  */
+static const unsigned char width_index[] =
+{
+#include "widthindex.t"
+};
+
+static const unsigned char width_pages[][16] =
+{
+#include "widthpages.t"
+};
+
+static int
+width_class (wint_t ucs)
+{
+  /* sorted lists of non-overlapping intervals of East Asian Ambiguous,
+     non-spacing, and wide characters, from U+20000 up */
+  static const struct interval ambiguous[] =
+#include "ambiguous.t"
+  static const struct interval combining[] =
+#include "combining.t"
+  static const struct interval wide[] =
+#include "wide.t"
+
+  if (ucs < 0x20000)
+    return (width_pages[width_index[ucs >> 6]][(ucs >> 2) & 15]
+	    >> ((ucs & 3) * 2)) & 3;
+  if (bisearch(ucs, ambiguous,
+	       sizeof(ambiguous) / sizeof(struct interval) - 1))
+    return WIDTH_AMBIGUOUS;
+  if (bisearch(ucs, combining,
+	       sizeof(combining) / sizeof(struct interval) - 1))
+    return WIDTH_COMBINING;
+  if (bisearch(ucs, wide,
+	       sizeof(wide) / sizeof(struct interval) - 1))
+    return WIDTH_WIDE;
+  return WIDTH_OTHER;
+}
 #endif /* _MB_CAPABLE */
 
 /* The following function defines the column width of an ISO 10646
@@ -163,24 +209,13 @@ bisearch(wint_t ucs, const struct interval *table, int max)
  * in ISO 10646.
  */
 
+#ifdef _MB_CAPABLE
+/* __wcwidth for a CJK width mode cjk_lang, as __locale_cjk_lang returns
+   it (1: ambiguous-wide, 0: normal, -1: disabled), so that wcswidth
+   looks it up once per string.  */
 int
-__wcwidth (const wint_t ucs)
+__wcwidth_cjk (const wint_t ucs, int cjk_lang)
 {
-#ifdef _MB_CAPABLE
-  /* sorted list of non-overlapping intervals of East Asian Ambiguous chars */
-  static const struct interval ambiguous[] =
-#include "ambiguous.t"
-
-  /* sorted list of non-overlapping intervals of non-spacing characters */
-  static const struct interval combining[] =
-#include "combining.t"
-
-  /* sorted list of non-overlapping intervals of wide characters,
-     ranges extended to Blocks where possible
-   */
-  static const struct interval wide[] =
-#include "wide.t"
-
   /* Test for NUL character */
   if (ucs == 0)
     return 0;
@@ -197,29 +232,29 @@ __wcwidth (const wint_t ucs)
   if (ucs >= 0xd800 && ucs <= 0xdfff)
     return -1;
 
-  /* check CJK width mode (1: ambiguous-wide, 0: normal, -1: disabled) */
-  int cjk_lang = __locale_cjk_lang ();
-
-  /* binary search in table of ambiguous characters */
-  if (cjk_lang > 0
-      && bisearch(ucs, ambiguous,
-		  sizeof(ambiguous) / sizeof(struct interval) - 1))
-    return 2;
-
-  /* binary search in table of non-spacing characters */
-  if (bisearch(ucs, combining,
-	       sizeof(combining) / sizeof(struct interval) - 1))
-    return 0;
-
-  /* if we arrive here, ucs is not a combining or C0/C1 control character */
+  switch (width_class (ucs))
+    {
+    case WIDTH_AMBIGUOUS:
+      return cjk_lang > 0 ? 2 : 1;
+    case WIDTH_COMBINING:
+      return 0;
+    case WIDTH_WIDE:
+      return cjk_lang >= 0 ? 2 : 1;
+    default:
+      return 1;
+    }
+}
+#endif /* _MB_CAPABLE */
 
-  /* binary search in table of wide character codes */
-  if (cjk_lang >= 0
-      && bisearch(ucs, wide,
-	       sizeof(wide) / sizeof(struct interval) - 1))
-    return 2;
-  else
+int
+__wcwidth (const wint_t ucs)
+{
+#ifdef _MB_CAPABLE
+  /* Test for printable ASCII characters */
+  if (ucs >= 0x20 && ucs < 0x7f)
     return 1;
+
+  return __wcwidth_cjk (ucs, __locale_cjk_lang ());
 #else /* !_MB_CAPABLE */
   if (iswprint (ucs))
     return 1;
@@ -33,5 +33,10 @@ double
 difftime (time_t tim1,
 	time_t tim2)
 {
+#ifdef _USE_UNSIGNED_TIME_T
+  /* The difference of two unsigned times is negative, not a wrap.  */
+  if (tim1 < tim2)
+    return -(double)(tim2 - tim1);
+#endif
   return (double)(tim1 - tim2);
 }
@@ -21,8 +21,9 @@
 #define isleap(y) ((((y) % 4) == 0 && ((y) % 100) != 0) || ((y) % 400) == 0)
 
 int         __tzcalc_limits (int __year);
+void        __tzcalc_flush (void);
 
-extern const int __month_lengths[2][MONSPERYEAR];
+extern const int __month_lengths[2][MONSPERYEAR] _PSV_CONST;
 
 void _tzset_unlocked_r (struct _reent *);
 void _tzset_unlocked (void);
@@ -15,14 +15,17 @@
 
 /*
 FUNCTION
-<<mktime>>---convert time to arithmetic representation
+<<mktime>>, <<timegm>>---convert time to arithmetic representation
 
 INDEX
 	mktime
+INDEX
+	timegm
 
 SYNOPSIS
 	#include <time.h>
 	time_t mktime(struct tm *<[timp]>);
+	time_t timegm(struct tm *<[timp]>);
 
 DESCRIPTION
 <<mktime>> assumes the time at <[timp]> is a local time, and converts
@@ -31,15 +34,19 @@ its representation from the traditional representation defined by
 
 <<localtime>> is the inverse of <<mktime>>.
 
+<<timegm>> does the same for a time in UTC, the inverse of
+<<gmtime>>.  It neither reads the time zone nor takes its lock, and
+sets <<tm_isdst>> to 0.
+
 RETURNS
 If the contents of the structure at <[timp]> do not form a valid
 calendar time representation, the result is <<-1>>.  Otherwise, the
 result is the time, converted to a <<time_t>> value.
 
 PORTABILITY
-ANSI C requires <<mktime>>.
+ANSI C requires <<mktime>>.  <<timegm>> is a BSD and GNU extension.
 
-<<mktime>> requires no supporting OS subroutines.
+<<mktime>> and <<timegm>> require no supporting OS subroutines.
 */
 
 #include <stdlib.h>
@@ -61,6 +68,62 @@ static const int _DAYS_BEFORE_MONTH[12] =
 #define _ISLEAP(y) (((y) % 4) == 0 && (((y) % 100) != 0 || (((y)+1900) % 400) == 0))
 #define _DAYS_IN_YEAR(year) (_ISLEAP(year) ? 366 : 365)
 
+/* The Gregorian calendar repeats every 400 years of 146097 days.  */
+#define _DAYS_IN_400_YEARS 146097L
+
+#ifdef _USE_UNSIGNED_TIME_T
+/* An unsigned time_t holds 49710 days and a bit from the epoch.  The
+   arithmetic on it wraps, so the days are checked to be in range, or
+   a day before it for zones west of Greenwich, and a time the zone
+   offset took out of range is told by where it landed: one from the
+   first days wraps to the top of the range, one from the last days
+   to its bottom, each far from the times of the other days.  */
+#define DAYS_MIN	-1L
+#define DAYS_MAX	49710L
+#define WRAPPED(tim, days) \
+  ((days) < 24000L ? (tim) >= 0x80000000UL : (tim) < 0x40000000UL)
+#endif
+
+/* The days from 1970-01-01 to day MDAY, which may be out of the range
+   of the month, of month MON (0 to 11) of YEAR, counted from 1900.
+   The years are taken to start in March, which puts the leap day at
+   the end of one, so that the count is closed form.  */
+static long
+days_from_civil (int year,
+	int mon,
+	long mday)
+{
+  long y = (long) year + YEAR_BASE - (mon < 2);
+  long era = (y >= 0 ? y : y - 399) / 400;
+  int yoe = (int) (y - era * 400);
+  int doy = (153 * (mon < 2 ? mon + 10 : mon - 2) + 2) / 5;
+
+  return era * _DAYS_IN_400_YEARS + (long) yoe * 365 + yoe / 4 - yoe / 100
+	 + doy + mday - 1 - 719468L;
+}
+
+/* The inverse of days_from_civil, for an MDAY in range.  */
+static void
+civil_from_days (long days,
+	int *year,
+	int *mon,
+	int *mday)
+{
+  long era, doe;
+  int yoe, doy, mp;
+
+  days += 719468L;
+  era = (days >= 0 ? days : days - (_DAYS_IN_400_YEARS - 1))
+	/ _DAYS_IN_400_YEARS;
+  doe = days - era * _DAYS_IN_400_YEARS;
+  yoe = (int) ((doe - doe / 1460 + doe / 36524 - doe / 146096) / 365);
+  doy = (int) (doe - ((long) yoe * 365 + yoe / 4 - yoe / 100));
+  mp = (5 * doy + 2) / 153;
+  *mday = doy - (153 * mp + 2) / 5 + 1;
+  *mon = mp < 10 ? mp + 2 : mp - 10;
+  *year = (int) (era * 400 + yoe - YEAR_BASE) + (*mon < 2);
+}
+
 static void 
 validate_structure (struct tm *tim_p)
 {
@@ -115,78 +178,68 @@ validate_structure (struct tm *tim_p)
   if (_DAYS_IN_YEAR (tim_p->tm_year) == 366)
     days_in_feb = 29;
 
-  if (tim_p->tm_mday <= 0)
+  if (tim_p->tm_mday <= 0 || tim_p->tm_mday > _DAYS_IN_MONTH (tim_p->tm_mon))
     {
-      while (tim_p->tm_mday <= 0)
-	{
-	  if (--tim_p->tm_mon == -1)
-	    {
-	      tim_p->tm_year--;
-	      tim_p->tm_mon = 11;
-	      days_in_feb =
-		((_DAYS_IN_YEAR (tim_p->tm_year) == 366) ?
-		 29 : 28);
-	    }
-	  tim_p->tm_mday += _DAYS_IN_MONTH (tim_p->tm_mon);
-	}
-    }
-  else
-    {
-      while (tim_p->tm_mday > _DAYS_IN_MONTH (tim_p->tm_mon))
-	{
-	  tim_p->tm_mday -= _DAYS_IN_MONTH (tim_p->tm_mon);
-	  if (++tim_p->tm_mon == 12)
-	    {
-	      tim_p->tm_year++;
-	      tim_p->tm_mon = 0;
-	      days_in_feb =
-		((_DAYS_IN_YEAR (tim_p->tm_year) == 366) ?
-		 29 : 28);
-	    }
-	}
+      /* Count the days from a year of the same place in the 400 year
+	 cycle, after 1900, so that the count cannot overflow, and add
+	 the whole cycles of tm_mday and the year back afterwards.  */
+      int base = tim_p->tm_year % 400, year, mon, mday;
+      long cycles = tim_p->tm_mday / _DAYS_IN_400_YEARS;
+
+      if (base < 0)
+	base += 400;
+      civil_from_days (days_from_civil (base, tim_p->tm_mon,
+					tim_p->tm_mday
+					- cycles * _DAYS_IN_400_YEARS),
+		       &year, &mon, &mday);
+      tim_p->tm_year += year - base + (int) cycles * 400;
+      tim_p->tm_mon = mon;
+      tim_p->tm_mday = mday;
     }
 }
 
+/* Normalize *TIM_P as mktime does, set its tm_yday, and store in *DAYS
+   the days from the epoch to its date.  Returns -1 if the year is out
+   of range, else 0.  */
+static int
+tm_days (struct tm *tim_p,
+	long *days)
+{
+  /* validate structure */
+  validate_structure (tim_p);
+
+  /* compute day of the year */
+  tim_p->tm_yday = tim_p->tm_mday - 1 + _DAYS_BEFORE_MONTH[tim_p->tm_mon];
+  if (tim_p->tm_mon > 1 && _DAYS_IN_YEAR (tim_p->tm_year) == 366)
+    tim_p->tm_yday++;
+
+  if (tim_p->tm_year > 10000 || tim_p->tm_year < -10000)
+    return -1;
+
+  *days = days_from_civil (tim_p->tm_year, tim_p->tm_mon, tim_p->tm_mday);
+#ifdef _USE_UNSIGNED_TIME_T
+  if (*days < DAYS_MIN || *days > DAYS_MAX)
+    return -1;
+#endif
+  return 0;
+}
+
 time_t 
 mktime (struct tm *tim_p)
 {
   time_t tim = 0;
-  long days = 0;
+  long days;
   int year, isdst=0;
   __tzinfo_type *tz = __gettzinfo ();
 
-  /* validate structure */
-  validate_structure (tim_p);
+  if (tm_days (tim_p, &days))
+    return (time_t) -1;
+  year = tim_p->tm_year;
 
   /* compute hours, minutes, seconds */
   tim += tim_p->tm_sec + (tim_p->tm_min * _SEC_IN_MINUTE) +
     (tim_p->tm_hour * _SEC_IN_HOUR);
 
-  /* compute days in year */
-  days += tim_p->tm_mday - 1;
-  days += _DAYS_BEFORE_MONTH[tim_p->tm_mon];
-  if (tim_p->tm_mon > 1 && _DAYS_IN_YEAR (tim_p->tm_year) == 366)
-    days++;
-
-  /* compute day of the year */
-  tim_p->tm_yday = days;
-
-  if (tim_p->tm_year > 10000 || tim_p->tm_year < -10000)
-      return (time_t) -1;
-
-  /* compute days in other years */
-  if ((year = tim_p->tm_year) > 70)
-    {
-      for (year = 70; year < tim_p->tm_year; year++)
-	days += _DAYS_IN_YEAR (year);
-    }
-  else if (year < 70)
-    {
-      for (year = 69; year > tim_p->tm_year; year--)
-	days -= _DAYS_IN_YEAR (year);
-      days -= _DAYS_IN_YEAR (year);
-    }
-
   /* compute total seconds */
   tim += (time_t)days * _SEC_IN_DAY;
 
@@ -271,6 +324,11 @@ mktime (struct tm *tim_p)
 
   TZ_UNLOCK;
 
+#ifdef _USE_UNSIGNED_TIME_T
+  if (WRAPPED (tim, days))
+    return (time_t) -1;
+#endif
+
   /* reset isdst flag to what we have calculated */
   tim_p->tm_isdst = isdst;
 
@@ -280,3 +338,24 @@ mktime (struct tm *tim_p)
 	
   return tim;
 }
+
+time_t
+timegm (struct tm *tim_p)
+{
+  time_t tim;
+  long days;
+
+  if (tm_days (tim_p, &days))
+    return (time_t) -1;
+
+  tim = tim_p->tm_sec + (tim_p->tm_min * _SEC_IN_MINUTE) +
+    (tim_p->tm_hour * _SEC_IN_HOUR) + (time_t)days * _SEC_IN_DAY;
+#ifdef _USE_UNSIGNED_TIME_T
+  if (WRAPPED (tim, days))
+    return (time_t) -1;
+#endif
+  tim_p->tm_isdst = 0;
+  if ((tim_p->tm_wday = (days + 4) % 7) < 0)
+    tim_p->tm_wday += 7;
+  return tim;
+}
@@ -8,7 +8,7 @@
 
 #include "local.h"
 
-const int __month_lengths[2][MONSPERYEAR] = {
+const int __month_lengths[2][MONSPERYEAR] _PSV_CONST = {
   {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
   {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}
 } ;
@@ -0,0 +1,263 @@
+/*
+FUNCTION
+<<strftime_plan_compile>>, <<strftime_plan>>---format times with a precompiled strftime format
+
+INDEX
+	strftime_plan_compile
+INDEX
+	strftime_plan
+
+SYNOPSIS
+	#include <time.h>
+	int strftime_plan_compile(struct strftime_plan *<[plan]>,
+				  const char *<[format]>);
+	size_t strftime_plan(char *restrict <[s]>, size_t <[maxsize]>,
+			     const struct strftime_plan *restrict <[plan]>,
+			     const struct tm *restrict <[timp]>);
+
+DESCRIPTION
+<<strftime_plan_compile>> reads the <<strftime>> format <[format]>
+once and stores in *<[plan]> what <<strftime_plan>> then writes for
+each time, without parsing the format again, looking at the locale or
+calling <<snprintf>>.  This suits a timestamp rendered over and over,
+such as the head of each line of a log.
+
+Compiled are text, <<%%>>, and the numeric conversions <<%Y>>,
+<<%y>>, <<%m>>, <<%d>>, <<%e>>, <<%H>>, <<%M>>, <<%S>>, <<%j>>,
+<<%F>>, <<%T>>, <<%D>> and <<%R>>, without flags, widths or the
+<<E>> and <<O>> modifiers, with up to 32 conversions and runs of
+text and 32 bytes of text in all.  Any other format is kept as it is
+and <<strftime_plan>> passes it to <<strftime>>; it does the same for
+a year outside 1000 to 9999 and for fields out of the range of their
+digits.  Either way the result
+is that of <<strftime>> (<[s]>, <[maxsize]>, <[format]>, <[timp]>).
+
+<[format]> is not copied: it must stay valid as long as <[plan]> is
+used.
+
+RETURNS
+<<strftime_plan_compile>> returns 0 when it compiled the whole format,
+and -1 when <<strftime_plan>> will call <<strftime>>.
+
+<<strftime_plan>> returns what <<strftime>> would.
+
+PORTABILITY
+These functions are newlib extensions.
+
+No supporting OS subroutines are required.
+*/
+
+#include <_ansi.h>
+#include <string.h>
+#include <time.h>
+#include "local.h"
+
+#define PLAN_FIELD	0x80	/* op is PLAN_FIELD | conversion letter */
+#define PLAN_TEXT_MAX	0x7f	/* otherwise the length of a text run */
+
+#if !defined (__OPTIMIZE_SIZE__) && !defined (PREFER_SIZE_OVER_SPEED)
+static const char digit_pairs[200] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+#endif
+
+/* The two digits of V, 0 to 99.  */
+static __inline__ char *
+put2 (char *d,
+	unsigned int v)
+{
+#if !defined (__OPTIMIZE_SIZE__) && !defined (PREFER_SIZE_OVER_SPEED)
+  d[0] = digit_pairs[2 * v];
+  d[1] = digit_pairs[2 * v + 1];
+#else
+  d[0] = '0' + v / 10;
+  d[1] = '0' + v % 10;
+#endif
+  return d + 2;
+}
+
+struct plan_state
+{
+  unsigned int nop, ntext, len;
+};
+
+static int
+add_text (struct strftime_plan *plan,
+	struct plan_state *st,
+	char c)
+{
+  if (st->ntext == _STRFTIME_PLAN_MAX || st->len == 255)
+    return -1;
+  if (st->nop > 0 && plan->__op[st->nop - 1] < PLAN_TEXT_MAX)
+    ++plan->__op[st->nop - 1];
+  else if (st->nop < _STRFTIME_PLAN_MAX)
+    plan->__op[st->nop++] = 1;
+  else
+    return -1;
+  plan->__text[st->ntext++] = c;
+  ++st->len;
+  return 0;
+}
+
+static int
+add_format (struct strftime_plan *plan,
+	struct plan_state *st,
+	const char *f)
+{
+  unsigned int width;
+
+  while (*f)
+    {
+      if (*f != '%')
+	{
+	  if (add_text (plan, st, *f++) < 0)
+	    return -1;
+	  continue;
+	}
+      switch (*++f)
+	{
+	case '%':
+	  if (add_text (plan, st, '%') < 0)
+	    return -1;
+	  ++f;
+	  continue;
+	case 'F':
+	  if (add_format (plan, st, "%Y-%m-%d") < 0)
+	    return -1;
+	  ++f;
+	  continue;
+	case 'T':
+	  if (add_format (plan, st, "%H:%M:%S") < 0)
+	    return -1;
+	  ++f;
+	  continue;
+	case 'D':
+	  if (add_format (plan, st, "%m/%d/%y") < 0)
+	    return -1;
+	  ++f;
+	  continue;
+	case 'R':
+	  if (add_format (plan, st, "%H:%M") < 0)
+	    return -1;
+	  ++f;
+	  continue;
+	case 'Y':
+	  width = 4;
+	  break;
+	case 'j':
+	  width = 3;
+	  break;
+	case 'y':
+	case 'm':
+	case 'd':
+	case 'e':
+	case 'H':
+	case 'M':
+	case 'S':
+	  width = 2;
+	  break;
+	default:
+	  return -1;
+	}
+      if (st->nop == _STRFTIME_PLAN_MAX || st->len + width > 255)
+	return -1;
+      plan->__op[st->nop++] = PLAN_FIELD | *f++;
+      st->len += width;
+    }
+  return 0;
+}
+
+int
+strftime_plan_compile (struct strftime_plan *__restrict plan,
+	const char *__restrict format)
+{
+  struct plan_state st = { 0, 0, 0 };
+
+  plan->__fmt = format;
+  plan->__fast = add_format (plan, &st, format) == 0;
+  plan->__op[plan->__fast ? st.nop : 0] = 0;
+  plan->__len = st.len;
+  return plan->__fast ? 0 : -1;
+}
+
+size_t
+strftime_plan (char *__restrict s,
+	size_t maxsize,
+	const struct strftime_plan *__restrict plan,
+	const struct tm *__restrict tim_p)
+{
+  const unsigned char *op;
+  const char *text = plan->__text;
+  /* unsigned, so years below 0 also fail the range checks */
+  const unsigned int year = (unsigned) tim_p->tm_year + YEAR_BASE;
+  unsigned int v;
+  char *d = s;
+
+  if (!plan->__fast || plan->__len >= maxsize)
+    return strftime (s, maxsize, plan->__fmt, tim_p);
+
+  for (op = plan->__op; *op; ++op)
+    {
+      if (*op < PLAN_FIELD)
+	{
+	  memcpy (d, text, *op);
+	  d += *op;
+	  text += *op;
+	  continue;
+	}
+      switch (*op & ~PLAN_FIELD)
+	{
+	case 'Y':
+	  if (year - 1000 > 8999)
+	    goto slow;
+	  d = put2 (put2 (d, year / 100), year % 100);
+	  continue;
+	case 'y':
+	  if (year - 1000 > 8999)
+	    goto slow;
+	  v = year % 100;
+	  break;
+	case 'j':
+	  v = (unsigned) tim_p->tm_yday + 1;
+	  if (v > 999)
+	    goto slow;
+	  *d++ = '0' + v / 100;
+	  v %= 100;
+	  break;
+	case 'm':
+	  v = (unsigned) tim_p->tm_mon + 1;
+	  break;
+	case 'd':
+	case 'e':
+	  v = tim_p->tm_mday;
+	  break;
+	case 'H':
+	  v = tim_p->tm_hour;
+	  break;
+	case 'M':
+	  v = tim_p->tm_min;
+	  break;
+	default: /* 'S' */
+	  v = tim_p->tm_sec;
+	  break;
+	}
+      if (v > 99)
+	goto slow;
+      if (v < 10 && *op == (PLAN_FIELD | 'e'))
+	{
+	  d[0] = ' ';
+	  d[1] = '0' + v;
+	  d += 2;
+	}
+      else
+	d = put2 (d, v);
+    }
+  *d = '\0';
+  return d - s;
+
+slow:
+  return strftime (s, maxsize, plan->__fmt, tim_p);
+}
@@ -92,11 +92,13 @@ match_string (const char *__restrict *buf, const char * const*strs,
 static int
 first_day (int year)
 {
-    int ret = 4;
-
-    while (--year >= 1970)
-	ret = (ret + 365 + is_leap_year (year)) % 7;
-    return ret;
+    /* 1970-01-01 was a Thursday, and each year moves the day on by
+       one, two for a leap year.  Years before 1970 count as 1970.  */
+    if (year <= 1970)
+	return 4;
+    --year;
+    return (4 + (year - 1969) + (year / 4 - year / 100 + year / 400)
+	    - (1969 / 4 - 1969 / 100 + 1969 / 400)) % 7;
 }
 
 /*
@@ -153,15 +155,115 @@ set_week_number_mon4 (struct tm *timeptr, int wnum)
     }
 }
 
+/*
+ * The fields of the fixed numeric formats: %Y, %m, %d, %H, %M and %S
+ */
+#define FIXED_FIELDS 6
+
+static const unsigned char fixed_width[FIXED_FIELDS] = { 4, 2, 2, 2, 2, 2 };
+
+/*
+ * Fast path of strptime for formats made only of %Y, %m, %d, %e, %H,
+ * %k, %M, %S, %F, %T and %R and of text other than white space, such
+ * as "%Y-%m-%dT%H:%M:%S": each number is read from its digits where it
+ * stands, without strtol, the locale or a recursive call.  Returns the
+ * end of the input, or NULL to leave `buf' to the general loop, both
+ * for any other format and for input the widths of the fields do not
+ * describe.  As each number must be followed by a non-digit, it ends
+ * where strtol would stop, so the result is that of the loop.
+ */
+static const char *
+fixed_numeric (const char *buf, const char *format, struct tm *timeptr,
+	       int *ymd, locale_t locale)
+{
+    const char *resume = NULL;
+    int val[FIXED_FIELDS];
+    int set = 0, i, k, n;
+    char c;
+
+    for (;;) {
+	c = *format++;
+	if (c == '\0') {
+	    if (resume == NULL)
+		break;
+	    format = resume;
+	    resume = NULL;
+	    continue;
+	}
+	if (c != '%') {
+	    if (isspace_l ((unsigned char) c, locale) || *buf != c)
+		return NULL;
+	    ++buf;
+	    continue;
+	}
+	switch (c = *format++) {
+	case 'F' :
+	case 'T' :
+	case 'R' :
+	    if (resume != NULL)
+		return NULL;
+	    resume = format;
+	    format = c == 'F' ? "%Y-%m-%d" : c == 'T' ? "%H:%M:%S" : "%H:%M";
+	    continue;
+	case 'Y' : i = 0; break;
+	case 'm' : i = 1; break;
+	case 'd' :
+	case 'e' : i = 2; break;
+	case 'H' :
+	case 'k' : i = 3; break;
+	case 'M' : i = 4; break;
+	case 'S' : i = 5; break;
+	default :
+	    return NULL;
+	}
+	for (n = 0, k = 0; k < fixed_width[i]; ++k) {
+	    if ((unsigned) (buf[k] - '0') > 9)
+		return NULL;
+	    n = n * 10 + (buf[k] - '0');
+	}
+	if ((unsigned) (buf[k] - '0') <= 9)
+	    return NULL;
+	buf += k;
+	val[i] = n;
+	set |= 1 << i;
+    }
+
+    if (set & 1) {
+	timeptr->tm_year = val[0] - tm_year_base;
+	*ymd |= SET_YEAR;
+    }
+    if (set & 2) {
+	timeptr->tm_mon = val[1] - 1;
+	*ymd |= SET_MON;
+    }
+    if (set & 4) {
+	timeptr->tm_mday = val[2];
+	*ymd |= SET_MDAY;
+    }
+    if (set & 8)
+	timeptr->tm_hour = val[3];
+    if (set & 16)
+	timeptr->tm_min = val[4];
+    if (set & 32)
+	timeptr->tm_sec = val[5];
+    return buf;
+}
+
 char *
 strptime_l (const char *buf, const char *format, struct tm *timeptr,
 	    locale_t locale)
 {
     char c;
     int ymd = 0;
+    const char *end;
 
     const struct lc_time_T *_CurrentTimeLocale = __get_time_locale (locale);
+    if ((end = fixed_numeric (buf, format, timeptr, &ymd, locale)) != NULL) {
+	buf = end;
+	goto fill;
+    }
     for (; (c = *format) != '\0'; ++format) {
+
 	char *s;
 	int ret;
 
@@ -448,6 +550,7 @@ strptime_l (const char *buf, const char *format, struct tm *timeptr,
 	}
     }
 
+fill:
     if ((ymd & SET_YMD) == SET_YMD) {
 	/* all of tm_year, tm_mon and tm_mday, but... */
 
@@ -10,24 +10,67 @@
 
 #include "local.h"
 
+/* The change-over times of the last few years looked up, so that
+   times spread over several years, as when replaying a log, do not
+   redo the rule arithmetic on every call.  Direct mapped on the year;
+   an entry with year 0 is empty.  _tzset_unlocked_r flushes them when
+   the rules change, under the same lock as every lookup.  */
+#define TZCACHE_SIZE	8
+
+static struct tzcache_entry
+{
+  int year;
+  time_t change[2];
+} tzcache[TZCACHE_SIZE];
+
+void
+__tzcalc_flush (void)
+{
+  int i;
+
+  for (i = 0; i < TZCACHE_SIZE; ++i)
+    tzcache[i].year = 0;
+}
+
 int
 __tzcalc_limits (int year)
 {
-  int days, year_days, years;
+  long days, year_days;
+  int years, leaps, yleap;
+  unsigned jan1_wday;
   int i, j;
   __tzinfo_type *const tz = __gettzinfo ();
+  struct tzcache_entry *ce;
 
   if (year < EPOCH_YEAR)
     return 0;
+#ifdef _USE_UNSIGNED_TIME_T
+  /* An unsigned time_t ends in February 2106, before any change-over
+     of that year.  */
+  if (year > 2105)
+    return 0;
+#endif
 
   tz->__tzyear = year;
 
+  ce = &tzcache[year % TZCACHE_SIZE];
+  if (ce->year == year)
+    {
+      tz->__tzrule[0].change = ce->change[0];
+      tz->__tzrule[1].change = ce->change[1];
+      goto done;
+    }
+
   years = (year - EPOCH_YEAR);
+  yleap = isleap(year);
 
-  year_days = years * 365 +
-    (years - 1 + EPOCH_YEARS_SINCE_LEAP) / 4 -
+  leaps = (years - 1 + EPOCH_YEARS_SINCE_LEAP) / 4 -
     (years - 1 + EPOCH_YEARS_SINCE_CENTURY) / 100 +
     (years - 1 + EPOCH_YEARS_SINCE_LEAP_CENTURY) / 400;
+  /* long, as 16-bit ints run out in 2059; but 365 is 1 mod 7, so the
+     weekday of 1st January needs no long arithmetic */
+  year_days = years * 365L + leaps;
+  jan1_wday = (EPOCH_WDAY + (unsigned) years + leaps) % DAYSPERWEEK;
 
   for (i = 0; i < 2; ++i)
     {
@@ -35,7 +78,7 @@ __tzcalc_limits (int year)
 	{
 	  /* The Julian day n (1 <= n <= 365). */
 	  days = year_days + tz->__tzrule[i].d +
-	    (isleap(year) && tz->__tzrule[i].d >= 60);
+	    (yleap && tz->__tzrule[i].d >= 60);
 	  /* Convert to yday */
 	  --days;
 	}
@@ -43,16 +86,16 @@ __tzcalc_limits (int year)
 	days = year_days + tz->__tzrule[i].d;
       else
 	{
-	  const int yleap = isleap(year);
-	  int m_day, m_wday, wday_diff;
+	  int m_day, m_wday, wday_diff, yday;
 	  const int *const ip = __month_lengths[yleap];
 
-	  days = year_days;
+	  yday = 0;
 
 	  for (j = 1; j < tz->__tzrule[i].m; ++j)
-	    days += ip[j-1];
+	    yday += ip[j-1];
 
-	  m_wday = (EPOCH_WDAY + days) % DAYSPERWEEK;
+	  m_wday = (jan1_wday + yday) % DAYSPERWEEK;
+	  days = year_days + yday;
 
 	  wday_diff = tz->__tzrule[i].d - m_wday;
 	  if (wday_diff < 0)
@@ -70,6 +113,11 @@ __tzcalc_limits (int year)
       tz->__tzrule[i].s + tz->__tzrule[i].offset;
     }
 
+  ce->year = year;
+  ce->change[0] = tz->__tzrule[0].change;
+  ce->change[1] = tz->__tzrule[1].change;
+
+done:
   tz->__tznorth = (tz->__tzrule[0].change < tz->__tzrule[1].change);
 
   return 1;
@@ -36,6 +36,7 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
   if (prev_tzenv != NULL && strcmp(tzenv, prev_tzenv) == 0)
     return;
 
+  __tzcalc_flush ();
   free(prev_tzenv);
   prev_tzenv = _malloc_r (reent_ptr, strlen(tzenv) + 1);
   if (prev_tzenv != NULL)
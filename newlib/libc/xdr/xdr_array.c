@@ -46,6 +46,13 @@
 
 #include "xdr_private.h"
 
+#ifndef ntohl
+# define ntohl(x) xdr_ntohl(x)
+#endif
+#ifndef htonl
+# define htonl(x) xdr_htonl(x)
+#endif
+
 /*
  * XDR an array of arbitrary elements
  * *addrp is a pointer to the array, *sizep is the number of elements.
@@ -157,3 +164,78 @@ xdr_vector (XDR * xdrs,
     }
   return TRUE;
 }
+
+/*
+ * XDR fixed-size arrays of integers and floats, the same on the wire
+ * as xdr_vector with xdr_int16_t, xdr_int32_t or xdr_float.  When
+ * the stream hands out the whole array with XDR_INLINE, as an aligned
+ * memory stream does, it is converted in one loop with no call per
+ * element; otherwise the elements go through the stream one by one.
+ */
+static int32_t *
+xdr_bulk_inline (XDR * xdrs,
+	u_int nelem)
+{
+  if (nelem > UINT_MAX / sizeof (int32_t))
+    return NULL;
+  return XDR_INLINE (xdrs, nelem * sizeof (int32_t));
+}
+
+bool_t
+xdr_int32_array (XDR * xdrs,
+	int32_t * p,
+	u_int nelem)
+{
+  int32_t *buf;
+  u_int i;
+
+  if (xdrs->x_op == XDR_FREE)
+    return TRUE;
+  buf = xdr_bulk_inline (xdrs, nelem);
+  if (buf == NULL)
+    return xdr_vector (xdrs, (char *) p, nelem, sizeof (int32_t),
+                       (xdrproc_t) xdr_int32_t);
+  if (xdrs->x_op == XDR_ENCODE)
+    for (i = 0; i < nelem; i++)
+      IXDR_PUT_INT32 (buf, p[i]);
+  else
+    for (i = 0; i < nelem; i++)
+      p[i] = IXDR_GET_INT32 (buf);
+  return TRUE;
+}
+
+bool_t
+xdr_int16_array (XDR * xdrs,
+	int16_t * p,
+	u_int nelem)
+{
+  int32_t *buf;
+  u_int i;
+
+  if (xdrs->x_op == XDR_FREE)
+    return TRUE;
+  buf = xdr_bulk_inline (xdrs, nelem);
+  if (buf == NULL)
+    return xdr_vector (xdrs, (char *) p, nelem, sizeof (int16_t),
+                       (xdrproc_t) xdr_int16_t);
+  if (xdrs->x_op == XDR_ENCODE)
+    for (i = 0; i < nelem; i++)
+      IXDR_PUT_INT32 (buf, (int32_t) p[i]);
+  else
+    for (i = 0; i < nelem; i++)
+      p[i] = (int16_t) IXDR_GET_INT32 (buf);
+  return TRUE;
+}
+
+bool_t
+xdr_float_array (XDR * xdrs,
+	float *p,
+	u_int nelem)
+{
+#if defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)
+  if (sizeof (float) == sizeof (int32_t))
+    return xdr_int32_array (xdrs, (int32_t *) (void *) p, nelem);
+#endif
+  return xdr_vector (xdrs, (char *) p, nelem, sizeof (float),
+                     (xdrproc_t) xdr_float);
+}
@@ -61,6 +61,13 @@ _ELIDABLE_INLINE uint32_t xdr_ntohl (uint32_t x)
 {
 #if BYTE_ORDER == BIG_ENDIAN
   return x;
+#elif defined (__pic30__)
+  /* SWAP on each half, then exchange the halves */
+  unsigned int lo = (unsigned int) x, hi = (unsigned int) (x >> 16);
+
+  __asm__ ("swap\t%0" : "+r" (lo));
+  __asm__ ("swap\t%0" : "+r" (hi));
+  return (uint32_t) lo << 16 | hi;
 #elif BYTE_ORDER == LITTLE_ENDIAN
   u_char *s = (u_char *)&x;
   return (uint32_t)(s[0] << 24 | s[1] << 16 | s[2] << 8 | s[3]);
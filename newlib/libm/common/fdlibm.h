@@ -352,12 +352,24 @@ do {								\
 } while (0)
 
 /* A union which permits us to convert between a float and a 32 bit
-   int.  */
+   int, or two 16 bit ints.  The more significant of those holds the
+   sign, the exponent and the top seven bits of the fraction, so on a
+   16 bit target most tests of a float need only load that one.  */
 
 typedef union
 {
   float value;
   __uint32_t word;
+  struct
+  {
+#ifdef __IEEE_BIG_ENDIAN
+    __uint16_t msw;
+    __uint16_t lsw;
+#else
+    __uint16_t lsw;
+    __uint16_t msw;
+#endif
+  } parts16;
 } ieee_float_shape_type;
 
 /* Get a 32 bit int from a float.  */
@@ -378,6 +390,44 @@ do {								\
   (d) = sf_u.value;						\
 } while (0)
 
+/* Get the more significant 16 bits of a float.  */
+
+#define GET_FLOAT_HI16(i,d)					\
+do {								\
+  ieee_float_shape_type gfh_u;					\
+  gfh_u.value = (d);						\
+  (i) = gfh_u.parts16.msw;					\
+} while (0)
+
+/* Get the less significant 16 bits of a float.  */
+
+#define GET_FLOAT_LO16(i,d)					\
+do {								\
+  ieee_float_shape_type gfl_u;					\
+  gfl_u.value = (d);						\
+  (i) = gfl_u.parts16.lsw;					\
+} while (0)
+
+/* Set the more significant 16 bits of a float from an int.  */
+
+#define SET_FLOAT_HI16(d,v)					\
+do {								\
+  ieee_float_shape_type sfh_u;					\
+  sfh_u.value = (d);						\
+  sfh_u.parts16.msw = (v);					\
+  (d) = sfh_u.value;						\
+} while (0)
+
+/* Set a float from two 16 bit ints.  */
+
+#define INSERT_FLOAT_HALVES(d,hi,lo)				\
+do {								\
+  ieee_float_shape_type if_u;					\
+  if_u.parts16.msw = (hi);					\
+  if_u.parts16.lsw = (lo);					\
+  (d) = if_u.value;						\
+} while (0)
+
 /* Macros to avoid undefined behaviour that can arise if the amount
    of a shift is exactly equal to the size of the shifted operand.  */
 
@@ -33,7 +33,7 @@
 
 #define N (1 << LOG_TABLE_BITS)
 
-const struct log_data __log_data = {
+const struct log_data __log_data PSV_TABLE = {
 .ln2hi = 0x1.62e42fefa3800p-1,
 .ln2lo = 0x1.ef35793c76730p-45,
 .poly1 = {
@@ -268,6 +268,16 @@ eval_as_double (double x)
 # define HIDDEN
 #endif
 
+/* The lookup tables below are large next to the RAM of small parts.
+   On pic30 they are put in the auto_psv section of program memory and
+   read through the PSV window that the startup code maps onto it, so
+   they cost no RAM even with -mconst-in-data.  */
+#ifdef __dsPIC30__
+# define PSV_TABLE __attribute__ ((space (auto_psv)))
+#else
+# define PSV_TABLE
+#endif
+
 /* Error handling tail calls for special cases, with a sign argument.
    The sign of the return value is set if the argument is non-zero.  */
 
@@ -327,7 +337,7 @@ extern const struct exp2f_data
   double shift;
   double invln2_scaled;
   double poly_scaled[EXP2F_POLY_ORDER];
-} __exp2f_data HIDDEN;
+} __exp2f_data HIDDEN PSV_TABLE;
 
 #define LOGF_TABLE_BITS 4
 #define LOGF_POLY_ORDER 4
@@ -339,7 +349,7 @@ extern const struct logf_data
   } tab[1 << LOGF_TABLE_BITS];
   double ln2;
   double poly[LOGF_POLY_ORDER - 1]; /* First order coefficient is 1.  */
-} __logf_data HIDDEN;
+} __logf_data HIDDEN PSV_TABLE;
 
 #define LOG2F_TABLE_BITS 4
 #define LOG2F_POLY_ORDER 4
@@ -350,7 +360,7 @@ extern const struct log2f_data
     double invc, logc;
   } tab[1 << LOG2F_TABLE_BITS];
   double poly[LOG2F_POLY_ORDER];
-} __log2f_data HIDDEN;
+} __log2f_data HIDDEN PSV_TABLE;
 
 #define POWF_LOG2_TABLE_BITS 4
 #define POWF_LOG2_POLY_ORDER 5
@@ -367,7 +377,7 @@ extern const struct powf_log2_data
     double invc, logc;
   } tab[1 << POWF_LOG2_TABLE_BITS];
   double poly[POWF_LOG2_POLY_ORDER];
-} __powf_log2_data HIDDEN;
+} __powf_log2_data HIDDEN PSV_TABLE;
 
 #define EXP_TABLE_BITS 7
 #define EXP_POLY_ORDER 5
@@ -389,7 +399,7 @@ extern const struct exp_data
   double exp2_shift;
   double exp2_poly[EXP2_POLY_ORDER];
   uint64_t tab[2*(1 << EXP_TABLE_BITS)];
-} __exp_data HIDDEN;
+} __exp_data HIDDEN PSV_TABLE;
 
 #define LOG_TABLE_BITS 7
 #define LOG_POLY_ORDER 6
@@ -404,7 +414,7 @@ extern const struct log_data
 #if !HAVE_FAST_FMA
   struct {double chi, clo;} tab2[1 << LOG_TABLE_BITS];
 #endif
-} __log_data HIDDEN;
+} __log_data HIDDEN PSV_TABLE;
 
 #define LOG2_TABLE_BITS 6
 #define LOG2_POLY_ORDER 7
@@ -419,7 +429,7 @@ extern const struct log2_data
 #if !HAVE_FAST_FMA
   struct {double chi, clo;} tab2[1 << LOG2_TABLE_BITS];
 #endif
-} __log2_data HIDDEN;
+} __log2_data HIDDEN PSV_TABLE;
 
 #define POW_LOG_TABLE_BITS 7
 #define POW_LOG_POLY_ORDER 8
@@ -430,6 +440,6 @@ extern const struct pow_log_data
   double poly[POW_LOG_POLY_ORDER - 1]; /* First coefficient is 1.  */
   /* Note: the pad field is unused, but allows slightly faster indexing.  */
   struct {double invc, pad, logc, logctail;} tab[1 << POW_LOG_TABLE_BITS];
-} __pow_log_data HIDDEN;
+} __pow_log_data HIDDEN PSV_TABLE;
 
 #endif
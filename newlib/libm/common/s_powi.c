@@ -0,0 +1,49 @@
+/*
+FUNCTION
+	<<powi>>, <<powif>>---power to an integer exponent
+INDEX
+	powi
+INDEX
+	powif
+
+SYNOPSIS
+	#include <math.h>
+	double powi(double <[x]>, int <[n]>);
+	float powif(float <[x]>, int <[n]>);
+
+DESCRIPTION
+	<<powi>> and <<powif>> calculate <[x]> raised to the power <[n]>
+	by repeated squaring, with about log2 |<[n]>| multiplications and,
+	for a negative <[n]>, one division.  They are much faster than
+	<<pow>> and <<powf>>, at the price of accuracy: each step may add
+	half an ulp of rounding error, which the later squarings amplify.
+	<[x]>**0 is 1 for any <[x]>, NaN included.
+
+RETURNS
+	The calculated value, which is infinite or 0 when the result
+	overflows or underflows.  <<errno>> is not set.
+
+PORTABILITY
+	<<powi>> and <<powif>> are newlib extensions.
+*/
+
+#include "fdlibm.h"
+
+#ifndef _DOUBLE_IS_32BITS
+
+double
+powi (double x,
+	int n)
+{
+	unsigned int m = n < 0 ? -(unsigned int) n : (unsigned int) n;
+	double z = (m & 1) ? x : 1.0;
+
+	while ((m >>= 1) != 0) {
+	    x *= x;
+	    if (m & 1)
+		z *= x;
+	}
+	return n < 0 ? 1.0 / z : z;
+}
+
+#endif /* _DOUBLE_IS_32BITS */
@@ -28,10 +28,10 @@
 	float x,y;
 #endif
 {
-	__uint32_t ix,iy;
-	GET_FLOAT_WORD(ix,x);
-	GET_FLOAT_WORD(iy,y);
-	SET_FLOAT_WORD(x,(ix&0x7fffffff)|(iy&0x80000000));
+	__uint16_t hx,hy;
+	GET_FLOAT_HI16(hx,x);
+	GET_FLOAT_HI16(hy,y);
+	SET_FLOAT_HI16(x,(hx&0x7fff)|(hy&0x8000));
         return x;
 }
 
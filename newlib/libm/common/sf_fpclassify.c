@@ -9,21 +9,19 @@
 int
 __fpclassifyf (float x)
 {
-  __uint32_t w;
+  __uint16_t hi, lo, e;
 
-  GET_FLOAT_WORD(w,x);
-  
-  if (w == 0x00000000 || w == 0x80000000)
-    return FP_ZERO;
-  else if ((w >= 0x00800000 && w <= 0x7f7fffff) ||
-           (w >= 0x80800000 && w <= 0xff7fffff))
+  /* The exponent is in the high half, so a normal number is told
+     without looking at the low one.  */
+  GET_FLOAT_HI16(hi,x);
+  e = hi & 0x7f80;
+  if (e != 0 && e != 0x7f80)
     return FP_NORMAL;
-  else if ((w >= 0x00000001 && w <= 0x007fffff) ||
-           (w >= 0x80000001 && w <= 0x807fffff))
-    return FP_SUBNORMAL;
-  else if (w == 0x7f800000 || w == 0xff800000)
-    return FP_INFINITE;
+
+  GET_FLOAT_LO16(lo,x);
+  if (((hi & 0x007f) | lo) == 0)
+    return e == 0 ? FP_ZERO : FP_INFINITE;
   else
-    return FP_NAN;
+    return e == 0 ? FP_SUBNORMAL : FP_NAN;
 }
 
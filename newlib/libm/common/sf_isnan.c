@@ -26,7 +26,11 @@
 int
 isnanf (float x)
 {
+	__uint16_t hx;
 	__int32_t ix;
+	GET_FLOAT_HI16(hx,x);
+	if ((hx & 0x7f80) != 0x7f80)
+		return 0;	/* any NaN has the largest exponent */
 	GET_FLOAT_WORD(ix,x);
 	ix &= 0x7fffffff;
 	return FLT_UWORD_IS_NAN(ix);
@@ -31,7 +31,7 @@
 
 #include "math_config.h"
 
-const struct powf_log2_data __powf_log2_data = {
+const struct powf_log2_data __powf_log2_data PSV_TABLE = {
   .tab = {
   { 0x1.661ec79f8f3bep+0, -0x1.efec65b963019p-2 * POWF_SCALE },
   { 0x1.571ed4aaf883dp+0, -0x1.b0b6832d4fca4p-2 * POWF_SCALE },
@@ -0,0 +1,29 @@
+/* sf_powi.c -- float version of s_powi.c.  */
+
+#include "fdlibm.h"
+
+float
+powif (float x,
+	int n)
+{
+	unsigned int m = n < 0 ? -(unsigned int) n : (unsigned int) n;
+	float z = (m & 1) ? x : 1.0f;
+
+	while ((m >>= 1) != 0) {
+	    x *= x;
+	    if (m & 1)
+		z *= x;
+	}
+	return n < 0 ? 1.0f / z : z;
+}
+
+#ifdef _DOUBLE_IS_32BITS
+
+double
+powi (double x,
+	int n)
+{
+	return (double) powif ((float) x, n);
+}
+
+#endif /* defined(_DOUBLE_IS_32BITS) */
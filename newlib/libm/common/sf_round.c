@@ -19,33 +19,53 @@
 #endif
 {
   __uint32_t w;
-  /* Most significant word, least significant word. */
+  __uint16_t hi, lo, mask;
   int exponent_less_127;
 
-  GET_FLOAT_WORD(w, x);
+  GET_FLOAT_HI16(hi, x);
 
   /* Extract exponent field. */
-  exponent_less_127 = (int)((w & 0x7f800000) >> 23) - 127;
+  exponent_less_127 = ((hi & 0x7f80) >> 7) - 127;
 
-  if (exponent_less_127 < 23)
+  if (exponent_less_127 < 7)
     {
+      /* |x| < 128, so the integer part and the half to round with
+         are in the high 16 bits. */
+      GET_FLOAT_LO16(lo, x);
       if (exponent_less_127 < 0)
         {
-          w &= 0x80000000;
+          hi &= 0x8000;
           if (exponent_less_127 == -1)
             /* Result is +1.0 or -1.0. */
-            w |= ((__uint32_t)127 << 23);
+            hi |= 0x3f80;
         }
       else
         {
-          unsigned int exponent_mask = 0x007fffff >> exponent_less_127;
-          if ((w & exponent_mask) == 0)
+          mask = 0x007f >> exponent_less_127;
+          if (((hi & mask) | lo) == 0)
             /* x has an integral value. */
             return x;
 
-          w += 0x00400000 >> exponent_less_127;
-          w &= ~exponent_mask;
+          hi += 0x0040 >> exponent_less_127;
+          hi &= ~mask;
         }
+      INSERT_FLOAT_HALVES(x, hi, 0);
+      return x;
+    }
+
+  /* From 128 up the rounding can carry from the low half into the
+     high, so use the whole word. */
+  GET_FLOAT_WORD(w, x);
+
+  if (exponent_less_127 < 23)
+    {
+      __uint32_t exponent_mask = 0x007fffff >> exponent_less_127;
+      if ((w & exponent_mask) == 0)
+        /* x has an integral value. */
+        return x;
+
+      w += 0x00400000 >> exponent_less_127;
+      w &= ~exponent_mask;
     }
   else
     {
@@ -18,26 +18,33 @@
 	float x;
 #endif
 {
-  __int32_t signbit, w, exponent_less_127;
+  __uint16_t hi, lo;
+  int exponent_less_127;
 
-  GET_FLOAT_WORD(w,x);
-
-  /* Extract sign bit. */
-  signbit = w & 0x80000000;
+  /* Only the high half holds the sign and exponent, and no carry
+     ever crosses between the halves, so each is masked on its own. */
+  GET_FLOAT_HI16(hi,x);
 
   /* Extract exponent field. */
-  exponent_less_127 = ((w & 0x7f800000) >> 23) - 127;
+  exponent_less_127 = ((hi & 0x7f80) >> 7) - 127;
 
   if (exponent_less_127 < 23)
     {
       if (exponent_less_127 < 0)
         {
           /* -1 < x < 1, so result is +0 or -0. */
-          SET_FLOAT_WORD(x, signbit);
+          INSERT_FLOAT_HALVES(x, hi & 0x8000, 0);
+        }
+      else if (exponent_less_127 < 7)
+        {
+          /* The low half is all fraction. */
+          INSERT_FLOAT_HALVES(x, hi & ~(0x007f >> exponent_less_127), 0);
         }
       else
         {
-          SET_FLOAT_WORD(x, signbit | (w & ~(0x007fffff >> exponent_less_127)));
+          GET_FLOAT_LO16(lo,x);
+          INSERT_FLOAT_HALVES(x, hi,
+                              lo & ~(0xffff >> (exponent_less_127 - 7)));
         }
     }
   else
@@ -46,10 +46,10 @@ typedef struct
 } sincos_t;
 
 /* Polynomial data (the cosine polynomial is negated in the 2nd entry).  */
-extern const sincos_t __sincosf_table[2] HIDDEN;
+extern const sincos_t __sincosf_table[2] HIDDEN PSV_TABLE;
 
 /* Table with 4/PI to 192 bit precision.  */
-extern const uint32_t __inv_pio4[] HIDDEN;
+extern const uint32_t __inv_pio4[] HIDDEN PSV_TABLE;
 
 /* Top 12 bits of the float representation with the sign bit cleared.  */
 static inline uint32_t
@@ -0,0 +1,55 @@
+/* Assembler helpers for the pic30 libm machine directory.  */
+
+#ifndef _PIC30_ASM_H
+#define _PIC30_ASM_H
+
+#ifndef __USER_LABEL_PREFIX__
+#define __USER_LABEL_PREFIX__ _
+#endif
+
+#define CONCAT1(a, b) CONCAT2(a, b)
+#define CONCAT2(a, b) a##b
+
+#define SYM(x) CONCAT1(__USER_LABEL_PREFIX__, x)
+
+/* ';' starts a comment for the pic30 assembler, so anything longer
+   than one statement is a gas macro rather than a cpp one.  */
+
+	.macro	func_start name
+	.text
+	.global	\name
+	.type	\name, @function
+\name:
+	.endm
+
+/* Start a global function in .text.  */
+#define FUNC_START(name) func_start SYM(name)
+
+#define FUNC_END(name)	\
+	.size	SYM(name), . - SYM(name)
+
+/* CORCON set-up for the DSP kernels: signed fractional multiplies,
+   saturation on both accumulators and on data space writes.  The
+   PSV/SFA and IPL3 bits are preserved; the DO level bits are
+   read-only.  DSP_MODE_Q15 adds 9.31 super-saturation so that sums
+   may overflow 1.0 on the way as long as the result fits.
+   DSP_MODE_Q31 saturates at 1.31 so ACCxH:ACCxL is a valid Q31.  */
+#define CORCON_KEEP	0x000c
+#define DSP_MODE_Q15	0x00f0
+#define DSP_MODE_Q31	0x00e0
+
+/* Save CORCON on the stack and switch to MODE, using scratch
+   register W.  Must be paired with DSP_LEAVE.  */
+	.macro	dsp_enter mode, w
+	push	CORCON
+	mov	CORCON, \w
+	and	#CORCON_KEEP, \w
+	ior	#\mode, \w
+	mov	\w, CORCON
+	.endm
+
+#define DSP_ENTER(mode, w) dsp_enter mode, w
+
+#define DSP_LEAVE	pop	CORCON
+
+#endif /* _PIC30_ASM_H */
@@ -0,0 +1,20 @@
+/* cabsf for pic30, without the hypotf wrapper.  */
+
+#include <complex.h>
+#include "fdlibm.h"
+
+float
+cabsf (float complex z)
+{
+  return __ieee754_hypotf (crealf (z), cimagf (z));
+}
+
+#ifdef _DOUBLE_IS_32BITS
+
+double
+cabs (double complex z)
+{
+  return (double) cabsf ((float complex) z);
+}
+
+#endif /* defined(_DOUBLE_IS_32BITS) */
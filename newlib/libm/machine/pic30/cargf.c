@@ -0,0 +1,20 @@
+/* cargf for pic30, without the atan2f wrapper.  */
+
+#include <complex.h>
+#include "fdlibm.h"
+
+float
+cargf (float complex z)
+{
+  return __ieee754_atan2f (cimagf (z), crealf (z));
+}
+
+#ifdef _DOUBLE_IS_32BITS
+
+double
+carg (double complex z)
+{
+  return (double) cargf ((float complex) z);
+}
+
+#endif /* defined(_DOUBLE_IS_32BITS) */
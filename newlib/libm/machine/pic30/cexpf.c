@@ -0,0 +1,37 @@
+/* cexpf for pic30: expf and one sincosf, all in float.  */
+
+#define _GNU_SOURCE	/* for sincosf */
+
+#include <complex.h>
+#include "fdlibm.h"
+
+float complex
+cexpf (float complex z)
+{
+  float complex w;
+  float r, s, c, y;
+
+  r = __ieee754_expf (crealf (z));
+  y = cimagf (z);
+  if (y == 0)
+    {
+      /* Real z: keep the sign of the zero and skip the sincos.  */
+      __real__ w = r;
+      __imag__ w = y;
+      return w;
+    }
+  sincosf (y, &s, &c);
+  __real__ w = r * c;
+  __imag__ w = r * s;
+  return w;
+}
+
+#ifdef _DOUBLE_IS_32BITS
+
+double complex
+cexp (double complex z)
+{
+  return (double complex) cexpf ((float complex) z);
+}
+
+#endif /* defined(_DOUBLE_IS_32BITS) */
@@ -0,0 +1,95 @@
+/* Circular buffers of Q15 samples, see <machine/dsp.h>.
+
+   The copies take at most two memcpy calls, one on each side of the
+   wrap; memcpy already moves them with a REPEAT.  The dot product uses
+   the modulo addressing of __circ_dot_mod (circ_dot.S) when the part
+   and the buffer allow it.  */
+
+#include <string.h>
+#include <machine/dsp.h>
+
+#ifdef __HAS_DSP__
+q15_t	__circ_dot_mod (const q15_t *, const q15_t *, unsigned int,
+			const q15_t *, const char *);
+#endif
+
+/* Index of the oldest of the N newest samples.  */
+static unsigned int
+oldest (const circbuf_t *c, unsigned int n)
+{
+  return c->pos >= n ? c->pos - n : c->pos + c->len - n;
+}
+
+void
+circ_init (circbuf_t *c, q15_t *buf, unsigned int len)
+{
+  c->buf = buf;
+  c->len = len;
+  c->pos = 0;
+  memset (buf, 0, len * sizeof *buf);
+}
+
+void
+circ_memcpy_in (circbuf_t *c, const q15_t *src, unsigned int n)
+{
+  unsigned int part;
+
+  if (n > c->len)
+    {
+      src += n - c->len;
+      n = c->len;
+    }
+  part = c->len - c->pos;
+  if (part > n)
+    part = n;
+  memcpy (c->buf + c->pos, src, part * sizeof *src);
+  memcpy (c->buf, src + part, (n - part) * sizeof *src);
+  c->pos += n;
+  if (c->pos >= c->len)
+    c->pos -= c->len;
+}
+
+void
+circ_memcpy_out (q15_t *dst, const circbuf_t *c, unsigned int n)
+{
+  unsigned int start = oldest (c, n);
+  unsigned int part = c->len - start;
+
+  if (part > n)
+    part = n;
+  memcpy (dst, c->buf + start, part * sizeof *dst);
+  memcpy (dst + part, c->buf, (n - part) * sizeof *dst);
+}
+
+q15_t
+circ_dot_q15 (const circbuf_t *c, const q15_t *h, unsigned int n)
+{
+  unsigned int start = oldest (c, n);
+  unsigned int part = c->len - start;
+  long long acc;
+
+#ifdef __HAS_DSP__
+  {
+    unsigned int size = c->len * sizeof *c->buf, align;
+
+    for (align = 2; align < size; align <<= 1)
+      ;
+    if (((unsigned int) c->buf & (align - 1)) == 0)
+      return __circ_dot_mod (c->buf + start, h, n, c->buf,
+			     (const char *) (c->buf + c->len) - 1);
+  }
+#endif
+  if (part >= n)
+    return q15_dot (c->buf + start, h, n);
+
+  /* Sum the two Q31 halves as the accumulator would, saturated to
+     Q31, and round to Q15 as SAC.R does.  */
+  acc = (long long) q15_dot_q31 (c->buf + start, h, part)
+	+ q15_dot_q31 (c->buf, h + part, n - part);
+  if (acc > 0x7fffffffLL)
+    acc = 0x7fffffffLL;
+  else if (acc < -0x7fffffffLL - 1)
+    acc = -0x7fffffffLL - 1;
+  acc = (acc + 0x8000) >> 16;
+  return acc > 32767 ? 32767 : (q15_t) acc;
+}
@@ -0,0 +1,16 @@
+/* cmulf for pic30, see <machine/fastmath.h>.  */
+
+#include <complex.h>
+#include <machine/fastmath.h>
+
+float complex
+cmulf (float complex a,
+	float complex b)
+{
+  float complex w;
+  float ar = crealf (a), ai = cimagf (a), br = crealf (b), bi = cimagf (b);
+
+  __real__ w = ar * br - ai * bi;
+  __imag__ w = ar * bi + ai * br;
+  return w;
+}
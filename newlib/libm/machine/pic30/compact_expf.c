@@ -0,0 +1,52 @@
+/* __compact_expf for pic30, see <machine/fastmath.h>.  */
+
+#include "fdlibm.h"
+#include "compact_local.h"
+
+static const float
+LN2HI = 6.9314575195e-01f,	/* 0x3f317200, n * LN2HI is exact */
+LN2LO = 1.4286067653e-06f,	/* 0x35bfbe8e */
+INVLN2 = 1.4426950216e+00f,	/* 0x3fb8aa3b */
+TWOM100 = 7.8886090522e-31f;	/* 0x0d800000 */
+
+/* exp (x) = 2^n exp (r), |r| <= ln 2 / 2.  Adding 1.5 * 2^23 rounds
+   x / ln 2 to the integer n and leaves it in the low bits of the
+   word.  exp (r) is 1 + r + r^2 P (r), so there is no division.  */
+float
+__compact_expf (float x)
+{
+  float t, r;
+  __int32_t hx, ix, n;
+
+  GET_FLOAT_WORD (hx, x);
+  ix = hx & 0x7fffffff;
+  if (FLT_UWORD_IS_NAN (ix))
+    return x + x;
+  if (FLT_UWORD_IS_INFINITE (ix))
+    return hx < 0 ? 0.0f : x;
+  if (hx > FLT_UWORD_LOG_MAX)
+    return __math_oflowf (0);
+  if (hx < 0 && ix > FLT_UWORD_LOG_MIN)
+    return __math_uflowf (0);
+  if (ix < 0x31800000)			/* |x| < 2^-28 */
+    return 1.0f + x;
+
+  t = x * INVLN2 + 12582912.0f;
+  GET_FLOAT_WORD (n, t);
+  n -= 0x4b400000;
+  t -= 12582912.0f;
+  r = (x - t * LN2HI) - t * LN2LO;
+  t = 1.0f + (r + r * r * EXPM1_TAIL (r));
+  GET_FLOAT_WORD (hx, t);
+  if (n >= -125)
+    {
+      SET_FLOAT_WORD (t, hx + (n << 23));
+      return t;
+    }
+  SET_FLOAT_WORD (t, hx + ((n + 100) << 23));
+  return t * TWOM100;
+}
+
+#ifdef LIBM_COMPACT
+float __ieee754_expf (float) __attribute__ ((__alias__ ("__compact_expf")));
+#endif
@@ -0,0 +1,61 @@
+/* Shared by the pic30 __compact_logf and __compact_powf, see
+   <machine/fastmath.h>.  Included after fdlibm.h.  */
+
+#ifndef _COMPACT_LOCAL_H_
+#define _COMPACT_LOCAL_H_
+
+#define SQRT1_2_WORD	0x3f3504f3
+
+/* Minimax fit of (log1p (f) - f + f^2 / 2) / f^3 on [sqrt(1/2) - 1,
+   sqrt(2) - 1], error 2^-27 relative to log1p (f).  */
+#define LOG1P_TAIL(f) \
+  (3.33333317e-01f + (f) * (-2.50008210e-01f + (f) * (2.00012269e-01f \
+   + (f) * (-1.66233573e-01f + (f) * (1.42017580e-01f \
+   + (f) * (-1.31601824e-01f + (f) * (1.27615771e-01f \
+   + (f) * -7.63449664e-02f)))))))
+
+/* Minimax fit of (exp (r) - 1 - r) / r^2 on [-ln 2 / 2, ln 2 / 2],
+   error 2^-28 relative to exp (r).  */
+#define EXPM1_TAIL(r) \
+  (4.99999940e-01f + (r) * (1.66665211e-01f + (r) * (4.16683890e-02f \
+   + (r) * (8.36870957e-03f + (r) * 1.38146128e-03f))))
+
+/* log2 (x) = k + log2 (1 + f) with 1 + f in [sqrt(1/2), sqrt(2)), for
+   the word IX of a positive float, whose exponent may be negative for
+   a subnormal scaled up.  Taking the bits of sqrt(1/2) off the word
+   before splitting it rounds k to the nearest; f is exact.  */
+static __inline__ float
+__compact_logsplit (__uint32_t ix,
+	int *k)
+{
+  float m;
+
+  ix -= SQRT1_2_WORD;
+  *k = (int) ((__int32_t) ix >> 23);
+  SET_FLOAT_WORD (m, (ix & 0x7fffff) + SQRT1_2_WORD);
+  return m - 1.0f;
+}
+
+/* K as a float, -2^22 <= K < 2^22, without __floatsisf.  */
+static __inline__ float
+__compact_itof (int k)
+{
+  float f;
+
+  SET_FLOAT_WORD (f, 0x4b400000 + (__int32_t) k);
+  return f - 12582912.0f;
+}
+
+/* X with the low 12 bits of its mantissa cleared, so that the product
+   of two such numbers is exact.  */
+static __inline__ float
+__compact_split (float x)
+{
+  __uint32_t w;
+
+  GET_FLOAT_WORD (w, x);
+  SET_FLOAT_WORD (x, w & 0xfffff000);
+  return x;
+}
+
+#endif /* _COMPACT_LOCAL_H_ */
@@ -0,0 +1,44 @@
+/* __compact_logf for pic30, see <machine/fastmath.h>.  */
+
+#include "fdlibm.h"
+#include "compact_local.h"
+
+static const float
+LN2HI = 6.9314575195e-01f,	/* 0x3f317200, k * LN2HI is exact */
+LN2LO = 1.4286067653e-06f,	/* 0x35bfbe8e */
+TWO25 = 3.3554432000e+07f,	/* 0x4c000000 */
+zero = 0.0f;
+
+/* log (x) = k ln 2 + log1p (f), summed as fdlibm does, with log1p (f)
+   a polynomial in f rather than in f / (2 + f): no division.  */
+float
+__compact_logf (float x)
+{
+  float f, hfsq, dk;
+  __int32_t ix;
+  int k, k0 = 0;
+
+  GET_FLOAT_WORD (ix, x);
+  if (FLT_UWORD_IS_ZERO (ix & 0x7fffffff))
+    return -TWO25 / zero;		/* log(+-0)=-inf */
+  if (ix < 0)
+    return (x - x) / zero;		/* log(-#) = NaN */
+  if (!FLT_UWORD_IS_FINITE (ix))
+    return x + x;
+  if (FLT_UWORD_IS_SUBNORMAL (ix))
+    {
+      k0 = -25;
+      x *= TWO25;
+      GET_FLOAT_WORD (ix, x);
+    }
+
+  f = __compact_logsplit (ix, &k);
+  dk = __compact_itof (k + k0);
+  hfsq = 0.5f * f * f;
+  return dk * LN2HI - ((hfsq - (f * f * f * LOG1P_TAIL (f) + dk * LN2LO))
+		       - f);
+}
+
+#ifdef LIBM_COMPACT
+float __ieee754_logf (float) __attribute__ ((__alias__ ("__compact_logf")));
+#endif
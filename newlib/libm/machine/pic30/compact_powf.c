@@ -0,0 +1,162 @@
+/* __compact_powf for pic30, see <machine/fastmath.h>.  */
+
+#include "fdlibm.h"
+#include "compact_local.h"
+
+static const float
+IH = 1.4423828125e+00f,		/* 0x3fb8a000, 1 / ln 2 to 11 bits */
+IL = 3.1222839607e-04f,		/* 0x39a3b296, the rest of it */
+INVLN2 = 1.4426950216e+00f,	/* 0x3fb8aa3b */
+LN2H = 6.9311523438e-01f,	/* 0x3f317000, ln 2 to 12 bits */
+LN2L = 3.1946183299e-05f,	/* 0x3805fdf4 */
+TWOM100 = 7.8886090522e-31f;	/* 0x0d800000 */
+
+/* 0 if IY is not an integer, 1 if it is odd, 2 if it is even.  */
+static int
+checkint (__uint32_t iy)
+{
+  int e = (iy >> 23) & 0xff;
+
+  if (e < 0x7f)
+    return 0;
+  if (e > 0x7f + 23)
+    return 2;
+  if (iy & (((__uint32_t) 1 << (0x7f + 23 - e)) - 1))
+    return 0;
+  if (iy & ((__uint32_t) 1 << (0x7f + 23 - e)))
+    return 1;
+  return 2;
+}
+
+/* Whether 2 * IX, shifting the sign out, is that of 0, an infinity
+   or a NaN.  */
+#define ZEROINFNAN(ix)	(2 * (ix) - 1 >= 2 * (__uint32_t) 0x7f800000 - 1)
+
+/* x^y = 2^(y log2 (x)).  log2 (x) is accurate to beyond float, kept as
+   the sum of two floats: the terms that matter are formed from halves
+   of 12 bits, whose products are exact.  y log2 (x) is then split the
+   same way, as Dekker's product, so that 2^n can be taken off
+   exactly, leaving 2^r for |r| <= 1/2.  No division and no table.  */
+float
+__compact_powf (float x,
+	float y)
+{
+  float f, fh, q, s, t, hi, lo, yh, sh, ph, pl, r;
+  __uint32_t ix, iy, w, sign = 0;
+  __int32_t n;
+  int k;
+
+  GET_FLOAT_WORD (ix, x);
+  GET_FLOAT_WORD (iy, y);
+  if (iy == 0x40000000)			/* y is 2 */
+    return x * x;
+
+  if (ix - 0x00800000 >= 0x7f800000 - 0x00800000 || ZEROINFNAN (iy))
+    {
+      /* x is negative, subnormal, 0, an infinity or a NaN, or y is 0,
+	 an infinity or a NaN.  */
+      if (ZEROINFNAN (iy))
+	{
+	  if (2 * iy == 0)
+	    return issignalingf_inline (x) ? x + y : 1.0f;
+	  if (ix == 0x3f800000)
+	    return issignalingf_inline (y) ? x + y : 1.0f;
+	  if (2 * ix > 2 * (__uint32_t) 0x7f800000
+	      || 2 * iy > 2 * (__uint32_t) 0x7f800000)
+	    return x + y;
+	  if (2 * ix == 2 * (__uint32_t) 0x3f800000)
+	    return 1.0f;		/* (-1)^+-inf */
+	  if ((2 * ix < 2 * (__uint32_t) 0x3f800000) == !(iy & 0x80000000))
+	    return 0.0f;		/* |x| < 1, y = inf or |x| > 1, -inf */
+	  return y * y;
+	}
+      if (ZEROINFNAN (ix))
+	{
+	  t = x * x;
+	  if ((ix & 0x80000000) && checkint (iy) == 1)
+	    t = -t;
+	  return (iy & 0x80000000) ? 1.0f / t : t;
+	}
+      if (ix & 0x80000000)
+	{
+	  switch (checkint (iy))
+	    {
+	    case 0:
+	      return __math_invalidf (x);
+	    case 1:
+	      sign = 0x80000000;
+	      break;
+	    }
+	  ix &= 0x7fffffff;
+	}
+      if (ix < 0x00800000)
+	{
+	  /* Normalize a subnormal x; its exponent goes negative.  */
+	  SET_FLOAT_WORD (t, ix);
+	  GET_FLOAT_WORD (ix, t * 8388608.0f);
+	  ix -= (__uint32_t) 23 << 23;
+	}
+    }
+
+  /* log1p (f) = (s + q) + f^3 P (f), where s + q is f - f^2 / 2 to
+     twice float: fh^2 is exact and f - fh^2 / 2 is summed exactly.  */
+  f = __compact_logsplit (ix, &k);
+  fh = __compact_split (f);
+  t = 0.5f * fh * fh;
+  s = f - t;
+  q = ((f - s) - t) - 0.5f * (f - fh) * (f + fh);
+  q += f * f * f * LOG1P_TAIL (f);
+
+  /* log2 (x) = k + (s + q) / ln 2 = hi + lo.  */
+  sh = __compact_split (s);
+  t = sh * IH;
+  lo = (s - sh) * IH + s * IL + q * INVLN2;
+  r = __compact_itof (k);
+  hi = r + t;
+  lo += (r - hi) + t;
+  t = hi + lo;
+  lo -= t - hi;
+  hi = t;
+
+  /* y log2 (x) = ph + pl.  */
+  ph = y * hi;
+  if (!(ph < 128.5f))
+    return __math_oflowf (sign);
+  if (!(ph > -150.5f))
+    return __math_uflowf (sign);
+  yh = __compact_split (y);
+  sh = __compact_split (hi);
+  pl = (((yh * sh - ph) + yh * (hi - sh)) + (y - yh) * sh)
+       + (y - yh) * (hi - sh) + y * lo;
+
+  /* 2^(ph + pl) = 2^n 2^r.  */
+  t = ph + 12582912.0f;
+  GET_FLOAT_WORD (n, t);
+  n -= 0x4b400000;
+  r = (ph - (t - 12582912.0f)) + pl;
+
+  /* 2^r = exp (zh + zl), zh = rh LN2H exact, as in __compact_expf.  */
+  sh = __compact_split (r);
+  hi = sh * LN2H;
+  lo = (r - sh) * LN2H + r * LN2L;
+  r = hi + lo;
+  t = 1.0f + (hi + (lo + r * r * EXPM1_TAIL (r)));
+  GET_FLOAT_WORD (w, t);
+  if ((__int32_t) (w >> 23) + n >= 0xff)
+    return __math_oflowf (sign);
+  if ((__int32_t) (w >> 23) + n <= 0)
+    {
+      SET_FLOAT_WORD (t, w + ((__uint32_t) (n + 100) << 23));
+      t *= TWOM100;
+    }
+  else
+    SET_FLOAT_WORD (t, w + ((__uint32_t) n << 23));
+  GET_FLOAT_WORD (w, t);
+  SET_FLOAT_WORD (t, w | sign);
+  return t;
+}
+
+#ifdef LIBM_COMPACT
+float __ieee754_powf (float, float)
+  __attribute__ ((__alias__ ("__compact_powf")));
+#endif
@@ -0,0 +1,92 @@
+/* The CORDIC engine for pic30, see cordic_local.h.  Each iteration
+   is two shifts, three additions and a table read.  */
+
+#include "cordic_local.h"
+
+/* atan (2^-i), 2^31 being pi.  */
+static const __int32_t cordic_atan[CORDIC_ITERS]
+  __attribute__ ((space (auto_psv))) =
+{
+  536870912L, 316933406L, 167458907L, 85004756L, 42667331L, 21354465L,
+  10679838L, 5340245L, 2670163L, 1335087L, 667544L, 333772L, 166886L,
+  83443L, 41722L, 20861L
+};
+
+/* 2^30 / K.  */
+#define INV_K_Q30	652032874L
+
+__uint32_t
+__cordic_vector (__int32_t x,
+	__int32_t y,
+	__int32_t *mag)
+{
+  __uint32_t z = 0;
+  __int32_t t;
+  unsigned int i;
+
+  if (x == 0 && y == 0)
+    {
+      *mag = 0;
+      return 0;
+    }
+  /* The iterations turn through at most 99.9 degrees either way, so
+     start from the right half-plane.  */
+  if (x < 0)
+    {
+      x = -x;
+      y = -y;
+      z = 0x80000000UL;
+    }
+  for (i = 0; i < CORDIC_ITERS; i++)
+    {
+      t = x;
+      if (y > 0)
+	{
+	  x += y >> i;
+	  y -= t >> i;
+	  z += cordic_atan[i];
+	}
+      else
+	{
+	  x -= y >> i;
+	  y += t >> i;
+	  z -= cordic_atan[i];
+	}
+    }
+  *mag = x;
+  return z;
+}
+
+void
+__cordic_rotate (__uint32_t z,
+	__int32_t *c,
+	__int32_t *s)
+{
+  __int32_t x = INV_K_Q30, y = 0, t;
+  unsigned int i;
+
+  /* Past a quarter turn, rotate -1 by the rest of the half turn.  */
+  if (((z + 0x40000000UL) & 0x80000000UL) != 0)
+    {
+      z += 0x80000000UL;
+      x = -x;
+    }
+  for (i = 0; i < CORDIC_ITERS; i++)
+    {
+      t = x;
+      if ((__int32_t) z >= 0)
+	{
+	  x -= y >> i;
+	  y += t >> i;
+	  z -= cordic_atan[i];
+	}
+      else
+	{
+	  x += y >> i;
+	  y -= t >> i;
+	  z += cordic_atan[i];
+	}
+    }
+  *c = x;
+  *s = y;
+}
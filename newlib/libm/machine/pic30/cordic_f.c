@@ -0,0 +1,76 @@
+/* cordic_polarf and cordic_sincosf for pic30, see
+   <machine/fastmath.h>.  */
+
+#include <machine/fastmath.h>
+#include "fdlibm.h"
+#include "cordic_local.h"
+
+static const float
+INV_K = 6.0725293e-01f,
+PI_2_31 = 1.4629181e-09f,	/* pi / 2^31 */
+TWO30_PI = 3.4178264e+08f,	/* 2^30 / pi */
+TWO_M30 = 9.3132257e-10f,	/* 2^-30 */
+PI = 3.1415927410e+00f,		/* 0x40490fdb */
+TWO_PI = 6.2831854820e+00f,	/* 0x40c90fdb */
+INV_TWO_PI = 1.5915493667e-01f;	/* 0x3e22f983 */
+
+/* The biased exponent of the float with word W, 1 for a subnormal.  */
+static int
+cordic_exp (__int32_t w)
+{
+  int e = (w >> 23) & 0xff;
+
+  return e != 0 ? e : 1;
+}
+
+/* The float with word W times 2^(155 - E), E being at least its
+   exponent, so that the leading bit is at 2^28 when they are equal.  */
+static __int32_t
+cordic_fixed (__int32_t w,
+	int e)
+{
+  int d = e - cordic_exp (w);
+  __int32_t m = w & 0x007fffff;
+
+  if ((w & 0x7f800000) != 0)
+    m |= 0x00800000;
+  m = d < 29 ? (m << 5) >> d : 0;
+  return w < 0 ? -m : m;
+}
+
+/* Both inputs are put on the exponent of the larger, so the whole
+   loop runs in integers; x = y = 0 gives 0 and 0.  */
+float
+cordic_polarf (float y,
+	float x,
+	float *r)
+{
+  __int32_t wx, wy, m;
+  __uint32_t z;
+  int ex, ey;
+
+  GET_FLOAT_WORD (wx, x);
+  GET_FLOAT_WORD (wy, y);
+  ex = cordic_exp (wx);
+  ey = cordic_exp (wy);
+  if (ey > ex)
+    ex = ey;
+  z = __cordic_vector (cordic_fixed (wx, ex), cordic_fixed (wy, ex), &m);
+  *r = scalbnf ((float) m * INV_K, ex - 155);
+  return (float) (__int32_t) z * PI_2_31;
+}
+
+void
+cordic_sincosf (float a,
+	float *s,
+	float *c)
+{
+  __int32_t ci, si;
+
+  if (fabsf (a) > PI)
+    a -= TWO_PI * rintf (a * INV_TWO_PI);
+  /* Halve the angle so that pi itself still fits.  */
+  __cordic_rotate ((__uint32_t) (__int32_t) (a * TWO30_PI) << 1, &ci, &si);
+  *c = (float) ci * TWO_M30;
+  *s = (float) si * TWO_M30;
+}
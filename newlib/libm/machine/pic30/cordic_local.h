@@ -0,0 +1,23 @@
+/* The CORDIC engine behind cordic_polarf and cordic_sincosf, see
+   <machine/fastmath.h>, and their Q15 versions in <machine/dsp.h>.
+   Angles are binary, a full turn being 2^32, so that they wrap as
+   unsigned arithmetic does.  */
+
+#ifndef _CORDIC_LOCAL_H_
+#define _CORDIC_LOCAL_H_
+
+#include <sys/types.h>
+
+#define CORDIC_ITERS	16
+
+/* 2^16 / K, K = 1.6467602... being the gain of the iterations.  */
+#define CORDIC_INV_K_Q16	39797L
+
+/* The angle of (X, Y), storing K times its magnitude in *MAG.  |X|
+   and |Y| must be below 2^29; (0, 0) gives 0.  */
+__uint32_t	__cordic_vector (__int32_t, __int32_t, __int32_t *);
+
+/* 2^30 times the cosine and sine of an angle.  */
+void	__cordic_rotate (__uint32_t, __int32_t *, __int32_t *);
+
+#endif /* _CORDIC_LOCAL_H_ */
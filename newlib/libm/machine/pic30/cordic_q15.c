@@ -0,0 +1,41 @@
+/* cordic_polar_q15 and cordic_sincos_q15 for pic30, see
+   <machine/dsp.h>.  */
+
+#include <machine/dsp.h>
+#include "cordic_local.h"
+
+/* 2^-15 times V, rounded and saturated.  */
+static q15_t
+cordic_q15 (__int32_t v)
+{
+  v = (v + 0x4000) >> 15;
+  return v > 0x7fff ? 0x7fff : v < -0x8000 ? -0x8000 : v;
+}
+
+/* The inputs go in at 2^14 times their integer value, clear of the
+   2^29 that __cordic_vector allows.  */
+q15_t
+cordic_polar_q15 (q15_t y,
+	q15_t x,
+	q15_t *r)
+{
+  __int32_t m;
+  __uint32_t z, u;
+
+  z = __cordic_vector (x * 16384L, y * 16384L, &m);
+  u = (((__uint32_t) m >> 14) * CORDIC_INV_K_Q16 + 0x8000) >> 16;
+  *r = u > 0x7fff ? 0x7fff : u;
+  return (__int16_t) ((z + 0x8000) >> 16);
+}
+
+void
+cordic_sincos_q15 (q15_t a,
+	q15_t *s,
+	q15_t *c)
+{
+  __int32_t ci, si;
+
+  __cordic_rotate ((__uint32_t) (__int32_t) a << 16, &ci, &si);
+  *c = cordic_q15 (ci);
+  *s = cordic_q15 (si);
+}
@@ -0,0 +1,11 @@
+/* cpolarf for pic30, see <machine/fastmath.h>.  */
+
+#include <complex.h>
+#include <machine/fastmath.h>
+
+float
+cpolarf (float complex z,
+	float *r)
+{
+  return cordic_polarf (cimagf (z), crealf (z), r);
+}
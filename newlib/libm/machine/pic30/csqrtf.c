@@ -0,0 +1,80 @@
+/* csqrtf for pic30: the method of libm/complex/csqrtf.c, calling
+   __ieee754_sqrtf and __ieee754_hypotf directly rather than through
+   the sqrtf and cabsf wrappers.  */
+
+#include <complex.h>
+#include "fdlibm.h"
+
+float complex
+csqrtf (float complex z)
+{
+  float complex w;
+  float x, y, r, t, scale;
+
+  x = crealf (z);
+  y = cimagf (z);
+
+  if (y == 0)
+    {
+      if (x < 0)
+	{
+	  __real__ w = 0;
+	  __imag__ w = __ieee754_sqrtf (-x);
+	}
+      else
+	{
+	  __real__ w = x == 0 ? 0 : __ieee754_sqrtf (x);
+	  __imag__ w = y;
+	}
+      return w;
+    }
+
+  if (x == 0)
+    {
+      r = __ieee754_sqrtf (0.5f * fabsf (y));
+      __real__ w = r;
+      __imag__ w = y > 0 ? r : -r;
+      return w;
+    }
+
+  /* Rescale to avoid internal overflow or underflow.  */
+  if (fabsf (x) > 4.0f || fabsf (y) > 4.0f)
+    {
+      x *= 0.25f;
+      y *= 0.25f;
+      scale = 2.0f;
+    }
+  else
+    {
+      x *= 6.7108864e7f;	/* 2^26 */
+      y *= 6.7108864e7f;
+      scale = 1.220703125e-4f;	/* 2^-13 */
+    }
+  r = __ieee754_hypotf (x, y);
+  if (x > 0)
+    {
+      t = __ieee754_sqrtf (0.5f * r + 0.5f * x);
+      r = scale * fabsf ((0.5f * y) / t);
+      t *= scale;
+    }
+  else
+    {
+      r = __ieee754_sqrtf (0.5f * r - 0.5f * x);
+      t = scale * fabsf ((0.5f * y) / r);
+      r *= scale;
+    }
+
+  __real__ w = t;
+  __imag__ w = y < 0 ? -r : r;
+  return w;
+}
+
+#ifdef _DOUBLE_IS_32BITS
+
+double complex
+csqrt (double complex z)
+{
+  return (double complex) csqrtf ((float complex) z);
+}
+
+#endif /* defined(_DOUBLE_IS_32BITS) */
@@ -0,0 +1,6 @@
+/* __ieee754_expf for pic30: the fdlibm code, unless newlib is built
+   with LIBM_COMPACT, when compact_expf.c provides it.  */
+
+#ifndef LIBM_COMPACT
+#include "../../math/ef_exp.c"
+#endif
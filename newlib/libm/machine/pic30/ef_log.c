@@ -0,0 +1,6 @@
+/* __ieee754_logf for pic30: the fdlibm code, unless newlib is built
+   with LIBM_COMPACT, when compact_logf.c provides it.  */
+
+#ifndef LIBM_COMPACT
+#include "../../math/ef_log.c"
+#endif
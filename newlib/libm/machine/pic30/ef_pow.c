@@ -0,0 +1,6 @@
+/* __ieee754_powf for pic30: the fdlibm code, unless newlib is built
+   with LIBM_COMPACT, when compact_powf.c provides it.  */
+
+#ifndef LIBM_COMPACT
+#include "../../math/ef_pow.c"
+#endif
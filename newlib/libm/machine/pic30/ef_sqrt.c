@@ -0,0 +1,49 @@
+/* __ieee754_sqrtf for pic30: a table seed and two Newton steps in
+   32-bit integers, then an exact remainder to round correctly.  */
+
+#include "fdlibm.h"
+#include "sqrt_local.h"
+
+float
+__ieee754_sqrtf (float x)
+{
+  __uint32_t a, q, m;
+  __int32_t ix, hx, r;
+  int e;
+
+  GET_FLOAT_WORD (ix, x);
+  hx = ix & 0x7fffffff;
+  if (!FLT_UWORD_IS_FINITE (hx))
+    return x * x + x;			/* sqrt(NaN)=NaN, sqrt(+inf)=+inf
+					   sqrt(-inf)=sNaN */
+  if (FLT_UWORD_IS_ZERO (hx))
+    return x;				/* sqrt(+-0) = +-0 */
+  if (ix < 0)
+    return (x - x) / (x - x);		/* sqrt(-ve) = sNaN */
+
+  a = __sqrt_split (ix, &e);
+  /* sqrt (a) in Q24, within a few units of the exact root.  */
+  q = (__sqrt_mulhi (a, __sqrt_recip (a)) + 32) >> 6;
+
+  /* With q that close, a * 2^48 - q^2 is small enough to take mod
+     2^32; a * 2^48 is a << 16.  Step to the root rounded down, then
+     round it to nearest; it is never exactly halfway.  */
+  m = a << 16;
+  r = (__int32_t) (m - q * q);
+  while (r < 0)
+    {
+      q--;
+      r += 2 * q + 1;
+    }
+  while ((__uint32_t) r > 2 * q)
+    {
+      r -= 2 * q + 1;
+      q++;
+    }
+  if ((__uint32_t) r > q)
+    q++;
+
+  /* q carries into the exponent if it rounded up to 2^24.  */
+  SET_FLOAT_WORD (x, q + ((__int32_t) (e + 125) << 23));
+  return x;
+}
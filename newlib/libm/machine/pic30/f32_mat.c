@@ -0,0 +1,169 @@
+/* Float matrix kernels for pic30, see <machine/matrix.h>.
+
+   Each element of a product is summed in a local and stored once
+   instead of being accumulated through C, which the compiler would
+   have to reload around every soft-float call.  The fixed sizes are
+   unrolled outright, so their indices are constants and there is no
+   loop to run.  */
+
+#include <machine/matrix.h>
+
+void
+f32_mat_mul (float *c,
+	const float *a,
+	const float *b,
+	unsigned int m,
+	unsigned int n,
+	unsigned int p)
+{
+  const float *ak, *bk;
+  unsigned int i, j, k;
+  float s;
+
+  for (i = 0; i < m; i++, a += n)
+    for (j = 0; j < p; j++)
+      {
+	s = 0;
+	for (k = n, ak = a, bk = b + j; k != 0; k--, bk += p)
+	  s += *ak++ * *bk;
+	*c++ = s;
+      }
+}
+
+/* Row I of A times column J of B, for N x N matrices.  */
+#define DOT2(i, j) \
+  (a[2 * (i)] * b[(j)] + a[2 * (i) + 1] * b[2 + (j)])
+#define DOT3(i, j) \
+  (a[3 * (i)] * b[(j)] + a[3 * (i) + 1] * b[3 + (j)] \
+   + a[3 * (i) + 2] * b[6 + (j)])
+#define DOT4(i, j) \
+  (a[4 * (i)] * b[(j)] + a[4 * (i) + 1] * b[4 + (j)] \
+   + a[4 * (i) + 2] * b[8 + (j)] + a[4 * (i) + 3] * b[12 + (j)])
+
+void
+f32_mat2_mul (float *c,
+	const float *a,
+	const float *b)
+{
+  c[0] = DOT2 (0, 0);
+  c[1] = DOT2 (0, 1);
+  c[2] = DOT2 (1, 0);
+  c[3] = DOT2 (1, 1);
+}
+
+void
+f32_mat3_mul (float *c,
+	const float *a,
+	const float *b)
+{
+  c[0] = DOT3 (0, 0);
+  c[1] = DOT3 (0, 1);
+  c[2] = DOT3 (0, 2);
+  c[3] = DOT3 (1, 0);
+  c[4] = DOT3 (1, 1);
+  c[5] = DOT3 (1, 2);
+  c[6] = DOT3 (2, 0);
+  c[7] = DOT3 (2, 1);
+  c[8] = DOT3 (2, 2);
+}
+
+void
+f32_mat4_mul (float *c,
+	const float *a,
+	const float *b)
+{
+  unsigned int i;
+
+  /* A row at a time keeps the code to a quarter of the full unroll.  */
+  for (i = 0; i < 4; i++, a += 4, c += 4)
+    {
+      c[0] = DOT4 (0, 0);
+      c[1] = DOT4 (0, 1);
+      c[2] = DOT4 (0, 2);
+      c[3] = DOT4 (0, 3);
+    }
+}
+
+void
+f32_mat_trans (float *d,
+	const float *s,
+	unsigned int m,
+	unsigned int n)
+{
+  unsigned int i, j;
+
+  for (i = 0; i < m; i++, d++)
+    for (j = 0; j < n; j++)
+      d[j * m] = *s++;
+}
+
+void
+f32_mat_add (float *d,
+	const float *a,
+	const float *b,
+	unsigned int n)
+{
+  while (n-- != 0)
+    *d++ = *a++ + *b++;
+}
+
+void
+f32_mat_sub (float *d,
+	const float *a,
+	const float *b,
+	unsigned int n)
+{
+  while (n-- != 0)
+    *d++ = *a++ - *b++;
+}
+
+void
+f32_mat_scale (float *d,
+	const float *a,
+	float k,
+	unsigned int n)
+{
+  while (n-- != 0)
+    *d++ = *a++ * k;
+}
+
+/* The cofactors of the first row, which the determinant and the
+   first column of the inverse share.  */
+#define COF0	(a[4] * a[8] - a[5] * a[7])
+#define COF1	(a[5] * a[6] - a[3] * a[8])
+#define COF2	(a[3] * a[7] - a[4] * a[6])
+
+float
+f32_mat3_det (const float *a)
+{
+  return a[0] * COF0 + a[1] * COF1 + a[2] * COF2;
+}
+
+int
+f32_mat3_inv (float *d,
+	const float *a)
+{
+  float c0 = COF0, c1 = COF1, c2 = COF2;
+  float det = a[0] * c0 + a[1] * c1 + a[2] * c2;
+  float r, t[6];
+
+  if (det == 0)
+    return -1;
+  r = 1 / det;
+  t[0] = (a[2] * a[7] - a[1] * a[8]) * r;
+  t[1] = (a[1] * a[5] - a[2] * a[4]) * r;
+  t[2] = (a[0] * a[8] - a[2] * a[6]) * r;
+  t[3] = (a[2] * a[3] - a[0] * a[5]) * r;
+  t[4] = (a[1] * a[6] - a[0] * a[7]) * r;
+  t[5] = (a[0] * a[4] - a[1] * a[3]) * r;
+  d[0] = c0 * r;
+  d[1] = t[0];
+  d[2] = t[1];
+  d[3] = c1 * r;
+  d[4] = t[2];
+  d[5] = t[3];
+  d[6] = c2 * r;
+  d[7] = t[4];
+  d[8] = t[5];
+  return 0;
+}
@@ -0,0 +1,50 @@
+/* __fast_atanf and __fast_atan2f for pic30, see <machine/fastmath.h>.  */
+
+#include <machine/fastmath.h>
+#include "fdlibm.h"
+
+/* Minimax fit of atan (z) / z on [0, 1], relative error 3.0e-5.  */
+static const float
+A0 = 9.9997006e-01f,
+A1 = -3.3170113e-01f,
+A2 = 1.8521674e-01f,
+A3 = -9.1928005e-02f,
+A4 = 2.3864043e-02f,
+PIO2 = 1.5707963705e+00f,	/* 0x3fc90fdb */
+PI = 3.1415927410e+00f;		/* 0x40490fdb */
+
+static __inline__ float
+fast_atan01 (float z)
+{
+  float z2 = z * z;
+
+  return z * (A0 + z2 * (A1 + z2 * (A2 + z2 * (A3 + z2 * A4))));
+}
+
+float
+__fast_atanf (float x)
+{
+  float a = fabsf (x);
+
+  a = a > 1.0f ? PIO2 - fast_atan01 (1.0f / a) : fast_atan01 (a);
+  return x < 0 ? -a : a;
+}
+
+/* One division, of the smaller magnitude by the larger; the origin
+   gives 0 rather than NaN.  The sign of y is taken from its word so
+   that -0 gives -pi as well as -0.  */
+float
+__fast_atan2f (float y, float x)
+{
+  float ax = fabsf (x), ay = fabsf (y), a;
+  __int32_t iy;
+
+  if (ay > ax)
+    a = PIO2 - fast_atan01 (ax / ay);
+  else
+    a = ax != 0 ? fast_atan01 (ay / ax) : 0;
+  if (x < 0)
+    a = PI - a;
+  GET_FLOAT_WORD (iy, y);
+  return iy < 0 ? -a : a;
+}
@@ -0,0 +1,42 @@
+/* __fast_exp2f and __fast_expf for pic30, see <machine/fastmath.h>.  */
+
+#include <machine/fastmath.h>
+#include "fdlibm.h"
+
+/* Minimax fit of 2^f on [0, 1], relative error 7.5e-5.  */
+static const float
+E0 = 9.9992522e-01f,
+E1 = 6.9583354e-01f,
+E2 = 2.2606716e-01f,
+E3 = 7.8024521e-02f,
+LOG2E = 1.4426950216e+00f;	/* 0x3fb8aa3b */
+
+/* 2^x = 2^n * 2^f.  Biasing x by 127 before truncating gives the
+   exponent field 127 + n directly, without a floor; x - n is exact,
+   and may come out a rounding below 0 when x + 127 rounds up.  The
+   polynomial dips below 1 near 0, so n stops at -125 to keep the
+   result normal.  */
+float
+__fast_exp2f (float x)
+{
+  float f, p;
+  __int32_t w;
+  int i;
+
+  if (x < -125.0f)
+    x = -125.0f;
+  else if (x > 127.99f)
+    x = 127.99f;
+  i = (int) (x + 127.0f);
+  f = x - (float) (i - 127);
+  p = E0 + f * (E1 + f * (E2 + f * E3));
+  GET_FLOAT_WORD (w, p);
+  SET_FLOAT_WORD (p, w + ((__int32_t) (i - 127) << 23));
+  return p;
+}
+
+float
+__fast_expf (float x)
+{
+  return __fast_exp2f (x * LOG2E);
+}
@@ -0,0 +1,40 @@
+/* __fast_log2f and __fast_logf for pic30, see <machine/fastmath.h>.  */
+
+#include <machine/fastmath.h>
+#include "fdlibm.h"
+
+/* Minimax fit of log2 (1 + u) / u on [sqrt(1/2) - 1, sqrt(2) - 1],
+   relative error 5.0e-5.  */
+static const float
+L0 = 1.4426463e+00f,
+L1 = -7.2055497e-01f,
+L2 = 4.8530653e-01f,
+L3 = -3.9089241e-01f,
+L4 = 2.5475175e-01f,
+LN2 = 6.9314718246e-01f;	/* 0x3f317218 */
+
+#define SQRT1_2_WORD	0x3f3504f3
+
+/* log2 (x) = n + log2 (m) with m in [sqrt(1/2), sqrt(2)).  Taking the
+   bits of sqrt(1/2) off the word before splitting it rounds n to the
+   nearest; x must be positive and normal.  */
+float
+__fast_log2f (float x)
+{
+  float u;
+  __int32_t ix;
+  int n;
+
+  GET_FLOAT_WORD (ix, x);
+  ix -= SQRT1_2_WORD;
+  n = (int) (ix >> 23);
+  SET_FLOAT_WORD (u, (ix & 0x7fffff) + SQRT1_2_WORD);
+  u -= 1.0f;
+  return (float) n + u * (L0 + u * (L1 + u * (L2 + u * (L3 + u * L4))));
+}
+
+float
+__fast_logf (float x)
+{
+  return __fast_log2f (x) * LN2;
+}
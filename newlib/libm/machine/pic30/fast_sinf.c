@@ -0,0 +1,53 @@
+/* __fast_sinf and __fast_cosf for pic30, see <machine/fastmath.h>.  */
+
+#include <machine/fastmath.h>
+#include "fdlibm.h"
+
+/* Minimax fits of sin (r) / r and cos (r) on [-pi/4, pi/4], relative
+   errors 1.5e-6 and 1.2e-5.  */
+static const float
+S0 = 9.9999849e-01f,
+S1 = -1.6662383e-01f,
+S2 = 8.1500652e-03f,
+C0 = 9.9998823e-01f,
+C1 = -4.9968553e-01f,
+C2 = 4.0362356e-02f,
+INVPIO2 = 6.3661974669e-01f,	/* 0x3f22f983 */
+PIO2_1 = 1.5707855225e+00f,	/* 0x3fc90f80, 17 bits */
+PIO2_2 = 1.0804295016e-05f,	/* 0x37354418 */
+TOINT = 1.2582912000e+07f;	/* 0x4b400000, 1.5 * 2^23 */
+
+/* Reduce X to [-pi/4, pi/4] as sincosf_kernel.h does for small
+   arguments, but with a two-part pi/2 and no fallback, and give the
+   value of the sine (ODD 0) or cosine (ODD 1) at X.  */
+static float
+fast_sincosf (float x, int odd)
+{
+  float t, fn, r, r2;
+  __uint32_t it;
+  int n;
+
+  t = x * INVPIO2 + TOINT;
+  GET_FLOAT_WORD (it, t);
+  fn = t - TOINT;
+  n = (int) (it & 3) + odd;
+  r = (x - fn * PIO2_1) - fn * PIO2_2;
+  r2 = r * r;
+  if (n & 1)
+    t = C0 + r2 * (C1 + r2 * C2);
+  else
+    t = r * (S0 + r2 * (S1 + r2 * S2));
+  return n & 2 ? -t : t;
+}
+
+float
+__fast_sinf (float x)
+{
+  return fast_sincosf (x, 0);
+}
+
+float
+__fast_cosf (float x)
+{
+  return fast_sincosf (x, 1);
+}
@@ -0,0 +1,66 @@
+/* atan2k for pic30, see <machine/stdfix.h>.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#include "fx_k.h"
+
+/* atan (i/128) in Q15. */
+static const __uint16_t atan_tab[129]
+  __attribute__ ((space (auto_psv))) =
+{
+  0, 256, 512, 768, 1024, 1279, 1535, 1790, 2045, 2300, 2555, 2809,
+  3063, 3317, 3570, 3823, 4075, 4327, 4578, 4829, 5079, 5329, 5578,
+  5826, 6073, 6320, 6567, 6812, 7057, 7301, 7544, 7786, 8027, 8268,
+  8508, 8746, 8984, 9221, 9456, 9691, 9925, 10158, 10389, 10620, 10849,
+  11078, 11305, 11531, 11756, 11980, 12203, 12424, 12645, 12864, 13082,
+  13298, 13514, 13728, 13941, 14153, 14363, 14573, 14781, 14987, 15193,
+  15397, 15600, 15801, 16002, 16201, 16398, 16595, 16790, 16984, 17176,
+  17368, 17557, 17746, 17933, 18119, 18304, 18488, 18670, 18851, 19030,
+  19209, 19386, 19561, 19736, 19909, 20081, 20252, 20421, 20589, 20756,
+  20922, 21086, 21249, 21411, 21572, 21732, 21890, 22047, 22203, 22358,
+  22512, 22664, 22815, 22966, 23115, 23262, 23409, 23555, 23699, 23842,
+  23985, 24126, 24266, 24405, 24542, 24679, 24815, 24950, 25083, 25216,
+  25347, 25478, 25607, 25736
+};
+
+#define PI_Q29		1686629713L
+#define PI_2_Q29	843314857L
+
+/* atan (N / D), N <= D, in Q29.  */
+static __int32_t
+atan_ratio (__uint64_t n,
+	__uint64_t d)
+{
+  return __fx_interp (atan_tab, (__uint32_t) ((n << 22) / d)) >> 1;
+}
+
+_Accum
+atan2k (_Accum y,
+	_Accum x)
+{
+  __int64_t by = fx_get (y), bx = fx_get (x);
+  __uint64_t ay = by < 0 ? -by : by, ax = bx < 0 ? -bx : bx;
+  __int32_t v;
+
+  if (ax == 0 && ay == 0)
+    return fx_put (0);
+  /* Keep N << 22 within 64 bits.  */
+  while ((ax | ay) >> 41 != 0)
+    {
+      ax >>= 1;
+      ay >>= 1;
+    }
+  if (ay <= ax)
+    v = atan_ratio (ay, ax);
+  else
+    v = PI_2_Q29 - atan_ratio (ax, ay);
+  if (bx < 0)
+    v = PI_Q29 - v;
+  if (by < 0)
+    v = -v;
+  return fx_sat (__fx_rescale (v, 29, FX_FBIT));
+}
+
+#endif /* __FRACT_FBIT__ */
@@ -0,0 +1,81 @@
+/* Bit conversions for one fixed-point type.  The includer defines
+
+   FX_S		the type's suffix, for example k for _Accum
+   FX_TYPE	the type
+   FX_INT	its int_<FX_S>_t or uint_<FX_S>_t
+   FX_FBIT	its fraction bits
+   FX_IBIT	its integer bits
+   FX_SIGNED	1 for a signed type, else 0
+
+   and gets fx_get and fx_put, which move the bits between FX_TYPE and
+   FX_INT through memory, plus the limits of FX_INT that the type can
+   hold.  */
+
+#ifndef _FX_BITS_H_
+#define _FX_BITS_H_
+
+#include "fx_local.h"
+
+#define FX_CAT1(a, b)	a ## b
+#define FX_CAT(a, b)	FX_CAT1 (a, b)
+
+#define FX_WIDTH	(FX_IBIT + FX_FBIT + FX_SIGNED)
+
+/* The unsigned type of the size <machine/stdfix.h> picks for FX_INT.  */
+#if FX_WIDTH <= 8
+#define FX_UINT		__uint8_t
+#elif FX_WIDTH <= 16
+#define FX_UINT		__uint16_t
+#elif FX_WIDTH <= 32
+#define FX_UINT		__uint32_t
+#else
+#define FX_UINT		__uint64_t
+#endif
+
+#define FX_MASK		((((FX_UINT) 2) << (FX_WIDTH - 1)) - 1)
+#define FX_IMAX		((FX_INT) (FX_SIGNED ? FX_MASK >> 1 : FX_MASK))
+#define FX_IMIN		(FX_SIGNED ? -FX_IMAX - 1 : 0)
+
+/* The bytes holding the value bits, the low ones of each object.  */
+#define FX_COPY		(sizeof (FX_TYPE) < sizeof (FX_UINT) \
+			 ? sizeof (FX_TYPE) : sizeof (FX_UINT))
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define FX_LOW(p)	((char *) (p) + sizeof (*(p)) - FX_COPY)
+#else
+#define FX_LOW(p)	((char *) (p))
+#endif
+
+static __inline__ FX_INT
+fx_get (FX_TYPE f)
+{
+  FX_UINT u = 0;
+
+  memcpy (FX_LOW (&u), FX_LOW (&f), FX_COPY);
+  u &= FX_MASK;
+  if (FX_SIGNED && (u >> (FX_WIDTH - 1)) != 0)
+    u |= ~FX_MASK;
+  return (FX_INT) u;
+}
+
+static __inline__ FX_TYPE
+fx_put (FX_INT i)
+{
+  FX_TYPE f = 0;
+  FX_UINT u = (FX_UINT) i;
+
+  memcpy (FX_LOW (&f), FX_LOW (&u), FX_COPY);
+  return f;
+}
+
+/* V saturated to the range of FX_TYPE.  */
+static __inline__ FX_TYPE
+fx_sat (__int64_t v)
+{
+  if (v > (__int64_t) FX_IMAX)
+    return fx_put (FX_IMAX);
+  if (v < (__int64_t) FX_IMIN)
+    return fx_put (FX_IMIN);
+  return fx_put ((FX_INT) v);
+}
+
+#endif /* _FX_BITS_H_ */
@@ -0,0 +1,61 @@
+/* expk for pic30, see <machine/stdfix.h>.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#include "fx_k.h"
+
+/* 2^(i/128) / 2 in Q15. */
+static const __uint16_t exp2_tab[129]
+  __attribute__ ((space (auto_psv))) =
+{
+  16384, 16473, 16562, 16652, 16743, 16834, 16925, 17017, 17109, 17202,
+  17296, 17390, 17484, 17579, 17674, 17770, 17867, 17964, 18061, 18160,
+  18258, 18357, 18457, 18557, 18658, 18759, 18861, 18963, 19066, 19170,
+  19274, 19379, 19484, 19590, 19696, 19803, 19911, 20019, 20127, 20237,
+  20347, 20457, 20568, 20680, 20792, 20905, 21019, 21133, 21247, 21363,
+  21479, 21595, 21713, 21831, 21949, 22068, 22188, 22309, 22430, 22552,
+  22674, 22797, 22921, 23045, 23170, 23296, 23423, 23550, 23678, 23806,
+  23936, 24066, 24196, 24328, 24460, 24593, 24726, 24860, 24995, 25131,
+  25268, 25405, 25543, 25681, 25821, 25961, 26102, 26244, 26386, 26530,
+  26674, 26818, 26964, 27110, 27258, 27406, 27554, 27704, 27855, 28006,
+  28158, 28311, 28464, 28619, 28774, 28931, 29088, 29246, 29405, 29564,
+  29725, 29886, 30048, 30212, 30376, 30541, 30706, 30873, 31041, 31209,
+  31379, 31549, 31720, 31893, 32066, 32240, 32415, 32591, 32768
+};
+
+#define LN2_Q62		3196577161300663915LL
+
+static const __int64_t ln2 = (LN2_Q62 + (1LL << (61 - FX_FBIT)))
+			     >> (62 - FX_FBIT);
+
+/* exp (x) = 2^(n + 1) * (2^f / 2), where x = (n + f) * ln 2 and f is
+   in [0, 1).  */
+_Accum
+expk (_Accum x)
+{
+  __int64_t b = fx_get (x), n, r, v;
+  int s;
+
+  n = b / ln2;
+  r = b - n * ln2;
+  if (r < 0)
+    {
+      r += ln2;
+      n--;
+    }
+  if (n >= FX_IBIT)
+    return fx_put (FX_IMAX);
+  s = (int) n + 1 + FX_FBIT - 30;
+  if (s < -31)
+    return fx_put (0);
+  v = __fx_interp (exp2_tab, (__uint32_t) ((r << 22) / ln2));
+  if (s >= 0)
+    v <<= s;
+  else
+    v = (v + ((__int64_t) 1 << (-s - 1))) >> -s;
+  return fx_sat (v);
+}
+
+#endif /* __FRACT_FBIT__ */
@@ -0,0 +1,16 @@
+/* TR 18037 functions for short _Accum, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		hk
+#define FX_TYPE		short _Accum
+#define FX_INT		int_hk_t
+#define FX_FBIT		__SACCUM_FBIT__
+#define FX_IBIT		__SACCUM_IBIT__
+#define FX_SIGNED	1
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
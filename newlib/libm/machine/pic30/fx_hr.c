@@ -0,0 +1,16 @@
+/* TR 18037 functions for short _Fract, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		hr
+#define FX_TYPE		short _Fract
+#define FX_INT		int_hr_t
+#define FX_FBIT		__SFRACT_FBIT__
+#define FX_IBIT		__SFRACT_IBIT__
+#define FX_SIGNED	1
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
@@ -0,0 +1,10 @@
+/* TR 18037 functions for _Accum, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#include "fx_k.h"
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
@@ -0,0 +1,10 @@
+/* The fx_bits.h parameters for _Accum, shared by its functions.  */
+
+#define FX_S		k
+#define FX_TYPE		_Accum
+#define FX_INT		int_k_t
+#define FX_FBIT		__ACCUM_FBIT__
+#define FX_IBIT		__ACCUM_IBIT__
+#define FX_SIGNED	1
+
+#include "fx_bits.h"
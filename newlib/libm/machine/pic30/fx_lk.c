@@ -0,0 +1,16 @@
+/* TR 18037 functions for long _Accum, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		lk
+#define FX_TYPE		long _Accum
+#define FX_INT		int_lk_t
+#define FX_FBIT		__LACCUM_FBIT__
+#define FX_IBIT		__LACCUM_IBIT__
+#define FX_SIGNED	1
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
@@ -0,0 +1,37 @@
+/* Shared helpers for the pic30 TR 18037 fixed-point functions, see
+   <machine/stdfix.h>.  The functions work on the integer bits of their
+   operands; fx_bits.h converts between the two for one type.  */
+
+#ifndef _FX_LOCAL_H_
+#define _FX_LOCAL_H_
+
+#include <machine/stdfix.h>
+#include <string.h>
+
+/* V, which has FROM fraction bits, with TO of them, rounded to
+   nearest when bits are dropped.  FROM and TO are constants.  */
+static __inline__ __int64_t
+__fx_rescale (__int64_t v, int from, int to)
+{
+  if (to >= from)
+    return (__int64_t) ((__uint64_t) v << (to - from));
+  return (v + ((__int64_t) 1 << (from - to - 1))) >> (from - to);
+}
+
+/* Interpolate the 129-entry Q15 table T at X, a 22-bit fraction of
+   its span: the top 7 bits pick the entry and the low 15 the point
+   between it and the next.  Neighbouring entries differ by less than
+   2^15, so the step is one 16 x 16 multiply.  The result is Q30.  */
+static __inline__ __int32_t
+__fx_interp (const __uint16_t *t, __uint32_t x)
+{
+  unsigned int i = (unsigned int) (x >> 15);
+  __int32_t a = (__int32_t) t[i] << 15;
+
+  if (i >= 128)
+    return a;
+  return a + (__int32_t) (__int16_t) (x & 0x7fff)
+    * (__int16_t) (t[i + 1] - t[i]);
+}
+
+#endif /* _FX_LOCAL_H_ */
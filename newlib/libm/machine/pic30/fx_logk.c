@@ -0,0 +1,52 @@
+/* logk for pic30, see <machine/stdfix.h>.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#include "fx_k.h"
+
+/* log2 (1 + i/128) in Q15. */
+static const __uint16_t log2_tab[129]
+  __attribute__ ((space (auto_psv))) =
+{
+  0, 368, 733, 1095, 1455, 1811, 2166, 2517, 2866, 3212, 3556, 3897,
+  4236, 4573, 4907, 5239, 5568, 5895, 6220, 6543, 6863, 7182, 7498,
+  7812, 8124, 8434, 8742, 9048, 9352, 9654, 9954, 10253, 10549, 10843,
+  11136, 11427, 11716, 12004, 12289, 12573, 12855, 13136, 13415, 13692,
+  13968, 14242, 14514, 14785, 15055, 15322, 15589, 15854, 16117, 16379,
+  16639, 16898, 17156, 17412, 17667, 17921, 18173, 18424, 18673, 18921,
+  19168, 19414, 19658, 19901, 20143, 20383, 20623, 20861, 21098, 21334,
+  21568, 21802, 22034, 22265, 22495, 22724, 22952, 23179, 23404, 23629,
+  23852, 24075, 24296, 24517, 24736, 24955, 25172, 25388, 25604, 25818,
+  26031, 26244, 26455, 26666, 26876, 27084, 27292, 27499, 27705, 27910,
+  28114, 28318, 28520, 28722, 28922, 29122, 29321, 29520, 29717, 29914,
+  30109, 30304, 30498, 30692, 30884, 31076, 31267, 31457, 31647, 31836,
+  32024, 32211, 32397, 32583, 32768
+};
+
+#define LN2_Q30		744261118L
+
+/* log (x) = ln 2 * (e + log2 (m)), where x = 2^e * m and m is in
+   [1, 2).  log (x) for x <= 0 is the most negative _Accum.  */
+_Accum
+logk (_Accum x)
+{
+  __int64_t b = fx_get (x), v;
+  __uint32_t m;
+  int e;
+
+  if (b <= 0)
+    return fx_put (FX_IMIN);
+  for (e = 0; (b >> (e + 1)) != 0; e++)
+    ;
+  if (e >= 22)
+    m = (__uint32_t) (b >> (e - 22));
+  else
+    m = (__uint32_t) b << (22 - e);
+  v = __fx_interp (log2_tab, m & 0x3fffff);
+  v = (__int64_t) (e - FX_FBIT) * LN2_Q30 + ((v * LN2_Q30 + (1L << 29)) >> 30);
+  return fx_sat (__fx_rescale (v, 30, FX_FBIT));
+}
+
+#endif /* __FRACT_FBIT__ */
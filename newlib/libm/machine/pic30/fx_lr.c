@@ -0,0 +1,16 @@
+/* TR 18037 functions for long _Fract, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		lr
+#define FX_TYPE		long _Fract
+#define FX_INT		int_lr_t
+#define FX_FBIT		__LFRACT_FBIT__
+#define FX_IBIT		__LFRACT_IBIT__
+#define FX_SIGNED	1
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
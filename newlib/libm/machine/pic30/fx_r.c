@@ -0,0 +1,16 @@
+/* TR 18037 functions for _Fract, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		r
+#define FX_TYPE		_Fract
+#define FX_INT		int_r_t
+#define FX_FBIT		__FRACT_FBIT__
+#define FX_IBIT		__FRACT_IBIT__
+#define FX_SIGNED	1
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
@@ -0,0 +1,68 @@
+/* sink and cosk for pic30, see <machine/stdfix.h>.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#include "fx_k.h"
+
+/* sin (pi/2 * i/128) in Q15. */
+static const __uint16_t sin_tab[129]
+  __attribute__ ((space (auto_psv))) =
+{
+  0, 402, 804, 1206, 1608, 2009, 2411, 2811, 3212, 3612, 4011, 4410,
+  4808, 5205, 5602, 5998, 6393, 6787, 7180, 7571, 7962, 8351, 8740,
+  9127, 9512, 9896, 10279, 10660, 11039, 11417, 11793, 12167, 12540,
+  12910, 13279, 13646, 14010, 14373, 14733, 15091, 15447, 15800, 16151,
+  16500, 16846, 17190, 17531, 17869, 18205, 18538, 18868, 19195, 19520,
+  19841, 20160, 20475, 20788, 21097, 21403, 21706, 22006, 22302, 22595,
+  22884, 23170, 23453, 23732, 24008, 24279, 24548, 24812, 25073, 25330,
+  25583, 25833, 26078, 26320, 26557, 26791, 27020, 27246, 27467, 27684,
+  27897, 28106, 28311, 28511, 28707, 28899, 29086, 29269, 29448, 29622,
+  29792, 29957, 30118, 30274, 30425, 30572, 30715, 30853, 30986, 31114,
+  31238, 31357, 31471, 31581, 31686, 31786, 31881, 31972, 32058, 32138,
+  32214, 32286, 32352, 32413, 32470, 32522, 32568, 32610, 32647, 32679,
+  32706, 32729, 32746, 32758, 32766, 32768
+};
+
+#define TWO_PI_Q60	7244019458077122842LL
+
+static const __int64_t two_pi = (TWO_PI_Q60 + (1LL << (59 - FX_FBIT)))
+				>> (60 - FX_FBIT);
+
+/* sin (x + QUARTERS * pi/2).  X is reduced to a 24-bit fraction of a
+   turn, whose top two bits are the quadrant.  */
+static _Accum
+sin_turn (_Accum x,
+	__uint32_t quarters)
+{
+  __int64_t r = (__int64_t) fx_get (x) % two_pi;
+  __uint32_t p;
+  __int32_t v;
+
+  if (r < 0)
+    r += two_pi;
+  p = (__uint32_t) (((__uint64_t) r << 24) / two_pi);
+  p = (p + (quarters << 22)) & 0xffffff;
+  if (p & 0x400000)
+    v = __fx_interp (sin_tab, 0x400000 - (p & 0x3fffff));
+  else
+    v = __fx_interp (sin_tab, p & 0x3fffff);
+  if (p & 0x800000)
+    v = -v;
+  return fx_sat (__fx_rescale (v, 30, FX_FBIT));
+}
+
+_Accum
+sink (_Accum x)
+{
+  return sin_turn (x, 0);
+}
+
+_Accum
+cosk (_Accum x)
+{
+  return sin_turn (x, 1);
+}
+
+#endif /* __FRACT_FBIT__ */
@@ -0,0 +1,43 @@
+/* sqrtk for pic30, see <machine/stdfix.h>.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#include "fx_k.h"
+
+/* The bits of sqrt (x) are sqrt (bits (x) << FX_FBIT), taken two bits
+   at a time from the top, rounded to nearest.  */
+#define SQRT_BITS	((FX_IBIT + 2 * FX_FBIT + 1) & ~1)
+
+_Accum
+sqrtk (_Accum x)
+{
+  __int64_t b = fx_get (x);
+  __uint64_t rem = 0, root = 0, t;
+  int i, j;
+
+  if (b <= 0)
+    return fx_put (0);
+  for (i = SQRT_BITS - 2; i >= 0; i -= 2)
+    {
+      j = i - FX_FBIT;
+      rem <<= 2;
+      if (j >= 0)
+	rem |= (b >> j) & 3;
+      else if (j == -1)
+	rem |= (b & 1) << 1;
+      root <<= 1;
+      t = (root << 1) | 1;
+      if (rem >= t)
+	{
+	  rem -= t;
+	  root |= 1;
+	}
+    }
+  if (rem > root)
+    root++;
+  return fx_put ((int_k_t) root);
+}
+
+#endif /* __FRACT_FBIT__ */
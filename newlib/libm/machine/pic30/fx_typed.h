@@ -0,0 +1,64 @@
+/* Template for the TR 18037 7.18a.6 functions of one fixed-point type:
+   abs<FX_S> for a signed type, round<FX_S>, countls<FX_S>, bits<FX_S>
+   and <FX_S>bits.  The includer defines the parameters of fx_bits.h.  */
+
+#include "fx_bits.h"
+
+#if FX_SIGNED
+FX_TYPE
+FX_CAT (abs, FX_S) (FX_TYPE f)
+{
+  FX_INT i = fx_get (f);
+
+  if (i >= 0)
+    return f;
+  return fx_put (i == FX_IMIN ? FX_IMAX : -i);
+}
+#endif
+
+/* Round to N fraction bits, halfway cases up; an N outside
+   [0, FX_FBIT) leaves F alone.  A result past the top saturates.  */
+FX_TYPE
+FX_CAT (round, FX_S) (FX_TYPE f,
+	int n)
+{
+  FX_INT i = fx_get (f);
+  FX_INT half;
+
+  if (n < 0 || n >= FX_FBIT)
+    return f;
+  half = (FX_INT) 1 << (FX_FBIT - 1 - n);
+  if (i > FX_IMAX - half)
+    return fx_put (FX_IMAX);
+  return fx_put ((i + half) & ~(2 * half - 1));
+}
+
+/* The largest K for which F << K does not overflow; for F == 0 the
+   number of value bits, FX_WIDTH - FX_SIGNED.  */
+int
+FX_CAT (countls, FX_S) (FX_TYPE f)
+{
+  FX_UINT u = (FX_UINT) fx_get (f);
+  const FX_UINT top = (FX_UINT) 1 << (FX_WIDTH - 1 - FX_SIGNED);
+  int k;
+
+#if FX_SIGNED
+  if ((FX_INT) u < 0)
+    u = ~u & FX_MASK;
+#endif
+  for (k = 0; k < FX_WIDTH - FX_SIGNED && (u & top) == 0; k++)
+    u <<= 1;
+  return k;
+}
+
+FX_INT
+FX_CAT (bits, FX_S) (FX_TYPE f)
+{
+  return fx_get (f);
+}
+
+FX_TYPE
+FX_CAT (FX_S, bits) (FX_INT n)
+{
+  return fx_put (n);
+}
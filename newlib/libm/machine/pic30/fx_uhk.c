@@ -0,0 +1,16 @@
+/* TR 18037 functions for unsigned short _Accum, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		uhk
+#define FX_TYPE		unsigned short _Accum
+#define FX_INT		uint_uhk_t
+#define FX_FBIT		__USACCUM_FBIT__
+#define FX_IBIT		__USACCUM_IBIT__
+#define FX_SIGNED	0
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
@@ -0,0 +1,16 @@
+/* TR 18037 functions for unsigned short _Fract, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		uhr
+#define FX_TYPE		unsigned short _Fract
+#define FX_INT		uint_uhr_t
+#define FX_FBIT		__USFRACT_FBIT__
+#define FX_IBIT		__USFRACT_IBIT__
+#define FX_SIGNED	0
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
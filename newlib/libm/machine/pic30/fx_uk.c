@@ -0,0 +1,16 @@
+/* TR 18037 functions for unsigned _Accum, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		uk
+#define FX_TYPE		unsigned _Accum
+#define FX_INT		uint_uk_t
+#define FX_FBIT		__UACCUM_FBIT__
+#define FX_IBIT		__UACCUM_IBIT__
+#define FX_SIGNED	0
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
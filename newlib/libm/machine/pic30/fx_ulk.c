@@ -0,0 +1,16 @@
+/* TR 18037 functions for unsigned long _Accum, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		ulk
+#define FX_TYPE		unsigned long _Accum
+#define FX_INT		uint_ulk_t
+#define FX_FBIT		__ULACCUM_FBIT__
+#define FX_IBIT		__ULACCUM_IBIT__
+#define FX_SIGNED	0
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
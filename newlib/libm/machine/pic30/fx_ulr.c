@@ -0,0 +1,16 @@
+/* TR 18037 functions for unsigned long _Fract, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		ulr
+#define FX_TYPE		unsigned long _Fract
+#define FX_INT		uint_ulr_t
+#define FX_FBIT		__ULFRACT_FBIT__
+#define FX_IBIT		__ULFRACT_IBIT__
+#define FX_SIGNED	0
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
@@ -0,0 +1,16 @@
+/* TR 18037 functions for unsigned _Fract, see fx_typed.h.  */
+
+#include <machine/stdfix.h>
+
+#ifdef __FRACT_FBIT__
+
+#define FX_S		ur
+#define FX_TYPE		unsigned _Fract
+#define FX_INT		uint_ur_t
+#define FX_FBIT		__UFRACT_FBIT__
+#define FX_IBIT		__UFRACT_IBIT__
+#define FX_SIGNED	0
+
+#include "fx_typed.h"
+
+#endif /* __FRACT_FBIT__ */
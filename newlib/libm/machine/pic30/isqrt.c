@@ -0,0 +1,46 @@
+/* isqrt16 and isqrt32 for pic30, see <machine/dsp.h>.  One result
+   bit per step, from the top.  */
+
+#include <machine/dsp.h>
+
+unsigned int
+isqrt16 (unsigned int v)
+{
+  unsigned int root = 0, bit = 0x4000, t;
+
+  while (bit > v)
+    bit >>= 2;
+  while (bit != 0)
+    {
+      t = root + bit;
+      root >>= 1;
+      if (v >= t)
+	{
+	  v -= t;
+	  root += bit;
+	}
+      bit >>= 2;
+    }
+  return root;
+}
+
+unsigned int
+isqrt32 (unsigned long v)
+{
+  unsigned long root = 0, bit = 0x40000000UL, t;
+
+  while (bit > v)
+    bit >>= 2;
+  while (bit != 0)
+    {
+      t = root + bit;
+      root >>= 1;
+      if (v >= t)
+	{
+	  v -= t;
+	  root += bit;
+	}
+      bit >>= 2;
+    }
+  return root;
+}
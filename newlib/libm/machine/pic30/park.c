@@ -0,0 +1,97 @@
+/* Clarke and Park transforms for pic30, see <machine/matrix.h>.
+
+	alpha = a
+	beta  = (a + 2 b) / sqrt 3
+	d     =  alpha cos + beta sin
+	q     = -alpha sin + beta cos
+
+   and the inverse Park transform alpha = d cos - q sin, beta = d sin
+   + q cos.  The Q15 sums of products in 2.30 are taken whole and
+   rounded once; 2 / sqrt 3 does not fit in Q15, so beta is
+   (a + 2 b) times 1 / sqrt 3.  */
+
+#include <machine/matrix.h>
+
+/* 1 / sqrt 3 in Q15 */
+#define INV_SQRT3_Q15	18919
+
+/* Round a sum of 2.30 products to 1.15; two of them may not fit in a
+   long.  */
+static q15_t
+round15 (long long acc)
+{
+  acc = (acc + 0x4000) >> 15;
+  if (acc > 32767)
+    return 32767;
+  if (acc < -32768)
+    return -32768;
+  return (q15_t) acc;
+}
+
+void
+q15_clarke (q15_t a,
+	q15_t b,
+	q15_t *alpha,
+	q15_t *beta)
+{
+  *alpha = a;
+  *beta = round15 (((long) a + 2L * b) * INV_SQRT3_Q15);
+}
+
+void
+q15_park (q15_t alpha,
+	q15_t beta,
+	q15_t s,
+	q15_t c,
+	q15_t *d,
+	q15_t *q)
+{
+  *d = round15 ((long long) ((long) alpha * c) + (long) beta * s);
+  *q = round15 ((long long) ((long) beta * c) - (long) alpha * s);
+}
+
+void
+q15_ipark (q15_t d,
+	q15_t q,
+	q15_t s,
+	q15_t c,
+	q15_t *alpha,
+	q15_t *beta)
+{
+  *alpha = round15 ((long long) ((long) d * c) - (long) q * s);
+  *beta = round15 ((long long) ((long) d * s) + (long) q * c);
+}
+
+void
+f32_clarke (float a,
+	float b,
+	float *alpha,
+	float *beta)
+{
+  *alpha = a;
+  *beta = (a + 2 * b) * 0.57735026919f;
+}
+
+void
+f32_park (float alpha,
+	float beta,
+	float s,
+	float c,
+	float *d,
+	float *q)
+{
+  *d = alpha * c + beta * s;
+  *q = beta * c - alpha * s;
+}
+
+void
+f32_ipark (float d,
+	float q,
+	float s,
+	float c,
+	float *alpha,
+	float *beta)
+{
+  *alpha = d * c - q * s;
+  *beta = d * s + q * c;
+}
@@ -0,0 +1,95 @@
+/* PID controllers for pic30, see <machine/dsp.h>.  On DSP parts the
+   Q15 step is in pid_q15.S; the portable version here follows its
+   arithmetic.  */
+
+#include <machine/dsp.h>
+
+int
+pid_q15_init (pid_q15_t *s,
+	q15_t kp,
+	q15_t ki,
+	q15_t kd,
+	unsigned int shift,
+	q15_t min,
+	q15_t max)
+{
+  long a0 = (long) kp + ki + kd, a1 = -((long) kp + 2L * kd);
+
+  if (shift > 15 || a0 > 32767 || a0 < -32768 || a1 > 32767 || a1 < -32768)
+    return -1;
+  s->a[0] = (q15_t) a0;
+  s->a[1] = (q15_t) a1;
+  s->a[2] = kd;
+  s->e[0] = s->e[1] = 0;
+  s->out = 0 < min ? min : 0 > max ? max : 0;
+  s->min = min;
+  s->max = max;
+  s->sft = -(int) shift;
+  return 0;
+}
+
+#ifndef __HAS_DSP__
+
+q15_t
+pid_q15_step (pid_q15_t *s, q15_t e)
+{
+  /* In 2.30 as on the MAC; the shifted sum stays well inside a long
+     long, so only the final store saturates.  */
+  long long acc = (long) s->a[0] * e + (long) s->a[1] * s->e[0]
+		  + (long) s->a[2] * s->e[1];
+  q15_t u;
+
+  acc = ((acc << -s->sft) + ((long long) s->out << 15) + 0x4000) >> 15;
+  u = acc > 32767 ? 32767 : acc < -32768 ? -32768 : (q15_t) acc;
+  if (u < s->min)
+    u = s->min;
+  if (u > s->max)
+    u = s->max;
+  s->out = u;
+  s->e[1] = s->e[0];
+  s->e[0] = e;
+  return u;
+}
+
+#endif /* !__HAS_DSP__ */
+
+void
+pid_f32_init (pid_f32_t *s,
+	float kp,
+	float ki,
+	float kd,
+	float min,
+	float max)
+{
+  s->kp = kp;
+  s->ki = ki;
+  s->kd = kd;
+  s->min = min;
+  s->max = max;
+  s->integ = 0;
+  s->prev = 0;
+}
+
+float
+pid_f32_step (pid_f32_t *s, float e)
+{
+  float ie = s->ki * e;
+  float i = s->integ + ie;
+  float u = s->kp * e + i + s->kd * (e - s->prev);
+
+  s->prev = e;
+  if (u > s->max)
+    {
+      u = s->max;
+      if (ie > 0)
+	return u;
+    }
+  else if (u < s->min)
+    {
+      u = s->min;
+      if (ie < 0)
+	return u;
+    }
+  s->integ = i;
+  return u;
+}
@@ -0,0 +1,18 @@
+/* polyeval_f32 for pic30, see <machine/fastmath.h>.  */
+
+#include <machine/fastmath.h>
+
+float
+polyeval_f32 (float x,
+	const float *c,
+	unsigned int n)
+{
+  float y;
+
+  if (n == 0)
+    return 0;
+  y = *c++;
+  while (--n != 0)
+    y = y * x + *c++;
+  return y;
+}
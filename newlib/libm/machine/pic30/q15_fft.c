@@ -0,0 +1,94 @@
+/* q15_fft, q15_ifft, q15_rfft -- FFTs on top of q15_bitrev and the
+   butterflies of __q15_dit, which are in assembler on DSP parts and in
+   q15_generic.c elsewhere.
+
+   The inverse is the forward transform of the conjugate, conjugated,
+   with no scaling.  The real transform packs its 2^m samples into
+   2^(m-1) complex points, one transform of which gives the spectra
+   of the even and of the odd samples; one more pass of twiddles
+   joins them.  */
+
+#include <machine/dsp.h>
+#include "q15_local.h"
+
+static void
+conj15 (q15c_t *x, unsigned int n)
+{
+  while (n-- != 0)
+    {
+      x->im = x->im == -32768 ? 32767 : -x->im;
+      x++;
+    }
+}
+
+/* ACC / 2^SHIFT, rounded and saturated.  */
+static q15_t
+shr15 (long acc, int shift)
+{
+  if (shift)
+    acc = (acc + (1L << (shift - 1))) >> shift;
+  if (acc > 32767)
+    return 32767;
+  if (acc < -32768)
+    return -32768;
+  return (q15_t) acc;
+}
+
+void
+q15_fft (q15c_t *x, unsigned int log2n)
+{
+  q15_bitrev (x, log2n);
+  __q15_dit (x, log2n, 1, __q15_twiddle);
+}
+
+void
+q15_ifft (q15c_t *x, unsigned int log2n)
+{
+  conj15 (x, 1U << log2n);
+  q15_bitrev (x, log2n);
+  __q15_dit (x, log2n, 0, __q15_twiddle);
+  conj15 (x, 1U << log2n);
+}
+
+void
+q15_rfft (q15_t *x, unsigned int log2n)
+{
+  q15c_t *z = (q15c_t *) x, *p, *q;
+  unsigned int m = 1U << (log2n - 1), k;
+  const q15c_t *w;
+  long sr, si, dr, di, tr, ti;
+  q15_t a;
+
+  /* Two real samples make a point of magnitude up to sqrt 2; halved,
+     no value of the transform can exceed 1.  */
+  for (k = 0; k < 2 * m; k++)
+    x[k] = shr15 (x[k], 1);
+  q15_fft (z, log2n - 1);
+
+  /* With Z[k] the transform and Z'[k] = conj (Z[m - k]), the even
+     samples have the spectrum E = (Z + Z') / 2, the odd ones
+     O = (Z - Z') / 2i, and bin k is E[k] + W^k O[k], where
+     W = exp (-2 pi i / 2m); the halving above makes up for the 1/2
+     this is short of 1/2m.  Bin m - k is conj (E[k] - W^k O[k]), so
+     each pass does two.  |W^k (Z - Z')| < 2^31 in Q30, but sums
+     with 2^15 (Z + Z') only stay in range halved.  */
+  a = z[0].re;
+  z[0].re = shr15 ((long) a + z[0].im, 0);
+  z[0].im = shr15 ((long) a - z[0].im, 0);
+  for (k = 1; k <= m / 2; k++)
+    {
+      p = &z[k];
+      q = &z[m - k];
+      w = &__q15_twiddle[k << (Q15_FFT_MAXLOG2 - log2n)];
+      sr = (long) p->re + q->re;
+      si = (long) p->im - q->im;
+      dr = (long) p->re - q->re;
+      di = (long) p->im + q->im;
+      tr = (long) w->re * di + (long) w->im * dr;
+      ti = (long) w->im * di - (long) w->re * dr;
+      p->re = shr15 ((sr << 14) + (tr >> 1), 15);
+      p->im = shr15 ((si << 14) + (ti >> 1), 15);
+      q->re = shr15 ((sr << 14) - (tr >> 1), 15);
+      q->im = shr15 ((ti >> 1) - (si << 14), 15);
+    }
+}
@@ -0,0 +1,141 @@
+/* Conversions between float and Q15 or Q31 for pic30, see
+   <machine/dsp.h>.  A cast would call the soft-float __fixsfsi or
+   __floatsisf, then scale and saturate around it; here the exponent
+   and the mantissa are taken apart and put together directly.  */
+
+#include <machine/dsp.h>
+#include "fdlibm.h"
+
+/* X times 2^FBITS, rounded to nearest, ties away from zero, and
+   saturated to -MAX - 1 .. MAX; 0 for a NaN.  */
+static __int32_t
+from_f32 (float x,
+	int fbits,
+	__int32_t max)
+{
+  __uint32_t w, m;
+  int e, shift;
+
+  GET_FLOAT_WORD (w, x);
+  e = (w >> 23) & 0xff;
+  if (e >= 127)
+    {
+      if (e == 0xff && (w & 0x7fffff) != 0)
+	return 0;
+      return (w & 0x80000000) ? -max - 1 : max;
+    }
+  /* |X| 2^FBITS is M 2^-SHIFT, below 1/2 from SHIFT 25 on, which
+     covers the subnormals.  */
+  shift = 150 - fbits - e;
+  if (shift > 24)
+    return 0;
+  m = (w & 0x7fffff) | 0x800000;
+  if (shift <= 0)
+    m <<= -shift;
+  else
+    m = (m + ((__uint32_t) 1 << (shift - 1))) >> shift;
+  if (w & 0x80000000)
+    return -(__int32_t) m;
+  return m > (__uint32_t) max ? max : (__int32_t) m;
+}
+
+/* V times 2^-FBITS, rounded to nearest even when V has more than 24
+   significant bits.  */
+static float
+to_f32 (__int32_t v,
+	int fbits)
+{
+  __uint32_t a, w, sign = 0, half, rem;
+  int e = 150 - fbits, s;
+  float x;
+
+  if (v == 0)
+    return 0.0f;
+  a = (__uint32_t) v;
+  if (v < 0)
+    {
+      sign = 0x80000000;
+      a = -a;
+    }
+  /* Bring the leading one to bit 23.  Rounding up may carry it to bit
+     24, which the addition below turns into the next exponent.  */
+  if (a >= 0x1000000)
+    {
+      for (s = 1; (a >> s) >= 0x1000000; s++)
+	;
+      half = (__uint32_t) 1 << (s - 1);
+      rem = a & ((half << 1) - 1);
+      a >>= s;
+      e += s;
+      if (rem > half || (rem == half && (a & 1)))
+	a++;
+    }
+  else
+    {
+      while (a < 0x8000)
+	{
+	  a <<= 8;
+	  e -= 8;
+	}
+      while (a < 0x800000)
+	{
+	  a <<= 1;
+	  e--;
+	}
+    }
+  w = sign + ((__uint32_t) (e - 1) << 23) + a;
+  SET_FLOAT_WORD (x, w);
+  return x;
+}
+
+q15_t
+f32_to_q15 (float x)
+{
+  return (q15_t) from_f32 (x, 15, 0x7fff);
+}
+
+float
+q15_to_f32 (q15_t q)
+{
+  return to_f32 (q, 15);
+}
+
+q31_t
+f32_to_q31 (float x)
+{
+  return from_f32 (x, 31, 0x7fffffffL);
+}
+
+float
+q31_to_f32 (q31_t q)
+{
+  return to_f32 (q, 31);
+}
+
+void
+f32_to_q15_array (q15_t *d, const float *s, unsigned int n)
+{
+  while (n-- != 0)
+    *d++ = (q15_t) from_f32 (*s++, 15, 0x7fff);
+}
+
+void
+q15_to_f32_array (float *d, const q15_t *s, unsigned int n)
+{
+  while (n-- != 0)
+    *d++ = to_f32 (*s++, 15);
+}
+
+void
+f32_to_q31_array (q31_t *d, const float *s, unsigned int n)
+{
+  while (n-- != 0)
+    *d++ = from_f32 (*s++, 31, 0x7fffffffL);
+}
+
+void
+q31_to_f32_array (float *d, const q31_t *s, unsigned int n)
+{
+  while (n-- != 0)
+    *d++ = to_f32 (*s++, 31);
+}
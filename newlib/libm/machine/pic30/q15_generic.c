@@ -0,0 +1,218 @@
+/* Portable versions of the Q15 kernels for pic30 parts without a DSP
+   engine (PIC24).  They follow the DSP versions' arithmetic: products
+   are summed in a wide accumulator, then rounded and saturated once
+   on the way out.  */
+
+#include <machine/dsp.h>
+#include "q15_local.h"
+
+#ifndef __HAS_DSP__
+
+static q15_t
+sat15 (long acc)
+{
+  if (acc > 32767L)
+    return 32767;
+  if (acc < -32768L)
+    return -32768;
+  return (q15_t) acc;
+}
+
+/* Round a sum of 1.15 * 1.15 products (2.30) to 1.15.  */
+static q15_t
+round15 (long long acc)
+{
+  acc = (acc + 0x4000) >> 15;
+  if (acc > 32767)
+    return 32767;
+  if (acc < -32768)
+    return -32768;
+  return (q15_t) acc;
+}
+
+static long long
+dot (const q15_t *x, const q15_t *y, unsigned int n)
+{
+  long long acc = 0;
+
+  while (n-- != 0)
+    acc += (long) *x++ * *y++;
+  return acc;
+}
+
+q15_t
+q15_dot (const q15_t *x, const q15_t *y, unsigned int n)
+{
+  return round15 (dot (x, y, n));
+}
+
+q31_t
+q15_dot_q31 (const q15_t *x, const q15_t *y, unsigned int n)
+{
+  long long acc = dot (x, y, n) << 1;
+
+  if (acc > 0x7fffffffLL)
+    return 0x7fffffffL;
+  if (acc < -0x7fffffffLL - 1)
+    return -0x7fffffffL - 1;
+  return (q31_t) acc;
+}
+
+void
+q15_vadd (q15_t *d, const q15_t *a, const q15_t *b, unsigned int n)
+{
+  while (n-- != 0)
+    *d++ = sat15 ((long) *a++ + *b++);
+}
+
+void
+q15_vscale (q15_t *d, const q15_t *s, q15_t k, unsigned int n)
+{
+  while (n-- != 0)
+    *d++ = round15 ((long) k * *s++);
+}
+
+void
+q15_fir (q15_t *y, const q15_t *x, unsigned int n, q15_fir_t *f)
+{
+  unsigned int pos = f->pos;
+
+  while (n-- != 0)
+    {
+      pos = (pos ? pos : f->ntaps) - 1;
+      f->delay[pos] = f->delay[pos + f->ntaps] = *x++;
+      *y++ = round15 (dot (f->coeffs, &f->delay[pos], f->ntaps));
+    }
+  f->pos = pos;
+}
+
+void
+q15_biquad (q15_t *y, const q15_t *x, unsigned int n, q15_biquad_t *s)
+{
+  q15_t *st = s->state;
+  q15_t out;
+
+  while (n-- != 0)
+    {
+      st[0] = *x++;
+      out = round15 (dot (s->coeffs, st, 5) << 1);
+      *y++ = out;
+      st[2] = st[1];
+      st[1] = st[0];
+      st[4] = st[3];
+      st[3] = out;
+    }
+}
+
+void
+q15_bitrev (q15c_t *x, unsigned int log2n)
+{
+  unsigned int n = 1U << log2n, i, j, bit;
+  q15c_t t;
+
+  for (i = j = 0; i < n; i++)
+    {
+      if (i < j)
+	{
+	  t = x[i];
+	  x[i] = x[j];
+	  x[j] = t;
+	}
+      /* J += 1 with the carry running from the top bit down.  */
+      for (bit = n >> 1; j & bit; bit >>= 1)
+	j ^= bit;
+      j |= bit;
+    }
+}
+
+/* A sum of Q15 values, divided by 2^SHIFT, rounded and saturated.  */
+static q15_t
+scale15 (long acc, int shift)
+{
+  if (shift)
+    acc = (acc + (1L << (shift - 1))) >> shift;
+  return sat15 (acc);
+}
+
+/* *P times *W, each product rounded to Q15.  */
+static void
+cmul (q15_t *re, q15_t *im, const q15c_t *p, const q15c_t *w)
+{
+  *re = round15 ((long long) p->re * w->re - (long long) p->im * w->im);
+  *im = round15 ((long long) p->re * w->im + (long long) p->im * w->re);
+}
+
+void
+__q15_dit (q15c_t *x, unsigned int log2n, int scale, const q15c_t *tw)
+{
+  unsigned int n = 1U << log2n, h = 1, j, step;
+  int s2 = scale ? 1 : 0, s4 = scale ? 2 : 0;
+  q15c_t *p, a;
+  q15_t br, bi, cr, ci, dr, di;
+
+  if (log2n & 1)
+    {
+      for (p = x; p < x + n; p += 2)
+	{
+	  a = p[0];
+	  p[0].re = scale15 ((long) a.re + p[1].re, s2);
+	  p[0].im = scale15 ((long) a.im + p[1].im, s2);
+	  p[1].re = scale15 ((long) a.re - p[1].re, s2);
+	  p[1].im = scale15 ((long) a.im - p[1].im, s2);
+	}
+      h = 2;
+    }
+
+  /* Point k + m h of a group of 4h takes W^(2j), W^j, W^(3j) for
+     m = 1, 2, 3, with j = k mod h and W a 4h'th root of unity.  */
+  for (; h < n; h *= 4)
+    {
+      step = (1U << (Q15_FFT_MAXLOG2 - 2)) / h;
+      for (j = 0; j < h; j++)
+	for (p = x + j; p < x + n; p += 4 * h)
+	  {
+	    a = p[0];
+	    cmul (&br, &bi, &p[h], &tw[2 * j * step]);
+	    cmul (&cr, &ci, &p[2 * h], &tw[j * step]);
+	    cmul (&dr, &di, &p[3 * h], &tw[3 * j * step]);
+	    p[0].re = scale15 ((long) a.re + br + cr + dr, s4);
+	    p[0].im = scale15 ((long) a.im + bi + ci + di, s4);
+	    p[h].re = scale15 ((long) a.re - br + ci - di, s4);
+	    p[h].im = scale15 ((long) a.im - bi - cr + dr, s4);
+	    p[2 * h].re = scale15 ((long) a.re + br - cr - dr, s4);
+	    p[2 * h].im = scale15 ((long) a.im + bi - ci - di, s4);
+	    p[3 * h].re = scale15 ((long) a.re - br - ci + di, s4);
+	    p[3 * h].im = scale15 ((long) a.im - bi + cr - dr, s4);
+	  }
+    }
+}
+
+/* As the DSP version: the low halves of x and y lose two bits each
+   and their product is dropped.  */
+q31_t
+polyeval_q31 (q31_t x, const q31_t *c, unsigned int n)
+{
+  long xh = x >> 16, xl = (x & 0xffffL) >> 2, yh, yl;
+  long long acc;
+  q31_t y;
+
+  if (n == 0)
+    return 0;
+  y = *c++;
+  while (--n != 0)
+    {
+      yh = y >> 16;
+      yl = (y & 0xffffL) >> 2;
+      acc = (2LL * (xl * yh + xh * yl)) >> 14;
+      acc += 2LL * xh * yh + *c++;
+      if (acc > 0x7fffffffLL)
+	y = 0x7fffffffL;
+      else if (acc < -0x7fffffffLL - 1)
+	y = -0x7fffffffL - 1;
+      else
+	y = (q31_t) acc;
+    }
+  return y;
+}
+
+#endif /* !__HAS_DSP__ */
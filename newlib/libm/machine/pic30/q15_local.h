@@ -0,0 +1,21 @@
+/* Internals of the pic30 Q15 FFTs.  */
+
+#ifndef _Q15_LOCAL_H_
+#define _Q15_LOCAL_H_
+
+#include <machine/dsp.h>
+
+/* W^k for the largest FFT, over three quarters of a turn.  */
+#define Q15_TWIDDLES	(3 << (Q15_FFT_MAXLOG2 - 2))
+
+extern const q15c_t __q15_twiddle[Q15_TWIDDLES]
+  __attribute__ ((space (auto_psv)));
+
+/* The butterflies of an FFT of points already in bit-reversed order:
+   a radix-2 pass first if log2n is odd, then radix-4 passes.  Each
+   pass halves or quarters its results when SCALE is nonzero.  The
+   last argument is __q15_twiddle, which C code can point to whether
+   or not constants are in the PSV window.  */
+void	__q15_dit (q15c_t *, unsigned int, int, const q15c_t *);
+
+#endif /* _Q15_LOCAL_H_ */
@@ -0,0 +1,99 @@
+/* Q15 matrix products and transposes for pic30, see
+   <machine/matrix.h>.  On DSP parts the products are in q15_mat_t.S;
+   the portable versions here follow their arithmetic.  */
+
+#include <machine/matrix.h>
+
+void
+q15_mat_trans (q15_t *d,
+	const q15_t *s,
+	unsigned int m,
+	unsigned int n)
+{
+  unsigned int i, j;
+
+  for (i = 0; i < m; i++, d++)
+    for (j = 0; j < n; j++)
+      d[j * m] = *s++;
+}
+
+void
+q15_mat_mul (q15_t *c,
+	const q15_t *a,
+	const q15_t *b,
+	q15_t *bt,
+	unsigned int m,
+	unsigned int n,
+	unsigned int p)
+{
+  q15_mat_trans (bt, b, n, p);
+  q15_mat_mul_t (c, a, bt, m, n, p);
+}
+
+void
+q15_mat_mul_q31 (q31_t *c,
+	const q15_t *a,
+	const q15_t *b,
+	q15_t *bt,
+	unsigned int m,
+	unsigned int n,
+	unsigned int p)
+{
+  q15_mat_trans (bt, b, n, p);
+  q15_mat_mul_t_q31 (c, a, bt, m, n, p);
+}
+
+#ifndef __HAS_DSP__
+
+static long long
+dot (const q15_t *x, const q15_t *y, unsigned int n)
+{
+  long long acc = 0;
+
+  while (n-- != 0)
+    acc += (long) *x++ * *y++;
+  return acc;
+}
+
+void
+q15_mat_mul_t (q15_t *c,
+	const q15_t *a,
+	const q15_t *bt,
+	unsigned int m,
+	unsigned int n,
+	unsigned int p)
+{
+  const q15_t *b;
+  long long acc;
+  unsigned int j;
+
+  for (; m != 0; m--, a += n)
+    for (j = 0, b = bt; j < p; j++, b += n)
+      {
+	acc = (dot (a, b, n) + 0x4000) >> 15;
+	*c++ = acc > 32767 ? 32767 : acc < -32768 ? -32768 : (q15_t) acc;
+      }
+}
+
+void
+q15_mat_mul_t_q31 (q31_t *c,
+	const q15_t *a,
+	const q15_t *bt,
+	unsigned int m,
+	unsigned int n,
+	unsigned int p)
+{
+  const q15_t *b;
+  long long acc;
+  unsigned int j;
+
+  for (; m != 0; m--, a += n)
+    for (j = 0, b = bt; j < p; j++, b += n)
+      {
+	acc = dot (a, b, n) << 1;
+	*c++ = acc > 0x7fffffffLL ? 0x7fffffffL
+	       : acc < -0x7fffffffLL - 1 ? -0x7fffffffL - 1 : (q31_t) acc;
+      }
+}
+
+#endif /* !__HAS_DSP__ */
@@ -0,0 +1,39 @@
+/* cosf for pic30, evaluated entirely in float; see sincosf_kernel.h.  */
+
+#include "fdlibm.h"
+#include "sincosf_kernel.h"
+
+float
+cosf (float x)
+{
+  float r, r2;
+  __int32_t ix;
+  int n;
+
+  GET_FLOAT_WORD (ix, x);
+  ix &= 0x7fffffff;
+  if (ix < 0x39800000)			/* |x| < 2^-12 */
+    return 1.0f;
+  if (!FLT_UWORD_IS_FINITE (ix))	/* cos(Inf or NaN) is NaN */
+    return x - x;
+
+  r = __kernel_reducef (x, ix, &n);
+  r2 = r * r;
+  switch (n)
+    {
+    case 0: return __kernel_cospf (r2);
+    case 1: return -__kernel_sinpf (r, r2);
+    case 2: return -__kernel_cospf (r2);
+    default: return __kernel_sinpf (r, r2);
+    }
+}
+
+#ifdef _DOUBLE_IS_32BITS
+
+double
+cos (double x)
+{
+  return (double) cosf ((float) x);
+}
+
+#endif /* defined(_DOUBLE_IS_32BITS) */
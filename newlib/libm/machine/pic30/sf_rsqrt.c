@@ -0,0 +1,27 @@
+/* rsqrtf for pic30, see <machine/fastmath.h>.  */
+
+#include <machine/fastmath.h>
+#include "fdlibm.h"
+#include "sqrt_local.h"
+
+float
+rsqrtf (float x)
+{
+  __uint32_t y;
+  __int32_t ix, hx;
+  int e;
+
+  GET_FLOAT_WORD (ix, x);
+  hx = ix & 0x7fffffff;
+  if (ix < 0 && !FLT_UWORD_IS_ZERO (hx))
+    return (x - x) / (x - x);		/* rsqrt(-ve) = NaN */
+  if (!FLT_UWORD_IS_FINITE (hx))
+    return ix == 0x7f800000 ? 0 : x + x;	/* rsqrt(+inf) = 0 */
+  if (FLT_UWORD_IS_ZERO (hx))
+    return 1 / x;			/* rsqrt(+-0) = +-inf */
+
+  /* x = a 2^(2e), so 1 / sqrt (x) = y 2^-e with 1 < y <= 2.  */
+  y = __sqrt_recip (__sqrt_split (ix, &e));
+  SET_FLOAT_WORD (x, ((y + 64) >> 7) + ((__int32_t) (126 - e) << 23));
+  return x;
+}
@@ -0,0 +1,43 @@
+/* sinf for pic30, evaluated entirely in float; see sincosf_kernel.h.
+
+   Below 2^7 * pi/2 it takes at most 4000 cycles, 5500 on the parts
+   with EDS, as newlib.bench/wcet.c checks.  Larger arguments go
+   through __ieee754_rem_pio2f and are not bounded here.  */
+
+#include "fdlibm.h"
+#include "sincosf_kernel.h"
+
+float
+sinf (float x)
+{
+  float r, r2;
+  __int32_t ix;
+  int n;
+
+  GET_FLOAT_WORD (ix, x);
+  ix &= 0x7fffffff;
+  if (ix < 0x39800000)			/* |x| < 2^-12 */
+    return x;
+  if (!FLT_UWORD_IS_FINITE (ix))	/* sin(Inf or NaN) is NaN */
+    return x - x;
+
+  r = __kernel_reducef (x, ix, &n);
+  r2 = r * r;
+  switch (n)
+    {
+    case 0: return __kernel_sinpf (r, r2);
+    case 1: return __kernel_cospf (r2);
+    case 2: return -__kernel_sinpf (r, r2);
+    default: return -__kernel_cospf (r2);
+    }
+}
+
+#ifdef _DOUBLE_IS_32BITS
+
+double
+sin (double x)
+{
+  return (double) sinf ((float) x);
+}
+
+#endif /* defined(_DOUBLE_IS_32BITS) */
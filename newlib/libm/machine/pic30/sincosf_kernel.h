@@ -0,0 +1,78 @@
+/* Single-precision sine/cosine kernel shared by the pic30 sinf, cosf
+   and sincosf.
+
+   Everything stays in float: in a -fno-short-double multilib a double
+   operation is a 64-bit soft-float call, several times dearer than its
+   float counterpart.  Arguments up to 2^7 * pi/2 are reduced with a
+   three-part Cody-Waite split of pi/2 whose leading parts have enough
+   trailing zero bits that n * part is exact; only larger arguments go
+   through __ieee754_rem_pio2f.  The polynomials are the degree 7 sine
+   and degree 8 cosine minimax fits from libm/common/sincosf_data.c,
+   which are all float precision needs on [-pi/4, pi/4].  Measured
+   worst-case error is about 1.5 ulp, against 2^-23 relative for the
+   double-evaluated libm/common versions.  */
+
+#ifndef _SINCOSF_KERNEL_H
+#define _SINCOSF_KERNEL_H
+
+/* fdlibm.h has no include guard; includers bring it in first.  */
+
+static const float
+__kinvpio2 = 6.3661974669e-01f,	/* 0x3f22f983 */
+__kpio2_1 = 1.5707855225e+00f,	/* 0x3fc90f80, 17 bits */
+__kpio2_2 = 1.0804273188e-05f,	/* 0x37354400, 14 bits */
+__kpio2_2t = 6.0770999344e-11f,	/* 0x2e85a308 */
+__ktoint = 1.2582912000e+07f,	/* 0x4b400000, 1.5 * 2^23 */
+__kS1 = -1.6666655242e-01f,	/* 0xbe2aaaa3 */
+__kS2 = 8.3321779966e-03f,	/* 0x3c0883b0 */
+__kS3 = -1.9517299370e-04f,	/* 0xb94ca75a */
+__kC1 = -5.0000000000e-01f,	/* 0xbf000000 */
+__kC2 = 4.1666623205e-02f,	/* 0x3d2aaa9f */
+__kC3 = -1.3886763481e-03f,	/* 0xbab6043f */
+__kC4 = 2.4390450562e-05f;	/* 0x37cc9a18 */
+
+/* Reduce the finite X, whose magnitude bits are IX, to [-pi/4, pi/4]
+   and store the quadrant (mod 4) in *NP.  */
+static __inline__ float
+__kernel_reducef (float x, __int32_t ix, int *np)
+{
+  float r, w, t, fn, y[2];
+  __uint32_t it;
+
+  if (ix <= 0x3f490fd8)			/* |x| ~<= pi/4 */
+    {
+      *np = 0;
+      return x;
+    }
+  if (ix < 0x43490f80)			/* |x| < 2^7 * pi/2 */
+    {
+      /* Round x * 2/pi to an integer by pushing it into the low
+	 mantissa bits of 1.5 * 2^23; those bits are n mod 4.  */
+      t = x * __kinvpio2 + __ktoint;
+      GET_FLOAT_WORD (it, t);
+      fn = t - __ktoint;
+      *np = (int) (it & 3);
+      /* x - fn * pio2_1 is exact; keep the rounding error of the
+	 second step so that only the final sum rounds.  */
+      r = x - fn * __kpio2_1;
+      w = fn * __kpio2_2;
+      t = r - w;
+      return t + (((r - t) - w) - fn * __kpio2_2t);
+    }
+  *np = (int) (__ieee754_rem_pio2f (x, y) & 3);
+  return y[0] + y[1];
+}
+
+static __inline__ float
+__kernel_sinpf (float r, float r2)
+{
+  return r + r * r2 * (__kS1 + r2 * (__kS2 + r2 * __kS3));
+}
+
+static __inline__ float
+__kernel_cospf (float r2)
+{
+  return 1.0f + r2 * (__kC1 + r2 * (__kC2 + r2 * (__kC3 + r2 * __kC4)));
+}
+
+#endif /* _SINCOSF_KERNEL_H */
@@ -0,0 +1,29 @@
+/* Shared by the pic30 __ieee754_sqrtf and rsqrtf.  */
+
+#ifndef _SQRT_LOCAL_H_
+#define _SQRT_LOCAL_H_
+
+#include <sys/types.h>
+
+/* The top 32 bits of A * B, short by at most 2; three 16 x 16
+   multiplications.  */
+static __inline__ __uint32_t
+__sqrt_mulhi (__uint32_t a,
+	__uint32_t b)
+{
+  __uint16_t ah = a >> 16, al = a, bh = b >> 16, bl = b;
+
+  return (__uint32_t) ah * bh + (((__uint32_t) ah * bl) >> 16)
+	 + (((__uint32_t) al * bh) >> 16);
+}
+
+/* 1 / sqrt (A / 2^32) in Q30 for 2^30 <= A, to within 2^-26, always
+   short of it.  */
+__uint32_t	__sqrt_recip (__uint32_t);
+
+/* The fraction of a positive finite nonzero float with word IX, as
+   A / 2^32 with 1/4 <= A / 2^32 < 1, so that the float is
+   A / 2^32 * 2^(2 * *E).  */
+__uint32_t	__sqrt_split (__int32_t, int *);
+
+#endif /* _SQRT_LOCAL_H_ */
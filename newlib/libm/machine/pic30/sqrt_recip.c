@@ -0,0 +1,54 @@
+/* The reciprocal square root seed and Newton steps behind the pic30
+   __ieee754_sqrtf and rsqrtf, see sqrt_local.h.  */
+
+#include "sqrt_local.h"
+
+/* 1 / sqrt (a) in Q15 for a in [i / 128, (i + 1) / 128), 32 <= i < 128,
+   balanced so that the relative error is at most 2^-7.  */
+static const __uint16_t sqrt_seed[96]
+  __attribute__ ((space (auto_psv))) =
+{
+  65032, 64054, 63119, 62223, 61365, 60541, 59749, 58988, 58255, 57549,
+  56868, 56211, 55575, 54961, 54367, 53792, 53234, 52694, 52169, 51660,
+  51166, 50685, 50218, 49764, 49321, 48891, 48471, 48062, 47663, 47274,
+  46894, 46523, 46161, 45808, 45462, 45124, 44793, 44470, 44153, 43843,
+  43540, 43243, 42952, 42666, 42386, 42112, 41843, 41579, 41320, 41066,
+  40816, 40571, 40330, 40093, 39861, 39633, 39408, 39187, 38970, 38757,
+  38547, 38340, 38136, 37936, 37739, 37545, 37354, 37166, 36981, 36798,
+  36618, 36441, 36266, 36094, 35924, 35756, 35591, 35428, 35268, 35109,
+  34953, 34798, 34646, 34496, 34347, 34201, 34056, 33913, 33772, 33633,
+  33496, 33360, 33225, 33093, 32962, 32832
+};
+
+/* Each step of y = y (3 - a y^2) / 2 takes a relative error e to
+   1.5 e^2, so two reach 2^-26.  */
+__uint32_t
+__sqrt_recip (__uint32_t a)
+{
+  __uint32_t y = (__uint32_t) sqrt_seed[(a >> 25) - 32] << 15;
+  int i;
+
+  for (i = 0; i < 2; i++)
+    y = __sqrt_mulhi (y, 0xc0000000UL
+		      - (__sqrt_mulhi (__sqrt_mulhi (a, y), y) << 2)) << 1;
+  return y;
+}
+
+__uint32_t
+__sqrt_split (__int32_t ix,
+	int *e)
+{
+  int m = (ix >> 23) - 127;
+
+  if (m == -127)
+    {
+      /* Subnormal: normalize.  */
+      for (m = -126; (ix & 0x00800000L) == 0; m--)
+	ix <<= 1;
+    }
+  ix = (ix & 0x007fffffL) | 0x00800000L;
+  /* x = ix / 2^24 * 2^m; halve the fraction again if m is odd.  */
+  m++;
+  *e = (m + 1) >> 1;
+  return (__uint32_t) ix << ((m & 1) ? 7 : 8);
+}
@@ -0,0 +1,53 @@
+/* sincosf for pic30: one range reduction and r * r shared by both
+   results, all in float; see sincosf_kernel.h.  */
+
+#include "fdlibm.h"
+#include "sincosf_kernel.h"
+
+void
+sincosf (float x, float *sinx, float *cosx)
+{
+  float r, r2, s, c;
+  __int32_t ix;
+  int n;
+
+  GET_FLOAT_WORD (ix, x);
+  ix &= 0x7fffffff;
+  if (ix < 0x39800000)			/* |x| < 2^-12 */
+    {
+      *sinx = x;
+      *cosx = 1.0f;
+      return;
+    }
+  if (!FLT_UWORD_IS_FINITE (ix))
+    {
+      *sinx = *cosx = x - x;
+      return;
+    }
+
+  r = __kernel_reducef (x, ix, &n);
+  r2 = r * r;
+  s = __kernel_sinpf (r, r2);
+  c = __kernel_cospf (r2);
+  switch (n)
+    {
+    case 0: *sinx = s; *cosx = c; break;
+    case 1: *sinx = c; *cosx = -s; break;
+    case 2: *sinx = -s; *cosx = -c; break;
+    default: *sinx = -c; *cosx = s; break;
+    }
+}
+
+#ifdef _DOUBLE_IS_32BITS
+
+void
+sincos (double x, double *sinx, double *cosx)
+{
+  float s, c;
+
+  sincosf ((float) x, &s, &c);
+  *sinx = (double) s;
+  *cosx = (double) c;
+}
+
+#endif /* defined(_DOUBLE_IS_32BITS) */
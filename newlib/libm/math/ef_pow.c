@@ -113,6 +113,25 @@ ivln2_l  =  7.0526075433e-06; /* 0x36eca570 =1/ln2 tail*/
 	    if(hy<0) return one/x; else return x;
 	}
 	if(hy==0x40000000) return x*x; /* y is  2 */
+	if(iy>0x3f800000&&iy<=(hy>0? 0x40800000: 0x40000000)) {
+	/* y = 3, 4 or -2: square and multiply, within 2 ulp.
+	   x**-n is 1/(x**n) unless that is infinite, zero or subnormal,
+	   which the general code below gets right */
+	    k = (iy>>23)-0x7f;
+	    j = (iy&0x7fffff)|0x800000;
+	    if(((j>>(23-k))<<(23-k))==j) {
+		j >>= 23-k;
+		z = (j&1)? x: one;
+		t = x*x;
+		if(j&2) z *= t;
+		if(j&4) z *= t*t;
+		if(hy>0) return z;
+		GET_FLOAT_WORD(is,z);
+		is &= 0x7fffffff;
+		if(is>=0x00800000&&FLT_UWORD_IS_FINITE(is))
+		    return one/z;
+	    }
+	}
 	if(hy==0x3f000000) {	/* y is  0.5 */
 	    if(hx>=0)	/* x >= +0 */
 	    return __ieee754_sqrtf(x);	
@@ -60,10 +60,14 @@ PORTABILITY
 	double value; int exp;
 #endif
 {
+#ifdef _IEEE_LIBM
+	return scalbn(value,exp);
+#else
 	if(!finite(value)||value==0.0) return value;
 	value = scalbn(value,exp);
 	if(!finite(value)||value==0.0) errno = ERANGE;
 	return value;
+#endif
 }
 
 #endif /* _DOUBLE_IS_32BITS */
@@ -26,9 +26,9 @@
 	float x;
 #endif
 {
-	__uint32_t ix;
-	GET_FLOAT_WORD(ix,x);
-	SET_FLOAT_WORD(x,ix&0x7fffffff);
+	__uint16_t hx;
+	GET_FLOAT_HI16(hx,x);
+	SET_FLOAT_HI16(x,hx&0x7fff);
         return x;
 }
 
@@ -17,7 +17,7 @@
  * floorf(x)
  * Return x rounded toward -inf to integral value
  * Method:
- *	Bit twiddling.
+ *	Bit twiddling, on the high 16 bits alone when |x| < 128.
  * Exception:
  *	Inexact flag raised if x not equal to floorf(x).
  */
@@ -39,24 +39,38 @@ static float huge = 1.0e30;
 {
 	__int32_t i0,j0;
 	__uint32_t i,ix;
-	GET_FLOAT_WORD(i0,x);
-	ix = (i0&0x7fffffff);
-	j0 = (ix>>23)-0x7f;
-	if(j0<23) {
+	__uint16_t hi,lo,m;
+	GET_FLOAT_HI16(hi,x);
+	j0 = ((hi>>7)&0xff)-0x7f;
+	if(j0<7) {	/* the integer part is all in the high half */
+	    GET_FLOAT_LO16(lo,x);
 	    if(j0<0) { 	/* raise inexact if x != 0 */
 		if(huge+x>(float)0.0) {/* return 0*sign(x) if |x|<1 */
-		    if(i0>=0) {i0=0;} 
-		    else if(!FLT_UWORD_IS_ZERO(ix))
-			{ i0=0xbf800000;}
+		    if((hi&0x8000)==0) {hi=0;}
+		    else if(((hi&0x7fff)|lo)!=0) { hi=0xbf80;}
+		    lo=0;
 		}
 	    } else {
-		i = (0x007fffff)>>j0;
-		if((i0&i)==0) return x; /* x is integral */
+		m = (0x007f)>>j0;
+		if(((hi&m)|lo)==0) return x; /* x is integral */
 		if(huge+x>(float)0.0) {	/* raise inexact flag */
-		    if(i0<0) i0 += (0x00800000)>>j0;
-		    i0 &= (~i);
+		    if((hi&0x8000)!=0) hi += (0x0080)>>j0;
+		    hi &= (~m);
+		    lo = 0;
 		}
 	    }
+	    INSERT_FLOAT_HALVES(x,hi,lo);
+	    return x;
+	}
+	GET_FLOAT_WORD(i0,x);
+	ix = (i0&0x7fffffff);
+	if(j0<23) {
+	    i = (0x007fffff)>>j0;
+	    if((i0&i)==0) return x; /* x is integral */
+	    if(huge+x>(float)0.0) {	/* raise inexact flag */
+		if(i0<0) i0 += (0x00800000)>>j0;
+		i0 &= (~i);
+	    }
 	} else {
 	    if(!FLT_UWORD_IS_FINITE(ix)) return x+x;	/* inf or NaN */
 	    else return x;		/* x is integral */
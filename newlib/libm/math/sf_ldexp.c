@@ -23,10 +23,14 @@
 	float value; int exp;
 #endif
 {
+#ifdef _IEEE_LIBM
+	return scalbnf(value,exp);
+#else
 	if(!finitef(value)||value==(float)0.0) return value;
 	value = scalbnf(value,exp);
 	if(!finitef(value)||value==(float)0.0) errno = ERANGE;
 	return value;
+#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
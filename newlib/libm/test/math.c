@@ -23,6 +23,7 @@
 #include <math.h>
 #include <errno.h>
 #include <stdio.h>
+#include "../../testsuite/include/bench.h"
 
 int inacc;
 
@@ -37,7 +38,7 @@ void translate_to (FILE *file,
 	    double r)
 {
   __ieee_double_shape_type bits;
-  bits.value = r;
+  double_parts (r, &bits);
   fprintf(file, "0x%08x, 0x%08x", bits.parts.msw, bits.parts.lsw);
 }
 
@@ -51,12 +52,12 @@ ffcheck (double is,
   /* Make sure the answer isn't to far wrong from the correct value */
   __ieee_double_shape_type correct, isbits;
   int mag;  
-  isbits.value = is;
+  double_parts (is, &isbits);
   
   correct.parts.msw = p->qs[0].msw;
   correct.parts.lsw = p->qs[0].lsw;
   
-  mag = mag_of_error(correct.value, is);
+  mag = mag_of_error(thedouble (correct.parts.msw, correct.parts.lsw), is);
   
   if (mag < p->error_bit)
   {
@@ -68,7 +69,7 @@ ffcheck (double is,
 	   correct.parts.lsw,
 	   isbits.parts.msw,
 	   isbits.parts.lsw,
-	   correct.value, is);
+	   thedouble (correct.parts.msw, correct.parts.lsw), is);
   }      
   
 #if 0
@@ -89,15 +90,157 @@ ffcheck (double is,
   return mag;
 }
 
+/* The vectors hold IEEE double bit patterns.  Where double is only
+   as wide as a float they are converted by hand, rounding once.  */
 double
 thedouble (long msw,
        long lsw)
 {
+#ifdef _DOUBLE_IS_32BITS
+  unsigned long hi = msw, lo = lsw;
+  unsigned long frac;
+  int exp = (hi >> 20) & 0x7ff;
+  double x;
+
+  /* The top 32 bits of the significand, with the rest folded into
+     the lowest so that the conversion rounds as the exact value.  */
+  frac = ((hi & 0xfffff) << 11) | (lo >> 21) | ((lo & 0x1fffff) != 0);
+  if (exp == 0x7ff)
+    x = frac ? NAN : INFINITY;
+  else if (exp == 0)
+    x = ldexp ((double) frac, -1022 - 31);
+  else
+    x = ldexp ((double) (frac | 0x80000000UL), exp - 1023 - 31);
+  return hi & 0x80000000UL ? -x : x;
+#else
   __ieee_double_shape_type x;
   
   x.parts.msw = msw;
   x.parts.lsw = lsw;
   return x.value;
+#endif
+}
+
+/* The inverse of thedouble.  */
+void
+double_parts (double value,
+       __ieee_double_shape_type *bits)
+{
+#ifdef _DOUBLE_IS_32BITS
+  unsigned long sign = signbit (value) ? 0x80000000UL : 0;
+  unsigned long frac;
+  int exp;
+
+  value = fabs (value);
+  if (isnan (value))
+    {
+      bits->parts.msw = sign | 0x7ff80000UL;
+      bits->parts.lsw = 0;
+    }
+  else if (isinf (value))
+    {
+      bits->parts.msw = sign | 0x7ff00000UL;
+      bits->parts.lsw = 0;
+    }
+  else if (value == 0)
+    {
+      bits->parts.msw = sign;
+      bits->parts.lsw = 0;
+    }
+  else
+    {
+      /* Exact: the significand has no more than 32 bits.  */
+      frac = (unsigned long) ldexp (frexp (value, &exp), 32);
+      bits->parts.msw = sign | ((unsigned long) (exp + 1022) << 20)
+			| ((frac >> 11) & 0xfffff);
+      bits->parts.lsw = frac << 21;
+    }
+#else
+  bits->value = value;
+#endif
+}
+
+/* With -bench each call is timed, repeated TIMING_REPS times, and
+   every function gets one line giving the average cost of a call and
+   the largest error seen, in units in the last place of its result
+   type, after the usual checks:
+
+	bench <name> <calls> cycles=<n> ulp=<max>
+
+   Lines with an error_bit of 0, an expected errno or an expected value
+   of 0 are timed but leave the error alone: they test arguments for
+   which no answer is meaningful, the old matherr return value or a
+   result whose last place is not defined.  */
+int timing;
+
+static unsigned long cycles;
+static unsigned long calls;
+static double max_ulp;
+static bench_t timing_overhead;
+
+#define TIMED(call)						\
+  do								\
+    {								\
+      bench_t t0_ = bench_now ();				\
+      int i_ = 0;						\
+								\
+      do							\
+	result = (call);					\
+      while (++i_ < timing);					\
+      cycles += bench_now () - t0_;				\
+      calls++;							\
+    }								\
+  while (0)
+
+static double
+ulp_error (double is,
+       double shouldbe,
+       int mant_dig,
+       int min_exp)
+{
+  int e;
+
+  if (is == shouldbe || (isnan (is) && isnan (shouldbe)))
+    return 0;
+  if (!finite (is) || !finite (shouldbe))
+    return HUGE_VAL;
+  frexp (shouldbe, &e);
+  if (shouldbe == 0 || e < min_exp)
+    e = min_exp;
+  return fabs (is - shouldbe) / ldexp (1.0, e - mant_dig);
+}
+
+static void
+timing_start (void)
+{
+  volatile double zero = 0;
+  double result;
+
+  cycles = 0;
+  calls = 0;
+  max_ulp = 0;
+  if (!timing_overhead)
+    {
+      TIMED (zero);
+      timing_overhead = cycles;
+      cycles = 0;
+      calls = 0;
+    }
+}
+
+static void
+timing_report (char *name)
+{
+  unsigned long per_call = 0;
+
+  if (calls)
+    {
+      per_call = cycles / calls;
+      per_call = per_call > timing_overhead ? per_call - timing_overhead : 0;
+      per_call /= timing;
+    }
+  printf ("bench %s %lu cycles=%lu ulp=%.2f\n", name, calls, per_call,
+	  max_ulp);
 }
 
 int calc;
@@ -166,6 +309,20 @@ finish (FILE *f,
   int mag;
 
   mag = ffcheck(result, p,name,  merror, errno);    
+  if (timing && p->error_bit && !p->errno_val)
+  {
+    double correct = thedouble(p->qs[0].msw, p->qs[0].lsw);
+    double ulp = 0;
+
+    if (correct == 0)
+      ;
+    else if (args[0] == 'f')
+      ulp = ulp_error(result, correct, FLT_MANT_DIG, FLT_MIN_EXP);
+    else
+      ulp = ulp_error(result, correct, DBL_MANT_DIG, DBL_MIN_EXP);
+    if (ulp > max_ulp)
+      max_ulp = ulp;
+  }
   if (vector) 
   {    
     frontline(f, mag, p, result, merror, errno, args , name);
@@ -228,6 +385,8 @@ run_vector_1 (int vector,
   }
  
   newfunc(name);
+  if (timing)
+    timing_start();
   while (p->line) 
   {
     double arg1 = thedouble(p->qs[1].msw, p->qs[1].lsw);
@@ -252,7 +411,7 @@ run_vector_1 (int vector,
       
       /* Double function returning a double */
       
-      result = ((pdblfunc)(func))(arg1);
+      TIMED(((pdblfunc)(func))(arg1));
       
       finish(f,vector, result, p, args, name);       
     }  
@@ -268,7 +427,7 @@ run_vector_1 (int vector,
       if (arg1 < FLT_MAX )
       {
 	arga = arg1;      
-	result = ((pdblfunc)(func))(arga);
+	TIMED(((pdblfunc)(func))(arga));
 	finish(f, vector, result, p,args, name);       
       }
     }      
@@ -276,7 +435,7 @@ run_vector_1 (int vector,
      {
        typedef double (*pdblfunc) (double,double);
       
-       result = ((pdblfunc)(func))(arg1,arg2);
+       TIMED(((pdblfunc)(func))(arg1,arg2));
        finish(f, vector, result, p,args, name);       
      }  
      else  if (strcmp(args,"fff")==0)
@@ -293,7 +452,7 @@ run_vector_1 (int vector,
        {
 	 arga = arg1;      
 	 argb = arg2;
-	 result = ((pdblfunc)(func))(arga, argb);
+	 TIMED(((pdblfunc)(func))(arga, argb));
 	 finish(f, vector, result, p,args, name);       
        }
      }      
@@ -301,7 +460,7 @@ run_vector_1 (int vector,
      {
        typedef double (*pdblfunc) (int,double);
       
-       result = ((pdblfunc)(func))((int)arg1,arg2);
+       TIMED(((pdblfunc)(func))((int)arg1,arg2));
        finish(f, vector, result, p,args, name);       
      }  
      else  if (strcmp(args,"fif")==0)
@@ -318,13 +477,15 @@ run_vector_1 (int vector,
        {
 	 arga = arg1;      
 	 argb = arg2;
-	 result = ((pdblfunc)(func))((int)arga, argb);
+	 TIMED(((pdblfunc)(func))((int)arga, argb));
 	 finish(f, vector, result, p,args, name);       
        }
      }      
 
     p++;
   }
+  if (timing)
+    timing_report(name);
   if (vector)
   {
     VECCLOSE(f, name, args);
@@ -334,6 +495,8 @@ run_vector_1 (int vector,
 void
 test_math (void)
 {
+  if (timing)
+    bench_init("libm");
   test_acos(0);
   test_acosf(0);
   test_acosh(0);
@@ -384,6 +547,7 @@ test_math (void)
   test_log2(0);
   test_log2f(0);
   test_logf(0);
+  test_powf(0);
   test_sin(0);
   test_sinf(0);
   test_sinh(0);
@@ -0,0 +1,112 @@
+#include "test.h"
+ one_line_type powf_vec[] = {
+{28, 0,123,__LINE__, 0x40200000, 0x00000000, 0x3fe00000, 0x00000000, 0xc0080000, 0x00000000},	/* 8=f(0.5, -3)*/
+{28, 0,123,__LINE__, 0x4006a09e, 0x667f3bcd, 0x3fe00000, 0x00000000, 0xbff80000, 0x00000000},	/* 2.82843=f(0.5, -1.5)*/
+{28, 0,123,__LINE__, 0x3ff6a09e, 0x667f3bcd, 0x3fe00000, 0x00000000, 0xbfe00000, 0x00000000},	/* 1.41421=f(0.5, -0.5)*/
+{28, 0,123,__LINE__, 0x3feae89f, 0x995ad3ad, 0x3fe00000, 0x00000000, 0x3fd00000, 0x00000000},	/* 0.840896=f(0.5, 0.25)*/
+{28, 0,123,__LINE__, 0x3fe6a09e, 0x667f3bcd, 0x3fe00000, 0x00000000, 0x3fe00000, 0x00000000},	/* 0.707107=f(0.5, 0.5)*/
+{28, 0,123,__LINE__, 0x3fd306fe, 0x0a31b715, 0x3fe00000, 0x00000000, 0x3ffc0000, 0x00000000},	/* 0.297302=f(0.5, 1.75)*/
+{28, 0,123,__LINE__, 0x3fc00000, 0x00000000, 0x3fe00000, 0x00000000, 0x40080000, 0x00000000},	/* 0.125=f(0.5, 3)*/
+{28, 0,123,__LINE__, 0x3f79fdf8, 0x83275843, 0x3fe00000, 0x00000000, 0x401d3333, 0x40000000},	/* 0.00634572=f(0.5, 7.3)*/
+{28, 0,123,__LINE__, 0x3ff5f2a7, 0xf8be1927, 0x3feccccc, 0xc0000000, 0xc0080000, 0x00000000},	/* 1.37174=f(0.9, -3)*/
+{28, 0,123,__LINE__, 0x3ff2bd4a, 0xe2c1203b, 0x3feccccc, 0xc0000000, 0xbff80000, 0x00000000},	/* 1.17121=f(0.9, -1.5)*/
+{28, 0,123,__LINE__, 0x3ff0dd90, 0x2afbb241, 0x3feccccc, 0xc0000000, 0xbfe00000, 0x00000000},	/* 1.05409=f(0.9, -0.5)*/
+{28, 0,123,__LINE__, 0x3fef2b09, 0xe42bf0b0, 0x3feccccc, 0xc0000000, 0x3fd00000, 0x00000000},	/* 0.974004=f(0.9, 0.25)*/
+{28, 0,123,__LINE__, 0x3fee5b9d, 0x0cad671f, 0x3feccccc, 0xc0000000, 0x3fe00000, 0x00000000},	/* 0.948683=f(0.9, 0.5)*/
+{28, 0,123,__LINE__, 0x3fea9c9f, 0x525d06c1, 0x3feccccc, 0xc0000000, 0x3ffc0000, 0x00000000},	/* 0.831619=f(0.9, 1.75)*/
+{28, 0,123,__LINE__, 0x3fe753f7, 0xafbe76d7, 0x3feccccc, 0xc0000000, 0x40080000, 0x00000000},	/* 0.729=f(0.9, 3)*/
+{28, 0,123,__LINE__, 0x3fdda898, 0x02bcdb5e, 0x3feccccc, 0xc0000000, 0x401d3333, 0x40000000},	/* 0.463415=f(0.9, 7.3)*/
+{28, 0,123,__LINE__, 0x3fe80ac5, 0x3c21a447, 0x3ff19999, 0xa0000000, 0xc0080000, 0x00000000},	/* 0.751315=f(1.1, -3)*/
+{28, 0,123,__LINE__, 0x3febbcb2, 0x19d25d21, 0x3ff19999, 0xa0000000, 0xbff80000, 0x00000000},	/* 0.866784=f(1.1, -1.5)*/
+{28, 0,123,__LINE__, 0x3fee82c3, 0xf44c7a7b, 0x3ff19999, 0xa0000000, 0xbfe00000, 0x00000000},	/* 0.953463=f(1.1, -0.5)*/
+{28, 0,123,__LINE__, 0x3ff062c5, 0x0a9d667e, 0x3ff19999, 0xa0000000, 0x3fd00000, 0x00000000},	/* 1.02411=f(1.1, 0.25)*/
+{28, 0,123,__LINE__, 0x3ff0c7eb, 0xcc776a8e, 0x3ff19999, 0xa0000000, 0x3fe00000, 0x00000000},	/* 1.04881=f(1.1, 0.5)*/
+{28, 0,123,__LINE__, 0x3ff2e776, 0x7f9bca77, 0x3ff19999, 0xa0000000, 0x3ffc0000, 0x00000000},	/* 1.18151=f(1.1, 1.75)*/
+{28, 0,123,__LINE__, 0x3ff54bc6, 0xbf2b0215, 0x3ff19999, 0xa0000000, 0x40080000, 0x00000000},	/* 1.331=f(1.1, 3)*/
+{28, 0,123,__LINE__, 0x40000abc, 0x0a9cc51c, 0x3ff19999, 0xa0000000, 0x401d3333, 0x40000000},	/* 2.00524=f(1.1, 7.3)*/
+{28, 0,123,__LINE__, 0x3fd2f684, 0xbda12f68, 0x3ff80000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.296296=f(1.5, -3)*/
+{28, 0,123,__LINE__, 0x3fe16b28, 0xf55d72d4, 0x3ff80000, 0x00000000, 0xbff80000, 0x00000000},	/* 0.544331=f(1.5, -1.5)*/
+{28, 0,123,__LINE__, 0x3fea20bd, 0x700c2c3e, 0x3ff80000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.816497=f(1.5, -0.5)*/
+{28, 0,123,__LINE__, 0x3ff1b4f8, 0x19c2ff81, 0x3ff80000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.10668=f(1.5, 0.25)*/
+{28, 0,123,__LINE__, 0x3ff3988e, 0x1409212e, 0x3ff80000, 0x00000000, 0x3fe00000, 0x00000000},	/* 1.22474=f(1.5, 0.5)*/
+{28, 0,123,__LINE__, 0x400043cc, 0x4bdde0e1, 0x3ff80000, 0x00000000, 0x3ffc0000, 0x00000000},	/* 2.0331=f(1.5, 1.75)*/
+{28, 0,123,__LINE__, 0x400b0000, 0x00000000, 0x3ff80000, 0x00000000, 0x40080000, 0x00000000},	/* 3.375=f(1.5, 3)*/
+{28, 0,123,__LINE__, 0x40334bc3, 0x8d7d5cfe, 0x3ff80000, 0x00000000, 0x401d3333, 0x40000000},	/* 19.296=f(1.5, 7.3)*/
+{28, 0,123,__LINE__, 0x3fc00000, 0x00000000, 0x40000000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.125=f(2, -3)*/
+{28, 0,123,__LINE__, 0x3fd6a09e, 0x667f3bcd, 0x40000000, 0x00000000, 0xbff80000, 0x00000000},	/* 0.353553=f(2, -1.5)*/
+{28, 0,123,__LINE__, 0x3fe6a09e, 0x667f3bcd, 0x40000000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.707107=f(2, -0.5)*/
+{28, 0,123,__LINE__, 0x3ff306fe, 0x0a31b715, 0x40000000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.18921=f(2, 0.25)*/
+{28, 0,123,__LINE__, 0x3ff6a09e, 0x667f3bcd, 0x40000000, 0x00000000, 0x3fe00000, 0x00000000},	/* 1.41421=f(2, 0.5)*/
+{28, 0,123,__LINE__, 0x400ae89f, 0x995ad3ad, 0x40000000, 0x00000000, 0x3ffc0000, 0x00000000},	/* 3.36359=f(2, 1.75)*/
+{28, 0,123,__LINE__, 0x40200000, 0x00000000, 0x40000000, 0x00000000, 0x40080000, 0x00000000},	/* 8=f(2, 3)*/
+{28, 0,123,__LINE__, 0x4063b2c4, 0xa7b0bab7, 0x40000000, 0x00000000, 0x401d3333, 0x40000000},	/* 157.587=f(2, 7.3)*/
+{28, 0,123,__LINE__, 0x3fb0624d, 0xd2f1a9fc, 0x40040000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.064=f(2.5, -3)*/
+{28, 0,123,__LINE__, 0x3fd030dc, 0x4ea03a72, 0x40040000, 0x00000000, 0xbff80000, 0x00000000},	/* 0.252982=f(2.5, -1.5)*/
+{28, 0,123,__LINE__, 0x3fe43d13, 0x6248490f, 0x40040000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.632456=f(2.5, -0.5)*/
+{28, 0,123,__LINE__, 0x3ff41e72, 0x84162a49, 0x40040000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.25743=f(2.5, 0.25)*/
+{28, 0,123,__LINE__, 0x3ff94c58, 0x3ada5b53, 0x40040000, 0x00000000, 0x3fe00000, 0x00000000},	/* 1.58114=f(2.5, 0.5)*/
+{28, 0,123,__LINE__, 0x4013e1bb, 0x8fe003a4, 0x40040000, 0x00000000, 0x3ffc0000, 0x00000000},	/* 4.97044=f(2.5, 1.75)*/
+{28, 0,123,__LINE__, 0x402f4000, 0x00000000, 0x40040000, 0x00000000, 0x40080000, 0x00000000},	/* 15.625=f(2.5, 3)*/
+{28, 0,123,__LINE__, 0x40891ba6, 0x0b01c339, 0x40040000, 0x00000000, 0x401d3333, 0x40000000},	/* 803.456=f(2.5, 7.3)*/
+{28, 0,123,__LINE__, 0x3fa08348, 0x89f64f1f, 0x400921fa, 0x00000000, 0xc0080000, 0x00000000},	/* 0.0322516=f(3.14159, -3)*/
+{28, 0,123,__LINE__, 0x3fc6fcb7, 0xcafb6ed9, 0x400921fa, 0x00000000, 0xbff80000, 0x00000000},	/* 0.179587=f(3.14159, -1.5)*/
+{28, 0,123,__LINE__, 0x3fe20dd7, 0xca79a3b0, 0x400921fa, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.56419=f(3.14159, -0.5)*/
+{28, 0,123,__LINE__, 0x3ff54d26, 0x075f4272, 0x400921fa, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.33134=f(3.14159, 0.25)*/
+{28, 0,123,__LINE__, 0x3ffc5bf7, 0xd1bb6651, 0x400921fa, 0x00000000, 0x3fe00000, 0x00000000},	/* 1.77245=f(3.14159, 0.5)*/
+{28, 0,123,__LINE__, 0x401da738, 0x82d8dc16, 0x400921fa, 0x00000000, 0x3ffc0000, 0x00000000},	/* 7.4133=f(3.14159, 1.75)*/
+{28, 0,123,__LINE__, 0x403f0196, 0x6ddca92c, 0x400921fa, 0x00000000, 0x40080000, 0x00000000},	/* 31.0062=f(3.14159, 3)*/
+{28, 0,123,__LINE__, 0x40b0a1dc, 0xbc6f9637, 0x400921fa, 0x00000000, 0x401d3333, 0x40000000},	/* 4257.86=f(3.14159, 7.3)*/
+{28, 0,123,__LINE__, 0x3f50624d, 0xd2f1a9fc, 0x40240000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.001=f(10, -3)*/
+{28, 0,123,__LINE__, 0x3fa030dc, 0x4ea03a72, 0x40240000, 0x00000000, 0xbff80000, 0x00000000},	/* 0.0316228=f(10, -1.5)*/
+{28, 0,123,__LINE__, 0x3fd43d13, 0x6248490f, 0x40240000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.316228=f(10, -0.5)*/
+{28, 0,123,__LINE__, 0x3ffc73d5, 0x1c54470e, 0x40240000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.77828=f(10, 0.25)*/
+{28, 0,123,__LINE__, 0x40094c58, 0x3ada5b53, 0x40240000, 0x00000000, 0x3fe00000, 0x00000000},	/* 3.16228=f(10, 0.5)*/
+{28, 0,123,__LINE__, 0x404c1df8, 0x0dec17af, 0x40240000, 0x00000000, 0x3ffc0000, 0x00000000},	/* 56.2341=f(10, 1.75)*/
+{28, 0,123,__LINE__, 0x408f4000, 0x00000000, 0x40240000, 0x00000000, 0x40080000, 0x00000000},	/* 1000=f(10, 3)*/
+{28, 0,123,__LINE__, 0x4173073f, 0x7e99cc9f, 0x40240000, 0x00000000, 0x401d3333, 0x40000000},	/* 1.99526e+07=f(10, 7.3)*/
+{28, 0,123,__LINE__, 0x408f3fff, 0xe890000c, 0x3fb99999, 0xa0000000, 0xc0080000, 0x00000000},	/* 1000=f(0.1, -3)*/
+{28, 0,123,__LINE__, 0x403f9f6e, 0x3db528cf, 0x3fb99999, 0xa0000000, 0xbff80000, 0x00000000},	/* 31.6228=f(0.1, -1.5)*/
+{28, 0,123,__LINE__, 0x40094c58, 0x37b0d04c, 0x3fb99999, 0xa0000000, 0xbfe00000, 0x00000000},	/* 3.16228=f(0.1, -0.5)*/
+{28, 0,123,__LINE__, 0x3fe1feb3, 0x3d3c2352, 0x3fb99999, 0xa0000000, 0x3fd00000, 0x00000000},	/* 0.562341=f(0.1, 0.25)*/
+{28, 0,123,__LINE__, 0x3fd43d13, 0x64cfeb7b, 0x3fb99999, 0xa0000000, 0x3fe00000, 0x00000000},	/* 0.316228=f(0.1, 0.5)*/
+{28, 0,123,__LINE__, 0x3f9235a7, 0x24565ee9, 0x3fb99999, 0xa0000000, 0x3ffc0000, 0x00000000},	/* 0.0177828=f(0.1, 1.75)*/
+{28, 0,123,__LINE__, 0x3f50624d, 0xdf3b645d, 0x3fb99999, 0xa0000000, 0x40080000, 0x00000000},	/* 0.001=f(0.1, 3)*/
+{28, 0,123,__LINE__, 0x3e6ae843, 0x3a912363, 0x3fb99999, 0xa0000000, 0x401d3333, 0x40000000},	/* 5.01187e-08=f(0.1, 7.3)*/
+{28, 0,123,__LINE__, 0x3eb0c6f7, 0xa0b5ed8d, 0x40590000, 0x00000000, 0xc0080000, 0x00000000},	/* 1e-06=f(100, -3)*/
+{28, 0,123,__LINE__, 0x3f50624d, 0xd2f1a9fc, 0x40590000, 0x00000000, 0xbff80000, 0x00000000},	/* 0.001=f(100, -1.5)*/
+{28, 0,123,__LINE__, 0x3fb99999, 0x9999999a, 0x40590000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.1=f(100, -0.5)*/
+{28, 0,123,__LINE__, 0x40094c58, 0x3ada5b53, 0x40590000, 0x00000000, 0x3fd00000, 0x00000000},	/* 3.16228=f(100, 0.25)*/
+{28, 0,123,__LINE__, 0x40240000, 0x00000000, 0x40590000, 0x00000000, 0x3fe00000, 0x00000000},	/* 10=f(100, 0.5)*/
+{28, 0,123,__LINE__, 0x40a8b48e, 0x29793d2f, 0x40590000, 0x00000000, 0x3ffc0000, 0x00000000},	/* 3162.28=f(100, 1.75)*/
+{28, 0,123,__LINE__, 0x412e8480, 0x00000000, 0x40590000, 0x00000000, 0x40080000, 0x00000000},	/* 1e+06=f(100, 3)*/
+{28, 0,123,__LINE__, 0x42f6a13a, 0x15380573, 0x40590000, 0x00000000, 0x401d3333, 0x40000000},	/* 3.98108e+14=f(100, 7.3)*/
+{28, 0,123,__LINE__, 0x3ea1d521, 0x851af311, 0x405edd2f, 0x20000000, 0xc0080000, 0x00000000},	/* 5.31451e-07=f(123.456, -3)*/
+{28, 0,123,__LINE__, 0x3f47e35a, 0x95865c87, 0x405edd2f, 0x20000000, 0xbff80000, 0x00000000},	/* 0.000729007=f(123.456, -1.5)*/
+{28, 0,123,__LINE__, 0x3fb70a42, 0x439704e0, 0x405edd2f, 0x20000000, 0xbfe00000, 0x00000000},	/* 0.0900003=f(123.456, -0.5)*/
+{28, 0,123,__LINE__, 0x400aaaa7, 0xdfff8fc6, 0x405edd2f, 0x20000000, 0x3fd00000, 0x00000000},	/* 3.33333=f(123.456, 0.25)*/
+{28, 0,123,__LINE__, 0x402638de, 0xe71bf515, 0x405edd2f, 0x20000000, 0x3fe00000, 0x00000000},	/* 11.1111=f(123.456, 0.5)*/
+{28, 0,123,__LINE__, 0x40b1dc6c, 0x2e300ee1, 0x405edd2f, 0x20000000, 0x3ffc0000, 0x00000000},	/* 4572.42=f(123.456, 1.75)*/
+{28, 0,123,__LINE__, 0x413cb628, 0x5a933d94, 0x405edd2f, 0x20000000, 0x40080000, 0x00000000},	/* 1.88164e+06=f(123.456, 3)*/
+{28, 0,123,__LINE__, 0x431a57b8, 0xded13d6d, 0x405edd2f, 0x20000000, 0x401d3333, 0x40000000},	/* 1.8537e+15=f(123.456, 7.3)*/
+{28, 0,123,__LINE__, 0x41cdcd64, 0xb8c0fafe, 0x3f50624d, 0xe0000000, 0xc0080000, 0x00000000},	/* 1e+09=f(0.001, -3)*/
+{28, 0,123,__LINE__, 0x40dee1b1, 0x8eedc636, 0x3f50624d, 0xe0000000, 0xbff80000, 0x00000000},	/* 31622.8=f(0.001, -1.5)*/
+{28, 0,123,__LINE__, 0x403f9f6e, 0x3cf76c3d, 0x3f50624d, 0xe0000000, 0xbfe00000, 0x00000000},	/* 31.6228=f(0.001, -0.5)*/
+{28, 0,123,__LINE__, 0x3fc6c310, 0xe7ff7b9b, 0x3f50624d, 0xe0000000, 0x3fd00000, 0x00000000},	/* 0.177828=f(0.001, 0.25)*/
+{28, 0,123,__LINE__, 0x3fa030dc, 0x5513b238, 0x3f50624d, 0xe0000000, 0x3fe00000, 0x00000000},	/* 0.0316228=f(0.001, 0.5)*/
+{28, 0,123,__LINE__, 0x3ed79618, 0x316b9a37, 0x3f50624d, 0xe0000000, 0x3ffc0000, 0x00000000},	/* 5.62341e-06=f(0.001, 1.75)*/
+{28, 0,123,__LINE__, 0x3e112e0c, 0x1138eb2c, 0x3f50624d, 0xe0000000, 0x40080000, 0x00000000},	/* 1e-09=f(0.001, 3)*/
+{28, 0,123,__LINE__, 0x3b63063a, 0x20eb5d54, 0x3f50624d, 0xe0000000, 0x401d3333, 0x40000000},	/* 1.25892e-22=f(0.001, 7.3)*/
+{28, 0,123,__LINE__, 0xc0200000, 0x00000000, 0xc0000000, 0x00000000, 0x40080000, 0x00000000},	/* -8=f(-2, 3)*/
+{28, 0,123,__LINE__, 0x3fd00000, 0x00000000, 0xc0000000, 0x00000000, 0xc0000000, 0x00000000},	/* 0.25=f(-2, -2)*/
+{28, 0,123,__LINE__, 0xbfa00000, 0x00000000, 0xbfe00000, 0x00000000, 0x40140000, 0x00000000},	/* -0.03125=f(-0.5, 5)*/
+{28, 0,123,__LINE__, 0x40900000, 0x00000000, 0x40000000, 0x00000000, 0x40240000, 0x00000000},	/* 1024=f(2, 10)*/
+{28, 0,123,__LINE__, 0x3f500000, 0x00000000, 0x40000000, 0x00000000, 0xc0240000, 0x00000000},	/* 0.000976562=f(2, -10)*/
+{28, 0,123,__LINE__, 0x3f847ae1, 0x47ae147b, 0x40240000, 0x00000000, 0xc0000000, 0x00000000},	/* 0.01=f(10, -2)*/
+{28, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x3ff00000, 0x00000000, 0x408f4000, 0x00000000},	/* 1=f(1, 1000)*/
+{28, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x40140000, 0x00000000, 0x00000000, 0x00000000},	/* 1=f(5, 0)*/
+{28, 0,123,__LINE__, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000},	/* 0=f(0, 2)*/
+{28, 0,123,__LINE__, 0x4005bfaf, 0xc42f7690, 0x3ff00068, 0xe0000000, 0x40c38800, 0x00000000},	/* 2.7186=f(1.0001, 10000)*/
+{28, 0,123,__LINE__, 0x46300000, 0x00000000, 0x40000000, 0x00000000, 0x40590000, 0x00000000},	/* 1.26765e+30=f(2, 100)*/
+{28, 0,123,__LINE__, 0x38700000, 0x00000000, 0x3fe00000, 0x00000000, 0x405e0000, 0x00000000},	/* 7.52316e-37=f(0.5, 120)*/
+0,};
+test_powf(m)   {run_vector_1(m,powf_vec,(char *)(powf),"powf","fff");   }
@@ -35,6 +35,18 @@ typedef struct
 
 
 int mag_of_error (double, double);
+double thedouble (long, long);
+void double_parts (double, __ieee_double_shape_type *);
+
+/* Set by -bench to the number of times each call in the vectors is
+   repeated while it is timed.  The pic30 timer counts every cycle of
+   one call; clock () needs many to register.  */
+extern int timing;
+#ifdef __dsPIC30__
+#define TIMING_REPS 1
+#else
+#define TIMING_REPS 1000
+#endif
 
 
 #define ERROR_PERFECT 20
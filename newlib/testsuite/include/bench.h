@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Cycle, stack and heap measurement for the newlib.bench programs.
+
+   On pic30 cycles come from Timer2/3 chained as a 32-bit timer clocked
+   at Fcy with no prescaler, which the MPLAB and gdb simulators model
+   exactly and which matches the part on hardware.  Stack use is found
+   by painting the area above the stack pointer up to SPLIM and looking
+   for the highest word touched.  Elsewhere clock() is used instead and
+   stack use is not reported, so the figures only compare with runs on
+   the same host.
+
+   Each BENCH line reports the average over ITERS calls, less the cost
+   of an empty loop:
+
+	bench <name> <size> cycles=<n> stack=<bytes> heap=<bytes>  */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+
+typedef unsigned long bench_t;
+
+#ifdef __dsPIC30__
+
+extern volatile unsigned int T2CON, T3CON, TMR2, TMR3, TMR3HLD, PR2, PR3;
+extern volatile unsigned int SPLIM;
+
+#define BENCH_PAINT	0x5aa5
+
+static inline void
+bench_timer_init (void)
+{
+  T2CON = 0;
+  T3CON = 0;
+  TMR3 = 0;
+  TMR2 = 0;
+  PR3 = 0xffff;
+  PR2 = 0xffff;
+  T2CON = 0x8008;		/* TON | T32, Fcy, 1:1 */
+}
+
+static inline bench_t
+bench_now (void)
+{
+  unsigned int lo = TMR2;	/* latches TMR3 into TMR3HLD */
+  unsigned int hi = TMR3HLD;
+
+  return ((bench_t) hi << 16) | lo;
+}
+
+static inline unsigned int *
+bench_sp (void)
+{
+  unsigned int *sp;
+
+  __asm__ volatile ("mov w15, %0" : "=r" (sp));
+  return sp;
+}
+
+/* Painting and scanning are inline so that the area starts at the
+   caller's own stack pointer; the stack grows upwards.  */
+static inline __attribute__ ((always_inline)) unsigned int *
+bench_stack_paint (void)
+{
+  unsigned int *base = bench_sp () + 8;
+  unsigned int *p;
+
+  for (p = base; p < (unsigned int *) SPLIM; p++)
+    *p = BENCH_PAINT;
+  return base;
+}
+
+static inline __attribute__ ((always_inline)) unsigned int
+bench_stack_used (unsigned int *base)
+{
+  unsigned int *p = (unsigned int *) SPLIM;
+
+  while (p > base && p[-1] == BENCH_PAINT)
+    p--;
+  return (unsigned int) ((char *) p - (char *) base);
+}
+
+#else /* !__dsPIC30__ */
+
+static inline void
+bench_timer_init (void)
+{
+}
+
+static inline bench_t
+bench_now (void)
+{
+  return (bench_t) clock ();
+}
+
+#define bench_stack_paint()	((unsigned int *) 0)
+#define bench_stack_used(base)	((void) (base), 0u)
+
+#endif /* !__dsPIC30__ */
+
+static inline long
+bench_heap (void)
+{
+  return (long) (char *) sbrk (0);
+}
+
+static volatile int bench_sink;
+static bench_t bench_overhead;
+
+/* Start the timer, bring stdio up so its buffers are not charged to
+   the first benchmark and measure the cost of the empty loop.  */
+static void
+bench_init (const char *suite)
+{
+  bench_t t0;
+  int i;
+
+  bench_timer_init ();
+  printf ("bench suite %s\n", suite);
+  t0 = bench_now ();
+  for (i = 0; i < 64; i++)
+    __asm__ volatile ("");
+  bench_overhead = (bench_now () - t0) / 64;
+}
+
+static void
+bench_report (const char *name, unsigned long size, bench_t cycles,
+	      unsigned int stack, long heap)
+{
+  printf ("bench %s %lu cycles=%lu stack=%u heap=%ld\n",
+	  name, size, cycles, stack, heap);
+}
+
+#define BENCH(name, size, iters, stmt)					\
+  do									\
+    {									\
+      unsigned int *bench_base_ = bench_stack_paint ();			\
+      long bench_heap_ = bench_heap ();					\
+      bench_t bench_t0_, bench_t1_;					\
+      int bench_i_;							\
+									\
+      bench_t0_ = bench_now ();						\
+      for (bench_i_ = 0; bench_i_ < (iters); bench_i_++)		\
+	{								\
+	  stmt;								\
+	  __asm__ volatile ("");					\
+	}								\
+      bench_t1_ = bench_now ();						\
+      bench_t1_ = (bench_t1_ - bench_t0_) / (iters);			\
+      bench_report ((name), (size),					\
+		    bench_t1_ > bench_overhead				\
+		    ? bench_t1_ - bench_overhead : 0,			\
+		    bench_stack_used (bench_base_),			\
+		    bench_heap () - bench_heap_);			\
+    }									\
+  while (0)
+
+#endif /* BENCH_H */
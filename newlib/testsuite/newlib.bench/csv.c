@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* A data logger record of integers, decimal readings and a tag,
+   split with strtok_r and converted with strtol and strtof, then taken
+   field by field with the csv_next functions.  The size is the number
+   of records parsed per run.  */
+
+#include <string.h>
+#include <csv.h>
+#include "bench.h"
+
+static const char record[] = "1699999999,12,-345,27.25,3.5e-2,ok,40000\n";
+static char line[sizeof (record)];
+static char tag[8];
+static long isum;
+static float fsum;
+
+static void
+parse_strtok (void)
+{
+  char *save, *tok, *end;
+  int k = 0;
+
+  memcpy (line, record, sizeof (record));
+  for (tok = strtok_r (line, ",\n", &save); tok != NULL;
+       tok = strtok_r (NULL, ",\n", &save), k++)
+    if (k == 3 || k == 4)
+      fsum += strtof (tok, &end);
+    else if (k == 5)
+      {
+	strncpy (tag, tok, sizeof (tag) - 1);
+	tag[sizeof (tag) - 1] = '\0';
+      }
+    else
+      isum += strtol (tok, &end, 10);
+}
+
+static void
+parse_csv (void)
+{
+  struct csv_cursor c;
+  __int32_t v;
+  float f;
+  int k;
+
+  csv_init (&c, record, ',');
+  for (k = 0; k < 7; k++)
+    if (k == 3 || k == 4)
+      {
+	if (csv_next_f32 (&c, &f) == 0)
+	  fsum += f;
+      }
+    else if (k == 5)
+      csv_next_str (&c, tag, sizeof (tag));
+    else if (csv_next_i32 (&c, &v) == 0)
+      isum += v;
+}
+
+int
+main (void)
+{
+  bench_init ("csv");
+  BENCH ("csv-strtok", 1, 16, parse_strtok ());
+  BENCH ("csv-next", 1, 16, parse_csv ());
+  bench_sink = (int) isum + (int) fsum;
+  exit (0);
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <stdlib.h>
+#include "bench.h"
+
+#ifdef __dsPIC30__
+#include <machine/dsp.h>
+
+/* The transforms work in place on Y data space, aligned to the size
+   of the largest transform.  */
+static q15c_t buf[1 << Q15_FFT_MAXLOG2]
+  __attribute__ ((space (ymemory), aligned (4 << Q15_FFT_MAXLOG2)));
+
+static void
+fill (void)
+{
+  unsigned int i;
+
+  for (i = 0; i < (1 << Q15_FFT_MAXLOG2); i++)
+    {
+      buf[i].re = (q15_t) (i * 2654435761UL >> 20) >> 1;
+      buf[i].im = (q15_t) (i * 40503U) >> 1;
+    }
+}
+#endif
+
+int
+main (void)
+{
+#ifdef __dsPIC30__
+  unsigned int log2n;
+#endif
+
+  bench_init ("fft");
+#ifdef __dsPIC30__
+  for (log2n = 6; log2n <= Q15_FFT_MAXLOG2; log2n += 2)
+    {
+      fill ();
+      BENCH ("q15_fft", 1 << log2n, 4, q15_fft (buf, log2n));
+      BENCH ("q15_ifft", 1 << log2n, 4, q15_ifft (buf, log2n));
+      BENCH ("q15_rfft", 1 << log2n, 4, q15_rfft ((q15_t *) buf, log2n));
+    }
+#endif
+  exit (0);
+}
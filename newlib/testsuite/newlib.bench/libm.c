@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <math.h>
+#ifdef __dsPIC30__
+#include <fastmath.h>
+#include <machine/dsp.h>
+#endif
+#include "bench.h"
+
+static volatile float fsink;
+static volatile double dsink;
+#ifdef __dsPIC30__
+static volatile unsigned int usink;
+static volatile q31_t qsink;
+
+/* A sixth-order calibration curve.  */
+static const float poly_f[7] = { 0.01f, -0.05f, 0.1f, -0.2f, 0.3f, 0.9f, 0.02f };
+static const q31_t poly_q[7] =
+{
+  21474836L, -107374182L, 214748365L, -429496730L, 644245094L,
+  1932735283L, 42949673L
+};
+#endif
+
+static const float inputs[] = { 0.1f, 0.785f, 2.5f, 100.0f, 12345.6f };
+
+int
+main (void)
+{
+  unsigned int i;
+
+  bench_init ("libm");
+  for (i = 0; i < sizeof (inputs) / sizeof (inputs[0]); i++)
+    {
+      float x = inputs[i];
+#ifdef __dsPIC30__
+      float r, r2;
+#endif
+
+      BENCH ("sinf", i, 8, fsink = sinf (x));
+      BENCH ("cosf", i, 8, fsink = cosf (x));
+      BENCH ("tanf", i, 8, fsink = tanf (x));
+      BENCH ("expf", i, 8, fsink = expf (x / 16));
+      BENCH ("logf", i, 8, fsink = logf (x));
+      BENCH ("sqrtf", i, 8, fsink = sqrtf (x));
+      BENCH ("powf", i, 8, fsink = powf (x, 1.5f));
+      BENCH ("atan2f", i, 8, fsink = atan2f (x, 1.0f));
+      BENCH ("sin", i, 8, dsink = sin (x));
+      BENCH ("exp", i, 8, dsink = exp (x / 16));
+#ifdef __dsPIC30__
+      BENCH ("__fast_sinf", i, 8, fsink = __fast_sinf (x));
+      BENCH ("__fast_cosf", i, 8, fsink = __fast_cosf (x));
+      BENCH ("__fast_expf", i, 8, fsink = __fast_expf (x / 16));
+      BENCH ("__fast_logf", i, 8, fsink = __fast_logf (x));
+      BENCH ("__fast_atan2f", i, 8, fsink = __fast_atan2f (x, 1.0f));
+      BENCH ("__compact_expf", i, 8, fsink = __compact_expf (x / 16));
+      BENCH ("__compact_logf", i, 8, fsink = __compact_logf (x));
+      BENCH ("__compact_powf", i, 8, fsink = __compact_powf (x, 1.5f));
+      BENCH ("cordic_polarf", i, 8, fsink = cordic_polarf (x, 1.0f, &r));
+      BENCH ("cordic_sincosf", i, 8, cordic_sincosf (x, &r, &r2));
+      BENCH ("rsqrtf", i, 8, fsink = rsqrtf (x));
+      BENCH ("isqrt32", i, 8, usink = isqrt32 ((unsigned long) x * 1000));
+      BENCH ("polyeval_f32", i, 8, fsink = polyeval_f32 (x, poly_f, 7));
+      BENCH ("polyeval_q31", i, 8,
+	     qsink = polyeval_q31 ((q31_t) (x / 16384.0f * 2147483647.0f),
+				   poly_q, 7));
+#endif
+    }
+  exit (0);
+}
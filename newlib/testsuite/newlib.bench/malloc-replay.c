@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Replay an allocation workload against whichever malloc the C
+   library was built with, and report what it did to the heap.
+
+   Built as it is, the workload is a fixed pseudo-random mix of small,
+   medium and a few large blocks with mixed lifetimes.  To replay a
+   real one, turn a malloc_trace_dump capture into a table with
+
+	malltrace.py --c trace.h DUMP
+
+   and build this file with -DREPLAY_TRACE='"trace.h"'.  The same
+   source builds for the host and for the simulator; build it once
+   per allocator (nano-malloc, nano-malloc with NANO_MALLOC_BINS,
+   --enable-newlib-tlsf-malloc or the default dlmalloc) and diff the
+   newlib.replay.txt runtest leaves for each.
+
+   After every REPLAY_SAMPLE operations, and once at the end, a line
+
+	replay <alloc> <n> live=<bytes> heap=<bytes> free=<bytes>
+	    frag=<percent>
+
+   gives the bytes the workload holds, the heap sbrk has handed out,
+   mallinfo's free bytes and the part of the heap that is not held,
+   in percent.  Then come the first failed request, if any, the peak
+   heap, and the cycles per malloc, free and realloc, on average and
+   at worst, as bench lines whose size is the number of calls.  */
+
+#include <stdlib.h>
+#include <malloc.h>
+#include <newlib.h>
+#include "bench.h"
+
+#if defined (_TLSF_MALLOC)
+#define ALLOC_NAME "tlsf"
+#elif defined (_NANO_MALLOC)
+#define ALLOC_NAME "nano"
+#else
+#define ALLOC_NAME "dlmalloc"
+#endif
+
+#ifndef REPLAY_SAMPLE
+#define REPLAY_SAMPLE 256
+#endif
+
+/* malloc into a slot, free it, realloc it.  */
+struct replay_op
+{
+  unsigned char op;
+  unsigned int slot;
+  unsigned int size;
+};
+
+#ifdef REPLAY_TRACE
+#include REPLAY_TRACE
+#define REPLAY_OPS (sizeof (replay_trace) / sizeof (replay_trace[0]))
+#else
+#define REPLAY_SLOTS 48
+#define REPLAY_OPS 4096
+#endif
+
+static void *slot[REPLAY_SLOTS];
+static unsigned int slot_size[REPLAY_SLOTS];
+
+#ifndef REPLAY_TRACE
+static unsigned long seed = 1;
+
+static unsigned int
+rnd (void)
+{
+  seed = seed * 1103515245UL + 12345;
+  return (unsigned int) (seed >> 16) & 0x7fff;
+}
+
+/* Mostly small blocks, some medium and a few large; a live block is
+   freed twice as often as it is resized.  */
+static void
+next_op (struct replay_op *o)
+{
+  unsigned int r = rnd () % 100;
+
+  o->slot = rnd () % REPLAY_SLOTS;
+  o->size = r < 70 ? 4 + rnd () % 29 : r < 95 ? 33 + rnd () % 96
+	    : 129 + rnd () % 256;
+  if (slot[o->slot] == NULL)
+    o->op = 'm';
+  else
+    o->op = rnd () % 3 == 0 ? 'r' : 'f';
+}
+#endif
+
+struct op_time
+{
+  unsigned long n;
+  bench_t total;
+  bench_t worst;
+};
+
+static struct op_time t_malloc, t_free, t_realloc;
+
+static void
+charge (struct op_time *t, bench_t c)
+{
+  c = c > bench_overhead ? c - bench_overhead : 0;
+  t->n++;
+  t->total += c;
+  if (c > t->worst)
+    t->worst = c;
+}
+
+static void
+report_time (const char *name, const char *worst_name,
+	     const struct op_time *t, long peak)
+{
+  bench_report (name, t->n, t->n ? t->total / t->n : 0, 0, peak);
+  bench_report (worst_name, t->n, t->worst, 0, peak);
+}
+
+static unsigned long live;
+static long heap0, peak;
+
+static void
+sample (unsigned long n)
+{
+  long heap = bench_heap () - heap0;
+  struct mallinfo mi = mallinfo ();
+
+  printf ("replay %s %lu live=%lu heap=%ld free=%lu frag=%ld\n",
+	  ALLOC_NAME, n, live, heap, (unsigned long) mi.fordblks,
+	  heap > 0 ? (long) ((heap - (long) live) * 100 / heap) : 0L);
+}
+
+int
+main (void)
+{
+  struct replay_op o;
+  unsigned long n, failures = 0;
+  long first_failure = -1;
+  bench_t t0, t;
+  void *p;
+  int ok;
+
+  bench_init ("malloc-replay");
+  heap0 = bench_heap ();
+
+  for (n = 0; n < REPLAY_OPS; n++)
+    {
+#ifdef REPLAY_TRACE
+      o = replay_trace[n];
+#else
+      next_op (&o);
+#endif
+      ok = 1;
+      switch (o.op)
+	{
+	case 'm':
+	  t0 = bench_now ();
+	  p = malloc (o.size);
+	  t = bench_now () - t0;
+	  charge (&t_malloc, t);
+	  if (p == NULL)
+	    {
+	      ok = 0;
+	      break;
+	    }
+	  /* A trace may reuse a slot whose block it never freed.  */
+	  if (slot[o.slot] != NULL)
+	    {
+	      free (slot[o.slot]);
+	      live -= slot_size[o.slot];
+	    }
+	  slot[o.slot] = p;
+	  slot_size[o.slot] = o.size;
+	  live += o.size;
+	  break;
+	case 'f':
+	  t0 = bench_now ();
+	  free (slot[o.slot]);
+	  t = bench_now () - t0;
+	  charge (&t_free, t);
+	  live -= slot_size[o.slot];
+	  slot[o.slot] = NULL;
+	  slot_size[o.slot] = 0;
+	  break;
+	case 'r':
+	  t0 = bench_now ();
+	  p = realloc (slot[o.slot], o.size);
+	  t = bench_now () - t0;
+	  charge (&t_realloc, t);
+	  if (p == NULL && o.size != 0)
+	    {
+	      ok = 0;
+	      break;
+	    }
+	  live += o.size;
+	  live -= slot_size[o.slot];
+	  slot[o.slot] = p;
+	  slot_size[o.slot] = o.size;
+	  break;
+	}
+      if (!ok)
+	{
+	  if (first_failure < 0)
+	    {
+	      first_failure = (long) n;
+	      printf ("replay %s %lu failed %c %u live=%lu\n", ALLOC_NAME,
+		      n, o.op, o.size, live);
+	    }
+	  failures++;
+	}
+      if (bench_heap () - heap0 > peak)
+	peak = bench_heap () - heap0;
+      if ((n + 1) % REPLAY_SAMPLE == 0)
+	sample (n + 1);
+    }
+  if (n % REPLAY_SAMPLE != 0)
+    sample (n);
+  printf ("replay %s failures=%lu first=%ld peak=%ld\n", ALLOC_NAME,
+	  failures, first_failure, peak);
+
+  report_time ("replay-malloc", "replay-malloc-worst", &t_malloc, peak);
+  report_time ("replay-free", "replay-free-worst", &t_free, peak);
+  report_time ("replay-realloc", "replay-realloc-worst", &t_realloc, peak);
+
+  for (n = 0; n < REPLAY_SLOTS; n++)
+    free (slot[n]);
+  exit (0);
+}
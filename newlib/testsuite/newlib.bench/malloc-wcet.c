@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Worst malloc and free times seen over a fixed set of requests, once
+   with a nearly empty free list and once with NHOLE free blocks of
+   mixed sizes scattered through the heap.  With the TLSF malloc the
+   two must agree, as neither path depends on the number of free
+   blocks, and stay within the bounds documented in tlsf-mallocr.c,
+   reported as wcet lines like those of wcet.c; with the other
+   implementations the figures are only reported.  */
+
+#include <stdlib.h>
+#include <newlib.h>
+#include "bench.h"
+
+#define NHOLE 48
+#define NREQ 16
+
+static void *hole[2 * NHOLE];
+static void *req[NREQ];
+static const unsigned int sizes[] = { 2, 6, 14, 30, 62, 126, 254, 510 };
+
+#define NSIZES (sizeof (sizes) / sizeof (sizes[0]))
+
+static bench_t worst_malloc, worst_free;
+
+static void
+timed_round (void)
+{
+  bench_t t0, t;
+  int i;
+
+  for (i = 0; i < NREQ; i++)
+    {
+      t0 = bench_now ();
+      req[i] = malloc (sizes[i % NSIZES]);
+      t = bench_now () - t0;
+      if (t > worst_malloc)
+	worst_malloc = t;
+    }
+  for (i = NREQ; i-- > 0; )
+    {
+      t0 = bench_now ();
+      free (req[i]);
+      t = bench_now () - t0;
+      if (t > worst_free)
+	worst_free = t;
+    }
+}
+
+static void
+measure (unsigned long nfree, bench_t *m, bench_t *f)
+{
+  long heap = bench_heap ();
+  int i;
+
+  worst_malloc = worst_free = 0;
+  for (i = 0; i < 8; i++)
+    timed_round ();
+  *m = worst_malloc > bench_overhead ? worst_malloc - bench_overhead : 0;
+  *f = worst_free > bench_overhead ? worst_free - bench_overhead : 0;
+  bench_report ("malloc-worst", nfree, *m, 0, bench_heap () - heap);
+  bench_report ("free-worst", nfree, *f, 0, bench_heap () - heap);
+}
+
+#if defined (_TLSF_MALLOC) && defined (__dsPIC30__)
+#ifdef __HAS_EDS__
+#define MALLOC_BOUND	1400
+#define FREE_BOUND	1100
+#else
+#define MALLOC_BOUND	1000
+#define FREE_BOUND	800
+#endif
+
+/* Within an eighth, plus a little for timer read jitter.  */
+static int
+close_enough (bench_t many, bench_t few)
+{
+  return many <= few + few / 8 + 8;
+}
+#endif
+
+int
+main (void)
+{
+  bench_t m0, f0, m1, f1;
+  int i;
+
+  bench_init ("malloc-wcet");
+
+  /* Warm up so that the heap already holds the requests.  */
+  timed_round ();
+  measure (0, &m0, &f0);
+
+  /* Punch holes: allocate pairs and free every other block.  */
+  for (i = 0; i < 2 * NHOLE; i++)
+    hole[i] = malloc (sizes[(i / 2) % NSIZES] + (i & 2));
+  for (i = 0; i < 2 * NHOLE; i += 2)
+    free (hole[i]);
+
+  measure (NHOLE, &m1, &f1);
+
+  for (i = 1; i < 2 * NHOLE; i += 2)
+    free (hole[i]);
+
+#if defined (_TLSF_MALLOC) && defined (__dsPIC30__)
+  if (!close_enough (m1, m0) || !close_enough (f1, f0))
+    {
+      printf ("malloc-wcet: worst case grows with free blocks\n");
+      exit (1);
+    }
+  printf ("wcet malloc %d cycles=%lu bound=%d\n", NHOLE, m1, MALLOC_BOUND);
+  printf ("wcet free %d cycles=%lu bound=%d\n", NHOLE, f1, FREE_BOUND);
+  if (m1 > MALLOC_BOUND || f1 > FREE_BOUND)
+    {
+      printf ("malloc-wcet: worst case over its bound\n");
+      exit (1);
+    }
+#endif
+  exit (0);
+}
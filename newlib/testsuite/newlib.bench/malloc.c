@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <stdlib.h>
+#include "bench.h"
+
+#define NPTR 16
+
+static void *ptr[NPTR];
+static const unsigned int sizes[] = { 4, 16, 64, 256 };
+
+static void
+churn (unsigned int n)
+{
+  int i;
+
+  for (i = 0; i < NPTR; i++)
+    ptr[i] = malloc (n + (i & 3) * 2);
+  for (i = 0; i < NPTR; i += 2)
+    free (ptr[i]);
+  for (i = 0; i < NPTR; i += 2)
+    ptr[i] = malloc (n);
+  for (i = 0; i < NPTR; i++)
+    free (ptr[i]);
+}
+
+int
+main (void)
+{
+  unsigned int i;
+
+  bench_init ("malloc");
+  for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+      unsigned int n = sizes[i];
+
+      BENCH ("malloc-free", n, 16, free (malloc (n)));
+      BENCH ("churn", n, 4, churn (n));
+      BENCH ("realloc-grow", n, 4,
+	     free (realloc (malloc (n), 2 * n)));
+    }
+  exit (0);
+}
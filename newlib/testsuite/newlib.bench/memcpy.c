@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <string.h>
+#include "bench.h"
+
+#define MAX 1024
+
+static char src[MAX + 2];
+static char dst[MAX + 2];
+
+static const unsigned int sizes[] = { 1, 8, 32, 128, 512, MAX };
+
+int
+main (void)
+{
+  unsigned int i;
+
+  bench_init ("memcpy");
+  for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+      unsigned int n = sizes[i];
+
+      BENCH ("memcpy", n, 16, memcpy (dst, src, n));
+      BENCH ("memcpy-unaligned", n, 16, memcpy (dst + 1, src, n));
+      BENCH ("memmove-overlap", n, 16, memmove (dst + 1, dst, n));
+      BENCH ("memset", n, 16, memset (dst, i, n));
+    }
+  exit (0);
+}
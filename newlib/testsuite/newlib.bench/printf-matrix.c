@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* One format corpus printed at one printf level, chosen by
+   PRINTF_LEVEL:
+
+	0 int		siprintf, the integer-only family
+	1 printf	sprintf without float conversions
+	2 float		sprintf with them, _printf_float linked in
+	3 plan		snprintf_plan on formats compiled beforehand
+	4 stream	fprintf to a stream that discards its output
+
+   bench.exp builds this file once per level and reports the text,
+   data and bss of each executable next to the bench lines, which
+   give cycles and stack per format.  Whether the library has the
+   nano or the full formatted I/O is chosen when it is configured, so
+   the two are compared by running the suite against each build; the
+   suite name says which one ran.  The executables share everything
+   but the printf code, so their size differences are what each level
+   costs.  */
+
+#include <stdio.h>
+#include <newlib.h>
+#include "bench.h"
+
+#ifndef PRINTF_LEVEL
+#define PRINTF_LEVEL 1
+#endif
+
+#ifdef _NANO_FORMATTED_IO
+#define IO "nano"
+#else
+#define IO "full"
+#endif
+
+static char buf[64];
+static volatile int ival = -12345;
+static volatile unsigned int uval = 54321U;
+static volatile long lval = 123456789L;
+static volatile double dval = 3.14159265;
+static const char *volatile sval = "hello";
+
+#define PREPARE(fmt)	((void) 0)
+
+#if PRINTF_LEVEL == 0
+#define LEVEL "int"
+#define PRINT(fmt, ...)	siprintf (buf, fmt, __VA_ARGS__)
+#elif PRINTF_LEVEL == 1
+#define LEVEL "printf"
+#define PRINT(fmt, ...)	sprintf (buf, fmt, __VA_ARGS__)
+#elif PRINTF_LEVEL == 2
+#define LEVEL "float"
+#define PRINT(fmt, ...)	sprintf (buf, fmt, __VA_ARGS__)
+#ifdef _NANO_FORMATTED_IO
+/* What -u _printf_float does on the command line.  */
+extern int _printf_float ();
+int (*volatile bench_keep_float) () = _printf_float;
+#endif
+#elif PRINTF_LEVEL == 3
+#define LEVEL "plan"
+#ifdef _NANO_FORMATTED_IO
+#include <printf_plan.h>
+static printf_plan_t plan;
+#undef PREPARE
+#define PREPARE(fmt)	printf_plan_compile (&plan, fmt)
+#define PRINT(fmt, ...)	snprintf_plan (buf, sizeof buf, &plan, __VA_ARGS__)
+#endif
+#elif PRINTF_LEVEL == 4
+#define LEVEL "stream"
+static FILE *sink;
+#define PRINT(fmt, ...)	fprintf (sink, fmt, __VA_ARGS__)
+
+static int
+discard (void *cookie, const char *p, int n)
+{
+  return n;
+}
+#endif
+
+#define FORMAT(name, fmt, ...)						\
+  do									\
+    {									\
+      PREPARE (fmt);							\
+      BENCH ("printf-" LEVEL "-" name, 0, 8, PRINT (fmt, __VA_ARGS__)); \
+    }									\
+  while (0)
+
+int
+main (void)
+{
+  bench_init ("printf-matrix-" IO);
+#ifndef PRINT
+  printf ("printf-matrix: plans need the nano formatted I/O\n");
+#else
+#if PRINTF_LEVEL == 4
+  sink = funopen (NULL, NULL, discard, NULL, NULL);
+  if (sink == NULL)
+    exit (1);
+#endif
+  FORMAT ("str", "hello, world%s", "");
+  FORMAT ("s", "%s", sval);
+  FORMAT ("s-width", "%-8s|", sval);
+  FORMAT ("c", "%c", 'x');
+  FORMAT ("d", "%d", ival);
+  FORMAT ("u", "%u", uval);
+  FORMAT ("d-width", "%6d", ival);
+  FORMAT ("x", "%04x", uval);
+  FORMAT ("ld", "%ld", lval);
+  FORMAT ("mixed", "t=%d v=%ld %s", ival, lval, sval);
+#if PRINTF_LEVEL == 2
+  FORMAT ("f", "%f", dval);
+  FORMAT ("f-prec", "%.2f", dval);
+  FORMAT ("e", "%.3e", dval);
+  FORMAT ("g", "%g", dval);
+#endif
+#endif
+  exit (0);
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <stdio.h>
+#include "bench.h"
+
+static char buf[64];
+static volatile int ival = -12345;
+static volatile long lval = 123456789L;
+static volatile double dval = 3.14159265;
+
+int
+main (void)
+{
+  bench_init ("printf");
+  BENCH ("sprintf-str", 0, 8, sprintf (buf, "hello, world"));
+  BENCH ("sprintf-s", 0, 8, sprintf (buf, "%s", "hello, world"));
+  BENCH ("sprintf-d", 0, 8, sprintf (buf, "%d", ival));
+  BENCH ("sprintf-x", 0, 8, sprintf (buf, "%04x", ival));
+  BENCH ("sprintf-ld", 0, 8, sprintf (buf, "%ld", lval));
+  BENCH ("sprintf-f", 0, 8, sprintf (buf, "%f", dval));
+  BENCH ("sprintf-e", 0, 8, sprintf (buf, "%.3e", dval));
+  BENCH ("sprintf-mixed", 0, 8,
+	 sprintf (buf, "t=%d v=%ld %s", ival, lval, "ok"));
+  exit (0);
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Records ordered by channel and, within a channel, by time: with two
+   qsort passes, with one qsort pass comparing both keys, and with a
+   stable mergesort_r by channel after one by time.  "-ordered" starts
+   from records that arrive in time order, where the stable sort needs
+   only its pass by channel.  Each run includes copying the input
+   back.  */
+
+#include <string.h>
+#include "bench.h"
+
+#define MAX 512
+
+struct rec
+{
+  unsigned long time;
+  unsigned int channel;
+};
+
+static struct rec in[MAX];
+static struct rec work[MAX];
+static struct rec scratch[(MAX + 1) / 2];
+
+static const unsigned int sizes[] = { 16, 64, 256, MAX };
+
+static int
+by_time (const void *a,
+	const void *b)
+{
+  const struct rec *x = a, *y = b;
+
+  return x->time < y->time ? -1 : x->time > y->time;
+}
+
+static int
+by_channel (const void *a,
+	const void *b)
+{
+  const struct rec *x = a, *y = b;
+
+  return x->channel < y->channel ? -1 : x->channel > y->channel;
+}
+
+static int
+by_both (const void *a,
+	const void *b)
+{
+  int c = by_channel (a, b);
+
+  return c != 0 ? c : by_time (a, b);
+}
+
+static int
+by_time_r (const void *a,
+	const void *b,
+	void *thunk)
+{
+  return by_time (a, b);
+}
+
+static int
+by_channel_r (const void *a,
+	const void *b,
+	void *thunk)
+{
+  return by_channel (a, b);
+}
+
+static void
+run (const char *suffix,
+	unsigned int n,
+	int ordered)
+{
+  char name[32];
+
+  strcpy (name, "sort-qsort-twice");
+  strcat (name, suffix);
+  BENCH (name, n, 4,
+	 (memcpy (work, in, n * sizeof (in[0])),
+	  qsort (work, n, sizeof (work[0]), by_time),
+	  qsort (work, n, sizeof (work[0]), by_both)));
+  strcpy (name, "sort-qsort-both");
+  strcat (name, suffix);
+  BENCH (name, n, 4,
+	 (memcpy (work, in, n * sizeof (in[0])),
+	  qsort (work, n, sizeof (work[0]), by_both)));
+  strcpy (name, "sort-mergesort");
+  strcat (name, suffix);
+  BENCH (name, n, 4,
+	 (memcpy (work, in, n * sizeof (in[0])),
+	  ordered ? (void) 0
+		  : mergesort_r (work, n, sizeof (work[0]), by_time_r, NULL,
+				 scratch),
+	  mergesort_r (work, n, sizeof (work[0]), by_channel_r, NULL,
+		       scratch)));
+  strcpy (name, "sort-mergesort-inplace");
+  strcat (name, suffix);
+  BENCH (name, n, 4,
+	 (memcpy (work, in, n * sizeof (in[0])),
+	  ordered ? (void) 0
+		  : mergesort_r (work, n, sizeof (work[0]), by_time_r, NULL,
+				 NULL),
+	  mergesort_r (work, n, sizeof (work[0]), by_channel_r, NULL,
+		       NULL)));
+}
+
+int
+main (void)
+{
+  unsigned int i, j;
+
+  bench_init ("sort");
+  for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+      unsigned int n = sizes[i];
+
+      srand (1);
+      for (j = 0; j < n; j++)
+	{
+	  in[j].time = ((unsigned long) rand () << 8) ^ rand ();
+	  in[j].channel = rand () % 8;
+	}
+      run ("", n, 0);
+
+      for (j = 0; j < n; j++)
+	in[j].time = j * 100UL;
+      run ("-ordered", n, 1);
+    }
+  exit (0);
+}
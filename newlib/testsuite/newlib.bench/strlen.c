@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <string.h>
+#include "bench.h"
+
+#define MAX 512
+
+static char str[MAX + 2];
+static char buf[MAX + 2];
+
+static const unsigned int sizes[] = { 0, 1, 8, 32, 128, MAX };
+
+int
+main (void)
+{
+  unsigned int i;
+
+  bench_init ("strlen");
+  for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+      unsigned int n = sizes[i];
+
+      memset (str, 'a', n);
+      str[n] = '\0';
+      strcpy (buf, str);
+      BENCH ("strlen", n, 16, bench_sink = strlen (str));
+      BENCH ("strlen-unaligned", n, 16, bench_sink = strlen (str + 1));
+      BENCH ("strcpy", n, 16, strcpy (buf, str));
+      BENCH ("strcmp", n, 16, bench_sink = strcmp (buf, str));
+      BENCH ("strchr", n, 16, bench_sink = strchr (str, 'b') != 0);
+    }
+  exit (0);
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <stdlib.h>
+#include "bench.h"
+
+static volatile double sink;
+
+static const char *const inputs[] = {
+  "0",
+  "1",
+  "3.14159",
+  "-273.15",
+  "6.02214076e23",
+  "1e-10",
+  "123456789.123456789",
+  "1.17549435e-38",
+  "2.2250738585072014e-308",
+};
+
+int
+main (void)
+{
+  unsigned int i;
+
+  bench_init ("strtod");
+  for (i = 0; i < sizeof (inputs) / sizeof (inputs[0]); i++)
+    {
+      BENCH ("strtod", i, 8, sink = strtod (inputs[i], 0));
+      BENCH ("strtof", i, 8, sink = strtof (inputs[i], 0));
+      BENCH ("atoi", i, 8, bench_sink = atoi (inputs[i]));
+    }
+  exit (0);
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Worst-case cycle counts of the characterised functions against
+   their documented bounds.  Each input is timed as a single call, the
+   worst of WCET_REPS, from the first timer read to the second less
+   the cost of the two reads alone, so it covers loading the arguments,
+   the call and the return.  The inputs are the worst of each
+   function: source and destination of different parity for memcpy,
+   an odd start for memset and strlen, the most digits for the integer
+   conversions and the most expensive reduction for sinf.  The TLSF
+   malloc and free are checked by malloc-wcet.c.
+
+   Every result is a line
+
+	wcet <name> <n> cycles=<measured> bound=<bound>
+
+   which bench.exp gathers into newlib.wcet.txt.  On pic30 a count
+   above its bound fails the test.  The bounds are those of the
+   dsPIC30F, dsPIC33F, PIC24F and PIC24H, or of the parts with EDS
+   (dsPIC33E, dsPIC33C and PIC24E), whose taken branches, calls and
+   returns cost more; they do not hold with
+   --enable-newlib-yield-interval, where the block functions stop to
+   call __libc_yield.  */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <newlib.h>
+#include "bench.h"
+
+#ifdef __HAS_EDS__
+#define FAMILY(f, e)	(e)
+#else
+#define FAMILY(f, e)	(f)
+#endif
+
+#define WCET_REPS 4
+#define MAX 1024
+
+static char src[MAX + 2];
+static char dst[MAX + 2];
+static char num[40];
+static volatile float fsink;
+
+static const unsigned int sizes[] = { 0, 1, 2, 3, 8, 31, 32, 255, 256, MAX };
+
+#define NSIZES (sizeof (sizes) / sizeof (sizes[0]))
+
+static bench_t wcet_null;
+static int wcet_failed;
+
+/* The documented bounds, N being the bytes, characters or digits.  */
+#define MEMCPY_BOUND(n) \
+  (FAMILY (32, 48) + (n) + FAMILY (10, 14) * ((n) / 8192))
+#define MEMSET_BOUND(n) \
+  (FAMILY (40, 52) + ((n) + 1) / 2 + FAMILY (10, 14) * ((n) / 16384))
+#define STRLEN_BOUND(n) \
+  (FAMILY (32, 48) + (FAMILY (7, 9) * (n) + 1) / 2)
+#define UTOA10_BOUND \
+  FAMILY (300, 400)
+#define UTOA_BOUND(d) \
+  (FAMILY (120, 160) + FAMILY (60, 80) * (d))
+#define ITOA_BOUND(bound) \
+  ((bound) + FAMILY (40, 60))
+#define STRTOL_BOUND(n) \
+  (FAMILY (2000, 2600) + FAMILY (80, 100) * (n))
+#define SINF_BOUND \
+  FAMILY (4000, 5500)
+
+static void
+wcet_check (const char *name, unsigned long n, bench_t cycles,
+	    unsigned long bound)
+{
+  printf ("wcet %s %lu cycles=%lu bound=%lu\n", name, n, cycles, bound);
+#if defined (__dsPIC30__) && !defined (_LIBC_YIELD_INTERVAL)
+  if (cycles > bound)
+    {
+      printf ("wcet: %s %lu over its bound\n", name, n);
+      wcet_failed = 1;
+    }
+#endif
+}
+
+#define WCET(name, n, bound, stmt)					\
+  do									\
+    {									\
+      bench_t wcet_t0_, wcet_t_, wcet_worst_ = 0;			\
+      int wcet_i_;							\
+									\
+      for (wcet_i_ = 0; wcet_i_ < WCET_REPS; wcet_i_++)			\
+	{								\
+	  wcet_t0_ = bench_now ();					\
+	  stmt;								\
+	  wcet_t_ = bench_now () - wcet_t0_;				\
+	  if (wcet_t_ > wcet_worst_)					\
+	    wcet_worst_ = wcet_t_;					\
+	}								\
+      wcet_check ((name), (n),						\
+		  wcet_worst_ > wcet_null ? wcet_worst_ - wcet_null : 0, \
+		  (bound));						\
+    }									\
+  while (0)
+
+/* A decimal number of N characters: leading blanks, a sign and as many
+   digits as a long takes, the last of them past the point where
+   strtol has to check for overflow.  */
+static void
+make_number (unsigned int n)
+{
+  static const char digits[] = "-2147483648";
+  unsigned int d = n < sizeof (digits) - 1 ? n : sizeof (digits) - 1;
+
+  memset (num, ' ', n - d);
+  memcpy (num + n - d, digits + sizeof (digits) - 1 - d, d);
+  num[n] = '\0';
+}
+
+int
+main (void)
+{
+  static const float angles[] = { 0.7853982f, 2.3561945f, 100.0f, 200.95f };
+  static const unsigned int lens[] = { 1, 5, 11, 20, 32 };
+  bench_t t0;
+  unsigned int i, n;
+
+  bench_init ("wcet");
+  for (i = 0; i < WCET_REPS; i++)
+    {
+      t0 = bench_now ();
+      n = bench_now () - t0;
+      if (i == 0 || n < wcet_null)
+	wcet_null = n;
+    }
+
+  for (i = 0; i < NSIZES; i++)
+    {
+      n = sizes[i];
+      memset (src, 'a', n + 1);
+      src[n + 1] = '\0';
+      WCET ("memcpy", n, MEMCPY_BOUND (n), memcpy (dst + 1, src, n));
+      WCET ("memset", n, MEMSET_BOUND (n), memset (dst + 1, 0x5a, n));
+      WCET ("strlen", n, STRLEN_BOUND (n), bench_sink = strlen (src + 1));
+    }
+
+  WCET ("utoa-10", 5, UTOA10_BOUND, utoa (65535u, num, 10));
+  WCET ("utoa-16", 4, UTOA_BOUND (4), utoa (65535u, num, 16));
+  WCET ("utoa-2", 16, UTOA_BOUND (16), utoa (65535u, num, 2));
+  WCET ("itoa-10", 6, ITOA_BOUND (UTOA10_BOUND), itoa (-32768, num, 10));
+  WCET ("itoa-2", 16, ITOA_BOUND (UTOA_BOUND (16)), itoa (-1, num, 2));
+
+  for (i = 0; i < sizeof (lens) / sizeof (lens[0]); i++)
+    {
+      n = lens[i];
+      make_number (n);
+      WCET ("strtol", n, STRTOL_BOUND (n),
+	    bench_sink = strtol (num, NULL, 10) != 0);
+    }
+
+  for (i = 0; i < sizeof (angles) / sizeof (angles[0]); i++)
+    WCET ("sinf", (unsigned long) angles[i], SINF_BOUND,
+	  fsink = sinf (angles[i]));
+
+  exit (wcet_failed);
+}
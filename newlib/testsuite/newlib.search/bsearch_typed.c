@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* bsearch_u16, bsearch_u32 and their Eytzinger forms for every key
+   around the elements of tables of 0 to MAX elements, with and without
+   repeated values: a hit must be the last equal element in a sorted
+   table and the first in sorted order in an Eytzinger one.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "check.h"
+
+#define MAX 70
+
+static uint16_t sorted16[MAX], tree16[MAX];
+static uint32_t sorted32[MAX], tree32[MAX];
+/* Where each element of the sorted table lands in the tree.  */
+static uint32_t index32[MAX], where[MAX];
+
+/* The index of the last element equal to KEY, or -1.  */
+static int
+last_equal (uint32_t key, size_t n)
+{
+  int i;
+
+  for (i = (int) n - 1; i >= 0; i--)
+    if (sorted32[i] == key)
+      return i;
+  return -1;
+}
+
+static int
+first_equal (uint32_t key, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    if (sorted32[i] == key)
+      return (int) i;
+  return -1;
+}
+
+static void
+check_table (size_t n)
+{
+  const uint16_t *p16;
+  const uint32_t *p32;
+  uint32_t key;
+  size_t i;
+  int at;
+
+  for (i = 0; i < n; i++)
+    {
+      sorted16[i] = (uint16_t) sorted32[i];
+      index32[i] = i;
+    }
+  eytzinger_u16 (tree16, sorted16, n);
+  eytzinger_u32 (tree32, sorted32, n);
+  eytzinger_u32 (where, index32, n);
+  for (i = 0; i < n; i++)
+    {
+      CHECK (tree32[i] == sorted32[where[i]]);
+      CHECK (tree16[i] == sorted16[where[i]]);
+    }
+
+  for (key = 0; key <= (n ? sorted32[n - 1] + 1 : 1); key++)
+    {
+      at = last_equal (key, n);
+      p16 = bsearch_u16 ((uint16_t) key, sorted16, n);
+      p32 = bsearch_u32 (key, sorted32, n);
+      if (at < 0)
+	{
+	  CHECK (p16 == NULL && p32 == NULL);
+	}
+      else
+	{
+	  CHECK (p16 == &sorted16[at] && p32 == &sorted32[at]);
+	}
+
+      at = first_equal (key, n);
+      p16 = bsearch_eytzinger_u16 ((uint16_t) key, tree16, n);
+      p32 = bsearch_eytzinger_u32 (key, tree32, n);
+      if (at < 0)
+	{
+	  CHECK (p16 == NULL && p32 == NULL);
+	}
+      else
+	{
+	  CHECK (p16 != NULL && where[p16 - tree16] == (uint32_t) at);
+	  CHECK (p32 != NULL && where[p32 - tree32] == (uint32_t) at);
+	}
+    }
+}
+
+int
+main (void)
+{
+  size_t n, i;
+
+  for (n = 0; n <= MAX; n++)
+    {
+      /* Odd keys only, so that every even key misses.  */
+      for (i = 0; i < n; i++)
+	sorted32[i] = 2 * i + 1;
+      check_table (n);
+
+      /* Runs of equal keys.  */
+      for (i = 0; i < n; i++)
+	sorted32[i] = 2 * (i / 3) + 1;
+      check_table (n);
+
+      /* All equal.  */
+      for (i = 0; i < n; i++)
+	sorted32[i] = 5;
+      check_table (n);
+    }
+
+  /* The extremes of the types.  */
+  {
+    static const uint16_t a[] = { 0, 1, 0x7fff, 0x8000, UINT16_MAX };
+    static const uint32_t b[] = { 0, 1, 0x7fffffff, 0x80000000, UINT32_MAX };
+    uint16_t ta[5];
+    uint32_t tb[5];
+
+    eytzinger_u16 (ta, a, 5);
+    eytzinger_u32 (tb, b, 5);
+    for (i = 0; i < 5; i++)
+      {
+	CHECK (bsearch_u16 (a[i], a, 5) == &a[i]);
+	CHECK (bsearch_u32 (b[i], b, 5) == &b[i]);
+	CHECK (*bsearch_eytzinger_u16 (a[i], ta, 5) == a[i]);
+	CHECK (*bsearch_eytzinger_u32 (b[i], tb, 5) == b[i]);
+      }
+    CHECK (bsearch_u16 (2, a, 5) == NULL);
+    CHECK (bsearch_u32 (UINT32_MAX - 1, b, 5) == NULL);
+    CHECK (bsearch_eytzinger_u16 (UINT16_MAX - 1, ta, 5) == NULL);
+    CHECK (bsearch_eytzinger_u32 (2, tb, 5) == NULL);
+  }
+
+  exit (0);
+}
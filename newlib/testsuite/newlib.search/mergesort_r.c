@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* mergesort_r must be stable, with scratch of exactly (n + 1) / 2
+   elements and with none, for runs below, at and above the insertion
+   sort cutoff and for inputs that make it gallop.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+
+#define MAX 600
+
+struct rec
+{
+  unsigned short key;
+  unsigned short seq;
+};
+
+static struct rec a[MAX];
+static unsigned long seed = 1;
+static int calls;
+
+static unsigned int
+next (void)
+{
+  seed = seed * 1103515245 + 12345;
+  return (unsigned int) (seed >> 16) & 0x7fff;
+}
+
+static int
+by_key (const void *x, const void *y, void *thunk)
+{
+  const struct rec *p = x, *q = y;
+
+  CHECK (thunk == &calls);
+  calls++;
+  return (p->key > q->key) - (p->key < q->key);
+}
+
+static int
+by_char (const void *x, const void *y, void *thunk)
+{
+  return *(const char *) x - *(const char *) y;
+}
+
+static void
+fill (size_t n, int pattern)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      switch (pattern)
+	{
+	case 0:	/* random, many equal keys */
+	  a[i].key = next () % 8;
+	  break;
+	case 1:	/* random, few equal keys */
+	  a[i].key = next ();
+	  break;
+	case 2:	/* ascending */
+	  a[i].key = i / 3;
+	  break;
+	case 3:	/* descending */
+	  a[i].key = n - i / 3;
+	  break;
+	case 4:	/* two ascending halves, so the merge gallops */
+	  a[i].key = i < n / 2 ? i : i - n / 2;
+	  break;
+	default: /* all equal */
+	  a[i].key = 7;
+	  break;
+	}
+      a[i].seq = i;
+    }
+}
+
+static void
+check_sorted (size_t n)
+{
+  size_t i;
+
+  for (i = 1; i < n; i++)
+    {
+      CHECK (a[i - 1].key <= a[i].key);
+      if (a[i - 1].key == a[i].key)
+	CHECK (a[i - 1].seq < a[i].seq);
+    }
+}
+
+int
+main (void)
+{
+  size_t n;
+  int pattern;
+
+  for (n = 0; n <= MAX; n += n < 40 ? 1 : 37)
+    for (pattern = 0; pattern < 6; pattern++)
+      {
+	/* Exactly the scratch documented, from malloc so that a checking
+	   allocator sees any overrun.  */
+	size_t size = (n + 1) / 2 * sizeof (struct rec);
+	struct rec *scratch = malloc (size);
+
+	CHECK (scratch != NULL || size == 0);
+	fill (n, pattern);
+	mergesort_r (a, n, sizeof (struct rec), by_key, &calls, scratch);
+	check_sorted (n);
+	free (scratch);
+
+	fill (n, pattern);
+	mergesort_r (a, n, sizeof (struct rec), by_key, &calls, NULL);
+	check_sorted (n);
+      }
+
+  /* Still sorted when sorted again, and a sorted input takes about one
+     comparison per element.  */
+  fill (MAX, 2);
+  calls = 0;
+  mergesort_r (a, MAX, sizeof (struct rec), by_key, &calls, NULL);
+  check_sorted (MAX);
+  CHECK (calls < 2 * MAX);
+
+  /* An element size that is not a multiple of a word.  */
+  {
+    static char s[] = "the quick brown fox jumps over the lazy dog";
+    char tmp[(sizeof (s) + 1) / 2];
+    size_t i;
+
+    mergesort_r (s, sizeof (s) - 1, 1, by_char, NULL, tmp);
+    for (i = 1; i < sizeof (s) - 1; i++)
+      CHECK (s[i - 1] <= s[i]);
+  }
+
+  exit (0);
+}
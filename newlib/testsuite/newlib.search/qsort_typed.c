@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* qsort_i16, qsort_u16, qsort_i32, qsort_f32 and qsort against an
+   insertion sort, on the inputs that push a quicksort to its depth
+   limit and through its heapsort: sorted, reversed, organ pipe,
+   sawtooth and constant arrays, besides random ones.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "check.h"
+
+#define MAX 700
+
+static int32_t in[MAX], ref[MAX];
+static int16_t s16[MAX];
+static uint16_t u16[MAX];
+static int32_t s32[MAX];
+static float f32[MAX];
+static int32_t q32[MAX];
+static unsigned long seed = 1;
+
+static int32_t
+next (void)
+{
+  seed = seed * 1103515245 + 12345;
+  return (int32_t) (seed >> 8);
+}
+
+static void
+fill (size_t n, int pattern)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    switch (pattern)
+      {
+      case 0:
+	in[i] = next ();
+	break;
+      case 1:
+	in[i] = next () % 5 - 2;
+	break;
+      case 2:
+	in[i] = i;
+	break;
+      case 3:
+	in[i] = n - i;
+	break;
+      case 4:
+	in[i] = i < n / 2 ? i : n - i;
+	break;
+      case 5:
+	in[i] = i % 17;
+	break;
+      default:
+	in[i] = 42;
+	break;
+      }
+}
+
+static void
+reference (size_t n)
+{
+  size_t i, j;
+
+  memcpy (ref, in, n * sizeof (ref[0]));
+  for (i = 1; i < n; i++)
+    {
+      int32_t v = ref[i];
+
+      for (j = i; j > 0 && v < ref[j - 1]; j--)
+	ref[j] = ref[j - 1];
+      ref[j] = v;
+    }
+}
+
+static int
+cmp_i32 (const void *x, const void *y)
+{
+  int32_t a = *(const int32_t *) x, b = *(const int32_t *) y;
+
+  return (a > b) - (a < b);
+}
+
+static void
+check_i16 (size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    s16[i] = (int16_t) (in[i] >> 16);
+  qsort_i16 (s16, n);
+  for (i = 1; i < n; i++)
+    CHECK (s16[i - 1] <= s16[i]);
+}
+
+static void
+check_u16 (size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    u16[i] = (uint16_t) in[i];
+  qsort_u16 (u16, n);
+  for (i = 1; i < n; i++)
+    CHECK (u16[i - 1] <= u16[i]);
+}
+
+int
+main (void)
+{
+  size_t n, i;
+  int pattern;
+
+  for (n = 0; n <= MAX; n += n < 30 ? 1 : 67)
+    for (pattern = 0; pattern < 7; pattern++)
+      {
+	fill (n, pattern);
+	reference (n);
+
+	memcpy (s32, in, n * sizeof (s32[0]));
+	qsort_i32 (s32, n);
+	CHECK (memcmp (s32, ref, n * sizeof (s32[0])) == 0);
+
+	memcpy (q32, in, n * sizeof (q32[0]));
+	qsort (q32, n, sizeof (q32[0]), cmp_i32);
+	CHECK (memcmp (q32, ref, n * sizeof (q32[0])) == 0);
+
+	/* Small enough to be exact in a float.  */
+	for (i = 0; i < n; i++)
+	  f32[i] = (float) (in[i] % 65536);
+	qsort_f32 (f32, n);
+	for (i = 1; i < n; i++)
+	  CHECK (f32[i - 1] <= f32[i]);
+
+	check_i16 (n);
+	check_u16 (n);
+      }
+
+  /* The ends of each range, and the order qsort_f32 documents for
+     signed zeros.  */
+  {
+    int16_t a[] = { 0, INT16_MAX, -1, INT16_MIN, 1, INT16_MIN, INT16_MAX };
+    uint16_t b[] = { UINT16_MAX, 0, 1, UINT16_MAX, 0x8000, 0x7fff };
+    int32_t c[] = { INT32_MAX, 0, INT32_MIN, -1, 1, INT32_MIN };
+    float d[] = { 1.0f, 0.0f, -0.0f, -1.0f, -0.0f, 0.0f };
+
+    qsort_i16 (a, 7);
+    CHECK (a[0] == INT16_MIN && a[1] == INT16_MIN && a[2] == -1
+	   && a[3] == 0 && a[4] == 1 && a[6] == INT16_MAX);
+    qsort_u16 (b, 6);
+    CHECK (b[0] == 0 && b[1] == 1 && b[2] == 0x7fff && b[3] == 0x8000
+	   && b[5] == UINT16_MAX);
+    qsort_i32 (c, 6);
+    CHECK (c[0] == INT32_MIN && c[2] == -1 && c[5] == INT32_MAX);
+    qsort_f32 (d, 6);
+    CHECK (d[0] == -1.0f && d[5] == 1.0f);
+    for (i = 1; i < 3; i++)
+      CHECK (d[i] == 0 && (1 / d[i]) < 0);
+    for (i = 3; i < 5; i++)
+      CHECK (d[i] == 0 && (1 / d[i]) > 0);
+  }
+
+  exit (0);
+}
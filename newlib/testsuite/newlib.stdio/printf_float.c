@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* %e and %f of FLT_MIN and of the floats with the most significant
+   digits, the largest subnormal and the float below 2 * FLT_MIN, at a
+   precision past all of them: the digits must be exact and then zeros
+   to the full precision, and the conversion must stay within its
+   buffer.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include "check.h"
+
+/* The 36 zeros after the point of %f for these values.  */
+#define Z36 "000000000000000000000000000000000000"
+
+static void
+check (const char *fmt, double value, const char *head, const char *tail,
+       int len)
+{
+  char buf[256];
+  int n, h = strlen (head), t = strlen (tail), i;
+
+  n = snprintf (buf, sizeof (buf), fmt, value);
+  CHECK (n == len);
+  CHECK (strncmp (buf, head, h) == 0);
+  for (i = h; i < n - t; i++)
+    CHECK (buf[i] == '0');
+  CHECK (strcmp (buf + n - t, tail) == 0);
+}
+
+int
+main (void)
+{
+  check ("%.113e", FLT_MIN,
+	 "1.17549435082228750796873653722224567781866555677208752150875170"
+	 "62784172594547271728515625", "e-38", 119);
+  check ("%.152f", FLT_MIN,
+	 "0." Z36 "0"
+	 "11754943508222875079687365372222456778186655567720875215087517062"
+	 "784172594547271728515625", "", 154);
+
+  check ("%.120e", (double) 0x1.fffffcp-127f,
+	 "1.17549421069244107548702944484928734882705242874589333385717453"
+	 "0571588870475618904265502351336181163787841796875", "e-38", 126);
+  check ("%.160f", (double) 0x1.fffffcp-127f,
+	 "0." Z36 "0"
+	 "11754942106924410754870294448492873488270524287458933338571745305"
+	 "71588870475618904265502351336181163787841796875", "", 162);
+
+  check ("%.120e", (double) 0x1.fffffep-126f,
+	 "2.35098856151472858345576598207153302664571798551798085536592623"
+	 "6850006129930346077117064851336181163787841796875", "e-38", 126);
+  check ("%.160f", (double) 0x1.fffffep-126f,
+	 "0." Z36 "0"
+	 "23509885615147285834557659820715330266457179855179808553659262368"
+	 "50006129930346077117064851336181163787841796875", "", 162);
+
+  exit (0);
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* The csv_next functions on the limits of a 32-bit integer, empty and
+   blank fields, doubled quotes, quotes left open, cut strings and
+   records ended by "\r\n".  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <csv.h>
+#include "check.h"
+
+static void
+test_i32 (void)
+{
+  struct csv_cursor c;
+  int32_t v;
+
+  csv_init (&c, "1,-2147483648,2147483647,2147483648,-2147483649,,  ,"
+	    " x1,3 4, +5 \r\nnext", ',');
+  CHECK (csv_next_i32 (&c, &v) == 0 && v == 1);
+  CHECK (csv_next_i32 (&c, &v) == 0 && v == INT32_MIN);
+  CHECK (csv_next_i32 (&c, &v) == 0 && v == INT32_MAX);
+  CHECK (csv_next_i32 (&c, &v) == CSV_RANGE && v == INT32_MAX);
+  CHECK (csv_next_i32 (&c, &v) == CSV_RANGE && v == INT32_MIN);
+  v = 9;
+  CHECK (csv_next_i32 (&c, &v) == CSV_EMPTY && v == 9);
+  CHECK (csv_next_i32 (&c, &v) == CSV_EMPTY && v == 9);
+  CHECK (csv_next_i32 (&c, &v) == CSV_SYNTAX && v == 9);
+  CHECK (csv_next_i32 (&c, &v) == CSV_SYNTAX && v == 9);
+  CHECK (csv_next_i32 (&c, &v) == 0 && v == 5);
+  CHECK (csv_next_i32 (&c, &v) == CSV_END);
+  CHECK (csv_next_i32 (&c, &v) == CSV_END);
+  CHECK (strcmp (c.p, "next") == 0);
+
+  /* Blanks are not skipped when they are the separator.  */
+  csv_init (&c, "7\t\t-8", '\t');
+  CHECK (csv_next_i32 (&c, &v) == 0 && v == 7);
+  CHECK (csv_next_i32 (&c, &v) == CSV_EMPTY);
+  CHECK (csv_next_i32 (&c, &v) == 0 && v == -8);
+  CHECK (csv_next_i32 (&c, &v) == CSV_END);
+
+  /* An empty record is one empty field.  */
+  csv_init (&c, "", ',');
+  CHECK (csv_next_i32 (&c, &v) == CSV_EMPTY);
+  CHECK (csv_next_i32 (&c, &v) == CSV_END);
+  CHECK (*c.p == '\0');
+}
+
+#ifndef _REENT_ONLY
+static void
+test_f32 (void)
+{
+  struct csv_cursor c;
+  float f;
+
+  csv_init (&c, "1.5, -0.25 ,1e40,-1e40,abc,2.5x,,", ',');
+  CHECK (csv_next_f32 (&c, &f) == 0 && f == 1.5f);
+  CHECK (csv_next_f32 (&c, &f) == 0 && f == -0.25f);
+  CHECK (csv_next_f32 (&c, &f) == CSV_RANGE && isinf (f) && f > 0);
+  CHECK (csv_next_f32 (&c, &f) == CSV_RANGE && isinf (f) && f < 0);
+  f = 3;
+  CHECK (csv_next_f32 (&c, &f) == CSV_SYNTAX && f == 3);
+  CHECK (csv_next_f32 (&c, &f) == CSV_SYNTAX && f == 3);
+  CHECK (csv_next_f32 (&c, &f) == CSV_EMPTY);
+  CHECK (csv_next_f32 (&c, &f) == CSV_EMPTY);
+  CHECK (csv_next_f32 (&c, &f) == CSV_END);
+}
+#endif
+
+static void
+test_str (void)
+{
+  struct csv_cursor c;
+  char buf[16];
+
+  csv_init (&c, "plain,\"a\"\"b\",\"with,comma\",\"\",,\"two\nlines\","
+	    "\"ab\"x,last", ',');
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == 5
+	 && strcmp (buf, "plain") == 0);
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == 3
+	 && strcmp (buf, "a\"b") == 0);
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == 10
+	 && strcmp (buf, "with,comma") == 0);
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == 0 && buf[0] == '\0');
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == 0 && buf[0] == '\0');
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == 9
+	 && strcmp (buf, "two\nlines") == 0);
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == CSV_SYNTAX);
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == 4
+	 && strcmp (buf, "last") == 0);
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == CSV_END);
+
+  /* Cut to the buffer, the length still that of the field.  */
+  csv_init (&c, "hello,\"quo\"\"ted\"", ',');
+  CHECK (csv_next_str (&c, buf, 3) == 5 && strcmp (buf, "he") == 0);
+  CHECK (csv_next_str (&c, buf, 5) == 7 && strcmp (buf, "quo\"") == 0);
+  CHECK (csv_next_str (&c, buf, 0) == CSV_END);
+
+  /* A quote left open runs to the end of the buffer.  */
+  csv_init (&c, "\"open,\r\nmore", ',');
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == CSV_SYNTAX);
+  CHECK (strcmp (buf, "open,\r\nmore") == 0);
+  CHECK (csv_next_str (&c, buf, sizeof (buf)) == CSV_END);
+  CHECK (*c.p == '\0');
+}
+
+static void
+test_records (void)
+{
+  static const char text[] = "1,a\r\n2,b\n\r\n3,\"c\r\nd\"\r\n";
+  struct csv_cursor c;
+  char buf[8];
+  int32_t v;
+  const char *p = text;
+  int n = 0;
+
+  while (*p)
+    {
+      csv_init (&c, p, ',');
+      if (csv_next_i32 (&c, &v) == 0)
+	{
+	  CHECK (v == ++n);
+	  CHECK (csv_next_str (&c, buf, sizeof (buf)) >= 1);
+	  CHECK (buf[0] == 'a' + n - 1);
+	}
+      else
+	CHECK (n == 2);	/* the empty record */
+      CHECK (csv_next_str (&c, buf, sizeof (buf)) == CSV_END);
+      CHECK (c.p > p);
+      p = c.p;
+    }
+  CHECK (n == 3);
+  CHECK (strcmp (buf, "c\r\nd") == 0);
+}
+
+int
+main (void)
+{
+  test_i32 ();
+#ifndef _REENT_ONLY
+  test_f32 ();
+#endif
+  test_str ();
+  test_records ();
+  exit (0);
+}
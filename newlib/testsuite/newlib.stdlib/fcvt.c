@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* ecvt, fcvt, ecvtbuf and fcvtbuf of FLT_MIN and of the floats with
+   the most significant digits, the largest subnormal and the float
+   below 2 * FLT_MIN, for more digits than any float has: the digits
+   must be exact, then zeros to the count asked for.  */
+
+#define _XOPEN_SOURCE 500
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include "check.h"
+
+#define SUB_DIGITS \
+  "11754942106924410754870294448492873488270524287458933338571745305" \
+  "71588870475618904265502351336181163787841796875"
+#define TOP_DIGITS \
+  "23509885615147285834557659820715330266457179855179808553659262368" \
+  "50006129930346077117064851336181163787841796875"
+
+static void
+check (const char *p, int decpt, int sign, const char *head, size_t len)
+{
+  size_t i, h = strlen (head);
+
+  CHECK (p != NULL);
+  CHECK (decpt == -37 && sign == 0);
+  CHECK (strlen (p) == len);
+  CHECK (strncmp (p, head, h) == 0);
+  for (i = h; i < len; i++)
+    CHECK (p[i] == '0');
+}
+
+int
+main (void)
+{
+  char buf[200];
+  int decpt, sign;
+  char *p;
+
+  /* Rounded at the 120th place, the 83rd digit.  */
+  p = fcvt (FLT_MIN, 120, &decpt, &sign);
+  check (p, decpt, sign,
+	 "11754943508222875079687365372222456778186655567720875215087517062"
+	 "784172594547271729", 83);
+
+  p = fcvt ((double) 0x1.fffffcp-127f, 160, &decpt, &sign);
+  check (p, decpt, sign, SUB_DIGITS, 160 - 37);
+  p = ecvt ((double) 0x1.fffffep-126f, 120, &decpt, &sign);
+  check (p, decpt, sign, TOP_DIGITS, 120);
+
+  p = ecvtbuf ((double) 0x1.fffffcp-127f, 130, &decpt, &sign, buf);
+  CHECK (p == buf);
+  check (p, decpt, sign, SUB_DIGITS, 130);
+  p = fcvtbuf ((double) 0x1.fffffep-126f, 150, &decpt, &sign, buf);
+  CHECK (p == buf);
+  check (p, decpt, sign, TOP_DIGITS, 150 - 37);
+
+  exit (0);
+}
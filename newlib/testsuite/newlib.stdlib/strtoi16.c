@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* strtoi16, strtou16 and strtou32 at and past their limits in the
+   bases that shift, divide and fold to constants, and with the bases
+   outside 0 and 2 to 36 that they fail with EINVAL.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include "check.h"
+
+#define TRY(fn, str, base, want, err, used) \
+  do { \
+    char *end; \
+    errno = 0; \
+    CHECK (fn (str, &end, base) == (want)); \
+    CHECK (errno == (err)); \
+    CHECK (end == (char *) (str) + (used)); \
+  } while (0)
+
+int
+main (void)
+{
+  static const int bad[] = { -1, 1, 37, 100 };
+  char *end;
+  int i;
+
+  TRY (strtoi16, "32767", 10, INT16_MAX, 0, 5);
+  TRY (strtoi16, "-32768", 10, INT16_MIN, 0, 6);
+  TRY (strtoi16, "32768", 10, INT16_MAX, ERANGE, 5);
+  TRY (strtoi16, "-32769", 10, INT16_MIN, ERANGE, 6);
+  TRY (strtoi16, "  +7fff", 16, INT16_MAX, 0, 7);
+  TRY (strtoi16, "-0x8000", 0, INT16_MIN, 0, 7);
+  TRY (strtoi16, "0x8000", 0, INT16_MAX, ERANGE, 6);
+  TRY (strtoi16, "077777", 0, INT16_MAX, 0, 6);
+  TRY (strtoi16, "100000", 8, INT16_MAX, ERANGE, 6);
+  TRY (strtoi16, "pa7", 36, INT16_MAX, 0, 3);
+  TRY (strtoi16, "pa8", 36, INT16_MAX, ERANGE, 3);
+  TRY (strtoi16, "-pa8", 36, INT16_MIN, 0, 4);
+  TRY (strtoi16, "-pa9", 36, INT16_MIN, ERANGE, 4);
+
+  TRY (strtou16, "65535", 10, UINT16_MAX, 0, 5);
+  TRY (strtou16, "65536", 10, UINT16_MAX, ERANGE, 5);
+  TRY (strtou16, "-1", 10, UINT16_MAX, 0, 2);
+  TRY (strtou16, "1111111111111111", 2, UINT16_MAX, 0, 16);
+  TRY (strtou16, "10000000000000000", 2, UINT16_MAX, ERANGE, 17);
+  TRY (strtou16, "1ekf", 36, UINT16_MAX, 0, 4);
+  TRY (strtou16, "1ekg", 36, UINT16_MAX, ERANGE, 4);
+  TRY (strtou16, "12z", 10, 12, 0, 2);
+  TRY (strtou16, "", 10, 0, 0, 0);
+
+  TRY (strtou32, "4294967295", 10, UINT32_MAX, 0, 10);
+  TRY (strtou32, "4294967296", 10, UINT32_MAX, ERANGE, 10);
+  TRY (strtou32, "99999999999999999999", 10, UINT32_MAX, ERANGE, 20);
+  TRY (strtou32, "0xffffffff", 0, UINT32_MAX, 0, 10);
+  TRY (strtou32, "0x100000000", 0, UINT32_MAX, ERANGE, 11);
+  TRY (strtou32, "3vvvvvv", 32, UINT32_MAX, 0, 7);
+  TRY (strtou32, "4000000", 32, UINT32_MAX, ERANGE, 7);
+  TRY (strtou32, "1z141z3", 36, UINT32_MAX, 0, 7);
+  TRY (strtou32, "1z141z4", 36, UINT32_MAX, ERANGE, 7);
+  TRY (strtou32, "-4294967295", 10, 1, 0, 11);
+
+  for (i = 0; i < (int) (sizeof (bad) / sizeof (bad[0])); i++)
+    {
+      errno = 0;
+      CHECK (strtoi16 ("12", &end, bad[i]) == 0 && errno == EINVAL);
+      errno = 0;
+      CHECK (strtou16 ("12", &end, bad[i]) == 0 && errno == EINVAL);
+      errno = 0;
+      CHECK (strtou32 ("12", &end, bad[i]) == 0 && errno == EINVAL);
+    }
+
+  exit (0);
+}